@@ -1,7 +1,7 @@
 /*
 ******************************************************************************
 *
-*   Copyright (C) 2007-2012, International Business Machines
+*   Copyright (C) 2007-2016, International Business Machines
 *   Corporation and others.  All Rights Reserved.
 *
 ******************************************************************************
@@ -24,11 +24,63 @@
 
 U_NAMESPACE_BEGIN
 
+namespace {
+
+/*
+ * 1 and bit 7 in each byte of a 64-bit word.
+ */
+const uint64_t ONES8=UINT64_C(0x0101010101010101);
+const uint64_t HIGH8=UINT64_C(0x8080808080808080);
+
+/*
+ * For a word with bit 7 set in at least one of its bytes and no other bits,
+ * returns the number of bytes before the first one with bit 7 set,
+ * in memory order.
+ */
+inline int32_t bytesBeforeFirst(uint64_t bits) {
+#if U_IS_BIG_ENDIAN
+    // Smear bit 7 into the less significant bytes and count the bytes
+    // from the most significant one with bit 7 set.
+    bits|=bits>>8;
+    bits|=bits>>16;
+    bits|=bits>>32;
+    return 8-(int32_t)(((bits>>7)*ONES8)>>56);
+#else
+    // Count the bytes below the least significant one with bit 7 set.
+    return (int32_t)((((((bits&(0-bits))-1)>>7)&ONES8)*ONES8)>>56);
+#endif
+}
+
+/*
+ * For a word with bit 7 set in at least one of its bytes and no other bits,
+ * returns the number of bytes after the last one with bit 7 set,
+ * in memory order.
+ */
+inline int32_t bytesAfterLast(uint64_t bits) {
+#if U_IS_BIG_ENDIAN
+    return (int32_t)((((((bits&(0-bits))-1)>>7)&ONES8)*ONES8)>>56);
+#else
+    bits|=bits>>8;
+    bits|=bits>>16;
+    bits|=bits>>32;
+    return 8-(int32_t)(((bits>>7)*ONES8)>>56);
+#endif
+}
+
+}  // namespace
+
 BMPSet::BMPSet(const int32_t *parentList, int32_t parentListLength) :
         list(parentList), listLength(parentListLength) {
+    initTables();
+}
+
+void BMPSet::initTables() {
     uprv_memset(asciiBytes, 0, sizeof(asciiBytes));
     uprv_memset(table7FF, 0, sizeof(table7FF));
     uprv_memset(bmpBlockBits, 0, sizeof(bmpBlockBits));
+    asciiRangeCount=0;
+    uprv_memset(asciiLoAdd8, 0, sizeof(asciiLoAdd8));
+    uprv_memset(asciiHiAdd8, 0, sizeof(asciiHiAdd8));
 
     /*
      * Set the list indexes for binary searches for
@@ -51,14 +103,68 @@ BMPSet::BMPSet(const int32_t *parentList, int32_t parentListLength) :
 BMPSet::BMPSet(const BMPSet &otherBMPSet, const int32_t *newParentList, int32_t newParentListLength) :
         list(newParentList), listLength(newParentListLength) {
     uprv_memcpy(asciiBytes, otherBMPSet.asciiBytes, sizeof(asciiBytes));
+    asciiRangeCount=otherBMPSet.asciiRangeCount;
+    uprv_memcpy(asciiLoAdd8, otherBMPSet.asciiLoAdd8, sizeof(asciiLoAdd8));
+    uprv_memcpy(asciiHiAdd8, otherBMPSet.asciiHiAdd8, sizeof(asciiHiAdd8));
     uprv_memcpy(table7FF, otherBMPSet.table7FF, sizeof(table7FF));
     uprv_memcpy(bmpBlockBits, otherBMPSet.bmpBlockBits, sizeof(bmpBlockBits));
     uprv_memcpy(list4kStarts, otherBMPSet.list4kStarts, sizeof(list4kStarts));
 }
 
+BMPSet::BMPSet(const int32_t *parentList, int32_t parentListLength, const void *tables) :
+        list(parentList), listLength(parentListLength) {
+    const uint8_t *p=(const uint8_t *)tables;
+    uprv_memcpy(asciiLoAdd8, p, sizeof(asciiLoAdd8));
+    p+=sizeof(asciiLoAdd8);
+    uprv_memcpy(asciiHiAdd8, p, sizeof(asciiHiAdd8));
+    p+=sizeof(asciiHiAdd8);
+    uprv_memcpy(table7FF, p, sizeof(table7FF));
+    p+=sizeof(table7FF);
+    uprv_memcpy(bmpBlockBits, p, sizeof(bmpBlockBits));
+    p+=sizeof(bmpBlockBits);
+    uprv_memcpy(list4kStarts, p, sizeof(list4kStarts));
+    p+=sizeof(list4kStarts);
+    uprv_memcpy(&asciiRangeCount, p, sizeof(asciiRangeCount));
+    p+=sizeof(asciiRangeCount);
+    uprv_memcpy(asciiBytes, p, sizeof(asciiBytes));
+
+    // The tables index into the list; do not trust them beyond its bounds.
+    UBool isValid= -1<=asciiRangeCount && asciiRangeCount<=MAX_ASCII_RANGES;
+    for(int32_t i=0; isValid && i<=0x11; ++i) {
+        isValid= 0<=list4kStarts[i] && list4kStarts[i]<listLength &&
+                 (i==0 || list4kStarts[i-1]<=list4kStarts[i]);
+    }
+    if(!isValid) {
+        initTables();
+    }
+}
+
 BMPSet::~BMPSet() {
 }
 
+int32_t BMPSet::getTablesLength() {
+    // asciiLoAdd8, asciiHiAdd8, table7FF, bmpBlockBits, list4kStarts, asciiRangeCount, asciiBytes
+    return (int32_t)(2*MAX_ASCII_RANGES*sizeof(uint64_t)+2*64*sizeof(uint32_t)+
+                     18*sizeof(int32_t)+sizeof(int32_t)+0xc0*sizeof(UBool));
+}
+
+void BMPSet::getTables(void *dest) const {
+    uint8_t *p=(uint8_t *)dest;
+    uprv_memcpy(p, asciiLoAdd8, sizeof(asciiLoAdd8));
+    p+=sizeof(asciiLoAdd8);
+    uprv_memcpy(p, asciiHiAdd8, sizeof(asciiHiAdd8));
+    p+=sizeof(asciiHiAdd8);
+    uprv_memcpy(p, table7FF, sizeof(table7FF));
+    p+=sizeof(table7FF);
+    uprv_memcpy(p, bmpBlockBits, sizeof(bmpBlockBits));
+    p+=sizeof(bmpBlockBits);
+    uprv_memcpy(p, list4kStarts, sizeof(list4kStarts));
+    p+=sizeof(list4kStarts);
+    uprv_memcpy(p, &asciiRangeCount, sizeof(asciiRangeCount));
+    p+=sizeof(asciiRangeCount);
+    uprv_memcpy(p, asciiBytes, sizeof(asciiBytes));
+}
+
 /*
  * Set bits in a bit rectangle in "vertical" bit organization.
  * start<limit<=0x800
@@ -129,6 +235,14 @@ void BMPSet::initBits() {
         if(start>=0x80) {
             break;
         }
+        if(0<=asciiRangeCount && asciiRangeCount<MAX_ASCII_RANGES) {
+            UChar32 hi=limit<=0x80 ? limit-1 : 0x7f;
+            asciiLoAdd8[asciiRangeCount]=(uint64_t)(0x80-start)*ONES8;
+            asciiHiAdd8[asciiRangeCount]=(uint64_t)(0x7f-hi)*ONES8;
+            ++asciiRangeCount;
+        } else {
+            asciiRangeCount=-1;
+        }
         do {
             asciiBytes[start++]=1;
         } while(start<limit && start<0x80);
@@ -300,6 +414,60 @@ BMPSet::contains(UChar32 c) const {
     }
 }
 
+/*
+ * Returns bit 7 set in each byte of w whose ASCII value is in the set.
+ * Bytes must have bit 7 clear on input, so that the additions do not carry.
+ */
+inline uint64_t BMPSet::containsASCIIBytes(uint64_t w) const {
+    // Unused ranges have zero addends and never match.
+    return (((w+asciiLoAdd8[0])&~(w+asciiHiAdd8[0])) |
+            ((w+asciiLoAdd8[1])&~(w+asciiHiAdd8[1])) |
+            ((w+asciiLoAdd8[2])&~(w+asciiHiAdd8[2])) |
+            ((w+asciiLoAdd8[3])&~(w+asciiHiAdd8[3])))&HIGH8;
+}
+
+/*
+ * Bit 7 of a byte is set in the "stop" word if the byte is not ASCII
+ * or its contains() result differs from the spanCondition.
+ * Non-ASCII bytes are classified with their low 7 bits,
+ * which is harmless because they stop the span anyway.
+ */
+const uint8_t *
+BMPSet::spanASCIIUTF8(const uint8_t *s, const uint8_t *limit, USetSpanCondition spanCondition) const {
+    if(asciiRangeCount<0) {
+        return s;
+    }
+    uint64_t notInSpan=spanCondition ? HIGH8 : 0;
+    uint64_t w;
+    while((limit-s)>=8) {
+        uprv_memcpy(&w, s, 8);
+        uint64_t stop=(w&HIGH8)|(containsASCIIBytes(w&~HIGH8)^notInSpan);
+        if(stop!=0) {
+            return s+bytesBeforeFirst(stop);
+        }
+        s+=8;
+    }
+    return s;
+}
+
+const uint8_t *
+BMPSet::spanBackASCIIUTF8(const uint8_t *s, const uint8_t *limit, USetSpanCondition spanCondition) const {
+    if(asciiRangeCount<0) {
+        return limit;
+    }
+    uint64_t notInSpan=spanCondition ? HIGH8 : 0;
+    uint64_t w;
+    while((limit-s)>=8) {
+        uprv_memcpy(&w, limit-8, 8);
+        uint64_t stop=(w&HIGH8)|(containsASCIIBytes(w&~HIGH8)^notInSpan);
+        if(stop!=0) {
+            return limit-bytesAfterLast(stop);
+        }
+        limit-=8;
+    }
+    return limit;
+}
+
 /*
  * Check for sufficient length for trail unit for each surrogate pair.
  * Handle single surrogates as surrogate code points as usual in ICU.
@@ -497,21 +665,50 @@ BMPSet::spanUTF8(const uint8_t *s, int32_t length, USetSpanCondition spanConditi
     uint8_t b=*s;
     if((int8_t)b>=0) {
         // Initial all-ASCII span.
+        // Stop after MIN_ASCII_RUN bytes to continue a word at a time.
+        const uint8_t *runLimit=length>MIN_ASCII_RUN ? s+MIN_ASCII_RUN : limit;
         if(spanCondition) {
             do {
-                if(!asciiBytes[b] || ++s==limit) {
+                if(!asciiBytes[b]) {
                     return s;
+                } else if(++s==runLimit) {
+                    break;
                 }
                 b=*s;
             } while((int8_t)b>=0);
         } else {
             do {
-                if(asciiBytes[b] || ++s==limit) {
+                if(asciiBytes[b]) {
                     return s;
+                } else if(++s==runLimit) {
+                    break;
                 }
                 b=*s;
             } while((int8_t)b>=0);
         }
+        if(s==limit) {
+            return s;
+        }
+        length=(int32_t)(limit-s);
+    }
+    // The rest is in a separate function so that short all-ASCII spans
+    // return without saving the registers that it needs.
+    return spanUTF8Rest(s, length, spanCondition);
+}
+
+/*
+ * The part of spanUTF8() after its initial all-ASCII span:
+ * s starts with a non-ASCII byte, or with the rest of a long ASCII run.
+ */
+const uint8_t *
+BMPSet::spanUTF8Rest(const uint8_t *s, int32_t length, USetSpanCondition spanCondition) const {
+    const uint8_t *limit=s+length;
+    uint8_t b=*s;
+    if((int8_t)b>=0) {
+        s=spanASCIIUTF8(s, limit, spanCondition);
+        if(s==limit) {
+            return s;
+        }
         length=(int32_t)(limit-s);
     }
 
@@ -563,12 +760,21 @@ BMPSet::spanUTF8(const uint8_t *s, int32_t length, USetSpanCondition spanConditi
         b=*s;
         if(b<0xc0) {
             // ASCII; or trail bytes with the result of contains(FFFD).
+            // Continue a word at a time after MIN_ASCII_RUN bytes.
+            const uint8_t *runLimit=(limit-s)>MIN_ASCII_RUN ? s+MIN_ASCII_RUN : limit;
             if(spanCondition) {
                 do {
                     if(!asciiBytes[b]) {
                         return s;
-                    } else if(++s==limit) {
-                        return limit0;
+                    } else if(++s==runLimit) {
+                        if(s==limit) {
+                            return limit0;
+                        }
+                        s=spanASCIIUTF8(s, limit, spanCondition);
+                        if(s==limit) {
+                            return limit0;
+                        }
+                        runLimit=limit;
                     }
                     b=*s;
                 } while(b<0xc0);
@@ -576,8 +782,15 @@ BMPSet::spanUTF8(const uint8_t *s, int32_t length, USetSpanCondition spanConditi
                 do {
                     if(asciiBytes[b]) {
                         return s;
-                    } else if(++s==limit) {
-                        return limit0;
+                    } else if(++s==runLimit) {
+                        if(s==limit) {
+                            return limit0;
+                        }
+                        s=spanASCIIUTF8(s, limit, spanCondition);
+                        if(s==limit) {
+                            return limit0;
+                        }
+                        runLimit=limit;
                     }
                     b=*s;
                 } while(b<0xc0);
@@ -667,12 +880,21 @@ BMPSet::spanBackUTF8(const uint8_t *s, int32_t length, USetSpanCondition spanCon
         b=s[--length];
         if((int8_t)b>=0) {
             // ASCII sub-span
+            // Continue a word at a time after MIN_ASCII_RUN bytes.
+            int32_t runStart=length>MIN_ASCII_RUN ? length-MIN_ASCII_RUN : 0;
             if(spanCondition) {
                 do {
                     if(!asciiBytes[b]) {
                         return length+1;
-                    } else if(length==0) {
-                        return 0;
+                    } else if(length==runStart) {
+                        if(length==0) {
+                            return 0;
+                        }
+                        length=(int32_t)(spanBackASCIIUTF8(s, s+length, spanCondition)-s);
+                        if(length==0) {
+                            return 0;
+                        }
+                        runStart=0;
                     }
                     b=s[--length];
                 } while((int8_t)b>=0);
@@ -680,8 +902,15 @@ BMPSet::spanBackUTF8(const uint8_t *s, int32_t length, USetSpanCondition spanCon
                 do {
                     if(asciiBytes[b]) {
                         return length+1;
-                    } else if(length==0) {
-                        return 0;
+                    } else if(length==runStart) {
+                        if(length==0) {
+                            return 0;
+                        }
+                        length=(int32_t)(spanBackASCIIUTF8(s, s+length, spanCondition)-s);
+                        if(length==0) {
+                            return 0;
+                        }
+                        runStart=0;
                     }
                     b=s[--length];
                 } while((int8_t)b>=0);
@@ -1,7 +1,7 @@
 /*
 ******************************************************************************
 *
-*   Copyright (C) 2007, International Business Machines
+*   Copyright (C) 2007-2016, International Business Machines
 *   Corporation and others.  All Rights Reserved.
 *
 ******************************************************************************
@@ -31,13 +31,39 @@ U_NAMESPACE_BEGIN
  * 3-byte characters: Use zero/one/mixed data per 64-block in U+0000..U+FFFF,
  *                    with mixed for illegal ranges.
  * Supplementary characters: Call contains() on the parent set.
+ *
+ * Long runs of ASCII bytes in UTF-8 are spanned eight at a time
+ * if the set has few enough ASCII ranges to classify a 64-bit word of them
+ * with a few additions per range.
  */
 class BMPSet : public UMemory {
 public:
     BMPSet(const int32_t *parentList, int32_t parentListLength);
     BMPSet(const BMPSet &otherBMPSet, const int32_t *newParentList, int32_t newParentListLength);
+
+    /*
+     * Constructs a BMPSet from lookup tables that were written by getTables()
+     * for the same parent list, rather than computing them.
+     * Recomputes the tables if they do not fit the list.
+     */
+    BMPSet(const int32_t *parentList, int32_t parentListLength, const void *tables);
+
     virtual ~BMPSet();
 
+    /*
+     * Version and length in bytes of the lookup tables written by getTables().
+     * The version changes whenever the tables change in a way
+     * that getTablesLength() does not reflect.
+     */
+    enum { TABLES_VERSION=1 };
+    static int32_t getTablesLength();
+
+    /*
+     * Writes getTablesLength() bytes of lookup tables to dest,
+     * in platform endianness and without alignment requirements.
+     */
+    void getTables(void *dest) const;
+
     virtual UBool contains(UChar32 c) const;
 
     /*
@@ -69,6 +95,9 @@ public:
     int32_t spanBackUTF8(const uint8_t *s, int32_t length, USetSpanCondition spanCondition) const;
 
 private:
+    enum { MAX_ASCII_RANGES=4, MIN_ASCII_RUN=16 };
+
+    void initTables();
     void initBits();
     void overrideIllegal();
 
@@ -93,6 +122,21 @@ private:
 
     inline UBool containsSlow(UChar32 c, int32_t lo, int32_t hi) const;
 
+    /*
+     * Word-at-a-time spans over ASCII bytes, called only after MIN_ASCII_RUN
+     * ASCII characters in a row, so that short runs do not pay for a word that does not match.
+     * They return at the first byte (or, going backward, after the last one)
+     * which is not ASCII or for which spanCondition!=contains(c),
+     * or at fewer than eight bytes from the other end,
+     * for the caller to continue one byte at a time.
+     * They return right away if asciiRangeCount<0.
+     */
+    inline uint64_t containsASCIIBytes(uint64_t w) const;
+    const uint8_t *spanASCIIUTF8(const uint8_t *s, const uint8_t *limit, USetSpanCondition spanCondition) const;
+    const uint8_t *spanBackASCIIUTF8(const uint8_t *s, const uint8_t *limit, USetSpanCondition spanCondition) const;
+
+    const uint8_t *spanUTF8Rest(const uint8_t *s, int32_t length, USetSpanCondition spanCondition) const;
+
     /*
      * One byte per ASCII character, or trail byte in lead position.
      * 0 or 1 for ASCII characters.
@@ -101,6 +145,18 @@ private:
      */
     UBool asciiBytes[0xc0];
 
+    /*
+     * The set's ranges lo..hi of ASCII code points, as addends for testing
+     * all of the bytes of a 64-bit word at once:
+     * For an ASCII value c in a byte,
+     * adding (0x80-lo) sets bit 7 of the byte if c>=lo, and
+     * adding (0x7f-hi) sets bit 7 of the byte if c>hi,
+     * without carries into the next byte.
+     * asciiRangeCount<0 if the set has more than MAX_ASCII_RANGES ASCII ranges.
+     */
+    int32_t asciiRangeCount;
+    uint64_t asciiLoAdd8[MAX_ASCII_RANGES], asciiHiAdd8[MAX_ASCII_RANGES];
+
     /*
      * One bit per code point from U+0000..U+07FF.
      * The bits are organized vertically; consecutive code points
@@ -0,0 +1,517 @@
+/*
+*******************************************************************************
+*
+*   Copyright (C) 2016, International Business Machines
+*   Corporation and others.  All Rights Reserved.
+*
+*******************************************************************************
+*   file name:  localematcher.cpp
+*   encoding:   US-ASCII
+*   tab size:   8 (not used)
+*   indentation:4
+*/
+
+#include "unicode/utypes.h"
+#include "unicode/localematcher.h"
+#include "unicode/uloc.h"
+#include "unicode/ures.h"
+#include "charstr.h"
+#include "cmemory.h"
+#include "cstring.h"
+#include "hash.h"
+#include "ucln_cmn.h"
+#include "uhash.h"
+#include "umutex.h"
+#include "uresimp.h"
+
+U_NAMESPACE_BEGIN
+
+// Region containment ------------------------------------------------------ ***
+
+/*
+ * Maps each region code to the codes of all of the regions that contain it,
+ * directly or indirectly, except for the world (001).
+ * Each code is followed by a space, for example "155 150 " for "DE".
+ * Built once from the supplementalData territoryContainment.
+ * Remains NULL if the data is not available;
+ * then regions only match when they are equal.
+ */
+static UHashtable *gContainingRegions = NULL;
+static UInitOnce gContainingRegionsInitOnce = U_INITONCE_INITIALIZER;
+
+static const char WORLD[] = "001";
+
+U_CDECL_BEGIN
+
+static UBool U_CALLCONV
+localematcher_cleanup(void) {
+    if (gContainingRegions != NULL) {
+        uhash_close(gContainingRegions);
+        gContainingRegions = NULL;
+    }
+    gContainingRegionsInitOnce.reset();
+    return TRUE;
+}
+
+U_CDECL_END
+
+/**
+ * @return TRUE if the space-terminated list of region codes contains the region
+ */
+static UBool
+listContains(const char *list, const char *region, int32_t length) {
+    for (const char *p = list; *p != 0;) {
+        const char *space = uprv_strchr(p, ' ');
+        if ((space - p) == length && uprv_strncmp(p, region, length) == 0) {
+            return TRUE;
+        }
+        p = space + 1;
+    }
+    return FALSE;
+}
+
+static void U_CALLCONV
+deleteCharString(void *obj) {
+    delete (CharString *)obj;
+}
+
+/**
+ * Adds the container as a direct parent of each region in the array resource.
+ * parents maps each region code to a CharString with the codes of its parents.
+ */
+static void
+addParents(Hashtable &parents, const char *container, UResourceBundle *regions,
+           UErrorCode &errorCode) {
+    if (uprv_strcmp(container, WORLD) == 0) {
+        return;
+    }
+    while (U_SUCCESS(errorCode) && ures_hasNext(regions)) {
+        UnicodeString region = ures_getNextUnicodeString(regions, NULL, &errorCode);
+        if (U_FAILURE(errorCode)) {
+            return;
+        }
+        CharString *list = (CharString *)parents.get(region);
+        if (list == NULL) {
+            list = new CharString();
+            if (list == NULL) {
+                errorCode = U_MEMORY_ALLOCATION_ERROR;
+                return;
+            }
+            parents.put(region, list, errorCode);
+        }
+        list->append(container, errorCode).append(' ', errorCode);
+    }
+}
+
+/**
+ * Appends to ancestors each parent of the region and, recursively,
+ * each of their parents, unless already there.
+ */
+static void
+addAncestors(const Hashtable &parents, const CharString &region, CharString &ancestors,
+             int32_t depth, UErrorCode &errorCode) {
+    const CharString *list =
+        (const CharString *)parents.get(UnicodeString(region.data(), -1, US_INV));
+    // The containment is a shallow tree; the depth limit only guards against bad data.
+    if (list == NULL || depth > 8) {
+        return;
+    }
+    for (const char *p = list->data(); *p != 0 && U_SUCCESS(errorCode);) {
+        const char *space = uprv_strchr(p, ' ');
+        int32_t length = (int32_t)(space - p);
+        if (!listContains(ancestors.data(), p, length)) {
+            CharString code(p, length, errorCode);
+            ancestors.append(code, errorCode).append(' ', errorCode);
+            addAncestors(parents, code, ancestors, depth + 1, errorCode);
+        }
+        p = space + 1;
+    }
+}
+
+static void U_CALLCONV
+initContainingRegions() {
+    ucln_common_registerCleanup(UCLN_COMMON_LOCALE_MATCHER, localematcher_cleanup);
+    UErrorCode errorCode = U_ZERO_ERROR;
+    LocalUResourceBundlePointer supplementalData(ures_openDirect(NULL, "supplementalData", &errorCode));
+    LocalUResourceBundlePointer containment(
+        ures_getByKey(supplementalData.getAlias(), "territoryContainment", NULL, &errorCode));
+    Hashtable parents(errorCode);
+    if (U_FAILURE(errorCode)) {
+        return;
+    }
+    parents.setValueDeleter(deleteCharString);
+    LocalUResourceBundlePointer table;
+    LocalUResourceBundlePointer nested;
+    while (U_SUCCESS(errorCode) && ures_hasNext(containment.getAlias())) {
+        table.adoptInstead(ures_getNextResource(containment.getAlias(), table.orphan(), &errorCode));
+        if (U_FAILURE(errorCode)) {
+            break;
+        }
+        const char *key = ures_getKey(table.getAlias());
+        if (uprv_strcmp(key, "containedGroupings") == 0) {
+            // Groupings like 419 (Latin America) as children of the regions that contain them.
+            while (U_SUCCESS(errorCode) && ures_hasNext(table.getAlias())) {
+                nested.adoptInstead(ures_getNextResource(table.getAlias(), nested.orphan(), &errorCode));
+                if (U_SUCCESS(errorCode)) {
+                    addParents(parents, ures_getKey(nested.getAlias()), nested.getAlias(), errorCode);
+                }
+            }
+        } else if (ures_getType(table.getAlias()) == URES_ARRAY) {
+            // Skips the deprecated table and the grouping list.
+            if (uprv_strcmp(key, "grouping") != 0) {
+                addParents(parents, key, table.getAlias(), errorCode);
+            }
+        }
+    }
+    if (U_FAILURE(errorCode)) {
+        return;
+    }
+
+    UHashtable *containing = uhash_open(uhash_hashChars, uhash_compareChars, NULL, &errorCode);
+    if (U_FAILURE(errorCode)) {
+        return;
+    }
+    uhash_setKeyDeleter(containing, uprv_free);
+    uhash_setValueDeleter(containing, uprv_free);
+    int32_t pos = UHASH_FIRST;
+    const UHashElement *element;
+    while (U_SUCCESS(errorCode) && (element = parents.nextElement(pos)) != NULL) {
+        CharString region;
+        region.appendInvariantChars(*(const UnicodeString *)element->key.pointer, errorCode);
+        CharString ancestors;
+        addAncestors(parents, region, ancestors, 0, errorCode);
+        if (U_FAILURE(errorCode)) {
+            break;
+        }
+        char *key = uprv_strdup(region.data());
+        char *value = uprv_strdup(ancestors.data());
+        if (key == NULL || value == NULL) {
+            uprv_free(key);
+            uprv_free(value);
+            errorCode = U_MEMORY_ALLOCATION_ERROR;
+            break;
+        }
+        uhash_put(containing, key, value, &errorCode);
+    }
+    if (U_FAILURE(errorCode)) {
+        uhash_close(containing);
+        return;
+    }
+    gContainingRegions = containing;
+}
+
+// Locale matcher ---------------------------------------------------------- ***
+
+/**
+ * The likely subtags of a locale, and the regions containing its region.
+ */
+struct LocaleMatcherEntry : public UMemory {
+    char language[ULOC_LANG_CAPACITY];
+    char script[ULOC_SCRIPT_CAPACITY];
+    char region[ULOC_COUNTRY_CAPACITY];
+    // From gContainingRegions, or an empty string.
+    const char *containingRegions;
+    // Index of the next supported locale with the same language, or -1.
+    int32_t nextSameLanguage;
+
+    void set(const char *localeID);
+};
+
+void
+LocaleMatcherEntry::set(const char *localeID) {
+    // Without data, or for unusual IDs, the locale is compared as is.
+    UErrorCode errorCode = U_ZERO_ERROR;
+    char maximized[ULOC_FULLNAME_CAPACITY];
+    uloc_addLikelySubtags(localeID, maximized, (int32_t)sizeof(maximized), &errorCode);
+    if (U_SUCCESS(errorCode) && errorCode != U_STRING_NOT_TERMINATED_WARNING) {
+        localeID = maximized;
+    }
+    errorCode = U_ZERO_ERROR;
+    uloc_getLanguage(localeID, language, (int32_t)sizeof(language), &errorCode);
+    if (U_FAILURE(errorCode) || errorCode == U_STRING_NOT_TERMINATED_WARNING) {
+        language[0] = 0;
+    }
+    errorCode = U_ZERO_ERROR;
+    uloc_getScript(localeID, script, (int32_t)sizeof(script), &errorCode);
+    if (U_FAILURE(errorCode) || errorCode == U_STRING_NOT_TERMINATED_WARNING) {
+        script[0] = 0;
+    }
+    errorCode = U_ZERO_ERROR;
+    uloc_getCountry(localeID, region, (int32_t)sizeof(region), &errorCode);
+    if (U_FAILURE(errorCode) || errorCode == U_STRING_NOT_TERMINATED_WARNING) {
+        region[0] = 0;
+    }
+    containingRegions = "";
+    if (region[0] != 0 && gContainingRegions != NULL) {
+        const char *regions = (const char *)uhash_get(gContainingRegions, region);
+        if (regions != NULL) {
+            containingRegions = regions;
+        }
+    }
+    nextSameLanguage = -1;
+}
+
+static int32_t
+getEntryDistance(const LocaleMatcherEntry &desired, const LocaleMatcherEntry &supported) {
+    if (uprv_strcmp(desired.language, supported.language) != 0) {
+        return LocaleMatcher::DISTANCE_LANGUAGE;
+    }
+    int32_t distance = LocaleMatcher::DISTANCE_EXACT;
+    if (uprv_strcmp(desired.script, supported.script) != 0) {
+        distance += LocaleMatcher::DISTANCE_SCRIPT;
+    }
+    if (uprv_strcmp(desired.region, supported.region) != 0) {
+        int32_t supportedRegionLength = (int32_t)uprv_strlen(supported.region);
+        if (supportedRegionLength != 0 &&
+                listContains(desired.containingRegions, supported.region, supportedRegionLength)) {
+            distance += LocaleMatcher::DISTANCE_CONTAINING_REGION;
+        } else {
+            // Nearby if the supported region contains or shares
+            // one of the regions containing the desired region.
+            int32_t regionDistance = LocaleMatcher::DISTANCE_REGION;
+            for (const char *p = desired.containingRegions; *p != 0;) {
+                const char *space = uprv_strchr(p, ' ');
+                int32_t length = (int32_t)(space - p);
+                if (listContains(supported.containingRegions, p, length)) {
+                    regionDistance = LocaleMatcher::DISTANCE_NEARBY_REGION;
+                    break;
+                }
+                p = space + 1;
+            }
+            distance += regionDistance;
+        }
+    }
+    return distance;
+}
+
+LocaleMatcher::LocaleMatcher(const Locale *supported, int32_t len, UErrorCode &errorCode)
+        : supportedLocales(NULL), entries(NULL), length(0),
+          indexesByName(NULL), indexesByLanguage(NULL) {
+    if (U_FAILURE(errorCode)) {
+        return;
+    }
+    if (supported == NULL || len <= 0) {
+        errorCode = U_ILLEGAL_ARGUMENT_ERROR;
+        return;
+    }
+    umtx_initOnce(gContainingRegionsInitOnce, &initContainingRegions);
+    supportedLocales = new Locale[len];
+    entries = new LocaleMatcherEntry[len];
+    if (supportedLocales == NULL || entries == NULL) {
+        errorCode = U_MEMORY_ALLOCATION_ERROR;
+        return;
+    }
+    length = len;
+    indexesByName = uhash_open(uhash_hashChars, uhash_compareChars, NULL, &errorCode);
+    indexesByLanguage = uhash_open(uhash_hashChars, uhash_compareChars, NULL, &errorCode);
+    if (U_FAILURE(errorCode)) {
+        return;
+    }
+    // The hash tables use the Locale and entry strings as keys and
+    // store index+1 because uhash_geti() returns 0 for missing keys.
+    // Traverse backwards so that the first of duplicates wins and the
+    // language lists are in order.
+    for (int32_t i = length - 1; i >= 0 && U_SUCCESS(errorCode); --i) {
+        supportedLocales[i] = supported[i];
+        LocaleMatcherEntry &entry = entries[i];
+        entry.set(supportedLocales[i].getName());
+        uhash_puti(indexesByName, (void *)supportedLocales[i].getName(), i + 1, &errorCode);
+        entry.nextSameLanguage = uhash_geti(indexesByLanguage, entry.language) - 1;
+        uhash_puti(indexesByLanguage, entry.language, i + 1, &errorCode);
+    }
+}
+
+LocaleMatcher::~LocaleMatcher() {
+    uhash_close(indexesByName);
+    uhash_close(indexesByLanguage);
+    delete[] entries;
+    delete[] supportedLocales;
+}
+
+int32_t
+LocaleMatcher::getBestIndex(const Locale &desiredLocale, int32_t *pDistance) const {
+    int32_t index = uhash_geti(indexesByName, desiredLocale.getName()) - 1;
+    if (index >= 0) {
+        *pDistance = DISTANCE_EXACT;
+        return index;
+    }
+    LocaleMatcherEntry desired;
+    desired.set(desiredLocale.getName());
+    int32_t bestIndex = -1;
+    int32_t bestDistance = DISTANCE_LANGUAGE;
+    for (index = uhash_geti(indexesByLanguage, desired.language) - 1;
+            index >= 0; index = entries[index].nextSameLanguage) {
+        int32_t distance = getEntryDistance(desired, entries[index]);
+        if (distance < bestDistance) {
+            bestIndex = index;
+            bestDistance = distance;
+            if (distance == DISTANCE_EXACT) {
+                break;
+            }
+        }
+    }
+    *pDistance = bestDistance;
+    return bestIndex;
+}
+
+const Locale *
+LocaleMatcher::getBestMatch(const Locale &desiredLocale, UErrorCode &errorCode) const {
+    return getBestMatch(&desiredLocale, 1, errorCode);
+}
+
+const Locale *
+LocaleMatcher::getBestMatch(const Locale *desiredLocales, int32_t desiredLength,
+                            UErrorCode &errorCode) const {
+    if (U_FAILURE(errorCode)) {
+        return NULL;
+    }
+    if (desiredLocales == NULL ? desiredLength != 0 : desiredLength < 0) {
+        errorCode = U_ILLEGAL_ARGUMENT_ERROR;
+        return NULL;
+    }
+    int32_t bestIndex = 0;  // the default locale
+    int32_t bestDistance = DISTANCE_THRESHOLD;
+    for (int32_t i = 0; i < desiredLength; ++i) {
+        int32_t demotion = i * DISTANCE_DEMOTION_PER_DESIRED_LOCALE;
+        if (demotion >= bestDistance) {
+            break;  // No later desired locale can be better.
+        }
+        int32_t distance;
+        int32_t index = getBestIndex(desiredLocales[i], &distance);
+        if (index >= 0 && (distance + demotion) < bestDistance) {
+            bestIndex = index;
+            bestDistance = distance + demotion;
+        }
+    }
+    return supportedLocales + bestIndex;
+}
+
+namespace {
+
+/** One language range from an Accept-Language header. */
+struct LanguageRange {
+    const char *start;
+    int32_t length;
+    int32_t q;  // quality value in thousandths
+};
+
+/**
+ * Parses an HTTP quality value like "0.8" or "1.000" into thousandths.
+ * Returns 1000 for malformed values, like the absence of a value.
+ */
+int32_t parseQuality(const char *s, const char *limit) {
+    int32_t q = 0;
+    if (s < limit && (*s == '0' || *s == '1')) {
+        q = (*s++ - '0') * 1000;
+    } else {
+        return 1000;
+    }
+    if (s < limit && *s == '.') {
+        ++s;
+        for (int32_t factor = 100; factor > 0 && s < limit && '0' <= *s && *s <= '9'; factor /= 10) {
+            q += (*s++ - '0') * factor;
+        }
+    }
+    return q > 1000 ? 1000 : q;
+}
+
+UBool isHTTPSpace(char c) {
+    return c == ' ' || c == '\t';
+}
+
+}  // namespace
+
+const Locale *
+LocaleMatcher::getBestMatchForHTTP(const char *httpAcceptLanguage, UErrorCode &errorCode) const {
+    if (U_FAILURE(errorCode)) {
+        return NULL;
+    }
+    if (httpAcceptLanguage == NULL) {
+        errorCode = U_ILLEGAL_ARGUMENT_ERROR;
+        return NULL;
+    }
+    MaybeStackArray<LanguageRange, 16> ranges;
+    int32_t count = 0;
+    const char *s = httpAcceptLanguage;
+    while (*s != 0) {
+        const char *limit = uprv_strchr(s, ',');
+        if (limit == NULL) {
+            limit = s + uprv_strlen(s);
+        }
+        const char *end = uprv_strchr(s, ';');
+        if (end == NULL || end > limit) {
+            end = limit;
+        }
+        int32_t q = 1000;
+        for (const char *param = end; param < limit;) {
+            // Skip the ';' and spaces, then look for "q=".
+            do { ++param; } while (param < limit && isHTTPSpace(*param));
+            if (param + 2 <= limit && (*param == 'q' || *param == 'Q') && param[1] == '=') {
+                q = parseQuality(param + 2, limit);
+            }
+            while (param < limit && *param != ';') { ++param; }
+        }
+        while (s < end && isHTTPSpace(*s)) { ++s; }
+        while (s < end && isHTTPSpace(end[-1])) { --end; }
+        if (s < end && q > 0 && !(end - s == 1 && *s == '*')) {
+            if (count == ranges.getCapacity() && ranges.resize(2 * count, count) == NULL) {
+                errorCode = U_MEMORY_ALLOCATION_ERROR;
+                return NULL;
+            }
+            // Insert in order of descending quality, after ranges with the same quality.
+            int32_t i = count++;
+            for (; i > 0 && ranges[i - 1].q < q; --i) {
+                ranges[i] = ranges[i - 1];
+            }
+            ranges[i].start = s;
+            ranges[i].length = (int32_t)(end - s);
+            ranges[i].q = q;
+        }
+        s = *limit == ',' ? limit + 1 : limit;
+    }
+
+    int32_t bestIndex = 0;  // the default locale
+    int32_t bestDistance = DISTANCE_THRESHOLD;
+    for (int32_t i = 0; i < count; ++i) {
+        int32_t demotion = i * DISTANCE_DEMOTION_PER_DESIRED_LOCALE;
+        if (demotion >= bestDistance) {
+            break;  // No later desired locale can be better.
+        }
+        char tag[ULOC_FULLNAME_CAPACITY];
+        char localeID[ULOC_FULLNAME_CAPACITY];
+        if (ranges[i].length >= (int32_t)sizeof(tag)) {
+            continue;
+        }
+        uprv_memcpy(tag, ranges[i].start, ranges[i].length);
+        tag[ranges[i].length] = 0;
+        UErrorCode tagErrorCode = U_ZERO_ERROR;
+        int32_t parsedLength = 0;
+        uloc_forLanguageTag(tag, localeID, (int32_t)sizeof(localeID), &parsedLength, &tagErrorCode);
+        if (U_FAILURE(tagErrorCode) || tagErrorCode == U_STRING_NOT_TERMINATED_WARNING ||
+                parsedLength != ranges[i].length) {
+            continue;  // Ignore malformed language ranges.
+        }
+        int32_t distance;
+        int32_t index = getBestIndex(Locale(localeID), &distance);
+        if (index >= 0 && (distance + demotion) < bestDistance) {
+            bestIndex = index;
+            bestDistance = distance + demotion;
+        }
+    }
+    return supportedLocales + bestIndex;
+}
+
+int32_t
+LocaleMatcher::getDistance(const Locale &desiredLocale, const Locale &supportedLocale,
+                           UErrorCode &errorCode) {
+    if (U_FAILURE(errorCode)) {
+        return DISTANCE_LANGUAGE;
+    }
+    umtx_initOnce(gContainingRegionsInitOnce, &initContainingRegions);
+    LocaleMatcherEntry desired, supported;
+    desired.set(desiredLocale.getName());
+    supported.set(supportedLocale.getName());
+    return getEntryDistance(desired, supported);
+}
+
+U_NAMESPACE_END
@@ -1,6 +1,6 @@
 /*
  **********************************************************************
- *   Copyright (C) 1997-2015, International Business Machines
+ *   Copyright (C) 1997-2016, International Business Machines
  *   Corporation and others.  All Rights Reserved.
  **********************************************************************
 *
@@ -57,6 +57,38 @@ static UMutex gDefaultLocaleMutex = U_MUTEX_INITIALIZER;
 static UHashtable *gDefaultLocalesHashT = NULL;
 static Locale *gDefaultLocale = NULL;
 
+/**
+ * The fields of a Locale as set by Locale::init() for one locale ID.
+ * Only for IDs whose full name fits into the fullNameBuffer and has no keywords.
+ */
+struct InternedLocaleID : public UMemory {
+    /** The locale ID as passed into Locale::init(). */
+    char id[ULOC_FULLNAME_CAPACITY];
+    char language[ULOC_LANG_CAPACITY];
+    char script[ULOC_SCRIPT_CAPACITY];
+    char country[ULOC_COUNTRY_CAPACITY];
+    int32_t variantBegin;
+    int32_t hashCode;
+    int32_t length;
+    char fullName[ULOC_FULLNAME_CAPACITY];
+};
+
+// Maps a locale ID as passed into Locale::init() (without canonicalization)
+// to its InternedLocaleID, so that each distinct ID is parsed only once.
+// Insert-only open-addressing hash table: Each slot holds 0 if it is empty,
+// or the index+1 of its entry in gInternedLocaleIDs.
+// A new entry is stored before its slot is published with a release barrier,
+// and entries are never removed until cleanup,
+// so lookups need no lock. gInternedLocaleIDsMutex serializes insertions.
+static UMutex gInternedLocaleIDsMutex = U_MUTEX_INITIALIZER;
+// Limits the memory used for arbitrary IDs; further IDs are parsed each time.
+static const int32_t kMaxInternedLocaleIDs = 1000;
+// A power of 2, with enough empty slots to keep the probe sequences short.
+static const int32_t kInternedLocaleIDSlots = 2048;
+static u_atomic_int32_t gInternedLocaleIDSlots[kInternedLocaleIDSlots];
+static InternedLocaleID *gInternedLocaleIDs[kMaxInternedLocaleIDs];
+static int32_t gInternedLocaleIDCount = 0;
+
 U_NAMESPACE_END
 
 typedef enum ELocalePos {
@@ -115,6 +147,14 @@ static UBool U_CALLCONV locale_cleanup(void)
         gDefaultLocalesHashT = NULL;
     }
     gDefaultLocale = NULL;
+    for (int32_t i = 0; i < kInternedLocaleIDSlots; ++i) {
+        umtx_storeRelease(gInternedLocaleIDSlots[i], 0);
+    }
+    for (int32_t i = 0; i < gInternedLocaleIDCount; ++i) {
+        delete gInternedLocaleIDs[i];
+        gInternedLocaleIDs[i] = NULL;
+    }
+    gInternedLocaleIDCount = 0;
     return TRUE;
 }
 
@@ -210,6 +250,44 @@ Locale *locale_set_default_internal(const char *id, UErrorCode& status) {
     return gDefaultLocale;
 }
 
+/** Lock-free lookup. hash=ustr_hashCharsN(localeID). */
+static const InternedLocaleID *findInternedLocaleID(const char *localeID, int32_t hash) {
+    for (int32_t i = hash & (kInternedLocaleIDSlots - 1);; i = (i + 1) & (kInternedLocaleIDSlots - 1)) {
+        int32_t index = umtx_loadAcquire(gInternedLocaleIDSlots[i]);
+        if (index == 0) {
+            return NULL;
+        }
+        const InternedLocaleID *entry = gInternedLocaleIDs[index - 1];
+        if (uprv_strcmp(entry->id, localeID) == 0) {
+            return entry;
+        }
+    }
+}
+
+/** Adopts the entry. hash=ustr_hashCharsN(entry->id). */
+static void addInternedLocaleID(InternedLocaleID *entry, int32_t hash) {
+    Mutex lock(&gInternedLocaleIDsMutex);
+    if (gInternedLocaleIDCount >= kMaxInternedLocaleIDs) {
+        delete entry;
+        return;
+    }
+    if (gInternedLocaleIDCount == 0) {
+        ucln_common_registerCleanup(UCLN_COMMON_LOCALE, locale_cleanup);
+    }
+    int32_t i = hash & (kInternedLocaleIDSlots - 1);
+    int32_t index;
+    while ((index = umtx_loadAcquire(gInternedLocaleIDSlots[i])) != 0) {
+        if (uprv_strcmp(gInternedLocaleIDs[index - 1]->id, entry->id) == 0) {
+            // Another thread added the same ID.
+            delete entry;
+            return;
+        }
+        i = (i + 1) & (kInternedLocaleIDSlots - 1);
+    }
+    gInternedLocaleIDs[gInternedLocaleIDCount++] = entry;
+    umtx_storeRelease(gInternedLocaleIDSlots[i], gInternedLocaleIDCount);
+}
+
 U_NAMESPACE_END
 
 /* sfb 07/21/99 */
@@ -458,6 +536,7 @@ Locale &Locale::operator=(const Locale &other)
     /* The variantBegin is an offset, just copy it */
     variantBegin = other.variantBegin;
     fIsBogus = other.fIsBogus;
+    fHashCode = other.fHashCode;
     return *this;
 }
 
@@ -469,7 +548,7 @@ Locale::clone() const {
 UBool
 Locale::operator==( const   Locale& other) const
 {
-    return (uprv_strcmp(other.fullName, fullName) == 0);
+    return other.fHashCode == fHashCode && uprv_strcmp(other.fullName, fullName) == 0;
 }
 
 #define ISASCIIALPHA(c) (((c) >= 'a' && (c) <= 'z') || ((c) >= 'A' && (c) <= 'Z'))
@@ -505,6 +584,21 @@ Locale& Locale::init(const char* localeID, UBool canonicalize)
             return *this = getDefault();
         }
 
+        int32_t idLength = (int32_t)uprv_strlen(localeID);
+        UBool internable = !canonicalize && idLength < ULOC_FULLNAME_CAPACITY;
+        int32_t idHash = internable ? ustr_hashCharsN(localeID, idLength) : 0;
+        const InternedLocaleID *interned = internable ? findInternedLocaleID(localeID, idHash) : NULL;
+        if (interned != NULL) {
+            uprv_strcpy(language, interned->language);
+            uprv_strcpy(script, interned->script);
+            uprv_strcpy(country, interned->country);
+            uprv_memcpy(fullName, interned->fullName, interned->length + 1);
+            baseName = fullName;
+            variantBegin = interned->variantBegin;
+            fHashCode = interned->hashCode;
+            return *this;
+        }
+
         /* preset all fields to empty */
         language[0] = script[0] = country[0] = 0;
 
@@ -592,6 +686,22 @@ Locale& Locale::init(const char* localeID, UBool canonicalize)
         if (U_FAILURE(err)) {
             break;
         }
+        fHashCode = ustr_hashCharsN(fullName, length);
+
+        if (internable && fullName == fullNameBuffer && baseName == fullName) {
+            InternedLocaleID *entry = new InternedLocaleID;
+            if (entry != NULL) {
+                uprv_memcpy(entry->id, localeID, idLength + 1);
+                uprv_strcpy(entry->language, language);
+                uprv_strcpy(entry->script, script);
+                uprv_strcpy(entry->country, country);
+                uprv_memcpy(entry->fullName, fullName, length + 1);
+                entry->length = length;
+                entry->variantBegin = variantBegin;
+                entry->hashCode = fHashCode;
+                addInternedLocaleID(entry, idHash);
+            }
+        }
 
         // successful end of init()
         return *this;
@@ -643,7 +753,7 @@ Locale::initBaseName(UErrorCode &status) {
 int32_t
 Locale::hashCode() const
 {
-    return ustr_hashCharsN(fullName, uprv_strlen(fullName));
+    return fHashCode;
 }
 
 void
@@ -662,6 +772,7 @@ Locale::setToBogus() {
     *script = 0;
     *country = 0;
     fIsBogus = TRUE;
+    fHashCode = 0;  // hash code of the empty fullName
 }
 
 const Locale& U_EXPORT2
@@ -1036,6 +1147,7 @@ Locale::setKeywordValue(const char* keywordName, const char* keywordValue, UErro
         // May have added the first keyword, meaning that the fullName is no longer also the baseName.
         initBaseName(status);
     }
+    fHashCode = ustr_hashCharsN(fullName, (int32_t)uprv_strlen(fullName));
 }
 
 const char *
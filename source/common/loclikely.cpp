@@ -1,7 +1,7 @@
 /*
 *******************************************************************************
 *
-*   Copyright (C) 1997-2014, International Business Machines
+*   Copyright (C) 1997-2016, International Business Machines
 *   Corporation and others.  All Rights Reserved.
 *
 *******************************************************************************
@@ -18,16 +18,92 @@
 */
 
 #include "unicode/utypes.h"
+#include "unicode/bytestrie.h"
+#include "unicode/bytestriebuilder.h"
 #include "unicode/locid.h"
 #include "unicode/putil.h"
 #include "unicode/uloc.h"
 #include "unicode/ures.h"
 #include "unicode/uscript.h"
+#include "charstr.h"
 #include "cmemory.h"
 #include "cstring.h"
+#include "ucln_cmn.h"
 #include "ulocimp.h"
+#include "umutex.h"
+#include "uresimp.h"
 #include "ustr_imp.h"
 
+U_NAMESPACE_USE
+
+/*
+ * The likelySubtags resource data, loaded once.
+ * gLikelySubtagsTrie maps each resource key (a locale ID) to the offset of
+ * its value in gLikelySubtagsValues, which holds the NUL-terminated
+ * values as invariant-character strings.
+ */
+static uint8_t *gLikelySubtagsTrie = NULL;
+static char *gLikelySubtagsValues = NULL;
+static UInitOnce gLikelySubtagsInitOnce = U_INITONCE_INITIALIZER;
+
+U_CDECL_BEGIN
+
+static UBool U_CALLCONV
+loclikely_cleanup(void) {
+    uprv_free(gLikelySubtagsTrie);
+    gLikelySubtagsTrie = NULL;
+    uprv_free(gLikelySubtagsValues);
+    gLikelySubtagsValues = NULL;
+    gLikelySubtagsInitOnce.reset();
+    return TRUE;
+}
+
+U_CDECL_END
+
+static void U_CALLCONV
+initLikelySubtags(UErrorCode &errorCode) {
+    ucln_common_registerCleanup(UCLN_COMMON_LIKELY_SUBTAGS, loclikely_cleanup);
+    LocalUResourceBundlePointer subtags(ures_openDirect(NULL, "likelySubtags", &errorCode));
+    if (U_FAILURE(errorCode)) {
+        return;
+    }
+    BytesTrieBuilder builder(errorCode);
+    CharString values;
+    LocalUResourceBundlePointer entry;
+    while (U_SUCCESS(errorCode) && ures_hasNext(subtags.getAlias())) {
+        entry.adoptInstead(ures_getNextResource(subtags.getAlias(), entry.orphan(), &errorCode));
+        int32_t length = 0;
+        const UChar *s = ures_getString(entry.getAlias(), &length, &errorCode);
+        if (U_FAILURE(errorCode)) {
+            break;
+        }
+        char value[ULOC_FULLNAME_CAPACITY];
+        if (length >= UPRV_LENGTHOF(value)) {
+            errorCode = U_INTERNAL_PROGRAM_ERROR;
+            break;
+        }
+        u_UCharsToChars(s, value, length + 1);
+        builder.add(ures_getKey(entry.getAlias()), values.length(), errorCode);
+        values.append(value, length + 1, errorCode);
+    }
+    if (U_FAILURE(errorCode)) {
+        return;
+    }
+    StringPiece trie = builder.buildStringPiece(USTRINGTRIE_BUILD_SMALL, errorCode);
+    if (U_FAILURE(errorCode)) {
+        return;
+    }
+    gLikelySubtagsTrie = (uint8_t *)uprv_malloc(trie.length());
+    gLikelySubtagsValues = (char *)uprv_malloc(values.length());
+    if (gLikelySubtagsTrie == NULL || gLikelySubtagsValues == NULL) {
+        loclikely_cleanup();
+        errorCode = U_MEMORY_ALLOCATION_ERROR;
+        return;
+    }
+    uprv_memcpy(gLikelySubtagsTrie, trie.data(), trie.length());
+    uprv_memcpy(gLikelySubtagsValues, values.data(), values.length());
+}
+
 /**
  * This function looks for the localeID in the likelySubtags resource.
  *
@@ -43,35 +119,24 @@ findLikelySubtags(const char* localeID,
                   UErrorCode* err) {
     const char* result = NULL;
 
+    umtx_initOnce(gLikelySubtagsInitOnce, &initLikelySubtags, *err);
     if (!U_FAILURE(*err)) {
-        int32_t resLen = 0;
-        const UChar* s = NULL;
-        UErrorCode tmpErr = U_ZERO_ERROR;
-        UResourceBundle* subtags = ures_openDirect(NULL, "likelySubtags", &tmpErr);
-        if (U_SUCCESS(tmpErr)) {
-            s = ures_getStringByKey(subtags, localeID, &resLen, &tmpErr);
-
-            if (U_FAILURE(tmpErr)) {
-                /*
-                 * If a resource is missing, it's not really an error, it's
-                 * just that we don't have any data for that particular locale ID.
-                 */
-                if (tmpErr != U_MISSING_RESOURCE_ERROR) {
-                    *err = tmpErr;
-                }
-            }
-            else if (resLen >= bufferLength) {
+        BytesTrie trie(gLikelySubtagsTrie);
+        /*
+         * If the localeID is not in the trie, it's not really an error, it's
+         * just that we don't have any data for that particular locale ID.
+         */
+        if (USTRINGTRIE_HAS_VALUE(trie.next(localeID, -1))) {
+            const char* s = gLikelySubtagsValues + trie.getValue();
+            int32_t resLen = (int32_t)uprv_strlen(s);
+            if (resLen >= bufferLength) {
                 /* The buffer should never overflow. */
                 *err = U_INTERNAL_PROGRAM_ERROR;
             }
             else {
-                u_UCharsToChars(s, buffer, resLen + 1);
+                uprv_memcpy(buffer, s, resLen + 1);
                 result = buffer;
             }
-
-            ures_close(subtags);
-        } else {
-            *err = tmpErr;
         }
     }
 
@@ -1,7 +1,7 @@
 /*
 ******************************************************************************
 *
-*   Copyright (C) 1999-2015, International Business Machines
+*   Copyright (C) 1999-2016, International Business Machines
 *   Corporation and others.  All Rights Reserved.
 *
 ******************************************************************************
@@ -265,6 +265,41 @@ ubidi_close(UBiDi *pBiDi) {
     }
 }
 
+U_CAPI void U_EXPORT2
+ubidi_reserve(UBiDi *pBiDi, int32_t maxLength, int32_t maxRunCount, UErrorCode *pErrorCode) {
+    if(pErrorCode==NULL || U_FAILURE(*pErrorCode)) {
+        return;
+    } else if(pBiDi==NULL || maxLength<0 || maxRunCount<0) {
+        *pErrorCode=U_ILLEGAL_ARGUMENT_ERROR;
+        return;
+    }
+
+    /*
+     * Growing the arrays may move them, and the current paragraph or line
+     * and its children point into them; discard it like ubidi_setPara() would.
+     */
+    pBiDi->pParaBiDi=NULL;
+
+    /*
+     * Unlike with ubidi_openSized(), the mayAllocate flags stay as they are:
+     * Longer texts still get more memory if the object was opened
+     * with ubidi_open(), and are still rejected if it was opened
+     * with fixed sizes.
+     */
+    if(maxLength>0) {
+        if( !getInitialDirPropsMemory(pBiDi, maxLength) ||
+            !getInitialLevelsMemory(pBiDi, maxLength)
+        ) {
+            *pErrorCode=U_MEMORY_ALLOCATION_ERROR;
+            return;
+        }
+    }
+    /* a single run uses simpleRuns[] */
+    if(maxRunCount>1 && !getInitialRunsMemory(pBiDi, maxRunCount)) {
+        *pErrorCode=U_MEMORY_ALLOCATION_ERROR;
+    }
+}
+
 /* set to approximate "inverse BiDi" ---------------------------------------- */
 
 U_CAPI void U_EXPORT2
@@ -365,6 +400,55 @@ int32_t length){
     return UBIDI_NEUTRAL;
 }
 
+U_CAPI int32_t U_EXPORT2
+ubidi_splitParagraphs(const UChar *text, int32_t length,
+                      int32_t *limits, int32_t maxParts,
+                      UErrorCode *pErrorCode) {
+    int32_t count, start, i;
+
+    if(pErrorCode==NULL || U_FAILURE(*pErrorCode)) {
+        return 0;
+    }
+    if(text==NULL || length<-1 || limits==NULL || maxParts<=0) {
+        *pErrorCode=U_ILLEGAL_ARGUMENT_ERROR;
+        return 0;
+    }
+
+    if(length==-1) {
+        length=u_strlen(text);
+    }
+
+    /*
+     * End each part at the first paragraph limit at or after
+     * its share of the text, as getDirProps() finds paragraph limits:
+     * after each B character except a CR that is followed by a LF.
+     * Paragraph separators are all in the BMP, so it is enough
+     * to look at single code units.
+     */
+    count=0;
+    start=0;
+    while(start<length) {
+        int32_t target;
+        if(count==maxParts-1) {
+            limits[count++]=length;
+            break;
+        }
+        target=(int32_t)(((int64_t)length*(count+1))/maxParts);
+        i= target>start ? target-1 : start;
+        for(;;) {
+            if(i==length) {
+                break;
+            }
+            if(u_charDirection(text[i++])==U_BLOCK_SEPARATOR &&
+                    !(text[i-1]==CR && i<length && text[i]==LF)) {
+                break;
+            }
+        }
+        limits[count++]=start=i;
+    }
+    return count;
+}
+
 /* perform (P2)..(P3) ------------------------------------------------------- */
 
 /**
@@ -640,16 +724,30 @@ getDirProps(UBiDi *pBiDi) {
     return TRUE;
 }
 
+/*
+ * Find the index of the paragraph that contains position index,
+ * or of the last paragraph if index is at or beyond its limit.
+ * Binary search, because this is called for each run
+ * and a large document can have many thousands of paragraphs.
+ */
+static int32_t
+findParaIndex(const UBiDi *pBiDi, int32_t pindex) {
+    int32_t start=0, limit=pBiDi->paraCount-1;
+    while(start<limit) {
+        int32_t i=(start+limit)/2;
+        if(pindex<pBiDi->paras[i].limit) {
+            limit=i;
+        } else {
+            start=i+1;
+        }
+    }
+    return start;
+}
+
 /* determine the paragraph level at position index */
 U_CFUNC UBiDiLevel
 ubidi_getParaLevelAtIndex(const UBiDi *pBiDi, int32_t pindex) {
-    int32_t i;
-    for(i=0; i<pBiDi->paraCount; i++)
-        if(pindex<pBiDi->paras[i].limit)
-            break;
-    if(i>=pBiDi->paraCount)
-        i=pBiDi->paraCount-1;
-    return (UBiDiLevel)(pBiDi->paras[i].level);
+    return (UBiDiLevel)(pBiDi->paras[findParaIndex(pBiDi, pindex)].level);
 }
 
 /* Functions for handling paired brackets ----------------------------------- */
@@ -1125,7 +1223,8 @@ resolveExplicitLevels(UBiDi *pBiDi, UErrorCode *pErrorCode) {
                     if((i+1)<length) {
                         if(text[i]==CR && text[i+1]==LF)
                             continue;   /* skip CR when followed by LF */
-                        bracketProcessB(&bracketData, level);
+                        /* the next paragraph may have a different level */
+                        bracketProcessB(&bracketData, GET_PARALEVEL(pBiDi, i+1));
                     }
                     continue;
                 }
@@ -2953,7 +3052,7 @@ ubidi_getParagraph(const UBiDi *pBiDi, int32_t charIndex,
     pBiDi=pBiDi->pParaBiDi;             /* get Para object if Line object */
     RETURN_IF_BAD_RANGE(charIndex, 0, pBiDi->length, *pErrorCode, -1);
 
-    for(paraIndex=0; charIndex>=pBiDi->paras[paraIndex].limit; paraIndex++);
+    paraIndex=findParaIndex(pBiDi, charIndex);
     ubidi_getParagraphByIndex(pBiDi, paraIndex, pParaStart, pParaLimit, pParaLevel, pErrorCode);
     return paraIndex;
 }
@@ -1,7 +1,7 @@
 /*
 *******************************************************************************
 *
-*   Copyright (C) 2004-2014, International Business Machines
+*   Copyright (C) 2004-2016, International Business Machines
 *   Corporation and others.  All Rights Reserved.
 *
 *******************************************************************************
@@ -23,6 +23,7 @@
 #include "udatamem.h"
 #include "uassert.h"
 #include "cmemory.h"
+#include "ucptrie.h"
 #include "utrie2.h"
 #include "ubidi_props.h"
 #include "ucln_cmn.h"
@@ -34,7 +35,7 @@ struct UBiDiProps {
     const uint8_t *jgArray;
     const uint8_t *jgArray2;
 
-    UTrie2 trie;
+    UCPTrie trie;
     uint8_t formatVersion[4];
 };
 
@@ -72,7 +73,7 @@ ubidi_addPropertyStarts(const UBiDiProps *bdp, const USetAdder *sa, UErrorCode *
     }
 
     /* add the start code point of each same-value range of the trie */
-    utrie2_enum(&bdp->trie, NULL, _enumPropertyStartsRange, sa);
+    ucptrie_enum(&bdp->trie, NULL, _enumPropertyStartsRange, sa);
 
     /* add the code points from the bidi mirroring table */
     length=bdp->indexes[UBIDI_IX_MIRROR_LENGTH];
@@ -141,13 +142,13 @@ ubidi_getMaxValue(const UBiDiProps *bdp, UProperty which) {
 
 U_CAPI UCharDirection
 ubidi_getClass(const UBiDiProps *bdp, UChar32 c) {
-    uint16_t props=UTRIE2_GET16(&bdp->trie, c);
+    uint16_t props=UCPTRIE_FAST_GET(&bdp->trie, UCPTRIE_16, c);
     return (UCharDirection)UBIDI_GET_CLASS(props);
 }
 
 U_CFUNC UBool
 ubidi_isMirrored(const UBiDiProps *bdp, UChar32 c) {
-    uint16_t props=UTRIE2_GET16(&bdp->trie, c);
+    uint16_t props=UCPTRIE_FAST_GET(&bdp->trie, UCPTRIE_16, c);
     return (UBool)UBIDI_GET_FLAG(props, UBIDI_IS_MIRRORED_SHIFT);
 }
 
@@ -185,25 +186,25 @@ getMirror(const UBiDiProps *bdp, UChar32 c, uint16_t props) {
 
 U_CFUNC UChar32
 ubidi_getMirror(const UBiDiProps *bdp, UChar32 c) {
-    uint16_t props=UTRIE2_GET16(&bdp->trie, c);
+    uint16_t props=UCPTRIE_FAST_GET(&bdp->trie, UCPTRIE_16, c);
     return getMirror(bdp, c, props);
 }
 
 U_CFUNC UBool
 ubidi_isBidiControl(const UBiDiProps *bdp, UChar32 c) {
-    uint16_t props=UTRIE2_GET16(&bdp->trie, c);
+    uint16_t props=UCPTRIE_FAST_GET(&bdp->trie, UCPTRIE_16, c);
     return (UBool)UBIDI_GET_FLAG(props, UBIDI_BIDI_CONTROL_SHIFT);
 }
 
 U_CFUNC UBool
 ubidi_isJoinControl(const UBiDiProps *bdp, UChar32 c) {
-    uint16_t props=UTRIE2_GET16(&bdp->trie, c);
+    uint16_t props=UCPTRIE_FAST_GET(&bdp->trie, UCPTRIE_16, c);
     return (UBool)UBIDI_GET_FLAG(props, UBIDI_JOIN_CONTROL_SHIFT);
 }
 
 U_CFUNC UJoiningType
 ubidi_getJoiningType(const UBiDiProps *bdp, UChar32 c) {
-    uint16_t props=UTRIE2_GET16(&bdp->trie, c);
+    uint16_t props=UCPTRIE_FAST_GET(&bdp->trie, UCPTRIE_16, c);
     return (UJoiningType)((props&UBIDI_JT_MASK)>>UBIDI_JT_SHIFT);
 }
 
@@ -226,13 +227,13 @@ ubidi_getJoiningGroup(const UBiDiProps *bdp, UChar32 c) {
 
 U_CFUNC UBidiPairedBracketType
 ubidi_getPairedBracketType(const UBiDiProps *bdp, UChar32 c) {
-    uint16_t props=UTRIE2_GET16(&bdp->trie, c);
+    uint16_t props=UCPTRIE_FAST_GET(&bdp->trie, UCPTRIE_16, c);
     return (UBidiPairedBracketType)((props&UBIDI_BPT_MASK)>>UBIDI_BPT_SHIFT);
 }
 
 U_CFUNC UChar32
 ubidi_getPairedBracket(const UBiDiProps *bdp, UChar32 c) {
-    uint16_t props=UTRIE2_GET16(&bdp->trie, c);
+    uint16_t props=UCPTRIE_FAST_GET(&bdp->trie, UCPTRIE_16, c);
     if((props&UBIDI_BPT_MASK)==0) {
         return c;
     } else {
@@ -1,7 +1,7 @@
 /*
 *******************************************************************************
 *
-*   Copyright (C) 2004-2014, International Business Machines
+*   Copyright (C) 2004-2016, International Business Machines
 *   Corporation and others.  All Rights Reserved.
 *
 *******************************************************************************
@@ -27,6 +27,7 @@
 #include "umutex.h"
 #include "uassert.h"
 #include "cmemory.h"
+#include "ucptrie.h"
 #include "utrie2.h"
 #include "ucase.h"
 
@@ -36,7 +37,7 @@ struct UCaseProps {
     const uint16_t *exceptions;
     const uint16_t *unfold;
 
-    UTrie2 trie;
+    UCPTrie trie;
     uint8_t formatVersion[4];
 };
 
@@ -68,7 +69,7 @@ ucase_addPropertyStarts(const UCaseProps *csp, const USetAdder *sa, UErrorCode *
     }
 
     /* add the start code point of each same-value range of the trie */
-    utrie2_enum(&csp->trie, NULL, _enumPropertyStartsRange, sa);
+    ucptrie_enum(&csp->trie, NULL, _enumPropertyStartsRange, sa);
 
     /* add code points with hardcoded properties, plus the ones following them */
 
@@ -132,7 +133,7 @@ static const uint8_t flagsOffset[256]={
 
 U_CAPI UChar32 U_EXPORT2
 ucase_tolower(const UCaseProps *csp, UChar32 c) {
-    uint16_t props=UTRIE2_GET16(&csp->trie, c);
+    uint16_t props=UCPTRIE_FAST_GET(&csp->trie, UCPTRIE_16, c);
     if(!PROPS_HAS_EXCEPTION(props)) {
         if(UCASE_GET_TYPE(props)>=UCASE_UPPER) {
             c+=UCASE_GET_DELTA(props);
@@ -149,7 +150,7 @@ ucase_tolower(const UCaseProps *csp, UChar32 c) {
 
 U_CAPI UChar32 U_EXPORT2
 ucase_toupper(const UCaseProps *csp, UChar32 c) {
-    uint16_t props=UTRIE2_GET16(&csp->trie, c);
+    uint16_t props=UCPTRIE_FAST_GET(&csp->trie, UCPTRIE_16, c);
     if(!PROPS_HAS_EXCEPTION(props)) {
         if(UCASE_GET_TYPE(props)==UCASE_LOWER) {
             c+=UCASE_GET_DELTA(props);
@@ -166,7 +167,7 @@ ucase_toupper(const UCaseProps *csp, UChar32 c) {
 
 U_CAPI UChar32 U_EXPORT2
 ucase_totitle(const UCaseProps *csp, UChar32 c) {
-    uint16_t props=UTRIE2_GET16(&csp->trie, c);
+    uint16_t props=UCPTRIE_FAST_GET(&csp->trie, UCPTRIE_16, c);
     if(!PROPS_HAS_EXCEPTION(props)) {
         if(UCASE_GET_TYPE(props)==UCASE_LOWER) {
             c+=UCASE_GET_DELTA(props);
@@ -227,7 +228,7 @@ ucase_addCaseClosure(const UCaseProps *csp, UChar32 c, const USetAdder *sa) {
         break;
     }
 
-    props=UTRIE2_GET16(&csp->trie, c);
+    props=UCPTRIE_FAST_GET(&csp->trie, UCPTRIE_16, c);
     if(!PROPS_HAS_EXCEPTION(props)) {
         if(UCASE_GET_TYPE(props)!=UCASE_NONE) {
             /* add the one simple case mapping, no matter what type it is */
@@ -429,21 +430,21 @@ U_NAMESPACE_END
 /** @return UCASE_NONE, UCASE_LOWER, UCASE_UPPER, UCASE_TITLE */
 U_CAPI int32_t U_EXPORT2
 ucase_getType(const UCaseProps *csp, UChar32 c) {
-    uint16_t props=UTRIE2_GET16(&csp->trie, c);
+    uint16_t props=UCPTRIE_FAST_GET(&csp->trie, UCPTRIE_16, c);
     return UCASE_GET_TYPE(props);
 }
 
 /** @return same as ucase_getType() and set bit 2 if c is case-ignorable */
 U_CAPI int32_t U_EXPORT2
 ucase_getTypeOrIgnorable(const UCaseProps *csp, UChar32 c) {
-    uint16_t props=UTRIE2_GET16(&csp->trie, c);
+    uint16_t props=UCPTRIE_FAST_GET(&csp->trie, UCPTRIE_16, c);
     return UCASE_GET_TYPE_AND_IGNORABLE(props);
 }
 
 /** @return UCASE_NO_DOT, UCASE_SOFT_DOTTED, UCASE_ABOVE, UCASE_OTHER_ACCENT */
 static inline int32_t
 getDotType(const UCaseProps *csp, UChar32 c) {
-    uint16_t props=UTRIE2_GET16(&csp->trie, c);
+    uint16_t props=UCPTRIE_FAST_GET(&csp->trie, UCPTRIE_16, c);
     if(!PROPS_HAS_EXCEPTION(props)) {
         return props&UCASE_DOT_MASK;
     } else {
@@ -459,7 +460,7 @@ ucase_isSoftDotted(const UCaseProps *csp, UChar32 c) {
 
 U_CAPI UBool U_EXPORT2
 ucase_isCaseSensitive(const UCaseProps *csp, UChar32 c) {
-    uint16_t props=UTRIE2_GET16(&csp->trie, c);
+    uint16_t props=UCPTRIE_FAST_GET(&csp->trie, UCPTRIE_16, c);
     return (UBool)((props&UCASE_SENSITIVE)!=0);
 }
 
@@ -804,7 +805,7 @@ ucase_toFullLower(const UCaseProps *csp, UChar32 c,
                   const char *locale, int32_t *locCache)
 {
     UChar32 result=c;
-    uint16_t props=UTRIE2_GET16(&csp->trie, c);
+    uint16_t props=UCPTRIE_FAST_GET(&csp->trie, UCPTRIE_16, c);
     if(!PROPS_HAS_EXCEPTION(props)) {
         if(UCASE_GET_TYPE(props)>=UCASE_UPPER) {
             result=c+UCASE_GET_DELTA(props);
@@ -948,7 +949,7 @@ toUpperOrTitle(const UCaseProps *csp, UChar32 c,
                const char *locale, int32_t *locCache,
                UBool upperNotTitle) {
     UChar32 result=c;
-    uint16_t props=UTRIE2_GET16(&csp->trie, c);
+    uint16_t props=UCPTRIE_FAST_GET(&csp->trie, UCPTRIE_16, c);
     if(!PROPS_HAS_EXCEPTION(props)) {
         if(UCASE_GET_TYPE(props)==UCASE_LOWER) {
             result=c+UCASE_GET_DELTA(props);
@@ -1094,7 +1095,7 @@ ucase_toFullTitle(const UCaseProps *csp, UChar32 c,
 /* return the simple case folding mapping for c */
 U_CAPI UChar32 U_EXPORT2
 ucase_fold(const UCaseProps *csp, UChar32 c, uint32_t options) {
-    uint16_t props=UTRIE2_GET16(&csp->trie, c);
+    uint16_t props=UCPTRIE_FAST_GET(&csp->trie, UCPTRIE_16, c);
     if(!PROPS_HAS_EXCEPTION(props)) {
         if(UCASE_GET_TYPE(props)>=UCASE_UPPER) {
             c+=UCASE_GET_DELTA(props);
@@ -1158,7 +1159,7 @@ ucase_toFullFolding(const UCaseProps *csp, UChar32 c,
                     uint32_t options)
 {
     UChar32 result=c;
-    uint16_t props=UTRIE2_GET16(&csp->trie, c);
+    uint16_t props=UCPTRIE_FAST_GET(&csp->trie, UCPTRIE_16, c);
     if(!PROPS_HAS_EXCEPTION(props)) {
         if(UCASE_GET_TYPE(props)>=UCASE_UPPER) {
             result=c+UCASE_GET_DELTA(props);
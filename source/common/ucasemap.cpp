@@ -1,7 +1,7 @@
 /*
 *******************************************************************************
 *
-*   Copyright (C) 2005-2011, International Business Machines
+*   Copyright (C) 2005-2016, International Business Machines
 *   Corporation and others.  All Rights Reserved.
 *
 *******************************************************************************
@@ -174,6 +174,46 @@ appendResult(uint8_t *dest, int32_t destIndex, int32_t destCapacity,
     return destIndex;
 }
 
+/*
+ * Fast path for a run of Latin-1 characters with simple mappings, see ustr_imp.h.
+ * Maps src[srcIndex..] until the end of the run or srcLimit,
+ * and returns the srcIndex after the run.
+ * Like appendResult(), advances *pDestIndex beyond destCapacity for preflighting.
+ */
+static inline int32_t
+mapLatin1Run(const UChar *latin1Map,
+             uint8_t *dest, int32_t *pDestIndex, int32_t destCapacity,
+             const uint8_t *src, int32_t srcIndex, int32_t srcLimit) {
+    int32_t destIndex=*pDestIndex;
+    UChar m;
+    while(srcIndex<srcLimit) {
+        uint8_t b=src[srcIndex];
+        if(b<=0x7f) {
+            /* ASCII maps to ASCII */
+            if(destIndex<destCapacity) {
+                dest[destIndex]=(uint8_t)latin1Map[b];
+            }
+            ++destIndex;
+            ++srcIndex;
+        } else if(
+            (b==0xc2 || b==0xc3) && (srcIndex+1)<srcLimit && U8_IS_TRAIL(src[srcIndex+1]) &&
+            (m=latin1Map[((b&0x1f)<<6)|(src[srcIndex+1]&0x3f)])!=USTRCASE_LATIN1_SPECIAL
+        ) {
+            /* U+0080..U+00FF maps to U+0080..U+07FF, or to U+0178 etc. */
+            if((destIndex+1)<destCapacity) {
+                dest[destIndex]=(uint8_t)((m>>6)|0xc0);
+                dest[destIndex+1]=(uint8_t)((m&0x3f)|0x80);
+            }
+            destIndex+=2;
+            srcIndex+=2;
+        } else {
+            break;
+        }
+    }
+    *pDestIndex=destIndex;
+    return srcIndex;
+}
+
 static UChar32 U_CALLCONV
 utf8_caseContextIterator(void *context, int8_t dir) {
     UCaseContext *csc=(UCaseContext *)context;
@@ -211,7 +251,7 @@ utf8_caseContextIterator(void *context, int8_t dir) {
  * context [0..srcLength[ into account.
  */
 static int32_t
-_caseMap(const UCaseMap *csm, UCaseMapFull *map,
+_caseMap(const UCaseMap *csm, UCaseMapFull *map, const UChar *latin1Map,
          uint8_t *dest, int32_t destCapacity,
          const uint8_t *src, UCaseContext *csc,
          int32_t srcStart, int32_t srcLimit,
@@ -227,6 +267,12 @@ _caseMap(const UCaseMap *csm, UCaseMapFull *map,
     srcIndex=srcStart;
     destIndex=0;
     while(srcIndex<srcLimit) {
+        if(latin1Map!=NULL) {
+            srcIndex=mapLatin1Run(latin1Map, dest, &destIndex, destCapacity, src, srcIndex, srcLimit);
+            if(srcIndex>=srcLimit) {
+                break;
+            }
+        }
         csc->cpStart=srcIndex;
         U8_NEXT(src, srcIndex, srcLimit, c);
         csc->cpLimit=srcIndex;
@@ -359,6 +405,7 @@ ucasemap_internalUTF8ToTitle(const UCaseMap *csm,
                         destIndex+=
                             _caseMap(
                                 csm, ucase_toFullLower,
+                                ustrcase_isLatin1FastPathLocale(csm) ? ustrcase_latin1ToLower : NULL,
                                 dest+destIndex, destCapacity-destIndex,
                                 src, &csc,
                                 titleLimit, idx,
@@ -396,6 +443,7 @@ ucasemap_internalUTF8ToLower(const UCaseMap *csm,
     csc.limit=srcLength;
     return _caseMap(
         csm, ucase_toFullLower,
+        ustrcase_isLatin1FastPathLocale(csm) ? ustrcase_latin1ToLower : NULL,
         dest, destCapacity,
         src, &csc, 0, srcLength,
         pErrorCode);
@@ -411,6 +459,7 @@ ucasemap_internalUTF8ToUpper(const UCaseMap *csm,
     csc.limit=srcLength;
     return _caseMap(
         csm, ucase_toFullUpper,
+        ustrcase_isLatin1FastPathLocale(csm) ? ustrcase_latin1ToUpper : NULL,
         dest, destCapacity,
         src, &csc, 0, srcLength,
         pErrorCode);
@@ -428,9 +477,19 @@ utf8_foldCase(const UCaseProps *csp,
     UChar32 c, c2;
     int32_t start;
 
+    /* the Latin-1 fast path does not support the Turkic I options */
+    const UChar *latin1Map=
+        (options&_FOLD_CASE_OPTIONS_MASK)==U_FOLD_CASE_DEFAULT ? ustrcase_latin1Fold : NULL;
+
     /* case mapping loop */
     srcIndex=destIndex=0;
     while(srcIndex<srcLength) {
+        if(latin1Map!=NULL) {
+            srcIndex=mapLatin1Run(latin1Map, dest, &destIndex, destCapacity, src, srcIndex, srcLength);
+            if(srcIndex>=srcLength) {
+                break;
+            }
+        }
         start=srcIndex;
         U8_NEXT(src, srcIndex, srcLength, c);
         if(c<0) {
@@ -1,6 +1,6 @@
 /*
 ********************************************************************************
-*   Copyright (C) 1996-2014, International Business Machines
+*   Copyright (C) 1996-2016, International Business Machines
 *   Corporation and others.  All Rights Reserved.
 ********************************************************************************
 *
@@ -23,9 +23,14 @@
 #include "unicode/uchar.h"
 #include "unicode/uscript.h"
 #include "unicode/udata.h"
+#include "unicode/ustring.h"
+#include "unicode/utf8.h"
+#include "unicode/utf16.h"
 #include "uassert.h"
 #include "cmemory.h"
+#include "cstring.h"
 #include "ucln_cmn.h"
+#include "ucptrie.h"
 #include "utrie2.h"
 #include "udataswp.h"
 #include "uprops.h"
@@ -38,7 +43,7 @@
 /* constants and macros for access to the data ------------------------------ */
 
 /* getting a uint32_t properties word from the data */
-#define GET_PROPS(c, result) ((result)=UTRIE2_GET16(&propsTrie, c));
+#define GET_PROPS(c, result) ((result)=UCPTRIE_FAST_GET(&propsTrie, UCPTRIE_16, c));
 
 U_CFUNC UBool
 uprv_haveProperties(UErrorCode *pErrorCode) {
@@ -87,7 +92,187 @@ u_enumCharTypes(UCharEnumTypeRange *enumRange, const void *context) {
 
     callback.enumRange=enumRange;
     callback.context=context;
-    utrie2_enum(&propsTrie, _enumTypeValue, _enumTypeRange, &callback);
+    ucptrie_enum(&propsTrie, _enumTypeValue, _enumTypeRange, &callback);
+}
+
+/* Bulk general category lookups -------------------------------------------- */
+
+/*
+ * Gets the properties word for the next code point in UTF-16 text, from s before limit.
+ * Consecutive BMP code points in the same trie data block
+ * reuse the block's data offset (blockStart) without another index lookup.
+ * block must be initialized to -1.
+ */
+#define GET_PROPS_U16_NEXT(s, limit, block, blockStart, props) { \
+    UChar32 __c=*(s)++; \
+    if(!U16_IS_SURROGATE(__c)) { \
+        if((__c>>UCPTRIE_FAST_SHIFT)!=(block)) { \
+            (block)=__c>>UCPTRIE_FAST_SHIFT; \
+            (blockStart)=propsTrie.index[block]; \
+        } \
+        (props)=propsTrie.data.ptr16[(blockStart)+(__c&UCPTRIE_FAST_DATA_MASK)]; \
+    } else if(U16_IS_SURROGATE_LEAD(__c) && (s)!=(limit) && U16_IS_TRAIL(*(s))) { \
+        __c=U16_GET_SUPPLEMENTARY(__c, *(s)++); \
+        (props)=UCPTRIE_FAST_SUPP_GET(&propsTrie, UCPTRIE_16, __c); \
+    } else { \
+        (props)=UCPTRIE_FAST_BMP_GET(&propsTrie, UCPTRIE_16, __c); \
+    } \
+}
+
+/*
+ * Gets the properties word for the next code point in UTF-8 text, from s[i] before s[length].
+ * Each ill-formed sequence gets the properties of U+FFFD.
+ * Otherwise the same as GET_PROPS_U16_NEXT.
+ *
+ * Unlike U8_NEXT(), this also decodes lead byte E0 inline
+ * because it starts most of the Indic scripts.
+ * ED (surrogates) and 4-byte sequences go through utf8_nextCharSafeBody().
+ */
+#define GET_PROPS_U8_NEXT(s, i, length, block, blockStart, props) { \
+    UChar32 __c=(s)[(i)++]; \
+    uint8_t __t1, __t2; \
+    if(__c<0x80) { \
+        /* ASCII */ \
+    } else if( \
+        (0xe0<=__c && __c<=0xef && __c!=0xed) && \
+        ((i)+1)<(length) && \
+        (__t1=(uint8_t)((s)[i]-0x80))<=0x3f && (__c!=0xe0 || __t1>=0x20) && \
+        (__t2=(uint8_t)((s)[(i)+1]-0x80))<=0x3f \
+    ) { \
+        __c=((__c&0xf)<<12)|(__t1<<6)|__t2; \
+        (i)+=2; \
+    } else if( \
+        (0xc2<=__c && __c<0xe0) && \
+        (i)!=(length) && \
+        (__t1=(uint8_t)((s)[i]-0x80))<=0x3f \
+    ) { \
+        __c=((__c&0x1f)<<6)|__t1; \
+        ++(i); \
+    } else { \
+        __c=utf8_nextCharSafeBody(s, &(i), length, __c, -1); \
+        if(__c<0) { \
+            __c=0xfffd; \
+        } \
+    } \
+    if(__c<=0xffff) { \
+        if((__c>>UCPTRIE_FAST_SHIFT)!=(block)) { \
+            (block)=__c>>UCPTRIE_FAST_SHIFT; \
+            (blockStart)=propsTrie.index[block]; \
+        } \
+        (props)=propsTrie.data.ptr16[(blockStart)+(__c&UCPTRIE_FAST_DATA_MASK)]; \
+    } else { \
+        (props)=UCPTRIE_FAST_SUPP_GET(&propsTrie, UCPTRIE_16, __c); \
+    } \
+}
+
+U_CAPI int32_t U_EXPORT2
+u_strCharTypes(const UChar *s, int32_t length,
+               int8_t *types, int32_t capacity,
+               UErrorCode *pErrorCode) {
+    const UChar *limit;
+    int32_t count, block, blockStart;
+    uint32_t props;
+
+    if(U_FAILURE(*pErrorCode)) {
+        return 0;
+    }
+    if( (s==NULL && length!=0) || length<-1 ||
+        capacity<0 || (types==NULL && capacity>0)
+    ) {
+        *pErrorCode=U_ILLEGAL_ARGUMENT_ERROR;
+        return 0;
+    }
+    if(length<0) {
+        length=u_strlen(s);
+    }
+    limit=s+length;
+    count=0;
+    block=-1;
+    blockStart=0;
+    while(s<limit) {
+        GET_PROPS_U16_NEXT(s, limit, block, blockStart, props);
+        if(count<capacity) {
+            types[count]=(int8_t)GET_CATEGORY(props);
+        }
+        ++count;
+    }
+    if(count>capacity) {
+        *pErrorCode=U_BUFFER_OVERFLOW_ERROR;
+    }
+    return count;
+}
+
+U_CAPI int32_t U_EXPORT2
+u_strCharTypesUTF8(const char *s, int32_t length,
+                   int8_t *types, int32_t capacity,
+                   UErrorCode *pErrorCode) {
+    const uint8_t *s8;
+    int32_t i, count, block, blockStart;
+    uint32_t props;
+
+    if(U_FAILURE(*pErrorCode)) {
+        return 0;
+    }
+    if( (s==NULL && length!=0) || length<-1 ||
+        capacity<0 || (types==NULL && capacity>0)
+    ) {
+        *pErrorCode=U_ILLEGAL_ARGUMENT_ERROR;
+        return 0;
+    }
+    if(length<0) {
+        length=(int32_t)uprv_strlen(s);
+    }
+    s8=(const uint8_t *)s;
+    i=count=0;
+    block=-1;
+    blockStart=0;
+    while(i<length) {
+        if(s8[i]<0x80 && count<capacity) {
+            /* ASCII fast path: the ASCII data is in the first data block */
+            types[count++]=(int8_t)GET_CATEGORY(UCPTRIE_FAST_BMP_GET(&propsTrie, UCPTRIE_16, s8[i]));
+            ++i;
+            continue;
+        }
+        GET_PROPS_U8_NEXT(s8, i, length, block, blockStart, props);
+        if(count<capacity) {
+            types[count]=(int8_t)GET_CATEGORY(props);
+        }
+        ++count;
+    }
+    if(count>capacity) {
+        *pErrorCode=U_BUFFER_OVERFLOW_ERROR;
+    }
+    return count;
+}
+
+U_CFUNC int32_t
+uprv_spanCharTypes(const UChar *s, int32_t length, uint32_t mask) {
+    const UChar *start=s, *limit=s+length, *prev;
+    int32_t block=-1, blockStart=0;
+    uint32_t props;
+    while(s<limit) {
+        prev=s;
+        GET_PROPS_U16_NEXT(s, limit, block, blockStart, props);
+        if((CAT_MASK(props)&mask)==0) {
+            return (int32_t)(prev-start);
+        }
+    }
+    return length;
+}
+
+U_CFUNC int32_t
+uprv_spanCharTypesUTF8(const char *s, int32_t length, uint32_t mask) {
+    const uint8_t *s8=(const uint8_t *)s;
+    int32_t i=0, prev, block=-1, blockStart=0;
+    uint32_t props;
+    while(i<length) {
+        prev=i;
+        GET_PROPS_U8_NEXT(s8, i, length, block, blockStart, props);
+        if((CAT_MASK(props)&mask)==0) {
+            return prev;
+        }
+    }
+    return length;
 }
 
 /* Checks if ch is a lower case letter.*/
@@ -520,7 +705,7 @@ u_getUnicodeProperties(UChar32 c, int32_t column) {
     if(column>=propsVectorsColumns) {
         return 0;
     } else {
-        uint16_t vecIndex=UTRIE2_GET16(&propsVectorsTrie, c);
+        uint16_t vecIndex=UCPTRIE_FAST_GET(&propsVectorsTrie, UCPTRIE_16, c);
         return propsVectors[vecIndex+column];
     }
 }
@@ -658,7 +843,7 @@ uchar_addPropertyStarts(const USetAdder *sa, UErrorCode *pErrorCode) {
     }
 
     /* add the start code point of each same-value range of the main trie */
-    utrie2_enum(&propsTrie, NULL, _enumPropertyStartsRange, sa);
+    ucptrie_enum(&propsTrie, NULL, _enumPropertyStartsRange, sa);
 
     /* add code points with hardcoded properties, plus the ones following them */
 
@@ -720,6 +905,6 @@ upropsvec_addPropertyStarts(const USetAdder *sa, UErrorCode *pErrorCode) {
     /* add the start code point of each same-value range of the properties vectors trie */
     if(propsVectorsColumns>0) {
         /* if propsVectorsColumns==0 then the properties vectors trie may not be there at all */
-        utrie2_enum(&propsVectorsTrie, NULL, _enumPropertyStartsRange, sa);
+        ucptrie_enum(&propsVectorsTrie, NULL, _enumPropertyStartsRange, sa);
     }
 }
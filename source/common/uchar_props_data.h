@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 1999-2015, International Business Machines
+ * Copyright (C) 1999-2016, International Business Machines
  * Corporation and others.  All Rights Reserved.
  *
  * file name: uchar_props_data.h
@@ -13,1554 +13,1543 @@
 
 static const UVersionInfo dataVersion={8,0,0,0};
 
-static const uint16_t propsTrie_index[19820]={
-0x41e,0x426,0x42e,0x436,0x44e,0x456,0x45e,0x466,0x46e,0x476,0x47c,0x484,0x48c,0x494,0x49c,0x4a4,
-0x4aa,0x4b2,0x4ba,0x4c2,0x4c5,0x4cd,0x4d5,0x4dd,0x4e5,0x4ed,0x4e9,0x4f1,0x4f9,0x501,0x506,0x50e,
-0x516,0x51e,0x522,0x52a,0x532,0x53a,0x542,0x54a,0x546,0x54e,0x553,0x55b,0x561,0x569,0x571,0x579,
-0x581,0x589,0x591,0x599,0x59e,0x5a6,0x5a9,0x5b1,0x5b9,0x5c1,0x5c7,0x5cf,0x5ce,0x5d6,0x5de,0x5e6,
-0x5f6,0x5ee,0x5fe,0x43e,0x43e,0x60e,0x43e,0x606,0x61e,0x620,0x628,0x616,0x638,0x63e,0x646,0x630,
-0x656,0x65c,0x664,0x64e,0x674,0x67a,0x682,0x66c,0x692,0x698,0x6a0,0x68a,0x6b0,0x6b8,0x6c0,0x6a8,
-0x6d0,0x6d6,0x6de,0x6c8,0x6ee,0x6f4,0x6fc,0x6e6,0x6ee,0x70b,0x713,0x704,0x723,0x72a,0x732,0x71b,
-0x5ca,0x73a,0x742,0x43e,0x74a,0x752,0x75a,0x43e,0x762,0x76a,0x772,0x777,0x77f,0x786,0x78e,0x43e,
-0x589,0x796,0x79e,0x7a6,0x7ae,0x516,0x7be,0x7b6,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,
-0x589,0x589,0x7c4,0x589,0x7cc,0x7c2,0x7d4,0x589,0x7d0,0x589,0x7da,0x7e2,0x7ea,0x516,0x516,0x7f2,
-0x7fa,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,
-0x589,0x589,0x589,0x7ff,0x807,0x589,0x589,0x80f,0x817,0x81f,0x827,0x82f,0x589,0x837,0x83f,0x847,
-0x857,0x589,0x85f,0x861,0x589,0x84f,0x589,0x869,0x87d,0x871,0x879,0x885,0x589,0x88d,0x893,0x89b,
-0x8a3,0x589,0x8b3,0x8bb,0x8c3,0x8ab,0x43e,0x43e,0x8d3,0x8d6,0x8de,0x8cb,0x8ee,0x8e6,0x589,0x8f5,
-0x589,0x904,0x8fd,0x90c,0x43e,0x43e,0x914,0x91c,0x4be,0x924,0x927,0x92d,0x934,0x927,0x4e5,0x93c,
-0x46e,0x46e,0x46e,0x46e,0x944,0x46e,0x46e,0x46e,0x954,0x95c,0x964,0x96c,0x974,0x978,0x980,0x94c,
-0x998,0x9a0,0x988,0x990,0x9a8,0x9b0,0x9b8,0x9c0,0x9d8,0x9c8,0x9d0,0x9e0,0x9e8,0x9f7,0x9fc,0x9ef,
-0xa04,0xa04,0xa04,0xa04,0xa04,0xa04,0xa04,0xa04,0xa0c,0xa14,0x89b,0xa17,0xa1f,0xa26,0xa2b,0xa33,
-0x89b,0xa38,0xa37,0xa48,0xa4b,0x89b,0x89b,0xa40,0x89b,0x89b,0x89b,0x89b,0x89b,0xa5a,0xa62,0xa52,
-0x89b,0x89b,0x89b,0xa67,0x89b,0x89b,0x89b,0x89b,0x89b,0x89b,0x89b,0xa6d,0xa75,0x89b,0xa7d,0xa84,
-0x89b,0x89b,0x89b,0x89b,0x89b,0x89b,0x89b,0x89b,0xa04,0xa04,0xa04,0xa04,0xa8c,0xa04,0xa93,0xa9a,
-0xa04,0xa04,0xa04,0xa04,0xa04,0xa04,0xa04,0xa04,0x89b,0xaa2,0xaa9,0xaad,0xab3,0xab9,0xac1,0xac6,
-0x516,0xad6,0xace,0xade,0x46e,0x46e,0x46e,0xae6,0x4be,0xaee,0x589,0xaf4,0xb04,0xafc,0xafc,0x4e5,
-0xb0c,0xb14,0xb1c,0x43e,0xb24,0x89b,0x89b,0xb2b,0x89b,0x89b,0x89b,0x89b,0x89b,0x89b,0xb33,0xb39,
-0xb49,0xb41,0x5ca,0x589,0xb51,0x7fa,0x589,0xb59,0xb61,0xb66,0x589,0x589,0xb6b,0x575,0x89b,0xb72,
-0xb7a,0xb82,0xb88,0x89b,0xb82,0xb90,0x89b,0xb7a,0x89b,0x89b,0x89b,0x89b,0x89b,0x89b,0x89b,0x89b,
-0xb98,0x589,0x589,0x589,0xba0,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,
-0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,
-0x589,0xba6,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,
-0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0xbab,0x589,0x589,0x589,0x589,0x589,
-0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,
-0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,
-0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,
-0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,
-0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,
-0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,
-0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,
-0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,
-0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x869,0x89b,0x89b,
-0xbb3,0x589,0xbb6,0x589,0xbbe,0xbc4,0xbcc,0xbd4,0xbd9,0x589,0x589,0xbdd,0x589,0x589,0x589,0x589,
-0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0xbe4,0x589,0xbeb,0xbf1,0x589,0x589,0x589,0x589,
-0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0xbf9,0x589,0x589,0x589,0xc01,0x589,
-0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,
-0x589,0x589,0x589,0x589,0x589,0x589,0xc03,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,
-0x589,0x589,0x589,0x589,0x589,0x589,0x589,0xc0a,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,
-0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,
-0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,
-0x589,0x589,0x589,0xc11,0x589,0x589,0x589,0xc18,0xc20,0x589,0x589,0x589,0x589,0x589,0x589,0x589,
-0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,
-0x589,0x589,0x589,0x589,0x589,0x589,0x589,0xc25,0x589,0x589,0xc2d,0x589,0x589,0x589,0x589,0x589,
-0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,
-0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0xc31,0x589,
-0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,
-0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,
-0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,
-0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0xc34,0x589,0x589,0x589,0x589,0x589,0x589,0x589,
-0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,
-0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0xc37,0x589,0x589,0x589,
-0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,
-0x589,0x589,0x589,0xc3d,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,
-0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,
-0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,
-0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,
-0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,
-0x589,0x589,0x589,0x589,0xc45,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,
-0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,
-0x589,0xc4a,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,
-0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,
-0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,
-0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,
-0x589,0x589,0x589,0x589,0x589,0xc4f,0x589,0x589,0x589,0xc54,0x589,0x589,0x589,0x589,0x589,0x589,
-0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,
-0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,
-0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,
-0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,
-0x589,0xc5c,0xc63,0xc67,0x589,0x589,0x589,0xc6e,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,
-0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,
-0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,
-0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,
-0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x869,0x43e,
-0xc7c,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,
-0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,
-0x589,0x589,0x589,0x589,0xc74,0x89b,0xc84,0x90c,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,
-0xc89,0xc91,0x46e,0xca1,0xc99,0x589,0x589,0xca9,0xcb1,0xcc1,0x46e,0xcc6,0xcce,0xcd4,0x43e,0xcb9,
-0xcdc,0xce4,0x589,0xcec,0xcfc,0xcff,0xcf4,0xd07,0x5de,0xd0f,0xd16,0xd1e,0x61e,0xd2e,0xd26,0xd36,
-0x589,0xd3e,0xd46,0xd4e,0x589,0xd56,0xd5e,0xd66,0xd6e,0xd76,0xd7a,0xd82,0x4be,0x4be,0x589,0xd8a,
-0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,
-0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,
-0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,
-0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,
-0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,
-0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,
-0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,
-0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,
-0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,
-0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,
-0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,
-0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,
-0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,
-0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,
-0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,
-0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,
-0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,
-0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,
-0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,
-0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,
-0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,
-0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0xd92,0xd99,0x860,
-0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,
-0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,
-0xda1,0xda1,0xda1,0xda1,0xda1,0xda1,0xda1,0xda1,0xda1,0xda1,0xda1,0xda1,0xda1,0xda1,0xda1,0xda1,
-0xda1,0xda1,0xda1,0xda1,0xda1,0xda1,0xda1,0xda1,0xda1,0xda1,0xda1,0xda1,0xda1,0xda1,0xda1,0xda1,
-0xda9,0xda9,0xda9,0xda9,0xda9,0xda9,0xda9,0xda9,0xda9,0xda9,0xda9,0xda9,0xda9,0xda9,0xda9,0xda9,
-0xda9,0xda9,0xda9,0xda9,0xda9,0xda9,0xda9,0xda9,0xda9,0xda9,0xda9,0xda9,0xda9,0xda9,0xda9,0xda9,
-0xda9,0xda9,0xda9,0xda9,0xda9,0xda9,0xda9,0xda9,0xda9,0xda9,0xda9,0xda9,0xda9,0xda9,0xda9,0xda9,
-0xda9,0xda9,0xda9,0xda9,0xda9,0xda9,0xda9,0xda9,0xda9,0xda9,0xda9,0xda9,0xda9,0xda9,0xda9,0xda9,
-0xda9,0xda9,0xda9,0xda9,0xda9,0xda9,0xda9,0xda9,0xda9,0xda9,0xda9,0xda9,0xda9,0xda9,0xda9,0xda9,
-0xda9,0xda9,0xda9,0xda9,0xda9,0xda9,0xda9,0xda9,0xda9,0xda9,0xda9,0xda9,0xda9,0xda9,0xda9,0xda9,
-0xda9,0xda9,0xda9,0xda9,0xda9,0xda9,0xda9,0xda9,0xda9,0xda9,0xda9,0xda9,0xda9,0xda9,0xda9,0xda9,
-0xda9,0xda9,0xda9,0xda9,0xda9,0xda9,0xda9,0xda9,0xda9,0xda9,0xda9,0xda9,0xda9,0xda9,0xda9,0xda9,
-0xda9,0xda9,0xda9,0xda9,0xda9,0xda9,0xda9,0xda9,0xda9,0xda9,0xda9,0xda9,0xda9,0xda9,0xda9,0xda9,
-0xda9,0xda9,0xda9,0xda9,0xda9,0xda9,0xda9,0xda9,0xda9,0xda9,0xda9,0xda9,0xda9,0xda9,0xda9,0xda9,
-0xda9,0xda9,0xda9,0xda9,0xda9,0xda9,0xda9,0xda9,0xda9,0xda9,0xda9,0xda9,0xda9,0xda9,0xda9,0xda9,
-0xda9,0xda9,0xda9,0xda9,0xda9,0xda9,0xda9,0xda9,0xda9,0xda9,0xda9,0xda9,0xda9,0xda9,0xda9,0xda9,
-0xda9,0xda9,0xda9,0xda9,0xda9,0xda9,0xda9,0xda9,0x589,0x589,0x589,0xdb1,0x589,0xc6f,0xdb8,0xdbd,
-0x589,0x589,0x589,0xdc5,0x589,0x589,0xdc9,0x43e,0xde1,0xdd1,0xdd9,0x589,0x589,0xde9,0xdf1,0x589,
-0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0xdf6,0xdfe,0x589,0xe02,0x589,0xe08,0xe0c,
-0xe14,0xe1c,0xe23,0xe2b,0x589,0x589,0x589,0xe31,0xe49,0x42e,0xe51,0xe59,0xe5e,0x87d,0xe39,0xe41,
-0xda1,0xda1,0xda1,0xda1,0xda1,0xda1,0xda1,0xda1,0xda1,0xda1,0xda1,0xda1,0xda1,0xda1,0xda1,0xda1,
-0xda1,0xda1,0xda1,0xda1,0xda1,0xda1,0xda1,0xda1,0xda1,0xda1,0xda1,0xda1,0xda1,0xda1,0xda1,0xda1,
-0x10f8,0x10f8,0x1138,0x1178,0x11b8,0x11f0,0x1230,0x1270,0x12a8,0x12e8,0x1314,0x1354,0x1394,0x13a4,0x13e4,0x1418,
-0x1458,0x1488,0x14c8,0x1508,0x1518,0x154c,0x1584,0x15c4,0x1604,0x1644,0x1678,0x16a4,0x16e4,0x171c,0x1738,0x1778,
-0xa80,0xac0,0xb00,0xb3b,0xb7b,0xa40,0xbbb,0xa40,0xbdd,0xa40,0xa40,0xa40,0xa40,0xc1d,0xa40,0xa40,
-0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xc5d,0xc7d,0xa40,0xa40,0xcbd,0xcfd,0xa40,0xd3d,0xd7d,0xdbd,
-0xdfd,0xe34,0x1db,0x1db,0xe58,0xe8c,0x1db,0xeb4,0x1db,0x1db,0x1db,0x1db,0xee1,0x1db,0x1db,0x1db,
-0x1db,0x1db,0x1db,0x1db,0xef5,0x1db,0xf2d,0xf6d,0x1db,0xf78,0xa40,0xa40,0xa40,0xa40,0xa40,0xfb8,
-0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,
-0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,
-0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,
-0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,
-0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,
-0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,
-0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,
-0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,
-0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,
-0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,
-0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,
-0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,
-0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,
-0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,
-0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,
-0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,
-0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,
-0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,
-0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,
-0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,
-0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,
-0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,
-0xff8,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,
-0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,
-0x700,0x700,0x700,0x700,0x700,0x700,0x700,0x700,0x700,0x700,0x700,0x700,0x700,0x700,0x700,0x700,
-0x700,0x700,0x700,0x700,0x700,0x700,0x700,0x700,0x700,0x700,0x700,0x700,0x700,0x700,0x700,0x1038,
-0x700,0x700,0x700,0x700,0x700,0x700,0x700,0x700,0x700,0x700,0x700,0x700,0x700,0x700,0x700,0x700,
-0x700,0x700,0x700,0x700,0x700,0x700,0x700,0x700,0x700,0x700,0x700,0x700,0x700,0x700,0x700,0x1038,
-0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,
-0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,
-0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,
-0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,
-0xe66,0xe6d,0xe75,0x43e,0x589,0x589,0x589,0x575,0xe85,0xe7d,0xe9c,0xe8d,0xe94,0xea4,0xb20,0xeac,
-0x43e,0x43e,0x43e,0x43e,0xd1e,0x589,0xeb4,0xebc,0x589,0xec4,0xecc,0xed0,0xed8,0x589,0xee0,0x43e,
-0x516,0x520,0xee8,0x589,0xeec,0xef4,0x43e,0x43e,0x589,0x865,0x589,0xefc,0x43e,0x43e,0x43e,0x43e,
-0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0xb04,0x869,0xe08,0x43e,0x43e,0x43e,0x43e,
-0xf0c,0xf04,0xf0f,0xf17,0x87d,0xf1f,0x43e,0xf27,0xf2f,0xf37,0x43e,0x43e,0x589,0xf47,0xf4f,0xf3f,
-0xf5f,0xf66,0xf57,0xf6e,0xf76,0x43e,0xf86,0xf7e,0x589,0xf89,0xf91,0xf99,0xfa1,0xfa9,0x43e,0x43e,
-0x589,0x589,0xfb1,0x43e,0x516,0xfb9,0x4be,0xfc1,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,
-0x43e,0x43e,0x43e,0xfc9,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,
-0xfd9,0x5bf,0xfe1,0xfd1,0x8ee,0xfe9,0xff1,0xff7,0x100f,0xfff,0x1007,0x1013,0x8ee,0x1023,0x101b,0x102b,
-0x103b,0x1033,0x43e,0x43e,0x1042,0x104a,0x5e1,0x1052,0x1062,0x67a,0x106a,0x105a,0x43e,0x43e,0x43e,0x43e,
-0x43e,0x43e,0x43e,0x43e,0x589,0x1072,0x107a,0x43e,0x43e,0x43e,0x43e,0x43e,0x589,0x1082,0x108a,0x43e,
-0x589,0x1092,0x109a,0x43e,0x589,0x10a2,0xef4,0x43e,0x10b2,0x10aa,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,
-0x516,0x4be,0x10ba,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,
-0x43e,0x589,0x10c2,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,
-0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,
-0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x589,0x589,0x589,0x589,0x589,
-0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,
-0x589,0x589,0x589,0x589,0x589,0x589,0x589,0xdc9,0x43e,0x43e,0x43e,0x10d2,0x10da,0x10e2,0x10ca,0x589,
-0x589,0x589,0x589,0x589,0x589,0x10ea,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,
-0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x589,0x589,0x589,0x589,0x589,
-0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,
-0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x10f2,0x43e,0x43e,0x43e,
-0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,
-0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x589,0x589,0x589,
-0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x10f4,
-0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x589,0x589,0x589,
-0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x10c2,0x87d,
-0x10fc,0x43e,0x43e,0xdfe,0x1104,0x589,0x1114,0x111c,0x1124,0x110c,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,
-0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,
-0x43e,0x43e,0x43e,0x43e,0x43e,0x589,0x589,0x112c,0x1131,0x1139,0x43e,0x43e,0x43e,0x1141,0x43e,0x43e,
-0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,
-0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,
-0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,
-0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x589,0x589,0x589,
-0x1149,0x114e,0x1156,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,
-0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x89b,0x89b,0x89b,
-0x89b,0x89b,0x89b,0x89b,0xb33,0x89b,0x115e,0x89b,0x1165,0x116d,0x1173,0x89b,0x1179,0x89b,0x89b,0x1181,
-0x43e,0x43e,0x43e,0x43e,0x43e,0x89b,0x89b,0xa34,0x1189,0x43e,0x43e,0x43e,0x43e,0x1199,0x11a0,0x11a5,
-0x11ab,0x11b3,0x11bb,0x11c3,0x119d,0x11cb,0x11d3,0x11db,0x11e0,0x11b2,0x1199,0x11a0,0x119c,0x11ab,0x11e8,0x119a,
-0x11eb,0x119d,0x11f3,0x11fb,0x1203,0x120a,0x11f6,0x11fe,0x1206,0x120d,0x11f9,0x1215,0x1191,0x89b,0x89b,0x89b,
-0x89b,0x89b,0x89b,0x89b,0x89b,0x89b,0x89b,0x89b,0x89b,0x89b,0x89b,0x89b,0x89b,0x4e5,0x1225,0x4e5,
-0x122c,0x1233,0x121d,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,
-0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,
-0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x589,0x589,0x589,
-0x589,0x589,0x589,0x123b,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,
-0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,
-0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x1249,0x1251,0x1259,
-0x1261,0x1269,0x1271,0x43e,0x1241,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x89b,0x1279,0x89b,
-0x89b,0xb2b,0x127e,0x1282,0xb33,0x128a,0x128f,0x89b,0x1279,0x1293,0x43e,0x43e,0x129a,0x12a2,0x1293,0x12a8,
-0x43e,0x43e,0x43e,0x43e,0x43e,0x89b,0x89b,0x89b,0x89b,0x89b,0x89b,0x89b,0x12b0,0x89b,0x89b,0x89b,
-0x89b,0x89b,0x89b,0x89b,0x89b,0x89b,0x89b,0x89b,0xb24,0x89b,0x12b8,0x89b,0x89b,0x89b,0x89b,0x89b,
-0x89b,0x89b,0x89b,0x1177,0x12bd,0x89b,0x89b,0x89b,0xb2b,0x89b,0x89b,0x12c5,0x43e,0x1279,0x89b,0x12cd,
-0x89b,0x12d5,0xb35,0x43e,0x43e,0x12dd,0x43e,0x43e,0x43e,0x12e2,0x43e,0xea4,0x43e,0x43e,0x43e,0x43e,
-0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,
-0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,
-0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x12ea,0x589,0x589,
-0x12f1,0x589,0x589,0x589,0x12f9,0x589,0x1301,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,
-0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,
-0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,
-0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0xc15,0x589,0x589,
-0x1309,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x1311,0x1319,0x589,0x589,0x589,
-0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,
-0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,
-0x589,0x589,0x589,0x589,0xc54,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,
-0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,
-0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x1320,0x589,0x589,0x589,0x589,0x589,0x589,0x589,
-0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,
-0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,
-0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x1327,0x589,0x589,0x589,
-0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,
-0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,
-0x589,0x589,0x589,0x589,0x132e,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,
-0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,
-0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,
-0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0xb04,0x43e,0x589,0x589,0x589,
-0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,
-0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,
-0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,
-0x589,0x589,0x589,0x589,0x589,0x589,0x60e,0x589,0x589,0x589,0x589,0x589,0x589,0xeec,0x589,0x589,
-0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,
-0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,
-0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,
-0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x1141,0x43e,0x43e,
-0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x589,0x589,0x589,0x589,0x1332,0x589,0x589,0x589,
-0x589,0x589,0x589,0x589,0x589,0x589,0x589,0x589,0xeec,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,
-0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,
-0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,
-0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x1342,0x133a,0x133a,0x133a,0x43e,0x43e,0x43e,0x43e,
-0x4e5,0x4e5,0x4e5,0x4e5,0x4e5,0x4e5,0x4e5,0x134a,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,
-0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,
-0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,
-0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0xda9,0xda9,0xda9,0xda9,0xda9,0xda9,0xda9,0xda9,
-0xda9,0xda9,0xda9,0xda9,0xda9,0xda9,0xda9,0xda9,0xda9,0xda9,0xda9,0xda9,0xda9,0xda9,0xda9,0xda9,
-0xda9,0xda9,0xda9,0xda9,0xda9,0xda9,0xda9,0xda9,0xda9,0xda9,0xda9,0xda9,0xda9,0xda9,0xda9,0xda9,
-0xda9,0xda9,0xda9,0xda9,0xda9,0xda9,0xda9,0xda9,0xda9,0xda9,0xda9,0xda9,0xda9,0xda9,0xda9,0xda9,
-0xda9,0xda9,0xda9,0xda9,0xda9,0xda9,0xda9,0x1352,0xf,0xf,0xf,0xf,0xf,0xf,0xf,0xf,
+static const uint16_t propsTrie_index[4232]={
+0,0x3f,0x7e,0xbe,0xfe,0x12d,0x16c,0x1ac,0x1e4,0x223,0x24f,0x28d,0x2cd,0x2dd,0x31d,0x34e,
+0x38b,0x3bb,0x3f9,0x439,0x449,0x47a,0x4b2,0x4f2,0x532,0x572,0x5a3,0x5cf,0x60f,0x644,0x65e,0x69e,
+0x6de,0x71e,0x73e,0x773,0x7b0,0x7ef,0x82e,0x86d,0x8ac,0x8eb,0x92a,0x969,0x9a8,0x9e6,0xa24,0xa64,
+0xaa4,0xae3,0xb23,0xb63,0xba2,0xbe1,0xc21,0xc61,0xca0,0xce0,0xd1f,0xd5f,0xd9f,0xddf,0xe1f,0xe5d,
+0xe9d,0xedd,0xf1b,0xf55,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0xf92,0xfc9,0x1007,0x1036,0x105b,0x109b,0x10bb,
+0x10fb,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x110e,0x114e,0x116e,0x11ae,0x11ee,0x122e,0x126c,
+0x12ac,0x12e9,0x1329,0x1359,0x1399,0x13d9,0x1419,0x144f,0x148f,0x14ba,0x14fa,0x1539,0x1579,0x15b7,0x15f7,0x1631,
+0x1671,0x16b1,0x1539,0x16ef,0x172f,0x175b,0x1740,0x179b,0x17db,0x17db,0x1805,0x17db,0x1844,0x1884,0x18c4,0x1903,
+0x1943,0x1982,0x19c2,0x1a01,0x1a41,0x1a81,0x1ac0,0x1af2,0x1b26,0x1b26,0x1b26,0x1b26,0x1b66,0x1b91,0x1bce,0x1c02,
+0x1c42,0x1c82,0x1cae,0x1cca,0x1d0a,0x1d0a,0x1b96,0x1d49,0x1d0a,0x1b9e,0x1d0a,0x1d0a,0x1d0a,0x1d89,0x1dbf,0x1dff,
+0x1d0a,0x1d0a,0x1d0a,0x1d0a,0x1b26,0x1b26,0x1e3c,0x1e64,0x1b26,0x1b26,0x1b26,0x1b26,0x1ea4,0x1edf,0x1efd,0x1f3a,
+0x1f7a,0x1faa,0x17db,0x1fe9,0x2029,0x2059,0x2099,0x20b9,0x20f9,0x2139,0x2179,0x2194,0x1d0a,0x1d0a,0x1d0a,0x21b2,
+0x21f2,0x2232,0x225b,0x227c,0x22bc,0x5a3,0x22ed,0x232d,0x236d,0x23a5,0x23e5,0x2425,0x1d0a,0x1d0a,0x1d0a,0x1d0a,
+0x2465,0x5a3,0x24a2,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,
+0x24b8,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x24eb,0x5a3,0x5a3,
+0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,
+0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,
+0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,
+0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,
+0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x1359,0x1d0a,0x252b,0x254e,0x2582,0x25c2,0x25f5,0x2605,0x5a3,0x5a3,
+0x5a3,0x5a3,0x5a3,0x5a3,0x2641,0x267b,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x26ba,0x5a3,0x26f9,
+0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x271e,0x5a3,0x5a3,0x5a3,0x5a3,
+0x5a3,0x5a3,0x5a3,0x273a,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,
+0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x2774,0x5a3,0x27af,0x27ef,0x5a3,0x5a3,0x5a3,
+0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x2800,0x5a3,0x283f,0x5a3,0x5a3,
+0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x24e6,
+0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,
+0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x2879,0x5a3,0x5a3,0x5a3,
+0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x28a3,0x5a3,
+0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x28ba,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,
+0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,
+0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,
+0x5a3,0x5a3,0x28f9,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,
+0x290d,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,
+0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,
+0x5a3,0x5a3,0x293a,0x5a3,0x2475,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,
+0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,
+0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x296e,0x29a8,0x5a3,0x29e1,0x5a3,0x5a3,0x5a3,0x5a3,
+0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,
+0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x2a18,
+0x12d7,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,
+0x5a3,0x5a3,0x2a58,0x2a91,0x5a3,0x5a3,0x5a3,0x5a3,0x2ad1,0x2b11,0x2b51,0x2b71,0x2bb1,0x2be3,0x2c21,0x2c59,
+0x2c97,0x2cd7,0x2d17,0x2d53,0x2d93,0x2dcc,0x2e0c,0x2e4b,0x2e8b,0x2ecb,0x2f09,0x2f49,0x2f88,0x2fb8,0x2fe8,0x3028,
+0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,
+0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,
+0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,
+0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,
+0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,
+0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,
+0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,
+0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,
+0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,
+0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,
+0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x3068,0x30a1,
+0x30e1,0x30e1,0x30e1,0x30e1,0x30e1,0x30e1,0x30e1,0x30e1,0x30e1,0x30e1,0x30e1,0x30e1,0x30e1,0x30e1,0x30e1,0x30e1,
+0x30e1,0x30e1,0x30e1,0x30e1,0x30e1,0x30e1,0x30e1,0x30e1,0x30e1,0x30e1,0x30e1,0x30e1,0x30e1,0x30e1,0x30e1,0x30e1,
+0x3121,0x3121,0x3121,0x3121,0x3121,0x3121,0x3121,0x3121,0x3121,0x3121,0x3121,0x3121,0x3121,0x3121,0x3121,0x3121,
+0x3121,0x3121,0x3121,0x3121,0x3121,0x3121,0x3121,0x3121,0x3121,0x3121,0x3121,0x3121,0x3121,0x3121,0x3121,0x3121,
+0x3121,0x3121,0x3121,0x3121,0x3121,0x3121,0x3121,0x3121,0x3121,0x3121,0x3121,0x3121,0x3121,0x3121,0x3121,0x3121,
+0x3121,0x3121,0x3121,0x3121,0x3121,0x3121,0x3121,0x3121,0x3121,0x3121,0x3121,0x3121,0x3121,0x3121,0x3121,0x3121,
+0x3121,0x3121,0x3121,0x3121,0x3121,0x3121,0x3121,0x3121,0x3121,0x3121,0x3121,0x3121,0x3121,0x3121,0x3121,0x3121,
+0x3121,0x3121,0x3121,0x3121,0x3121,0x3121,0x3121,0x3121,0x3121,0x3121,0x3121,0x3121,0x3121,0x3121,0x3121,0x3121,
+0x3121,0x3121,0x3121,0x3121,0x5a3,0x3161,0x29e5,0x319a,0x5a3,0x31d8,0x5a3,0x3208,0x3248,0x3288,0x3296,0x32d4,
+0x5a3,0x5a3,0x5a3,0x5a3,0x32e7,0x32d7,0x3327,0x335f,0x339f,0x33db,0x5a3,0x3411,0x3451,0x3491,0x34c2,0x3501,
+0x800,0x840,0x880,0x8c0,0x900,0x938,0x96e,0x99e,0x9de,0xa1e,0x99e,0x99e,0xa5e,0xa9c,0x99e,0x99e,
+0x99e,0xadc,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0xb1c,0xb55,0x99e,0x99e,0x99e,0x99e,
+0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0xb95,0x99e,0x99e,0xbd5,
+0x99e,0x99e,0x99e,0x99e,0xc15,0xc55,0xc95,0x99e,0x99e,0x99e,0xcd5,0xcf5,0xd35,0xd75,0xdb5,0x99e,
+0xdf5,0xa5e,0xe23,0xa5e,0xa5e,0xa5e,0xa5e,0xa5e,0xe55,0xa5e,0xe8f,0xa5e,0xa5e,0xa5e,0xea9,0xa5e,
+0xa5e,0xa5e,0xa5e,0xa5e,0xa5e,0xa5e,0xa5e,0xa5e,0xedb,0xa5e,0xa5e,0xa5e,0xa5e,0xa5e,0xa5e,0xa5e,
+0xa5e,0xa5e,0xa5e,0xa5e,0xa5e,0xa5e,0xa5e,0xa5e,0xa5e,0xf02,0xa5e,0xa5e,0xa5e,0xf32,0xf71,0xa5e,
+0xa5e,0xa5e,0xa5e,0xf87,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0xfc7,0x99e,
+0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,
+0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,
+0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,
+0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,
+0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,
+0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,
+0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,
+0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,
+0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,
+0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,
+0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,
+0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,
+0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,
+0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,
+0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,
+0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,
+0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,
+0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,
+0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,
+0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,
+0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,
+0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,
+0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,
+0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,
+0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,
+0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,
+0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,
+0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,
+0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,
+0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,
+0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,
+0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,
+0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,
+0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,
+0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,
+0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,
+0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,
+0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,
+0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,
+0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,
+0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,
+0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,
+0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,
+0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,
+0x1007,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,
+0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,
+0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,
+0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,
+0x1047,0x1047,0x1047,0x1047,0x1047,0x1047,0x1047,0x1047,0x1047,0x1047,0x1047,0x1047,0x1047,0x1047,0x1047,0x1047,
+0x1047,0x1047,0x1047,0x1047,0x1047,0x1047,0x1047,0x1047,0x1047,0x1047,0x1047,0x1047,0x1047,0x1047,0x1047,0x1047,
+0x1047,0x1047,0x1047,0x1047,0x1047,0x1047,0x1047,0x1047,0x1047,0x1047,0x1047,0x1047,0x1047,0x1047,0x1047,0x1047,
+0x1047,0x1047,0x1047,0x1047,0x1047,0x1047,0x1047,0x1047,0x1047,0x1047,0x1047,0x1047,0x1047,0x1047,0x1047,0x1048,
+0x1047,0x1047,0x1047,0x1047,0x1047,0x1047,0x1047,0x1047,0x1047,0x1047,0x1047,0x1047,0x1047,0x1047,0x1047,0x1047,
+0x1047,0x1047,0x1047,0x1047,0x1047,0x1047,0x1047,0x1047,0x1047,0x1047,0x1047,0x1047,0x1047,0x1047,0x1047,0x1047,
+0x1047,0x1047,0x1047,0x1047,0x1047,0x1047,0x1047,0x1047,0x1047,0x1047,0x1047,0x1047,0x1047,0x1047,0x1047,0x1047,
+0x1047,0x1047,0x1047,0x1047,0x1047,0x1047,0x1047,0x1047,0x1047,0x1047,0x1047,0x1047,0x1047,0x1047,0x1047,0x1048,
+0x84b,0x502,0xac6,0x3541,0x50f,0x50f,0x73d,0x73d,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x512,
+0x3551,0x3561,0x3571,0x3581,0x3591,0x35a1,0x35b1,0x35c0,0x35c9,0x1c31,0x1c68,0x73d,0x73d,0x146d,0x146d,0x35d9,
+0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x502,0x510,0x502,0x502,0x502,0x772,0x35e9,0x35f9,
+0x502,0x502,0x3609,0x502,0x3619,0x502,0x502,0x3629,0x502,0x3639,0x502,0x502,0x1441,0x3648,0x73d,0x73d,
+0x40,0x40,0x341,0x60,0x60,0x502,0x502,0x502,0x502,0x50f,0xb09,0x73d,0x73d,0x73d,0x73d,0x73d,
+0x502,0x502,0x76b,0x502,0x502,0x502,0x3658,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,
+0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,
+0x502,0x502,0x502,0x76c,0x502,0x76d,0x76b,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,
+0x3668,0x502,0x502,0x3672,0x502,0x3681,0x502,0x3691,0x502,0x50e,0x36a1,0x73d,0x73d,0x73d,0x502,0x36b1,
+0x502,0x36c1,0x502,0x36d1,0x73d,0x73d,0x73d,0x73d,0x502,0x502,0x502,0x36e1,0x3558,0x36f1,0x3701,0x3711,
+0x3721,0x934,0x502,0x3731,0x3741,0x3751,0x502,0x3761,0x502,0x3771,0x73d,0x73d,0x3781,0x502,0x378c,0x379c,
+0x502,0x502,0x502,0x37ac,0x502,0x37bc,0x502,0x37cc,0x502,0x37dc,0x37e9,0x73d,0x73d,0x73d,0x73d,0x73d,
+0x502,0x502,0x502,0x502,0x76a,0x73d,0x73d,0x73d,0x40,0x40,0x40,0x37f9,0x60,0x60,0x60,0x3809,
+0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,
+0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x1084,0x3819,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,
+0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,
+0x2f06,0x502,0x502,0x575,0x3829,0x3837,0x3847,0x787,0x7b1,0x502,0x502,0x3857,0xcfa,0x502,0x76a,0xb09,
+0x3867,0x502,0x3870,0x387d,0x388d,0x502,0x502,0x389d,0x7b1,0x502,0x502,0x38ad,0x38bc,0x38cc,0x3557,0x38dc,
+0x502,0x93a,0x38ec,0x38fb,0x73d,0x73d,0x73d,0x73d,0x390b,0x849,0x391a,0x502,0x502,0x630,0x392a,0xb09,
+0x393a,0x83e,0x84e,0x95a,0x394a,0x395a,0x3968,0x1a2d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,
+0x502,0x502,0x502,0x3978,0x3987,0xb09,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,
+0x502,0x502,0xeb9,0x3997,0x39a6,0x39ae,0x73d,0x73d,0x502,0x502,0x502,0x39be,0x39cd,0xb09,0x73d,0x73d,
+0x502,0x502,0x39dd,0x39ed,0xb09,0x73d,0x73d,0x73d,0x502,0x2dff,0x39fd,0x3a0d,0x73d,0x73d,0x73d,0x73d,
+0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x40,0x40,0x60,0x60,0x3a1d,0x3a2d,0x73d,0x73d,
+0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,
+0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x502,0x502,0x502,0x76a,0x73d,0x73d,
+0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,
+0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,
+0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,
+0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x502,0x502,
+0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,
+0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,
+0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,
+0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x769,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x3a3d,0x3a4d,
+0x3a5d,0x3a6d,0x3a7d,0x3a8d,0x3a9d,0x3aad,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,
+0x502,0x502,0x76f,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,
+0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,
+0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x502,0x502,
+0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,
+0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,
+0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,
+0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x50e,0x73d,
+0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,
+0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,
+0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,
+0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x502,0x502,0x502,0x502,
+0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,
+0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,
+0x76c,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,
+0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x502,0x502,0x502,0x502,
+0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,
+0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x76a,
+0x502,0x50e,0x2e5b,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x502,0x50f,0x3abd,0x502,0x502,0x502,0x3acd,
+0x3add,0x3aed,0x3afd,0x515,0x502,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,
+0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,
+0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,
+0x73d,0x73d,0x73d,0x73d,0x73d,0x502,0x502,0x502,0x502,0x76e,0x3b0c,0x3b0d,0x3b0e,0x787,0x3b1e,0x73d,
+0x73d,0x73d,0x73d,0x73d,0x73d,0x771,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,
+0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,
+0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,
+0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,
+0x73d,0x73d,0x73d,0x73d,0x73d,0x502,0x502,0x502,0x502,0x502,0x502,0x512,0x510,0x76a,0x3b2e,0x3b3e,
+0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,
+0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,
+0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,
+0x73d,0x73d,0x73d,0x73d,0x73d,0x146d,0x146d,0x146d,0x146d,0x146d,0x146d,0x146d,0x146d,0x146d,0x146d,0x146d,
+0x146d,0x146d,0x146d,0x146d,0x1c63,0x146d,0x146d,0x1f0c,0x146d,0x146d,0x146d,0x3b4e,0x3b5b,0x3b68,0x146d,0x3b74,
+0x146d,0x146d,0x146d,0x1c60,0x73d,0x146d,0x146d,0x146d,0x146d,0x3b82,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,
+0x73d,0x73d,0x73d,0x73d,0x73d,0x146d,0x146d,0x146d,0x146d,0x146d,0x1c62,0x3558,0x3b92,0x73d,0x73d,0x73d,
+0x73d,0x73d,0x73d,0x73d,0x73d,0x40,0x3b1,0x60,0x3ba2,0x3ad,0x3bb2,0x1844,0x40,0xdb,0x3bb8,0x3bc8,
+0x3bd6,0x3bb3,0x40,0x3b1,0x60,0x3be3,0x3bf0,0x60,0x3bfe,0x3c0e,0x1fa8,0x3c1e,0x40,0xd7,0x60,0x40,
+0x3b1,0x60,0x3ba2,0x3ad,0x60,0x1844,0x40,0xdb,0x3c1e,0x40,0xd7,0x60,0x40,0x3b1,0x60,0x3c2e,
+0x40,0x3c3d,0xea,0x389,0x3c4d,0x60,0x3c59,0x40,0x3c39,0xe6,0x3c47,0xc6,0x60,0xec,0x40,0x3c65,
+0x60,0x3c72,0x3c82,0x3c88,0x3c84,0x146d,0x146d,0x146d,0x146d,0x146d,0x146d,0x146d,0x146d,0x146d,0x146d,0x146d,
+0x146d,0x146d,0x146d,0x146d,0x146d,0x146d,0x146d,0x146d,0x146d,0x146d,0x146d,0x146d,0x146d,0x146d,0x146d,0x146d,
+0x146d,0x146d,0x146d,0x146d,0x146d,0x2cd,0x2cd,0x2cd,0x3c98,0x2cd,0x2cd,0x3ca3,0x3cb0,0x3cbc,0x78b,0x4c2,
+0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,
+0x73d,0x73d,0x73d,0x73d,0x73d,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,
+0x502,0x3ccc,0x1a2b,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,
+0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,
+0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,
+0x73d,0x73d,0x73d,0x73d,0x73d,0xac9,0x502,0x3cdc,0x3ce9,0x3cf7,0x3d07,0x3d15,0x3d1d,0x84d,0x511,0x3d2c,
+0x511,0x73d,0x73d,0x73d,0x3d3c,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,
+0x73d,0x73d,0x73d,0x73d,0x73d,0x146d,0x146d,0x1c31,0x146d,0x146d,0x146d,0x146d,0x146d,0x146d,0x1c65,0x1c2e,
+0x146c,0x146c,0x146c,0x146d,0x1c63,0x3d4c,0x146d,0x1c2e,0x146d,0x146d,0x146d,0x1c31,0x146d,0x146d,0x1c32,0x73d,
+0x73d,0x73d,0x73d,0x1c7c,0x146d,0x1c66,0x146d,0x146d,0x1c32,0x1c60,0x1c67,0x73d,0x73d,0x73d,0x73d,0x73d,
+0x73d,0x73d,0x73d,0x73d,0x73d,0x146d,0x146d,0x146d,0x146d,0x146d,0x146d,0x146d,0x146d,0x146d,0x146d,0x146d,
+0x146d,0x146d,0x146d,0x146d,0x3d5c,0x146d,0x146d,0x146d,0x146d,0x146d,0x146d,0x146d,0x146d,0x146d,0x146d,0x146d,
+0x146d,0x146d,0x146d,0x146d,0x146d,0x146d,0x146d,0x146d,0x146d,0x146d,0x146d,0x146d,0x2189,0x146d,0x146d,0x218f,
+0x146d,0x146d,0x146d,0x146d,0x146d,0x146d,0x146d,0x146d,0x146d,0x146d,0x146d,0x146d,0x146d,0x146d,0x146d,0x146d,
+0x146d,0x146d,0x1c68,0x1c30,0x1c65,0x146d,0x146d,0x146d,0x146d,0x146d,0x146d,0x146d,0x1c65,0x146d,0x146d,0x146d,
+0x146d,0x146d,0x1c64,0x73d,0x73d,0x1c31,0x146d,0x146d,0x146d,0x1c61,0x10ab,0x146d,0x146d,0x1c61,0x146d,0x1c2f,
+0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x1c60,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x1c64,0x73d,0x73d,
+0x73d,0x1c68,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,
+0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,
+0x73d,0x73d,0x73d,0x73d,0x73d,0x24f7,0x502,0x502,0x502,0x502,0x502,0x2735,0x502,0x502,0x502,0x502,
+0x502,0x502,0x502,0x2737,0x502,0x502,0x502,0x2469,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,
+0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,
+0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,
+0x502,0x502,0x502,0x502,0x502,0x2761,0x502,0x502,0x502,0x502,0x502,0x3d6c,0x3d79,0x502,0x502,0x502,
+0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,
+0x502,0x29a4,0x317f,0x502,0x3183,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,
+0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,
+0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,
+0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x24a5,0x502,
+0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,
+0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x25e2,0x502,0x502,0x502,0x502,0x502,0x502,0x502,
+0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,
+0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,
+0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x3181,0x502,0x502,0x502,0x502,0x502,
+0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,
+0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,
+0x502,0x272c,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,
+0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,
+0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x76c,
+0x73d,0x73d,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,
+0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,
+0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,
+0x502,0x502,0x502,0x502,0x502,0x76e,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,
+0x502,0x502,0x50f,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,
+0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,
+0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,
+0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,
+0x502,0x771,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,
+0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,
+0x256b,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,
+0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x502,0x50f,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,
+0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,
+0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x3d89,0x73d,0x3d99,0x3d99,0x3d99,0x3d99,0x3d99,0x3d99,0x73d,
+0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x2cd,0x2cd,0x2cd,0x2cd,0x2cd,0x2cd,0x2cd,0x2cd,0x2cd,
+0x2cd,0x2cd,0x2cd,0x2cd,0x2cd,0x2cd,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,
+0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,
+0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x73d,0x3121,0x3121,0x3121,0x3121,0x3121,0x3121,0x3121,0x3121,0x3121,
+0x3121,0x3121,0x3121,0x3121,0x3121,0x3121,0x3121,0x3121,0x3121,0x3121,0x3121,0x3121,0x3121,0x3121,0x3121,0x3121,
+0x3121,0x3121,0x3121,0x3121,0x3121,0x3121,0x3121,0x3121,0x3121,0x3121,0x3121,0x3121,0x3121,0x3121,0x3121,0x3121,
+0x3121,0x3121,0x3121,0x3121,0x3121,0x3121,0x3121,0x3121,0x3121,0x3121,0x3121,0x3121,0x3121,0x3121,0x3121,0x3121,
+0x3121,0x3121,0x3121,0x3121,0x3121,0x3121,0x3121,0x3da9
+};
+
+static const uint16_t propsTrie_data16[15803]={
 0xf,0xf,0xf,0xf,0xf,0xf,0xf,0xf,0xf,0xf,0xf,0xf,0xf,0xf,0xf,0xf,
-0xf,0xf,0xf,0xf,0xf,0xf,0xf,0xf,0xc,0x17,0x17,0x17,0x19,0x17,0x17,0x17,
-0x14,0x15,0x17,0x18,0x17,0x13,0x17,0x17,0x49,0x89,0xc9,0x109,0x149,0x189,0x1c9,0x209,
-0x249,0x289,0x17,0x17,0x18,0x18,0x18,0x17,0x17,1,1,1,1,1,1,1,
+0xf,0xf,0xf,0xf,0xf,0xf,0xf,0xf,0xf,0xf,0xf,0xf,0xf,0xf,0xf,0xf,
+0xc,0x17,0x17,0x17,0x19,0x17,0x17,0x17,0x14,0x15,0x17,0x18,0x17,0x13,0x17,0x17,
+0x49,0x89,0xc9,0x109,0x149,0x189,0x1c9,0x209,0x249,0x289,0x17,0x17,0x18,0x18,0x18,0x17,
 1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
-1,1,1,0x14,0x17,0x15,0x1a,0x16,0x1a,2,2,2,2,2,2,2,
+1,1,1,1,1,1,1,1,1,1,0x14,0x17,0x15,0x1a,0x16,0x1a,
 2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
-2,2,2,0x14,0x18,0x15,0x18,0xf,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0xf,0xf,0xf,0xf,0xf,0xf,0xf,0xf,
+2,2,2,2,2,2,2,2,2,2,0x14,0x18,0x15,0x18,0xf,0xf,
 0xf,0xf,0xf,0xf,0xf,0xf,0xf,0xf,0xf,0xf,0xf,0xf,0xf,0xf,0xf,0xf,
-0xf,0xf,0xf,0xf,0xf,0xf,0xf,0xf,0xc,0x17,0x19,0x19,0x19,0x19,0x1b,0x17,
-0x1a,0x1b,5,0x1c,0x18,0x10,0x1b,0x1a,0x1b,0x18,0x34b,0x38b,0x1a,2,0x17,0x17,
-0x1a,0x30b,5,0x1d,0x34cb,0x344b,0x3ccb,0x17,1,1,1,1,1,1,1,1,
-1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,0x18,
-1,1,1,1,1,1,1,2,2,2,2,2,2,2,2,2,
-2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,0x18,
-2,2,2,2,2,2,2,2,1,2,1,2,1,2,1,2,
+0xf,0xf,0xf,0xf,0xf,0xf,0xf,0xf,0xf,0xf,0xf,0xf,0xf,0xf,0xc,0x17,
+0x19,0x19,0x19,0x19,0x1b,0x17,0x1a,0x1b,5,0x1c,0x18,0x10,0x1b,0x1a,0x1b,0x18,
+0x34b,0x38b,0x1a,2,0x17,0x17,0x1a,0x30b,5,0x1d,0x34cb,0x344b,0x3ccb,0x17,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,0x18,1,1,1,1,1,1,1,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,0x18,2,2,2,2,2,2,2,2,1,2,
 1,2,1,2,1,2,1,2,1,2,1,2,1,2,1,2,
 1,2,1,2,1,2,1,2,1,2,1,2,1,2,1,2,
 1,2,1,2,1,2,1,2,1,2,1,2,1,2,1,2,
+1,2,1,2,1,2,2,1,2,1,2,1,2,1,2,1,
+2,1,2,1,2,1,2,1,2,1,2,1,2,1,2,1,
+2,1,2,1,2,1,2,1,2,1,2,1,2,1,2,1,
+2,1,2,1,2,1,1,2,1,2,1,2,2,1,1,2,
+1,2,1,1,2,1,1,1,2,2,1,1,1,1,2,1,
+1,2,1,1,1,2,2,2,1,1,2,1,1,2,1,2,
+1,2,1,1,2,1,2,2,1,2,1,1,2,1,1,1,
+2,1,2,1,1,2,2,5,1,2,2,2,5,5,5,5,
+1,3,2,1,3,2,1,3,2,1,2,1,2,1,2,1,
 2,1,2,1,2,1,2,1,2,2,1,2,1,2,1,2,
+1,2,1,2,1,2,1,2,1,2,1,2,2,1,3,2,
+1,2,1,1,1,2,1,2,1,2,1,2,1,2,1,2,
 1,2,1,2,1,2,1,2,1,2,1,2,1,2,1,2,
 1,2,1,2,1,2,1,2,1,2,1,2,1,2,1,2,
-1,2,1,2,1,2,1,2,1,1,2,1,2,1,2,2,
-2,1,1,2,1,2,1,1,2,1,1,1,2,2,1,1,
-1,1,2,1,1,2,1,1,1,2,2,2,1,1,2,1,
-1,2,1,2,1,2,1,1,2,1,2,2,1,2,1,1,
-2,1,1,1,2,1,2,1,1,2,2,5,1,2,2,2,
-5,5,5,5,1,3,2,1,3,2,1,3,2,1,2,1,
-2,1,2,1,2,1,2,1,2,1,2,1,2,2,1,2,
-1,2,1,2,1,2,1,2,1,2,1,2,1,2,1,2,
-2,1,3,2,1,2,1,1,1,2,1,2,1,2,1,2,
-1,2,1,2,1,2,1,2,1,2,1,2,1,2,1,2,
-1,2,1,2,1,2,1,2,1,2,1,2,1,2,1,2,
-1,2,1,2,1,2,1,2,1,2,1,2,2,2,2,2,
-2,2,1,1,2,1,1,2,2,1,2,1,1,1,1,2,
-1,2,1,2,1,2,1,2,2,2,2,2,2,2,2,2,
-2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+1,2,1,2,1,2,1,2,2,2,2,2,2,2,1,1,
+2,1,1,2,1,2,1,1,1,1,2,1,2,1,2,1,
+2,1,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
 2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
-2,2,2,2,2,2,2,2,5,2,2,2,2,2,2,2,
 2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
-2,2,2,2,4,4,4,4,4,4,4,4,4,4,4,4,
-4,4,4,4,4,4,0x1a,0x1a,0x1a,0x1a,4,4,4,4,4,4,
-4,4,4,4,4,4,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,
-0x1a,0x1a,0x1a,0x1a,4,4,4,4,4,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,
-4,0x1a,4,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,
-0x1a,0x1a,0x1a,0x1a,6,6,6,6,6,6,6,6,6,6,6,6,
+2,2,2,5,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,4,
+4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,0x1a,
+0x1a,0x1a,0x1a,4,4,4,4,4,4,4,4,4,4,4,4,0x1a,
+0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,4,4,4,
+4,4,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,4,0x1a,4,0x1a,0x1a,0x1a,0x1a,
+0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,6,6,6,
 6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
 6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
 6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
-6,6,6,6,1,2,1,2,4,0x1a,1,2,0,0,4,2,
-2,2,0x17,1,0,0,0,0,0x1a,0x1a,1,0x17,1,1,1,0,
-1,0,1,1,2,1,1,1,1,1,1,1,1,1,1,1,
-1,1,1,1,1,1,0,1,1,1,1,1,1,1,1,1,
-2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
-2,2,2,2,2,2,2,1,2,2,1,1,1,2,2,2,
-1,2,1,2,1,2,1,2,1,2,1,2,1,2,1,2,
-1,2,1,2,1,2,1,2,2,2,2,2,1,2,0x18,1,
-2,1,1,2,2,1,1,1,1,1,1,1,1,1,1,1,
+6,6,6,6,6,6,6,6,6,6,6,6,6,1,2,1,
+2,4,0x1a,1,2,0,0,4,2,2,2,0x17,1,0,0,0,
+0,0x1a,0x1a,1,0x17,1,1,1,0,1,0,1,1,2,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,0,
+1,1,1,1,1,1,1,1,1,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,1,2,2,
+1,1,1,2,2,2,1,2,1,2,1,2,1,2,1,2,
+1,2,1,2,1,2,1,2,1,2,1,2,1,2,2,2,
+2,2,1,2,0x18,1,2,1,1,2,2,1,1,1,1,1,
 1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
 1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
-1,1,1,1,1,1,1,1,2,2,2,2,2,2,2,2,
+1,1,1,1,1,1,1,1,1,1,1,2,2,2,2,2,
 2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
-2,2,2,2,2,2,2,2,1,2,1,2,1,2,1,2,
-1,2,1,2,1,2,1,2,1,2,1,2,1,2,1,2,
-1,2,1,2,1,2,1,2,1,2,0x1b,6,6,6,6,6,
-7,7,1,2,1,2,1,2,1,2,1,2,1,2,1,2,
-1,2,1,2,1,2,1,2,1,2,1,2,1,2,1,2,
-1,2,1,2,1,2,1,2,1,2,1,2,1,2,1,2,
-1,2,1,2,1,2,1,2,1,1,2,1,2,1,2,1,
-2,1,2,1,2,1,2,2,1,2,1,2,1,2,1,2,
-1,2,1,2,1,2,1,2,1,2,1,2,1,2,1,2,
-1,2,1,2,1,2,1,2,1,2,1,2,1,2,1,2,
-1,2,1,2,1,2,1,2,0,1,1,1,1,1,1,1,
+2,2,2,2,2,2,2,2,2,2,2,1,2,1,2,1,
+2,1,2,1,2,1,2,1,2,1,2,1,2,1,2,1,
+2,1,2,1,2,1,2,1,2,1,2,0x1b,6,6,6,6,
+6,7,7,1,2,1,2,1,2,1,2,1,2,1,2,1,
+2,1,2,1,2,1,2,1,2,1,2,1,2,1,2,1,
+2,1,2,1,2,1,2,1,2,1,2,1,2,1,2,1,
+2,1,2,1,2,1,2,1,2,1,1,2,1,2,1,2,
+1,2,1,2,1,2,1,2,2,1,2,1,2,1,2,1,
+2,1,2,1,2,1,2,1,2,1,2,1,2,1,2,1,
+2,1,2,1,2,1,2,1,2,1,2,1,2,1,2,1,
+2,1,2,1,2,1,2,1,2,0,1,1,1,1,1,1,
 1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
-1,1,1,0,0,4,0x17,0x17,0x17,0x17,0x17,0x17,0,2,2,2,
+1,0,0,4,0x17,0x17,0x17,0x17,0x17,0x17,0,2,2,2,2,2,
 2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
-2,2,2,2,2,2,2,2,2,2,2,2,0,0x17,0x13,0,
-0,0x1b,0x1b,0x19,0,6,6,6,6,6,6,6,6,6,6,6,
+2,2,2,2,2,2,2,2,2,2,0,0x17,0x13,0,0,0x1b,
+0x1b,0x19,0,6,6,6,6,6,6,6,6,6,6,6,6,6,
 6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
 6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
-6,6,0x13,6,0x17,6,6,0x17,6,6,0x17,6,0,0,0,0,
-0,0,0,0,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,0,
-0,0,0,0,5,5,5,0x17,0x17,0,0,0,0,0,0,0,
-0,0,0,0,0x10,0x10,0x10,0x10,0x10,0x10,0x18,0x18,0x18,0x17,0x17,0x19,
-0x17,0x17,0x1b,0x1b,6,6,6,6,6,6,6,6,6,6,6,0x17,
-0x10,0,0x17,0x17,5,5,5,5,5,5,5,5,5,5,5,5,
+0x13,6,0x17,6,6,0x17,6,6,0x17,6,0,0,0,0,0,0,
+0,0,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,0,0,0,
+0,0,5,5,5,0x17,0x17,0,0,0,0,0,0,0,0,0,
+0,0,0x10,0x10,0x10,0x10,0x10,0x10,0x18,0x18,0x18,0x17,0x17,0x19,0x17,0x17,
+0x1b,0x1b,6,6,6,6,6,6,6,6,6,6,6,0x17,0x10,0,
+0x17,0x17,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
 5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,4,5,5,5,5,5,5,5,5,5,5,6,
+5,5,4,5,5,5,5,5,5,5,5,5,5,6,6,6,
 6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
-6,6,6,6,0x49,0x89,0xc9,0x109,0x149,0x189,0x1c9,0x209,0x249,0x289,0x17,0x17,
-0x17,0x17,5,5,6,5,5,5,5,5,5,5,5,5,5,5,
+6,6,0x49,0x89,0xc9,0x109,0x149,0x189,0x1c9,0x209,0x249,0x289,0x17,0x17,0x17,0x17,
+5,5,6,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
 5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
 5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,0x17,5,6,6,6,6,6,6,6,0x10,0x1b,6,6,
+6,6,6,6,4,4,6,6,0x1b,6,6,6,6,5,5,0x49,
+0x89,0xc9,0x109,0x149,0x189,0x1c9,0x209,0x249,0x289,5,5,5,0x1b,0x1b,5,0x17,
+0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0,0x10,5,
+6,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,6,
+6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,0,
+0,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
 5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,0x17,5,6,6,6,6,6,6,
-6,0x10,0x1b,6,6,6,6,6,6,4,4,6,6,0x1b,6,6,
-6,6,5,5,0x49,0x89,0xc9,0x109,0x149,0x189,0x1c9,0x209,0x249,0x289,5,5,
-5,0x1b,0x1b,5,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,
-0x17,0x17,0,0x10,5,6,5,5,5,5,5,5,5,5,5,5,
 5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,6,6,6,6,6,6,6,6,6,6,6,6,
-6,6,6,6,6,6,6,0,0,5,5,5,5,5,5,5,
+5,5,5,5,6,6,6,6,6,6,6,6,6,6,6,5,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0x49,0x89,
+0xc9,0x109,0x149,0x189,0x1c9,0x209,0x249,0x289,5,5,5,5,5,5,5,5,
 5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,6,6,6,6,6,6,6,
+6,6,4,4,0x1b,0x17,0x17,0x17,4,0,0,0,0,0,5,5,
 5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,6,6,
-6,6,6,6,6,6,6,6,6,5,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0x49,0x89,0xc9,0x109,0x149,0x189,0x1c9,0x209,
-0x249,0x289,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,6,6,6,6,4,6,6,6,6,6,6,6,
+6,6,4,6,6,6,4,6,6,6,6,6,0,0,0x17,0x17,
+0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0,5,5,
 5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,6,6,6,6,6,6,6,6,6,4,4,0x1b,0x17,
-0x17,0x17,4,0,0,0,0,0,6,6,6,6,4,6,6,6,
-4,6,6,6,6,6,0,0,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,
-0x17,0x17,0x17,0x17,0x17,0x17,0x17,0,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,6,6,
-6,6,4,6,6,6,6,6,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,6,6,6,0,0,0x17,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,5,5,
 5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,6,6,6,0,0,0x17,0,0,0,0,6,6,6,6,6,
+5,5,5,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,6,6,6,6,6,6,6,6,6,6,
 6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
-6,6,6,6,6,6,6,6,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,0,0,0,
-0,0,0,0,0,0,0,0,5,5,6,6,0x17,0x17,0x49,0x89,
-0xc9,0x109,0x149,0x189,0x1c9,0x209,0x249,0x289,0x17,4,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,6,6,6,8,5,5,5,5,
+6,6,6,8,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
 5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
 5,5,5,5,5,5,5,5,5,5,6,8,6,5,8,8,
-8,6,6,6,6,6,6,6,6,8,8,8,8,6,8,8,
-5,6,6,6,6,6,6,6,5,5,5,5,5,5,5,5,
-5,5,6,6,0,0,0x49,0x89,0xc9,0x109,0x149,0x189,0x1c9,0x209,0x249,0x289,
-5,5,0x19,0x19,0x37cb,0x35cb,0x3fcb,0x34cb,0x3ccb,0x94b,0x1b,0x19,0,0,0,0,
-5,6,8,8,0,5,5,5,5,5,5,5,5,0,0,5,
-5,0,0,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,0,5,5,5,5,5,5,5,0,5,0,0,0,5,5,
-5,5,0,0,6,5,8,8,8,6,6,6,6,0,0,8,
-8,0,0,8,8,6,5,0,0,0,0,0,0,0,0,8,
-0,0,0,0,5,5,0,5,0,0,0,0,0,0,0x49,0x89,
-0xc9,0x109,0x149,0x189,0x1c9,0x209,0x249,0x289,6,6,5,5,5,6,0,0,
-0,0,0,0,0,0,0,0,0,6,6,8,0,5,5,5,
-5,5,5,0,0,0,0,5,5,0,0,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,0,5,5,5,5,5,5,
-5,0,5,5,0,5,5,0,5,5,0,0,6,0,8,8,
-8,6,6,0,0,0,0,6,6,0,0,6,6,6,0,0,
-0,6,0,0,0,0,0,0,0,5,5,5,5,0,5,0,
-5,5,6,6,0,0,0x49,0x89,0xc9,0x109,0x149,0x189,0x1c9,0x209,0x249,0x289,
-0x17,0x19,0,0,0,0,0,0,0,5,0,0,0,0,0,0,
-0,6,6,8,0,5,5,5,5,5,5,5,5,5,0,5,
-5,5,0,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,0,5,5,5,5,5,5,5,0,5,5,0,5,5,5,
-5,5,0,0,6,5,8,8,8,6,6,6,6,6,0,6,
-6,8,0,8,8,6,0,0,5,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,5,5,6,6,0,0,0x49,0x89,
-0xc9,0x109,0x149,0x189,0x1c9,0x209,0x249,0x289,0x1b,5,0x34cb,0x344b,0x3ccb,0x37cb,0x35cb,0x3fcb,
-0,0,0,0,0,0,0,0,0,6,8,8,0,5,5,5,
-5,5,5,5,5,0,0,5,5,0,0,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,0,5,5,5,5,5,5,
-5,0,5,5,0,5,5,5,5,5,0,0,6,5,8,6,
-8,6,6,6,6,0,0,8,8,0,0,8,8,6,0,0,
-0,0,0,0,0,0,6,8,0,0,0,0,5,5,0,5,
-0,0,0,0,0,0,0x49,0x89,0xc9,0x109,0x149,0x189,0x1c9,0x209,0x249,0x289,
-0x7cb,0x1e4b,0x784b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x19,0x1b,0,0,0,0,0,
-0,0,6,5,0,5,5,5,5,5,5,0,0,0,5,5,
-5,0,5,5,5,5,0,0,0,5,5,0,5,0,5,5,
-0,0,0,5,5,0,0,0,5,5,5,0,0,0,5,5,
-5,5,5,5,5,5,5,5,5,5,0,0,0,0,8,8,
-6,8,8,0,0,0,8,8,8,0,8,8,8,6,0,0,
-5,0,0,0,0,0,0,8,0,0,0,0,0,0,0,0,
-5,5,6,6,0,0,0x49,0x89,0xc9,0x109,0x149,0x189,0x1c9,0x209,0x249,0x289,
-0,0,0,0,0,0,0,0,0x54b,0x58b,0x5cb,0x60b,0x58b,0x5cb,0x60b,0x1b,
-6,8,8,8,0,5,5,5,5,5,5,5,5,0,5,5,
-5,0,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,0,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,0,0,0,5,6,6,6,8,8,8,8,0,6,6,
-6,0,6,6,6,6,0,0,0,0,0,0,0,6,6,0,
-5,5,5,0,0,0,0,0,5,5,6,6,0,0,0x49,0x89,
-0xc9,0x109,0x149,0x189,0x1c9,0x209,0x249,0x289,0,5,5,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,6,8,8,0,5,5,5,
-5,5,5,5,5,0,5,5,5,0,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,0,5,5,5,5,5,5,
-5,5,5,5,0,5,5,5,5,5,0,0,6,5,8,6,
-8,8,8,8,8,0,6,8,8,0,8,8,6,6,0,0,
-0,0,0,0,0,8,8,0,0,0,0,0,0,0,5,0,
-5,5,6,6,0,0,0x49,0x89,0xc9,0x109,0x149,0x189,0x1c9,0x209,0x249,0x289,
-0x7cb,0x1e4b,0x784b,0x34cb,0x344b,0x3ccb,0,0,0,0x1b,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,0,0,5,8,8,8,6,6,6,
-6,0,8,8,8,0,8,8,8,6,5,0,0,0,0,0,
-0,0,0,8,0,0,0,0,0,0,0,5,0,0,0,0,
-0,0,0x49,0x89,0xc9,0x109,0x149,0x189,0x1c9,0x209,0x249,0x289,0,0,8,8,
-0x17,0,0,0,0,0,0,0,0,0,0,0,0,0,8,8,
+6,6,6,6,6,6,6,6,8,8,8,8,6,8,8,5,
+6,6,6,6,6,6,6,5,5,5,5,5,5,5,5,5,
+5,6,6,0x17,0x17,0x49,0x89,0xc9,0x109,0x149,0x189,0x1c9,0x209,0x249,0x289,0x17,
+4,5,5,5,5,5,5,5,5,5,5,5,5,5,5,6,
+8,8,0,5,5,5,5,5,5,5,5,0,0,5,5,0,
 0,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,0,0,0,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,0,5,5,5,5,5,
-5,5,5,5,0,5,0,0,5,5,5,5,5,5,5,0,
-0,0,6,0,0,0,0,8,8,8,6,6,6,0,6,0,
-8,8,8,8,8,8,8,8,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,6,5,5,6,6,6,6,
-6,6,6,0,0,0,0,0x19,5,5,5,5,5,5,4,6,
-6,6,6,6,6,6,6,0x17,0x49,0x89,0xc9,0x109,0x149,0x189,0x1c9,0x209,
-0x249,0x289,0x17,0x17,0,0,0,0,0,5,5,0,5,0,0,5,
-5,0,5,0,0,5,0,0,0,0,0,0,5,5,5,5,
-0,5,5,5,5,5,5,5,0,5,5,5,0,5,0,5,
-0,0,5,5,0,5,5,5,5,6,5,5,6,6,6,6,
-6,6,0,6,6,5,0,0,5,5,5,5,5,0,4,0,
-6,6,6,6,6,6,0,0,0x49,0x89,0xc9,0x109,0x149,0x189,0x1c9,0x209,
-0x249,0x289,0,0,5,5,5,5,5,0x1b,0x1b,0x1b,0x17,0x17,0x17,0x17,
-0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x1b,0x17,0x1b,0x1b,0x1b,
-6,6,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x49,0x89,0xc9,0x109,0x149,0x189,0x1c9,0x209,
-0x249,0x289,0x344b,0x3c4b,0x444b,0x4c4b,0x544b,0x5c4b,0x644b,0x6c4b,0x744b,0x2c4b,0x1b,6,0x1b,6,
-0x1b,6,0x14,0x15,0x14,0x15,8,8,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,0,5,5,5,5,5,5,5,0,
+5,0,0,0,5,5,5,5,0,0,6,5,8,8,6,6,
+6,6,0,0,8,8,0,0,8,8,6,5,0,0,0,0,
+0,0,0,0,8,0,0,0,0,5,5,0,5,5,5,6,
+6,0,0,0x49,0x89,0xc9,0x109,0x149,0x189,0x1c9,0x209,0x249,0x289,5,5,0x19,
+0x19,0x37cb,0x35cb,0x3fcb,0x34cb,0x3ccb,0x94b,0x1b,0x19,0,0,0,0,6,6,8,
+0,5,5,5,5,5,5,0,0,0,0,5,5,0,0,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,0,5,5,5,5,5,5,5,0,5,5,
+0,5,5,0,5,5,0,0,6,0,8,8,6,6,0,0,
+0,0,6,6,0,0,6,6,6,0,0,0,6,0,0,0,
+0,0,0,0,5,5,5,5,0,5,0,0,0,0,0,0,
+0,0x49,0x89,0xc9,0x109,0x149,0x189,0x1c9,0x209,0x249,0x289,6,6,5,5,5,
+6,0,0,0,0,0,0,0,0,0,0,6,6,8,0,5,
+5,5,5,5,5,5,5,5,0,5,5,5,0,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,0,5,5,5,5,5,5,5,0,5,5,0,5,
+5,5,5,5,0,0,6,5,8,8,6,6,6,6,6,0,
+6,6,8,0,8,8,6,0,0,5,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,5,5,6,6,0,0,0x49,
+0x89,0xc9,0x109,0x149,0x189,0x1c9,0x209,0x249,0x289,0x17,0x19,0,0,0,0,0,
+0,0,5,0,0,0,0,0,0,6,8,8,0,5,5,5,
+5,5,5,5,5,0,0,5,5,0,0,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,0,5,5,5,5,5,5,5,0,5,5,0,5,5,5,
+5,5,0,0,6,5,8,6,6,6,6,0,0,8,8,0,
+0,8,8,6,0,0,0,0,0,0,0,0,6,8,0,0,
+0,0,5,5,0,5,5,5,6,6,0,0,0x49,0x89,0xc9,0x109,
+0x149,0x189,0x1c9,0x209,0x249,0x289,0x1b,5,0x34cb,0x344b,0x3ccb,0x37cb,0x35cb,0x3fcb,0,0,
+0,0,0,0,0,0,6,5,0,5,5,5,5,5,5,0,
+0,0,5,5,5,0,5,5,5,5,0,0,0,5,5,0,
+5,0,5,5,0,0,0,5,5,0,0,0,5,5,5,0,
+0,0,5,5,5,5,5,5,5,5,5,5,5,5,0,0,
+0,0,8,8,6,8,8,0,0,0,8,8,8,0,8,8,
+8,6,0,0,5,0,0,0,0,0,0,8,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0x49,0x89,0xc9,0x109,0x149,0x189,
+0x1c9,0x209,0x249,0x289,0x7cb,0x1e4b,0x784b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x19,0x1b,0,
+0,0,0,0,6,8,8,8,0,5,5,5,5,5,5,5,
+5,0,5,5,5,0,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,0,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,0,0,
+0,5,6,6,8,8,8,8,0,6,6,6,0,6,6,6,
+6,0,0,0,0,0,0,0,6,6,0,5,5,5,0,0,
+0,0,0,5,5,6,6,0,0,0x49,0x89,0xc9,0x109,0x149,0x189,0x1c9,
+0x209,0x249,0x289,0,0,0,0,0,0,0,0,0x54b,0x58b,0x5cb,0x60b,0x58b,
+0x5cb,0x60b,0x1b,0,6,8,8,0,5,5,5,5,5,5,5,5,
+0,5,5,5,0,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,0,5,5,5,
+5,5,5,5,5,5,5,0,5,5,5,5,5,0,0,6,
+5,8,6,8,8,8,8,8,0,6,8,8,0,8,8,6,
+6,0,0,0,0,0,0,0,8,8,0,0,0,0,0,0,
+0,5,0,5,5,6,6,0,0,0x49,0x89,0xc9,0x109,0x149,0x189,0x1c9,
+0x209,0x249,0x289,0,5,5,0,0,0,0,0,0,0,0,0,0,
+0,0,0,6,8,8,0,5,5,5,5,5,5,5,5,0,
+5,5,5,0,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,0,0,5,
+8,8,6,6,6,6,0,8,8,8,0,8,8,8,6,5,
+0,0,0,0,0,0,0,0,8,0,0,0,0,0,0,0,
+5,5,5,6,6,0,0,0x49,0x89,0xc9,0x109,0x149,0x189,0x1c9,0x209,0x249,
+0x289,0x7cb,0x1e4b,0x784b,0x34cb,0x344b,0x3ccb,0,0,0,0x1b,5,5,5,5,5,
+5,0,0,8,8,0,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,0,0,0,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,0,5,5,5,5,5,5,5,5,5,0,5,0,
+0,5,5,5,5,5,5,5,0,0,0,6,0,0,0,0,
+8,8,8,6,6,6,0,6,0,8,8,8,8,8,8,8,
+8,0,0,0,0,0,0,0x49,0x89,0xc9,0x109,0x149,0x189,0x1c9,0x209,0x249,
+0x289,0,0,8,8,0x17,0,0,0,0,0,0,0,0,0,0,
 0,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,0,0,0,0,6,6,6,
-6,6,6,6,6,6,6,6,6,6,6,8,6,6,6,6,
-6,0x17,6,6,5,5,5,5,5,6,6,6,6,6,6,6,
-6,6,6,6,0,6,6,6,6,6,6,6,6,6,6,6,
-6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
-6,6,6,6,6,0,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,6,0x1b,
-0x1b,0x1b,0x1b,0x1b,0x1b,0,0x1b,0x1b,0x17,0x17,0x17,0x17,0x17,0x1b,0x1b,0x1b,
-0x1b,0x17,0x17,0,0,0,0,0,5,5,5,5,5,5,5,5,
-5,5,5,8,8,6,6,6,6,8,6,6,6,6,6,6,
-8,6,6,8,8,6,6,5,0x49,0x89,0xc9,0x109,0x149,0x189,0x1c9,0x209,
-0x249,0x289,0x17,0x17,0x17,0x17,0x17,0x17,5,5,5,5,5,5,8,8,
-6,6,5,5,5,5,6,6,6,5,8,8,8,5,5,8,
-8,8,8,8,8,8,5,5,5,6,6,6,6,5,5,5,
-5,5,5,5,5,5,5,5,5,5,6,8,8,6,6,8,
-8,8,8,8,8,6,5,8,0x49,0x89,0xc9,0x109,0x149,0x189,0x1c9,0x209,
-0x249,0x289,8,8,8,6,0x1b,0x1b,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,0x17,4,5,5,5,1,1,1,1,1,1,0,1,
-0,0,0,0,0,1,0,0,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,0,5,5,5,5,0,0,
-5,5,5,5,5,5,5,0,5,0,5,5,5,5,0,0,
-5,5,5,5,5,5,5,5,5,0,5,5,5,5,0,0,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,0,5,5,5,5,0,0,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,6,5,5,6,6,6,6,6,6,6,0,0,0,0,0x19,
+5,5,5,5,5,5,4,6,6,6,6,6,6,6,6,0x17,
+0x49,0x89,0xc9,0x109,0x149,0x189,0x1c9,0x209,0x249,0x289,0x17,0x17,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+5,5,0,5,0,0,5,5,0,5,0,0,5,0,0,0,
+0,0,0,5,5,5,5,0,5,5,5,5,5,5,5,0,
+5,5,5,0,5,0,5,0,0,5,5,0,5,5,5,5,
+6,5,5,6,6,6,6,6,6,0,6,6,5,0,0,5,
+5,5,5,5,0,4,0,6,6,6,6,6,6,0,0,0x49,
+0x89,0xc9,0x109,0x149,0x189,0x1c9,0x209,0x249,0x289,0,0,5,5,5,5,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,5,
+0x1b,0x1b,0x1b,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,
+0x17,0x17,0x1b,0x17,0x1b,0x1b,0x1b,6,6,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x49,
+0x89,0xc9,0x109,0x149,0x189,0x1c9,0x209,0x249,0x289,0x344b,0x3c4b,0x444b,0x4c4b,0x544b,0x5c4b,0x644b,
+0x6c4b,0x744b,0x2c4b,0x1b,6,0x1b,6,0x1b,6,0x14,0x15,0x14,0x15,8,8,5,
 5,5,5,5,5,5,5,0,5,5,5,5,5,5,5,5,
 5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,0,0,6,6,6,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,
-0x17,0x30b,0x34b,0x38b,0x3cb,0x40b,0x44b,0x48b,0x4cb,0x50b,0x7cb,0xa4b,0xccb,0xf4b,0x11cb,0x144b,
-0x16cb,0x194b,0x1bcb,0x1e4b,0x788b,0,0,0,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
-0x1b,0x1b,0,0,0,0,0,0,1,1,1,1,1,1,1,1,
-1,1,1,1,1,1,1,1,1,1,1,1,1,1,0,0,
-2,2,2,2,2,2,0,0,0x13,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,0x17,0x17,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,0xc,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,0x14,0x15,0,0,0,5,5,5,5,
-5,5,5,5,5,5,5,0x17,0x17,0x17,0x98a,0x9ca,0xa0a,5,5,5,
-5,5,5,5,5,0,0,0,0,0,0,0,5,5,5,5,
-5,5,5,5,5,5,5,5,5,0,5,5,5,5,6,6,
-6,0,0,0,0,0,0,0,0,0,0,0,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,6,6,
-6,0x17,0x17,0,0,0,0,0,0,0,0,0,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,6,6,
-0,0,0,0,0,0,0,0,0,0,0,0,5,5,5,5,
-5,5,5,5,5,5,5,5,5,0,5,5,5,0,6,6,
-0,0,0,0,0,0,0,0,0,0,0,0,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-6,6,8,6,6,6,6,6,6,6,8,8,8,8,8,8,
+5,5,5,5,5,5,5,5,5,5,5,5,0,0,0,0,
+6,6,6,6,6,6,6,6,6,6,6,6,6,6,8,6,
+6,6,6,6,0x17,6,6,5,5,5,5,5,6,6,6,6,
+6,6,6,6,6,6,6,0,6,6,6,6,6,6,6,6,
+6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
+6,6,6,6,6,6,6,6,6,6,6,6,0,0x1b,0x1b,0x1b,
+0x1b,0x1b,0x1b,6,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0,0x1b,0x1b,0x17,0x17,0x17,
+0x17,0x17,0x1b,0x1b,0x1b,0x1b,0x17,0x17,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,8,8,6,6,6,6,8,6,
+6,6,6,6,6,8,6,6,8,8,6,6,5,0x49,0x89,0xc9,
+0x109,0x149,0x189,0x1c9,0x209,0x249,0x289,0x17,0x17,0x17,0x17,0x17,0x17,5,5,5,
+5,5,5,8,8,6,6,5,5,5,5,6,6,6,5,8,
+8,8,5,5,8,8,8,8,8,8,8,5,5,5,6,6,
+6,6,5,5,5,5,5,5,5,5,5,5,5,6,8,8,
+6,6,8,8,8,8,8,8,6,5,8,0x49,0x89,0xc9,0x109,0x149,
+0x189,0x1c9,0x209,0x249,0x289,8,8,8,6,0x1b,0x1b,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,0,1,0,0,0,
+0,0,1,0,0,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+0x17,4,5,5,5,5,5,5,5,5,5,0,5,5,5,5,
+0,0,5,5,5,5,5,5,5,0,5,0,5,5,5,5,
+0,0,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,0,5,5,5,5,0,0,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,0,5,5,5,5,0,
+0,5,5,5,5,5,5,5,0,5,5,5,5,0,0,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,0,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,0,5,5,5,5,0,0,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,0,0,6,6,6,0x17,0x17,0x17,0x17,0x17,
+0x17,0x17,0x17,0x17,0x30b,0x34b,0x38b,0x3cb,0x40b,0x44b,0x48b,0x4cb,0x50b,0x7cb,0xa4b,0xccb,
+0xf4b,0x11cb,0x144b,0x16cb,0x194b,0x1bcb,0x1e4b,0x788b,0,0,0,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,0x1b,0x1b,0x1b,0x1b,0x1b,
+0x1b,0x1b,0x1b,0x1b,0x1b,0,0,0,0,0,0,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,0,0,2,2,2,2,2,2,0,0,0x13,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,0x17,0x17,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,0xc,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,0x14,0x15,0,0,0,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,0x17,0x17,0x17,0x98a,0x9ca,0xa0a,5,
+5,5,5,5,5,5,5,0,0,0,0,0,0,0,5,5,
+5,5,5,5,5,5,5,5,5,5,5,0,5,5,5,5,
+6,6,6,0,0,0,0,0,0,0,0,0,0,0,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+6,6,6,0x17,0x17,0,0,0,0,0,0,0,0,0,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+6,6,0,0,0,0,0,0,0,0,0,0,0,0,5,5,
+5,5,5,5,5,5,5,5,5,5,5,0,5,5,5,0,
+6,6,0,0,0,0,0,0,0,0,0,0,0,0,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,6,6,8,6,6,6,6,6,6,6,8,8,8,8,
 8,8,6,8,8,6,6,6,6,6,6,6,6,6,6,6,
 0x17,0x17,0x17,4,0x17,0x17,0x17,0x19,5,6,0,0,0x49,0x89,0xc9,0x109,
 0x149,0x189,0x1c9,0x209,0x249,0x289,0,0,0,0,0,0,0x54b,0x58b,0x5cb,0x60b,
-0x64b,0x68b,0x6cb,0x70b,0x74b,0x78b,0,0,0,0,0,0,5,5,5,5,
-5,5,5,5,5,6,5,0,0,0,0,0,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,0x17,0x17,0x17,0x17,
+0x64b,0x68b,0x6cb,0x70b,0x74b,0x78b,0,0,0,0,0,0,0x17,0x17,0x17,0x17,
 0x17,0x17,0x13,0x17,0x17,0x17,0x17,6,6,6,0x10,0,0x49,0x89,0xc9,0x109,
-0x149,0x189,0x1c9,0x209,0x249,0x289,0,0,0,0,0,0,5,5,5,4,
+0x149,0x189,0x1c9,0x209,0x249,0x289,0,0,0,0,0,0,5,5,5,5,
 5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,0,0,0,0,
-0,0,0,0,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,0,0,0,0,0,0,
-0,0,0,0,6,6,6,8,8,8,8,6,6,8,8,8,
-0,0,0,0,8,8,6,8,8,8,8,8,8,6,6,6,
-0,0,0,0,0x1b,0,0,0,0x17,0x17,0x49,0x89,0xc9,0x109,0x149,0x189,
-0x1c9,0x209,0x249,0x289,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,4,5,5,5,
 5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,0,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,0,0,5,5,5,5,5,0,0,0,0,0,0,0,
-0,0,0,0,5,5,5,5,5,5,5,5,5,5,5,5,
-0,0,0,0,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,0,0,0,0,0,0,0x49,0x89,0xc9,0x109,
-0x149,0x189,0x1c9,0x209,0x249,0x289,0x30b,0,0,0,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,0,0,0,0,0,0,0,0,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,6,5,0,0,0,0,0,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,0,
+0,0,0,0,0,0,0,0,0,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,0,6,6,6,8,8,8,8,
+6,6,8,8,8,0,0,0,0,8,8,6,8,8,8,8,
+8,8,6,6,6,0,0,0,0,0x1b,0,0,0,0x17,0x17,0x49,
+0x89,0xc9,0x109,0x149,0x189,0x1c9,0x209,0x249,0x289,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,0,0,5,5,5,5,5,0,0,
+0,0,0,0,0,0,0,0,0,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,0,0,0,0,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,0,0,0,0,0,0,0x49,
+0x89,0xc9,0x109,0x149,0x189,0x1c9,0x209,0x249,0x289,0x30b,0,0,0,0x1b,0x1b,0x1b,
 0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
-0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,6,6,8,8,6,0,0,0x17,0x17,0x17,0x17,0x17,0x17,
-0x17,0x17,0x17,4,0x17,0x17,0x17,0x17,0x17,0x17,0,0,6,6,6,6,
-6,6,6,6,6,6,6,6,6,6,7,0,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,8,6,8,6,6,6,6,6,6,6,0,6,8,6,8,
-8,6,6,6,6,6,6,6,6,8,8,8,8,8,8,6,
-6,6,6,6,6,6,6,6,6,0,0,6,0x49,0x89,0xc9,0x109,
-0x149,0x189,0x1c9,0x209,0x249,0x289,0,0,0,0,0,0,0x49,0x89,0xc9,0x109,
-0x149,0x189,0x1c9,0x209,0x249,0x289,0,0,0,0,0,0,0x17,0x1b,0x1b,0x1b,
-0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,6,6,6,6,6,6,6,6,6,
-0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0,0,0,6,6,6,6,
-8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,6,8,6,6,
-6,6,6,8,6,8,8,8,8,8,6,8,8,5,5,5,
-5,5,5,5,0,0,0,0,0x49,0x89,0xc9,0x109,0x149,0x189,0x1c9,0x209,
-0x249,0x289,0x17,0x17,0x17,0x17,0x17,0x17,5,8,6,6,6,6,8,8,
-6,6,8,6,6,6,5,5,0x49,0x89,0xc9,0x109,0x149,0x189,0x1c9,0x209,
-0x249,0x289,5,5,5,5,5,5,6,6,8,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,6,8,6,6,8,8,
-8,6,8,6,6,6,8,8,0,0,0,0,0,0,0,0,
-0x17,0x17,0x17,0x17,0x49,0x89,0xc9,0x109,0x149,0x189,0x1c9,0x209,0x249,0x289,0,0,
-0,5,5,5,0x49,0x89,0xc9,0x109,0x149,0x189,0x1c9,0x209,0x249,0x289,5,5,
-5,5,5,5,8,8,8,8,8,8,8,8,6,6,6,6,
-6,6,6,6,8,8,6,6,0,0,0,0x17,0x17,0x17,0x17,0x17,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,4,4,4,4,4,4,0x17,0x17,
-0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0,0,0,0,0,0,0,0,
-6,6,6,0x17,6,6,6,6,6,6,6,6,6,6,6,6,
-6,8,6,6,6,6,6,6,6,5,5,5,5,6,5,5,
-5,5,8,8,6,5,5,0,6,6,0,0,0,0,0,0,
-2,2,2,2,2,2,2,2,2,2,2,2,4,4,4,4,
-4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
-4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,2,
-2,2,2,2,2,2,2,2,2,2,2,2,4,2,2,2,
+0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,6,6,8,8,6,0,0,0x17,0x17,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,
+6,8,6,6,6,6,6,6,6,0,6,8,6,8,8,6,
+6,6,6,6,6,6,6,8,8,8,8,8,8,6,6,6,
+6,6,6,6,6,6,6,0,0,6,0x49,0x89,0xc9,0x109,0x149,0x189,
+0x1c9,0x209,0x249,0x289,0,0,0,0,0,0,0x49,0x89,0xc9,0x109,0x149,0x189,
+0x1c9,0x209,0x249,0x289,0,0,0,0,0,0,0x17,0x17,0x17,0x17,0x17,0x17,
+0x17,4,0x17,0x17,0x17,0x17,0x17,0x17,0,0,6,6,6,6,6,6,
+6,6,6,6,6,6,6,6,7,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,6,6,6,6,8,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,6,8,6,
+6,6,6,6,8,6,8,8,8,6,8,8,5,5,5,5,
+5,5,5,0,0,0,0,0x49,0x89,0xc9,0x109,0x149,0x189,0x1c9,0x209,0x249,
+0x289,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
+0x1b,0x1b,6,6,6,6,6,6,6,6,6,0x1b,0x1b,0x1b,0x1b,0x1b,
+0x1b,0x1b,0x1b,0x1b,0,0,0,6,6,8,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,8,6,6,6,6,8,8,6,
+6,8,6,6,6,5,5,0x49,0x89,0xc9,0x109,0x149,0x189,0x1c9,0x209,0x249,
+0x289,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,6,8,6,6,8,8,8,6,8,
+6,6,6,8,8,0,0,0,0,0,0,0,0,0x17,0x17,0x17,
+0x17,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,8,8,8,8,8,8,8,8,6,6,6,
+6,6,6,6,6,8,8,6,6,0,0,0,0x17,0x17,0x17,0x17,
+0x17,0x49,0x89,0xc9,0x109,0x149,0x189,0x1c9,0x209,0x249,0x289,0,0,0,5,5,
+5,0x49,0x89,0xc9,0x109,0x149,0x189,0x1c9,0x209,0x249,0x289,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,4,4,4,4,4,4,0x17,
+0x17,0x17,0x17,0x17,0x17,0x17,0x17,0,0,0,0,0,0,0,0,6,
+6,6,0x17,6,6,6,6,6,6,6,6,6,6,6,6,6,
+8,6,6,6,6,6,6,6,5,5,5,5,6,5,5,5,
+5,8,8,6,5,5,0,6,6,0,0,0,0,0,0,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
 2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
 2,2,2,2,2,2,2,2,2,2,2,4,4,4,4,4,
+4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+4,4,4,4,4,4,2,2,2,2,2,2,2,2,2,2,
+2,2,2,4,2,2,2,2,2,2,2,6,6,6,6,6,
 6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
-6,6,6,6,6,6,0,0,0,0,0,0,6,6,6,6,
-1,2,1,2,1,2,1,2,1,2,1,2,1,2,1,2,
-1,2,1,2,1,2,2,2,2,2,2,2,2,2,1,2,
-2,2,2,2,2,2,2,2,1,1,1,1,1,0x1a,0x1a,0x1a,
-0,0,2,2,2,0,2,2,1,1,1,1,3,0x1a,0x1a,0,
-2,2,2,2,2,2,2,2,1,1,1,1,1,1,1,1,
-2,2,2,2,2,2,0,0,1,1,1,1,1,1,0,0,
-2,2,2,2,2,2,2,2,1,1,1,1,1,1,1,1,
-2,2,2,2,2,2,2,2,1,1,1,1,1,1,1,1,
-2,2,2,2,2,2,0,0,1,1,1,1,1,1,0,0,
-2,2,2,2,2,2,2,2,0,1,0,1,0,1,0,1,
-2,2,2,2,2,2,2,2,1,1,1,1,1,1,1,1,
-2,2,2,2,2,2,2,2,2,2,2,2,2,2,0,0,
-2,2,2,2,2,2,2,2,3,3,3,3,3,3,3,3,
-2,2,2,2,2,2,2,2,3,3,3,3,3,3,3,3,
-2,2,2,2,2,0,2,2,1,1,1,1,3,0x1a,2,0x1a,
-0x1a,0x1a,2,2,2,0,2,2,1,1,1,1,3,0x1a,0x1a,0x1a,
-2,2,2,2,0,0,2,2,1,1,1,1,0,0x1a,0x1a,0x1a,
-0x16,0x17,0x17,0x17,0x18,0x14,0x15,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,
-0x17,0x17,0x18,0x17,0x16,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0xc,
-0x10,0x10,0x10,0x10,0x10,0,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,
-0x2cb,4,0,0,0x3cb,0x40b,0x44b,0x48b,0x4cb,0x50b,0x18,0x18,0x18,0x14,0x15,4,
-0xc,0xc,0xc,0xc,0xc,0xc,0xc,0xc,0xc,0xc,0xc,0x10,0x10,0x10,0x10,0x10,
-0x13,0x13,0x13,0x13,0x13,0x13,0x17,0x17,0x1c,0x1d,0x14,0x1c,0x1c,0x1d,0x14,0x1c,
-0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0xd,0xe,0x10,0x10,0x10,0x10,0x10,0xc,
-0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x1c,0x1d,0x17,0x17,0x17,0x17,0x16,
-0x2cb,0x30b,0x34b,0x38b,0x3cb,0x40b,0x44b,0x48b,0x4cb,0x50b,0x18,0x18,0x18,0x14,0x15,0,
-4,4,4,4,4,4,4,4,4,4,4,4,4,0,0,0,
+6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
+6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
+6,0,0,0,0,0,0,6,6,6,6,1,2,1,2,1,
+2,1,2,1,2,1,2,1,2,1,2,1,2,1,2,1,
+2,1,2,1,2,1,2,1,2,1,2,1,2,1,2,1,
+2,1,2,1,2,1,2,1,2,1,2,1,2,1,2,1,
+2,1,2,1,2,1,2,1,2,1,2,2,2,2,2,2,
+2,2,2,1,2,1,2,1,2,1,2,1,2,1,2,1,
+2,1,2,1,2,1,2,1,2,1,2,1,2,1,2,1,
+2,1,2,1,2,2,2,2,2,2,2,2,1,1,1,1,
+1,1,1,1,2,2,2,2,2,2,0,0,1,1,1,1,
+1,1,0,0,2,2,2,2,2,2,2,2,1,1,1,1,
+1,1,1,1,2,2,2,2,2,2,2,2,1,1,1,1,
+1,1,1,1,2,2,2,2,2,2,0,0,1,1,1,1,
+1,1,0,0,2,2,2,2,2,2,2,2,0,1,0,1,
+0,1,0,1,2,2,2,2,2,2,2,2,1,1,1,1,
+1,1,1,1,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,0,0,2,2,2,2,2,2,2,2,3,3,3,3,
+3,3,3,3,2,2,2,2,2,2,2,2,3,3,3,3,
+3,3,3,3,2,2,2,2,2,2,2,2,3,3,3,3,
+3,3,3,3,2,2,2,2,2,0,2,2,1,1,1,1,
+3,0x1a,2,0x1a,0x1a,2,2,2,0,2,2,1,1,1,1,3,
+0x1a,0x1a,0x1a,2,2,2,2,0,0,2,2,1,1,1,1,0,
+0x1a,0x1a,0x1a,2,2,2,2,2,2,2,2,1,1,1,1,1,
+0x1a,0x1a,0x1a,0,0,2,2,2,0,2,2,1,1,1,1,3,
+0x1a,0x1a,0,0xc,0xc,0xc,0xc,0xc,0xc,0xc,0xc,0xc,0xc,0xc,0x10,0x10,
+0x10,0x10,0x10,0x13,0x13,0x13,0x13,0x13,0x13,0x17,0x17,0x1c,0x1d,0x14,0x1c,0x1c,
+0x1d,0x14,0x1c,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0xd,0xe,0x10,0x10,0x10,
+0x10,0x10,0xc,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x1c,0x1d,0x17,0x17,
+0x17,0x17,0x16,0x17,0x17,0x17,0x18,0x14,0x15,0x17,0x17,0x17,0x17,0x17,0x17,0x17,
+0x17,0x17,0x17,0x17,0x18,0x17,0x16,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,
+0x17,0xc,0x10,0x10,0x10,0x10,0x10,0,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,
+0x10,0x10,0x2cb,4,0,0,0x3cb,0x40b,0x44b,0x48b,0x4cb,0x50b,0x18,0x18,0x18,0x14,
+0x15,4,0x2cb,0x30b,0x34b,0x38b,0x3cb,0x40b,0x44b,0x48b,0x4cb,0x50b,0x18,0x18,0x18,0x14,
+0x15,0,4,4,4,4,4,4,4,4,4,4,4,4,4,0,
+0,0,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,
 0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,
-0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-6,6,6,6,6,6,6,6,6,6,6,6,6,7,7,7,
-7,6,7,7,7,6,6,6,6,6,6,6,6,6,6,6,
-6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0x1b,0x1b,0x1b,0x1b,1,0x1b,1,0x1b,1,0x1b,1,1,1,1,0x1b,2,
-1,1,1,1,2,5,5,5,5,2,0x1b,0x1b,2,2,1,1,
-0x18,0x18,0x18,0x18,0x18,1,2,2,2,2,0x1b,0x18,0x1b,0x1b,2,0x1b,
-0x358b,0x360b,0x364b,0x348b,0x388b,0x350b,0x390b,0x3d0b,0x410b,0x354b,0x454b,0x35cb,0x3dcb,0x45cb,0x4dcb,0x58b,
-0x1b,0x1b,1,0x1b,0x1b,0x1b,0x1b,1,0x1b,0x1b,2,1,1,1,2,2,
-1,1,1,2,0x1b,1,0x1b,0x1b,0x18,1,1,1,1,1,0x1b,0x1b,
-0x58a,0x5ca,0x60a,0x64a,0x68a,0x6ca,0x70a,0x74a,0x78a,0x7ca,0x80a,0x84a,0x11ca,0x1e4a,0x980a,0x784a,
-0x58a,0x5ca,0x60a,0x64a,0x68a,0x6ca,0x70a,0x74a,0x78a,0x7ca,0x80a,0x84a,0x11ca,0x1e4a,0x980a,0x784a,
+0x19,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,6,6,6,6,6,6,6,6,6,6,6,6,6,7,7,
+7,7,6,7,7,7,6,6,6,6,6,6,6,6,6,6,
+6,6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0x1b,0x1b,1,0x1b,0x1b,0x1b,0x1b,1,0x1b,0x1b,2,1,1,1,2,
+2,1,1,1,2,0x1b,1,0x1b,0x1b,0x18,1,1,1,1,1,0x1b,
+0x1b,0x1b,0x1b,0x1b,0x1b,1,0x1b,1,0x1b,1,0x1b,1,1,1,1,0x1b,
+2,1,1,1,1,2,5,5,5,5,2,0x1b,0x1b,2,2,1,
+1,0x18,0x18,0x18,0x18,0x18,1,2,2,2,2,0x1b,0x18,0x1b,0x1b,2,
+0x1b,0x358b,0x360b,0x364b,0x348b,0x388b,0x350b,0x390b,0x3d0b,0x410b,0x354b,0x454b,0x35cb,0x3dcb,0x45cb,0x4dcb,
+0x58b,0x58a,0x5ca,0x60a,0x64a,0x68a,0x6ca,0x70a,0x74a,0x78a,0x7ca,0x80a,0x84a,0x11ca,0x1e4a,0x980a,
+0x784a,0x58a,0x5ca,0x60a,0x64a,0x68a,0x6ca,0x70a,0x74a,0x78a,0x7ca,0x80a,0x84a,0x11ca,0x1e4a,0x980a,
 0x784a,0x984a,0x788a,1,2,0x6ca,0x11ca,0x988a,0x78ca,0x54b,0x1b,0x1b,0,0,0,0,
 0x18,0x18,0x18,0x18,0x18,0x1b,0x1b,0x1b,0x1b,0x1b,0x18,0x18,0x1b,0x1b,0x1b,0x1b,
+0x18,0x1b,0x1b,0x18,0x1b,0x1b,0x18,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x18,0x1b,
 0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
-0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x1b,0x1b,0x18,
-0x1b,0x1b,0x18,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x18,0x1b,0x1b,0x1b,0x1b,0x1b,
-0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x18,0x18,
-0x1b,0x1b,0x18,0x1b,0x18,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
+0x18,0x18,0x1b,0x1b,0x18,0x1b,0x18,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
+0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
+0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,
 0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,
 0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,
-0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x14,0x15,0x14,0x15,0x1b,0x1b,0x1b,0x1b,
-0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
-0x18,0x18,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x14,0x15,0x1b,0x1b,0x1b,0x1b,0x1b,
+0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,
+0x18,0x18,0x18,0x18,0x18,0x18,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x14,0x15,
+0x14,0x15,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
+0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x18,0x18,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x14,
+0x15,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
 0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
-0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x18,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
 0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
-0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,
-0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x1b,0x1b,0x1b,0x1b,
+0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x18,0x1b,0x1b,
 0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
-0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x18,0x18,0x18,0x18,0x18,0x18,0x1b,0x1b,
+0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x18,0x18,0x18,0x18,0x18,0x18,0x18,
+0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,
+0x18,0x18,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
+0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x18,0x18,
+0x18,0x18,0x18,0x18,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
+0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0,0,0,
+0,0,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
 0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
-0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0,0,0,0,0,0,0,0,0,
+0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x2cb,0x80b,0x84b,0x88b,0x8cb,0x90b,
-0x94b,0x98b,0x9cb,0xa0b,0xa4b,0x30b,0x34b,0x38b,0x3cb,0x40b,0x44b,0x48b,0x4cb,0x50b,0x7cb,0x2cb,
-0x30b,0x34b,0x38b,0x3cb,0x40b,0x44b,0x48b,0x4cb,0x50b,0x7cb,0x80b,0x84b,0x88b,0x8cb,0x90b,0x94b,
-0x98b,0x9cb,0xa0b,0xa4b,0x30b,0x34b,0x38b,0x3cb,0x40b,0x44b,0x48b,0x4cb,0x50b,0x7cb,0x80b,0x84b,
-0x88b,0x8cb,0x90b,0x94b,0x98b,0x9cb,0xa0b,0xa4b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
+0,0,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0x30b,0x34b,0x38b,0x3cb,0x40b,0x44b,0x48b,0x4cb,0x50b,0x7cb,0x80b,0x84b,0x88b,0x8cb,
+0x90b,0x94b,0x98b,0x9cb,0xa0b,0xa4b,0x30b,0x34b,0x38b,0x3cb,0x40b,0x44b,0x48b,0x4cb,0x50b,0x7cb,
+0x80b,0x84b,0x88b,0x8cb,0x90b,0x94b,0x98b,0x9cb,0xa0b,0xa4b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
+0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
+0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
+0x1b,0x1b,0x1b,0x1b,0x2cb,0x80b,0x84b,0x88b,0x8cb,0x90b,0x94b,0x98b,0x9cb,0xa0b,0xa4b,0x30b,
+0x34b,0x38b,0x3cb,0x40b,0x44b,0x48b,0x4cb,0x50b,0x7cb,0x2cb,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
 0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
-0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
-0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x18,
-0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x18,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
 0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
-0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x18,0x1b,0x1b,0x1b,0x1b,
-0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x14,0x15,0x14,0x15,
-0x14,0x15,0x14,0x15,0x14,0x15,0x14,0x15,0x14,0x15,0x30b,0x34b,0x38b,0x3cb,0x40b,0x44b,
-0x48b,0x4cb,0x50b,0x7cb,0x30b,0x34b,0x38b,0x3cb,0x40b,0x44b,0x48b,0x4cb,0x50b,0x7cb,0x30b,0x34b,
-0x38b,0x3cb,0x40b,0x44b,0x48b,0x4cb,0x50b,0x7cb,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
-0x1b,0x1b,0x1b,0x1b,0x18,0x18,0x18,0x18,0x18,0x14,0x15,0x18,0x18,0x18,0x18,0x18,
+0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
+0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x18,0x1b,0x1b,0x1b,0x1b,0x1b,
+0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
+0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
+0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
+0x1b,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
+0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
+0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
+0x1b,0x14,0x15,0x14,0x15,0x14,0x15,0x14,0x15,0x14,0x15,0x14,0x15,0x14,0x15,0x30b,
+0x34b,0x38b,0x3cb,0x40b,0x44b,0x48b,0x4cb,0x50b,0x7cb,0x30b,0x34b,0x38b,0x3cb,0x40b,0x44b,0x48b,
+0x4cb,0x50b,0x7cb,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
+0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
+0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x18,
+0x18,0x18,0x18,0x18,0x14,0x15,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,
 0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,
-0x18,0x18,0x18,0x18,0x18,0x18,0x14,0x15,0x14,0x15,0x14,0x15,0x14,0x15,0x14,0x15,
+0x18,0x18,0x18,0x18,0x18,0x14,0x15,0x14,0x15,0x14,0x15,0x14,0x15,0x14,0x15,0x18,
+0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x14,
+0x15,0x14,0x15,0x14,0x15,0x14,0x15,0x14,0x15,0x14,0x15,0x14,0x15,0x14,0x15,0x14,
+0x15,0x14,0x15,0x14,0x15,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,
 0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,
-0x18,0x18,0x18,0x14,0x15,0x14,0x15,0x14,0x15,0x14,0x15,0x14,0x15,0x14,0x15,0x14,
-0x15,0x14,0x15,0x14,0x15,0x14,0x15,0x14,0x15,0x18,0x18,0x18,0x18,0x18,0x18,0x18,
+0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x14,0x15,0x14,0x15,
 0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,
-0x18,0x18,0x18,0x18,0x14,0x15,0x14,0x15,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,
 0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,
-0x18,0x18,0x18,0x18,0x14,0x15,0x18,0x18,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
-0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,
-0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x1b,0x1b,0x18,0x18,0x18,0x18,0x18,
-0x18,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
-0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0,0,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
+0x14,0x15,0x18,0x18,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
 0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
-0x1b,0x1b,0,0,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
-0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0,0,
-0,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0,0x1b,0x1b,
-0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0x1b,0x1b,0x1b,0x1b,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,2,2,2,2,2,2,2,2,
+0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
+0x1b,0x1b,0x1b,0x1b,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,
+0x18,0x18,0x18,0x18,0x1b,0x1b,0x18,0x18,0x18,0x18,0x18,0x18,0x1b,0x1b,0x1b,0x1b,
+0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
+0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
+0x1b,0x1b,0x1b,0,0,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
+0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
+0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0,0,0,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
+0x1b,0x1b,0x1b,0,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0x1b,0x1b,0x1b,0x1b,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,0,2,2,2,2,2,2,
 2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
-2,2,2,2,2,2,2,0,1,1,1,1,1,1,1,1,
-1,1,1,1,1,1,1,0,2,2,2,2,2,2,2,2,
-2,2,2,2,2,2,2,2,1,2,1,1,1,2,2,1,
-2,1,2,1,2,1,1,1,1,2,1,2,2,1,2,2,
-2,2,2,2,4,4,1,1,1,2,1,2,2,0x1b,0x1b,0x1b,
-0x1b,0x1b,0x1b,1,2,1,2,6,6,6,1,2,0,0,0,0,
-0,0x17,0x17,0x17,0x17,0x344b,0x17,0x17,2,2,2,2,2,2,0,2,
-0,0,0,0,0,2,0,0,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,0,0,0,0,0,0,0,4,
-0x17,0,0,0,0,0,0,0,0,0,0,0,0,0,0,6,
-5,5,5,5,5,5,5,0,5,5,5,5,5,5,5,0,
-5,5,5,5,5,5,5,0,5,5,5,5,5,5,5,0,
+2,2,2,2,2,2,2,2,2,0,1,2,1,1,1,2,
+2,1,2,1,2,1,2,1,1,1,1,2,1,2,2,1,
+2,2,2,2,2,2,4,4,1,1,2,1,2,1,2,1,
+2,1,2,1,2,1,2,1,2,1,2,1,2,1,2,1,
+2,1,2,1,2,1,2,1,2,1,2,1,2,2,0x1b,0x1b,
+0x1b,0x1b,0x1b,0x1b,1,2,1,2,6,6,6,1,2,0,0,0,
+0,0,0x17,0x17,0x17,0x17,0x344b,0x17,0x17,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,0,
+2,0,0,0,0,0,2,0,0,5,5,5,5,5,5,5,
 5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,0,0,0,0,0,0,0,0,0,
-0x17,0x17,0x1c,0x1d,0x1c,0x1d,0x17,0x17,0x17,0x1c,0x1d,0x17,0x1c,0x1d,0x17,0x17,
-0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x13,0x17,0x17,0x13,0x17,0x1c,0x1d,0x17,0x17,
-0x1c,0x1d,0x14,0x15,0x14,0x15,0x14,0x15,0x14,0x15,0x17,0x17,0x17,0x17,0x17,4,
-0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x13,0x13,0x17,0x17,0x17,0x17,
-0x13,0x17,0x14,0,0,0,0,0,0,0,0,0,0,0,0,0,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,0,0,0,0,0,0,0,4,0x17,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,6,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+0,0,0,0,0,0,0,0,0,5,5,5,5,5,5,5,
+0,5,5,5,5,5,5,5,0,5,5,5,5,5,5,5,
+0,5,5,5,5,5,5,5,0,6,6,6,6,6,6,6,
+6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
+6,6,6,6,6,6,6,6,6,0x17,0x17,0x1c,0x1d,0x1c,0x1d,0x17,
+0x17,0x17,0x1c,0x1d,0x17,0x1c,0x1d,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,
+0x13,0x17,0x17,0x13,0x17,0x1c,0x1d,0x17,0x17,0x1c,0x1d,0x14,0x15,0x14,0x15,0x14,
+0x15,0x14,0x15,0x17,0x17,0x17,0x17,0x17,4,0x17,0x17,0x17,0x17,0x17,0x17,0x17,
+0x17,0x17,0x17,0x13,0x13,0x17,0x17,0x17,0x17,0x13,0x17,0x14,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
 0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
-0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0,0x1b,0x1b,0x1b,0x1b,0x1b,
+0x1b,0x1b,0x1b,0,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
 0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
-0,0,0,0,0,0,0,0,0,0,0,0,0x1b,0x1b,0x1b,0x1b,
 0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
-0x1b,0x1b,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
-0,0,0,0,0x1b,0x58a,0x5ca,0x60a,0x64a,0x68a,0x6ca,0x70a,0x74a,0x78a,6,6,
-6,6,8,8,0x13,4,4,4,4,4,0x1b,0x1b,0x7ca,0xa4a,0xcca,4,
-5,0x17,0x1b,0x1b,0xc,0x17,0x17,0x17,0x1b,4,5,0x54a,0x14,0x15,0x14,0x15,
-0x14,0x15,0x14,0x15,0x14,0x15,0x1b,0x1b,0x14,0x15,0x14,0x15,0x14,0x15,0x14,0x15,
-0x13,0x14,0x15,0x15,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,0,0,6,6,0x1a,
-0x1a,4,4,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,0x17,
-4,4,4,5,0,0,0,0,0,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,0,0,0,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,0,0x1b,0x1b,0x58b,0x5cb,
-0x60b,0x64b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0,0,0,0,
-0,0,0,0,0,0,0,0,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
+0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0,0,
+0,0,0xc,0x17,0x17,0x17,0x1b,4,5,0x54a,0x14,0x15,0x14,0x15,0x14,0x15,
+0x14,0x15,0x14,0x15,0x1b,0x1b,0x14,0x15,0x14,0x15,0x14,0x15,0x14,0x15,0x13,0x14,
+0x15,0x15,0x1b,0x58a,0x5ca,0x60a,0x64a,0x68a,0x6ca,0x70a,0x74a,0x78a,6,6,6,6,
+8,8,0x13,4,4,4,4,4,0x1b,0x1b,0x7ca,0xa4a,0xcca,4,5,0x17,
+0x1b,0x1b,0,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,0,0,6,6,0x1a,0x1a,4,4,5,0x13,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,0x17,4,4,4,5,0,0,0,0,
+0,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,0,0,0,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,0,0x1b,0x1b,0x58b,
+0x5cb,0x60b,0x64b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,0,0,0,0,0,0x1b,0x1b,0x1b,
+0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
+0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
+0x1b,0,0,0,0,0,0,0,0,0,0,0,0,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,0x1b,0x1b,0x1b,
+0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
+0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0,0x58b,0x5cb,0x60b,
+0x64b,0x68b,0x6cb,0x70b,0x74b,0x78b,0x7cb,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
+0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x7cb,0xa4b,0xccb,
+0xf4b,0x11cb,0x144b,0x16cb,0x194b,0x1b,0xa8b,0xacb,0xb0b,0xb4b,0xb8b,0xbcb,0xc0b,0xc4b,0xc8b,0xccb,
+0xd0b,0xd4b,0xd8b,0xdcb,0xe0b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
+0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
+0x1b,0x1b,0x1b,0x1b,0x1b,0x58b,0x5cb,0x60b,0x64b,0x68b,0x6cb,0x70b,0x74b,0x78b,0x7cb,0x1b,
 0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
-0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0,0x58b,0x5cb,0x60b,0x64b,0x68b,0x6cb,0x70b,0x74b,
-0x78b,0x7cb,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
-0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x7cb,0xa4b,0xccb,0xf4b,0x11cb,0x144b,0x16cb,0x194b,
-0x1b,0xa8b,0xacb,0xb0b,0xb4b,0xb8b,0xbcb,0xc0b,0xc4b,0xc8b,0xccb,0xd0b,0xd4b,0xd8b,0xdcb,0xe0b,
 0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
-0x1b,0xe4b,0xe8b,0xecb,0xf0b,0xf4b,0xf8b,0xfcb,0x100b,0x104b,0x108b,0x10cb,0x110b,0x114b,0x118b,0x11cb,
-5,5,5,5,5,0x685,5,5,5,5,5,5,5,5,5,5,
+0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0xe4b,0xe8b,0xecb,0xf0b,0xf4b,0xf8b,0xfcb,0x100b,0x104b,0x108b,
+0x10cb,0x110b,0x114b,0x118b,0x11cb,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
+0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
+0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
+0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
+0x1b,0x1b,0x1b,0x1b,0,5,5,5,5,5,0x685,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,0x5c5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
 5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,0x5c5,5,5,5,5,5,5,5,5,5,5,5,5,
 5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
 5,5,0x685,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,0x705,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,0x585,5,5,0x705,
-5,5,5,0x7885,5,0x605,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,0x705,5,5,5,5,5,5,5,
 5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,0x785,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,0x5c5,5,5,5,5,5,5,5,0x685,5,0x645,5,
 5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,0x7985,
-0x7c5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,0x7845,
-5,5,5,5,5,5,5,5,0x605,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,0x585,5,5,0x705,5,
+5,5,0x7885,5,0x605,5,5,5,5,5,5,5,5,5,5,5,
 5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,0x685,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,0x1e45,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,0x7985,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,0x7a85,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,0x5c5,5,0x745,
-5,0x6c5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,0x7c5,5,0x7845,0xa45,0xcc5,5,5,5,5,5,5,
-0xf45,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,0x605,0x605,0x605,0x605,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,0x645,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,0x585,5,5,5,5,5,5,
-5,0x585,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,0x585,5,
 5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,0x785,0xa45,
-5,5,5,5,5,5,5,5,5,5,5,5,0x585,0x5c5,0x605,5,
-0x5c5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,0x785,5,5,5,5,
 5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,0x7c5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-0x745,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,0x705,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,0x5c5,5,
+5,5,5,5,5,5,0x685,5,0x645,5,5,5,5,5,5,5,
 5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,0x785,5,5,5,5,5,5,5,5,5,5,5,5,5,
 5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,0x1e45,5,5,5,5,5,5,5,0x645,5,5,5,5,5,
+5,0x7985,0x7c5,5,5,5,5,5,5,5,5,5,5,5,5,5,
 5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,0x7885,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,0x5c5,5,5,5,5,0x5c5,
+5,0x7845,5,5,5,5,5,5,5,5,0x605,5,5,5,5,5,
 5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-0x5c5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,0x7845,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,0x685,5,5,5,5,5,5,5,5,5,5,5,5,5,
 5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,0x6c5,5,5,5,5,5,0x1e45,5,5,5,5,5,5,5,
 5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,0x6c5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,0x545,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,0,0,0,
-0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
+5,5,5,5,5,0x1e45,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,0x7985,5,5,5,5,5,5,5,5,5,5,
 5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,4,5,5,5,5,5,5,5,5,5,5,
-0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0,0,0,0,0,0,0,0,0,
 5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-4,0x17,0x17,0x17,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,0x49,0x89,0xc9,0x109,0x149,0x189,0x1c9,0x209,0x249,0x289,5,5,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,1,2,1,2,1,2,1,2,1,2,1,2,
-1,2,1,2,1,2,1,2,1,2,1,2,1,2,1,2,
-4,4,6,6,1,2,1,2,1,2,1,2,1,2,1,2,
-1,2,5,6,7,7,7,0x17,6,6,6,6,6,6,6,6,
-6,6,0x17,4,5,5,5,5,5,5,0x58a,0x5ca,0x60a,0x64a,0x68a,0x6ca,
-0x70a,0x74a,0x78a,0x54a,6,6,0x17,0x17,0x17,0x17,0x17,0x17,0,0,0,0,
-0,0,0,0,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,
-0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,4,4,4,4,4,
-4,4,4,4,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,5,4,4,2,5,
-5,5,5,5,0x1a,0x1a,1,2,1,2,1,2,1,2,1,2,
-1,2,1,2,2,2,1,2,1,2,1,2,1,2,1,2,
-1,2,1,2,1,2,1,2,4,2,2,2,2,2,2,2,
-2,1,2,1,2,1,1,2,1,2,1,2,1,2,1,2,
-4,0x1a,0x1a,1,2,1,2,5,1,2,1,2,2,2,1,2,
-1,2,1,2,1,2,1,2,1,2,1,1,1,1,0,0,
-1,1,1,1,1,2,1,2,0,0,0,0,0,0,0,0,
-5,5,6,5,5,5,6,5,5,5,5,6,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,8,8,6,6,8,0x1b,0x1b,0x1b,0x1b,0,0,0,0,
-0x34cb,0x344b,0x3ccb,0x37cb,0x35cb,0x3fcb,0x1b,0x1b,0x19,0x1b,0,0,0,0,0,0,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,0x17,0x17,0x17,0x17,0,0,0,0,0,0,0,0,
-8,8,8,8,6,0,0,0,0,0,0,0,0,0,0x17,0x17,
-0x49,0x89,0xc9,0x109,0x149,0x189,0x1c9,0x209,0x249,0x289,0,0,0,0,0,0,
-8,8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-8,8,8,8,8,8,8,8,8,8,8,8,6,6,6,6,
-6,6,6,6,6,6,6,6,6,6,6,6,6,6,5,5,
-5,5,5,5,0x17,0x17,0x17,5,0x17,5,0,0,5,5,5,5,
-5,5,6,6,6,6,6,6,6,6,0x17,0x17,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,6,
-6,6,6,6,6,6,6,6,6,6,8,8,0,0,0,0,
-0,0,0,0,0,0,0,0x17,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,0,0,0,8,0x17,0x17,0x17,0x17,0x17,0x17,0x17,
-0x17,0x17,0x17,0x17,0x17,0x17,0,4,0x49,0x89,0xc9,0x109,0x149,0x189,0x1c9,0x209,
-0x249,0x289,0,0,0,0,0x17,0x17,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,6,8,8,6,6,
-6,6,8,8,6,8,8,8,5,5,5,5,5,6,4,5,
-5,5,5,5,5,5,5,5,0x49,0x89,0xc9,0x109,0x149,0x189,0x1c9,0x209,
-0x249,0x289,5,5,5,5,5,0,5,5,5,5,5,5,5,5,
-5,6,6,6,6,6,6,8,8,6,6,8,8,6,6,0,
-0,0,0,0,0,0,0,0,5,5,5,6,5,5,5,5,
-5,5,5,5,6,8,0,0,0x49,0x89,0xc9,0x109,0x149,0x189,0x1c9,0x209,
-0x249,0x289,0,0,0x17,0x17,0x17,0x17,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,4,5,5,5,5,5,5,0x1b,
-0x1b,0x1b,5,8,6,8,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,6,5,6,6,6,5,5,6,
-6,5,5,5,5,5,6,6,5,6,5,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,5,5,4,0x17,0x17,5,5,5,5,5,5,5,5,
-5,5,5,8,6,6,8,8,0x17,0x17,5,4,4,8,6,0,
-0,0,0,0,0,0,0,0,0,5,5,5,5,5,5,0,
-0,5,5,5,5,5,5,0,0,5,5,5,5,5,5,0,
-0,0,0,0,0,0,0,0,5,5,5,5,5,5,5,0,
-5,5,5,5,5,5,5,0,2,2,2,2,2,2,2,2,
-2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
-2,2,2,0x1a,4,4,4,4,2,2,2,2,2,2,0,0,
-0,0,0,0,0,0,0,0,2,2,2,2,2,2,2,2,
-2,2,2,2,2,2,2,2,5,5,5,8,8,6,8,8,
-6,8,8,0x17,8,6,0,0,0x49,0x89,0xc9,0x109,0x149,0x189,0x1c9,0x209,
-0x249,0x289,0,0,0,0,0,0,5,5,5,5,0,0,0,0,
-0,0,0,0,0,0,0,0,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,0,0,0,0,5,
 5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,
-0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,
-0x12,0x12,0x12,0x12,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,
-0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,
-0x11,0x11,0x11,0x11,5,5,5,5,5,5,5,5,5,5,5,0x605,
-5,5,5,5,5,5,5,0x7c5,5,5,5,5,0x5c5,5,5,5,
+5,0x7a85,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
 5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,0x6c5,5,0x6c5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,0x5c5,5,0x745,5,0x6c5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,0x7c5,5,0x7845,0xa45,0xcc5,
+5,5,5,5,5,5,0xf45,5,5,5,5,5,5,5,5,5,
 5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,0x7c5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,0,0,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,0,0,
-0,0,0,0,5,5,5,5,5,5,5,5,5,0x18,5,5,
-5,5,5,5,5,5,5,5,5,5,5,0,5,5,5,5,
-5,0,5,0,5,5,0,5,5,0,5,5,5,5,5,5,
 5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,2,2,2,2,2,2,2,0,0,0,0,0,
-0,0,0,0,0,0,0,2,2,2,2,2,0,0,0,0,
-0,5,6,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,
-0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,0x605,0x605,0x605,0x605,5,5,
 5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,0x15,0x14,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,0,0,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-5,5,5,5,5,5,5,5,5,5,5,5,0x19,0x1b,0,0,
-6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
-0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x14,0x15,0x17,0,0,0,0,0,0,
-6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
-0x17,0x13,0x13,0x16,0x16,0x14,0x15,0x14,0x15,0x14,0x15,0x14,0x15,0x14,0x15,0x14,
-0x15,0x17,0x17,0x14,0x15,0x17,0x17,0x17,0x17,0x16,0x16,0x16,0x17,0x17,0x17,0,
-0x17,0x17,0x17,0x17,0x13,0x14,0x15,0x14,0x15,0x14,0x15,0x17,0x17,0x17,0x18,0x13,
-0x18,0x18,0x18,0,0x17,0x19,0x17,0x17,0,0,0,0,5,5,5,5,
-5,0,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,0,0,0x10,0,0,5,5,5,5,5,5,0,0,5,5,
-5,5,5,5,0,0,5,5,5,5,5,5,0,0,5,5,
-5,0,0,0,0x19,0x19,0x18,0x1a,0x1b,0x19,0x19,0,0x1b,0x18,0x18,0x18,
-0x18,0x1b,0x1b,0,0,0,0,0,0,0,0,0,0,0x10,0x10,0x10,
-0x1b,0x1b,0,0,0,0x17,0x17,0x17,0x19,0x17,0x17,0x17,0x14,0x15,0x17,0x18,
-0x17,0x13,0x17,0x17,0x49,0x89,0xc9,0x109,0x149,0x189,0x1c9,0x209,0x249,0x289,0x17,0x17,
-0x18,0x18,0x18,0x17,0x1a,2,2,2,2,2,2,2,2,2,2,2,
-2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,0x14,
-0x18,0x15,0x18,0x14,0x15,0x17,0x14,0x15,0x17,0x17,5,5,5,5,5,5,
-5,5,5,5,4,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,4,4,5,5,5,5,5,5,5,5,
-5,5,5,5,0,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,0,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,0,
-5,5,0,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,0,0,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,0,0,0xb00b,0xb80b,0x784b,0x804b,0x884b,0x904b,0x984b,0xa04b,0xa84b,0xb04b,0xb84b,0x788b,
-0x808b,0x888b,0x908b,0x988b,0xa08b,0xa88b,0xb08b,0xb88b,0,0,0,0x1b,0x1b,0x1b,0x1b,0x1b,
-0x1b,0x1b,0x1b,0x1b,0x17,0x17,0x17,0,0,0,0,0x58b,0x5cb,0x60b,0x64b,0x68b,
-0x6cb,0x70b,0x74b,0x78b,0x7cb,0xa4b,0xccb,0xf4b,0x11cb,0x144b,0x16cb,0x194b,0x1bcb,0x1e4b,0x800b,0x880b,
-0x900b,0x980b,0xa00b,0xa80b,0x7ca,0x7ca,0x7ca,0x7ca,0x7ca,0xcca,0x11ca,0x11ca,0x11ca,0x11ca,0x1e4a,0x880a,
-0x980a,0x980a,0x980a,0x980a,0x980a,0x784a,0x984a,0x68a,0x11ca,0x344b,0x344b,0x388b,0x3ccb,0x1b,0x1b,0x1b,
-0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x54b,0x34cb,0x1b,0,0,0,
-0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0,0,0,0,
-0x34ca,0x344a,0x58a,0x68a,0x11ca,0x980a,0x984a,0x988a,0x68a,0x7ca,0x11ca,0x1e4a,0x980a,0x784a,0x984a,0x68a,
-0x7ca,0x11ca,0x1e4a,0x980a,0x784a,0x788a,0x988a,0x7ca,0x58a,0x58a,0x58a,0x5ca,0x5ca,0x5ca,0x5ca,0x68a,
-0x1b,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
-0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,6,0,0,
 5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-6,0x58b,0x5cb,0x60b,0x64b,0x68b,0x6cb,0x70b,0x74b,0x78b,0x7cb,0xa4b,0xccb,0xf4b,0x11cb,0x144b,
-0x16cb,0x194b,0x1bcb,0x1e4b,0x800b,0x880b,0x900b,0x980b,0xa00b,0xa80b,0xb00b,0xb80b,0,0,0,0,
-0x58b,0x68b,0x7cb,0x11cb,0,0,0,0,0,0,0,0,0,0,0,0,
 5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,0x1bca,5,5,5,5,5,5,5,5,0xb80a,0,0,0,0,0,
+5,5,5,5,5,5,5,5,5,0x645,5,5,5,5,5,5,
 5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,6,6,6,6,6,0,0,0,0,0,
 5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,0,0x17,
-5,5,5,5,0,0,0,0,5,5,5,5,5,5,5,5,
-0x17,0x58a,0x5ca,0x7ca,0xa4a,0x1e4a,0,0,0,0,0,0,0,0,0,0,
-2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+5,5,5,5,5,5,5,5,5,5,5,0x585,5,5,5,5,
+5,5,5,0x585,5,5,5,5,5,5,5,5,5,5,5,5,
 5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,0,0,
-0x49,0x89,0xc9,0x109,0x149,0x189,0x1c9,0x209,0x249,0x289,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-5,5,5,5,0,0,0,0,0,0,0,0,0,0,0,0x17,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
 5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,0,5,5,0,0,0,5,0,0,5,
-5,5,5,5,5,5,0,0,5,0,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,0x585,5,
 5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,0,0x17,0x58b,0x5cb,0x60b,0x7cb,0xa4b,0x1e4b,0x784b,0x788b,5,5,5,5,
 5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,0x1b,0x1b,0x58b,0x5cb,0x60b,0x64b,0x68b,0x7cb,0xa4b,0,0,0,0,
-0,0,0,0x58b,0x5cb,0x60b,0x64b,0x64b,0x68b,0x7cb,0xa4b,0x1e4b,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,0,
-5,5,0,0,0,0,0,0x58b,0x68b,0x7cb,0xa4b,0x1e4b,5,5,5,5,
 5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,0x58b,0x7cb,0xa4b,0x1e4b,0x5cb,0x60b,0,0,0,0x17,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,0x785,0xa45,5,
+5,5,5,5,5,5,5,5,5,5,5,0x585,0x5c5,0x605,5,0x5c5,
 5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,0,0,0,0,0,0x17,0xa04b,0xa84b,0xb04b,0xb84b,
-0x788b,0x808b,0x888b,0x908b,0x988b,0xa08b,0xa88b,0xb08b,0xb88b,0x78cb,0x80cb,0x88cb,0x90cb,0x98cb,0xa0cb,0xa8cb,
-0xb0cb,0xb8cb,0x36cb,0x354b,0x34cb,0x348b,0x46cb,0x344b,0x4ecb,0x388b,0x3ccb,0x454b,5,5,5,5,
 5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,0,0,0,0,0x5ecb,0x344b,5,5,0x58b,0x5cb,0x60b,0x64b,
-0x68b,0x6cb,0x70b,0x74b,0x78b,0x7cb,0xa4b,0xccb,0xf4b,0x11cb,0x144b,0x16cb,0,0,0x1e4b,0x800b,
-0x880b,0x900b,0x980b,0xa00b,0xa80b,0xb00b,0xb80b,0x784b,0x804b,0x884b,0x904b,0x984b,0x30b,0x34b,0x38b,0x3cb,
-0x7cb,0xa4b,0x1e4b,0x784b,0,0,0,0,0,0,0,0,0x17,0x17,0x17,0x17,
-0x17,0x17,0x17,0x17,0x17,0,0,0,0,0,0,0,5,6,6,6,
-0,6,6,0,0,0,0,0,6,6,6,6,5,5,5,5,
-0,5,5,5,0,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,0,0,0,0,
-6,6,6,0,0,0,0,6,5,5,5,5,5,5,5,5,
 5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,0x58b,0x11cb,0x17,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,0x7c5,5,
+5,5,5,5,5,5,5,5,5,5,5,0x745,5,5,5,5,
 5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,0x58b,0x7cb,0xa4b,5,5,5,5,5,6,6,0,
-0,0,0,0x58b,0x68b,0x7cb,0xa4b,0x1e4b,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0,
-0,0,0,0,0,0,0,0,5,5,5,5,5,5,5,5,
-0x1b,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,0,0,0,0x17,0x17,0x17,
-0x17,0x17,0x17,0x17,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,0,0,0x58b,0x5cb,0x60b,0x64b,
-0x7cb,0xa4b,0x1e4b,0x784b,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,0,0,0,0,0,0x58b,0x5cb,0x60b,0x64b,
-0x7cb,0xa4b,0x1e4b,0x784b,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,0,0,0,0,0,0,0,0x17,0x17,0x17,
-0x17,0,0,0,0,0,0,0,0,0,0,0,0,0x58b,0x5cb,0x60b,
-0x64b,0x7cb,0xa4b,0x1e4b,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,5,5,5,5,5,5,5,5,5,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,1,1,1,1,1,1,1,1,1,1,1,1,
-1,1,1,1,1,1,1,0,0,0,0,0,0,0,0,0,
-0,0,0,0,2,2,2,2,2,2,2,2,2,2,2,2,
-2,2,2,2,2,2,2,0,0,0,0,0,0,0,0x58b,0x68b,
-0x7cb,0x11cb,0x1e4b,0x784b,0x30b,0x34b,0x38b,0x3cb,0x40b,0x44b,0x48b,0x4cb,0x50b,0x7cb,0xa4b,0xccb,
-0xf4b,0x11cb,0x144b,0x16cb,0x194b,0x1bcb,0x1e4b,0x800b,0x880b,0x900b,0x980b,0xa00b,0xa80b,0xb00b,0xb80b,0x344b,
-0x34cb,0x348b,0x388b,0,0x144b,0x16cb,0x194b,0x1bcb,0x1e4b,0x784b,0x49,0x89,0xc9,0x109,0x149,0x189,
-0x1c9,0x209,0x249,0x289,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,6,8,6,8,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,6,6,6,6,6,6,6,0x17,0x17,0x17,0x17,0x17,
-0x17,0x17,0,0,0,0,0x30b,0x34b,0x38b,0x3cb,0x40b,0x44b,0x48b,0x4cb,0x50b,0x7cb,
-0xa4b,0xccb,0xf4b,0x11cb,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,8,8,8,6,6,6,6,8,8,6,6,0x17,
-0x17,0x10,0x17,0x17,0x17,0x17,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,0,0,0,0,0,0,0,0x49,0x89,0xc9,0x109,
-0x149,0x189,0x1c9,0x209,0x249,0x289,0,0,0,0,0,0,5,5,5,5,
-5,5,5,6,6,6,6,6,8,6,6,6,6,6,6,6,
-6,0,0x49,0x89,0xc9,0x109,0x149,0x189,0x1c9,0x209,0x249,0x289,0x17,0x17,0x17,0x17,
-0,0,0,0,0,0,0,0,0,0,0,0,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,6,6,6,5,
 5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,6,
-0x17,0x17,5,0,0,0,0,0,0,0,0,0,8,5,5,5,
-5,0x17,0x17,0x17,0x17,0x17,6,6,6,0x17,0,0,0x49,0x89,0xc9,0x109,
-0x149,0x189,0x1c9,0x209,0x249,0x289,5,0x17,5,0x17,0x17,0x17,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,
-8,8,6,6,6,6,6,6,6,6,6,8,0,0x58b,0x5cb,0x60b,
-0x64b,0x68b,0x6cb,0x70b,0x74b,0x78b,0x7cb,0xa4b,0xccb,0xf4b,0x11cb,0x144b,0x16cb,0x194b,0x1bcb,0x1e4b,
-0x784b,0,0,0,0,0,0,0,0,0,0,0,5,5,5,5,
-5,5,5,5,5,5,5,5,8,8,8,6,6,6,8,8,
-6,8,6,6,0x17,0x17,0x17,0x17,0x17,0x17,0,0,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,0,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,0,
-5,0,5,5,5,5,0,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,0,5,5,5,5,5,5,5,5,5,
-5,0x17,0,0,0,0,0,0,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,8,8,8,6,6,6,6,6,
-6,6,6,0,0,0,0,0,0x49,0x89,0xc9,0x109,0x149,0x189,0x1c9,0x209,
-0x249,0x289,0,0,0,0,0,0,5,5,8,8,0,0,6,6,
-6,6,6,6,6,0,0,0,6,6,6,6,6,0,0,0,
-0,0,0,0,0,0,0,0,6,6,8,8,0,5,5,5,
-5,5,5,5,5,0,0,5,5,0,0,5,5,5,5,5,
-5,5,5,5,5,5,5,5,6,8,8,8,8,0,0,8,
-8,0,0,8,8,8,0,0,5,0,0,0,0,0,0,8,
-0,0,0,0,0,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,8,8,8,6,6,6,6,6,
-6,8,6,8,8,8,8,6,6,8,6,6,5,5,0x17,5,
-0,0,0,0,0,0,0,0,0x49,0x89,0xc9,0x109,0x149,0x189,0x1c9,0x209,
-0x249,0x289,0,0,0,0,0,0,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,8,8,8,6,6,6,6,0,0,
-8,8,8,8,6,6,8,6,6,0x17,0x17,0x17,0x17,0x17,0x17,0x17,
-0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,
-5,5,5,5,6,6,0,0,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,8,8,8,6,6,6,6,6,
-6,6,6,8,8,6,8,6,6,0x17,0x17,0x17,5,0,0,0,
-0,0,0,0,0,0,0,0,0x49,0x89,0xc9,0x109,0x149,0x189,0x1c9,0x209,
-0x249,0x289,0,0,0,0,0,0,5,5,5,5,5,5,5,5,
-5,5,5,6,8,6,8,8,6,6,6,6,6,6,8,6,
-0,0,0,0,0,0,0,0,8,8,6,6,6,6,8,6,
-6,6,6,6,0,0,0,0,0x49,0x89,0xc9,0x109,0x149,0x189,0x1c9,0x209,
-0x249,0x289,0x7cb,0xa4b,0x17,0x17,0x17,0x1b,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,0x705,
 5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,0,0,0,6,6,6,0x49,0x89,0xc9,0x109,0x149,0x189,0x1c9,0x209,
-0x249,0x289,0x7cb,0xa4b,0xccb,0xf4b,0x11cb,0x144b,0x16cb,0x194b,0x1bcb,0,0,0,0,0,
-0,0,0,0,0,0,0,5,5,5,5,5,5,5,5,5,
 5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,0,0,0,0,0,0,0,0x34ca,0x354a,0x34ca,0x34ca,0x344a,0x348a,0x388a,0xf4a,
-0x11ca,0x64a,0x68a,0x6ca,0x70a,0x74a,0x78a,0,0x17,0x17,0x17,0x17,0x17,0,0,0,
-0,0,0,0,0,0,0,0,0x5ca,0x60a,0x64a,0x68a,0x6ca,0x70a,0x74a,0x78a,
-0x60a,0x64a,0x68a,0x6ca,0x70a,0x74a,0x78a,0x64a,0x68a,0x6ca,0x70a,0x74a,0x78a,0x58a,0x5ca,0x60a,
-0x64a,0x68a,0x6ca,0x70a,0x74a,0x78a,0x58a,0x5ca,0x60a,0x64a,0x68a,0x5ca,0x60a,0x60a,0x64a,0x68a,
-0x6ca,0x70a,0x74a,0x78a,0x58a,0x5ca,0x60a,0x60a,0x64a,0x68a,0xc08a,0xc18a,0x58a,0x5ca,0x60a,0x60a,
-0x64a,0x68a,0x60a,0x60a,0x64a,0x64a,0x64a,0x64a,0x6ca,0x70a,0x70a,0x70a,0x74a,0x74a,0x78a,0x78a,
-0x78a,0x78a,0x5ca,0x60a,0x64a,0x68a,0x6ca,0x58a,0x5ca,0x60a,0x64a,0x64a,0x68a,0x68a,0x5ca,0x60a,
-0x58a,0x5ca,0x348a,0x388a,0x454a,0x348a,0x388a,0x35ca,5,5,5,5,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0x49,0x89,0xc9,0x109,0x149,0x189,0x1c9,0x209,0x249,0x289,0,0,0,0,0x17,0x17,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,0,0,
-6,6,6,6,6,0x17,0,0,0,0,0,0,0,0,0,0,
 5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+5,5,5,5,5,5,5,5,5,0x785,5,5,5,5,5,5,
 5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-6,6,6,6,6,6,6,0x17,0x17,0x17,0x17,0x17,0x1b,0x1b,0x1b,0x1b,
-4,4,4,4,0x17,0x1b,0,0,0,0,0,0,0,0,0,0,
-0x49,0x89,0xc9,0x109,0x149,0x189,0x1c9,0x209,0x249,0x289,0,0x7cb,0x1e4b,0x788b,0x790b,0x798b,
-0x7a0b,0x7a8b,0,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,0,0,0,0,0,5,5,5,
-5,5,5,5,5,0,0,0,0,0,0,0,0,0,0,0,
-5,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
-8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
-8,8,8,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,6,6,6,6,4,4,4,4,4,4,4,4,4,
-4,4,4,4,5,5,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,5,5,5,5,5,5,5,5,5,5,5,0,
-0,0,0,0,5,5,5,5,5,5,5,5,5,5,5,5,
-5,0,0,0,0,0,0,0,5,5,5,5,5,5,5,5,
-5,5,0,0,0x1b,6,6,0x17,0x10,0x10,0x10,0x10,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0,
-0,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
-0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,8,8,6,6,6,0x1b,0x1b,
-0x1b,8,8,8,8,8,8,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,6,
-6,6,6,6,6,6,6,0x1b,0x1b,6,6,6,6,6,6,6,
-0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
-0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,6,6,6,6,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
-0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0x1b,0x1b,6,6,6,0x1b,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0x58b,0x5cb,0x60b,0x64b,0x68b,0x6cb,0x70b,0x74b,0x78b,0x7cb,0xa4b,0xccb,
-0xf4b,0x11cb,0x144b,0x16cb,0x194b,0x1bcb,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0x249,0x289,0x49,0x89,0xc9,0x109,0x149,0x189,0x1c9,0x209,0x249,0x289,
-0x49,0x89,0xc9,0x109,0x149,0x189,0x1c9,0x209,0x249,0x289,0x49,0x89,0xc9,0x109,0x149,0x189,
-0x1c9,0x209,0x249,0x289,1,1,1,1,1,1,1,1,1,1,1,1,
-1,1,1,1,1,1,1,1,1,1,1,1,1,1,2,2,
-2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
-2,2,2,2,1,1,1,1,1,1,1,1,1,1,1,1,
-1,1,2,2,2,2,2,2,2,0,2,2,2,2,2,2,
-2,2,2,2,1,1,1,1,1,1,1,1,1,1,1,1,
-1,1,1,1,1,1,1,1,1,1,1,1,1,1,2,2,
-2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
-2,2,2,2,2,2,2,2,1,0,1,1,0,0,1,0,
-0,1,1,0,0,1,1,1,1,0,1,1,1,1,1,1,
-1,1,2,2,2,2,0,2,0,2,2,2,2,2,2,2,
-0,2,2,2,2,2,2,2,2,2,2,2,1,1,1,1,
-1,1,1,1,1,1,1,1,1,1,1,1,2,2,2,2,
-1,1,0,1,1,1,1,0,0,1,1,1,1,1,1,1,
-1,0,1,1,1,1,1,1,1,0,2,2,2,2,2,2,
-2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
-2,2,2,2,1,1,0,1,1,1,1,0,1,1,1,1,
-1,0,1,0,0,0,1,1,1,1,1,1,1,0,2,2,
-2,2,2,2,2,2,2,2,2,2,2,2,1,1,1,1,
-1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
-1,1,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
-2,2,2,2,2,2,2,2,2,2,2,2,1,1,1,1,
-1,1,1,1,1,1,1,1,1,1,1,1,2,2,2,2,
-2,2,0,0,1,1,1,1,1,1,1,1,1,1,1,1,
-1,1,1,1,1,1,1,1,1,1,1,1,1,0x18,2,2,
-2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
-2,2,2,2,2,2,2,0x18,2,2,2,2,2,2,1,1,
-1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
-1,1,1,1,1,1,1,0x18,2,2,2,2,2,2,2,2,
-2,2,2,2,2,2,2,2,2,2,2,2,2,0x18,2,2,
-2,2,2,2,1,1,1,1,1,1,1,1,1,1,1,1,
-1,1,1,1,2,2,2,0x18,2,2,2,2,2,2,1,2,
-0,0,0x49,0x89,0xc9,0x109,0x149,0x189,0x1c9,0x209,0x249,0x289,0x49,0x89,0xc9,0x109,
-0x149,0x189,0x1c9,0x209,0,6,6,6,6,6,6,6,6,6,6,6,
-6,6,6,6,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,6,6,6,6,6,6,6,6,6,6,6,6,
-6,6,6,6,6,6,6,6,6,6,6,0x1b,0x1b,0x1b,0x1b,6,
-6,6,6,6,6,6,6,6,6,6,6,6,6,0x1b,0x1b,0x1b,
-0x1b,0x1b,0x1b,0x1b,0x1b,6,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
-6,0x1b,0x1b,0x17,0x17,0x17,0x17,0x17,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,6,6,6,6,6,5,5,5,5,
-5,0,0,0x58b,0x5cb,0x60b,0x64b,0x68b,0x6cb,0x70b,0x74b,0x78b,6,6,6,6,
-6,6,6,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0x18,0x18,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,5,5,5,5,0,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,0,5,5,0,5,0,0,5,0,5,5,5,
-5,5,5,5,5,5,5,0,5,5,5,5,0,5,0,5,
-0,0,0,0,0,0,5,0,0,0,0,5,0,5,0,5,
-0,5,5,5,0,5,5,0,5,0,0,5,0,5,0,5,
-0,5,0,5,0,5,5,0,5,0,0,5,5,5,5,0,
-5,5,5,5,5,5,5,0,5,5,5,5,0,5,5,5,
-5,0,5,0,5,5,5,5,5,5,5,5,5,5,0,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-0,0,0,0,0,5,5,5,0,5,5,5,5,5,0,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-0,0,0,0,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
-0,0,0,0,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
-0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0,0,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
-0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
-0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x2cb,0x2cb,0x30b,0x34b,0x38b,0x3cb,0x40b,0x44b,
-0x48b,0x4cb,0x50b,0x54b,0x54b,0,0,0,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
-0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0,0x1b,0x1b,0x1b,0x1b,
-0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
-0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0,0,0,0,0,0,0,0x1b,0x1b,
-0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
-0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
-0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0,0,0,0,0,0,0,
-0x1b,0x1b,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,0x1e45,5,5,5,5,5,5,0x645,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,0x7885,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,0x5c5,5,5,5,5,0x5c5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,0x7845,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,0x6c5,5,
+5,5,5,5,0x1e45,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+0x6c5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,0x545,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,5,5,5,5,5,5,5,5,
+5,5,5,5,5,0,0,0,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
 0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
-0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1a,0x1a,0x1a,0x1a,0x1a,
-0x1b,0x1b,0x1b,0x1b,0,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
 0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
-0x1b,0,0,0,0x1b,0x1b,0x1b,0x1b,0,0,0,0,0,0,0,0,
-0,0,0,0,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
-0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0,0,0,0,0,0,0,
-0,0,0,0,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0,0,0,0,
-0,0,0,0,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0,0,
-0,0,0,0,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0,0,0,0,
-0,0,0,0,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
-0x1b,0x1b,0x1b,0x1b,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0,0,0,
+0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0,0,0,0,0,0,0,0,
+0,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,4,4,4,4,4,4,0x17,
+0x17,5,5,5,5,5,5,5,5,5,5,5,5,4,0x17,0x17,
+0x17,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,0x49,0x89,0xc9,0x109,0x149,0x189,0x1c9,0x209,0x249,0x289,5,5,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,1,2,1,2,1,2,1,2,1,2,1,2,1,2,1,
+2,1,2,1,2,1,2,1,2,1,2,1,2,1,2,1,
+2,1,2,1,2,1,2,1,2,1,2,1,2,1,2,5,
+6,7,7,7,0x17,6,6,6,6,6,6,6,6,6,6,0x17,
+4,1,2,1,2,1,2,1,2,1,2,1,2,1,2,1,
+2,1,2,1,2,1,2,1,2,1,2,1,2,4,4,6,
+6,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,0x58a,0x5ca,0x60a,0x64a,0x68a,0x6ca,0x70a,0x74a,0x78a,
+0x54a,6,6,0x17,0x17,0x17,0x17,0x17,0x17,0,0,0,0,0,0,0,
+0,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,
+0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,4,4,4,4,4,4,4,4,
+4,0x1a,0x1a,1,2,1,2,1,2,1,2,1,2,1,2,1,
+2,2,2,1,2,1,2,1,2,1,2,1,2,1,2,1,
+2,1,2,1,2,1,2,1,2,1,2,1,2,1,2,1,
+2,1,2,1,2,1,2,1,2,1,2,1,2,1,2,1,
+2,1,2,4,2,2,2,2,2,2,2,2,1,2,1,2,
+1,1,2,1,2,1,2,1,2,4,0x1a,0x1a,1,2,1,2,
+5,1,2,1,2,2,2,1,2,1,2,1,2,1,2,1,
+2,1,2,1,2,1,2,1,2,1,2,1,1,1,1,0,
+0,1,1,1,1,1,2,1,2,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,5,0x705,5,5,5,5,5,5,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+5,4,4,2,5,5,5,5,5,6,5,5,5,6,5,5,
+5,5,6,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,8,8,6,6,8,0x1b,
+0x1b,0x1b,0x1b,0,0,0,0,0x34cb,0x344b,0x3ccb,0x37cb,0x35cb,0x3fcb,0x1b,0x1b,0x19,
+0x1b,0,0,0,0,0,0,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
 5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,0x645,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,0x17,0x17,0x17,0x17,0,
+0,0,0,0,0,0,0,8,8,5,5,5,5,5,5,5,
 5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,0x645,5,5,5,5,5,5,5,5,5,
 5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,0x685,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,8,8,8,8,8,
+8,8,8,8,8,8,8,6,0,0,0,0,0,0,0,0,
+0,0x17,0x17,0x49,0x89,0xc9,0x109,0x149,0x189,0x1c9,0x209,0x249,0x289,0,0,0,
+0,0,0,6,6,6,6,6,6,6,6,6,6,6,6,6,
+6,6,6,6,6,5,5,5,5,5,5,0x17,0x17,0x17,5,0x17,
+5,0,0,0x49,0x89,0xc9,0x109,0x149,0x189,0x1c9,0x209,0x249,0x289,5,5,5,
 5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,0xcc5,5,5,5,5,5,5,5,5,
-0xf45,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-0xf45,5,5,5,5,5,5,5,5,5,5,5,5,5,0x6c5,5,
+5,5,5,5,5,5,5,5,5,6,6,6,6,6,6,6,
+6,0x17,0x17,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,6,6,6,6,6,6,6,6,6,6,6,8,8,
+0,0,0,0,0,0,0,0,0,0,0,0x17,5,5,5,5,
 5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,0x605,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,0x605,5,5,
+5,5,5,5,5,5,5,5,5,0,0,0,6,6,6,8,
 5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,0x605,5,5,5,5,5,5,5,
 5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,0x605,5,5,5,5,5,5,5,5,
-5,5,5,5,5,0x645,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,0x785,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,
-0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,
-0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0,0x10,0,0,0,0,0,0,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,6,
+8,8,6,6,6,6,8,8,6,8,8,8,0x17,0x17,0x17,0x17,
+0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0,4,0x49,0x89,0xc9,0x109,0x149,
+0x189,0x1c9,0x209,0x249,0x289,0,0,0,0,0x17,0x17,5,5,5,5,5,
+6,4,5,5,5,5,5,5,5,5,5,0x49,0x89,0xc9,0x109,0x149,
+0x189,0x1c9,0x209,0x249,0x289,5,5,5,5,5,0,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,6,6,6,6,6,6,8,8,6,6,8,8,
+6,6,0,0,0,0,0,0,0,0,0,5,5,5,6,5,
+5,5,5,5,5,5,5,6,8,0,0,0x49,0x89,0xc9,0x109,0x149,
+0x189,0x1c9,0x209,0x249,0x289,0,0,0x17,0x17,0x17,0x17,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,4,5,5,5,5,
+5,5,0x1b,0x1b,0x1b,5,8,6,8,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,6,5,6,6,6,5,5,
+6,6,5,5,5,5,5,6,6,5,6,5,0,0,0,0,
 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,6,6,6,6,6,6,6,6,
-6,6,6,6,6,6,6,6,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,
+0,0,0,0,5,5,4,0x17,0x17,5,5,5,5,5,5,5,
+5,5,5,5,8,6,6,8,8,0x17,0x17,5,4,4,8,6,
+0,0,0,0,0,0,0,0,0,5,5,5,5,5,5,0,
+0,5,5,5,5,5,5,0,0,5,5,5,5,5,5,0,
+0,0,0,0,0,0,0,0,5,5,5,5,5,5,5,0,
+5,5,5,5,5,5,5,0,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,0x1a,4,4,4,4,2,2,2,2,2,2,0,0,
+0,0,0,0,0,0,0,0,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,8,8,6,8,8,
+6,8,8,0x17,8,6,0,0,0x49,0x89,0xc9,0x109,0x149,0x189,0x1c9,0x209,
+0x249,0x289,0,0,0,0,0,0,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,0,0,0,0,
+0,0,0,0,0,0,0,0,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,0,0,0,0,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,0,0,0,
+0,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,
+0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,
+0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,
+0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,
+0x12,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,
+0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,
 0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,
-0x11,0x11,0x11,0x11,0x11,0x11,0,0,0,0,0,0
+0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,
+0x11,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,0x605,5,5,5,
+5,5,5,5,0x7c5,5,5,5,5,0x5c5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,0x6c5,5,0x6c5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,0x7c5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,0,0,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,2,2,2,2,2,2,2,0,
+0,0,0,0,0,0,0,0,0,0,0,2,2,2,2,2,
+0,0,0,0,0,5,6,5,5,5,5,5,5,5,5,5,
+5,0x18,5,5,5,5,5,5,5,5,5,5,5,5,5,0,
+5,5,5,5,5,0,5,0,5,5,0,5,5,0,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,
+0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,0x15,0x14,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,0,0,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,5,
+5,5,5,5,5,5,5,5,5,5,5,0x19,0x1b,0,0,6,
+6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,0x17,
+0x17,0x17,0x17,0x17,0x17,0x17,0x14,0x15,0x17,0,0,0,0,0,0,6,
+6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,0x17,
+0x13,0x13,0x16,0x16,0x14,0x15,0x14,0x15,0x14,0x15,0x14,0x15,0x14,0x15,0x14,0x15,
+0x17,0x17,0x14,0x15,0x17,0x17,0x17,0x17,0x16,0x16,0x16,0x17,0x17,0x17,0,0x17,
+0x17,0x17,0x17,0x13,0x14,0x15,0x14,0x15,0x14,0x15,0x17,0x17,0x17,0x18,0x13,0x18,
+0x18,0x18,0,0x17,0x19,0x17,0x17,0,0,0,0,5,5,5,5,5,
+0,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,0,0,
+0x10,0,0x17,0x17,0x17,0x19,0x17,0x17,0x17,0x14,0x15,0x17,0x18,0x17,0x13,0x17,
+0x17,0x49,0x89,0xc9,0x109,0x149,0x189,0x1c9,0x209,0x249,0x289,0x17,0x17,0x18,0x18,0x18,
+0x17,0x17,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,0x14,0x17,0x15,0x1a,
+0x16,0x1a,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,0x14,0x18,0x15,0x18,
+0x14,0x15,0x17,0x14,0x15,0x17,0x17,5,5,5,5,5,5,5,5,5,
+5,4,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+4,4,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,0,0,5,5,5,5,5,5,0,0,5,5,5,5,5,
+5,0,0,5,5,5,5,5,5,0,0,5,5,5,0,0,
+0,0x19,0x19,0x18,0x1a,0x1b,0x19,0x19,0,0x1b,0x18,0x18,0x18,0x18,0x1b,0x1b,
+0,0,0,0,0,0,0,0,0,0,0x10,0x10,0x10,0x1b,0x1b,0,
+0,5,5,5,5,5,5,5,5,5,5,5,0,5,5,0,
+5,0x17,0x17,0x17,0,0,0,0,0x58b,0x5cb,0x60b,0x64b,0x68b,0x6cb,0x70b,0x74b,
+0x78b,0x7cb,0xa4b,0xccb,0xf4b,0x11cb,0x144b,0x16cb,0x194b,0x1bcb,0x1e4b,0x800b,0x880b,0x900b,0x980b,0xa00b,
+0xa80b,0xb00b,0xb80b,0x784b,0x804b,0x884b,0x904b,0x984b,0xa04b,0xa84b,0xb04b,0xb84b,0x788b,0x808b,0x888b,0x908b,
+0x988b,0xa08b,0xa88b,0xb08b,0xb88b,0,0,0,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
+0x1b,0x34ca,0x344a,0x58a,0x68a,0x11ca,0x980a,0x984a,0x988a,0x68a,0x7ca,0x11ca,0x1e4a,0x980a,0x784a,0x984a,
+0x68a,0x7ca,0x11ca,0x1e4a,0x980a,0x784a,0x788a,0x988a,0x7ca,0x58a,0x58a,0x58a,0x5ca,0x5ca,0x5ca,0x5ca,
+0x68a,0x7ca,0x7ca,0x7ca,0x7ca,0x7ca,0xcca,0x11ca,0x11ca,0x11ca,0x11ca,0x1e4a,0x880a,0x980a,0x980a,0x980a,
+0x980a,0x784a,0x984a,0x68a,0x11ca,0x344b,0x344b,0x388b,0x3ccb,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
+0x1b,0x1b,0x1b,0x54b,0x34cb,0x1b,0,0,0,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
+0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,6,0,0,6,0x58b,0x5cb,0x60b,0x64b,0x68b,0x6cb,
+0x70b,0x74b,0x78b,0x7cb,0xa4b,0xccb,0xf4b,0x11cb,0x144b,0x16cb,0x194b,0x1bcb,0x1e4b,0x800b,0x880b,0x900b,
+0x980b,0xa00b,0xa80b,0xb00b,0xb80b,0,0,0,0,0x58b,0x68b,0x7cb,0x11cb,0,0,0,
+0,0,0,0,0,0,0,0,0,5,0x1bca,5,5,5,5,5,
+5,5,5,0xb80a,0,0,0,0,0,5,5,5,5,5,5,6,
+6,6,6,6,0,0,0,0,0,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,0,0x17,0x58a,0x5ca,0x7ca,0xa4a,0x1e4a,0,0,
+0,0,0,0,0,0,0,0,5,5,5,5,0,0,0,0,
+0,0,0,0,0,0,0,0x17,5,5,5,5,5,5,0,0,
+5,0,5,5,5,5,5,5,0,5,5,0,0,0,5,0,
+0,5,5,5,5,5,5,0,0x17,0x58b,0x5cb,0x60b,0x7cb,0xa4b,0x1e4b,0x784b,
+0x788b,5,5,5,5,5,5,5,0x1b,0x1b,0x58b,0x5cb,0x60b,0x64b,0x68b,0x7cb,
+0xa4b,0,0,0,0,0,0,0,0x58b,0x5cb,0x60b,0x64b,0x64b,0x68b,0x7cb,0xa4b,
+0x1e4b,5,5,5,0,5,5,0,0,0,0,0,0x58b,0x68b,0x7cb,0xa4b,
+0x1e4b,5,5,5,5,5,5,0x58b,0x7cb,0xa4b,0x1e4b,0x5cb,0x60b,0,0,0,
+0x17,5,5,5,5,5,5,5,5,5,5,0,0,0,0,0,
+0x17,5,5,5,5,5,5,5,5,0,0,0,0,0x5ecb,0x344b,5,
+5,0,0,0x1e4b,0x800b,0x880b,0x900b,0x980b,0xa00b,0xa80b,0xb00b,0xb80b,0x784b,0x804b,0x884b,0x904b,
+0x984b,0xa04b,0xa84b,0xb04b,0xb84b,0x788b,0x808b,0x888b,0x908b,0x988b,0xa08b,0xa88b,0xb08b,0xb88b,0x78cb,0x80cb,
+0x88cb,0x90cb,0x98cb,0xa0cb,0xa8cb,0xb0cb,0xb8cb,0x36cb,0x354b,0x34cb,0x348b,0x46cb,0x344b,0x4ecb,0x388b,0x3ccb,
+0x454b,5,6,6,6,0,6,6,0,0,0,0,0,6,6,6,
+6,5,5,5,5,0,0,0,0,6,6,6,0,0,0,0,
+6,0x30b,0x34b,0x38b,0x3cb,0x7cb,0xa4b,0x1e4b,0x784b,0,0,0,0,0,0,0,
+0,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0,0,0,0,0,0,
+0,5,5,5,5,5,5,5,5,5,5,5,5,5,0x58b,0x11cb,
+0x17,5,5,5,5,5,5,5,5,5,5,5,5,5,0x58b,0x7cb,
+0xa4b,5,5,5,5,5,5,5,5,0x1b,5,5,5,5,5,5,
+5,6,6,0,0,0,0,0x58b,0x68b,0x7cb,0xa4b,0x1e4b,0x17,0x17,0x17,0x17,
+0x17,0x17,0x17,0,0,0,0,0,0,0,0,0,5,5,5,5,
+5,5,0,0,0,0x17,0x17,0x17,0x17,0x17,0x17,0x17,5,5,5,5,
+5,5,0,0,0x58b,0x5cb,0x60b,0x64b,0x7cb,0xa4b,0x1e4b,0x784b,5,5,5,0,
+0,0,0,0,0x58b,0x5cb,0x60b,0x64b,0x7cb,0xa4b,0x1e4b,0x784b,5,5,0,0,
+0,0,0,0,0,0x17,0x17,0x17,0x17,0,0,0,0,0,0,0,
+0,0,0x58b,0x5cb,0x60b,0x64b,0x7cb,0xa4b,0x1e4b,1,1,1,0,0,0,0,
+0,0,0,0,0,0,0,0,0,2,2,2,0,0,0,0,
+0,0,0,0x58b,0x68b,0x7cb,0x11cb,0x1e4b,0x784b,0x194b,0x1bcb,0x1e4b,0x800b,0x880b,0x900b,0x980b,
+0xa00b,0xa80b,0xb00b,0xb80b,0x344b,0x34cb,0x348b,0x388b,0,6,6,6,6,6,6,6,
+0x17,0x17,0x17,0x17,0x17,0x17,0x17,0,0,0x30b,0x34b,0x38b,0x3cb,0x40b,0x44b,0x48b,
+0x4cb,0x50b,0x7cb,0xa4b,0xccb,0xf4b,0x11cb,0x144b,0x16cb,0x194b,0x1bcb,0x1e4b,0x784b,0x49,0x89,0xc9,
+0x109,0x149,0x189,0x1c9,0x209,0x249,0x289,8,8,8,6,6,6,6,8,8,
+6,6,0x17,0x17,0x10,0x17,0x17,6,6,6,5,5,5,5,5,5,
+5,5,5,5,5,5,5,6,6,6,6,6,8,6,6,6,
+6,6,0,0x49,0x89,0xc9,0x109,0x149,0x189,0x1c9,0x209,0x249,0x289,0x17,0x17,0x17,
+0x17,0,0,0,0,0,0,0,0,0,0,0,0,5,5,5,
+6,0x17,0x17,5,0,0,0,0,0,0,0,0,0,5,5,5,
+8,8,8,6,6,6,6,6,6,6,6,6,8,5,5,5,
+5,0x17,0x17,0x17,0x17,0x17,6,6,6,0x17,0,0,0x49,0x89,0xc9,0x109,
+0x149,0x189,0x1c9,0x209,0x249,0x289,5,0x17,5,0x17,0x17,0x17,0x16cb,0x194b,0x1bcb,0x1e4b,
+0x784b,0,0,0,0,0,0,0,0,0,0,0,5,5,5,5,
+5,5,5,5,5,5,5,5,8,8,8,6,6,8,8,6,
+8,6,6,0x17,0x17,0x17,0x17,0x17,0x17,0,0,5,5,5,5,5,
+5,5,0,5,0,5,5,5,5,0,5,5,5,5,5,5,
+5,5,5,0x17,0,0,0,0,0,0,8,8,8,6,6,6,
+6,6,6,6,6,0,0,0,0,0,6,6,8,8,0,5,
+5,5,5,5,5,5,5,0,0,5,6,8,8,8,8,0,
+0,8,8,0,0,8,8,8,0,0,5,0,0,0,0,0,
+0,8,0,0,0,0,0,5,5,5,8,8,0,0,6,6,
+6,6,6,6,6,0,0,0,8,8,8,6,6,6,6,6,
+6,8,6,8,8,8,8,6,8,6,6,5,5,0x17,5,0,
+0,0,0,0,0,0,0,8,8,6,6,6,6,0,0,8,
+8,8,8,6,6,8,6,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,
+0x17,0x17,0x17,0x17,0x17,0x17,5,5,5,5,6,6,0,0,8,8,
+8,6,6,6,6,6,6,6,6,8,8,6,8,6,0x17,0x17,
+0x17,5,0,0,0,0,0,0,0,0,0,0,0,5,5,5,
+5,5,5,5,5,5,5,5,6,8,6,8,8,6,6,6,
+6,6,6,8,6,0,0,0,0,0,0,0,0,8,8,6,
+6,6,6,8,6,6,6,6,6,0,0,0,0,0x49,0x89,0xc9,
+0x109,0x149,0x189,0x1c9,0x209,0x249,0x289,0x7cb,0xa4b,0x17,0x17,0x17,0x1b,0x49,0x89,0xc9,
+0x109,0x149,0x189,0x1c9,0x209,0x249,0x289,0x7cb,0xa4b,0xccb,0xf4b,0x11cb,0x144b,0x16cb,0x194b,0x1bcb,
+0,0,0,0,0,0,0,0,0,0,0,0,5,0x5ca,0x60a,0x64a,
+0x68a,0x6ca,0x70a,0x74a,0x78a,0x60a,0x64a,0x68a,0x6ca,0x70a,0x74a,0x78a,0x64a,0x68a,0x6ca,0x70a,
+0x74a,0x78a,0x58a,0x5ca,0x60a,0x64a,0x68a,0x6ca,0x70a,0x74a,0x78a,0x58a,0x5ca,0x60a,0x64a,0x68a,
+0x5ca,0x60a,0x60a,0x64a,0x68a,0x6ca,0x70a,0x74a,0x78a,0x58a,0x5ca,0x60a,0x60a,0x64a,0x68a,0xc08a,
+0xc18a,0x58a,0x5ca,0x60a,0x60a,0x64a,0x68a,0x60a,0x60a,0x64a,0x64a,0x64a,0x64a,0x6ca,0x70a,0x70a,
+0x70a,0x74a,0x74a,0x78a,0x78a,0x78a,0x78a,0x5ca,0x60a,0x64a,0x68a,0x6ca,0x58a,0x5ca,0x60a,0x64a,
+0x64a,0x68a,0x68a,0x5ca,0x60a,0x58a,0x5ca,0x348a,0x388a,0x454a,0x348a,0x388a,0x35ca,0x34ca,0x354a,0x34ca,
+0x34ca,0x344a,0x348a,0x388a,0xf4a,0x11ca,0x64a,0x68a,0x6ca,0x70a,0x74a,0x78a,0,0x17,0x17,0x17,
+0x17,0x17,0,0,0,0,0,0,0,0,0,0,0,6,6,6,
+6,6,0x17,0,0,0,0,0,0,0,0,0,0,6,6,6,
+6,6,6,6,0x17,0x17,0x17,0x17,0x17,0x1b,0x1b,0x1b,0x1b,4,4,4,
+4,0x17,0x1b,0,0,0,0,0,0,0,0,0,0,0x49,0x89,0xc9,
+0x109,0x149,0x189,0x1c9,0x209,0x249,0x289,0,0x7cb,0x1e4b,0x788b,0x790b,0x798b,0x7a0b,0x7a8b,0,
+5,5,5,5,5,5,5,5,5,5,5,5,5,8,8,8,
+8,8,8,8,8,8,8,8,8,8,8,8,8,0,6,6,
+6,4,4,4,4,4,4,4,4,4,4,4,4,4,5,5,
+5,5,5,5,5,5,5,5,0,0,0x1b,6,6,0x17,0x10,0x10,
+0x10,0x10,0,0,0,0,0,0,0,0,0,0,0,0,0x1b,0x1b,
+0x1b,0x1b,0x1b,8,8,6,6,6,0x1b,0x1b,0x1b,8,8,8,0x10,0x10,
+0x10,0x10,0x10,0x10,0x10,0x10,6,6,6,6,6,0x1b,0x1b,6,6,6,
+6,6,6,6,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,6,6,
+6,6,0x1b,0x1b,6,6,6,0x1b,0,0,0,0,0,0,0,0,
+0,0,0x194b,0x1bcb,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,2,2,2,2,1,1,1,1,1,1,1,1,1,1,
+1,1,2,2,2,2,2,0,2,2,2,2,2,2,2,2,
+2,2,2,2,1,0,1,1,0,0,1,0,0,1,1,0,
+0,1,1,1,1,0,1,1,1,1,1,1,2,2,2,2,
+0,2,0,2,2,2,2,1,1,0,1,1,1,1,0,0,
+1,1,1,1,1,0,1,1,1,1,1,1,1,0,2,2,
+2,2,2,2,2,2,1,1,0,1,1,1,1,0,1,1,
+1,1,1,0,1,0,0,0,1,1,1,1,1,1,2,2,
+2,2,2,2,2,2,2,2,2,2,1,1,1,1,2,2,
+2,2,2,2,0,0,1,1,1,1,1,1,1,1,0x18,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,1,1,1,
+1,1,1,1,1,1,1,1,0x18,2,2,2,2,2,0x18,2,
+2,2,2,2,2,1,1,1,1,1,1,1,1,1,0x18,2,
+2,2,2,2,2,0x18,2,2,2,2,2,2,1,2,0,0,
+0x49,0x89,0xc9,0x109,0x149,0x189,0x1c9,0x209,0x249,0x289,0x49,0x89,0xc9,0x109,0x149,0x189,
+0x1c9,0x209,0x249,0x289,0x49,0x89,0xc9,0x109,6,6,6,6,6,6,6,0x1b,
+0x1b,0x1b,0x1b,6,6,6,6,6,6,6,6,6,6,6,6,6,
+0x1b,0x1b,0x1b,0x1b,0x1b,6,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
+6,0x1b,0x1b,0x17,0x17,0x17,0x17,0x17,0,0,0,0,5,5,5,5,
+5,0,0,0x58b,0x5cb,0x60b,0x64b,0x68b,0x6cb,0x70b,0x74b,0x78b,0,5,5,0,
+5,0,0,5,0,5,5,5,5,5,5,5,0,5,5,5,
+5,0,5,0,5,0,0,0,0,5,0,0,0,0,5,0,
+5,0,5,0,5,5,5,0,5,5,0,5,0,0,5,0,
+5,0,5,0,5,0,5,5,0,5,0,0,5,5,5,5,
+0,5,5,5,5,0,5,5,5,5,0,5,0,5,5,5,
+0,5,5,5,5,5,0,5,5,5,5,5,0x18,0x18,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0x2cb,0x2cb,0x30b,0x34b,
+0x38b,0x3cb,0x40b,0x44b,0x48b,0x4cb,0x50b,0x54b,0x54b,0,0,0,0x1b,0x1b,0x1b,0x1b,
+0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1a,0x1a,0x1a,0x1a,0x1a,5,5,5,0xcc5,
+5,5,5,5,5,5,5,5,0xf45,5,5,5,5,5,5,5,
+5,5,5,5,5,0xf45,5,5,5,0,0x10,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0x10,0x10,0x10,0x10,0x10,0x10,0x10,
+0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x11,0x11,0x11,0x11,0x11,0x11,0x11,
+0x11,0x11,0x11,0x11,0x11,0x11,0x11,0,0,0,0
 };
 
-static const UTrie2 propsTrie={
+static const UCPTrie propsTrie={
     propsTrie_index,
-    propsTrie_index+4216,
-    NULL,
-    4216,
-    15604,
-    0xa40,
-    0x10f8,
-    0x0,
-    0x0,
+    { propsTrie_data16 },
+    4232,
+    15803,
     0x110000,
-    0x4d68,
-    NULL, 0, FALSE, FALSE, 0, NULL
+    0,
+    0,
+    0, NULL
 };
 
-static const uint16_t propsVectorsTrie_index[27272]={
-0x488,0x490,0x498,0x4a0,0x4b8,0x4c0,0x4c8,0x4d0,0x4d8,0x4e0,0x4e8,0x4f0,0x4f8,0x500,0x508,0x510,
-0x517,0x51f,0x527,0x52f,0x532,0x53a,0x542,0x54a,0x552,0x55a,0x562,0x56a,0x572,0x57a,0x582,0x58a,
-0x592,0x59a,0x5a1,0x5a9,0x5b1,0x5b9,0x5c1,0x5c9,0x5d1,0x5d9,0x5de,0x5e6,0x5ed,0x5f5,0x5fd,0x605,
-0x60d,0x615,0x61d,0x625,0x62c,0x634,0x63c,0x644,0x64c,0x654,0x65c,0x664,0x66c,0x674,0x67c,0x684,
-0x17f7,0xce8,0xdd0,0x4a8,0x4a8,0xe4f,0xe55,0xe5d,0x10f0,0x1108,0x10f8,0x1100,0x71c,0x722,0x72a,0x732,
-0x73a,0x740,0x748,0x750,0x758,0x75e,0x766,0x76e,0x776,0x77c,0x784,0x78c,0x794,0x79c,0x7a4,0x7ab,
-0x7b3,0x7b9,0x7c1,0x7c9,0x7d1,0x7d7,0x7df,0x7e7,0x7ef,0x7f5,0x7fd,0x805,0x80d,0x814,0x81c,0x824,
-0x82c,0x830,0x838,0x83f,0x847,0x84f,0x857,0x85f,0x140a,0x1412,0x867,0x86f,0x877,0x87f,0x887,0x88e,
-0x1470,0x1460,0x1468,0x173a,0x1742,0x1118,0x896,0x1110,0x1357,0x1357,0x1359,0x112c,0x112d,0x1120,0x1122,0x1124,
-0x1478,0x147a,0x89e,0x147a,0x8a6,0x8ab,0x8b3,0x147f,0x8b9,0x147a,0x8bf,0x8c7,0xbc1,0x1487,0x1487,0x8cf,
-0x1497,0x1498,0x1498,0x1498,0x1498,0x1498,0x1498,0x1498,0x1498,0x1498,0x1498,0x1498,0x1498,0x1498,0x1498,0x1498,
-0x1498,0x1498,0x1498,0x148f,0x8d7,0x14a0,0x14a0,0x8df,0xad6,0xade,0xae6,0xaee,0x14b0,0x14a8,0x8e7,0x8ef,
-0x8f7,0x14b8,0x14c0,0x8ff,0x14b8,0x907,0x17ff,0xcf0,0xaf6,0xafe,0xb06,0xb0b,0x16b0,0xbf4,0xbfb,0x1618,
-0xb91,0x1807,0xcf8,0xd00,0xd08,0xd10,0xf0d,0xf0d,0x1700,0x1705,0xc2c,0xc34,0x1776,0x177e,0x18a0,0xdd8,
-0x1786,0xc7c,0xc84,0x178e,0x4a8,0x4a8,0xeed,0xd18,0x1638,0x1620,0x1630,0x1628,0x16c8,0x16c0,0x1688,0xba1,
-0x1135,0x1135,0x1135,0x1135,0x1138,0x1135,0x1135,0x1140,0x90f,0x1148,0x913,0x91b,0x1148,0x923,0x92b,0x933,
-0x1158,0x1150,0x1160,0x93b,0x943,0x94b,0x953,0x95b,0x1168,0x1170,0x1178,0x1180,0x963,0x1188,0x118f,0x1197,
-0x119f,0x11a7,0x11af,0x11b7,0x11bf,0x11c6,0x11ce,0x11d6,0x11de,0x11e6,0x11e9,0x11eb,0x14c8,0x15ae,0x15b4,0x96b,
-0x11f3,0x973,0x97b,0x130c,0x1311,0x1314,0x131a,0x11fb,0x1322,0x1322,0x120b,0x1203,0x1213,0x121b,0x1223,0x122b,
-0x1233,0x123b,0x1243,0x124b,0x15bc,0x1610,0x174a,0x1888,0x125b,0x1261,0x1269,0x1271,0x1253,0x1279,0x15c4,0x15cb,
-0x14d0,0x14d0,0x14d0,0x14d0,0x14d0,0x14d0,0x14d0,0x14d0,0x15d3,0x15d3,0x15d3,0x15d3,0x15db,0x15e2,0x15e4,0x15eb,
-0x15f3,0x15f7,0x15f7,0x15fa,0x15f7,0x15f7,0x1600,0x15f7,0x1640,0x16f8,0x1752,0xb13,0xb19,0xb1f,0xb27,0xb2c,
-0x16a0,0xbd1,0xbd5,0x170d,0x1690,0x1690,0x1690,0xba9,0x1698,0xbc9,0x16e0,0xc1c,0xbb1,0xbb9,0xbb9,0x1796,
-0x16d0,0x175a,0xc0b,0xc0c,0x983,0x14d8,0x14d8,0x98b,0x14e0,0x14e0,0x14e0,0x14e0,0x14e0,0x14e0,0x993,0x68c,
-0x133f,0x1361,0x99b,0x1369,0x9a3,0x1371,0x1379,0x1381,0x9ab,0x9b0,0x1389,0x1390,0x9b5,0x9bd,0x16f0,0xb99,
-0x9c5,0x13e7,0x13ee,0x1398,0x13f6,0x13fa,0x13a0,0x9cd,0x13b9,0x13b9,0x13bb,0x13a8,0x13b0,0x13b0,0x13b1,0x1402,
-0x14e8,0x14e8,0x14e8,0x14e8,0x14e8,0x14e8,0x14e8,0x14e8,0x14e8,0x14e8,0x14e8,0x14e8,0x14e8,0x14e8,0x14e8,0x14e8,
-0x14e8,0x14e8,0x14e8,0x14e8,0x14e8,0x14e8,0x14e8,0x14e8,0x14e8,0x14e8,0x14e8,0x14e8,0x14e8,0x14e8,0x14e8,0x14e8,
-0x14e8,0x14e8,0x14e8,0x14e8,0x14e8,0x14e8,0x14e8,0x14e8,0x14e8,0x14e8,0x14e8,0x14e8,0x14e8,0x14e8,0x14e8,0x14e8,
-0x14e8,0x14e8,0x14e8,0x14e8,0x14e8,0x14e8,0x14e8,0x14e8,0x14e8,0x14e8,0x14e8,0x14e8,0x14e8,0x14e8,0x14e8,0x14e8,
-0x14e8,0x14e8,0x14e8,0x14e8,0x14e8,0x14e8,0x14e8,0x14e8,0x14e8,0x14e8,0x14e8,0x14e8,0x14e8,0x14e8,0x14e8,0x14e8,
-0x14e8,0x14e8,0x14e8,0x14e8,0x14e8,0x14e8,0x14e8,0x14e8,0x14e8,0x14e8,0x14e8,0x14e8,0x14e8,0x14e8,0x14e8,0x14e8,
-0x14e8,0x14e8,0x14e8,0x14e8,0x14e8,0x14e8,0x14e8,0x14e8,0x14e8,0x14e8,0x14e8,0x14e8,0x14e8,0x14e8,0x14e8,0x14e8,
-0x14e8,0x14e8,0x14e8,0x14e8,0x14e8,0x14e8,0x14e8,0x14e8,0x14e8,0x14e8,0x14e8,0x14e8,0x14e8,0x14e8,0x14e8,0x14e8,
-0x14e8,0x14e8,0x14e8,0x14e8,0x14e8,0x14e8,0x14e8,0x14e8,0x14e8,0x14e8,0x14e8,0x14e8,0x14e8,0x14e8,0x14e8,0x14e8,
-0x14e8,0x14e8,0x14e8,0x14e8,0x14e8,0x14e8,0x14e8,0x14e8,0x14e8,0x14e8,0x14e8,0x14e8,0x14e8,0x14e8,0x14e8,0x14e8,
-0x14e8,0x14e8,0x14e8,0x14e8,0x14e8,0x14e8,0x14e8,0x14e8,0x14e8,0x14e8,0x14e8,0x14e8,0x14e8,0x14e8,0x14e8,0x14e8,
-0x14e8,0x14e8,0x14e8,0x14e8,0x14e8,0x14e8,0x14e8,0x14e8,0x14e8,0x14e8,0x14e8,0x14e8,0x14e8,0x14e8,0x14e8,0x14e8,
-0x14e8,0x14e8,0x14e8,0x14e8,0x14e8,0x14e8,0x14e8,0x14e8,0x14e8,0x14e8,0x14e8,0x14e8,0x14e8,0x10a7,0x1648,0x1648,
-0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,
-0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,
-0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,
-0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,
-0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,
-0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,
-0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,
-0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,
-0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,
-0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,
-0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,
-0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,
-0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,
-0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,
-0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,
-0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,
-0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,
-0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,
-0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,
-0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,
-0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,
-0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,
-0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,
-0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,
-0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,
-0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,
-0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,
-0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,
-0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,
-0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,
-0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,
-0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,
-0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,
-0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,
-0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,
-0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,
-0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,
-0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,
-0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,
-0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,
-0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13c3,0x13ca,0x10af,0x10b5,
-0x14f0,0x14f6,0x14f6,0x14f6,0x14f6,0x14f6,0x14f6,0x14f6,0x14f6,0x14f6,0x14f6,0x14f6,0x14f6,0x14f6,0x14f6,0x14f6,
-0x14f6,0x14f6,0x14f6,0x14f6,0x14f6,0x14f6,0x14f6,0x14f6,0x14f6,0x14f6,0x14f6,0x14f6,0x14f6,0x14f6,0x14f6,0x14f6,
-0x14f6,0x14f6,0x14f6,0x14f6,0x9d5,0x14fe,0x9dd,0x180f,0x17a2,0x17a2,0x17a2,0x17a2,0x17a2,0x17a2,0x17a2,0x17a2,
-0x179e,0xc8c,0x17b2,0x17aa,0x17b4,0x1817,0x1817,0xd20,0x16a8,0x1715,0x176a,0x176e,0x1762,0xc3c,0xc42,0xc45,
-0x16d8,0xc14,0x171d,0xc4d,0x17bc,0x17bf,0xc94,0xd28,0x17cf,0x17c7,0xc9c,0xd30,0x181f,0x1823,0xd38,0xfb3,
-0x17d7,0xca4,0xcac,0x182b,0x183b,0x1833,0xd40,0xeb0,0xde0,0xde8,0x19bc,0xf6b,0x1a61,0x1a61,0x1843,0xd48,
-0x1452,0x1453,0x1454,0x1455,0x1456,0x1457,0x1458,0x1452,0x1453,0x1454,0x1455,0x1456,0x1457,0x1458,0x1452,0x1453,
-0x1454,0x1455,0x1456,0x1457,0x1458,0x1452,0x1453,0x1454,0x1455,0x1456,0x1457,0x1458,0x1452,0x1453,0x1454,0x1455,
-0x1456,0x1457,0x1458,0x1452,0x1453,0x1454,0x1455,0x1456,0x1457,0x1458,0x1452,0x1453,0x1454,0x1455,0x1456,0x1457,
-0x1458,0x1452,0x1453,0x1454,0x1455,0x1456,0x1457,0x1458,0x1452,0x1453,0x1454,0x1455,0x1456,0x1457,0x1458,0x1452,
-0x1453,0x1454,0x1455,0x1456,0x1457,0x1458,0x1452,0x1453,0x1454,0x1455,0x1456,0x1457,0x1458,0x1452,0x1453,0x1454,
-0x1455,0x1456,0x1457,0x1458,0x1452,0x1453,0x1454,0x1455,0x1456,0x1457,0x1458,0x1452,0x1453,0x1454,0x1455,0x1456,
-0x1457,0x1458,0x1452,0x1453,0x1454,0x1455,0x1456,0x1457,0x1458,0x1452,0x1453,0x1454,0x1455,0x1456,0x1457,0x1458,
-0x1452,0x1453,0x1454,0x1455,0x1456,0x1457,0x1458,0x1452,0x1453,0x1454,0x1455,0x1456,0x1457,0x1458,0x1452,0x1453,
-0x1454,0x1455,0x1456,0x1457,0x1458,0x1452,0x1453,0x1454,0x1455,0x1456,0x1457,0x1458,0x1452,0x1453,0x1454,0x1455,
-0x1456,0x1457,0x1458,0x1452,0x1453,0x1454,0x1455,0x1456,0x1457,0x1458,0x1452,0x1453,0x1454,0x1455,0x1456,0x1457,
-0x1458,0x1452,0x1453,0x1454,0x1455,0x1456,0x1457,0x1458,0x1452,0x1453,0x1454,0x1455,0x1456,0x1457,0x1458,0x1452,
-0x1453,0x1454,0x1455,0x1456,0x1457,0x1458,0x1452,0x1453,0x1454,0x1455,0x1456,0x1457,0x1458,0x1452,0x1453,0x1454,
-0x1455,0x1456,0x1457,0x1458,0x1452,0x1453,0x1454,0x1455,0x1456,0x1457,0x1458,0x1452,0x1453,0x1454,0x1455,0x1456,
-0x1457,0x1458,0x1452,0x1453,0x1454,0x1455,0x1456,0x1457,0x1458,0x1452,0x1453,0x1454,0x1455,0x1456,0x1457,0x1458,
-0x1452,0x1453,0x1454,0x1455,0x1456,0x1457,0x1458,0x1452,0x1453,0x1454,0x1455,0x1456,0x1457,0x1458,0x1452,0x1453,
-0x1454,0x1455,0x1456,0x1457,0x1458,0x1452,0x1453,0x1454,0x1455,0x1456,0x1457,0x1458,0x1452,0x1453,0x1454,0x1455,
-0x1456,0x1457,0x1458,0x1452,0x1453,0x1454,0x1455,0x1456,0x1457,0x1458,0x1452,0x1453,0x1454,0x1455,0x1456,0x1457,
-0x1458,0x1452,0x1453,0x1454,0x1455,0x1456,0x1457,0x1458,0x1452,0x1453,0x1454,0x1455,0x1456,0x1457,0x1458,0x1452,
-0x1453,0x1454,0x1455,0x1456,0x1457,0x1458,0x1452,0x1453,0x1454,0x1455,0x1456,0x1457,0x1458,0x1452,0x1453,0x1454,
-0x1455,0x1456,0x1457,0x1458,0x1452,0x1453,0x1454,0x1455,0x1456,0x1457,0x1458,0x1452,0x1453,0x1454,0x1455,0x1456,
-0x1457,0x1458,0x1452,0x1453,0x1454,0x1455,0x1456,0x1457,0x1458,0x1452,0x1453,0x1454,0x1455,0x1456,0x1457,0x1458,
-0x1452,0x1453,0x1454,0x1455,0x1456,0x1457,0x1458,0x1452,0x1453,0x1454,0x1455,0x1456,0x1457,0x9e5,0xd50,0xd53,
-0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,
-0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,
-0x142a,0x142a,0x142a,0x142a,0x142a,0x142a,0x142a,0x142a,0x142a,0x142a,0x142a,0x142a,0x142a,0x142a,0x142a,0x142a,
-0x142a,0x142a,0x142a,0x142a,0x142a,0x142a,0x142a,0x142a,0x142a,0x142a,0x142a,0x142a,0x142a,0x142a,0x142a,0x142a,
-0x132a,0x132a,0x132a,0x132a,0x132a,0x132a,0x132a,0x132a,0x132a,0x132a,0x132a,0x132a,0x132a,0x132a,0x132a,0x132a,
-0x132a,0x132a,0x132a,0x132a,0x132a,0x132a,0x132a,0x132a,0x132a,0x132a,0x132a,0x132a,0x132a,0x132a,0x132a,0x132a,
-0x132a,0x132a,0x132a,0x132a,0x132a,0x132a,0x132a,0x132a,0x132a,0x132a,0x132a,0x132a,0x132a,0x132a,0x132a,0x132a,
-0x132a,0x132a,0x132a,0x132a,0x132a,0x132a,0x132a,0x132a,0x132a,0x132a,0x132a,0x132a,0x132a,0x132a,0x132a,0x132a,
-0x132a,0x132a,0x132a,0x132a,0x132a,0x132a,0x132a,0x132a,0x132a,0x132a,0x132a,0x132a,0x132a,0x132a,0x132a,0x132a,
-0x132a,0x132a,0x132a,0x132a,0x132a,0x132a,0x132a,0x132a,0x132a,0x132a,0x132a,0x132a,0x132a,0x132a,0x132a,0x132a,
-0x132a,0x132a,0x132a,0x132a,0x132a,0x132a,0x132a,0x132a,0x132a,0x132a,0x132a,0x132a,0x132a,0x132a,0x132a,0x132a,
-0x132a,0x132a,0x132a,0x132a,0x132a,0x132a,0x132a,0x132a,0x132a,0x132a,0x132a,0x132a,0x132a,0x132a,0x132a,0x132a,
-0x132a,0x132a,0x132a,0x132a,0x132a,0x132a,0x132a,0x132a,0x132a,0x132a,0x132a,0x132a,0x132a,0x132a,0x132a,0x132a,
-0x132a,0x132a,0x132a,0x132a,0x132a,0x132a,0x132a,0x132a,0x132a,0x132a,0x132a,0x132a,0x132a,0x132a,0x132a,0x132a,
-0x132a,0x132a,0x132a,0x132a,0x132a,0x132a,0x132a,0x132a,0x132a,0x132a,0x132a,0x132a,0x132a,0x132a,0x132a,0x132a,
-0x132a,0x132a,0x132a,0x132a,0x132a,0x132a,0x132a,0x132a,0x132a,0x132a,0x132a,0x132a,0x132a,0x132a,0x132a,0x132a,
-0x132a,0x132a,0x132a,0x132a,0x132a,0x132a,0x132a,0x132a,0x13d2,0x13d2,0x13d2,0x13d2,0x13d2,0x13d2,0x13d2,0x13d2,
-0x13d7,0x13df,0x1608,0x10bd,0x16e8,0x16e8,0x10c1,0x10c8,0x9ed,0x9f5,0x9fd,0x1299,0x12a0,0x12a8,0xa05,0x12b0,
-0x12e1,0x12e1,0x1289,0x1291,0x12b8,0x12d8,0x12d9,0x12e9,0x12c0,0x1281,0xa0d,0x12c8,0xa15,0x12d0,0xa1d,0xa21,
-0xc24,0x12f1,0xa29,0xa31,0x12f9,0x12ff,0x1304,0xa39,0xa49,0x1347,0x134f,0x1332,0x1337,0xa51,0xa59,0xa41,
-0x141a,0x141a,0x141a,0x141a,0x141a,0x141a,0x141a,0x141a,0x141a,0x141a,0x141a,0x141a,0x141a,0x141a,0x141a,0x141a,
-0x141a,0x141a,0x141a,0x141a,0x141a,0x141a,0x141a,0x141a,0x141a,0x141a,0x141a,0x141a,0x1422,0x1422,0x1422,0x1422,
-0x12a0,0x12a0,0x12e0,0x1320,0x1360,0x13a0,0x13e0,0x1420,0x145c,0x149c,0x14c8,0x1508,0x1548,0x1588,0x15c8,0x1608,
-0x1648,0x1684,0x16c4,0x1704,0x1744,0x1778,0x17b4,0x17f4,0x1834,0x1874,0x18b0,0x18f0,0x1930,0x1970,0x19b0,0x19f0,
-0xa80,0xac0,0xb00,0xe48,0xb40,0xa40,0xb80,0xa40,0xe68,0xa40,0xa40,0xa40,0xa40,0xbc0,0xa40,0xa40,
-0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xdcd,0xbfd,0xa40,0xa40,0xc3d,0xc7d,0xa40,0xe0d,0xd8d,0xcbd,
-0x115e,0x115e,0x115e,0x115e,0x115e,0x115e,0x115e,0x115e,0x115e,0x115e,0x115e,0x115e,0x115e,0x115e,0x115e,0x115e,
-0x115e,0x115e,0x115e,0x115e,0xea8,0x119e,0xfde,0x101e,0x11de,0xee8,0xf1e,0xf1e,0xf1e,0xf1e,0xf1e,0xf5e,
-0xf1e,0xf1e,0xf1e,0xf1e,0xf1e,0xf1e,0xf1e,0xf1e,0xf1e,0xf1e,0xf1e,0xf1e,0xf1e,0xf1e,0xf1e,0xf1e,
-0xf1e,0xf1e,0xf1e,0xf1e,0xf1e,0xf1e,0xf1e,0xf1e,0xf1e,0xf1e,0xf1e,0xf1e,0xf1e,0xf1e,0xf1e,0xf9e,
-0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,
-0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xcfd,
-0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,
-0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xcfd,
-0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,
-0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xcfd,
-0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,
-0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xcfd,
-0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,
-0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xcfd,
-0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,
-0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xcfd,
-0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,
-0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xcfd,
-0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,
-0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xcfd,
-0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,
-0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xcfd,
-0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,
-0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xcfd,
-0xd3d,0xd4d,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,
-0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xcfd,
-0x10de,0x10de,0x10de,0x10de,0x10de,0x10de,0x10de,0x10de,0x10de,0x10de,0x10de,0x10de,0x10de,0x10de,0x10de,0x10de,
-0x10de,0x10de,0x10de,0x10de,0x10de,0x10de,0x10de,0x10de,0x10de,0x10de,0x10de,0x10de,0x10de,0x10de,0x10de,0x105e,
-0x111e,0x111e,0x111e,0x111e,0x111e,0x111e,0x111e,0x111e,0x111e,0x111e,0x111e,0x111e,0x111e,0x111e,0x111e,0x111e,
-0x111e,0x111e,0x111e,0x111e,0x111e,0x111e,0x111e,0x111e,0x111e,0x111e,0x111e,0x111e,0x111e,0x111e,0x111e,0x109e,
-0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,
-0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,
-0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,
-0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,
-0xb34,0xb3b,0xb43,0xb4b,0x1650,0x1650,0x1650,0xb53,0xb5b,0xb5e,0x1680,0x1678,0xb89,0xcb4,0xcb8,0xcbc,
-0x4a8,0x4a8,0x4a8,0x4a8,0xcc4,0x17df,0xccc,0xf05,0x1506,0xa61,0xa67,0xfc3,0xb66,0x16b8,0xc03,0x4a8,
-0x151b,0x150e,0x1513,0x1658,0xb6e,0x694,0x4a8,0x4a8,0x19a4,0xf22,0x1994,0x69c,0x4a8,0x4a8,0x4a8,0x4a8,
-0x19c4,0x19c4,0x19c4,0x19c4,0x19c4,0x19c4,0x19c4,0x19c4,0x19c4,0xf73,0xf7b,0xf83,0x4a8,0x4a8,0x4a8,0x4a8,
-0xb76,0xb79,0xd5b,0x1a0c,0xfbb,0x6a4,0x4a8,0x1054,0xc55,0xcd4,0x4a8,0x4a8,0x1961,0xeb8,0xec0,0x1a4c,
-0xbdd,0xbe4,0xbec,0x184b,0x19ec,0x4a8,0x19cc,0xf93,0x1853,0xd63,0xd6b,0xd73,0xfe3,0x6ac,0x4a8,0x4a8,
-0x185b,0x185b,0x6b4,0x4a8,0x1a79,0x106c,0x1a71,0x1074,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,
-0x4a8,0x4a8,0x4a8,0xd7b,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,
-0x18a8,0x18aa,0xdf0,0xdf7,0x186b,0x1863,0xd83,0xee5,0x1959,0xea0,0xea8,0xf8b,0x1971,0x1975,0xedd,0x1003,
-0xf56,0xf5b,0x6bc,0x4a8,0x105c,0x1064,0x19b4,0xf63,0xf38,0xf3e,0xf46,0xf4e,0x4a8,0x4a8,0x4a8,0x4a8,
-0x4a8,0x4a8,0x4a8,0x4a8,0x1a34,0x1a2c,0x102a,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x1a1c,0xfeb,0xff3,0xffb,
-0x19e4,0x19dc,0xfa3,0x4a8,0x197d,0xef5,0x6c4,0x4a8,0x103a,0x1042,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,
-0x1725,0x1725,0x1725,0x1725,0x1725,0x1725,0x1725,0x1725,0x1725,0x1725,0x1725,0x1725,0x1725,0x1725,0x1725,0x1725,
-0x1725,0x1725,0x1725,0x1725,0x1725,0x1725,0x1725,0x1725,0x1725,0x1725,0x1725,0x172a,0xc5d,0xc64,0xc64,0xc64,
-0x1732,0x1732,0x1732,0xc6c,0x1a69,0x1a69,0x1a69,0x1a69,0x1a69,0x1a69,0x6cc,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,
-0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,
-0x1873,0x1873,0x1873,0x1873,0x1873,0x1873,0x1873,0x1873,0x1873,0x1873,0x1873,0x1873,0x1873,0x1873,0x1873,0x1873,
-0x1873,0x1873,0x1875,0x1873,0x187d,0x1873,0x1873,0x1873,0x1873,0x1873,0x1873,0x1880,0x1873,0x1873,0x1873,0x1873,
-0x1873,0x6d4,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,
-0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,
-0x18b2,0x18b2,0x18b2,0x18b2,0x18b2,0x18b2,0x18b2,0x18b2,0x18b2,0x18b2,0x18b2,0x18b2,0x18b2,0x18b2,0x18b2,0x18b2,
-0x18b2,0xdff,0xfab,0x6dc,0x4a8,0x4a8,0x6e0,0xefd,0x1a04,0x19fc,0xfcb,0xfd3,0x6e8,0x4a8,0x4a8,0x4a8,
-0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,
-0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x1969,0x1969,0xec8,0xecd,0xed5,0x4a8,0x4a8,0x4a8,
-0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,
-0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x199c,0x199c,0x199c,
-0xf15,0xf1a,0x6f0,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,
-0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x1523,0x1523,0x1523,
-0x1523,0x1523,0x1523,0x1523,0xa6f,0x1533,0xa77,0x1534,0x152b,0x153c,0x1542,0x154a,0xa7f,0x1670,0x1670,0x6f8,
-0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x1660,0x1660,0xb81,0xc74,0x4a8,0x4a8,0x4a8,0x4a8,0x157b,0x1582,0xa87,
-0x1585,0xa8f,0xa97,0xa9f,0x157f,0xaa7,0xaaf,0xab7,0x1584,0x158c,0x157b,0x1582,0x157e,0x1585,0x158d,0x157c,
-0x1583,0x157f,0xabe,0x1552,0x155a,0x1561,0x1568,0x1555,0x155d,0x1564,0x156b,0xac6,0x1573,0x1a91,0x1a91,0x1a91,
-0x1a91,0x1a91,0x1a91,0x1a91,0x1a91,0x1a91,0x1a91,0x1a91,0x1a91,0x1a91,0x1a91,0x1a91,0x1a91,0x1a81,0x1a84,0x1a81,
-0x1a8b,0x108b,0x700,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,
-0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,
-0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x100b,0x1a24,0x1011,
-0x1a24,0x1019,0x101e,0x1022,0x1022,0x107c,0x1083,0x1083,0x1083,0x1081,0x1083,0x1082,0x1083,0x4a8,0x4a8,0x4a8,
-0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,
-0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,
-0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x704,0x4a8,0x4a8,0x4a8,
-0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,
-0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,
-0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,
-0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x704,0xace,0x1595,0x1595,
-0x1596,0x70c,0x70c,0x70c,0x70c,0x1668,0x1668,0x1668,0x1668,0x1668,0x1668,0x1668,0x714,0x70c,0x70c,0x70c,
-0x70c,0x70c,0x70c,0x70c,0x70c,0x70c,0x70c,0x70c,0x70c,0x70c,0x70c,0x70c,0x70c,0x70c,0x70c,0x70c,
-0x70c,0x70c,0x70c,0x70c,0x70c,0x70c,0x70c,0x70c,0x70c,0x70c,0x70c,0x70c,0x70c,0x70c,0x70c,0x70c,
-0x70c,0x70c,0x70c,0x70c,0x70c,0x70c,0x70c,0x70c,0x70c,0x70c,0x70c,0x70c,0x70c,0x70c,0x70c,0x70c,
-0x70c,0x70c,0x70c,0x70c,0x70c,0x70c,0x70c,0x70c,0x70c,0x70c,0x70c,0x70c,0x70c,0x17e7,0xcdc,0x17ef,
-0x17ef,0xce0,0xe10,0xe18,0xe20,0xd8b,0xd91,0x1890,0xd99,0xda1,0xda8,0xda8,0xdaf,0xdb7,0xdbb,0xdc3,
-0xdc8,0xdc8,0xdc8,0xdc8,0xdc8,0x18d9,0x18e1,0x18d9,0x18e7,0x18ef,0x18ba,0x18f7,0x18ff,0x18d9,0x1907,0x190f,
-0x18d9,0x18d9,0x18c2,0x18d9,0x1911,0x18ca,0x18d1,0x1919,0xe28,0x198c,0xe2f,0x1985,0x1921,0x1929,0x1931,0x1939,
-0x19f4,0x1941,0x1941,0xe37,0xe3f,0x1949,0x1949,0x1949,0xe47,0x19ac,0x19ac,0xf2a,0xf30,0xe07,0xe08,0xe08,
-0xe08,0xe08,0xe08,0xe08,0xe08,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,
-0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,
-0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,
-0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x19d4,0x19d4,0x19d4,
-0x19d4,0x19d4,0x19d4,0xf9b,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,
-0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,
-0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0xe65,0xe6d,0xe75,
-0xe7d,0xe85,0xe8d,0xe94,0xe98,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x1a44,0x1a3c,0x1032,
-0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x1a14,0xfdb,
-0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,
-0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,
-0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x1a54,0x1a54,0x1a54,0x1a54,0x1a54,0x1a54,0x1a54,0x1a54,
-0x1a54,0x1a54,0x1a54,0x1a54,0x1a54,0x1a54,0x1a59,0x1a54,0x1a54,0x1a54,0x104a,0x104c,0x4a8,0x4a8,0x4a8,0x4a8,
-0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x4a8,0x159e,0x159e,0x159e,0x159e,0x159e,0x159e,0x159e,0x159e,
-0x159e,0x159e,0x159e,0x159e,0x159e,0x159e,0x159e,0x159e,0x159e,0x159e,0x159e,0x159e,0x159e,0x159e,0x159e,0x159e,
-0x159e,0x159e,0x159e,0x159e,0x159e,0x159e,0x159e,0x159e,0x159e,0x159e,0x159e,0x159e,0x159e,0x159e,0x159e,0x159e,
-0x159e,0x159e,0x159e,0x159e,0x159e,0x159e,0x159e,0x159e,0x159e,0x159e,0x159e,0x159e,0x159e,0x159e,0x10d0,0x1093,
-0x1898,0x1898,0x1898,0x1898,0x1898,0x1898,0x1898,0x1898,0x1a99,0x1a99,0x1a99,0x1a99,0x1a99,0x1a99,0x1a99,0x1a99,
-0x1a99,0x1a99,0x1a99,0x1a99,0x1a99,0x1a99,0x1a99,0x1a99,0x1a99,0x1a99,0x1a99,0x1a99,0x1a99,0x1a99,0x1a99,0x1a99,
-0x1a99,0x1a99,0x1a99,0x1a99,0x1a99,0x1a99,0x1a99,0x1a99,0x1a99,0x1a99,0x1a99,0x1a99,0x1a99,0x1a99,0x1a99,0x1a99,
-0x1a99,0x1a99,0x1a99,0x1a99,0x1a99,0x1a99,0x1a99,0x1a99,0x1a99,0x1a99,0x1a99,0x1a99,0x1a99,0x109b,0x1093,0x1093,
-0x1093,0x1093,0x1093,0x1093,0x1093,0x1093,0x1093,0x1093,0x1093,0x1093,0x1093,0x1093,0x1093,0x1093,0x1093,0x1093,
-0x1093,0x1093,0x1093,0x1093,0x1093,0x1093,0x1093,0x1093,0x1093,0x1093,0x1093,0x1093,0x1093,0x1093,0x1093,0x1093,
-0x1093,0x1093,0x1093,0x1093,0x1093,0x1093,0x1093,0x1093,0x1093,0x1093,0x1093,0x1093,0x1093,0x1093,0x1093,0x1093,
-0x1093,0x1093,0x1093,0x1093,0x1093,0x1093,0x1093,0x1093,0x1093,0x1093,0x1093,0x1093,0x1093,0x1093,0x15a6,0x15a6,
-0x15a6,0x15a6,0x15a6,0x15a6,0x15a6,0x15a6,0x15a6,0x15a6,0x15a6,0x15a6,0x15a6,0x15a6,0x15a6,0x15a6,0x10d8,0x1093,
-0x1093,0x1093,0x1093,0x1093,0x1093,0x1093,0x1093,0x1093,0x1093,0x1093,0x1093,0x1093,0x1093,0x1093,0x1093,0x1093,
-0x1093,0x1093,0x1093,0x1093,0x1093,0x1093,0x1093,0x1093,0x1093,0x1093,0x1093,0x1093,0x1093,0x1093,0x1093,0x1093,
-0x1093,0x1093,0x1093,0x1093,0x1093,0x1093,0x1093,0x1093,0x1093,0x1093,0x1093,0x1093,0x1093,0x109f,0x1093,0x1093,
-0x1093,0x1093,0x1093,0x1093,0x1093,0x1093,0x1093,0x1093,0x1093,0x1093,0x1093,0x1093,0x1093,0x1093,0x1093,0x1093,
-0x1093,0x1093,0x1093,0x1093,0x1093,0x1093,0x1093,0x1093,0x1093,0x1093,0x1093,0x1093,0x1093,0x1093,0x1093,0x1093,
-0x1093,0x1093,0x1093,0x1093,0x1093,0x1093,0x1093,0x1093,0x1093,0x1093,0x1093,0x1093,0x1093,0x1093,0x1093,0x1093,
-0x1093,0x1093,0x1093,0x1093,0x1093,0x1093,0x1093,0x1093,0x1093,0x1093,0x1093,0x1093,0x1093,0x109f,0x1898,0x1898,
-0x1898,0x1898,0x1898,0x1898,0x1898,0x1898,0x1898,0x1898,0x1898,0x1898,0x1898,0x1898,0x1898,0x1898,0x1898,0x1898,
-0x1898,0x1898,0x1898,0x1898,0x1898,0x1898,0x1898,0x1898,0x1898,0x1898,0x1898,0x1898,0x1898,0x1898,0x1898,0x1898,
-0x1898,0x1898,0x1898,0x1898,0x1898,0x1898,0x1898,0x1898,0x1898,0x1898,0x1898,0x1898,0x1898,0x1898,0x1898,0x1898,
-0x1898,0x1898,0x1898,0x1898,0x1898,0x1898,0x1898,0x10e0,0x1951,0x1951,0x1951,0x1951,0x1951,0x1951,0x10e8,0x1a99,
-0x1a99,0x1a99,0x1a99,0x1a99,0x1a99,0x1a99,0x1a99,0x1a99,0x1a99,0x1a99,0x1a99,0x1a99,0x1a99,0x1a99,0x1a99,0x1a99,
-0x1a99,0x1a99,0x1a99,0x1a99,0x1a99,0x1a99,0x1a99,0x1a99,0x1a99,0x1a99,0x1a99,0x1a99,0x1a99,0x1a99,0x1a99,0x1a99,
-0x1a99,0x1a99,0x1a99,0x1a99,0x1a99,0x1a99,0x1a99,0x1a99,0x1a99,0x1a99,0x1a99,0x1a99,0x1a99,0x1a99,0x1a99,0x1a99,
-0x1a99,0x1a99,0x1a99,0x1a99,0x1a99,0x1a99,0x1a99,0x1a99,0x1a99,0x1a99,0x1a99,0x1a99,0x1a99,0x1a99,0x1442,0x1442,
-0x1442,0x1442,0x1442,0x1442,0x1442,0x1442,0x1442,0x1442,0x1442,0x1442,0x1442,0x1442,0x1442,0x1442,0x1442,0x1442,
-0x1442,0x1442,0x1442,0x1442,0x1442,0x1442,0x1442,0x1442,0x1442,0x1442,0x1442,0x1442,0x1442,0x1442,0x1442,0x1442,
-0x1442,0x1442,0x1442,0x1442,0x1442,0x1442,0x1442,0x1442,0x1442,0x1442,0x1442,0x1442,0x1442,0x1442,0x1442,0x1442,
-0x1442,0x1442,0x1442,0x1442,0x1442,0x1442,0x1442,0x1442,0x1442,0x1442,0x1442,0x1442,0x1442,0x1432,0x144a,0x144a,
-0x144a,0x144a,0x144a,0x144a,0x144a,0x144a,0x144a,0x144a,0x144a,0x144a,0x144a,0x144a,0x144a,0x144a,0x144a,0x144a,
-0x144a,0x144a,0x144a,0x144a,0x144a,0x144a,0x144a,0x144a,0x144a,0x144a,0x144a,0x144a,0x144a,0x144a,0x144a,0x144a,
-0x144a,0x144a,0x144a,0x144a,0x144a,0x144a,0x144a,0x144a,0x144a,0x144a,0x144a,0x144a,0x144a,0x144a,0x144a,0x144a,
-0x144a,0x144a,0x144a,0x144a,0x144a,0x144a,0x144a,0x144a,0x144a,0x144a,0x144a,0x144a,0x144a,0x143a,0x1442,0x1442,
-0x1442,0x1442,0x1442,0x1442,0x1442,0x1442,0x1442,0x1442,0x1442,0x1442,0x1442,0x1442,0x1442,0x1442,0x1442,0x1442,
-0x1442,0x1442,0x1442,0x1442,0x1442,0x1442,0x1442,0x1442,0x1442,0x1442,0x1442,0x1442,0x1442,0x1442,0x1442,0x1442,
-0x1442,0x1442,0x1442,0x1442,0x1442,0x1442,0x1442,0x1442,0x1442,0x1442,0x1442,0x1442,0x1442,0x1442,0x1442,0x1442,
-0x1442,0x1442,0x1442,0x1442,0x1442,0x1442,0x1442,0x1442,0x1442,0x1442,0x1442,0x1442,0x1442,0x1442,0x144a,0x144a,
-0x144a,0x144a,0x144a,0x144a,0x144a,0x144a,0x144a,0x144a,0x144a,0x144a,0x144a,0x144a,0x144a,0x144a,0x144a,0x144a,
-0x144a,0x144a,0x144a,0x144a,0x144a,0x144a,0x144a,0x144a,0x144a,0x144a,0x144a,0x144a,0x144a,0x144a,0x144a,0x144a,
-0x144a,0x144a,0x144a,0x144a,0x144a,0x144a,0x144a,0x144a,0x144a,0x144a,0x144a,0x144a,0x144a,0x144a,0x144a,0x144a,
-0x144a,0x144a,0x144a,0x144a,0x144a,0x144a,0x144a,0x144a,0x144a,0x144a,0x144a,0x144a,0x144a,0x144a,0x159e,0x159e,
-0x159e,0x159e,0x159e,0x159e,0x159e,0x159e,0x159e,0x159e,0x159e,0x159e,0x159e,0x159e,0x159e,0x159e,0x159e,0x159e,
-0x159e,0x159e,0x159e,0x159e,0x159e,0x159e,0x159e,0x159e,0x159e,0x159e,0x159e,0x159e,0x159e,0x159e,0x159e,0x159e,
-0x159e,0x159e,0x159e,0x159e,0x159e,0x159e,0x159e,0x159e,0x159e,0x159e,0x159e,0x159e,0x159e,0x159e,0x159e,0x159e,
-0x159e,0x159e,0x159e,0x159e,0x159e,0x159e,0x159e,0x159e,0x159e,0x159e,0x159e,0x159e,0x159e,0x159e,0x1898,0x1898,
-0x1898,0x1898,0x1898,0x1898,0x1898,0x1898,0x1898,0x1898,0x1898,0x1898,0x1898,0x1898,0x1898,0x1898,0x1898,0x1898,
-0x1898,0x1898,0x1898,0x1898,0x1898,0x1898,0x1898,0x1898,0x1898,0x1898,0x1898,0x1898,0x1898,0x1898,0x1898,0x1898,
-0x1898,0x1898,0x1898,0x1898,0x1898,0x1898,0x1898,0x1898,0x1898,0x1898,0x1898,0x1898,0x1898,0x1898,0x1898,0x1898,
-0x1898,0x1898,0x1898,0x1898,0x1898,0x1898,0x1898,0x1898,0x1898,0x1898,0x1898,0x1898,0x1898,0x1898,0x1a99,0x1a99,
-0x1a99,0x1a99,0x1a99,0x1a99,0x1a99,0x1a99,0x1a99,0x1a99,0x1a99,0x1a99,0x1a99,0x1a99,0x1a99,0x1a99,0x1a99,0x1a99,
-0x1a99,0x1a99,0x1a99,0x1a99,0x1a99,0x1a99,0x1a99,0x1a99,0x1a99,0x1a99,0x1a99,0x1a99,0x1a99,0x1a99,0x1a99,0x1a99,
-0x1a99,0x1a99,0x1a99,0x1a99,0x1a99,0x1a99,0x1a99,0x1a99,0x1a99,0x1a99,0x1a99,0x1a99,0x1a99,0x1a99,0x1a99,0x1a99,
-0x1a99,0x1a99,0x1a99,0x1a99,0x1a99,0x1a99,0x1a99,0x1a99,0x1a99,0x1a99,0x1a99,0x1a99,0x1a99,0x1a99,0x487,0x487,
+static const uint16_t propsVectorsTrie_index[4202]={
+0,0x40,0x80,0xc0,0x100,0x140,0x180,0x1c0,0x1fa,0x239,0x265,0x2a5,0x2e5,0x325,0x365,0x3a3,
+0x3e3,0x41d,0x45b,0x49b,0x4db,0x50c,0x545,0x585,0x5c5,0x605,0x63e,0x67e,0x6be,0x6fe,0x73e,0x77e,
+0x7be,0x7fe,0x81e,0x853,0x893,0x8d2,0x912,0x951,0x991,0x9d0,0xa10,0xa4f,0xa8f,0xacf,0xb0f,0xb4d,
+0xb8d,0xbcc,0xc0c,0xc4c,0xc8c,0xccb,0xd0b,0xd4b,0xd8b,0xdcb,0xe0b,0xe4b,0xe8b,0xecb,0xf0b,0xf4b,
+0xf8b,0xfcb,0x1009,0x1043,0x1083,0x10a9,0x10ca,0x10f2,0x1132,0x116b,0x11a4,0x11e2,0x1213,0x124c,0x128c,0x12ac,
+0x12ec,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x12ed,0x1300,0x1340,0x1360,0x13a0,0x13e0,0x1420,0x145e,
+0x149e,0x14db,0x151b,0x154b,0x158b,0x15cb,0x160b,0x1646,0x1686,0x16b1,0x16f1,0x1730,0x1770,0x17b0,0x17f0,0x1830,
+0x1870,0x18b0,0x18f0,0x1930,0x1970,0x19ac,0x19ec,0x1a2c,0x1a6c,0x1a6c,0x1a96,0x1ab6,0x1af6,0x1b36,0x1b76,0x1bb5,
+0x1bf5,0x1c35,0x1c75,0x1cb4,0x1cf4,0x1d34,0x1d74,0x1db0,0x1df0,0x1e2f,0x1e6f,0x1eaf,0x1eef,0x1f1a,0x1f57,0x1f8f,
+0x1fcf,0x200f,0x2043,0x2079,0x20b9,0x20ed,0x212d,0x216d,0x21ad,0x21ed,0x222d,0x226d,0x22ad,0x22eb,0x232b,0x236b,
+0x23ab,0x23ab,0x23ab,0x23ab,0x23eb,0x23eb,0x242b,0x2453,0x2493,0x24a0,0x24d7,0x24fb,0x253b,0x2576,0x2594,0x25d1,
+0x2611,0x2641,0x2681,0x269d,0x26dd,0x270d,0x274d,0x276d,0x27ad,0x27ed,0x282d,0x284d,0x288d,0x288d,0x288d,0x28b7,
+0x28f7,0x2937,0x2975,0x29b3,0x29f3,0x2a24,0x2a55,0x2a95,0x2ad5,0x2b11,0x2b51,0x2b91,0x2bd1,0x2bf9,0x2c39,0x2c5b,
+0x2c9b,0x2c9b,0x2c9b,0x2c9b,0x2c9b,0x2c9b,0x2c9b,0x2c9b,0x2c9b,0x2c9b,0x2c9b,0x2c9b,0x2c9b,0x2c9b,0x2c9b,0x2c9b,
+0x2c9b,0x2c9b,0x2c9b,0x2c9b,0x2c9b,0x2c9b,0x2c9b,0x2c9b,0x2c9b,0x2c9b,0x2c9b,0x2c9b,0x2c9b,0x2c9b,0x2c9b,0x2c9b,
+0x2c9b,0x2c9b,0x2c9b,0x2c9b,0x2c9b,0x2c9b,0x2c9b,0x2c9b,0x2c9b,0x2c9b,0x2c9b,0x2c9b,0x2c9b,0x2c9b,0x2c9b,0x2c9b,
+0x2c9b,0x2c9b,0x2c9b,0x2c9b,0x2c9b,0x2c9b,0x2c9b,0x2c9b,0x2c9b,0x2c9b,0x2c9b,0x2c9b,0x2c9b,0x2c9b,0x2c9b,0x2c9b,
+0x2c9b,0x2c9b,0x2c9b,0x2c9b,0x2c9b,0x2c9b,0x2c9b,0x2c9b,0x2c9b,0x2c9b,0x2c9b,0x2c9b,0x2c9b,0x2c9b,0x2c9b,0x2c9b,
+0x2c9b,0x2c9b,0x2c9b,0x2c9b,0x2c9b,0x2c9b,0x2c9b,0x2c9b,0x2c9b,0x2c9b,0x2c9b,0x2c9b,0x2c9b,0x2c9b,0x2c9b,0x2c9b,
+0x2c9b,0x2c9b,0x2c9b,0x2c9b,0x2c9b,0x2c9b,0x2ca5,0x2ce5,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,
+0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,
+0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,
+0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,
+0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,
+0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,
+0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,
+0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,
+0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,
+0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,
+0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,
+0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,
+0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,
+0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,
+0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,
+0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,
+0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,
+0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,
+0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,
+0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,
+0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d25,0x2d3f,0x2d7b,
+0x2dbb,0x2dd1,0x2dd1,0x2dd1,0x2dd1,0x2dd1,0x2dd1,0x2dd1,0x2dd1,0x2dd1,0x2dd1,0x2dd1,0x2dd1,0x2dd1,0x2dd1,0x2dd1,
+0x2dd1,0x2dd1,0x2e04,0x2e43,0x2e83,0x2e83,0x2e83,0x2e83,0x2eb7,0x2ef7,0x2f37,0x2f57,0x2f97,0x2fc9,0x3007,0x303f,
+0x307f,0x30bf,0x30ff,0x313b,0x317b,0x31b4,0x31f4,0x3234,0x3274,0x32b4,0x32f4,0x3334,0x3374,0x33a4,0x33d4,0x3414,
+0x3454,0x345c,0x3464,0x346c,0x3458,0x3460,0x3468,0x3454,0x345c,0x3464,0x346c,0x3458,0x3460,0x3468,0x3454,0x345c,
+0x3464,0x346c,0x3458,0x3460,0x3468,0x3454,0x345c,0x3464,0x346c,0x3458,0x3460,0x3468,0x3454,0x345c,0x3464,0x346c,
+0x3458,0x3460,0x3468,0x3454,0x345c,0x3464,0x346c,0x3458,0x3460,0x3468,0x3454,0x345c,0x3464,0x346c,0x3458,0x3460,
+0x3468,0x3454,0x345c,0x3464,0x346c,0x3458,0x3460,0x3468,0x3454,0x345c,0x3464,0x346c,0x3458,0x3460,0x3468,0x3454,
+0x345c,0x3464,0x346c,0x3458,0x3460,0x3468,0x3454,0x345c,0x3464,0x346c,0x3458,0x3460,0x3468,0x3454,0x345c,0x3464,
+0x346c,0x3458,0x3460,0x3468,0x3454,0x345c,0x3464,0x346c,0x3458,0x3460,0x3468,0x3454,0x345c,0x3464,0x346c,0x3458,
+0x3460,0x3468,0x3454,0x345c,0x3464,0x346c,0x3458,0x3460,0x3468,0x3454,0x345c,0x3464,0x346c,0x3458,0x3460,0x3468,
+0x3454,0x345c,0x3464,0x346c,0x3458,0x3460,0x3468,0x3454,0x345c,0x3464,0x346c,0x3458,0x3460,0x3468,0x3454,0x345c,
+0x3464,0x346c,0x3458,0x3460,0x3468,0x3454,0x345c,0x3464,0x346c,0x3458,0x3460,0x3468,0x3454,0x345c,0x3464,0x346c,
+0x3458,0x3460,0x3468,0x3454,0x345c,0x3464,0x346c,0x3458,0x3460,0x3468,0x3454,0x345c,0x3464,0x346c,0x3458,0x3460,
+0x3468,0x3454,0x345c,0x3464,0x346c,0x3458,0x3460,0x3468,0x3454,0x345c,0x3464,0x346c,0x3458,0x3460,0x34a0,0x34d9,
+0x3519,0x3519,0x3519,0x3519,0x3519,0x3519,0x3519,0x3519,0x3519,0x3519,0x3519,0x3519,0x3519,0x3519,0x3559,0x3559,
+0x3599,0x3599,0x3599,0x3599,0x3599,0x3599,0x3599,0x3599,0x3599,0x3599,0x3599,0x3599,0x3599,0x3599,0x3599,0x3599,
+0x35d9,0x35d9,0x35d9,0x35d9,0x35d9,0x35d9,0x35d9,0x35d9,0x35d9,0x35d9,0x35d9,0x35d9,0x35d9,0x35d9,0x35d9,0x35d9,
+0x35d9,0x35d9,0x35d9,0x35d9,0x35d9,0x35d9,0x35d9,0x35d9,0x35d9,0x35d9,0x35d9,0x35d9,0x35d9,0x35d9,0x35d9,0x35d9,
+0x35d9,0x35d9,0x35d9,0x35d9,0x35d9,0x35d9,0x35d9,0x35d9,0x35d9,0x35d9,0x35d9,0x35d9,0x35d9,0x35d9,0x35d9,0x35d9,
+0x35d9,0x35d9,0x35d9,0x35d9,0x35d9,0x35d9,0x35d9,0x35d9,0x35d9,0x35d9,0x35d9,0x35d9,0x35d9,0x35d9,0x35d9,0x35d9,
+0x35d9,0x35d9,0x35d9,0x35d9,0x35d9,0x35d9,0x35d9,0x35d9,0x35d9,0x35d9,0x35d9,0x35d9,0x35d9,0x35d9,0x35d9,0x35d9,
+0x35d9,0x35d9,0x35d9,0x35d9,0x35d9,0x35d9,0x35d9,0x35d9,0x35d9,0x35d9,0x35d9,0x35d9,0x35d9,0x35d9,0x35d9,0x35d9,
+0x35d9,0x35d9,0x35d9,0x35d9,0x3619,0x3619,0x3619,0x3619,0x364b,0x367b,0x36ab,0x36d1,0x3711,0x3751,0x378d,0x37cb,
+0x380b,0x382d,0x3856,0x3877,0x38ac,0x38ec,0x3926,0x3963,0x39a3,0x39e3,0x3a23,0x3a57,0x3a97,0x3ad7,0x3b08,0x3b47,
+0x800,0x840,0x880,0x8c0,0x900,0x938,0x96e,0x99e,0x9de,0xa1e,0x99e,0x99e,0xa5e,0xa9c,0x99e,0x99e,
+0x99e,0xadc,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0xb1c,0xb55,0x99e,0x99e,0x99e,0x99e,
+0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0xb95,0x99e,0x99e,0xbd5,
+0x99e,0x99e,0x99e,0x99e,0xc15,0xc55,0xc95,0x99e,0x99e,0x99e,0xcd5,0xcf5,0xd35,0xd75,0xdb5,0xdd5,
+0xe15,0xe15,0xe15,0xe15,0xe15,0xe15,0xe15,0xe15,0xe15,0xe15,0xe15,0xe15,0xe15,0xe15,0xe15,0xe15,
+0xe15,0xe15,0xe15,0xe15,0xe15,0xe15,0xe15,0xe15,0xe15,0xe15,0xe15,0xe15,0xe15,0xe15,0xe15,0xe15,
+0xe15,0xe15,0xe15,0xe15,0xe15,0xe15,0xe15,0xe15,0xe15,0xe28,0xe58,0xe58,0xe58,0xe65,0xea4,0xea6,
+0xea6,0xea6,0xea6,0xebc,0xee7,0xee7,0xee7,0xee7,0xee7,0xee7,0xee7,0xee7,0xee7,0xee7,0xf27,0xf49,
+0xee7,0xee7,0xee7,0xee7,0xee7,0xee7,0xee7,0xee7,0xee7,0xee7,0xee7,0xee7,0xee7,0xee7,0xee7,0xee7,
+0xee7,0xee7,0xee7,0xee7,0xee7,0xee7,0xee7,0xee7,0xee7,0xee7,0xee7,0xee7,0xee7,0xee7,0xee7,0xee7,
+0xee7,0xee7,0xee7,0xee7,0xee7,0xee7,0xee7,0xee7,0xee7,0xee7,0xee7,0xee7,0xee7,0xee7,0xee7,0xee7,
+0xee7,0xee7,0xee7,0xee7,0xee7,0xee7,0xee7,0xee7,0xee7,0xee7,0xee7,0xee7,0xee7,0xee7,0xee7,0xf49,
+0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,
+0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,
+0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,
+0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0xdd5,
+0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,
+0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,
+0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,
+0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0xdd5,
+0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,
+0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,
+0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,
+0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0xdd5,
+0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,
+0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,
+0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,
+0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0xdd5,
+0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,
+0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,
+0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,
+0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0xdd5,
+0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,
+0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,
+0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,
+0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0xdd5,
+0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,
+0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,
+0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,
+0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0xdd5,
+0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,
+0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,
+0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,
+0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0xdd5,
+0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,
+0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,
+0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,
+0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0xdd5,
+0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,
+0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,
+0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,
+0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0xdd5,
+0xf89,0xfa8,0xfa8,0xfa8,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,
+0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,
+0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,
+0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0x99e,0xdd5,
+0xfe8,0xfe8,0xfe8,0xfe8,0xfe8,0xfe8,0xfe8,0xfe8,0xfe8,0xfe8,0xfe8,0xfe8,0xfe8,0xfe8,0xfe8,0xfe8,
+0xfe8,0xfe8,0xfe8,0xfe8,0xfe8,0xfe8,0xfe8,0xfe8,0xfe8,0xfe8,0xfe8,0xfe8,0xfe8,0xfe8,0xfe8,0xfe8,
+0xfe8,0xfe8,0xfe8,0xfe8,0xfe8,0xfe8,0xfe8,0xfe8,0xfe8,0xfe8,0xfe8,0xfe8,0xfe8,0xfe8,0xfe8,0xfe8,
+0xfe8,0xfe8,0xfe8,0xfe8,0xfe8,0xfe8,0xfe8,0xfe8,0xfe8,0xfe8,0xfe8,0xfe8,0xfe8,0xfe8,0xfe8,0xfe9,
+0x1029,0x1029,0x1029,0x1029,0x1029,0x1029,0x1029,0x1029,0x1029,0x1029,0x1029,0x1029,0x1029,0x1029,0x1029,0x1029,
+0x1029,0x1029,0x1029,0x1029,0x1029,0x1029,0x1029,0x1029,0x1029,0x1029,0x1029,0x1029,0x1029,0x1029,0x1029,0x1029,
+0x1029,0x1029,0x1029,0x1029,0x1029,0x1029,0x1029,0x1029,0x1029,0x1029,0x1029,0x1029,0x1029,0x1029,0x1029,0x1029,
+0x1029,0x1029,0x1029,0x1029,0x1029,0x1029,0x1029,0x1029,0x1029,0x1029,0x1029,0x1029,0x1029,0x1029,0x1029,0x102a,
+0x3b87,0x3b94,0x3b8c,0x3b99,0x3ba8,0x3ba8,0x3bb6,0x3bb6,0x3bc6,0x3bc6,0x3bc6,0x3bc6,0x3bc6,0x3bc6,0x3bc6,0x3bcb,
+0x3bdb,0x3be2,0x3be2,0x3bee,0x3bfe,0x3bfe,0x3bfe,0x3c09,0x3c0e,0x3c1e,0x3c2e,0x3c2f,0x3c2f,0x3c3f,0x3c3f,0x3c42,
+0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x3c52,0x3c55,0x3c65,0x3c65,0x3c65,0x3c74,0x3c84,0x3c88,
+0x3c98,0x3c99,0x3ca9,0x3cb9,0x3cbe,0x3cce,0x3cce,0x3cd8,0x3ce8,0x3cea,0x3cfa,0x3cfa,0x3d06,0x3d16,0x81e,0x81e,
+0x3d26,0x3d26,0x3d30,0x3d38,0x3d3a,0x3d4a,0x3d4a,0x3d4a,0x3d5a,0x3d5c,0x3d6c,0x81e,0x81e,0x81e,0x81e,0x81e,
+0x3d7c,0x3d7c,0x3d84,0x3d94,0x3d94,0x3d94,0x3da0,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,
+0x3db0,0x3db0,0x3db0,0x3db0,0x3db0,0x3db0,0x3db0,0x3db0,0x3db0,0x3db0,0x3db0,0x3db0,0x3db0,0x3db0,0x3db0,0x3db0,
+0x3db0,0x3db0,0x3db0,0x3db9,0x3db0,0x3dba,0x3db8,0x3dc0,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,
+0x3dd0,0x3dda,0x3dda,0x3de4,0x3df4,0x3dfe,0x3e0e,0x3e17,0x3e27,0x3e28,0x3e37,0x81e,0x81e,0x81e,0x3e47,0x3e54,
+0x3e64,0x3e6e,0x3e7e,0x3e84,0x81e,0x81e,0x81e,0x81e,0x3e94,0x3e94,0x3ea4,0x3eac,0x3ebc,0x3ecc,0x3ebc,0x3ebc,
+0x3edc,0x3eec,0x3ef5,0x3f01,0x3f11,0x3f21,0x3f31,0x3f34,0x3f44,0x3f47,0x81e,0x81e,0x3f57,0x3f60,0x3f6b,0x3f7b,
+0x3f8b,0x3f8b,0x3f8b,0x3f95,0x3fa5,0x3faf,0x3fbf,0x3fcc,0x3fdc,0x3fea,0x3ff7,0x81e,0x81e,0x81e,0x81e,0x81e,
+0x4007,0x4007,0x4007,0x4007,0x400e,0x81e,0x81e,0x81e,0x401e,0x401e,0x401e,0x402b,0x403b,0x403b,0x403b,0x4048,
+0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,
+0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x4058,0x4059,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,
+0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,
+0x4069,0x406c,0x406c,0x4074,0x407e,0x408c,0x4096,0x40a6,0x40b6,0x40bc,0x40c9,0x40d9,0x40e7,0x40f7,0x40fe,0x410e,
+0x411e,0x4121,0x412a,0x413a,0x414a,0x415a,0x415a,0x4167,0x4177,0x417a,0x417a,0x4187,0x4197,0x41a7,0x41b7,0x41c2,
+0x41d2,0x41e0,0x41e4,0x41f3,0x4201,0x81e,0x81e,0x81e,0x4211,0x4220,0x422f,0x423f,0x423f,0x4240,0x4250,0x4260,
+0x4270,0x427c,0x4283,0x4292,0x42a0,0x42b0,0x42be,0x42c6,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,
+0x42d6,0x42d6,0x42d6,0x42e6,0x42f5,0x4305,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,
+0x4315,0x4315,0x4316,0x4326,0x4336,0x4340,0x434e,0x434e,0x435e,0x435e,0x435e,0x436e,0x437e,0x438e,0x81e,0x81e,
+0x439e,0x439e,0x43a3,0x43b3,0x43c3,0x81e,0x81e,0x81e,0x43d3,0x43d9,0x43e9,0x43f9,0x81e,0x81e,0x81e,0x81e,
+0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x4409,0x4409,0x4419,0x4419,0x4429,0x4436,0x81e,0x81e,
+0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,
+0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x4446,0x4446,0x4446,0x444d,0x81e,0x81e,
+0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,
+0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,
+0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,
+0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x445d,0x445d,
+0x445d,0x445d,0x445d,0x445d,0x445d,0x445d,0x445d,0x445d,0x445d,0x445d,0x445d,0x445d,0x445d,0x445d,0x445d,0x445d,
+0x445d,0x445d,0x445d,0x445d,0x445d,0x445d,0x445d,0x445d,0x445d,0x445d,0x445d,0x445d,0x445d,0x445d,0x445d,0x445d,
+0x445d,0x445d,0x445d,0x445d,0x445d,0x445d,0x445d,0x445d,0x445d,0x445d,0x445d,0x445d,0x445d,0x445d,0x445d,0x445d,
+0x445d,0x445d,0x445d,0x445d,0x445e,0x446d,0x446d,0x4474,0x447e,0x447e,0x447e,0x447e,0x447e,0x447e,0x448e,0x448e,
+0x448e,0x448e,0x448e,0x448e,0x449b,0x44ab,0x44bb,0x44bb,0x44bb,0x44bb,0x44bb,0x44bb,0x44bb,0x44bb,0x44bb,0x44bb,
+0x44bb,0x44bb,0x44c7,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,
+0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,
+0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x44d7,0x44d7,
+0x44d7,0x44d7,0x44d7,0x44d7,0x44d7,0x44d7,0x44d7,0x44d7,0x44d7,0x44d7,0x44d7,0x44d7,0x44d7,0x44d7,0x44d7,0x44d7,
+0x44d7,0x44d7,0x44d7,0x44d7,0x44d7,0x44d7,0x44d7,0x44d7,0x44d7,0x44d7,0x44d7,0x44d7,0x44d7,0x44d7,0x44d7,0x44d7,
+0x44d7,0x44d7,0x44d7,0x44df,0x44d7,0x44d7,0x44ed,0x44d7,0x44d7,0x44d7,0x44d7,0x44d7,0x44d7,0x44d7,0x44d7,0x44d7,
+0x44d7,0x44d7,0x44d7,0x44d7,0x44d7,0x44f7,0x44d7,0x44d7,0x44d7,0x44d7,0x44d7,0x44d7,0x44d7,0x44d7,0x4503,0x81e,
+0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,
+0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,
+0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,
+0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x4513,0x4513,0x4513,0x4513,
+0x4513,0x4513,0x4513,0x4513,0x4513,0x4513,0x4513,0x4513,0x4513,0x4513,0x4513,0x4513,0x4513,0x4513,0x4513,0x4513,
+0x4513,0x4513,0x4513,0x4513,0x4513,0x4513,0x4513,0x4513,0x4515,0x4513,0x4513,0x4513,0x4513,0x4513,0x4513,0x4513,
+0x4525,0x452c,0x452c,0x452c,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,
+0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x453c,0x453c,0x453c,0x453c,
+0x453c,0x453c,0x453c,0x453c,0x453c,0x453c,0x453c,0x453c,0x453c,0x453c,0x453c,0x453c,0x453c,0x453c,0x453c,0x453c,
+0x453c,0x453c,0x453c,0x453c,0x453c,0x453c,0x453c,0x453c,0x453c,0x453c,0x453c,0x453c,0x453c,0x453c,0x453c,0x4543,
+0x4553,0x4554,0x4564,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x4574,0x4576,0x4586,0x4596,0x4596,0x4596,0x45a6,
+0x45b6,0x45c6,0x45d4,0x45dc,0x4596,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,
+0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,
+0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,
+0x81e,0x81e,0x81e,0x81e,0x81e,0x45ec,0x45ec,0x45ec,0x45ec,0x45f7,0x4607,0x4608,0x4609,0x4618,0x4627,0x81e,
+0x81e,0x81e,0x81e,0x81e,0x81e,0x4637,0x4639,0x4639,0x4639,0x4639,0x4639,0x4639,0x4639,0x4639,0x4639,0x4639,
+0x4639,0x4639,0x4639,0x4639,0x4639,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,
+0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,
+0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,
+0x81e,0x81e,0x81e,0x81e,0x81e,0x4649,0x4649,0x4649,0x4649,0x4649,0x4649,0x464e,0x464c,0x4650,0x4660,0x4670,
+0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,
+0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,
+0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,
+0x81e,0x81e,0x81e,0x81e,0x81e,0x4680,0x4680,0x4680,0x4680,0x4680,0x4680,0x4680,0x4680,0x4680,0x4680,0x4680,
+0x4680,0x4680,0x4680,0x4680,0x468a,0x469a,0x469a,0x46a3,0x469a,0x469a,0x46ad,0x46bb,0x46c9,0x46d6,0x469a,0x46e2,
+0x46b0,0x46f2,0x46f4,0x4702,0x470b,0x471b,0x471b,0x471b,0x471b,0x4729,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,
+0x81e,0x81e,0x81e,0x81e,0x81e,0x4739,0x4739,0x4739,0x4739,0x4739,0x4742,0x4752,0x4760,0x81e,0x81e,0x81e,
+0x81e,0x81e,0x81e,0x81e,0x81e,0x4770,0x4776,0x4780,0x478c,0x4772,0x479c,0x4788,0x4770,0x477e,0x47a2,0x47b2,
+0x47c0,0x47cf,0x4770,0x4776,0x4780,0x47db,0x47e8,0x4780,0x47d7,0x47f8,0x4807,0x4784,0x4770,0x477a,0x4780,0x4770,
+0x4776,0x4780,0x478c,0x4772,0x4780,0x4788,0x4770,0x477e,0x4784,0x4770,0x477a,0x4780,0x4770,0x4776,0x4780,0x4813,
+0x4770,0x4822,0x4827,0x4835,0x483a,0x4780,0x4846,0x4770,0x481e,0x4856,0x478a,0x4866,0x4780,0x4876,0x4770,0x486c,
+0x4780,0x487c,0x488a,0x488a,0x488a,0x489a,0x489a,0x489a,0x489a,0x489a,0x489a,0x489a,0x489a,0x489a,0x489a,0x489a,
+0x489a,0x489a,0x489a,0x489a,0x489a,0x489a,0x489a,0x489a,0x489a,0x489a,0x489a,0x489a,0x489a,0x489a,0x489a,0x489a,
+0x489a,0x489a,0x489a,0x489a,0x489a,0x48aa,0x48aa,0x48aa,0x48b3,0x48aa,0x48aa,0x48ad,0x48c3,0x48cf,0x48db,0x48e5,
+0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,
+0x81e,0x81e,0x81e,0x81e,0x81e,0x48f5,0x48f5,0x48f5,0x48f5,0x48f5,0x48f5,0x48f5,0x48f5,0x48f5,0x48f5,0x48f5,
+0x48f5,0x4900,0x4910,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,
+0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,
+0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,
+0x81e,0x81e,0x81e,0x81e,0x81e,0x4920,0x4925,0x4935,0x4942,0x4950,0x4960,0x496e,0x4976,0x4986,0x4991,0x49a0,
+0x4991,0x49b0,0x49b0,0x49b0,0x49c0,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,
+0x81e,0x81e,0x81e,0x81e,0x81e,0x49d0,0x49d0,0x49d4,0x49e4,0x49e4,0x49e4,0x49e4,0x49e4,0x49e4,0x49f0,0x4a00,
+0x4a0f,0x4a1f,0x4a1f,0x4a2f,0x4a39,0x4a49,0x4a59,0x4a5e,0x4a6e,0x4a7e,0x4a8e,0x4a9e,0x4aae,0x4abe,0x4ace,0x4ad9,
+0x4ad9,0x4ad9,0x4ad9,0x4ae3,0x4ae9,0x4af9,0x4b09,0x4b09,0x4b17,0x4b27,0x4b37,0x4b39,0x4b39,0x4b39,0x4b39,0x4b39,
+0x4b39,0x4b39,0x4b39,0x4b39,0x4b39,0x4b49,0x4b49,0x4b58,0x4b68,0x4b49,0x4b49,0x4b49,0x4b6f,0x4b49,0x4b7f,0x4b49,
+0x4b8f,0x4b9c,0x4bab,0x4b49,0x4bbb,0x4b49,0x4b49,0x4b49,0x4b4a,0x4bcb,0x4b49,0x4b49,0x4b49,0x4b49,0x4b49,0x4bdb,
+0x4be9,0x4b49,0x4b49,0x4b49,0x4bf1,0x4c01,0x4c0a,0x4c15,0x4c23,0x4c33,0x4b49,0x4b51,0x4c43,0x4c4e,0x4c4e,0x4c49,
+0x4c4e,0x4c4e,0x4c5a,0x4c4e,0x4c66,0x4c76,0x4c85,0x4c95,0x4ca5,0x4cb4,0x4cc4,0x4cc4,0x4cce,0x4cde,0x4cde,0x4cde,
+0x4cde,0x4ce8,0x4cf8,0x4d08,0x4d11,0x4d21,0x4d21,0x4d21,0x4d21,0x4d21,0x4d21,0x4d21,0x4d2d,0x4d3d,0x4d3d,0x4d3d,
+0x4d3d,0x4d3d,0x4d48,0x4d4d,0x4d4d,0x4d5d,0x4d6d,0x4d6d,0x4d6d,0x4d75,0x4d73,0x4d6d,0x4d6d,0x4d75,0x4d6d,0x4d6f,
+0x4d7d,0x4d7d,0x4d7d,0x4d7d,0x4d7d,0x4d8d,0x4d9d,0x4d8d,0x4d8d,0x4d8d,0x4d8d,0x4d8d,0x4d8d,0x4da1,0x4d8d,0x4d8d,
+0x4d8d,0x4da5,0x4d8d,0x4d8d,0x4d8d,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,
+0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,
+0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,
+0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,0x81e,
+0x81e,0x81e,0x81e,0x81e,0x4db5,0x4dc5,0x4dc5,0x4dc5,0x4dc5,0x4dc5,0x4dc5,0x4dc5,0x4dc5,0x4dc5,0x4dc5,0x4dc5,
+0x4dc5,0x4dc5,0x4dc5,0x4dc5,0x4dc5,0x4dc5,0x4dc5,0x4dc5,0x4dc5,0x4dc5,0x4dc5,0x4dc5,0x4dc5,0x4dc5,0x4dc5,0x4dc5,
+0x4dc5,0x4dc5,0x4dc5,0x4dc5,0x4dc5,0x4dc5,0x4dc5,0x4dc5,0x4dc5,0x4dc5,0x4dc5,0x4dc5,0x4dc5,0x4dc5,0x4dc5,0x4dc5,
+0x4dc5,0x4dc5,0x4dc5,0x4dc5,0x4dc5,0x4dc5,0x4dc5,0x4dc5,0x4dc5,0x4dc5,0x4dc5,0x4dc5,0x4dc5,0x4dc5,0x4dc5,0x4dc5,
+0x4dc5,0x4dc5,0x4dc5,0x4dc5,0x4dc5,0x4dce,0x4dde,0x4dde,0x4dee,0x4dee,0x4dee,0x4dee,0x4dee,0x4dee,0x4dee,0x4dee,
+0x4dee,0x4dee,0x4dee,0x4dee,0x4dee,0x4dee,0x4dee,0x4dee,0x4dee,0x4dee,0x4dee,0x4dee,0x4dee,0x4dee,0x4dee,0x4dee,
+0x4dee,0x4dee,0x4dee,0x4dee,0x4dee,0x4dee,0x4dee,0x4dee,0x4dee,0x4dee,0x4dee,0x4dee,0x4dee,0x4dee,0x4dee,0x4dee,
+0x4dee,0x4dee,0x4dee,0x4dee,0x4dee,0x4dee,0x4dee,0x4dee,0x4dee,0x4dee,0x4dee,0x4dee,0x4dee,0x4dee,0x4dee,0x4dee,
+0x4dee,0x4dee,0x4dee,0x4dee,0x4dee,0x4dee,0x4dee,0x4dee,0x4df9,0x4e09,0x4e09,0x4e09,0x4e09,0x4e09,0x4e09,0x4e09,
+0x4e09,0x4e09,0x4e09,0x4e09,0x4e09,0x4e0b,0x4e1b,0x4e1b,0x4e1b,0x4e1b,0x4e1b,0x4e1b,0x4e1b,0x4e1b,0x4e1b,0x4e1b,
+0x4e1b,0x4e1b,0x4e1b,0x4e1b,0x4e1b,0x4e1b,0x4e1b,0x4e1b,0x4e1b,0x4e1b,0x4e1b,0x4e1b,0x4e1b,0x4e1b,0x4e1b,0x4e1b,
+0x4e1b,0x4e1b,0x4e1b,0x4e1b,0x4e1b,0x4e1b,0x4e1b,0x4e1b,0x4e1b,0x4e1b,0x4e1b,0x4e1b,0x4e1b,0x4e1b,0x4e1b,0x4e1b,
+0x4e1b,0x4e1b,0x4e1b,0x4e1b,0x4e1b,0x4e1b,0x4e1b,0x4e1b,0x4e1b,0x4e1b,0x4e1b,0x4e1b,0x4e1b,0x4e1b,0x4e1b,0x4e1b,
+0x4e1b,0x4e1b,0x4e1b,0x4e1b,0x4e1b,0x4e1b,0x4e29,0x4dde,0x4dde,0x4dde,0x4dde,0x4dde,0x4dde,0x4dde,0x4dde,0x4dde,
+0x4dde,0x4dde,0x4dde,0x4dde,0x4dde,0x4dde,0x4dde,0x4dde,0x4dde,0x4dde,0x4dde,0x4dde,0x4dde,0x4dde,0x4dde,0x4dde,
+0x4dde,0x4dde,0x4dde,0x4dde,0x4dde,0x4dde,0x4dde,0x4dde,0x4dde,0x4dde,0x4dde,0x4dde,0x4dde,0x4dde,0x4dde,0x4dde,
+0x4dde,0x4dde,0x4dde,0x4dde,0x4dde,0x4dde,0x4dde,0x4dde,0x4dde,0x4dde,0x4dde,0x4dde,0x4dde,0x4dde,0x4dde,0x4dde,
+0x4dde,0x4dde,0x4dde,0x4dde,0x4dde,0x4dde,0x4dde,0x4e39,0x4e39,0x4e39,0x4e39,0x4e39,0x4e39,0x4e39,0x4e39,0x4e39,
+0x4e39,0x4e39,0x4e39,0x4e39,0x4e39,0x4e39,0x4e39,0x4e39,0x4e39,0x4e39,0x4e39,0x4e39,0x4e39,0x4e39,0x4e39,0x4e39,
+0x4e39,0x4e39,0x4e39,0x4e39,0x4e39,0x4e39,0x4e39,0x4e39,0x4e3b,0x4dde,0x4dde,0x4dde,0x4dde,0x4dde,0x4dde,0x4dde,
+0x4dde,0x4dde,0x4dde,0x4dde,0x4dde,0x4dde,0x4dde,0x4dde,0x4dde,0x4dde,0x4dde,0x4dde,0x4dde,0x4dde,0x4dde,0x4dde,
+0x4dde,0x4dde,0x4dde,0x4dde,0x4dde,0x4dde,0x4dde,0x4dde,0x4dde,0x4dde,0x4dde,0x4dde,0x4dde,0x4dde,0x4dde,0x4dde,
+0x4dde,0x4dde,0x4dde,0x4dde,0x4dde,0x4dde,0x4dde,0x4dde,0x4dde,0x4dde,0x4dde,0x4dde,0x4dde,0x4dde,0x4dde,0x4dde,
+0x4dde,0x4dde,0x4dde,0x4dde,0x4dde,0x4dde,0x4dde,0x4dde,0x4e4b,0x4e5b,0x4e5d,0x4e6d,0x4e6d,0x4e6d,0x4e6d,0x4e6d,
+0x4e6e,0x4e7e,0x4e7e,0x4e7e,0x4e7e,0x4e7e,0x4e7e,0x4e7e,0x4e7e,0x4e8e,0x4e8e,0x4e8e,0x4e8e,0x4e8e,0x4e8e,0x4e8e,
+0x4e8e,0x4e8e,0x4e8e,0x4e8e,0x4e8e,0x4e8e,0x4e8e,0x4e8e,0x4e7e,0x4e7e,0x4e7e,0x4e7e,0x4e7e,0x4e7e,0x4e7e,0x4e7e,
+0x4e7e,0x4e7e,0x4e7e,0x4e7e,0x4e7e,0x4e7e,0x4e7e,0x4e7e,0x4e7e,0x4e7e,0x4e7e,0x4e7e,0x4e7e,0x4e7e,0x4e7e,0x4e7e,
+0x4e7e,0x4e7e,0x4e7e,0x4e7e,0x4e7e,0x4e7e,0x4e7e,0x4e7e,0x4e7e,0x4e7e,0x4e7e,0x4e7e,0x4e7e,0x4e7e,0x4e7e,0x4e7e,
+0x4e7e,0x4e7e,0x4e7e,0x4e7e,0x4e7e,0x4e7e,0x4e7e,0x4e7e,0x4e7e,0x4e7e,0x4e7e,0x4e7e,0x4e7e,0x4e7e,0x4e7e,0x4e7e,
+0x4e7e,0x4e7e,0x4e7e,0x4e7e,0x4e7e,0x4e7e,0x4e7e,0x4e7e,0x4e9e,0x4e9e,0x4e9e,0x4e9e,0x4e9e,0x4e9e,0x4e9e,0x4e9e,
+0x4e9e,0x4e9e,0x4e9e,0x4e9e,0x4e9e,0x4e9e,0x4e9e,0x4e9e,0x4e9e,0x4e9e,0x4e9e,0x4e9e,0x4e9e,0x4e9e,0x4e9e,0x4e9e,
+0x4e9e,0x4e9e,0x4e9e,0x4e9e,0x4e9e,0x4e9e,0x4e9e,0x4e9e,0x4e9e,0x4e9e,0x4e9e,0x4e9e,0x4e9e,0x4e9e,0x4e9e,0x4e9e,
+0x4e9e,0x4e9e,0x4e9e,0x4e9e,0x4e9e,0x4e9e,0x4e9e,0x4e9e,0x4e9e,0x4e9e,0x4e9e,0x4e9e,0x4e9e,0x4e9e,0x4e9e,0x4e9e,
+0x4e9e,0x4e9e,0x4e9e,0x4e9e,0x4e9e,0x4e9e,0x4e9e,0x4e9e,0x4ea0,0x4eb0,0x4eb0,0x4eb0,0x4eb0,0x4eb0,0x4eb0,0x4eb0,
+0x4eb0,0x4eb0,0x4eb0,0x4eb0,0x4eb0,0x4eb0,0x4eb0,0x4eb0,0x4eb0,0x4eb0,0x4eb0,0x4eb0,0x4eb0,0x4eb0,0x4eb0,0x4eb0,
+0x4eb0,0x4eb0,0x4eb0,0x4eb0,0x4eb0,0x4eb0,0x4eb0,0x4eb0,0x4eb0,0x4eb0,0x4eb0,0x4eb0,0x4eb0,0x4eb0,0x4eb0,0x4eb0,
+0x4eb0,0x4eb0,0x4eb0,0x4eb0,0x4eb0,0x4eb0,0x4eb0,0x4eb0,0x4eb0,0x4eb0,0x4eb0,0x4eb0,0x4eb0,0x4eb0,0x4eb0,0x4eb0,
+0x4eb0,0x4eb0,0x4eb0,0x4eb0,0x4eb0,0x4eb0,0x4eb0,0x4eb0,0x4eb0,0x4eb2
+};
+
+static const uint16_t propsVectorsTrie_data16[20164]={
 0x252,0x252,0x252,0x252,0x252,0x252,0x252,0x252,0x252,0x255,0x25e,0x258,0x258,0x25b,0x252,0x252,
 0x252,0x252,0x252,0x252,0x252,0x252,0x252,0x252,0x252,0x252,0x252,0x252,0x252,0x252,0x252,0x252,
 0x750,0x74a,0x72f,0x714,0x720,0x71d,0x714,0x72c,0x71a,0x726,0x714,0x741,0x738,0x729,0x74d,0x723,
@@ -1569,10 +1558,6 @@ static const uint16_t propsVectorsTrie_index[27272]={
 0x756,0x756,0x756,0x756,0x756,0x756,0x756,0x756,0x756,0x756,0x756,0x71a,0x720,0x726,0x747,0x70e,
 0x744,0x759,0x759,0x759,0x759,0x759,0x759,0x753,0x753,0x753,0x753,0x753,0x753,0x753,0x753,0x753,
 0x753,0x753,0x753,0x753,0x753,0x753,0x753,0x753,0x753,0x753,0x753,0x71a,0x73e,0x717,0x73b,0x252,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
 0x261,0x261,0x261,0x261,0x261,0x270,0x261,0x261,0x261,0x261,0x261,0x261,0x261,0x261,0x261,0x261,
 0x261,0x261,0x261,0x261,0x261,0x261,0x261,0x261,0x261,0x261,0x261,0x261,0x261,0x261,0x261,0x261,
 0x264,0x5c1,0x765,0x768,0x5c7,0x768,0x762,0x5bb,0x5b2,0x26a,0x5d0,0x26d,0x76b,0x5a9,0x5be,0x75f,
@@ -1598,181 +1583,168 @@ static const uint16_t propsVectorsTrie_index[27272]={
 0x294,0x288,0x294,0x288,0x291,0x285,0x294,0x288,0x294,0x288,0x294,0x288,0x294,0x288,0x294,0x288,
 0x288,0x297,0x297,0x28b,0x294,0x288,0x930,0x930,0x933,0x92d,0x294,0x288,0x294,0x288,0x294,0x288,
 0x294,0x288,0x294,0x288,0x294,0x288,0x294,0x288,0x294,0x288,0x294,0x288,0x294,0x288,0x294,0x288,
-0x294,0x288,0x294,0x288,0x933,0x92d,0x933,0x92d,0x930,0x92a,0x933,0x92d,0xae9,0xbdf,0x930,0x92a,
-0x930,0x92a,0x933,0x92d,0x933,0x92d,0x933,0x92d,0x933,0x92d,0x933,0x92d,0x933,0x92d,0x933,0x92d,
-0xbdf,0xbdf,0xbdf,0xccc,0xccc,0xccc,0xccf,0xccf,0xccc,0xccf,0xccf,0xccc,0xccc,0xccf,0xe07,0xe0a,
-0xe0a,0xe0a,0xe0a,0xe07,0xe0a,0xe07,0xe0a,0xe07,0xe0a,0xe07,0xe0a,0xe07,0x29a,0x5f1,0x29a,0x29a,
-0x29a,0x29a,0x29a,0x29a,0x29a,0x29a,0x29a,0x29a,0x29a,0x29a,0x29a,0x29a,0x29a,0x5f1,0x29a,0x29a,
-0x29a,0x29a,0x29a,0x29a,0x29a,0x29a,0x29a,0x29a,0x29a,0x29a,0x29a,0x29a,0x29a,0x29a,0x29a,0x29a,
-0x29a,0x29a,0x29a,0x29a,0x29a,0x29a,0x29a,0x29a,0x29a,0x29a,0x29a,0x29a,0x29d,0x29a,0x29a,0x29a,
+0x294,0x288,0x933,0x92d,0x933,0x92d,0x930,0x92a,0x933,0x92d,0xae9,0xbdf,0x930,0x92a,0x930,0x92a,
+0x933,0x92d,0x933,0x92d,0x933,0x92d,0x933,0x92d,0x933,0x92d,0x933,0x92d,0x933,0x92d,0xbdf,0xbdf,
+0xbdf,0xccc,0xccc,0xccc,0xccf,0xccf,0xccc,0xccf,0xccf,0xccc,0xccf,0xe07,0xe0a,0xe0a,0xe0a,0xe0a,
+0xe07,0xe0a,0xe07,0xe0a,0xe07,0xe0a,0xe07,0xe0a,0xe07,0x29a,0x5f1,0x29a,0x29a,0x29a,0x29a,0x29a,
+0x29a,0x29a,0x29a,0x29a,0x29a,0x29a,0x29a,0x29a,0x29a,0x29a,0x5f1,0x29a,0x29a,0x29a,0x29a,0x29a,
 0x29a,0x29a,0x29a,0x29a,0x29a,0x29a,0x29a,0x29a,0x29a,0x29a,0x29a,0x29a,0x29a,0x29a,0x29a,0x29a,
-0x29a,0x936,0x936,0x936,0x936,0x936,0xbe2,0xbe2,0x2b5,0x2b5,0x2b5,0x2b5,0x2b5,0x2b5,0x2b5,0x2b5,
-0x2b5,0x2ac,0x2ac,0x2ac,0x2ac,0x2ac,0x2ac,0x2ac,0x2a9,0x2a9,0x2a0,0x2a0,0x5f7,0x2a0,0x2ac,0x5fa,
-0x2af,0x5fa,0x5fa,0x5fa,0x2af,0x5fa,0x2ac,0x2ac,0x5fd,0x2b2,0x2a0,0x2a0,0x2a0,0x2a0,0x2a0,0x2a6,
-0x5f4,0x5f4,0x5f4,0x5f4,0x2a3,0x5f4,0x2a0,0xa62,0x2b5,0x2b5,0x2b5,0x2b5,0x2b5,0x2a0,0x2a0,0x2a0,
-0x2a0,0x2a0,0x93f,0x93f,0x93c,0x939,0x93c,0xbe5,0xbe5,0xbe5,0xbe5,0xbe5,0xbe5,0xbe5,0xbe5,0xbe5,
-0xbe5,0xbe5,0xbe5,0xbe5,0xbe5,0xbe5,0xbe5,0xbe5,0x600,0x600,0x600,0x600,0x600,0x600,0x600,0x600,
+0x29a,0x29a,0x29a,0x29a,0x29a,0x29a,0x29a,0x29a,0x29a,0x29d,0x29a,0x29a,0x29a,0x29a,0x29a,0x29a,
+0x29a,0x29a,0x29a,0x29a,0x29a,0x29a,0x29a,0x29a,0x29a,0x29a,0x29a,0x29a,0x29a,0x29a,0x936,0x936,
+0x936,0x936,0x936,0xbe2,0xbe2,0x2b5,0x2b5,0x2b5,0x2b5,0x2b5,0x2b5,0x2b5,0x2b5,0x2b5,0x2ac,0x2ac,
+0x2ac,0x2ac,0x2ac,0x2ac,0x2ac,0x2a9,0x2a9,0x2a0,0x2a0,0x5f7,0x2a0,0x2ac,0x5fa,0x2af,0x5fa,0x5fa,
+0x5fa,0x2af,0x5fa,0x2ac,0x2ac,0x5fd,0x2b2,0x2a0,0x2a0,0x2a0,0x2a0,0x2a0,0x2a6,0x5f4,0x5f4,0x5f4,
+0x5f4,0x2a3,0x5f4,0x2a0,0xa62,0x2b5,0x2b5,0x2b5,0x2b5,0x2b5,0x2a0,0x2a0,0x2a0,0x2a0,0x2a0,0x93f,
+0x93f,0x93c,0x939,0x93c,0xbe5,0xbe5,0xbe5,0xbe5,0xbe5,0xbe5,0xbe5,0xbe5,0xbe5,0xbe5,0xbe5,0xbe5,
+0xbe5,0xbe5,0xbe5,0xbe5,0xbe5,0x600,0x600,0x600,0x600,0x600,0x600,0x600,0x600,0x600,0x600,0x600,
 0x600,0x600,0x600,0x600,0x600,0x600,0x600,0x600,0x600,0x600,0x600,0x600,0x600,0x600,0x600,0x600,
 0x600,0x600,0x600,0x600,0x600,0x600,0x600,0x600,0x600,0x600,0x600,0x600,0x600,0x600,0x600,0x600,
 0x600,0x600,0x600,0x600,0x600,0x600,0x600,0x600,0x600,0x600,0x600,0x600,0x600,0x600,0x600,0x600,
-0x600,0x600,0x600,0x600,0x600,0x600,0x600,0x600,0x603,0x603,0x897,0x603,0x603,0x89a,0xa65,0xa65,
-0xa65,0xa65,0xa65,0xa65,0xa65,0xa65,0xa65,0xb9a,0xca2,0xca2,0xca2,0xca2,0xca2,0xca2,0xca2,0xca2,
-0xdd4,0xdd4,0xdd4,0xdd4,0xdd7,0xca5,0xca5,0xca5,0x606,0x606,0xa68,0xbdc,0xbdc,0xbdc,0xbdc,0xbdc,
-0xbdc,0xbdc,0xbdc,0xbdc,0xbdc,0xbdc,0xbdc,0xbdc,0xeb5,0xeb2,0xeb5,0xeb2,0x2c1,0x2ca,0xeb5,0xeb2,
-6,6,0x2d0,0xe0d,0xe0d,0xe0d,0x2b8,0x13bf,6,6,6,6,0x2cd,0x2bb,0x2df,0x2be,
-0x2df,0x2df,0x2df,6,0x2df,6,0x2df,0x2df,0x2d6,0x60c,0x60c,0x60c,0x60c,0x60c,0x60c,0x60c,
-0x60c,0x60c,0x60c,0x60c,0x60c,0x60c,0x60c,0x60c,0x60c,0x60c,6,0x60c,0x60c,0x60c,0x60c,0x60c,
-0x60c,0x60c,0x2df,0x2df,0x2d6,0x2d6,0x2d6,0x2d6,0x2d6,0x609,0x609,0x609,0x609,0x609,0x609,0x609,
-0x609,0x609,0x609,0x609,0x609,0x609,0x609,0x609,0x609,0x609,0x2d3,0x609,0x609,0x609,0x609,0x609,
-0x609,0x609,0x2d6,0x2d6,0x2d6,0x2d6,0x2d6,0xeb5,0x2e2,0x2e2,0x2e5,0x2df,0x2df,0x2e2,0x2d9,0x942,
-0xaf2,0xaef,0x2dc,0x942,0x2dc,0x942,0x2dc,0x942,0x2dc,0x942,0x2c7,0x2c4,0x2c7,0x2c4,0x2c7,0x2c4,
-0x2c7,0x2c4,0x2c7,0x2c4,0x2c7,0x2c4,0x2c7,0x2c4,0x2e2,0x2e2,0x2d9,0x2d3,0xaa1,0xa9e,0xaec,0xbeb,
-0xbe8,0xbee,0xbeb,0xbe8,0xcd2,0xcd5,0xcd5,0xcd5,0x951,0x618,0x2f4,0x2f7,0x2f4,0x2f4,0x2f4,0x2f7,
-0x2f4,0x2f4,0x2f4,0x2f4,0x2f7,0x951,0x2f7,0x2f4,0x615,0x615,0x615,0x615,0x615,0x615,0x615,0x615,
-0x615,0x618,0x615,0x615,0x615,0x615,0x615,0x615,0x615,0x615,0x615,0x615,0x615,0x615,0x615,0x615,
-0x615,0x615,0x615,0x615,0x615,0x615,0x615,0x615,0x60f,0x60f,0x60f,0x60f,0x60f,0x60f,0x60f,0x60f,
-0x60f,0x612,0x60f,0x60f,0x60f,0x60f,0x60f,0x60f,0x60f,0x60f,0x60f,0x60f,0x60f,0x60f,0x60f,0x60f,
-0x60f,0x60f,0x60f,0x60f,0x94b,0x612,0x2ee,0x2f1,0x2ee,0x2ee,0x2ee,0x2f1,0x2ee,0x2ee,0x2ee,0x2ee,
-0x2f1,0x94b,0x2f1,0x2ee,0x2f4,0x2ee,0x2f4,0x2ee,0x2f4,0x2ee,0x2f4,0x2ee,0x2f4,0x2ee,0x2f4,0x2ee,
-0x2f4,0x2ee,0x2f4,0x2ee,0x2f4,0x2ee,0x2f4,0x2ee,0x2f4,0x2ee,0x2f7,0x2f1,0x2f4,0x2ee,0x2f4,0x2ee,
-0x2f4,0x2ee,0x2f4,0x2ee,0x2f4,0x2ee,0x2eb,0x8a3,0x2e8,0x888,0x888,0x1059,0x945,0x945,0xaf8,0xaf5,
-0x94e,0x948,0x94e,0x948,0x2f4,0x2ee,0x2f4,0x2ee,0x2f4,0x2ee,0x2f4,0x2ee,0x2f4,0x2ee,0x2f4,0x2ee,
-0x2f4,0x2ee,0x2f4,0x2ee,0x2f4,0x2ee,0x2f4,0x2ee,0x2f4,0x2ee,0x2f4,0x2ee,0x2f4,0x2ee,0x2f4,0x2ee,
-0x2f4,0x2ee,0x2f4,0x2ee,0x2f4,0x2ee,0x2f4,0x2ee,0x2f4,0x2ee,0x2f4,0x2ee,0x2f4,0x2ee,0x2f4,0x2ee,
-0x2f4,0x2ee,0x2f4,0x2ee,0x2f4,0x2f7,0x2f1,0x2f4,0x2ee,0xaf8,0xaf5,0x2f4,0x2ee,0xaf8,0xaf5,0x2f4,
-0x2ee,0xaf8,0xaf5,0xe10,0x2f7,0x2f1,0x2f7,0x2f1,0x2f4,0x2ee,0x2f7,0x2f1,0x2f4,0x2ee,0x2f7,0x2f1,
-0x2f7,0x2f1,0x2f7,0x2f1,0x2f4,0x2ee,0x2f7,0x2f1,0x2f7,0x2f1,0x2f7,0x2f1,0x2f4,0x2ee,0x2f7,0x2f1,
-0x951,0x94b,0x2f7,0x2f1,0x2f7,0x2f1,0x2f7,0x2f1,0x2f7,0x2f1,0xcdb,0xcd8,0x2f7,0x2f1,0xe13,0xe10,
-0xe13,0xe10,0xe13,0xe10,0xb5e,0xb5b,0xb5e,0xb5b,0xb5e,0xb5b,0xb5e,0xb5b,0xb5e,0xb5b,0xb5e,0xb5b,
-0xb5e,0xb5b,0xb5e,0xb5b,0xe40,0xe3d,0xe40,0xe3d,0xf33,0xf30,0xf33,0xf30,0xf33,0xf30,0xf33,0xf30,
-0xf33,0xf30,0xf33,0xf30,0xf33,0xf30,0xf33,0xf30,0x1095,0x1092,0x1257,0x1254,0x13f5,0x13f2,0x13f5,0x13f2,
-0x13f5,0x13f2,0x13f5,0x13f2,9,0x306,0x306,0x306,0x306,0x306,0x306,0x306,0x306,0x306,0x306,0x306,
-0x306,0x306,0x306,0x306,0x306,0x306,0x306,0x306,0x306,0x306,0x306,0x306,0x306,0x306,0x306,9,
-9,0x309,0x2fa,0x2fa,0x2fa,0x2fd,0x2fa,0x2fa,9,0x300,0x300,0x300,0x300,0x300,0x300,0x300,
+0x600,0x600,0x600,0x600,0x600,0x603,0x603,0x897,0x603,0x603,0x89a,0xa65,0xa65,0xa65,0xa65,0xa65,
+0xa65,0xa65,0xa65,0xa65,0xb9a,0xca2,0xca2,0xca2,0xca2,0xca2,0xca2,0xca2,0xca2,0xdd4,0xdd4,0xdd4,
+0xdd4,0xdd7,0xca5,0xca5,0xca5,0x606,0x606,0xa68,0xbdc,0xbdc,0xbdc,0xbdc,0xbdc,0xbdc,0xbdc,0xbdc,
+0xbdc,0xbdc,0xbdc,0xbdc,0xbdc,0xeb5,0xeb2,0xeb5,0xeb2,0x2c1,0x2ca,0xeb5,0xeb2,6,6,0x2d0,
+0xe0d,0xe0d,0xe0d,0x2b8,0x13bf,6,6,6,6,0x2cd,0x2bb,0x2df,0x2be,0x2df,0x2df,0x2df,
+6,0x2df,6,0x2df,0x2df,0x2d6,0x60c,0x60c,0x60c,0x60c,0x60c,0x60c,0x60c,0x60c,0x60c,0x60c,
+0x60c,0x60c,0x60c,0x60c,0x60c,0x60c,0x60c,6,0x60c,0x60c,0x60c,0x60c,0x60c,0x60c,0x60c,0x2df,
+0x2df,0x2d6,0x2d6,0x2d6,0x2d6,0x2d6,0x609,0x609,0x609,0x609,0x609,0x609,0x609,0x609,0x609,0x609,
+0x609,0x609,0x609,0x609,0x609,0x2d3,0x609,0x609,0x609,0x609,0x609,0x609,0x609,0x2d6,0x2d6,0x2d6,
+0x2d6,0x2d6,0xeb5,0x2e2,0x2e2,0x2e5,0x2df,0x2df,0x2e2,0x2d9,0x942,0xaf2,0xaef,0x2dc,0x942,0x2dc,
+0x942,0x2dc,0x942,0x2dc,0x942,0x2c7,0x2c4,0x2c7,0x2c4,0x2c7,0x2c4,0x2c7,0x2c4,0x2c7,0x2c4,0x2c7,
+0x2c4,0x2c7,0x2c4,0x2e2,0x2e2,0x2d9,0x2d3,0xaa1,0xa9e,0xaec,0xbeb,0xbe8,0xbee,0xbeb,0xbe8,0xcd2,
+0xcd5,0xcd5,0xcd5,0x951,0x618,0x2f4,0x2f7,0x2f4,0x2f4,0x2f4,0x2f7,0x2f4,0x2f4,0x2f4,0x2f4,0x2f7,
+0x951,0x2f7,0x2f4,0x615,0x615,0x615,0x615,0x615,0x615,0x615,0x615,0x615,0x618,0x615,0x615,0x615,
+0x615,0x615,0x615,0x615,0x615,0x615,0x615,0x615,0x615,0x615,0x615,0x615,0x615,0x615,0x615,0x615,
+0x615,0x615,0x615,0x60f,0x60f,0x60f,0x60f,0x60f,0x60f,0x60f,0x60f,0x60f,0x612,0x60f,0x60f,0x60f,
+0x60f,0x60f,0x60f,0x60f,0x60f,0x60f,0x60f,0x60f,0x60f,0x60f,0x60f,0x60f,0x60f,0x94b,0x612,0x2ee,
+0x2f1,0x2ee,0x2ee,0x2ee,0x2f1,0x2ee,0x2ee,0x2ee,0x2ee,0x2f1,0x94b,0x2f1,0x2ee,0x2f4,0x2ee,0x2f4,
+0x2ee,0x2f4,0x2ee,0x2f4,0x2ee,0x2f4,0x2ee,0x2f4,0x2ee,0x2f4,0x2ee,0x2f4,0x2ee,0x2f4,0x2ee,0x2f4,
+0x2ee,0x2f4,0x2ee,0x2f7,0x2f1,0x2f4,0x2ee,0x2f4,0x2ee,0x2f4,0x2ee,0x2f4,0x2ee,0x2eb,0x8a3,0x2e8,
+0x888,0x888,0x1059,0x945,0x945,0xaf8,0xaf5,0x94e,0x948,0x94e,0x948,0x2f4,0x2ee,0x2f4,0x2ee,0x2f4,
+0x2ee,0x2f4,0x2ee,0x2f4,0x2ee,0x2f4,0x2ee,0x2f4,0x2ee,0x2f4,0x2ee,0x2f4,0x2ee,0x2f4,0x2ee,0x2f4,
+0x2ee,0x2f4,0x2ee,0x2f4,0x2ee,0x2f4,0x2ee,0x2f4,0x2ee,0x2f4,0x2ee,0x2f4,0x2ee,0x2f4,0x2ee,0x2f4,
+0x2ee,0x2f4,0x2ee,0x2f4,0x2ee,0x2f4,0x2ee,0x2f4,0x2ee,0x2f4,0x2ee,0x2f4,0x2f7,0x2f1,0x2f4,0x2ee,
+0xaf8,0xaf5,0x2f4,0x2ee,0xaf8,0xaf5,0x2f4,0x2ee,0xaf8,0xaf5,0xe10,0x2f7,0x2f1,0x2f7,0x2f1,0x2f4,
+0x2ee,0x2f7,0x2f1,0x2f4,0x2ee,0x2f7,0x2f1,0x2f7,0x2f1,0x2f7,0x2f1,0x2f4,0x2ee,0x2f7,0x2f1,0x2f7,
+0x2f1,0x2f7,0x2f1,0x2f4,0x2ee,0x2f7,0x2f1,0x951,0x94b,0x2f7,0x2f1,0x2f7,0x2f1,0x2f7,0x2f1,0x2f7,
+0x2f1,0xcdb,0xcd8,0x2f7,0x2f1,0xe13,0xe10,0xe13,0xe10,0xe13,0xe10,0xb5e,0xb5b,0xb5e,0xb5b,0xb5e,
+0xb5b,0xb5e,0xb5b,0xb5e,0xb5b,0xb5e,0xb5b,0xb5e,0xb5b,0xb5e,0xb5b,0xe40,0xe3d,0xe40,0xe3d,0xf33,
+0xf30,0xf33,0xf30,0xf33,0xf30,0xf33,0xf30,0xf33,0xf30,0xf33,0xf30,0xf33,0xf30,0xf33,0xf30,0x1095,
+0x1092,0x1257,0x1254,0x13f5,0x13f2,0x13f5,0x13f2,0x13f5,0x13f2,0x13f5,0x13f2,9,0x306,0x306,0x306,0x306,
+0x306,0x306,0x306,0x306,0x306,0x306,0x306,0x306,0x306,0x306,0x306,0x306,0x306,0x306,0x306,0x306,
+0x306,0x306,0x306,9,9,0x309,0x2fa,0x2fa,0x2fa,0x2fd,0x2fa,0x2fa,9,0x300,0x300,0x300,
 0x300,0x300,0x300,0x300,0x300,0x300,0x300,0x300,0x300,0x300,0x300,0x300,0x300,0x300,0x300,0x300,
-0x300,0x300,0x300,0x300,0x300,0x300,0x300,0x300,0x300,0x300,0x300,0x303,9,0x813,0x954,9,
-9,0x13c2,0x13c2,0x12de,0xc,0x8c4,0x8c4,0x8c4,0x8c4,0x8c4,0x8c4,0x8c4,0x8c4,0x8c4,0x8c4,0x8c4,
-0x8c4,0x8c4,0x8c4,0x8c4,0x8c4,0x8c4,0xcde,0x8c4,0x8c4,0x8c4,0x8c4,0x8c4,0x8c4,0x8c4,0x8c4,0x8c4,
-0x8c4,0x8c4,0x8c4,0x8c4,0x30c,0x30c,0x30c,0x30c,0x30c,0x30c,0x30c,0x30c,0x30c,0x30c,0xe16,0x30c,
-0x30c,0x30c,0x318,0x30c,0x30f,0x30c,0x30c,0x31b,0x8c7,0xce1,0xce4,0xce1,0xc,0xc,0xc,0xc,
-0xc,0xc,0xc,0xc,0x31e,0x31e,0x31e,0x31e,0x31e,0x31e,0x31e,0x31e,0x31e,0x31e,0x31e,0x31e,
-0x31e,0x31e,0x31e,0x31e,0x31e,0x31e,0x31e,0x31e,0x31e,0x31e,0x31e,0x31e,0x31e,0x31e,0x31e,0xc,
-0xc,0xc,0xc,0xc,0x31e,0x31e,0x31e,0x315,0x312,0xc,0xc,0xc,0xc,0xc,0xc,0xc,
-0xc,0xc,0xc,0xc,0xbf1,0xbf1,0xbf1,0xbf1,0x12e1,0x13c5,0xebe,0xebe,0xebe,0xebb,0xebb,0xced,
-0x819,0xc00,0xbfd,0xbfd,0xbf4,0xbf4,0xbf4,0xbf4,0xbf4,0xbf4,0xeb8,0xeb8,0xeb8,0xeb8,0xeb8,0x816,
-0x13b9,0xf,0xcea,0x81c,0x121b,0x339,0x33c,0x33c,0x33c,0x33c,0x33c,0x339,0x339,0x339,0x339,0x339,
-0x339,0x339,0x339,0x339,0x339,0x339,0x339,0x339,0x339,0x339,0x339,0x339,0x339,0x339,0x339,0xec1,
-0xec1,0xec1,0xec1,0xec1,0x81f,0x339,0x339,0x339,0x339,0x339,0x339,0x339,0x339,0x339,0x339,0x88e,
-0x88e,0x88e,0x88e,0x88e,0x88e,0x88e,0x88e,0xa98,0xa98,0xa98,0xbf4,0xbfa,0xbf7,0xce7,0xce7,0xce7,
-0xce7,0xce7,0xce7,0x1218,0x8a6,0x8a6,0x8a6,0x8a6,0x8a6,0x8a6,0x8a6,0x8a6,0x8a6,0x8a6,0x333,0x330,
-0x32d,0x32a,0xafb,0xafb,0x88b,0x339,0x339,0x345,0x339,0x33f,0x33f,0x33f,0x33f,0x339,0x339,0x339,
+0x300,0x300,0x300,0x300,0x300,0x300,0x300,0x300,0x300,0x300,0x300,0x300,0x303,9,0x813,0x954,
+9,9,0x13c2,0x13c2,0x12de,0xc,0x8c4,0x8c4,0x8c4,0x8c4,0x8c4,0x8c4,0x8c4,0x8c4,0x8c4,0x8c4,
+0x8c4,0x8c4,0x8c4,0x8c4,0x8c4,0x8c4,0x8c4,0xcde,0x8c4,0x8c4,0x8c4,0x8c4,0x8c4,0x8c4,0x8c4,0x8c4,
+0x8c4,0x8c4,0x8c4,0x8c4,0x8c4,0x30c,0x30c,0x30c,0x30c,0x30c,0x30c,0x30c,0x30c,0x30c,0x30c,0xe16,
+0x30c,0x30c,0x30c,0x318,0x30c,0x30f,0x30c,0x30c,0x31b,0x8c7,0xce1,0xce4,0xce1,0xc,0xc,0xc,
+0xc,0xc,0xc,0xc,0xc,0x31e,0x31e,0x31e,0x31e,0x31e,0x31e,0x31e,0x31e,0x31e,0x31e,0x31e,
+0x31e,0x31e,0x31e,0x31e,0x31e,0x31e,0x31e,0x31e,0x31e,0x31e,0x31e,0x31e,0x31e,0x31e,0x31e,0x31e,
+0xc,0xc,0xc,0xc,0xc,0x31e,0x31e,0x31e,0x315,0x312,0xc,0xc,0xc,0xc,0xc,0xc,
+0xc,0xc,0xc,0xc,0xc,0xbf1,0xbf1,0xbf1,0xbf1,0x12e1,0x13c5,0xebe,0xebe,0xebe,0xebb,0xebb,
+0xced,0x819,0xc00,0xbfd,0xbfd,0xbf4,0xbf4,0xbf4,0xbf4,0xbf4,0xbf4,0xeb8,0xeb8,0xeb8,0xeb8,0xeb8,
+0x816,0x13b9,0xf,0xcea,0x81c,0x121b,0x339,0x33c,0x33c,0x33c,0x33c,0x33c,0x339,0x339,0x339,0x339,
 0x339,0x339,0x339,0x339,0x339,0x339,0x339,0x339,0x339,0x339,0x339,0x339,0x339,0x339,0x339,0x339,
+0xec1,0xec1,0xec1,0xec1,0xec1,0x81f,0x339,0x339,0x339,0x339,0x339,0x339,0x339,0x339,0x339,0x339,
+0x88e,0x88e,0x88e,0x88e,0x88e,0x88e,0x88e,0x88e,0xa98,0xa98,0xa98,0xbf4,0xbfa,0xbf7,0xce7,0xce7,
+0xce7,0xce7,0xce7,0xce7,0x1218,0x8a6,0x8a6,0x8a6,0x8a6,0x8a6,0x8a6,0x8a6,0x8a6,0x8a6,0x8a6,0x333,
+0x330,0x32d,0x32a,0xafb,0xafb,0x88b,0x339,0x339,0x345,0x339,0x33f,0x33f,0x33f,0x33f,0x339,0x339,
 0x339,0x339,0x339,0x339,0x339,0x339,0x339,0x339,0x339,0x339,0x339,0x339,0x339,0x339,0x339,0x339,
 0x339,0x339,0x339,0x339,0x339,0x339,0x339,0x339,0x339,0x339,0x339,0x339,0x339,0x339,0x339,0x339,
-0x339,0x339,0x339,0x339,0x339,0x339,0x339,0x339,0x95a,0x95a,0x339,0x339,0x339,0x339,0x339,0x95a,
-0x33c,0x339,0x33c,0x339,0x339,0x339,0x339,0x339,0x339,0x339,0x339,0x339,0x339,0x339,0x339,0x95a,
-0x339,0x339,0x339,0x33c,0x348,0x339,0x324,0x324,0x324,0x324,0x324,0x324,0x324,0x321,0x32a,0x327,
-0x327,0x324,0x324,0x324,0x324,0x342,0x342,0x324,0x324,0x32a,0x327,0x327,0x327,0x324,0xc03,0xc03,
-0x336,0x336,0x336,0x336,0x336,0x336,0x336,0x336,0x336,0x336,0x95a,0x95a,0x95a,0x957,0x957,0xc03,
-0x972,0x972,0x972,0x96c,0x96c,0x96c,0x96c,0x96c,0x96c,0x96c,0x96c,0x969,0x96c,0x969,0x12,0x95d,
-0x96f,0x960,0x96f,0x96f,0x96f,0x96f,0x96f,0x96f,0x96f,0x96f,0x96f,0x96f,0x96f,0x96f,0x96f,0x96f,
-0x96f,0x96f,0x96f,0x96f,0x96f,0x96f,0x96f,0x96f,0x96f,0x96f,0x96f,0x96f,0x96f,0xc06,0xc06,0xc06,
-0x966,0x966,0x966,0x966,0x966,0x966,0x966,0x966,0x966,0x966,0x966,0x966,0x966,0x966,0x966,0x966,
-0x963,0x963,0x963,0x963,0x963,0x963,0x963,0x963,0x963,0x963,0x963,0x12,0x12,0xc06,0xc06,0xc06,
+0x339,0x339,0x339,0x339,0x339,0x339,0x339,0x339,0x339,0x339,0x339,0x339,0x339,0x339,0x339,0x339,
+0x339,0x339,0x339,0x339,0x339,0x339,0x95a,0x95a,0x339,0x339,0x339,0x339,0x339,0x95a,0x33c,0x339,
+0x33c,0x339,0x339,0x339,0x339,0x339,0x339,0x339,0x339,0x339,0x339,0x339,0x339,0x95a,0x339,0x339,
+0x339,0x33c,0x348,0x339,0x324,0x324,0x324,0x324,0x324,0x324,0x324,0x321,0x32a,0x327,0x327,0x324,
+0x324,0x324,0x324,0x342,0x342,0x324,0x324,0x32a,0x327,0x327,0x327,0x324,0xc03,0xc03,0x336,0x336,
+0x336,0x336,0x336,0x336,0x336,0x336,0x336,0x336,0x95a,0x95a,0x95a,0x957,0x957,0xc03,0x972,0x972,
+0x972,0x96c,0x96c,0x96c,0x96c,0x96c,0x96c,0x96c,0x96c,0x969,0x96c,0x969,0x12,0x95d,0x96f,0x960,
+0x96f,0x96f,0x96f,0x96f,0x96f,0x96f,0x96f,0x96f,0x96f,0x96f,0x96f,0x96f,0x96f,0x96f,0x96f,0x96f,
+0x96f,0x96f,0x96f,0x96f,0x96f,0x96f,0x96f,0x96f,0x96f,0x96f,0x96f,0xc06,0xc06,0xc06,0x966,0x966,
+0x966,0x966,0x966,0x966,0x966,0x966,0x966,0x966,0x966,0x966,0x966,0x966,0x966,0x966,0x963,0x963,
+0x963,0x963,0x963,0x963,0x963,0x963,0x963,0x963,0x963,0x12,0x12,0xc06,0xc06,0xc06,0xd4a,0xd4a,
 0xd4a,0xd4a,0xd4a,0xd4a,0xd4a,0xd4a,0xd4a,0xd4a,0xd4a,0xd4a,0xd4a,0xd4a,0xd4a,0xd4a,0xd4a,0xd4a,
-0xd4a,0xd4a,0xd4a,0xd4a,0xd4a,0xd4a,0xd4a,0xd4a,0xd4a,0xd4a,0xd4a,0xd4a,0xd4a,0xd4a,0xf45,0xf45,
-0xf45,0xf45,0xf45,0xf45,0xf45,0xf45,0xf45,0xf45,0xf45,0xf45,0xf45,0xf45,0xf45,0xf45,0xf45,0xf45,
+0xd4a,0xd4a,0xd4a,0xd4a,0xd4a,0xd4a,0xd4a,0xd4a,0xd4a,0xd4a,0xd4a,0xd4a,0xf45,0xf45,0xf45,0xf45,
+0xf45,0xf45,0xf45,0xf45,0xf45,0xf45,0xf45,0xf45,0xf45,0xf45,0xf45,0xf45,0xf45,0xf45,0x978,0x978,
 0x978,0x978,0x978,0x978,0x978,0x978,0x978,0x978,0x978,0x978,0x978,0x978,0x978,0x978,0x978,0x978,
 0x978,0x978,0x978,0x978,0x978,0x978,0x978,0x978,0x978,0x978,0x978,0x978,0x978,0x978,0x978,0x978,
-0x978,0x978,0x978,0x978,0x978,0x978,0x975,0x975,0x975,0x975,0x975,0x975,0x975,0x975,0x975,0x975,
-0x975,0xafe,0x15,0x15,0x15,0x15,0x15,0x15,0x15,0x15,0x15,0x15,0x15,0x15,0x15,0x15,
-0xe58,0xe58,0xe58,0xe58,0xe58,0xe58,0xe58,0xe58,0xe58,0xe58,0xe5b,0xe5b,0xe5b,0xe5b,0xe5b,0xe5b,
+0x978,0x978,0x978,0x978,0x975,0x975,0x975,0x975,0x975,0x975,0x975,0x975,0x975,0x975,0x975,0xafe,
+0x15,0x15,0x15,0x15,0x15,0x15,0x15,0x15,0x15,0x15,0x15,0x15,0x15,0x15,0xe58,0xe58,
+0xe58,0xe58,0xe58,0xe58,0xe58,0xe58,0xe58,0xe58,0xe5b,0xe5b,0xe5b,0xe5b,0xe5b,0xe5b,0xe5b,0xe5b,
 0xe5b,0xe5b,0xe5b,0xe5b,0xe5b,0xe5b,0xe5b,0xe5b,0xe5b,0xe5b,0xe5b,0xe5b,0xe5b,0xe5b,0xe5b,0xe5b,
-0xe5b,0xe5b,0xe5b,0xe5b,0xe5b,0xe5b,0xe5b,0xe5b,0xe5b,0xe5b,0xe5b,0xe4f,0xe4f,0xe4f,0xe4f,0xe4f,
-0xe4f,0xe4f,0xe4f,0xe4f,0xe5e,0xe5e,0xe52,0xe52,0xe55,0xe64,0xe61,0x10e,0x10e,0x10e,0x10e,0x10e,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0xa74,0xa74,0xa77,0xa77,0xa74,0xa74,0xa74,0xa74,0xa74,0xa74,0xa74,0xa74,0x72,0x72,0x72,0x72,
-0xc96,0xc96,0xc96,0xc96,0xc96,0xc96,0xc96,0xc96,0xc96,0xc96,0xd2,0xd2,0xd2,0xd2,0xd2,0xd2,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0x146d,0x146d,0x146d,0x146d,0x1cb,0x1cb,0x1cb,0x1cb,0x1cb,0x1cb,0x1cb,0x1cb,0x1cb,0x1cb,0x1cb,0x146a,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0x1fe,0x1fe,0x1fe,0x1fe,0x1fe,0x1fe,0x1fe,0x1527,0x1527,0x1527,0x1527,0x1527,0x1527,0x1527,0x1527,0x1527,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0x20a,0x20a,0x20a,0x20a,0x20a,0x20a,0x20a,0x20a,0x20a,0x1560,0x1560,0x1560,0x1560,0x1560,0x1560,0x1560,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0x1185,0x1185,0x1185,0x1185,0x1185,0x1185,0x1185,0x1185,0x1185,0x17a,0x17a,0x17a,0x17a,0x17a,0x17a,0x17a,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0x1e0,0x1e0,0x1e0,0x1e0,0x1e0,0x1e0,0x1e0,0x1e0,0x1e0,0x1e0,0x1e0,0x1e0,0x1e0,0x1e0,0x1e0,0x1e0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0x1398,0x1398,0x1398,0x1398,0x1398,0x1398,0x1398,0x1398,0x1398,0x1398,0x1c5,0x1c5,0x1c5,0x1c5,0x1c5,0x1c5,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0x164d,0x164d,0x164d,0x164d,0x225,0x225,0x225,0x225,0x225,0x225,0x225,0x225,0x225,0x225,0x225,0x225,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0x11a9,0x11a9,0x11a9,0x11a9,0x11a9,0x11a9,0x11a9,0x11a9,0x11a9,0x11a9,0x11a9,0x11a9,0x11a9,0x11a9,0x11a9,0x183,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0x1512,0x1512,0x1512,0x1512,0x1512,0x1512,0x1512,0x1512,0x1512,0x1512,0x1f8,0x1f8,0x1f8,0x1f8,0x1518,0x1518,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0x1464,0x1464,0x1464,0x1464,0x1464,0x1464,0x1464,0x1464,0x1464,0x1464,0x1464,0x1464,0x1464,0x1464,0x1464,0x1464,
-0x154e,0x154e,0x154e,0x154e,0x154e,0x154e,0x154e,0x154e,0x154e,0x154e,0x154e,0x154e,0x154e,0x154e,0x154e,0x154e,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0x15b7,0x15b7,0x15b7,0x15b7,0x20d,0x20d,0x20d,0x20d,0x20d,0x20d,0x20d,0x20d,0x20d,0x20d,0x20d,0x20d,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0xd41,0xd41,0xd3e,0xd3e,0xd3e,0xd41,0xdb,0xdb,0xdb,0xdb,0xdb,0xdb,0xdb,0xdb,0xdb,0xdb,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0x234,0x1668,0x1668,0x1668,0x1668,0x1668,0x1668,0x1668,0x1668,0x1668,0x1668,0x1668,0x1668,0x1668,0x1668,0x1668,
+0xe5b,0xe5b,0xe5b,0xe5b,0xe5b,0xe5b,0xe5b,0xe5b,0xe5b,0xe4f,0xe4f,0xe4f,0xe4f,0xe4f,0xe4f,0xe4f,
+0xe4f,0xe4f,0xe5e,0xe5e,0xe52,0xe52,0xe55,0xe64,0xe61,0x10e,0x10e,0x10e,0x10e,0x10e,0x10bf,0x10bf,
+0x10bf,0x10bf,0x10bf,0x10bf,0x10bf,0x10bf,0x10bf,0x10bf,0x10bf,0x10bf,0x10bf,0x10bf,0x10bf,0x10bf,0x10bf,0x10bf,
+0x10bf,0x10bf,0x10bf,0x10bf,0x10b6,0x10b6,0x10b9,0x10b9,0x10bf,0x10b6,0x10b6,0x10b6,0x10b6,0x10b6,0x10b6,0x10b6,
+0x10b6,0x10b6,0x10bf,0x10b6,0x10b6,0x10b6,0x10bf,0x10b6,0x10b6,0x10b6,0x10b6,0x10b3,0x14a,0x14a,0x10bc,0x10bc,
+0x10bc,0x10bc,0x10bc,0x10bc,0x10bc,0x10bc,0x10bc,0x10bc,0x10bc,0x10bc,0x10bc,0x10bc,0x10bc,0x14a,0x127b,0x127b,
+0x127b,0x127b,0x127b,0x127b,0x127b,0x127b,0x127b,0x127b,0x127b,0x127b,0x127b,0x127b,0x127b,0x127b,0x127b,0x127b,
+0x127b,0x127b,0x127b,0x127b,0x127b,0x127b,0x127b,0x1275,0x1275,0x1275,0x18c,0x18c,0x1278,0x18c,0,0,
 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0x8c1,0x8c1,
-3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
-3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
-0xcae,0xcae,0xcae,0xcae,0xcae,0xcae,0xcae,0xcae,0xcae,0xcae,0xcae,0xcae,0xcae,0xcae,0xcae,0xcae,
-3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
-0x13cb,0x360,0x36f,0x36f,0x18,0x375,0x375,0x375,0x375,0x375,0x375,0x375,0x375,0x18,0x18,0x375,
-0x375,0x18,0x18,0x375,0x375,0x375,0x375,0x375,0x375,0x375,0x375,0x375,0x375,0x375,0x375,0x375,
-0x375,0x18,0x375,0x375,0x375,0x375,0x375,0x375,0x375,0x18,0x375,0x18,0x18,0x18,0x375,0x375,
-0x375,0x375,0x18,0x18,0x363,0xc0c,0x360,0x36f,0x36f,0x360,0x360,0x360,0x360,0x18,0x18,0x36f,
-0x36f,0x18,0x18,0x372,0x372,0x366,0xcf3,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x360,
-0x18,0x18,0x18,0x18,0x378,0x378,0x18,0x378,0x375,0x375,0x360,0x360,0x18,0x18,0x8ac,0x8ac,
-0x8ac,0x8ac,0x8ac,0x8ac,0x8ac,0x8ac,0x8ac,0x8ac,0x375,0x375,0x36c,0x36c,0x369,0x369,0x369,0x369,
-0x369,0x36c,0x369,0x1068,0x18,0x18,0x18,0x18,0x1b,0xc0f,0x37b,0xc12,0x1b,0x387,0x387,0x387,
-0x387,0x387,0x387,0x1b,0x1b,0x1b,0x1b,0x387,0x387,0x1b,0x1b,0x387,0x387,0x387,0x387,0x387,
-0x387,0x387,0x387,0x387,0x387,0x387,0x387,0x387,0x387,0x1b,0x387,0x387,0x387,0x387,0x387,0x387,
-0x387,0x1b,0x387,0x38a,0x1b,0x387,0x38a,0x1b,0x387,0x387,0x1b,0x1b,0x37e,0x1b,0x384,0x384,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0x132c,0x1458,
+0x132c,0x132c,0x132c,0x132c,0x132c,0x132c,0x132c,0x132c,0x132c,0x132c,0x132c,0x1458,0x1458,0x1458,0x1458,0x1458,
+0x1458,0x1602,0x1602,0x1aa,0x1aa,0x1aa,0x1aa,0x1aa,0x1aa,0x1aa,0x1aa,0x1aa,0x1aa,0x1aa,0x1aa,0x1aa,
+0x1aa,0x1aa,0x1aa,0x1aa,0x1aa,0x1aa,0x1aa,0x1aa,0x1aa,0x1aa,0x1aa,0x1aa,0x1aa,0x1aa,0x1aa,0x1aa,
+0x1aa,0x1aa,0x1aa,0x1aa,0x1aa,0x1aa,0x15ff,0x1329,0x1329,0x1329,0x1329,0x1329,0x1329,0x1326,0x1326,0x1326,
+0x1326,0x1326,0x1326,0x1329,0x1329,0x1329,0x1329,0x1329,0x1329,0x1329,0x1329,0x1329,0x1329,0x1329,0x1329,0x1329,
+0x1329,0x1329,0x1455,0x105f,0x34b,0x34b,0x357,0xc09,0x35a,0x35a,0x35a,0x35a,0x35a,0x35a,0x35a,0x35a,
+0x35a,0x35a,0x35a,0x35a,0x35a,0x35a,0x35a,0x35a,0x35a,0x35a,0x35a,0x35a,0x35a,0x35a,0x35a,0x35a,
+0x35a,0x35a,0x35a,0x35a,0x35a,0x35a,0x35a,0x35a,0x35a,0x35a,0x35a,0x35a,0x35d,0x35a,0x35a,0x35a,
+0x35a,0x35a,0x35a,0x35a,0x35d,0x35a,0x35a,0x35d,0x35a,0x35a,0x35a,0x35a,0x35a,0x121e,0x1221,0x34e,
+0x35a,0x357,0x357,0x34b,0x34b,0x34b,0x34b,0x34b,0x34b,0x34b,0x34b,0x357,0x357,0x357,0x357,0x351,
+0x1062,0x1221,0x35a,0x891,0x894,0x34e,0x34e,0x105f,0x121e,0x121e,0x35d,0x35d,0x35d,0x35d,0x35d,0x35d,
+0x35d,0x35d,0x35a,0x35a,0x34b,0x34b,0x822,0x825,0x8a9,0x8a9,0x8a9,0x8a9,0x8a9,0x8a9,0x8a9,0x8a9,
+0x8a9,0x8a9,0x354,0xec7,0xec4,0x1224,0x1224,0x1224,0x1224,0x1224,0x13c8,0x1065,0x1065,0xe19,0xe19,0xcf0,
+0xe19,0xe19,0x13cb,0x360,0x36f,0x36f,0x18,0x375,0x375,0x375,0x375,0x375,0x375,0x375,0x375,0x18,
+0x18,0x375,0x375,0x18,0x18,0x375,0x375,0x375,0x375,0x375,0x375,0x375,0x375,0x375,0x375,0x375,
+0x375,0x375,0x375,0x375,0x375,0x375,0x375,0x375,0x375,0x375,0x375,0x18,0x375,0x375,0x375,0x375,
+0x375,0x375,0x375,0x18,0x375,0x18,0x18,0x18,0x375,0x375,0x375,0x375,0x18,0x18,0x363,0xc0c,
+0x360,0x36f,0x360,0x360,0x360,0x360,0x18,0x18,0x36f,0x36f,0x18,0x18,0x372,0x372,0x366,0xcf3,
+0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x360,0x18,0x18,0x18,0x18,0x378,0x378,0x18,
+0x378,0x375,0x375,0x360,0x360,0x18,0x18,0x8ac,0x8ac,0x8ac,0x8ac,0x8ac,0x8ac,0x8ac,0x8ac,0x8ac,
+0x8ac,0x375,0x375,0x36c,0x36c,0x369,0x369,0x369,0x369,0x369,0x36c,0x369,0x1068,0x18,0x18,0x18,
+0x18,0x1b,0xc0f,0x37b,0xc12,0x1b,0x387,0x387,0x387,0x387,0x387,0x387,0x1b,0x1b,0x1b,0x1b,
+0x387,0x387,0x1b,0x1b,0x387,0x387,0x387,0x387,0x387,0x387,0x387,0x387,0x387,0x387,0x387,0x387,
+0x387,0x387,0x387,0x387,0x387,0x387,0x387,0x387,0x387,0x387,0x1b,0x387,0x387,0x387,0x387,0x387,
+0x387,0x387,0x1b,0x387,0x38a,0x1b,0x387,0x38a,0x1b,0x387,0x387,0x1b,0x1b,0x37e,0x1b,0x384,
 0x384,0x37b,0x37b,0x1b,0x1b,0x1b,0x1b,0x37b,0x37b,0x1b,0x1b,0x37b,0x37b,0x381,0x1b,0x1b,
 0x1b,0xeca,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x38a,0x38a,0x38a,0x387,0x1b,0x38a,0x1b,
 0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x8af,0x8af,0x8af,0x8af,0x8af,0x8af,0x8af,0x8af,0x8af,0x8af,
 0x37b,0x37b,0x387,0x387,0x387,0xeca,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
 0x1e,0x38d,0x38d,0x396,0x1e,0x399,0x399,0x399,0x399,0x399,0x399,0x399,0xc1b,0x399,0x1e,0x399,
 0x399,0x399,0x1e,0x399,0x399,0x399,0x399,0x399,0x399,0x399,0x399,0x399,0x399,0x399,0x399,0x399,
-0x399,0x1e,0x399,0x399,0x399,0x399,0x399,0x399,0x399,0x1e,0x399,0x399,0x1e,0x399,0x399,0x399,
-0x399,0x399,0x1e,0x1e,0x390,0x399,0x396,0x396,0x396,0x38d,0x38d,0x38d,0x38d,0x38d,0x1e,0x38d,
-0x38d,0x396,0x1e,0x396,0x396,0x393,0x1e,0x1e,0x399,0x1e,0x1e,0x1e,0x1e,0x1e,0x1e,0x1e,
-0x1e,0x1e,0x1e,0x1e,0x1e,0x1e,0x1e,0x1e,0x399,0xc1b,0xc15,0xc15,0x1e,0x1e,0x8b2,0x8b2,
-0x8b2,0x8b2,0x8b2,0x8b2,0x8b2,0x8b2,0x8b2,0x8b2,0x12e4,0xc18,0x1e,0x1e,0x1e,0x1e,0x1e,0x1e,
-0x1e,0x15c0,0x1e,0x1e,0x1e,0x1e,0x1e,0x1e,0x21,0x39c,0x3ab,0x3ab,0x21,0x3b1,0x3b1,0x3b1,
-0x3b1,0x3b1,0x3b1,0x3b1,0x3b1,0x21,0x21,0x3b1,0x3b1,0x21,0x21,0x3b1,0x3b1,0x3b1,0x3b1,0x3b1,
-0x3b1,0x3b1,0x3b1,0x3b1,0x3b1,0x3b1,0x3b1,0x3b1,0x3b1,0x21,0x3b1,0x3b1,0x3b1,0x3b1,0x3b1,0x3b1,
-0x3b1,0x21,0x3b1,0x3b1,0x21,0xc1e,0x3b1,0x3b1,0x3b1,0x3b1,0x21,0x21,0x39f,0x3b1,0x39c,0x39c,
-0x3ab,0x39c,0x39c,0x39c,0xecd,0x21,0x21,0x3ab,0x3ae,0x21,0x21,0x3ae,0x3ae,0x3a2,0x21,0x21,
-0x21,0x21,0x21,0x21,0x21,0x21,0x39c,0x39c,0x21,0x21,0x21,0x21,0x3b4,0x3b4,0x21,0x3b1,
-0x3b1,0x3b1,0xecd,0xecd,0x21,0x21,0x3a8,0x3a8,0x3a8,0x3a8,0x3a8,0x3a8,0x3a8,0x3a8,0x3a8,0x3a8,
-0x3a5,0xc1e,0x1227,0x1227,0x1227,0x1227,0x1227,0x1227,0x21,0x21,0x21,0x21,0x21,0x21,0x21,0x21,
-0x24,0x24,0x3b7,0x3c3,0x24,0x3c3,0x3c3,0x3c3,0x3c3,0x3c3,0x3c3,0x24,0x24,0x24,0x3c3,0x3c3,
-0x3c3,0x24,0x3c3,0x3c3,0x3c6,0x3c3,0x24,0x24,0x24,0x3c3,0x3c3,0x24,0x3c3,0x24,0x3c3,0x3c3,
-0x24,0x24,0x24,0x3c3,0x3c3,0x24,0x24,0x24,0x3c3,0x3c3,0x8bb,0x24,0x24,0x24,0x3c3,0x3c3,
-0x3c3,0x3c3,0x3c3,0x3c3,0x3c3,0x8bb,0xcf6,0x3c3,0x3c3,0x3c3,0x24,0x24,0x24,0x24,0x3b7,0x3bd,
-0x3b7,0x3bd,0x3bd,0x24,0x24,0x24,0x3bd,0x3bd,0x3bd,0x24,0x3c0,0x3c0,0x3c0,0x3ba,0x24,0x24,
-0xed0,0x24,0x24,0x24,0x24,0x24,0x24,0x3b7,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,
-0x24,0x24,0xe04,0x8b8,0x8b8,0x8b8,0x8b8,0x8b8,0x8b8,0x8b8,0x8b8,0x8b8,0x8b5,0x8b5,0x8b5,0xc21,
-0xc21,0xc21,0xc21,0xc21,0xc21,0xc24,0xc21,0x24,0x24,0x24,0x24,0x24,0x13ce,0x3d5,0x3d5,0x3d5,
-0x27,0x3d8,0x3d8,0x3d8,0x3d8,0x3d8,0x3d8,0x3d8,0x3d8,0x27,0x3d8,0x3d8,0x3d8,0x27,0x3d8,0x3d8,
-0x3d8,0x3d8,0x3d8,0x3d8,0x3d8,0x3d8,0x3d8,0x3d8,0x3d8,0x3d8,0x3d8,0x3d8,0x3d8,0x27,0x3d8,0x3d8,
-0x3d8,0x3d8,0x3d8,0x3d8,0x3d8,0x3d8,0x3d8,0x3d8,0x13d1,0x3d8,0x3d8,0x3d8,0x3d8,0x3d8,0x27,0x27,
-0x27,0xed9,0x3c9,0x3c9,0x3c9,0x3d5,0x3d5,0x3d5,0x3d5,0x27,0x3c9,0x3c9,0x3cc,0x27,0x3c9,0x3c9,
-0x3c9,0x3cf,0x27,0x27,0x27,0x27,0x27,0x27,0x27,0x3c9,0x3c9,0x27,0xed9,0xed9,0x15c3,0x27,
-0x27,0x27,0x27,0x27,0x3d8,0x3d8,0xed3,0xed3,0x27,0x27,0x3d2,0x3d2,0x3d2,0x3d2,0x3d2,0x3d2,
-0x3d2,0x3d2,0x3d2,0x3d2,0x27,0x27,0x27,0x27,0x27,0x27,0x27,0x27,0xed6,0xed6,0xed6,0xed6,
-0xed6,0xed6,0xed6,0xed6,0x2a,0x13d4,0x3e4,0x3e4,0x2a,0x3ea,0x3ea,0x3ea,0x3ea,0x3ea,0x3ea,0x3ea,
-0x3ea,0x2a,0x3ea,0x3ea,0x3ea,0x2a,0x3ea,0x3ea,0x3ea,0x3ea,0x3ea,0x3ea,0x3ea,0x3ea,0x3ea,0x3ea,
+0x399,0x399,0x399,0x399,0x399,0x399,0x399,0x399,0x399,0x1e,0x399,0x399,0x399,0x399,0x399,0x399,
+0x399,0x1e,0x399,0x399,0x1e,0x399,0x399,0x399,0x399,0x399,0x1e,0x1e,0x390,0x399,0x396,0x396,
+0x38d,0x38d,0x38d,0x38d,0x38d,0x1e,0x38d,0x38d,0x396,0x1e,0x396,0x396,0x393,0x1e,0x1e,0x399,
+0x1e,0x1e,0x1e,0x1e,0x1e,0x1e,0x1e,0x1e,0x1e,0x1e,0x1e,0x1e,0x1e,0x1e,0x1e,0x399,
+0xc1b,0xc15,0xc15,0x1e,0x1e,0x8b2,0x8b2,0x8b2,0x8b2,0x8b2,0x8b2,0x8b2,0x8b2,0x8b2,0x8b2,0x12e4,
+0xc18,0x1e,0x1e,0x1e,0x1e,0x1e,0x1e,0x1e,0x15c0,0x1e,0x1e,0x1e,0x1e,0x1e,0x1e,0x21,
+0x39c,0x3ab,0x3ab,0x21,0x3b1,0x3b1,0x3b1,0x3b1,0x3b1,0x3b1,0x3b1,0x3b1,0x21,0x21,0x3b1,0x3b1,
+0x21,0x21,0x3b1,0x3b1,0x3b1,0x3b1,0x3b1,0x3b1,0x3b1,0x3b1,0x3b1,0x3b1,0x3b1,0x3b1,0x3b1,0x3b1,
+0x3b1,0x3b1,0x3b1,0x3b1,0x3b1,0x3b1,0x3b1,0x3b1,0x21,0x3b1,0x3b1,0x3b1,0x3b1,0x3b1,0x3b1,0x3b1,
+0x21,0x3b1,0x3b1,0x21,0xc1e,0x3b1,0x3b1,0x3b1,0x3b1,0x21,0x21,0x39f,0x3b1,0x39c,0x39c,0x3ab,
+0x39c,0x39c,0x39c,0xecd,0x21,0x21,0x3ab,0x3ae,0x21,0x21,0x3ae,0x3ae,0x3a2,0x21,0x21,0x21,
+0x21,0x21,0x21,0x21,0x21,0x39c,0x39c,0x21,0x21,0x21,0x21,0x3b4,0x3b4,0x21,0x3b1,0x3b1,
+0x3b1,0xecd,0xecd,0x21,0x21,0x3a8,0x3a8,0x3a8,0x3a8,0x3a8,0x3a8,0x3a8,0x3a8,0x3a8,0x3a8,0x3a5,
+0xc1e,0x1227,0x1227,0x1227,0x1227,0x1227,0x1227,0x21,0x21,0x21,0x21,0x21,0x21,0x21,0x21,0x24,
+0x24,0x3b7,0x3c3,0x24,0x3c3,0x3c3,0x3c3,0x3c3,0x3c3,0x3c3,0x24,0x24,0x24,0x3c3,0x3c3,0x3c3,
+0x24,0x3c3,0x3c3,0x3c6,0x3c3,0x24,0x24,0x24,0x3c3,0x3c3,0x24,0x3c3,0x24,0x3c3,0x3c3,0x24,
+0x24,0x24,0x3c3,0x3c3,0x24,0x24,0x24,0x3c3,0x3c3,0x8bb,0x24,0x24,0x24,0x3c3,0x3c3,0x3c3,
+0x3c3,0x3c3,0x3c3,0x3c3,0x8bb,0xcf6,0x3c3,0x3c3,0x3c3,0x24,0x24,0x24,0x24,0x3b7,0x3bd,0x3bd,
+0x24,0x24,0x24,0x3bd,0x3bd,0x3bd,0x24,0x3c0,0x3c0,0x3c0,0x3ba,0x24,0x24,0xed0,0x24,0x24,
+0x24,0x24,0x24,0x24,0x3b7,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,
+0x24,0x24,0x24,0xe04,0x8b8,0x8b8,0x8b8,0x8b8,0x8b8,0x8b8,0x8b8,0x8b8,0x8b8,0x8b5,0x8b5,0x8b5,
+0xc21,0xc21,0xc21,0xc21,0xc21,0xc21,0xc24,0xc21,0x24,0x24,0x24,0x24,0x24,0x13ce,0x3d5,0x3d5,
+0x3d5,0x27,0x3d8,0x3d8,0x3d8,0x3d8,0x3d8,0x3d8,0x3d8,0x3d8,0x27,0x3d8,0x3d8,0x3d8,0x27,0x3d8,
+0x3d8,0x3d8,0x3d8,0x3d8,0x3d8,0x3d8,0x3d8,0x3d8,0x3d8,0x3d8,0x3d8,0x3d8,0x3d8,0x3d8,0x3d8,0x3d8,
+0x3d8,0x3d8,0x3d8,0x3d8,0x3d8,0x3d8,0x27,0x3d8,0x3d8,0x3d8,0x3d8,0x3d8,0x3d8,0x3d8,0x3d8,0x3d8,
+0x3d8,0x13d1,0x3d8,0x3d8,0x3d8,0x3d8,0x3d8,0x27,0x27,0x27,0xed9,0x3c9,0x3c9,0x3d5,0x3d5,0x3d5,
+0x3d5,0x27,0x3c9,0x3c9,0x3cc,0x27,0x3c9,0x3c9,0x3c9,0x3cf,0x27,0x27,0x27,0x27,0x27,0x27,
+0x27,0x3c9,0x3c9,0x27,0xed9,0xed9,0x15c3,0x27,0x27,0x27,0x27,0x27,0x3d8,0x3d8,0xed3,0xed3,
+0x27,0x27,0x3d2,0x3d2,0x3d2,0x3d2,0x3d2,0x3d2,0x3d2,0x3d2,0x3d2,0x3d2,0x27,0x27,0x27,0x27,
+0x27,0x27,0x27,0x27,0xed6,0xed6,0xed6,0xed6,0xed6,0xed6,0xed6,0xed6,0x2a,0x13d4,0x3e4,0x3e4,
+0x2a,0x3ea,0x3ea,0x3ea,0x3ea,0x3ea,0x3ea,0x3ea,0x3ea,0x2a,0x3ea,0x3ea,0x3ea,0x2a,0x3ea,0x3ea,
+0x3ea,0x3ea,0x3ea,0x3ea,0x3ea,0x3ea,0x3ea,0x3ea,0x3ea,0x3ea,0x3ea,0x3ea,0x3ea,0x3ea,0x3ea,0x3ea,
 0x3ea,0x3ea,0x3ea,0x3ea,0x3ea,0x2a,0x3ea,0x3ea,0x3ea,0x3ea,0x3ea,0x3ea,0x3ea,0x3ea,0x3ea,0x3ea,
 0x2a,0x3ea,0x3ea,0x3ea,0x3ea,0x3ea,0x2a,0x2a,0xc27,0xc2a,0x3e4,0x3db,0x3e7,0x3e4,0x3db,0x3e4,
 0x3e4,0x2a,0x3db,0x3e7,0x3e7,0x2a,0x3e7,0x3e7,0x3db,0x3de,0x2a,0x2a,0x2a,0x2a,0x2a,0x2a,
@@ -1780,1217 +1752,1076 @@ static const uint16_t propsVectorsTrie_index[27272]={
 0x2a,0x2a,0x3e1,0x3e1,0x3e1,0x3e1,0x3e1,0x3e1,0x3e1,0x3e1,0x3e1,0x3e1,0x2a,0xe1f,0xe1f,0x2a,
 0x2a,0x2a,0x2a,0x2a,0x2a,0x2a,0x2a,0x2a,0x2a,0x2a,0x2a,0x2a,0x2d,0x13d7,0x3f6,0x3f6,
 0x2d,0x3fc,0x3fc,0x3fc,0x3fc,0x3fc,0x3fc,0x3fc,0x3fc,0x2d,0x3fc,0x3fc,0x3fc,0x2d,0x3fc,0x3fc,
-0x3fc,0x3fc,0x3fc,0x3fc,0x3fc,0x3fc,0x3fc,0x3fc,0x3fc,0x3fc,0x3fc,0x3fc,0x3fc,0x122a,0x3fc,0x3fc,
-0x3fc,0x3fc,0x3fc,0x3fc,0x3fc,0x3fc,0x3fc,0x3fc,0x3fc,0x3fc,0x3fc,0x3fc,0x3fc,0x3fc,0x122a,0x2d,
-0x2d,0xee5,0x3ed,0x3f6,0x3f6,0x3ed,0x3ed,0x3ed,0xedc,0x2d,0x3f6,0x3f6,0x3f6,0x2d,0x3f9,0x3f9,
-0x3f9,0x3f0,0x122a,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x3ed,0x2d,0x2d,0x2d,0x2d,
-0x2d,0x2d,0x2d,0x15c6,0x3fc,0x3fc,0xedc,0xedc,0x2d,0x2d,0x3f3,0x3f3,0x3f3,0x3f3,0x3f3,0x3f3,
-0x3f3,0x3f3,0x3f3,0x3f3,0xedf,0xedf,0xedf,0xedf,0xedf,0xedf,0x2d,0x2d,0x2d,0xee2,0xee5,0xee5,
-0xee5,0xee5,0xee5,0xee5,0x30,0x30,0x984,0x984,0x30,0x98a,0x98a,0x98a,0x98a,0x98a,0x98a,0x98a,
-0x98a,0x98a,0x98a,0x98a,0x98a,0x98a,0x98a,0x98a,0x98a,0x98a,0x98a,0x30,0x30,0x30,0x98a,0x98a,
+0x3fc,0x3fc,0x3fc,0x3fc,0x3fc,0x3fc,0x3fc,0x3fc,0x3fc,0x3fc,0x3fc,0x3fc,0x3fc,0x3fc,0x3fc,0x3fc,
+0x3fc,0x3fc,0x3fc,0x3fc,0x3fc,0x122a,0x3fc,0x3fc,0x3fc,0x3fc,0x3fc,0x3fc,0x3fc,0x3fc,0x3fc,0x3fc,
+0x3fc,0x3fc,0x3fc,0x3fc,0x3fc,0x3fc,0x122a,0x2d,0x2d,0xee5,0x3ed,0x3f6,0x3ed,0x3ed,0x3ed,0xedc,
+0x2d,0x3f6,0x3f6,0x3f6,0x2d,0x3f9,0x3f9,0x3f9,0x3f0,0x122a,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,
+0x2d,0x2d,0x3ed,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x15c6,0x3fc,0x3fc,0xedc,0xedc,0x2d,
+0x2d,0x3f3,0x3f3,0x3f3,0x3f3,0x3f3,0x3f3,0x3f3,0x3f3,0x3f3,0x3f3,0xedf,0xedf,0xedf,0xedf,0xedf,
+0xedf,0x2d,0x2d,0x2d,0xee2,0xee5,0xee5,0xee5,0xee5,0xee5,0xee5,0x30,0x30,0x984,0x984,0x30,
 0x98a,0x98a,0x98a,0x98a,0x98a,0x98a,0x98a,0x98a,0x98a,0x98a,0x98a,0x98a,0x98a,0x98a,0x98a,0x98a,
-0x98a,0x98a,0x30,0x98a,0x98a,0x98a,0x98a,0x98a,0x98a,0x98a,0x98a,0x98a,0x30,0x98a,0x30,0x30,
-0x98a,0x98a,0x98a,0x98a,0x98a,0x98a,0x98a,0x30,0x30,0x30,0x97e,0x30,0x30,0x30,0x30,0x97b,
-0x984,0x984,0x97b,0x97b,0x97b,0x30,0x97b,0x30,0x984,0x984,0x987,0x984,0x987,0x987,0x987,0x97b,
-0x30,0x30,0x30,0x30,0x30,0x30,0x13da,0x13da,0x13da,0x13da,0x13da,0x13da,0x13da,0x13da,0x13da,0x13da,
-0x30,0x30,0x984,0x984,0x981,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,
-0x33,0x417,0x417,0x417,0x417,0x417,0x417,0x417,0x417,0x417,0x417,0x417,0x417,0x417,0x417,0x417,
+0x98a,0x98a,0x30,0x30,0x30,0x98a,0x98a,0x98a,0x98a,0x98a,0x98a,0x98a,0x98a,0x98a,0x98a,0x98a,
+0x98a,0x98a,0x98a,0x98a,0x98a,0x98a,0x98a,0x98a,0x98a,0x98a,0x98a,0x98a,0x98a,0x30,0x98a,0x98a,
+0x98a,0x98a,0x98a,0x98a,0x98a,0x98a,0x98a,0x30,0x98a,0x30,0x30,0x98a,0x98a,0x98a,0x98a,0x98a,
+0x98a,0x98a,0x30,0x30,0x30,0x97e,0x30,0x30,0x30,0x30,0x97b,0x984,0x984,0x97b,0x97b,0x97b,
+0x30,0x97b,0x30,0x984,0x984,0x987,0x984,0x987,0x987,0x987,0x97b,0x30,0x30,0x30,0x30,0x30,
+0x30,0x13da,0x13da,0x13da,0x13da,0x13da,0x13da,0x13da,0x13da,0x13da,0x13da,0x30,0x30,0x984,0x984,0x981,
+0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x33,0x417,0x417,0x417,0x417,
+0x417,0x417,0x417,0x417,0x417,0x417,0x417,0x417,0x417,0x417,0x417,0x417,0x417,0x417,0x417,0x417,
 0x417,0x417,0x417,0x417,0x417,0x417,0x417,0x417,0x417,0x417,0x417,0x417,0x417,0x417,0x417,0x417,
-0x417,0x402,0x417,0x414,0x402,0x402,0x402,0x402,0x402,0x402,0x408,0x33,0x33,0x33,0x33,0x3ff,
-0x41d,0x41d,0x41d,0x41d,0x41d,0x417,0x41a,0x405,0x405,0x405,0x405,0x405,0x405,0x402,0x405,0x40b,
-0x411,0x411,0x411,0x411,0x411,0x411,0x411,0x411,0x411,0x411,0x40e,0x40e,0x33,0x33,0x33,0x33,
+0x417,0x417,0x417,0x417,0x417,0x417,0x417,0x417,0x417,0x417,0x417,0x417,0x402,0x417,0x414,0x402,
+0x402,0x402,0x402,0x402,0x402,0x408,0x33,0x33,0x33,0x33,0x3ff,0x41d,0x41d,0x41d,0x41d,0x41d,
+0x417,0x41a,0x405,0x405,0x405,0x405,0x405,0x405,0x402,0x405,0x40b,0x411,0x411,0x411,0x411,0x411,
+0x411,0x411,0x411,0x411,0x411,0x40e,0x40e,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x33,
 0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x33,
-0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x36,0x42c,0x42c,0x36,
-0x42c,0x36,0x36,0x42c,0x42c,0x36,0x42c,0x36,0x36,0x42c,0x36,0x36,0x36,0x36,0x36,0x36,
-0x42c,0x42c,0x42c,0x42c,0x36,0x42c,0x42c,0x42c,0x42c,0x42c,0x42c,0x42c,0x36,0x42c,0x42c,0x42c,
-0x36,0x42c,0x36,0x42c,0x36,0x36,0x42c,0x42c,0x36,0x42c,0x42c,0x42c,0x42c,0x420,0x42c,0x429,
-0x420,0x420,0x420,0x420,0x420,0x420,0x36,0x420,0x420,0x42c,0x36,0x36,0x435,0x435,0x435,0x435,
-0x435,0x36,0x432,0x36,0x423,0x423,0x423,0x423,0x423,0x420,0x36,0x36,0x426,0x426,0x426,0x426,
-0x426,0x426,0x426,0x426,0x426,0x426,0x36,0x36,0x42f,0x42f,0x12e7,0x12e7,0x36,0x36,0x36,0x36,
+0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x36,0x42c,0x42c,0x36,0x42c,
+0x36,0x36,0x42c,0x42c,0x36,0x42c,0x36,0x36,0x42c,0x36,0x36,0x36,0x36,0x36,0x36,0x42c,
+0x42c,0x42c,0x42c,0x36,0x42c,0x42c,0x42c,0x42c,0x42c,0x42c,0x42c,0x36,0x42c,0x42c,0x42c,0x36,
+0x42c,0x36,0x42c,0x36,0x36,0x42c,0x42c,0x36,0x42c,0x42c,0x42c,0x42c,0x420,0x42c,0x429,0x420,
+0x420,0x420,0x420,0x420,0x420,0x36,0x420,0x420,0x42c,0x36,0x36,0x435,0x435,0x435,0x435,0x435,
+0x36,0x432,0x36,0x423,0x423,0x423,0x423,0x423,0x420,0x36,0x36,0x426,0x426,0x426,0x426,0x426,
+0x426,0x426,0x426,0x426,0x426,0x36,0x36,0x42f,0x42f,0x12e7,0x12e7,0x36,0x36,0x36,0x36,0x36,
 0x36,0x36,0x36,0x36,0x36,0x36,0x36,0x36,0x36,0x36,0x36,0x36,0x36,0x36,0x36,0x36,
-0x36,0x36,0x36,0x36,0x36,0x36,0x36,0x36,0x36,0x36,0x36,0x36,0x8fd,0x8fd,0x8fd,0x900,
-0x8fd,0x8fd,0x8fd,0x8fd,0x39,0x8fd,0x8fd,0x8fd,0x8fd,0x900,0x8fd,0x8fd,0x8fd,0x8fd,0x900,0x8fd,
-0x8fd,0x8fd,0x8fd,0x900,0x8fd,0x8fd,0x8fd,0x8fd,0x900,0x8fd,0x8fd,0x8fd,0x8fd,0x8fd,0x8fd,0x8fd,
-0x8fd,0x8fd,0x8fd,0x8fd,0x8fd,0x900,0x999,0xef1,0xef1,0x39,0x39,0x39,0x39,0x8ca,0x8ca,0x8cd,
-0x8ca,0x8cd,0x8cd,0x8d6,0x8cd,0x8d6,0x8ca,0x8ca,0x8ca,0x8ca,0x8ca,0x8f7,0x8ca,0x8cd,0x8d0,0x8d0,
-0x8d3,0x8dc,0x8d0,0x8d0,0x8fd,0x8fd,0x8fd,0x8fd,0x1233,0x122d,0x122d,0x122d,0x8ca,0x8ca,0x8ca,0x8cd,
-0x8ca,0x8ca,0x98d,0x8ca,0x39,0x8ca,0x8ca,0x8ca,0x8ca,0x8cd,0x8ca,0x8ca,0x8ca,0x8ca,0x8cd,0x8ca,
-0x8ca,0x8ca,0x8ca,0x8cd,0x8ca,0x8ca,0x8ca,0x8ca,0x8cd,0x8ca,0x98d,0x98d,0x98d,0x8ca,0x8ca,0x8ca,
-0x8ca,0x8ca,0x8ca,0x8ca,0x98d,0x8cd,0x98d,0x98d,0x98d,0x39,0x996,0x996,0x993,0x993,0x993,0x993,
-0x993,0x993,0x990,0x993,0x993,0x993,0x993,0x993,0x993,0x39,0xee8,0x993,0xcf9,0xcf9,0xeeb,0xeee,
-0xee8,0x106b,0x106b,0x106b,0x106b,0x1230,0x1230,0x39,0x39,0x39,0x39,0x39,0x39,0x39,0x39,0x39,
+0x36,0x36,0x36,0x36,0x36,0x36,0x36,0x36,0x36,0x36,0x36,0x8fd,0x8df,0x8df,0x8df,0x8df,
+0x8d9,0x8df,0x8df,0x8f1,0x8df,0x8df,0x8dc,0x8e8,0x8ee,0x8ee,0x8ee,0x8ee,0x8ee,0x8f1,0x8d9,0x8e5,
+0x8d9,0x8d9,0x8d9,0x8d0,0x8d0,0x8d9,0x8d9,0x8d9,0x8d9,0x8d9,0x8d9,0x8f4,0x8f4,0x8f4,0x8f4,0x8f4,
+0x8f4,0x8f4,0x8f4,0x8f4,0x8f4,0x8d9,0x8d9,0x8d9,0x8d9,0x8d9,0x8d9,0x8d9,0x8d9,0x8d9,0x8d9,0x8dc,
+0x8d0,0x8d9,0x8d0,0x8d9,0x8d0,0x8eb,0x8e2,0x8eb,0x8e2,0x8fa,0x8fa,0x8fd,0x8fd,0x8fd,0x900,0x8fd,
+0x8fd,0x8fd,0x8fd,0x39,0x8fd,0x8fd,0x8fd,0x8fd,0x900,0x8fd,0x8fd,0x8fd,0x8fd,0x900,0x8fd,0x8fd,
+0x8fd,0x8fd,0x900,0x8fd,0x8fd,0x8fd,0x8fd,0x900,0x8fd,0x8fd,0x8fd,0x8fd,0x8fd,0x8fd,0x8fd,0x8fd,
+0x8fd,0x8fd,0x8fd,0x8fd,0x900,0x999,0xef1,0xef1,0x39,0x39,0x39,0x39,0x8ca,0x8ca,0x8cd,0x8ca,
+0x8cd,0x8cd,0x8d6,0x8cd,0x8d6,0x8ca,0x8ca,0x8ca,0x8ca,0x8ca,0x8f7,0x8ca,0x8cd,0x8d0,0x8d0,0x8d3,
+0x8dc,0x8d0,0x8d0,0x8fd,0x8fd,0x8fd,0x8fd,0x1233,0x122d,0x122d,0x122d,0x8ca,0x8ca,0x8ca,0x8cd,0x8ca,
+0x8ca,0x98d,0x8ca,0x39,0x8ca,0x8ca,0x8ca,0x8ca,0x8cd,0x8ca,0x8ca,0x8ca,0x8ca,0x8cd,0x8ca,0x8ca,
+0x8ca,0x8ca,0x8cd,0x8ca,0x8ca,0x8ca,0x8ca,0x8cd,0x8ca,0x98d,0x98d,0x98d,0x8ca,0x8ca,0x8ca,0x8ca,
+0x8ca,0x8ca,0x8ca,0x98d,0x8cd,0x98d,0x98d,0x98d,0x39,0x996,0x996,0x993,0x993,0x993,0x993,0x993,
+0x993,0x990,0x993,0x993,0x993,0x993,0x993,0x993,0x39,0xee8,0x993,0xcf9,0xcf9,0xeeb,0xeee,0xee8,
+0x106b,0x106b,0x106b,0x106b,0x1230,0x1230,0x39,0x39,0x39,0x39,0x39,0x39,0x39,0x39,0x39,0x39,
 0x39,0x39,0x39,0x39,0x39,0x39,0x39,0x39,0x39,0x39,0x39,0x39,0x39,0x39,0x39,0x39,
-0x39,0x39,0x39,0x39,0x39,0x39,0x39,0x39,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x3c,0x12ed,
-0x3c,0x3c,0x3c,0x3c,0x3c,0x12ed,0x3c,0x3c,0x43b,0x43b,0x43b,0x43b,0x43b,0x43b,0x43b,0x43b,
-0x43b,0x43b,0x43b,0x43b,0x43b,0x43b,0x43b,0x43b,0x9c3,0x9c3,0x9c3,0x9c3,0x9c3,0x9c3,0x9c3,0xd08,
-0x9c3,0x3f,0x9c3,0x9c3,0x9c3,0x9c3,0x3f,0x3f,0x9c3,0x9c3,0x9c3,0x9c3,0x9c3,0x9c3,0x9c3,0x3f,
-0x9c3,0x3f,0x9c3,0x9c3,0x9c3,0x9c3,0x3f,0x3f,0x9c3,0x9c3,0x9c3,0x9c3,0x9c3,0x9c3,0x9c3,0xd08,
-0x9c3,0x3f,0x9c3,0x9c3,0x9c3,0x9c3,0x3f,0x3f,0x9c3,0x9c3,0x9c3,0x9c3,0x9c3,0x9c3,0x9c3,0x9c3,
+0x39,0x39,0x39,0x39,0x39,0x39,0x39,0x39,0x39,0x39,0x39,0x9ae,0x9ae,0x9ae,0x9ae,0x9ae,
+0x9ae,0x9ae,0x9ae,0x9ae,0x9ae,0x9ae,0x9ae,0x9ae,0x9ae,0x9ae,0x9ae,0x9ae,0x9ae,0x9ae,0x9ae,0x9ae,
+0x9ae,0x9ae,0x9ae,0x9ae,0x9ae,0x9ae,0x9ae,0x9ae,0x9ae,0x9ae,0x9ae,0x9ae,0x9ae,0xf0f,0x9ae,0x9ae,
+0x9ae,0x9b1,0x9ae,0xf0f,0x9ae,0x9ae,0xf06,0x9a8,0x99c,0x99c,0x99c,0x99c,0x9ab,0x99c,0xef4,0xef4,
+0xef4,0x99c,0x99f,0x9a8,0x9a2,0xefa,0xf09,0xf09,0xef4,0xef4,0xf0f,0xa9b,0xa9b,0xa9b,0xa9b,0xa9b,
+0xa9b,0xa9b,0xa9b,0xa9b,0xa9b,0x9b4,0x9b4,0x9a5,0x9a5,0x9a5,0x9a5,0x9ae,0x9ae,0x9ae,0x9ae,0x9ae,
+0x9ae,0x9ab,0x9ab,0x99c,0x99c,0xf0f,0xf0f,0xf0f,0xf0f,0xef4,0xef4,0xef4,0xf0f,0xf06,0xf03,0xf03,
+0xf0f,0xf0f,0xf06,0xf06,0xf03,0xf03,0xf03,0xf03,0xf03,0xf0f,0xf0f,0xf0f,0xef4,0xef4,0xef4,0xef4,
+0xf0f,0xf0f,0xf0f,0xf0f,0xf0f,0xf0f,0xf0f,0xf0f,0xf0f,0xf0f,0xf0f,0xef4,0xf06,0xf09,0xef4,0xef4,
+0xf0c,0xf0c,0xf0c,0xf0c,0xf0c,0xf0c,0xef7,0xf0f,0xf0c,0xf00,0xf00,0xf00,0xf00,0xf00,0xf00,0xf00,
+0xf00,0xf00,0xf00,0x1074,0x1074,0x1071,0x106e,0xefd,0xefd,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,
+0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,
+0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x3c,0x12ed,0x3c,0x3c,0x3c,0x3c,0x3c,
+0x12ed,0x3c,0x3c,0x43b,0x43b,0x43b,0x43b,0x43b,0x43b,0x43b,0x43b,0x43b,0x43b,0x43b,0x43b,0x43b,
+0x43b,0x43b,0x43b,0x43b,0x43b,0x43b,0x43b,0x43b,0x43b,0x43b,0x43b,0x43b,0x43b,0x43b,0x43b,0x43b,
+0x43b,0x43b,0x43b,0x43b,0x43b,0x43b,0x43b,0x43b,0x43b,0x43b,0xb01,0xb01,0xcfc,0xcfc,0x438,0xcff,
+0x12ea,0x12ea,0x12ea,0x76e,0x76e,0x76e,0x76e,0x76e,0x76e,0x76e,0x76e,0x76e,0x76e,0x76e,0x76e,0x76e,
+0x76e,0x76e,0x76e,0x76e,0x76e,0x76e,0x76e,0x76e,0x76e,0x76e,0x76e,0x76e,0x76e,0x76e,0x76e,0x76e,
+0x76e,0x76e,0x76e,0x76e,0x76e,0x76e,0x76e,0x76e,0x76e,0x76e,0x76e,0x76e,0x76e,0x76e,0x76e,0x76e,
+0x76e,0x76e,0x76e,0x76e,0x76e,0x76e,0x76e,0x76e,0x76e,0x76e,0x76e,0x76e,0x76e,0x76e,0x76e,0x76e,
+0x76e,0x76e,0x76e,0x11d9,0x11d9,0x11d9,0x11d9,0x11d9,0x771,0x447,0x444,0x444,0x444,0x444,0x444,0x444,
+0x444,0x444,0x444,0x444,0x444,0x444,0x444,0x444,0x444,0x444,0x444,0x444,0x444,0x444,0x444,0x444,
+0x444,0x444,0x444,0x444,0x444,0x444,0x444,0x444,0x444,0x444,0x444,0x444,0x444,0x107a,0x107a,0x107a,
+0x107a,0x107a,0x441,0x441,0x441,0x441,0x441,0x441,0x441,0x441,0x441,0x441,0x441,0x441,0x441,0x441,
+0x441,0x441,0x441,0x441,0x441,0x441,0x441,0x441,0x441,0x441,0x441,0x441,0x441,0x441,0x441,0x441,
+0x441,0x441,0x441,0x441,0x441,0x441,0x441,0x441,0x441,0x441,0x441,0x441,0x441,0x441,0x441,0x441,
+0x441,0x441,0x441,0x441,0x441,0x441,0x441,0x441,0x441,0x441,0x441,0x441,0x1077,0x1077,0x1077,0x1077,
+0x1077,0x1077,0x9c3,0x9c3,0x9c3,0x9c3,0x9c3,0x9c3,0x9c3,0xd08,0x9c3,0x9c3,0x9c3,0x9c3,0x9c3,0x9c3,
+0x9c3,0x9c3,0x9c3,0x9c3,0x9c3,0x9c3,0x9c3,0x9c3,0x9c3,0x9c3,0x9c3,0x9c3,0x9c3,0x9c3,0x9c3,0x9c3,
+0x9c3,0x9c3,0x9c3,0x9c3,0x9c3,0x9c3,0x9c3,0x9c3,0x9c3,0x9c3,0x9c3,0x9c3,0x9c3,0x9c3,0x9c3,0x9c3,
+0x9c3,0x9c3,0x9c3,0x9c3,0x9c3,0x9c3,0x9c3,0x9c3,0x9c3,0x9c3,0x9c3,0x9c3,0x9c3,0x9c3,0x9c3,0x9c3,
+0x9c3,0x9c3,0xd08,0x9c3,0x3f,0x9c3,0x9c3,0x9c3,0x9c3,0x3f,0x3f,0x9c3,0x9c3,0x9c3,0x9c3,0x9c3,
+0x9c3,0x9c3,0x3f,0x9c3,0x3f,0x9c3,0x9c3,0x9c3,0x9c3,0x3f,0x3f,0x9c3,0x9c3,0x9c3,0x9c3,0x9c3,
+0x9c3,0x9c3,0x9c3,0x9c3,0x9c3,0x9c3,0x9c3,0x9c3,0x9c3,0x9c3,0x9c3,0x9c3,0x9c3,0x9c3,0x9c3,0x9c3,
 0x9c3,0x9c3,0x9c3,0x9c3,0x9c3,0x9c3,0x9c3,0x9c3,0x9c3,0x9c3,0x9c3,0xd08,0x9c3,0x3f,0x9c3,0x9c3,
-0x9c3,0x9c3,0x3f,0x3f,0x9c3,0x9c3,0x9c3,0x9c3,0x9c3,0x9c3,0x9c3,0x3f,0x9c3,0x3f,0x9c3,0x9c3,
-0x9c3,0x9c3,0x3f,0x3f,0x9c3,0x9c3,0x9c3,0x9c3,0x9c3,0x9c3,0x9c3,0xd08,0x9c3,0x9c3,0x9c3,0x9c3,
-0x9c3,0x9c3,0x9c3,0x3f,0x9c3,0x9c3,0x9c3,0x9c3,0x9c3,0x9c3,0x9c3,0x9c3,0x9c3,0x9c3,0x9c3,0x9c3,
+0x9c3,0x9c3,0x3f,0x3f,0x9c3,0x9c3,0x9c3,0x9c3,0x9c3,0x9c3,0x9c3,0x9c3,0x9c3,0x9c3,0x9c3,0x9c3,
+0x9c3,0x9c3,0x9c3,0x9c3,0x9c3,0x9c3,0x9c3,0x9c3,0x9c3,0x9c3,0x9c3,0x9c3,0x9c3,0x9c3,0x9c3,0x9c3,
 0x9c3,0x9c3,0x9c3,0xd08,0x9c3,0x3f,0x9c3,0x9c3,0x9c3,0x9c3,0x3f,0x3f,0x9c3,0x9c3,0x9c3,0x9c3,
+0x9c3,0x9c3,0x9c3,0x3f,0x9c3,0x9c3,0x9c3,0x9c3,0x3f,0x3f,0x9c3,0x9c3,0x9c3,0x9c3,0x9c3,0x9c3,
+0x9c3,0xd08,0x9c3,0x9c3,0x9c3,0x9c3,0x9c3,0x9c3,0x9c3,0x3f,0x9c3,0x9c3,0x9c3,0x9c3,0x9c3,0x9c3,
+0x9c3,0x9c3,0x9c3,0x9c3,0x9c3,0x9c3,0x9c3,0x9c3,0x9c3,0x9c3,0x9c3,0x9c3,0x9c3,0x9c3,0x9c3,0x9c3,
+0x9c3,0xd08,0x9c3,0x9c3,0x9c3,0x9c3,0x9c3,0x9c3,0x9c3,0x9c3,0x9c3,0x9c3,0x9c3,0x9c3,0x9c3,0x9c3,
+0x9c3,0x9c3,0xd08,0x9c3,0x3f,0x9c3,0x9c3,0x9c3,0x9c3,0x3f,0x3f,0x9c3,0x9c3,0x9c3,0x9c3,0x9c3,
+0x9c3,0x9c3,0xd08,0x9c3,0x9c3,0x9c3,0x9c3,0x9c3,0x9c3,0x9c3,0x9c3,0x9c3,0x9c3,0x9c3,0x9c3,0x9c3,
+0x9c3,0x9c3,0x9c3,0x9c3,0x9c3,0x9c3,0x9c3,0x9c3,0x9c3,0x9c3,0x9c3,0x9c3,0x9c3,0x9c3,0x9c3,0x9c3,
 0x9c3,0x9c3,0x9c3,0xd08,0x9c3,0x9c3,0x9c3,0x9c3,0x9c3,0x9c3,0x9c3,0x9c3,0x9c3,0x9c3,0x9c3,0x9c3,
 0x9c3,0x9c3,0x9c3,0x9c3,0x9c3,0x9c3,0x9c3,0x3f,0x3f,0x1236,0x1236,0xd02,0xd05,0x9bd,0x9c6,0x9ba,
 0x9ba,0x9ba,0x9ba,0x9c6,0x9c6,0x9c0,0x9c0,0x9c0,0x9c0,0x9c0,0x9c0,0x9c0,0x9c0,0x9c0,0x9b7,0x9b7,
-0x9b7,0x9b7,0x9b7,0x9b7,0x9b7,0x9b7,0x9b7,0x9b7,0x9b7,0x3f,0x3f,0x3f,0x9c9,0x9c9,0x9c9,0x9c9,
+0x9b7,0x9b7,0x9b7,0x9b7,0x9b7,0x9b7,0x9b7,0x9b7,0x9b7,0x3f,0x3f,0x3f,0xd71,0xd71,0xd71,0xd71,
+0xd71,0xd71,0xd71,0xd71,0xd71,0xd71,0xd71,0xd71,0xd71,0xd71,0xd71,0xd71,0xd6e,0xd6e,0xd6e,0xd6e,
+0xd6e,0xd6e,0xd6e,0xd6e,0xd6e,0xd6e,0xf0,0xf0,0xf0,0xf0,0xf0,0xf0,0x9c9,0x9c9,0x9c9,0x9c9,
+0x9c9,0x9c9,0x9c9,0x9c9,0x9c9,0x9c9,0x9c9,0x9c9,0x9c9,0x9c9,0x9c9,0x9c9,0x9c9,0x9c9,0x9c9,0x9c9,
 0x9c9,0x9c9,0x9c9,0x9c9,0x9c9,0x9c9,0x9c9,0x9c9,0x9c9,0x9c9,0x9c9,0x9c9,0x9c9,0x9c9,0x9c9,0x9c9,
-0x9c9,0x15cc,0x42,0x42,0x15c9,0x15c9,0x15c9,0x15c9,0x15c9,0x15c9,0x42,0x42,0x9db,0x9de,0x9de,0x9de,
-0x9de,0x9de,0x9de,0x9de,0x9de,0x9de,0x9de,0x9de,0x9de,0x9de,0x9de,0x9de,0x9de,0x9de,0x9de,0x9de,
-0x9de,0x9de,0x9de,0x9de,0x9de,0x9de,0x9de,0x9d8,0x9d5,0x45,0x45,0x45,0x9e4,0x9e4,0x9e4,0x9e4,
-0x9e4,0x9e4,0x9e4,0x9e4,0x9e4,0x9e4,0x9e4,0x9e1,0x9e1,0x9e1,0x9e4,0x9e4,0x9e4,0x13dd,0x13dd,0x13dd,
-0x13dd,0x13dd,0x13dd,0x13dd,0x13dd,0x48,0x48,0x48,0x48,0x48,0x48,0x48,0xa05,0xa05,0xa05,0xa05,
-0xa05,0xa05,0x9e7,0xa05,0xa05,0x9ea,0x9ea,0x9ea,0x9ea,0x9ea,0x9ea,0x9ea,0x9ea,0x9ea,0x9ed,0x9ea,
-0x9fc,0x9fc,0x9ff,0xa08,0x9f6,0x9f3,0x9fc,0x9f9,0xa08,0xc2d,0x4b,0x4b,0xa02,0xa02,0xa02,0xa02,
-0xa02,0xa02,0xa02,0xa02,0xa02,0xa02,0x4b,0x4b,0x4b,0x4b,0x4b,0x4b,0xc30,0xc30,0xc30,0xc30,
-0xc30,0xc30,0xc30,0xc30,0xc30,0xc30,0x4b,0x4b,0x4b,0x4b,0x4b,0x4b,0xa14,0xa14,0xa8f,0xa92,
-0xa1a,0xa8c,0xa17,0xa14,0xa1d,0xa2c,0xa20,0xa2f,0xa2f,0xa2f,0xa0e,0x4e,0xa23,0xa23,0xa23,0xa23,
-0xa23,0xa23,0xa23,0xa23,0xa23,0xa23,0x4e,0x4e,0x4e,0x4e,0x4e,0x4e,0xa26,0xa26,0xa26,0xa26,
+0x9c9,0x9c9,0x9c9,0x9c9,0x9c9,0x9c9,0x9c9,0x9c9,0x9c9,0x9c9,0x9c9,0x9c9,0x9c9,0x9c9,0x9c9,0x9c9,
+0x9c9,0x15cc,0x42,0x42,0x15c9,0x15c9,0x15c9,0x15c9,0x15c9,0x15c9,0x42,0x42,0x107d,0x9cf,0x9cf,0x9cf,
+0x9cf,0x9cf,0x9cf,0x9cf,0x9cf,0x9cf,0x9cf,0x9cf,0x9cf,0x9cf,0x9cf,0x9cf,0x9cf,0x9cf,0x9cf,0x9cf,
+0x9cf,0x9cf,0x9cf,0x9cf,0x9cf,0x9cf,0x9cf,0x9cf,0x9cf,0x9cf,0x9cf,0x9cf,0x9cf,0x9cf,0x9cf,0x9cf,
+0x9cf,0x9cf,0x9cf,0x9cf,0x9cf,0x9cf,0x9cf,0x9cf,0x9cf,0x9cf,0x9cf,0x9cf,0x9cf,0x9cf,0x9cf,0x9cf,
+0x9cf,0x9cf,0x9cf,0x9cf,0x9cf,0x9cf,0x9cf,0x9cf,0x9cf,0x9cf,0x9cf,0x9cf,0x9cf,0x9cc,0x9d2,0x9cf,
+0x9cf,0x9cf,0x9cf,0x9cf,0x9cf,0x9cf,0x9cf,0x1080,0x1080,0x1080,0x1080,0x1080,0x1080,0x1080,0x1080,0x1080,
+0x9db,0x9de,0x9de,0x9de,0x9de,0x9de,0x9de,0x9de,0x9de,0x9de,0x9de,0x9de,0x9de,0x9de,0x9de,0x9de,
+0x9de,0x9de,0x9de,0x9de,0x9de,0x9de,0x9de,0x9de,0x9de,0x9de,0x9de,0x9d8,0x9d5,0x45,0x45,0x45,
+0x9e4,0x9e4,0x9e4,0x9e4,0x9e4,0x9e4,0x9e4,0x9e4,0x9e4,0x9e4,0x9e4,0x9e4,0x9e4,0x9e4,0x9e4,0x9e4,
+0x9e4,0x9e4,0x9e4,0x9e4,0x9e4,0x9e4,0x9e4,0x9e4,0x9e4,0x9e4,0x9e4,0x9e4,0x9e4,0x9e4,0x9e4,0x9e4,
+0x9e4,0x9e4,0x9e4,0x9e4,0x9e4,0x9e4,0x9e4,0x9e4,0x9e4,0x9e4,0x9e4,0x9e1,0x9e1,0x9e1,0x9e4,0x9e4,
+0x9e4,0x13dd,0x13dd,0x13dd,0x13dd,0x13dd,0x13dd,0x13dd,0x13dd,0x48,0x48,0x48,0x48,0x48,0x48,0x48,
+0xb67,0xb67,0xb67,0xb67,0xb67,0xb67,0xb67,0xb67,0xb67,0xb67,0xb67,0xb67,0xb67,0xb1,0xb67,0xb67,
+0xb67,0xb67,0xb61,0xb61,0xb64,0xb1,0xb1,0xb1,0xb1,0xb1,0xb1,0xb1,0xb1,0xb1,0xb1,0xb1,
+0xb70,0xb70,0xb70,0xb70,0xb70,0xb70,0xb70,0xb70,0xb70,0xb70,0xb70,0xb70,0xb70,0xb70,0xb70,0xb70,
+0xb70,0xb70,0xb6a,0xb6a,0xb6d,0xbcd,0xbcd,0xb4,0xb4,0xb4,0xb4,0xb4,0xb4,0xb4,0xb4,0xb4,
+0xb76,0xb76,0xb76,0xb76,0xb76,0xb76,0xb76,0xb76,0xb76,0xb76,0xb76,0xb76,0xb76,0xb76,0xb76,0xb76,
+0xb76,0xb76,0xb73,0xb73,0xb7,0xb7,0xb7,0xb7,0xb7,0xb7,0xb7,0xb7,0xb7,0xb7,0xb7,0xb7,
+0xb7c,0xb7c,0xb7c,0xb7c,0xb7c,0xb7c,0xb7c,0xb7c,0xb7c,0xb7c,0xb7c,0xb7c,0xb7c,0xba,0xb7c,0xb7c,
+0xb7c,0xba,0xb79,0xb79,0xba,0xba,0xba,0xba,0xba,0xba,0xba,0xba,0xba,0xba,0xba,0xba,
+0xa08,0xa08,0xa08,0xa08,0xa08,0xa08,0xa08,0xa08,0xa08,0xa08,0xa08,0xa08,0xa08,0xa08,0xa08,0xa08,
+0xa08,0xa08,0xa08,0xa08,0xa08,0xa08,0xa08,0xa08,0xa08,0xa08,0xa08,0xa08,0xa08,0xa08,0xa08,0xa08,
+0xa08,0xa08,0xa08,0xa0b,0xa0b,0xa08,0xa08,0xa08,0xa08,0xa08,0xa08,0xa08,0xa08,0xa08,0xa08,0xa08,
+0xa08,0xa08,0xa08,0xa08,0x9f0,0x9f0,0xa05,0x9e7,0x9e7,0x9e7,0x9e7,0x9e7,0x9e7,0x9e7,0xa05,0xa05,
+0xa05,0xa05,0xa05,0xa05,0x9e7,0xa05,0xa05,0x9ea,0x9ea,0x9ea,0x9ea,0x9ea,0x9ea,0x9ea,0x9ea,0x9ea,
+0x9ed,0x9ea,0x9fc,0x9fc,0x9ff,0xa08,0x9f6,0x9f3,0x9fc,0x9f9,0xa08,0xc2d,0x4b,0x4b,0xa02,0xa02,
+0xa02,0xa02,0xa02,0xa02,0xa02,0xa02,0xa02,0xa02,0x4b,0x4b,0x4b,0x4b,0x4b,0x4b,0xc30,0xc30,
+0xc30,0xc30,0xc30,0xc30,0xc30,0xc30,0xc30,0xc30,0x4b,0x4b,0x4b,0x4b,0x4b,0x4b,0xa14,0xa14,
+0xa8f,0xa92,0xa1a,0xa8c,0xa17,0xa14,0xa1d,0xa2c,0xa20,0xa2f,0xa2f,0xa2f,0xa0e,0x4e,0xa23,0xa23,
+0xa23,0xa23,0xa23,0xa23,0xa23,0xa23,0xa23,0xa23,0x4e,0x4e,0x4e,0x4e,0x4e,0x4e,0xa26,0xa26,
 0xa26,0xa26,0xa26,0xa26,0xa26,0xa26,0xa26,0xa26,0xa26,0xa26,0xa26,0xa26,0xa26,0xa26,0xa26,0xa26,
-0xa26,0xa26,0xa26,0xa26,0x4e,0x4e,0x4e,0x4e,0x4e,0x4e,0x4e,0x4e,0xa26,0xa26,0xa26,0xa26,
-0xa26,0xa26,0xa26,0xa26,0xa26,0xa11,0xf12,0x4e,0x4e,0x4e,0x4e,0x4e,0x10c2,0x10c2,0x10c2,0x10c2,
-0x10c2,0x10c2,0x10c2,0x10c2,0x10c2,0x10c2,0x10c2,0x10c2,0x10c2,0x10c2,0x10c2,0x10c2,0x45c,0x45c,0x45c,0x45c,
-0x45c,0x45c,0x45c,0x45c,0x45f,0x45f,0x45f,0x45f,0x45f,0x45f,0x45f,0x45f,0x45c,0x45c,0x45c,0x45c,
-0x45c,0x45c,0x51,0x51,0x45f,0x45f,0x45f,0x45f,0x45f,0x45f,0x51,0x51,0x45c,0x45c,0x45c,0x45c,
-0x45c,0x45c,0x45c,0x45c,0x51,0x45f,0x51,0x45f,0x51,0x45f,0x51,0x45f,0x45c,0x45c,0x45c,0x45c,
-0x45c,0x45c,0x45c,0x45c,0x45f,0x45f,0x45f,0x45f,0x45f,0x45f,0x45f,0x45f,0x45c,0x45c,0x45c,0x45c,
-0x45c,0x45c,0x45c,0x45c,0x45c,0x45c,0x45c,0x45c,0x45c,0x45c,0x51,0x51,0x45c,0x45c,0x45c,0x45c,
-0x45c,0x45c,0x45c,0x45c,0x45f,0x45f,0x45f,0x45f,0x45f,0x45f,0x45f,0x45f,0x45c,0x45c,0x45c,0x45c,
-0x45c,0x51,0x45c,0x45c,0x45f,0x45f,0x45f,0x45f,0x45f,0x456,0x45c,0x456,0x456,0x453,0x45c,0x45c,
-0x45c,0x51,0x45c,0x45c,0x45f,0x45f,0x45f,0x45f,0x45f,0x453,0x453,0x453,0x45c,0x45c,0x45c,0x45c,
-0x51,0x51,0x45c,0x45c,0x45f,0x45f,0x45f,0x45f,0x51,0x453,0x453,0x453,0x45c,0x45c,0x45c,0x45c,
-0x45c,0x45c,0x45c,0x45c,0x45f,0x45f,0x45f,0x45f,0x45f,0x453,0x453,0x453,0x51,0x51,0x45c,0x45c,
-0x45c,0x51,0x45c,0x45c,0x45f,0x45f,0x45f,0x45f,0x45f,0x459,0x456,0x51,0xb04,0xb07,0xb07,0xb07,
-0xf1b,0x54,0x13bc,0x13bc,0x13bc,0x13bc,0x468,0x468,0x468,0x468,0x468,0x468,0x4b0,0xb19,0x57,0x57,
-0x64e,0x4b0,0x4b0,0x4b0,0x4b0,0x4b0,0x4b6,0x4c8,0x4b6,0x4c2,0x4bc,0x651,0x4ad,0x64b,0x64b,0x64b,
-0x64b,0x4ad,0x4ad,0x4ad,0x4ad,0x4ad,0x4b3,0x4c5,0x4b3,0x4bf,0x4b9,0x57,0xd11,0xd11,0xd11,0xd11,
-0xd11,0x1239,0x1239,0x1239,0x1239,0x1239,0x1239,0x1239,0x1239,0x57,0x57,0x57,0x4ce,0x4ce,0x4ce,0x4ce,
-0x4ce,0x4ce,0x4ce,0x4cb,0x4d1,0x6b4,0x4ce,0x906,0x927,0xa3b,0xa3b,0xa3b,0xb1c,0xb1c,0xd14,0xd14,
-0xd14,0xd14,0x1083,0x1086,0x1086,0x123c,0x13b6,0x13e0,0x13e3,0x13e3,0x15cf,0x5a,0x5a,0x5a,0x5a,0x5a,
-0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,0x4d7,0x4d7,0x4d7,0x4d7,
-0x4d7,0x4d7,0x4d7,0x4d7,0x4d7,0x4d7,0x4d7,0x4d7,0x4d7,0x4d4,0x4d4,0x4d4,0x4d4,0x4d7,0xa3e,0xa3e,
-0xb1f,0xb25,0xb25,0xb22,0xb22,0xb22,0xb22,0xd17,0xe22,0xe22,0xe22,0xe22,0x1056,0x5d,0x5d,0x5d,
-0x5d,0x5d,0x5d,0x5d,0x5d,0x5d,0x5d,0x5d,0x5d,0x5d,0x5d,0x5d,0x507,0x507,0x507,0xa47,
-0xe2b,0xf21,0xf21,0xf21,0xf21,0x11b5,0x15d2,0x15d2,0x60,0x60,0x60,0x60,0x678,0x678,0x678,0x678,
-0x678,0x678,0x678,0x678,0x678,0x678,0x513,0x513,0x510,0x510,0x510,0x510,0xe31,0xe31,0xe31,0xe2e,
-0xe2e,0xe2e,0xe2e,0xe2e,0x108c,0x123f,0x123f,0x123f,0x123f,0x123f,0x123f,0x123f,0x1242,0x1242,0x1242,0x1242,
-0x13e6,0x13e6,0x13e6,0x13e6,0x13e6,0x13e6,0x13e6,0x63,0x63,0x63,0x63,0x63,0x537,0x537,0x537,0x537,
-0x537,0xa50,0xa50,0x66,0x66,0x66,0x66,0x66,0x66,0x66,0x66,0x66,0x66,0x66,0x66,0x66,
-0x66,0x66,0x66,0x66,0x66,0x66,0x66,0x66,0x66,0x66,0x66,0x66,0x53a,0x53a,0x53a,0x53a,
-0x53a,0x53a,0x53a,0x53a,0x53a,0x53a,0x53a,0x69,0x69,0x69,0x69,0x69,0x69,0x69,0x69,0x69,
-0x69,0x69,0x69,0x69,0x69,0x69,0x69,0x69,0x69,0x69,0x69,0x69,0xa6b,0xa6b,0xa6b,0xa6b,
-0xa6b,0xa6b,0xa6b,0xa6b,0xa6b,0xa6b,0xa6b,0xa6b,0xa6b,0xa6b,0xa6b,0xa6b,0xa6b,0xa6b,0xa6b,0xa6b,
-0xa6b,0xa6b,0xa6b,0xa6b,0xa6b,0xa6b,0x6c,0xa6b,0xa6b,0xa6b,0xa6b,0xa6e,0xa6b,0xa6b,0xa6b,0xa6b,
-0xa6b,0xa6b,0xa6b,0xa6b,0xa6b,0xa6b,0xa6b,0xa6b,0xa6b,0xa6b,0xa6b,0xa6b,0xa6b,0xa6b,0xa6b,0xa6e,
-0x6c,0x6c,0x6c,0x6c,0x6c,0x6c,0x6c,0x6c,0x6c,0x6c,0x6c,0x6c,0xa71,0xa71,0xa71,0xa71,
-0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,
-0xa71,0xa71,0x6f,0x6f,0x6f,0x6f,0x6f,0x6f,0x6f,0x6f,0x6f,0x6f,0x75,0x792,0x78c,0x792,
-0x78c,0x792,0x78c,0x792,0x78c,0x792,0x78c,0x78c,0x78f,0x78c,0x78f,0x78c,0x78f,0x78c,0x78f,0x78c,
-0x78f,0x78c,0x78f,0x78c,0x78f,0x78c,0x78f,0x78c,0x78f,0x78c,0x78f,0x78c,0x78c,0x78c,0x78c,0x792,
-0x78c,0x792,0x78c,0x792,0x78c,0x78c,0x78c,0x78c,0x78c,0x78c,0x792,0x78c,0x78c,0x78c,0x78c,0x78c,
-0x78f,0xbbb,0xbbb,0x75,0x75,0x8a0,0x8a0,0x86d,0x86d,0x795,0x798,0xbb8,0x78,0x78,0x78,0x78,
-0x78,0x7aa,0x7aa,0x7aa,0x7aa,0x7aa,0x7aa,0x7aa,0x7aa,0x7aa,0x7aa,0x7aa,0x7aa,0x7aa,0x7aa,0x7aa,
-0x7aa,0x7aa,0x7aa,0x7aa,0x7aa,0x7aa,0x7aa,0x7aa,0x7aa,0x7aa,0x7aa,0x7aa,0x7aa,0x104a,0x78,0x78,
-0x7b,0x7ad,0x7ad,0x7ad,0x7ad,0x7ad,0x7ad,0x7ad,0x7ad,0x7ad,0x7ad,0x7ad,0x7ad,0x7ad,0x7ad,0x7ad,
-0x7ad,0x7ad,0x7ad,0x7b,0x876,0x876,0x879,0x879,0x879,0x879,0x879,0x879,0x879,0x879,0x879,0x879,
-0x879,0x879,0x879,0x879,0xa7d,0xa7d,0xa7d,0xa7d,0xa7d,0xa7d,0xa7d,0xa7d,0xa7d,0xa7d,0xa7d,0xa7d,
-0xa7d,0xa7d,0xa7d,0xa7d,0xa7d,0xa7d,0xa7d,0xa7d,0xa7d,0xa7d,0xa7d,0xa7d,0x12cc,0x12cc,0x12cc,0x7e,
-0x7e,0x7e,0x7e,0x7e,0x7b6,0x7b6,0x7b6,0x7b6,0x7b6,0x7b6,0x7b6,0x7b6,0x7b6,0x7b6,0x7b6,0x7b6,
-0x7b6,0x7b6,0x7b6,0x7b6,0x7b6,0x7b6,0x7b6,0x7b6,0x7b6,0x7b6,0x7b6,0x7b6,0x7b6,0x7b6,0x7b6,0x7b6,
-0x7b6,0xcb4,0xcb4,0x81,0x7bc,0x7bc,0x7bc,0x7bc,0x7bc,0x7bc,0x7bc,0x7bc,0x7bc,0x7bc,0x7bc,0x7bc,
-0x7bc,0x7bc,0x7bc,0x7bc,0x7bc,0x7bc,0x7bc,0x7bc,0x7bc,0x7bc,0x7bc,0x7bc,0x7bc,0x7bc,0x7bc,0x7bc,
-0x7bc,0x7bc,0x7bc,0x81,0xa83,0xa83,0xa83,0xa83,0xa83,0xa83,0xa83,0xa83,0xa83,0xa83,0xa83,0xa83,
-0xa83,0x84,0x84,0x84,0xa89,0xa89,0xa89,0xa89,0xa89,0xa89,0xa89,0xa89,0xa89,0xa89,0xa89,0xa89,
-0xa89,0xa89,0xa89,0xa89,0xa89,0xbc4,0xa89,0xa89,0xa89,0xbc4,0xa89,0x87,0x87,0x87,0x87,0x87,
-0x87,0x87,0x87,0x87,0x10e9,0x10e9,0x10e9,0x10e9,0x10e9,0x10e9,0x10e9,0x10e9,0x10e9,0x10e9,0x10e9,0x10e9,
-0x10e9,0x10e9,0x10e9,0x10e9,0x921,0x921,0x921,0x921,0x8a,0x8a,0x8a,0x8a,0x8a,0x8a,0x8a,0x8a,
-0x8a,0x8a,0x8a,0x8a,0x115e,0x115e,0x115e,0x115e,0x115e,0x115e,0x115e,0x115e,0x115e,0x115e,0x115e,0x115e,
-0x115e,0x115e,0x115e,0x115e,0x579,0x579,0x579,0x579,0x579,0x579,0x579,0x8d,0x8d,0x8d,0x8d,0x8d,
-0x8d,0x8d,0x8d,0x8d,0x8d,0x8d,0x8d,0x567,0x567,0x567,0x567,0x567,0x8d,0x8d,0x8d,0x8d,
-0x8d,0xa5c,0x56a,0x570,0x576,0x576,0x576,0x576,0x576,0x576,0x576,0x576,0x576,0x56d,0x570,0x570,
-0x570,0x570,0x570,0x570,0x570,0x570,0x570,0x570,0x570,0x570,0x570,0x8d,0x570,0x570,0x570,0x570,
-0x570,0x8d,0x570,0x8d,0x570,0x570,0x8d,0x570,0x570,0x8d,0x570,0x570,0x570,0x570,0x570,0x570,
-0x570,0x570,0x570,0x573,0x58b,0x585,0x58b,0x585,0x588,0x58e,0x58b,0x585,0x588,0x58e,0x58b,0x585,
-0x588,0x58e,0x58b,0x585,0x1251,0x1251,0x90,0x90,0x90,0x90,0x90,0x90,0x90,0x90,0x90,0x90,
-0x90,0x90,0x90,0x90,0x90,0x90,0x90,0x58b,0x585,0x588,0x58e,0x58b,0x585,0x58b,0x585,0x58b,
-0x585,0x58b,0x58b,0x585,0x90,0x90,0x90,0x90,0x90,0x90,0x90,0x90,0x90,0x90,0x90,0x90,
-0x90,0x90,0x90,0x90,0x588,0x585,0x588,0x588,0x588,0x588,0x588,0x588,0x585,0x588,0x585,0x585,
-0x588,0x588,0x585,0x585,0x585,0x585,0x585,0x588,0x585,0x585,0x588,0x585,0x588,0x588,0x588,0x585,
-0x588,0x588,0x588,0x588,0x90,0x90,0x588,0x588,0x588,0x588,0x585,0x585,0x588,0x585,0x585,0x585,
-0x585,0x588,0x585,0x585,0x585,0x585,0x585,0x588,0x588,0x588,0x585,0x585,0x90,0x90,0x90,0x90,
-0x90,0x90,0x90,0x90,0xaa4,0xaa4,0xaa4,0xaa4,0xaa4,0xaa4,0xaa4,0xaa4,0xaa4,0xaa4,0xaa4,0xaa4,
-0xaa4,0xaa4,0xaa4,0xaa4,0x58b,0x58b,0x8be,0x58b,0x58b,0x58b,0x58b,0x58b,0x58b,0x58b,0x582,0x582,
-0xb55,0xcc9,0x90,0x90,0x7ce,0x7e0,0x7dd,0x7e0,0x7dd,0xbd9,0xbd9,0xcc0,0xcbd,0x7d1,0x7d1,0x7d1,
-0x7d1,0x7e3,0x7e3,0x7e3,0x7fb,0x7fe,0x80d,0x93,0x801,0x804,0x810,0x810,0x7f8,0x7ef,0x7e9,0x7ef,
-0x7e9,0x7ef,0x7e9,0x7ec,0x7ec,0x807,0x807,0x80a,0x807,0x807,0x807,0x93,0x807,0x7f5,0x7f2,0x7ec,
-0x93,0x93,0x93,0x93,0x597,0x5a3,0x597,0xb58,0x597,0x96,0x597,0x5a3,0x597,0x5a3,0x597,0x5a3,
-0x597,0x5a3,0x597,0x5a3,0x5a3,0x5a0,0x59a,0x59d,0x5a3,0x5a0,0x59a,0x59d,0x5a3,0x5a0,0x59a,0x59d,
-0x5a3,0x5a0,0x59a,0x5a0,0x59a,0x5a0,0x59a,0x59d,0x5a3,0x5a0,0x59a,0x5a0,0x59a,0x5a0,0x59a,0x5a0,
-0x59a,0x96,0x96,0x594,0x6d5,0x6d8,0x6ed,0x6f0,0x6cf,0x6d8,0x6d8,0x9c,0x6b7,0x6ba,0x6ba,0x6ba,
-0x6ba,0x6b7,0x6b7,0x9c,0x99,0x99,0x99,0x99,0x99,0x99,0x99,0x99,0x99,0xa5f,0xa5f,0xa5f,
-0x924,0x6b1,0x5a6,0x5a6,0x9c,0x6ff,0x6de,0x6cf,0x6d8,0x6d5,0x6cf,0x6e1,0x6d2,0x6cc,0x6cf,0x6ed,
-0x6e4,0x6db,0x6fc,0x6cf,0x6f9,0x6f9,0x6f9,0x6f9,0x6f9,0x6f9,0x6f9,0x6f9,0x6f9,0x6f9,0x6ea,0x6e7,
-0x6ed,0x6ed,0x6ed,0x6ff,0x6c0,0x6bd,0x6bd,0x6bd,0x6bd,0x6bd,0x6bd,0x6bd,0x6bd,0x6bd,0x6bd,0x6bd,
-0x6bd,0x6bd,0x6bd,0x6bd,0x6bd,0x6bd,0x6bd,0x6bd,0x6bd,0x6bd,0x6bd,0x6bd,0x6bd,0x6bd,0x6bd,0x6bd,
-0x6bd,0x6bd,0x6bd,0x9c,0x9c,0x9c,0x6bd,0x6bd,0x6bd,0x6bd,0x6bd,0x6bd,0x9c,0x9c,0x6bd,0x6bd,
-0x6bd,0x6bd,0x6bd,0x6bd,0x9c,0x9c,0x6bd,0x6bd,0x6bd,0x6bd,0x6bd,0x6bd,0x9c,0x9c,0x6bd,0x6bd,
-0x6bd,0x9c,0x9c,0x9c,0xaa7,0xaa7,0xaa7,0xaa7,0x9f,0x9f,0x9f,0x9f,0x9f,0x9f,0x9f,0x9f,
-0x9f,0x9f,0x9f,0x9f,0xaad,0xaad,0xaad,0xaad,0xaad,0xaad,0xaad,0xaad,0xaad,0xaad,0xaad,0xaad,
-0xaad,0xaad,0xaad,0xaad,0xaad,0xaad,0xaad,0xa2,0xa2,0xa2,0xa2,0xa2,0x1536,0x1536,0x1536,0x1536,
-0x1536,0x1536,0x1536,0x1536,0x1536,0x1536,0x1536,0x1536,0x1536,0x1536,0x1536,0x1536,0xab6,0xab6,0xab6,0xab6,
-0xab6,0xab6,0xab6,0xab6,0xab6,0xab6,0xab6,0xab6,0xab6,0xab6,0xab6,0xab6,0xab6,0xab6,0xab6,0xab6,
-0xab6,0xab6,0xa5,0xa5,0xa5,0xa5,0xa5,0xa5,0xa5,0xa5,0xa5,0xa5,0xac2,0xac2,0xac2,0xac2,
-0xac2,0xac2,0xac2,0xa8,0xa8,0xf2d,0xac2,0xac2,0xac2,0xac2,0xac2,0xac2,0xac2,0xac2,0xac2,0xac2,
-0xac2,0xac2,0xac2,0xac2,0xac2,0xac2,0xac2,0xac2,0xac2,0xac2,0xac2,0xac2,0x15d8,0x15d8,0x15d8,0x15d8,
-0x15d8,0x15d8,0x15d8,0x15d8,0x15d8,0xa8,0xa8,0xa8,0xa8,0xa8,0xa8,0xa8,0xa8,0xa8,0xa8,0xa8,
-0xa8,0xa8,0xa8,0xa8,0xa8,0xa8,0xa8,0xa8,0xa8,0xa8,0xa8,0xa8,0xada,0xada,0xada,0xada,
-0xada,0xada,0xada,0xada,0xada,0xada,0xada,0xada,0xada,0xada,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,
-0xad7,0xab,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xada,0xada,0xad7,0xad7,
-0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,
-0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xada,0xab,0xada,0xada,0xab,0xab,0xada,0xab,
-0xab,0xada,0xada,0xab,0xab,0xada,0xada,0xada,0xada,0xab,0xada,0xada,0xada,0xada,0xada,0xada,
-0xada,0xada,0xad7,0xad7,0xad7,0xad7,0xab,0xad7,0xab,0xad7,0xad7,0xad7,0xad7,0xc4b,0xad7,0xad7,
-0xab,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xada,0xada,0xada,0xada,
-0xada,0xada,0xada,0xada,0xada,0xada,0xada,0xada,0xada,0xada,0xada,0xada,0xad7,0xad7,0xad7,0xad7,
-0xada,0xada,0xab,0xada,0xada,0xada,0xada,0xab,0xab,0xada,0xada,0xada,0xada,0xada,0xada,0xada,
-0xada,0xab,0xada,0xada,0xada,0xada,0xada,0xada,0xada,0xab,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,
-0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,
-0xad7,0xad7,0xad7,0xad7,0xada,0xada,0xab,0xada,0xada,0xada,0xada,0xab,0xada,0xada,0xada,0xada,
-0xada,0xab,0xada,0xab,0xab,0xab,0xada,0xada,0xada,0xada,0xada,0xada,0xada,0xab,0xad7,0xad7,
-0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xd29,0xd29,0xab,0xab,
-0xada,0xada,0xada,0xada,0xada,0xada,0xada,0xada,0xada,0xada,0xada,0xada,0xada,0xada,0xada,0xada,
-0xada,0xada,0xada,0xada,0xada,0xada,0xada,0xada,0xad7,0xad7,0xad7,0xad1,0xad7,0xad7,0xad7,0xad7,
-0xad7,0xad7,0xe3a,0xe37,0xab,0xab,0xad4,0xad4,0xad4,0xad4,0xad4,0xad4,0xad4,0xad4,0xad4,0xad4,
-0xad4,0xad4,0xad4,0xad4,0xad4,0xad4,0xad4,0xad4,0xae,0xae0,0xae,0xae,0xae,0xae,0xae,0xae,
-0xae,0xae,0xae,0xae,0xae,0xae,0xae,0xae,0xae,0xae,0xae,0xae,0xae,0xae,0xae,0xae,
-0xae,0xae,0xae,0xae,0xae,0xae,0xae,0xae,0xb67,0xb67,0xb67,0xb67,0xb67,0xb67,0xb67,0xb67,
-0xb67,0xb67,0xb67,0xb67,0xb67,0xb1,0xb67,0xb67,0xb67,0xb67,0xb61,0xb61,0xb64,0xb1,0xb1,0xb1,
-0xb1,0xb1,0xb1,0xb1,0xb1,0xb1,0xb1,0xb1,0xb70,0xb70,0xb70,0xb70,0xb70,0xb70,0xb70,0xb70,
-0xb70,0xb70,0xb70,0xb70,0xb70,0xb70,0xb70,0xb70,0xb70,0xb70,0xb6a,0xb6a,0xb6d,0xbcd,0xbcd,0xb4,
-0xb4,0xb4,0xb4,0xb4,0xb4,0xb4,0xb4,0xb4,0xb76,0xb76,0xb76,0xb76,0xb76,0xb76,0xb76,0xb76,
-0xb76,0xb76,0xb76,0xb76,0xb76,0xb76,0xb76,0xb76,0xb76,0xb76,0xb73,0xb73,0xb7,0xb7,0xb7,0xb7,
-0xb7,0xb7,0xb7,0xb7,0xb7,0xb7,0xb7,0xb7,0xb7c,0xb7c,0xb7c,0xb7c,0xb7c,0xb7c,0xb7c,0xb7c,
-0xb7c,0xb7c,0xb7c,0xb7c,0xb7c,0xba,0xb7c,0xb7c,0xb7c,0xba,0xb79,0xb79,0xba,0xba,0xba,0xba,
-0xba,0xba,0xba,0xba,0xba,0xba,0xba,0xba,0xc5d,0xc5d,0xc5d,0xc5d,0xc5d,0xc5d,0xc5d,0xc5d,
+0xa26,0xa26,0xa26,0xa26,0xa26,0xa26,0xa26,0xa26,0xa26,0xa26,0xa26,0xa26,0xa26,0xa26,0xa29,0xa26,
+0xa26,0xa26,0xa26,0xa26,0xa26,0xa26,0xa26,0xa26,0xa26,0xa26,0xa26,0xa26,0xa26,0xa26,0xa26,0xa26,
+0xa26,0xa26,0xa26,0xa26,0xa26,0xa26,0xa26,0xa26,0xa26,0xa26,0xa26,0xa26,0xa26,0xa26,0xa26,0xa26,
+0xa26,0xa26,0xa26,0xa26,0xa26,0xa26,0xa26,0xa26,0xa26,0xa26,0xa26,0xa26,0xa26,0xa26,0xa26,0xa26,
+0xa26,0xa26,0xa26,0x4e,0x4e,0x4e,0x4e,0x4e,0x4e,0x4e,0x4e,0xa26,0xa26,0xa26,0xa26,0xa26,
+0xa26,0xa26,0xa26,0xa26,0xa26,0xa26,0xa26,0xa26,0xa26,0xa26,0xa26,0xa26,0xa26,0xa26,0xa26,0xa26,
+0xa26,0xa26,0xa26,0xa26,0xa26,0xa26,0xa26,0xa26,0xa26,0xa26,0xa26,0xa26,0xa26,0xa26,0xa26,0xa26,
+0xa26,0xa26,0xa26,0xa26,0xa11,0xf12,0x4e,0x4e,0x4e,0x4e,0x4e,0x10c2,0x10c2,0x10c2,0x10c2,0x10c2,
+0x10c2,0x10c2,0x10c2,0x10c2,0x10c2,0x10c2,0x10c2,0x10c2,0x10c2,0x10c2,0x10c2,0x10c2,0x10c2,0x10c2,0x10c2,0x10c2,
+0x10c2,0x10c2,0x10c2,0x10c2,0x10c2,0x10c2,0x10c2,0x10c2,0x10c2,0x10c2,0x10c2,0x10c2,0x10c2,0x10c2,0x10c2,0x10c2,
+0x10c2,0x10c2,0x10c2,0x10c2,0x10c2,0x10c2,0x10c2,0x10c2,0x10c2,0x10c2,0x10c2,0x10c2,0x10c2,0x10c2,0x10c2,0x10c2,
+0x10c2,0x14d,0x14d,0x14d,0x14d,0x14d,0x14d,0x14d,0x14d,0x14d,0x14d,0xc5d,0xc5d,0xc5d,0xc5d,0xc5d,
 0xc5d,0xc5d,0xc5d,0xc5d,0xc5d,0xc5d,0xc5d,0xc5d,0xc5d,0xc5d,0xc5d,0xc5d,0xc5d,0xc5d,0xc5d,0xc5d,
-0xc5d,0xc5d,0xc5d,0xc5d,0xc5d,0x13f8,0x13f8,0xbd,0xc4e,0xc4e,0xc4e,0xc5a,0xc5a,0xc5a,0xc5a,0xc4e,
-0xc4e,0xc5a,0xc5a,0xc5a,0xbd,0xbd,0xbd,0xbd,0xc5a,0xc5a,0xc4e,0xc5a,0xc5a,0xc5a,0xc5a,0xc5a,
-0xc5a,0xc51,0xc51,0xc51,0xbd,0xbd,0xbd,0xbd,0xc54,0xbd,0xbd,0xbd,0xc60,0xc60,0xc57,0xc57,
-0xc57,0xc57,0xc57,0xc57,0xc57,0xc57,0xc57,0xc57,0xc63,0xc63,0xc63,0xc63,0xc63,0xc63,0xc63,0xc63,
-0xc63,0xc63,0xc63,0xc63,0xc63,0xc63,0xc63,0xc63,0xc63,0xc63,0xc0,0xc0,0xc63,0xc63,0xc63,0xc63,
-0xc63,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0x13fb,0x13fb,0x13fb,0x13fb,
-0x13fb,0x13fb,0x13fb,0x13fb,0x13fb,0x13fb,0x13fb,0x13fb,0x13fb,0x13fb,0x13fb,0x13fb,0x13fb,0x13fb,0x13fb,0x13fb,
-0xc3,0xc3,0x13fb,0x13fb,0x13fb,0x13fb,0x13fb,0x13fb,0x13fb,0x13fb,0x13fb,0x13fb,0x13fb,0x13fb,0x13fb,0x13fb,
-0x13fb,0x13fb,0x13fb,0x13fb,0x13fb,0x13fb,0x13fb,0x13fb,0x13fb,0x13fb,0xc3,0xc3,0x13fb,0x13fb,0x13fb,0x13fb,
-0x13fb,0x13fb,0x13fb,0x13fb,0x13fb,0x13fb,0x13fb,0x13fb,0x13fb,0x13fb,0x13fb,0x13fb,0x13fb,0x13fb,0x13fb,0x13fb,
-0x13fb,0x13fb,0x13fb,0x13fb,0x13fb,0x13fb,0xc3,0xc3,0xc3,0x13fb,0x13fb,0x13fb,0x13fb,0x13fb,0x13fb,0x13fb,
-0x13fb,0x13fb,0x13fb,0x13fb,0x13fb,0xc3,0x13fb,0x13fb,0x13fb,0x13fb,0x13fb,0x13fb,0x13fb,0x13fb,0xc3,0xc3,
-0xc3,0xc3,0xc3,0xc3,0xc3,0xc3,0xc3,0xc3,0xc3,0xc3,0xc3,0xc3,0x15db,0x15db,0x15db,0x15db,
-0xc3,0xc3,0xc3,0xc3,0xc3,0xc3,0xc3,0xc3,0xc3,0xc3,0xc3,0xc3,0xc3,0xc3,0xc3,0xc3,
-0xc87,0xc87,0xc87,0xc87,0xc87,0xc87,0xc87,0xc87,0xc87,0xc87,0xc87,0xc87,0xc6,0xc87,0xc87,0xc87,
-0xc87,0xc87,0xc87,0xc87,0xc87,0xc87,0xc87,0xc87,0xc87,0xc87,0xc87,0xc87,0xc87,0xc87,0xc87,0xc87,
-0xc87,0xc87,0xc87,0xc6,0xc87,0xc87,0xc87,0xc87,0xc87,0xc87,0xc87,0xc87,0xc87,0xc87,0xc87,0xc87,
-0xc87,0xc87,0xc87,0xc87,0xc87,0xc87,0xc87,0xc6,0xc87,0xc87,0xc6,0xc87,0xc87,0xc87,0xc87,0xc87,
-0xc87,0xc87,0xc87,0xc87,0xc87,0xc87,0xc87,0xc87,0xc87,0xc87,0xc6,0xc6,0xc87,0xc87,0xc87,0xc87,
-0xc87,0xc87,0xc87,0xc87,0xc87,0xc87,0xc87,0xc87,0xc87,0xc87,0xc6,0xc6,0xc6,0xc6,0xc6,0xc6,
-0xc6,0xc6,0xc6,0xc6,0xc6,0xc6,0xc6,0xc6,0xc6,0xc6,0xc6,0xc6,0xc6,0xc6,0xc6,0xc6,
-0xc6,0xc6,0xc6,0xc6,0xc6,0xc6,0xc6,0xc6,0xc6,0xc6,0xc6,0xc6,0xc8a,0xc8a,0xc8a,0xc8a,
-0xc8a,0xc8a,0xc8a,0xc8a,0xc8a,0xc8a,0xc8a,0xc8a,0xc8a,0xc8a,0xc8a,0xc8a,0xc8a,0xc8a,0xc8a,0xc8a,
-0xc8a,0xc8a,0xc8a,0xc8a,0xc8a,0xc8a,0xc8a,0xc9,0xc9,0xc9,0xc9,0xc9,0xcc6,0xcc6,0xcc6,0xcc,
-0xcc,0xcc,0xcc,0xcc3,0xcc3,0xcc3,0xcc3,0xcc3,0xcc3,0xcc3,0xcc3,0xcc3,0xcc3,0xcc3,0xcc3,0xcc3,
-0xcc3,0xcc3,0xcc3,0xcc3,0xcc3,0xcc3,0xcc3,0xcc3,0xcc3,0xcc3,0xcc3,0xcc3,0xcc,0xcc,0xcc,0xcc3,
-0xcc3,0xcc3,0xcc3,0xcc3,0xcc3,0xcc3,0xcc3,0xcc3,0xc90,0xc90,0xc90,0xc90,0xc90,0xc90,0xc90,0xc90,
-0xc90,0xc90,0xc90,0xc90,0xc90,0xc90,0xc90,0xc90,0xc90,0xc90,0xc90,0xc90,0xc90,0xc90,0xc90,0xc90,
-0xc90,0xc90,0xc90,0xc90,0xc90,0xc90,0xcf,0xc8d,0xc99,0xc99,0xc99,0xc99,0xc99,0xc99,0xc99,0xc99,
-0xc99,0xc99,0xc99,0xc99,0xc99,0xc99,0xc99,0xc99,0xc99,0xc99,0xc99,0xc99,0xc99,0xc99,0xc99,0xc99,
-0xc99,0xc99,0xc99,0xc99,0xc99,0xc99,0xd2,0xd2,0xc9c,0xc9c,0xc9c,0xc9c,0xc9c,0xc9c,0xd5,0xd5,
-0xc9c,0xd5,0xc9c,0xc9c,0xc9c,0xc9c,0xc9c,0xc9c,0xc9c,0xc9c,0xc9c,0xc9c,0xc9c,0xc9c,0xc9c,0xc9c,
-0xc9c,0xc9c,0xc9c,0xc9c,0xc9c,0xc9c,0xc9c,0xc9c,0xc9c,0xc9c,0xd5,0xc9c,0xc9c,0xd5,0xd5,0xd5,
-0xc9c,0xd5,0xd5,0xc9c,0xc9f,0xc9f,0xc9f,0xc9f,0xc9f,0xc9f,0xc9f,0xc9f,0xc9f,0xc9f,0xc9f,0xc9f,
-0xc9f,0xc9f,0xc9f,0xc9f,0xc9f,0xc9f,0xc9f,0xc9f,0xc9f,0xc9f,0xc9f,0xd8,0xd8,0xd8,0xd8,0xd8,
-0xd8,0xd8,0xd8,0xd8,0xd44,0xd44,0xd44,0xd44,0xd44,0xd44,0xd44,0xd44,0xd44,0xd44,0xd44,0x13fe,
-0x13fe,0xde,0xde,0xde,0x1029,0x1029,0x1029,0x1029,0x1029,0x1029,0x1029,0x1029,0x1029,0x1029,0x1029,0x1029,
-0x135,0x135,0x135,0x135,0xd56,0xd56,0xd56,0xd56,0xd56,0xd56,0xd56,0xd56,0xd56,0xd56,0xd56,0xd56,
-0xd56,0xd56,0xd56,0xd56,0xd56,0xd56,0xd56,0xd56,0xd56,0xd56,0xd56,0xd4d,0xd4d,0xd53,0xd53,0xd4d,
-0xe1,0xe1,0xd50,0xd50,0x1053,0x1053,0x1053,0x1053,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,
-0xe4,0xe4,0xe4,0xe4,0xbca,0xbca,0xbca,0xbca,0xbca,0xbca,0xbca,0xbca,0xbca,0xbca,0xbca,0xbca,
-0xbca,0xbca,0xbca,0xbca,0xf48,0xf48,0xf48,0xf48,0xf48,0xf48,0xf48,0x1401,0x1401,0x1401,0x1401,0x1401,
-0x1401,0x1401,0x1401,0x1401,0x1401,0x1401,0x1401,0x1401,0x1401,0x1404,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,
-0x125d,0x1098,0xe49,0xe49,0xd68,0xd65,0xd68,0xd65,0xd65,0xd5c,0xd5c,0xd5c,0xd5c,0xd5c,0xd5c,0x10a1,
-0x109e,0x10a1,0x109e,0x109b,0x109b,0x109b,0x12f6,0x12f3,0xea,0xea,0xea,0xea,0xea,0xd62,0xd5f,0xd5f,
-0xd5f,0xd5c,0xd62,0xd5f,0xd6b,0xd6b,0xd6b,0xd6b,0xd6b,0xd6b,0xd6b,0xd6b,0xd6b,0xd6b,0xd6b,0xd6b,
-0xd6b,0xd6b,0xd6b,0xd6b,0xd6b,0xd6b,0xd6b,0xd6b,0xd6b,0xd6b,0xd6b,0xed,0xed,0xed,0xed,0xed,
-0xed,0xed,0xed,0xed,0xd6b,0xd6b,0xd6b,0xd6b,0xd6b,0xd6b,0xd6b,0xed,0xd6b,0xd6b,0xd6b,0xd6b,
-0xd6b,0xd6b,0xd6b,0xed,0xd6b,0xd6b,0xd6b,0xd6b,0xd6b,0xd6b,0xd6b,0xed,0xd6b,0xd6b,0xd6b,0xd6b,
-0xd6b,0xd6b,0xd6b,0xed,0xd71,0xd71,0xd71,0xd71,0xd71,0xd71,0xd71,0xd71,0xd71,0xd71,0xd71,0xd71,
-0xd71,0xd71,0xd71,0xd71,0xd6e,0xd6e,0xd6e,0xd6e,0xd6e,0xd6e,0xd6e,0xd6e,0xd6e,0xd6e,0xf0,0xf0,
-0xf0,0xf0,0xf0,0xf0,0xd74,0xd74,0xd74,0xd74,0xd74,0xd74,0xf3,0x12f9,0xf3,0xf3,0xf3,0xf3,
-0xf3,0x12f9,0xf3,0xf3,0xdce,0xdce,0xdce,0xdce,0xdce,0xdce,0xdce,0xdce,0xdce,0xdce,0xdce,0xdce,
-0xdce,0xdce,0xdce,0xdce,0xd7a,0xd7a,0xd7a,0xd7a,0xd7a,0xd7a,0xd7a,0xd7a,0xd7a,0xd7a,0xd7a,0xd7a,
-0xd7a,0xd7a,0xd7a,0xf6,0xd77,0xd77,0xd77,0xd77,0xd77,0xd77,0xd77,0xd77,0xd77,0xd77,0xd77,0xd77,
-0xd77,0xd77,0xd77,0xd77,0xd77,0xd77,0xd77,0xd77,0xd77,0xd77,0xd77,0xd77,0xd77,0xd77,0xd77,0xd77,
-0xd77,0xd77,0xd77,0xf6,0xd8c,0xd80,0xd80,0xd80,0xf9,0xd80,0xd80,0xf9,0xf9,0xf9,0xf9,0xf9,
-0xd80,0xd80,0xd80,0xd80,0xd8c,0xd8c,0xd8c,0xd8c,0xf9,0xd8c,0xd8c,0xd8c,0xf9,0xd8c,0xd8c,0xd8c,
-0xd8c,0xd8c,0xd8c,0xd8c,0xd8c,0xd8c,0xd8c,0xd8c,0xd8c,0xd8c,0xd8c,0xd8c,0xd8c,0xd8c,0xd8c,0xd8c,
-0xd8c,0xd8c,0xd8c,0xd8c,0xf9,0xf9,0xf9,0xf9,0xd7d,0xd7d,0xd7d,0xf9,0xf9,0xf9,0xf9,0xd83,
-0xd86,0xd86,0xd86,0xd86,0xd86,0xd86,0xd86,0xd86,0xf9,0xf9,0xf9,0xf9,0xf9,0xf9,0xf9,0xf9,
-0xd89,0xd89,0xd89,0xd89,0xd89,0xd89,0xd8f,0xd8f,0xd86,0xf9,0xf9,0xf9,0xf9,0xf9,0xf9,0xf9,
-0xd9b,0xd9b,0xd9b,0xd9b,0xd9b,0xd9b,0xd9b,0xd9b,0xd9b,0xd9b,0x10a7,0x10a7,0xfc,0xfc,0xfc,0xfc,
-0xd9b,0xd9b,0xd9b,0xd9b,0xd9b,0xd9e,0xd9e,0xd9e,0xd9b,0xd9b,0xd9e,0xd9b,0xd9b,0xd9b,0xd9b,0xd9b,
-0xd9b,0xd9b,0xd9b,0xd9b,0xd9b,0xd9b,0xfc,0xfc,0xfc,0xfc,0xfc,0xfc,0xd98,0xd98,0xd98,0xd98,
-0xd98,0xd98,0xd98,0xd98,0xd98,0xd98,0x10a4,0xfc,0xfc,0xfc,0xd95,0xd95,0xda4,0xda4,0xda4,0xda4,
-0xff,0xff,0xff,0xff,0xda4,0xda4,0xda4,0xda4,0xda4,0xda4,0xda4,0xda4,0xda1,0xda4,0xda4,0xda4,
-0xda4,0xda4,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x140d,0x1413,0x1410,0x102,
-0x102,0x102,0x102,0x102,0x102,0x102,0x102,0x102,0x102,0x102,0x102,0x102,0x102,0x102,0x102,0x102,
-0x102,0x102,0x102,0x102,0x102,0x102,0x102,0x102,0x102,0x102,0x102,0x102,0x102,0x102,0x102,0x102,
-0xdcb,0xdcb,0xdcb,0xdc8,0xdc8,0xdbf,0xdbf,0xdc8,0xdc5,0xdc5,0xdc5,0xdc5,0x105,0x105,0x105,0x105,
-0x1200,0x1200,0x1200,0x1200,0x1200,0x1200,0x1200,0x1200,0x1203,0x1200,0x159,0x159,0x159,0x159,0x159,0x159,
-0xdce,0xdce,0xdce,0xdce,0xdce,0xdce,0x1305,0x1305,0x108,0x108,0x108,0x108,0x108,0x108,0x108,0xdd1,
-0x1263,0x108,0x108,0x108,0x108,0x108,0x108,0x108,0x108,0x108,0x108,0x108,0x108,0x108,0x108,0x1260,
-0xba0,0xba0,0xba0,0xba0,0xba0,0xba0,0xba0,0xba0,0xba0,0xba0,0xba0,0xba0,0xba0,0xba0,0xba0,0xba0,
-0xdf8,0xde9,0xde3,0xdf5,0xdf2,0xdec,0xdec,0xdfb,0xde6,0xdef,0x10b,0x10b,0x10b,0x10b,0x10b,0x10b,
+0xc5d,0xc5d,0xc5d,0xc5d,0xc5d,0xc5d,0xc5d,0xc5d,0x13f8,0x13f8,0xbd,0xc4e,0xc4e,0xc4e,0xc5a,0xc5a,
+0xc5a,0xc5a,0xc4e,0xc4e,0xc5a,0xc5a,0xc5a,0xbd,0xbd,0xbd,0xbd,0xc5a,0xc5a,0xc4e,0xc5a,0xc5a,
+0xc5a,0xc5a,0xc5a,0xc5a,0xc51,0xc51,0xc51,0xbd,0xbd,0xbd,0xbd,0xc54,0xbd,0xbd,0xbd,0xc60,
+0xc60,0xc57,0xc57,0xc57,0xc57,0xc57,0xc57,0xc57,0xc57,0xc57,0xc57,0xc63,0xc63,0xc63,0xc63,0xc63,
+0xc63,0xc63,0xc63,0xc63,0xc63,0xc63,0xc63,0xc63,0xc63,0xc63,0xc63,0xc63,0xc63,0xc63,0xc63,0xc63,
+0xc63,0xc63,0xc63,0xc63,0xc63,0xc63,0xc63,0xc63,0xc63,0xc0,0xc0,0xc63,0xc63,0xc63,0xc63,0xc63,
+0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xd9b,0xd9b,0xd9b,0xd9b,0xd9b,
+0xd9b,0xd9b,0xd9b,0xd9b,0xd9b,0xd9b,0xd9b,0xd9b,0xd9b,0xd9b,0xd9b,0xd9b,0xd9b,0xd9b,0xd9b,0xd9b,
+0xd9b,0xd9b,0xd9b,0xd9b,0xd9b,0xd9b,0xd9b,0xd9b,0xd9b,0xd9b,0xd9b,0xd9b,0xd9b,0xd9b,0xd9b,0xd9b,
+0xd9b,0xd9b,0xd9b,0xd9b,0xd9b,0x10a7,0x10a7,0xfc,0xfc,0xfc,0xfc,0xd9b,0xd9b,0xd9b,0xd9b,0xd9b,
+0xd9e,0xd9e,0xd9e,0xd9b,0xd9b,0xd9e,0xd9b,0xd9b,0xd9b,0xd9b,0xd9b,0xd9b,0xd9b,0xd9b,0xd9b,0xd9b,
+0xfc,0xfc,0xfc,0xfc,0xfc,0xfc,0xd98,0xd98,0xd98,0xd98,0xd98,0xd98,0xd98,0xd98,0xd98,0xd98,
+0x10a4,0xfc,0xfc,0xfc,0xd95,0xd95,0xc66,0xc66,0xc66,0xc66,0xc66,0xc66,0xc66,0xc66,0xc66,0xc66,
+0xc66,0xc66,0xc66,0xc66,0xc66,0xc66,0xc66,0xc66,0xc66,0xc66,0xc66,0xc66,0xc66,0xc66,0xc66,0xc66,
+0xc66,0xc66,0xc66,0xc66,0xc66,0xc66,0xd56,0xd56,0xd56,0xd56,0xd56,0xd56,0xd56,0xd56,0xd56,0xd56,
+0xd56,0xd56,0xd56,0xd56,0xd56,0xd56,0xd56,0xd56,0xd56,0xd56,0xd56,0xd56,0xd56,0xd4d,0xd4d,0xd53,
+0xd53,0xd4d,0xe1,0xe1,0xd50,0xd50,0x10dd,0x10dd,0x10dd,0x10dd,0x10dd,0x10dd,0x10dd,0x10dd,0x10dd,0x10dd,
+0x10dd,0x10dd,0x10dd,0x10dd,0x10dd,0x10dd,0x10dd,0x10dd,0x10dd,0x10dd,0x10dd,0x10dd,0x10dd,0x10dd,0x10dd,0x10dd,
+0x10dd,0x10dd,0x10dd,0x10dd,0x10dd,0x10dd,0x10da,0x10c5,0x10da,0x10c5,0x10c5,0x10c5,0x10c5,0x10c5,0x10c5,0x10c5,
+0x150,0x10ce,0x10d7,0x10c5,0x10d7,0x10d7,0x10c5,0x10c5,0x10c5,0x10c5,0x10c5,0x10c5,0x10c5,0x10c5,0x10da,0x10da,
+0x10da,0x10da,0x10da,0x10da,0x10c5,0x10c5,0x10cb,0x10cb,0x10cb,0x10cb,0x10cb,0x10cb,0x10cb,0x10cb,0x150,0x150,
+0x10c8,0x10d4,0x10d4,0x10d4,0x10d4,0x10d4,0x10d4,0x10d4,0x10d4,0x10d4,0x10d4,0x150,0x150,0x150,0x150,0x150,
+0x150,0x10d4,0x10d4,0x10d4,0x10d4,0x10d4,0x10d4,0x10d4,0x10d4,0x10d4,0x10d4,0x150,0x150,0x150,0x150,0x150,
+0x150,0x10d1,0x10d1,0x10d1,0x10d1,0x10d1,0x10d1,0x10d1,0x10e0,0x10e3,0x10e3,0x10e3,0x10e3,0x10d1,0x10d1,0x150,
+0x150,0x1473,0x1473,0x1473,0x1473,0x1473,0x1473,0x1473,0x1473,0x1473,0x1473,0x1473,0x1473,0x1473,0x1473,0x1470,
+0x1d1,0x1d1,0x1d1,0x1d1,0x1d1,0x1d1,0x1d1,0x1d1,0x1d1,0x1d1,0x1d1,0x1d1,0x1d1,0x1d1,0x1d1,0x1d1,
+0x1d1,0x1d1,0x1d1,0x1d1,0x1d1,0x1d1,0x1d1,0x1d1,0x1d1,0x1d1,0x1d1,0x1d1,0x1d1,0x1d1,0x1d1,0x1d1,
+0x1d1,0x1d1,0x1d1,0x1d1,0x1d1,0x1d1,0x1d1,0x1d1,0x1d1,0x1d1,0x1d1,0x1d1,0x1d1,0x1d1,0x1d1,0x1d1,
+0x1d1,0x1d1,0x1d1,0x1d1,0x1d1,0x1d1,0x1d1,0x1d1,0x1d1,0x1d1,0x1d1,0x1d1,0x1d1,0x1d1,0x1d1,0x1d1,
+0xe67,0xe67,0xe67,0xe67,0xe79,0xe82,0xe85,0xe82,0xe85,0xe82,0xe85,0xe82,0xe85,0xe82,0xe85,0xe82,
+0xe82,0xe82,0xe85,0xe82,0xe82,0xe82,0xe82,0xe82,0xe82,0xe82,0xe82,0xe82,0xe82,0xe82,0xe82,0xe82,
+0xe82,0xe82,0xe82,0xe82,0xe82,0xe82,0xe82,0xe82,0xe82,0xe82,0xe82,0xe82,0xe82,0xe82,0xe82,0xe82,
+0xe82,0xe82,0xe82,0xe82,0xe6a,0xe79,0xe67,0xe67,0xe67,0xe67,0xe67,0xe7c,0xe67,0xe7c,0xe79,0xe79,
 0xe7c,0xe7c,0xe67,0xe7c,0xe7f,0xe82,0xe82,0xe82,0xe82,0xe82,0xe82,0xe82,0x111,0x111,0x111,0x111,
 0xe76,0xe76,0xe76,0xe76,0xe76,0xe76,0xe76,0xe76,0xe76,0xe76,0xe88,0xe88,0xe6d,0xe73,0xe88,0xe88,
 0xe70,0xe6d,0xe6d,0xe6d,0xe6d,0xe6d,0xe6d,0xe6d,0xe6d,0xe6d,0xe6d,0xe6a,0xe6a,0xe6a,0xe6a,0xe6a,
 0xe6a,0xe6a,0xe6a,0xe6a,0xe6d,0xe6d,0xe6d,0xe6d,0xe6d,0xe6d,0xe6d,0xe6d,0xe6d,0x111,0x111,0x111,
-0x1269,0x1266,0x1269,0x1266,0x1269,0x1266,0x1269,0x1266,0x1269,0x1266,0x130b,0x141f,0x141f,0x141f,0x114,0x114,
-0x141f,0x141f,0x15e4,0x15e4,0x15e4,0x15de,0x15e4,0x15de,0x114,0x114,0x114,0x114,0x114,0x114,0x114,0x114,
-0x114,0x114,0x114,0x114,0x114,0x114,0x114,0x114,0x114,0x114,0x114,0x114,0x114,0x114,0x114,0x114,
-0x114,0x114,0x114,0x114,0x114,0x114,0x114,0x114,0x114,0x114,0x114,0x141c,0x130e,0x130e,0x1266,0xf84,
-0xf84,0xf84,0xf84,0xf84,0xe97,0xe97,0xe97,0xe97,0xe97,0xe97,0xe97,0xe97,0xe97,0xe97,0xe97,0xe97,
-0xe97,0xe97,0xe97,0xe97,0xe97,0xe97,0xe97,0xe97,0xe94,0xe94,0xe9a,0xe9a,0x117,0x117,0x117,0x117,
-0x117,0x117,0x117,0x117,0xea3,0xea3,0xea3,0xea3,0xea3,0xea3,0xea3,0xea3,0xea3,0xea3,0xea3,0xea3,
-0xea3,0xea3,0xea3,0xea3,0xea3,0xea3,0xea3,0xea3,0xea3,0xea3,0xe9d,0xe9d,0xe9d,0xe9d,0x10b0,0x10b0,
-0x11a,0x11a,0x11a,0xea0,0x1422,0x1422,0x1422,0x1422,0x1422,0x1422,0x1422,0x1422,0x1422,0x1422,0x1422,0x1422,
-0x1422,0x1422,0x1422,0x1422,0x1422,0x1422,0x1422,0x1422,0x1422,0x1422,0x1422,0x1422,0x1422,0x15e7,0x11d,0x11d,
-0x11d,0x11d,0x11d,0x11d,0x11d,0x11d,0x11d,0x11d,0x11d,0x11d,0x11d,0x11d,0x11d,0x11d,0x11d,0x11d,
-0x11d,0x11d,0x11d,0x11d,0x11d,0x11d,0x11d,0x11d,0x11d,0x11d,0x11d,0x11d,0x11d,0x11d,0x11d,0x11d,
-0xeac,0xeac,0xeac,0x1428,0x1428,0x1428,0x1428,0x1428,0x1428,0x1428,0x1428,0x1428,0x1428,0x1428,0x1428,0x120,
-0xea9,0xea9,0xea9,0xea9,0x1425,0x120,0x120,0x120,0x120,0x120,0x120,0x120,0x120,0x120,0x120,0x120,
-0xeaf,0xeaf,0xeaf,0xeaf,0xeaf,0xeaf,0xeaf,0xeaf,0xeaf,0xeaf,0xeaf,0xeaf,0xeaf,0xeaf,0xeaf,0xeaf,
-0xeaf,0xeaf,0x123,0x123,0x123,0x123,0x123,0x123,0x123,0x123,0x123,0x123,0x123,0x123,0x123,0x123,
+0xf8a,0xf8a,0xf90,0xf96,0xf96,0xf96,0xf96,0xf96,0xf96,0xf96,0xf96,0xf96,0xf96,0xf96,0xf96,0xf96,
+0xf96,0xf96,0xf96,0xf96,0xf96,0xf96,0xf96,0xf96,0xf96,0xf96,0xf96,0xf96,0xf96,0xf96,0xf96,0xf96,
+0xf96,0xf90,0xf8a,0xf8a,0xf8a,0xf8a,0xf90,0xf90,0xf8a,0xf8a,0xf93,0x1314,0x1311,0x1311,0xf96,0xf96,
+0xf8d,0xf8d,0xf8d,0xf8d,0xf8d,0xf8d,0xf8d,0xf8d,0xf8d,0xf8d,0x1317,0x1317,0x1317,0x1317,0x1317,0x1317,
+0x128d,0x128d,0x128d,0x128d,0x128d,0x128d,0x128d,0x128d,0x128d,0x128d,0x128d,0x128d,0x128d,0x128d,0x128d,0x128d,
+0x128d,0x128d,0x128d,0x128d,0x128d,0x128d,0x128d,0x128d,0x128d,0x128d,0x128d,0x128d,0x128d,0x128d,0x128d,0x128d,
+0x128d,0x128d,0x128d,0x128d,0x128d,0x128d,0x127e,0x1287,0x1281,0x1281,0x1287,0x1287,0x1287,0x1281,0x1287,0x1281,
+0x1281,0x1281,0x128a,0x128a,0x18f,0x18f,0x18f,0x18f,0x18f,0x18f,0x18f,0x18f,0x1284,0x1284,0x1284,0x1284,
+0xfab,0xfab,0xfab,0xfab,0xfab,0xfab,0xfab,0xfab,0xfab,0xfab,0xfab,0xfab,0xfab,0xfab,0xfab,0xfab,
+0xfab,0xfab,0xfab,0xfab,0xfab,0xfab,0xfab,0xfab,0xfab,0xfab,0xfab,0xfab,0xfab,0xfab,0xfab,0xfab,
 0xfab,0xfab,0xfab,0xfab,0xfa8,0xfa8,0xfa8,0xfa8,0xfa8,0xfa8,0xfa8,0xfa8,0xf99,0xf99,0xf99,0xf99,
 0xf99,0xf99,0xf99,0xf99,0xfa8,0xfa8,0xf9f,0xf9c,0x126,0x126,0x126,0xfae,0xfae,0xfa2,0xfa2,0xfa2,
 0xfa5,0xfa5,0xfa5,0xfa5,0xfa5,0xfa5,0xfa5,0xfa5,0xfa5,0xfa5,0x126,0x126,0x126,0xfab,0xfab,0xfab,
 0xfb1,0xfb1,0xfb1,0xfb1,0xfb1,0xfb1,0xfb1,0xfb1,0xfb1,0xfb1,0xfb4,0xfb4,0xfb4,0xfb4,0xfb4,0xfb4,
-0xfc6,0xfc6,0xfc6,0xfc6,0xfc6,0xfc6,0xfc6,0xfc6,0xfc6,0xfc6,0xfc9,0xfc9,0x129,0x129,0x129,0x129,
-0x129,0x129,0x129,0x129,0x129,0x129,0x129,0x129,0x129,0x129,0x129,0x129,0x129,0x129,0x129,0x129,
-0xff0,0xff0,0xff0,0xff0,0xfea,0x12c,0x12c,0x12c,0x12c,0x12c,0x12c,0x12c,0x12c,0x12c,0xff6,0xff6,
-0xfed,0xfed,0xfed,0xfed,0xfed,0xfed,0xfed,0xfed,0xfed,0xfed,0x12c,0x12c,0x12c,0x12c,0x12c,0x12c,
-0x1014,0x1014,0x1014,0x1014,0x1014,0x1014,0x1014,0x1008,0x1008,0x1008,0x1008,0x1008,0x1008,0x1008,0x1008,0x1008,
-0x1008,0x1008,0x100e,0x1011,0x12f,0x12f,0x12f,0x12f,0x12f,0x12f,0x12f,0x12f,0x12f,0x12f,0x12f,0x100b,
-0x1023,0x1023,0x1023,0x1023,0x1023,0x1023,0x1023,0x1023,0x1023,0x1017,0x1017,0x1017,0x1017,0x1017,0x1017,0x1020,
-0x1020,0x1017,0x1017,0x1020,0x1020,0x1017,0x1017,0x132,0x132,0x132,0x132,0x132,0x132,0x132,0x132,0x132,
-0x1023,0x1023,0x1023,0x1017,0x1023,0x1023,0x1023,0x1023,0x1023,0x1023,0x1023,0x1023,0x1017,0x1020,0x132,0x132,
-0x101d,0x101d,0x101d,0x101d,0x101d,0x101d,0x101d,0x101d,0x101d,0x101d,0x132,0x132,0x101a,0x1026,0x1026,0x1026,
-0x1434,0x135,0x135,0x135,0x135,0x135,0x135,0x135,0x135,0x135,0x135,0x135,0x135,0x135,0x135,0x135,
-0x135,0x135,0x135,0x135,0x135,0x135,0x135,0x135,0x135,0x135,0x135,0x135,0x135,0x135,0x135,0x135,
-0x102c,0x102c,0x102c,0x102c,0x102c,0x102c,0x102c,0x102c,0x102c,0x102c,0x102c,0x102c,0x102c,0x102c,0x102c,0x102c,
-0x102c,0x102c,0x102c,0x102c,0x102c,0x102c,0x102c,0x102c,0x102c,0x102c,0x102c,0x102c,0x102c,0x102f,0x138,0x138,
-0x1032,0x1032,0x1032,0x1032,0x1032,0x1032,0x1032,0x1032,0x1032,0x1032,0x1032,0x1032,0x1032,0x1032,0x1032,0x1032,
-0x1032,0x1032,0x1032,0x1032,0x1032,0x1032,0x1032,0x1032,0x1032,0x1032,0x1032,0x1032,0x1032,0x13b,0x13b,0x13b,
-0x1035,0x1035,0x1035,0x1035,0x1035,0x1035,0x1035,0x1035,0x1035,0x1035,0x1035,0x1035,0x1035,0x1035,0x1035,0x1035,
-0x1035,0x13e,0x13e,0x13e,0x13e,0x13e,0x13e,0x13e,0x13e,0x13e,0x13e,0x13e,0x13e,0x13e,0x13e,0x13e,
-0x103b,0x103b,0x103b,0x103b,0x103b,0x103b,0x103b,0x103b,0x103b,0x103b,0x103b,0x103b,0x103b,0x103b,0x103b,0x103b,
-0x103b,0x103b,0x103b,0x103b,0x103b,0x103b,0x103b,0x103b,0x103b,0x103b,0x141,0x141,0x141,0x141,0x141,0x1038,
-0x103e,0x103e,0x103e,0x103e,0x103e,0x103e,0x103e,0x103e,0x103e,0x103e,0x103e,0x103e,0x144,0x144,0x144,0x144,
-0x1041,0x1041,0x1041,0x1041,0x1041,0x1041,0x1041,0x1041,0x1041,0x1041,0x1041,0x1041,0x1041,0x1041,0x1041,0x1041,
-0x1041,0x1041,0x1041,0x1041,0x147,0x147,0x147,0x147,0x147,0x147,0x147,0x147,0x147,0x147,0x147,0x147,
-0x10b6,0x10b6,0x10b6,0x10b6,0x10bf,0x10b6,0x10b6,0x10b6,0x10bf,0x10b6,0x10b6,0x10b6,0x10b6,0x10b3,0x14a,0x14a,
-0x10bc,0x10bc,0x10bc,0x10bc,0x10bc,0x10bc,0x10bc,0x10bc,0x10bc,0x10bc,0x10bc,0x10bc,0x10bc,0x10bc,0x10bc,0x14a,
-0x10c2,0x10c2,0x10c2,0x10c2,0x10c2,0x10c2,0x10c2,0x10c2,0x10c2,0x10c2,0x10c2,0x10c2,0x10c2,0x10c2,0x10c2,0x10c2,
-0x10c2,0x10c2,0x10c2,0x10c2,0x10c2,0x10c2,0x14d,0x14d,0x14d,0x14d,0x14d,0x14d,0x14d,0x14d,0x14d,0x14d,
-0x10dd,0x10dd,0x10dd,0x10dd,0x10dd,0x10dd,0x10dd,0x10dd,0x10dd,0x10dd,0x10dd,0x10dd,0x10dd,0x10dd,0x10dd,0x10dd,
-0x10dd,0x10dd,0x10dd,0x10dd,0x10dd,0x10da,0x10c5,0x10da,0x10c5,0x10c5,0x10c5,0x10c5,0x10c5,0x10c5,0x10c5,0x150,
-0x10ce,0x10d7,0x10c5,0x10d7,0x10d7,0x10c5,0x10c5,0x10c5,0x10c5,0x10c5,0x10c5,0x10c5,0x10c5,0x10da,0x10da,0x10da,
-0x10da,0x10da,0x10da,0x10c5,0x10c5,0x10cb,0x10cb,0x10cb,0x10cb,0x10cb,0x10cb,0x10cb,0x10cb,0x150,0x150,0x10c8,
-0x10d4,0x10d4,0x10d4,0x10d4,0x10d4,0x10d4,0x10d4,0x10d4,0x10d4,0x10d4,0x150,0x150,0x150,0x150,0x150,0x150,
-0x10d4,0x10d4,0x10d4,0x10d4,0x10d4,0x10d4,0x10d4,0x10d4,0x10d4,0x10d4,0x150,0x150,0x150,0x150,0x150,0x150,
-0x10d1,0x10d1,0x10d1,0x10d1,0x10d1,0x10d1,0x10d1,0x10e0,0x10e3,0x10e3,0x10e3,0x10e3,0x10d1,0x10d1,0x150,0x150,
-0x1473,0x1473,0x1473,0x1473,0x1473,0x1473,0x1473,0x1473,0x1473,0x1473,0x1473,0x1473,0x1473,0x1473,0x1470,0x1d1,
+0xfb4,0xfb4,0xfb4,0xfb4,0xfb4,0xfb4,0xfb4,0xfb4,0xfb4,0xfb4,0xfb4,0xfb4,0xfb4,0xfb4,0xfb4,0xfb4,
+0xfb4,0xfb4,0xfb4,0xfb4,0xfb4,0xfb4,0xfb4,0xfb4,0xfb7,0xfb7,0xfb7,0xfba,0xfb7,0xfb7,0xfbd,0xfbd,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0x138f,0x138f,0x138f,0x138f,0x138f,0x138f,0x138f,0x138f,0x1c2,0x1c2,0x1c2,0x1c2,0x1c2,0x1c2,0x1c2,0x1c2,
+0x120c,0x1209,0x120c,0x11fa,0x1209,0x1209,0x1209,0x120f,0x1209,0x120f,0x1212,0x1209,0x120f,0x120f,0x1209,0x1209,
 0x120f,0x11f4,0x1209,0x1209,0x1209,0x1209,0x1209,0x1209,0x1209,0x11f7,0x11f7,0x11f7,0x11f7,0x1209,0x11f7,0x11f7,
 0x11f7,0x11f7,0x11fd,0x13ad,0x13b3,0x13b0,0x13aa,0x153,0x15ba,0x15ba,0x153,0x153,0x153,0x153,0x153,0x153,
-0x10f8,0x10f8,0x10f8,0x10f8,0x10f8,0x10f8,0x10f8,0x10f8,0x10f8,0x10f8,0x10f8,0x10f8,0x10f8,0x10f8,0x10f8,0x10f8,
-0x10ef,0x10ef,0x10f2,0x10fb,0x10f5,0x10f5,0x10f5,0x10fb,0x156,0x156,0x156,0x156,0x156,0x156,0x156,0x156,
-0x10fe,0x10fe,0x10fe,0x10fe,0x10fe,0x10fe,0x10fe,0x10fe,0x10fe,0x10fe,0x10fe,0x10fe,0x10fe,0x10fe,0x10fe,0x10fe,
-0x10fe,0x10fe,0x1104,0x1215,0x1104,0x1104,0x1104,0x1104,0x1101,0x1101,0x1101,0x1104,0x15ed,0x15f0,0x15c,0x15c,
-0x11e5,0x11e5,0x11e5,0x11e5,0x11e5,0x11e5,0x11e5,0x11e5,0x11e5,0x11e5,0x11e5,0x11e5,0x11e5,0x11e5,0x11e5,0x11e5,
-0x11e5,0x11e5,0x11e5,0x11e5,0x11e5,0x11e5,0x11e5,0x11e5,0x11e5,0x11e5,0x11e5,0x11e5,0x11e5,0x15f,0x15f,0x15f,
-0x1119,0x110d,0x110d,0x110d,0x110d,0x110d,0x110d,0x1110,0x111f,0x111f,0x110d,0x110d,0x110d,0x110d,0x162,0x1206,
-0x1113,0x1113,0x1113,0x1113,0x1113,0x1113,0x1113,0x1113,0x1113,0x1113,0x162,0x162,0x162,0x162,0x110d,0x110d,
-0x113d,0x1131,0x113d,0x165,0x165,0x165,0x165,0x165,0x165,0x165,0x165,0x165,0x165,0x165,0x165,0x165,
-0x165,0x165,0x165,0x165,0x165,0x165,0x165,0x165,0x165,0x165,0x165,0x113a,0x113a,0x1140,0x1134,0x1137,
-0x1155,0x1155,0x1155,0x114f,0x114f,0x1146,0x114f,0x114f,0x1146,0x114f,0x114f,0x1158,0x1152,0x1149,0x168,0x168,
-0x114c,0x114c,0x114c,0x114c,0x114c,0x114c,0x114c,0x114c,0x114c,0x114c,0x168,0x168,0x168,0x168,0x168,0x168,
-0x115e,0x115e,0x115e,0x115e,0x115e,0x115e,0x115e,0x16b,0x16b,0x16b,0x16b,0x115b,0x115b,0x115b,0x115b,0x115b,
-0x115b,0x115b,0x115b,0x115b,0x115b,0x115b,0x115b,0x115b,0x115b,0x115b,0x115b,0x115b,0x115b,0x115b,0x115b,0x115b,
-0x115b,0x115b,0x115b,0x115b,0x115b,0x115b,0x115b,0x115b,0x16b,0x16b,0x16b,0x16b,0x1167,0x1167,0x1167,0x1167,
-0x1167,0x1167,0x1167,0x1167,0x1167,0x1167,0x1167,0x1167,0x1167,0x1167,0x1167,0x1167,0x1167,0x1167,0x1167,0x1167,
-0x1167,0x1167,0x16e,0x1164,0x1161,0x1161,0x1161,0x1161,0x1161,0x1161,0x1161,0x1161,0x1176,0x1176,0x1176,0x1176,
-0x1176,0x1176,0x1176,0x1176,0x1176,0x1176,0x1176,0x1176,0x1176,0x1176,0x1176,0x1176,0x1176,0x1176,0x1176,0x1176,
-0x1176,0x1176,0x171,0x171,0x171,0x1170,0x1173,0x1173,0x1173,0x1173,0x1173,0x1173,0x117c,0x117c,0x117c,0x117c,
-0x117c,0x117c,0x117c,0x117c,0x117c,0x117c,0x117c,0x117c,0x117c,0x117c,0x117c,0x117c,0x117c,0x117c,0x117c,0x117c,
-0x117c,0x117c,0x174,0x174,0x1179,0x1179,0x1179,0x1179,0x1179,0x1179,0x1179,0x1179,0x1182,0x1182,0x1182,0x1182,
-0x1182,0x1182,0x1182,0x1182,0x1182,0x1182,0x1182,0x1182,0x1182,0x1182,0x1182,0x1182,0x1182,0x1182,0x1182,0x177,
-0x177,0x177,0x177,0x177,0x117f,0x117f,0x117f,0x117f,0x117f,0x117f,0x117f,0x117f,0x1188,0x1188,0x1188,0x1188,
-0x1188,0x1188,0x1188,0x1188,0x1188,0x1188,0x1188,0x1188,0x1188,0x1188,0x1188,0x1188,0x1188,0x1188,0x1188,0x1188,
-0x1188,0x1188,0x1188,0x1188,0x1188,0x1188,0x1188,0x1188,0x1188,0x1188,0x1188,0x17d,0x11a6,0x11a6,0x180,0x180,
-0x180,0x180,0x180,0x180,0x180,0x180,0x180,0x180,0x180,0x180,0x180,0x180,0x138c,0x138c,0x138c,0x138c,
-0x138c,0x138c,0x138c,0x138c,0x138c,0x138c,0x138c,0x138c,0x138c,0x138c,0x138c,0x138c,0x11ca,0x11ca,0x11ca,0x11ca,
-0x11ca,0x11ca,0x11ca,0x11ca,0x11ca,0x11ca,0x11ca,0x1440,0x1440,0x186,0x186,0x186,0x11ca,0x11ca,0x11ca,0x11ca,
-0x11ca,0x11ca,0x11ca,0x11ca,0x11ca,0x11ca,0x11ca,0x11ca,0x11ca,0x11ca,0x11ca,0x11ca,0x11ca,0x11ca,0x11ca,0x11cd,
-0x11cd,0x11cd,0x11b2,0x186,0x12c9,0x11d6,0x12c9,0x12c9,0x12c9,0x12c9,0x12c9,0x12c9,0x12c9,0x12c9,0x12c9,0x12c9,
-0x12c9,0x11d6,0x12c9,0x11d6,0x12c6,0x12c6,0x12c6,0x12c6,0x12c6,0x12c6,0x12c6,0x12c6,0x12c6,0x12c6,0x131d,0x131d,
-0x186,0x186,0x186,0x186,0x12c6,0x12c6,0x12c6,0x12c6,0x12c6,0x12c6,0x12c6,0x12c6,0x12c6,0x11d3,0x12c6,0x11d3,
-0x11d3,0x12c6,0x12c6,0x11d3,0x12c6,0x12c6,0x12c6,0x12c6,0x12c6,0x12c6,0x12c6,0x12c6,0x12c6,0x12c6,0x11c7,0x11c7,
-0x11c7,0x11c7,0x12c0,0x12c0,0x11d0,0x12c0,0x12c0,0x12c0,0x12c0,0x12c0,0x12c0,0x12c0,0x12c0,0x12c0,0x12c0,0x186,
-0x186,0x186,0x186,0x186,0x186,0x186,0x186,0x186,0x186,0x186,0x186,0x186,0x186,0x186,0x186,0x186,
-0x186,0x186,0x186,0x186,0x186,0x186,0x186,0x186,0x186,0x186,0x186,0x186,0x186,0x186,0x186,0x186,
-0x186,0x186,0x1272,0x1272,0x1272,0x1272,0x1272,0x1272,0x1272,0x1272,0x1272,0x1272,0x1272,0x1272,0x1272,0x1272,
-0x1272,0x1272,0x1272,0x1272,0x1272,0x1272,0x1272,0x1272,0x1272,0x1272,0x1272,0x1272,0x11ee,0x12d2,0x12d2,0x189,
-0x189,0x189,0x189,0x189,0x189,0x189,0x189,0x189,0x189,0x189,0x189,0x189,0x11eb,0x11eb,0x11eb,0x11eb,
-0x11eb,0x11eb,0x11eb,0x11eb,0x11eb,0x11eb,0x11eb,0x11eb,0x11eb,0x11eb,0x11eb,0x11eb,0x11eb,0x11eb,0x12d2,0x12d2,
-0x12d2,0x12d2,0x12d2,0x12d2,0x12d2,0x12d2,0x12d2,0x189,0x189,0x189,0x189,0x189,0x11e8,0x11e8,0x11e8,0x11e8,
-0x11e8,0x11e8,0x11e8,0x11e8,0x11e8,0x189,0x189,0x189,0x189,0x189,0x189,0x189,0x12cf,0x12cf,0x189,0x189,
-0x189,0x189,0x189,0x189,0x189,0x189,0x189,0x189,0x189,0x189,0x189,0x189,0x189,0x189,0x189,0x189,
-0x189,0x189,0x189,0x189,0x189,0x189,0x189,0x189,0x189,0x189,0x189,0x189,0x189,0x189,0x189,0x189,
-0x127b,0x127b,0x127b,0x127b,0x127b,0x127b,0x127b,0x127b,0x127b,0x127b,0x127b,0x127b,0x127b,0x127b,0x127b,0x127b,
-0x127b,0x127b,0x127b,0x127b,0x127b,0x127b,0x127b,0x127b,0x127b,0x1275,0x1275,0x1275,0x18c,0x18c,0x1278,0x18c,
-0x128d,0x128d,0x128d,0x128d,0x128d,0x128d,0x127e,0x1287,0x1281,0x1281,0x1287,0x1287,0x1287,0x1281,0x1287,0x1281,
-0x1281,0x1281,0x128a,0x128a,0x18f,0x18f,0x18f,0x18f,0x18f,0x18f,0x18f,0x18f,0x1284,0x1284,0x1284,0x1284,
-0x192,0x1290,0x1290,0x1290,0x1290,0x1290,0x1290,0x192,0x192,0x1290,0x1290,0x1290,0x1290,0x1290,0x1290,0x192,
-0x192,0x1290,0x1290,0x1290,0x1290,0x1290,0x1290,0x192,0x192,0x192,0x192,0x192,0x192,0x192,0x192,0x192,
-0x1290,0x1290,0x1290,0x1290,0x1290,0x1290,0x1290,0x192,0x1290,0x1290,0x1290,0x1290,0x1290,0x1290,0x1290,0x192,
-0x14d0,0x14d0,0x14d0,0x14d0,0x14d0,0x14d0,0x14d0,0x14d0,0x14d0,0x14d0,0x14d0,0x14d0,0x14d0,0x14d0,0x14d0,0x14d0,
-0x1293,0x1293,0x1293,0x1293,0x1293,0x1293,0x1296,0x12a8,0x12a8,0x129c,0x129c,0x129c,0x129c,0x129c,0x195,0x195,
-0x195,0x195,0x1299,0x1299,0x1299,0x1299,0x1299,0x1299,0x1299,0x1299,0x1299,0x1299,0x1299,0x1299,0x1299,0x1299,
-0x1299,0x1299,0x129f,0x129f,0x129f,0x129f,0x129f,0x129f,0x129f,0x129f,0x129f,0x129f,0x195,0x195,0x195,0x195,
-0x195,0x195,0x195,0x195,0x195,0x195,0x195,0x195,0x195,0x195,0x195,0x1443,0x12ab,0x12ab,0x12ab,0x12ab,
-0x12ab,0x12ab,0x12ab,0x12ab,0x12ab,0x12ab,0x12ab,0x12ab,0x12ab,0x12ab,0x12ab,0x12ab,0x12ab,0x12ab,0x12ab,0x12ab,
-0x12ab,0x12ab,0x12ab,0x12ab,0x12ab,0x198,0x198,0x198,0x198,0x198,0x198,0x198,0x12d8,0x12d5,0x19b,0x19b,
-0x19b,0x19b,0x19b,0x19b,0x19b,0x19b,0x19b,0x19b,0x19b,0x19b,0x19b,0x19b,0x19b,0x19b,0x19b,0x19b,
-0x19b,0x19b,0x19b,0x19b,0x19b,0x19b,0x19b,0x19b,0x19b,0x19b,0x19b,0x19b,0x19b,0x19b,0x19b,0x19b,
-0x12ae,0x12ae,0x12ae,0x12ae,0x12ae,0x12ae,0x12ae,0x12ae,0x12ae,0x12ae,0x12ae,0x12ae,0x12ae,0x12ae,0x12ae,0x19e,
-0x19e,0x12ae,0x12ae,0x12ae,0x12ae,0x12ae,0x12ae,0x12ae,0x12ae,0x12ae,0x12ae,0x12ae,0x12ae,0x12ae,0x12ae,0x1446,
-0x19e,0x12ae,0x12ae,0x12ae,0x12ae,0x12ae,0x12ae,0x12ae,0x12ae,0x12ae,0x12ae,0x12ae,0x12ae,0x12ae,0x12ae,0x12ae,
-0x19e,0x12ae,0x12ae,0x12ae,0x12ae,0x12ae,0x12ae,0x12ae,0x12ae,0x12ae,0x12ae,0x12ae,0x12ae,0x12ae,0x12ae,0x12ae,
-0x1446,0x1446,0x1446,0x1446,0x1446,0x1446,0x1446,0x1446,0x1446,0x1446,0x1446,0x1446,0x1446,0x1446,0x1446,0x1446,
-0x1446,0x1446,0x1446,0x1446,0x1446,0x1446,0x19e,0x19e,0x19e,0x19e,0x19e,0x19e,0x19e,0x19e,0x19e,0x19e,
-0x12b4,0x12b4,0x12b4,0x12b4,0x12b4,0x12b4,0x12b4,0x12b4,0x144c,0x144c,0x144c,0x144c,0x144c,0x144c,0x144c,0x144c,
-0x144c,0x144c,0x144c,0x144c,0x144c,0x144c,0x144c,0x144c,0x144c,0x144c,0x1a1,0x144c,0x144c,0x144c,0x144c,0x144c,
-0x1a1,0x144c,0x144c,0x144c,0x144c,0x144c,0x144c,0x144c,0x144c,0x144c,0x144c,0x144c,0x144c,0x144c,0x144c,0x144c,
-0x144c,0x144c,0x144c,0x144c,0x144c,0x144c,0x144c,0x144c,0x144c,0x144c,0x144c,0x144c,0x12ba,0x12ba,0x12ba,0x12ba,
-0x12ba,0x12ba,0x1452,0x1452,0x1452,0x1452,0x1452,0x1452,0x1452,0x1452,0x1452,0x1452,0x15fc,0x1a4,0x1a4,0x1a4,
-0x1a4,0x1a4,0x1a4,0x1a4,0x1a4,0x1a4,0x1a4,0x1a4,0x1a4,0x1a4,0x1a4,0x1a4,0x1452,0x1452,0x1452,0x1452,
-0x1452,0x1452,0x1452,0x1452,0x1452,0x1452,0x1452,0x1452,0x1452,0x1a4,0x1a4,0x1a4,0x1452,0x1452,0x1452,0x1452,
-0x1a4,0x1a4,0x1a4,0x1a4,0x1a4,0x1a4,0x1a4,0x1a4,0x1a4,0x1a4,0x1a4,0x1a4,0x12bd,0x12bd,0x12bd,0x12bd,
-0x12bd,0x12bd,0x12bd,0x12bd,0x12bd,0x12bd,0x12bd,0x12bd,0x12bd,0x12bd,0x12bd,0x12bd,0x12bd,0x12bd,0x12bd,0x12bd,
-0x1a7,0x1a7,0x1a7,0x1a7,0x1a7,0x1a7,0x1a7,0x1a7,0x1a7,0x1a7,0x1a7,0x1a7,0x132c,0x1458,0x132c,0x132c,
-0x132c,0x132c,0x132c,0x132c,0x132c,0x132c,0x132c,0x132c,0x132c,0x1458,0x1458,0x1458,0x1458,0x1458,0x1458,0x1602,
-0x1602,0x1aa,0x1aa,0x1aa,0x1aa,0x1aa,0x1aa,0x1aa,0x1aa,0x1aa,0x1aa,0x1aa,0x1aa,0x1aa,0x1aa,0x1aa,
-0x1aa,0x1aa,0x1aa,0x1aa,0x1aa,0x1aa,0x1aa,0x1aa,0x1aa,0x1aa,0x1aa,0x1aa,0x1aa,0x1aa,0x1aa,0x1aa,
-0x1aa,0x1aa,0x1aa,0x1aa,0x1aa,0x1aa,0x1aa,0x15ff,0x1329,0x1329,0x1329,0x1329,0x1329,0x1329,0x1326,0x1326,
-0x1326,0x1326,0x1326,0x1326,0x1329,0x1329,0x1329,0x1329,0x1329,0x1329,0x1329,0x1329,0x1329,0x1329,0x1329,0x1329,
-0x1329,0x1329,0x1329,0x1455,0x1332,0x1332,0x1332,0x1332,0x1ad,0x1332,0x1332,0x1332,0x1332,0x1332,0x1332,0x1332,
-0x1332,0x1332,0x1332,0x1332,0x1332,0x1332,0x1332,0x1332,0x1332,0x1332,0x1332,0x1332,0x1332,0x1332,0x1332,0x1332,
-0x1332,0x1332,0x1332,0x1332,0x1ad,0x1332,0x1332,0x1ad,0x1332,0x1ad,0x1ad,0x1332,0x1ad,0x1332,0x1332,0x1332,
-0x1332,0x1332,0x1332,0x1332,0x1332,0x1332,0x1332,0x1ad,0x1332,0x1332,0x1332,0x1332,0x1ad,0x1332,0x1ad,0x1332,
-0x1ad,0x1ad,0x1ad,0x1ad,0x1ad,0x1ad,0x1332,0x1ad,0x1ad,0x1ad,0x1ad,0x1332,0x1ad,0x1332,0x1ad,0x1332,
-0x1ad,0x1332,0x1332,0x1332,0x1ad,0x1332,0x1332,0x1ad,0x1332,0x1ad,0x1ad,0x1332,0x1ad,0x1332,0x1ad,0x1332,
-0x1ad,0x1332,0x1ad,0x1332,0x1ad,0x1332,0x1332,0x1ad,0x1332,0x1ad,0x1ad,0x1332,0x1332,0x1332,0x1332,0x1ad,
-0x1332,0x1332,0x1332,0x1332,0x1332,0x1332,0x1332,0x1ad,0x1332,0x1332,0x1332,0x1332,0x1ad,0x1332,0x1332,0x1332,
-0x1332,0x1ad,0x1332,0x1ad,0x1332,0x1332,0x1332,0x1332,0x1332,0x1332,0x1332,0x1332,0x1332,0x1332,0x1ad,0x1332,
-0x1332,0x1332,0x1332,0x1332,0x1332,0x1332,0x1332,0x1332,0x1332,0x1332,0x1332,0x1332,0x1332,0x1332,0x1332,0x1332,
-0x1ad,0x1ad,0x1ad,0x1ad,0x1ad,0x1332,0x1332,0x1332,0x1ad,0x1332,0x1332,0x1332,0x1332,0x1332,0x1ad,0x1332,
-0x1332,0x1332,0x1332,0x1332,0x1332,0x1332,0x1332,0x1332,0x1332,0x1332,0x1332,0x1332,0x1332,0x1332,0x1332,0x1332,
-0x1ad,0x1ad,0x1ad,0x1ad,0x1ad,0x1ad,0x1ad,0x1ad,0x1ad,0x1ad,0x1ad,0x1ad,0x1ad,0x1ad,0x1ad,0x1ad,
-0x1ad,0x1ad,0x1ad,0x1ad,0x1ad,0x1ad,0x1ad,0x1ad,0x1ad,0x1ad,0x1ad,0x1ad,0x1ad,0x1ad,0x1ad,0x1ad,
-0x132f,0x132f,0x1ad,0x1ad,0x1ad,0x1ad,0x1ad,0x1ad,0x1ad,0x1ad,0x1ad,0x1ad,0x1ad,0x1ad,0x1ad,0x1ad,
-0x1347,0x1347,0x1347,0x1347,0x1347,0x1347,0x1347,0x1335,0x1335,0x1335,0x1335,0x1335,0x1344,0x1335,0x1338,0x1338,
-0x1335,0x1335,0x1335,0x133b,0x133b,0x1b0,0x1341,0x1341,0x1341,0x1341,0x1341,0x1341,0x1341,0x1341,0x1341,0x1341,
-0x133e,0x134a,0x134a,0x134a,0x1b0,0x1b0,0x1b0,0x1b0,0x1b0,0x1b0,0x1b0,0x1b0,0x1b0,0x1b0,0x1b0,0x1b0,
-0x14e2,0x14e2,0x14e2,0x14e2,0x14e2,0x14e2,0x14e2,0x14e2,0x14e2,0x14e2,0x14e2,0x14e2,0x14e2,0x14e2,0x14e2,0x14e2,
-0x1356,0x1356,0x1356,0x1356,0x1356,0x1356,0x1356,0x1356,0x1356,0x1356,0x1356,0x1353,0x134d,0x134d,0x1353,0x1353,
-0x135c,0x135c,0x1356,0x1359,0x1359,0x1353,0x1350,0x1b3,0x1b3,0x1b3,0x1b3,0x1b3,0x1b3,0x1b3,0x1b3,0x1b3,
-0x135f,0x135f,0x135f,0x135f,0x135f,0x135f,0x135f,0x135f,0x135f,0x135f,0x135f,0x135f,0x135f,0x135f,0x135f,0x135f,
-0x135f,0x135f,0x135f,0x135f,0x135f,0x135f,0x135f,0x135f,0x1b6,0x1b6,0x1b6,0x1b6,0x1605,0x1605,0x135f,0x135f,
-0x1605,0x1605,0x1605,0x1605,0x1605,0x1605,0x1605,0x1605,0x1605,0x1605,0x1605,0x1605,0x1605,0x1605,0x1605,0x1605,
-0x1b6,0x1b6,0x1605,0x1605,0x1605,0x1605,0x1605,0x1605,0x1605,0x1605,0x1605,0x1605,0x1605,0x1605,0x1605,0x1605,
-0x136b,0x136b,0x136b,0x136b,0x136b,0x1b9,0x1b9,0x1b9,0x1b9,0x1b9,0x1b9,0x1b9,0x1b9,0x1b9,0x1b9,0x1b9,
-0x136b,0x1368,0x1368,0x1368,0x1368,0x1368,0x1368,0x1368,0x1368,0x1368,0x1368,0x1368,0x1368,0x1368,0x1368,0x1368,
-0x1368,0x1368,0x1368,0x1368,0x1368,0x1368,0x1368,0x1368,0x1368,0x1368,0x1368,0x1368,0x1368,0x1368,0x1368,0x1368,
-0x1368,0x1368,0x1368,0x1b9,0x1b9,0x1b9,0x1b9,0x1b9,0x1b9,0x1b9,0x1b9,0x1b9,0x1b9,0x1b9,0x1b9,0x1b9,
-0x1b9,0x1b9,0x1b9,0x1365,0x1365,0x1365,0x1365,0x136e,0x136e,0x136e,0x136e,0x136e,0x136e,0x136e,0x136e,0x136e,
-0x136e,0x136e,0x136e,0x136e,0x1380,0x1383,0x1383,0x1383,0x1383,0x1386,0x1386,0x1374,0x1377,0x160b,0x1608,0x1608,
-0x1608,0x145e,0x1bc,0x1bc,0x137a,0x137a,0x137a,0x137a,0x137a,0x137a,0x137a,0x137a,0x137a,0x137a,0x145b,0x1611,
-0x1614,0x160e,0x1617,0x1617,0x138c,0x138c,0x138c,0x138c,0x138c,0x138c,0x138c,0x138c,0x138c,0x1bf,0x1bf,0x1bf,
-0x1bf,0x1bf,0x1bf,0x1bf,0x1389,0x1389,0x1389,0x1389,0x1389,0x1389,0x1389,0x1389,0x1389,0x1389,0x1bf,0x1bf,
-0x1bf,0x1bf,0x1bf,0x1bf,0x138f,0x138f,0x138f,0x138f,0x138f,0x138f,0x138f,0x138f,0x1c2,0x1c2,0x1c2,0x1c2,
-0x1c2,0x1c2,0x1c2,0x1c2,0x120c,0x1209,0x120c,0x11fa,0x1209,0x1209,0x1209,0x120f,0x1209,0x120f,0x1212,0x1209,
-0x120f,0x120f,0x1209,0x1209,0x13a1,0x13a1,0x13a1,0x13a1,0x13a1,0x13a1,0x13a1,0x13a1,0x13a1,0x13a1,0x13a1,0x1392,
-0x139b,0x1392,0x139b,0x139b,0x1392,0x1392,0x1392,0x1392,0x1392,0x1392,0x139e,0x1395,0x1c5,0x1c5,0x1c5,0x1c5,
-0x1c5,0x1c5,0x1c5,0x1c5,0x1464,0x1464,0x1464,0x1464,0x1464,0x1464,0x1464,0x1464,0x1464,0x1464,0x1464,0x1464,
-0x1464,0x1464,0x1c8,0x1c8,0x1461,0x1461,0x1461,0x1461,0x1461,0x1467,0x1c8,0x1c8,0x1c8,0x1c8,0x1c8,0x1c8,
-0x1c8,0x1c8,0x1c8,0x1c8,0x15bd,0x15b4,0x15b4,0x15b4,0x15b4,0x15b4,0x15b4,0x15b4,0x15b4,0x15b4,0x15b4,0x15b4,
-0x15b4,0x15b4,0x15b4,0x15b4,0x15b4,0x15b4,0x15b4,0x15b4,0x15b4,0x15b4,0x15b4,0x15b4,0x15b4,0x15b4,0x15b4,0x15b4,
-0x1ce,0x1ce,0x1ce,0x1ce,0x1d1,0x1d1,0x1d1,0x1d1,0x1d1,0x1d1,0x1d1,0x1d1,0x1d1,0x1d1,0x1d1,0x1d1,
-0x1d1,0x1d1,0x1d1,0x1d1,0x1d1,0x1d1,0x1d1,0x1d1,0x1d1,0x1d1,0x1d1,0x1d1,0x1d1,0x1d1,0x1d1,0x1d1,
-0x1d1,0x1d1,0x1d1,0x1d1,0x147f,0x147f,0x147f,0x147f,0x147f,0x147f,0x147f,0x147f,0x147f,0x147f,0x147f,0x1d4,
-0x1d4,0x1d4,0x1d4,0x1d4,0x147f,0x147f,0x147f,0x147f,0x147f,0x147f,0x147f,0x147f,0x147f,0x147f,0x147f,0x147f,
-0x147f,0x1d4,0x1d4,0x1d4,0x1d4,0x1d4,0x1d4,0x1d4,0x147f,0x147f,0x147f,0x147f,0x147f,0x147f,0x147f,0x147f,
-0x147f,0x147f,0x1d4,0x1d4,0x147c,0x1476,0x1479,0x1482,0x1485,0x1485,0x1485,0x1485,0x1485,0x1485,0x1485,0x1485,
-0x1d7,0x1d7,0x1d7,0x1d7,0x1d7,0x1d7,0x1d7,0x1d7,0x146d,0x146d,0x146d,0x146d,0x146d,0x146d,0x146d,0x146d,
-0x146d,0x146d,0x146d,0x146d,0x146d,0x146d,0x146d,0x146d,0x1488,0x1488,0x1488,0x1488,0x1488,0x1488,0x1488,0x1488,
-0x1488,0x1488,0x1488,0x1488,0x1488,0x1488,0x1488,0x1488,0x1488,0x1488,0x1488,0x1488,0x1488,0x1da,0x1da,0x1da,
-0x1da,0x1da,0x1da,0x1da,0x1da,0x1da,0x1da,0x1da,0x1da,0x1da,0x1da,0x1da,0x1da,0x1da,0x1da,0x1da,
-0x1da,0x1da,0x1da,0x1da,0x1da,0x1da,0x1da,0x1da,0x1da,0x1da,0x1da,0x1da,0x1da,0x1da,0x1da,0x1da,
-0x161a,0x148b,0x1491,0x1491,0x1dd,0x149a,0x149a,0x149a,0x149a,0x149a,0x149a,0x149a,0x149a,0x1dd,0x1dd,0x149a,
-0x149a,0x1dd,0x1dd,0x149a,0x149a,0x149a,0x149a,0x149a,0x149a,0x149a,0x149a,0x149a,0x149a,0x149a,0x149a,0x149a,
-0x149a,0x1dd,0x149a,0x149a,0x149a,0x149a,0x149a,0x149a,0x149a,0x1dd,0x149a,0x149a,0x1dd,0x149a,0x149a,0x149a,
-0x149a,0x149a,0x1dd,0x1dd,0x148e,0x149a,0x148b,0x1491,0x148b,0x1491,0x1491,0x1491,0x1491,0x1dd,0x1dd,0x1491,
-0x1491,0x1dd,0x1dd,0x1494,0x1494,0x1497,0x1dd,0x1dd,0x161d,0x1dd,0x1dd,0x1dd,0x1dd,0x1dd,0x1dd,0x148b,
-0x1dd,0x1dd,0x1dd,0x1dd,0x1dd,0x149d,0x149a,0x149a,0x149a,0x149a,0x1491,0x1491,0x1dd,0x1dd,0x148e,0x148e,
-0x148e,0x148e,0x148e,0x148e,0x148e,0x1dd,0x1dd,0x1dd,0x148e,0x148e,0x148e,0x148e,0x148e,0x1dd,0x1dd,0x1dd,
-0x1dd,0x1dd,0x1dd,0x1dd,0x1dd,0x1dd,0x1dd,0x1dd,0x14b2,0x14b2,0x14b2,0x14b2,0x14b2,0x14b2,0x14b2,0x14b2,
-0x14b2,0x14b2,0x14b2,0x14b2,0x14b2,0x14b2,0x14b2,0x14b2,0x14b2,0x14b2,0x1e0,0x14b2,0x14b2,0x14b2,0x14b2,0x14b2,
-0x14b2,0x14b2,0x14b2,0x14b2,0x14b2,0x14b2,0x14b2,0x14b2,0x14ac,0x14ac,0x14ac,0x14a0,0x14a0,0x14a0,0x14ac,0x14ac,
-0x14a0,0x14af,0x14a3,0x14a0,0x14b5,0x14b5,0x14a9,0x14b5,0x14b5,0x14a6,0x1e0,0x1e0,0x14c4,0x14c4,0x14c4,0x14b8,
-0x14b8,0x14b8,0x14b8,0x14b8,0x14b8,0x14bb,0x14be,0x1e3,0x1e3,0x1e3,0x1e3,0x1e3,0x14c1,0x14c1,0x14c1,0x14c1,
-0x14c1,0x14c1,0x14c1,0x14c1,0x14c1,0x14c1,0x1e3,0x1e3,0x1e3,0x1e3,0x1e3,0x1e3,0x1620,0x1620,0x1620,0x1620,
-0x14d0,0x14cd,0x1e6,0x1e6,0x1e6,0x1e6,0x1e6,0x1e6,0x1e6,0x1e6,0x1e6,0x1e6,0x164a,0x164a,0x164a,0x164a,
-0x164a,0x164a,0x164a,0x164a,0x164a,0x164a,0x164a,0x164a,0x164a,0x164a,0x164a,0x164a,0x14d6,0x14d6,0x14d6,0x14d6,
-0x14d6,0x14d6,0x14d6,0x14d6,0x14d6,0x14d6,0x14d6,0x14d6,0x14d6,0x14d6,0x14d6,0x14d6,0x14d6,0x14d6,0x14d6,0x14d6,
-0x14d6,0x14d6,0x14d6,0x1e9,0x1e9,0x1e9,0x1e9,0x1e9,0x1e9,0x1e9,0x1e9,0x1e9,0x14d6,0x14d6,0x14d6,0x14d6,
-0x14d6,0x14d6,0x14d6,0x14d6,0x14d6,0x14d6,0x14d6,0x14d6,0x14d6,0x14d6,0x14d6,0x14d6,0x14d6,0x14d6,0x14d6,0x14d6,
-0x14d6,0x14d6,0x1e9,0x1e9,0x1e9,0x1e9,0x1e9,0x1e9,0x1e9,0x1e9,0x1e9,0x1e9,0x14d6,0x14d6,0x14d6,0x14d6,
-0x14d6,0x14d6,0x14d6,0x14d6,0x1e9,0x1e9,0x1e9,0x1e9,0x1e9,0x1e9,0x1e9,0x1e9,0x1e9,0x1e9,0x1e9,0x1e9,
-0x1e9,0x1e9,0x1e9,0x1e9,0x1e9,0x1e9,0x1e9,0x1e9,0x1e9,0x1e9,0x1e9,0x1e9,0x14e2,0x14e2,0x14e2,0x14e2,
-0x14e2,0x14e2,0x14e2,0x14e2,0x14e2,0x14e2,0x14e2,0x14e2,0x14e2,0x14e2,0x14e2,0x14e2,0x14e2,0x14e2,0x14e2,0x14d9,
-0x14dc,0x14df,0x14e2,0x1ec,0x1ec,0x1ec,0x1ec,0x1ec,0x1ec,0x1ec,0x1ec,0x1ec,0x14f1,0x14f1,0x14f1,0x14f1,
-0x14f1,0x14e5,0x14e5,0x1ef,0x1ef,0x1ef,0x1ef,0x14e8,0x14e8,0x14e8,0x14e8,0x14e8,0x14ee,0x14ee,0x14ee,0x14ee,
-0x14ee,0x14ee,0x14eb,0x1ef,0x1ef,0x1ef,0x1ef,0x1ef,0x1ef,0x1ef,0x1ef,0x1ef,0x14fa,0x14fa,0x14fa,0x14fa,
-0x14fa,0x1f2,0x1f2,0x14f7,0x14f7,0x14f7,0x14f7,0x14f7,0x14f7,0x14f7,0x14f7,0x14f7,0x14f4,0x14f4,0x14f4,0x14f4,
-0x14f4,0x14f4,0x14f4,0x1f2,0x1f2,0x1f2,0x1f2,0x1f2,0x1f2,0x1f2,0x1f2,0x1f2,0x14fd,0x150f,0x150f,0x1503,
-0x150c,0x1f5,0x1f5,0x1f5,0x1f5,0x1f5,0x1f5,0x1f5,0x1f5,0x1f5,0x1f5,0x1f5,0x1506,0x1506,0x1506,0x1506,
-0x1506,0x1506,0x1506,0x1506,0x1506,0x1506,0x1f5,0x1f5,0x1f5,0x1f5,0x1f5,0x1f5,0x1515,0x1515,0x1515,0x1515,
-0x1515,0x1515,0x1515,0x1515,0x1515,0x1515,0x1515,0x1515,0x1515,0x1515,0x1515,0x1515,0x1515,0x1515,0x1515,0x1515,
-0x1515,0x1515,0x1515,0x1515,0x1515,0x1515,0x1515,0x1515,0x1515,0x1515,0x1515,0x1f8,0x1521,0x1521,0x1521,0x1521,
-0x1521,0x151b,0x1524,0x1521,0x1521,0x1521,0x1521,0x1521,0x1521,0x1521,0x1521,0x1521,0x151e,0x151e,0x151e,0x151e,
-0x151e,0x151e,0x151e,0x151e,0x151e,0x151e,0x1521,0x1521,0x1521,0x1521,0x1521,0x1fb,0x152a,0x152a,0x152a,0x152a,
-0x152a,0x152a,0x152a,0x152a,0x152a,0x152a,0x152a,0x152a,0x152a,0x152a,0x152a,0x152a,0x152a,0x152a,0x152a,0x152a,
-0x152a,0x152a,0x152a,0x152a,0x152a,0x152a,0x152a,0x152a,0x152a,0x152a,0x152a,0x1fe,0x1536,0x1536,0x1536,0x1536,
-0x1536,0x1536,0x1536,0x1536,0x1536,0x1536,0x1536,0x1536,0x1536,0x1536,0x1536,0x1536,0x1536,0x1536,0x1536,0x1536,
-0x1536,0x1536,0x1533,0x1533,0x1533,0x1533,0x1533,0x201,0x201,0x201,0x201,0x201,0x154e,0x154e,0x1551,0x1551,
-0x1554,0x1545,0x204,0x204,0x204,0x204,0x204,0x204,0x204,0x204,0x204,0x204,0x154b,0x154b,0x154b,0x154b,
-0x154b,0x154b,0x154b,0x154b,0x154b,0x154b,0x204,0x1545,0x1545,0x1545,0x1545,0x1545,0x1545,0x1545,0x204,0x154e,
-0x154e,0x154e,0x154e,0x154e,0x154e,0x154e,0x154e,0x154e,0x154e,0x154e,0x154e,0x154e,0x154e,0x154e,0x154e,0x154e,
-0x154e,0x154e,0x154e,0x154e,0x204,0x204,0x204,0x204,0x204,0x154e,0x154e,0x154e,0x155d,0x155d,0x155d,0x155d,
-0x155d,0x155d,0x155d,0x155d,0x155d,0x155d,0x155d,0x155d,0x155d,0x155d,0x155d,0x155d,0x155d,0x155d,0x155d,0x155d,
-0x155d,0x155d,0x155d,0x155d,0x155d,0x207,0x207,0x207,0x207,0x207,0x207,0x207,0x1566,0x1566,0x1566,0x1566,
-0x1566,0x1566,0x1566,0x1566,0x1566,0x1566,0x1566,0x1566,0x1566,0x1566,0x1566,0x1566,0x1566,0x1566,0x20a,0x20a,
-0x20a,0x20a,0x20a,0x20a,0x20a,0x1563,0x1563,0x1563,0x1563,0x20a,0x20a,0x20a,0x1581,0x1581,0x1581,0x1581,
-0x1581,0x1581,0x1581,0x1581,0x1581,0x1581,0x1581,0x1581,0x1581,0x1581,0x1581,0x1569,0x157b,0x157b,0x1569,0x1569,
-0x1569,0x1569,0x210,0x210,0x157b,0x157b,0x157e,0x157e,0x1569,0x1569,0x157b,0x156f,0x156c,0x1572,0x1584,0x1584,
-0x1575,0x1575,0x1578,0x1578,0x1578,0x1584,0x1629,0x1629,0x1629,0x1629,0x1629,0x1629,0x1629,0x1629,0x1629,0x1629,
-0x1629,0x1629,0x1629,0x1629,0x1626,0x1626,0x1626,0x1626,0x1623,0x1623,0x210,0x210,0x210,0x210,0x210,0x210,
-0x210,0x210,0x210,0x210,0x210,0x210,0x210,0x210,0x210,0x210,0x210,0x210,0x210,0x210,0x210,0x210,
-0x210,0x210,0x210,0x210,0x210,0x210,0x210,0x210,0x210,0x210,0x210,0x210,0x213,0x1587,0x1587,0x1587,
-0x1587,0x1587,0x1587,0x1587,0x1587,0x1587,0x1587,0x1587,0x1587,0x1587,0x1587,0x1587,0x1587,0x1587,0x1587,0x1587,
-0x1587,0x213,0x213,0x213,0x213,0x213,0x213,0x213,0x213,0x213,0x213,0x213,0x158a,0x158a,0x158a,0x158a,
-0x158a,0x158a,0x158a,0x158a,0x158a,0x158a,0x158a,0x158a,0x216,0x216,0x216,0x216,0x158a,0x158a,0x158a,0x158a,
-0x158a,0x158a,0x158a,0x158a,0x158a,0x158a,0x158a,0x158a,0x158a,0x158a,0x158a,0x158a,0x216,0x216,0x216,0x216,
-0x216,0x216,0x216,0x216,0x158a,0x158a,0x158a,0x158a,0x158a,0x158a,0x158a,0x158a,0x158a,0x158a,0x216,0x216,
-0x216,0x216,0x216,0x216,0x158a,0x158a,0x158a,0x158a,0x158a,0x158a,0x158a,0x158a,0x216,0x216,0x216,0x216,
-0x216,0x216,0x216,0x216,0x158a,0x158a,0x158a,0x158a,0x158a,0x158a,0x158a,0x158a,0x158a,0x158a,0x158a,0x158a,
-0x158a,0x158a,0x158a,0x158a,0x158a,0x158a,0x216,0x216,0x216,0x216,0x216,0x216,0x216,0x216,0x216,0x216,
-0x216,0x216,0x216,0x216,0x216,0x216,0x216,0x216,0x216,0x216,0x216,0x216,0x216,0x216,0x216,0x216,
-0x216,0x216,0x216,0x216,0x216,0x216,0x216,0x216,0x158d,0x159c,0x1593,0x1590,0x15a2,0x15a2,0x1596,0x15a2,
-0x219,0x219,0x219,0x219,0x219,0x219,0x219,0x219,0x1599,0x1599,0x1599,0x1599,0x1599,0x1599,0x1599,0x1599,
-0x1599,0x1599,0x219,0x219,0x219,0x219,0x219,0x219,0x15a8,0x15a8,0x15a8,0x15a8,0x15a8,0x15a8,0x15a8,0x15a8,
-0x15a8,0x15a8,0x15a5,0x15a5,0x15a5,0x15a5,0x15a5,0x15a5,0x15a5,0x15a5,0x15a5,0x21c,0x21c,0x21c,0x21c,0x21c,
-0x21c,0x21c,0x21c,0x21c,0x21c,0x21c,0x21c,0x15ae,0x163b,0x163b,0x163b,0x163b,0x163b,0x163b,0x163b,0x163b,
-0x163b,0x163b,0x163b,0x163b,0x163b,0x163b,0x163b,0x163b,0x163b,0x163b,0x163b,0x163b,0x163b,0x163b,0x163b,0x163b,
-0x163b,0x163b,0x21f,0x21f,0x21f,0x162c,0x162c,0x162c,0x1638,0x1638,0x162c,0x162c,0x162c,0x162c,0x1638,0x162c,
-0x162c,0x162c,0x162c,0x162f,0x21f,0x21f,0x21f,0x21f,0x1635,0x1635,0x1635,0x1635,0x1635,0x1635,0x1635,0x1635,
-0x1635,0x1635,0x1632,0x1632,0x163e,0x163e,0x163e,0x1632,0x1641,0x1641,0x1641,0x1641,0x1641,0x1641,0x1641,0x222,
-0x222,0x222,0x222,0x222,0x222,0x222,0x222,0x222,0x222,0x222,0x222,0x222,0x222,0x222,0x222,0x222,
-0x222,0x222,0x222,0x222,0x222,0x222,0x222,0x222,0x222,0x222,0x222,0x222,0x222,0x222,0x222,0x222,
-0x1653,0x1653,0x1653,0x1653,0x1653,0x1653,0x1653,0x1653,0x1653,0x1653,0x1653,0x1653,0x1653,0x1653,0x1653,0x1653,
-0x1653,0x1653,0x1653,0x228,0x1653,0x1653,0x228,0x228,0x228,0x228,0x228,0x1650,0x1650,0x1650,0x1650,0x1650,
-0x1656,0x1656,0x1656,0x1656,0x1656,0x1656,0x1656,0x22b,0x1656,0x22b,0x1656,0x1656,0x1656,0x1656,0x22b,0x1656,
-0x1656,0x1656,0x1656,0x1656,0x1656,0x1656,0x1656,0x1656,0x1656,0x1656,0x1656,0x1656,0x1656,0x1656,0x22b,0x1656,
-0x1656,0x1656,0x1656,0x1656,0x1656,0x1656,0x1656,0x1656,0x1656,0x1659,0x22b,0x22b,0x22b,0x22b,0x22b,0x22b,
-0x14c7,0x14c7,0x14c7,0x14c7,0x14c7,0x14c7,0x14c7,0x14c7,0x14c7,0x14c7,0x14c7,0x14c7,0x14c7,0x14c7,0x14c7,0x14c7,
-0x1662,0x1662,0x1662,0x1662,0x1662,0x1662,0x1662,0x1662,0x1662,0x1662,0x1662,0x1662,0x1662,0x1662,0x1662,0x1662,
-0x1662,0x1662,0x1662,0x22e,0x22e,0x22e,0x22e,0x22e,0x22e,0x22e,0x22e,0x22e,0x22e,0x22e,0x22e,0x22e,
-0x165f,0x165f,0x165f,0x165f,0x165f,0x165f,0x165f,0x165f,0x165f,0x165f,0x165f,0x165f,0x165f,0x165f,0x165f,0x165f,
-0x165f,0x165f,0x165f,0x22e,0x22e,0x22e,0x22e,0x22e,0x22e,0x22e,0x165c,0x165c,0x165c,0x165c,0x165c,0x165c,
-0x231,0x231,0x231,0x231,0x231,0x231,0x231,0x231,0x231,0x231,0x231,0x231,0x231,0x231,0x231,0x231,
-0x1665,0x1665,0x1665,0x1665,0x1665,0x1665,0x1665,0x1665,0x1665,0x231,0x231,0x231,0x231,0x231,0x231,0x231,
-0x231,0x231,0x231,0x231,0x231,0x231,0x231,0x231,0x231,0x231,0x231,0x231,0x231,0x231,0x231,0x231,
-0x231,0x231,0x231,0x231,0x231,0x231,0x231,0x231,0x231,0x231,0x231,0x231,0x166b,0x166b,0x166b,0x166b,
-0x1668,0x166b,0x166b,0x166e,0x1671,0x166e,0x166e,0x166b,0x234,0x234,0x234,0x234,0x234,0x234,0x234,0x234,
-0x234,0x234,0x234,0x234,0x234,0x234,0x234,0x1668,0x1668,0x1668,0x1668,0x1668,0x237,0x237,0x237,0x237,
-0x237,0x237,0x237,0x237,0x237,0x237,0x237,0x237,0x237,0x237,0x237,0x237,0x237,0x237,0x237,0x237,
-0x237,0x237,0x237,0x237,0x237,0x237,0x237,0x237,0x237,0x237,0x237,0x237,0x1677,0x1677,0x24f,0x24f,
-0x24f,0x24f,0x24f,0x24f,0x24f,0x24f,0x24f,0x24f,0x24f,0x24f,0x24f,0x24f,0x237,0x237,0x237,0x237,
-0x237,0x237,0x237,0x237,0x237,0x237,0x237,0x237,0x237,0x237,0x237,0x237,0x237,0x237,0x237,0x237,
-0x237,0x237,0x237,0x237,0x237,0x237,0x237,0x237,0x237,0x237,0x8c1,0x8c1,0xa80,0xa80,0xa80,0xa80,
-0xa80,0xa80,0xa80,0xa80,0xa80,0xa80,0xa80,0xa80,0xa80,0xa80,0xa80,0xa80,0xa80,0xa80,0xa80,0xa80,
-0xa80,0xa80,0x23a,0x23a,0x23a,0x23a,0x23a,0x23a,0x23a,0x23a,0x23a,0x23a,0x104d,0x104d,0x104d,0x104d,
-0x11df,0x11df,0x11df,0x11df,0x11df,0x11df,0x11df,0x11df,0x13a4,0x1674,0x1674,0x1674,0x1674,0x1674,0x1674,0x1674,
-0x1674,0x1674,0x23d,0x23d,0x23d,0x23d,0x23d,0x23d,0x23d,0x23d,0x23d,0x23d,0x23d,0x23d,0x23d,0x23d,
-0x23d,0x23d,0x23d,0x23d,0x23d,0x23d,0x23d,0x23d,0x23d,0x23d,0x23d,0x23d,0x23d,0x23d,0x23d,0x23d,
-0x23d,0x23d,0x23d,0x23d,0xbc7,0xbc7,0xbc7,0xbc7,0xbc7,0xbc7,0xbc7,0xbc7,0xbc7,0xbc7,0xbc7,0x11e2,
-0x11e2,0x11e2,0x240,0x240,0xde0,0xde0,0xde0,0xde0,0xde0,0xde0,0xde0,0xde0,0xde0,0xde0,0xde0,0xde0,
-0xde0,0xde0,0xde0,0xde0,0xde0,0xde0,0xde0,0xde0,0xde0,0xde0,0xde0,0xde0,0xde0,0xde0,0x240,0x240,
-0x240,0x240,0x240,0x240,0x240,0x240,0x240,0x240,0x240,0x240,0x240,0x240,0x240,0x240,0x240,0x240,
-0x240,0x240,0x240,0x240,0x240,0x240,0x240,0x240,0x240,0x240,0x240,0x240,0x240,0x240,0x240,0x240,
-0xae3,0xae3,0xae3,0xae3,0xae3,0xae3,0xae3,0xae3,0xae3,0xae3,0xae3,0xae3,0xae3,0xae3,0xae3,0xae3,
-0xae3,0xae3,0xae3,0xae3,0xae3,0xae3,0xae3,0x243,0x243,0x243,0x243,0x243,0x243,0x243,0x243,0x243,
-0xae6,0xae6,0xae6,0xae6,0xae6,0xae6,0xae6,0xae6,0xae6,0xae6,0xae6,0xae6,0xae6,0xae6,0xae6,0xae6,
-0xae6,0xae6,0xae6,0xae6,0xae6,0xae6,0xae6,0xae6,0xae6,0xae6,0xae6,0xae6,0xae6,0xae6,0x246,0x246,
-0x11f1,0x11f1,0x11f1,0x11f1,0x11f1,0x11f1,0x11f1,0x11f1,0x11f1,0x11f1,0x11f1,0x11f1,0x11f1,0x11f1,0x11f1,0x11f1,
-0x11f1,0x11f1,0x11f1,0x11f1,0x11f1,0x249,0x249,0x249,0x249,0x249,0x249,0x249,0x249,0x249,0x249,0x249,
-0x12db,0x12db,0x12db,0x12db,0x12db,0x12db,0x12db,0x12db,0x12db,0x12db,0x12db,0x12db,0x12db,0x12db,0x12db,0x12db,
-0x12db,0x12db,0x12db,0x12db,0x12db,0x12db,0x12db,0x12db,0x12db,0x12db,0x12db,0x12db,0x12db,0x12db,0x24c,0x24c,
-0x105f,0x34b,0x34b,0x357,0xc09,0x35a,0x35a,0x35a,0x35a,0x35a,0x35a,0x35a,0x35a,0x35a,0x35a,0x35a,
-0x35a,0x35a,0x35a,0x35a,0x35a,0x35a,0x35a,0x35a,0x35a,0x35a,0x35a,0x35a,0x35a,0x35a,0x35a,0x35a,
-0x357,0x34b,0x34b,0x34b,0x34b,0x34b,0x34b,0x34b,0x34b,0x357,0x357,0x357,0x357,0x351,0x1062,0x1221,
-0x35a,0x891,0x894,0x34e,0x34e,0x105f,0x121e,0x121e,0x35d,0x35d,0x35d,0x35d,0x35d,0x35d,0x35d,0x35d,
-0x35a,0x35a,0x34b,0x34b,0x822,0x825,0x8a9,0x8a9,0x8a9,0x8a9,0x8a9,0x8a9,0x8a9,0x8a9,0x8a9,0x8a9,
-0x354,0xec7,0xec4,0x1224,0x1224,0x1224,0x1224,0x1224,0x13c8,0x1065,0x1065,0xe19,0xe19,0xcf0,0xe19,0xe19,
-0x35a,0x35a,0x35a,0x35a,0x35a,0x35a,0x35a,0x35a,0x35a,0x35d,0x35a,0x35a,0x35a,0x35a,0x35a,0x35a,
-0x35a,0x35d,0x35a,0x35a,0x35d,0x35a,0x35a,0x35a,0x35a,0x35a,0x121e,0x1221,0x34e,0x35a,0x357,0x357,
-0x43b,0x43b,0x43b,0x43b,0x43b,0x43b,0x43b,0x43b,0x43b,0x43b,0x43b,0x43b,0x43b,0x43b,0x43b,0x43b,
-0x43b,0x43b,0x43b,0x43b,0x43b,0x43b,0x43b,0xb01,0xb01,0xcfc,0xcfc,0x438,0xcff,0x12ea,0x12ea,0x12ea,
-0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,
-0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,
-0x444,0x444,0x444,0x107a,0x107a,0x107a,0x107a,0x107a,0x441,0x441,0x441,0x441,0x441,0x441,0x441,0x441,
-0x441,0x441,0x441,0x441,0x441,0x441,0x441,0x441,0x441,0x441,0x441,0x441,0x441,0x441,0x441,0x441,
-0x441,0x441,0x441,0x441,0x441,0x441,0x441,0x441,0x441,0x441,0x1077,0x1077,0x1077,0x1077,0x1077,0x1077,
-0x447,0x444,0x444,0x444,0x444,0x444,0x444,0x444,0x444,0x444,0x444,0x444,0x444,0x444,0x444,0x444,
-0x444,0x444,0x444,0x444,0x444,0x444,0x444,0x444,0x444,0x444,0x444,0x444,0x444,0x444,0x444,0x444,
-0x444,0x444,0x444,0x444,0x450,0x44a,0x450,0x44a,0x450,0x44a,0x450,0x44a,0x450,0x44a,0x450,0x44a,
+0xc75,0xc75,0xc75,0xc75,0xc75,0xc75,0xc75,0xc75,0xc75,0xc75,0xc75,0xc75,0xc75,0xc75,0xc75,0xc75,
+0xc75,0xc75,0xc75,0xc75,0xc75,0xc75,0xc75,0xc75,0xc75,0xc75,0xc75,0xc75,0xc75,0xc75,0xc75,0xc75,
+0xc75,0xc75,0xc75,0xc75,0xc75,0xc75,0xc6c,0xc6c,0xc6c,0xc6c,0xc6c,0xc69,0xc7e,0xc7e,0xc7e,0xc78,
+0xc7e,0xc7e,0xc7e,0xc7e,0xc7e,0xc7e,0xc7e,0xc7e,0xc7e,0xc7e,0xc7e,0xc78,0xc7e,0xc7e,0xc7e,0xc7e,
+0xc7e,0xc7e,0xc7e,0xc7e,0xc7e,0xc7e,0xc7e,0xc7e,0xc7e,0xc7e,0xc78,0xc7e,0xc7e,0xc7e,0xc7e,0xc7e,
+0xc7e,0xc7e,0xc7e,0xc7e,0xc7e,0xc7e,0xc7e,0xc7e,0xc7e,0xc72,0xc72,0xc72,0xc72,0xc72,0xc7b,0xc7b,
+0xc7b,0xc7b,0xc6f,0xc6f,0xc6f,0xc6f,0xc6f,0xc75,0xd38,0xd38,0xd38,0xd38,0xd38,0xd38,0xd38,0xd38,
+0xd38,0xd38,0xd38,0xd38,0xd35,0xd38,0xd38,0xd38,0xd38,0xd38,0xd38,0xd38,0xdaa,0xdaa,0xdaa,0xdaa,
+0xdaa,0xdaa,0xdaa,0xdaa,0xdaa,0xdaa,0xdaa,0xdaa,0xdaa,0xdaa,0xdaa,0xdaa,0xdaa,0xdaa,0xdaa,0xdaa,
+0xdaa,0xdaa,0xdaa,0xdaa,0xdaa,0xdaa,0xdaa,0xdad,0xdad,0xdad,0xdad,0xdad,0xdad,0xdad,0xdad,0xdad,
+0xdad,0xdad,0xdad,0xdad,0xdad,0xdad,0xdad,0xdad,0xdad,0xdad,0xdad,0xdad,0xdad,0xdad,0xdad,0xdad,
+0xdad,0xdad,0xdad,0xdad,0xdad,0xdad,0xdad,0xdad,0xdad,0xdad,0xdad,0xda7,0xe01,0xe01,0xd59,0xd59,
+0xe49,0xe49,0xe49,0xe49,0xe49,0xe49,0xe49,0xf4b,0xf4b,0xf4b,0xf4b,0xf4b,0xf48,0xf48,0xf48,0xf48,
+0xf48,0xf48,0xf48,0xf48,0xf48,0xf48,0xf48,0xf48,0xf48,0xf48,0xf48,0xf48,0xf48,0xf48,0xf48,0xf48,
+0xf48,0xf48,0xf48,0x1401,0x1401,0x1401,0x1401,0x1401,0x1401,0x1401,0x1401,0x1401,0x1401,0x1401,0x1401,0x1401,
+0x1401,0x1404,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0x125d,0x1098,0xe49,0xe49,0x450,0x44a,0x450,0x44a,
+0x450,0x44a,0x450,0x44a,0x450,0x44a,0x450,0x44a,0x450,0x44a,0x450,0x44a,0x450,0x44a,0x450,0x44a,
+0x450,0x44a,0x450,0x44a,0x450,0x44a,0x450,0x44a,0x450,0x44a,0x450,0x44a,0x450,0x44a,0x450,0x44a,
 0x450,0x44a,0x450,0x44a,0x450,0x44a,0x450,0x44a,0x450,0x44a,0x450,0x44a,0x450,0x44a,0x450,0x44a,
-0x450,0x44a,0x450,0x44a,0x450,0x44a,0x44a,0x44a,0x44a,0x44a,0x44d,0x903,0xf15,0xf15,0xf18,0xf15,
+0x450,0x44a,0x450,0x44a,0x450,0x44a,0x450,0x44a,0x450,0x44a,0x450,0x44a,0x44a,0x44a,0x44a,0x44a,
+0x44d,0x903,0xf15,0xf15,0xf18,0xf15,0x450,0x44a,0x450,0x44a,0x450,0x44a,0x450,0x44a,0x450,0x44a,
 0x450,0x44a,0x450,0x44a,0x450,0x44a,0x450,0x44a,0x450,0x44a,0x450,0x44a,0x450,0x44a,0x450,0x44a,
-0x450,0x44a,0x450,0x44a,0x450,0x44a,0x450,0x44a,0x450,0x44a,0xf18,0xf15,0xf18,0xf15,0xf18,0xf15,
-0x45c,0x45c,0x45c,0x45c,0x45c,0x45c,0x45c,0x45c,0x45f,0x45f,0x45f,0x45f,0x45f,0x45f,0x45f,0x45f,
-0x45c,0x45c,0x45c,0x45c,0x45c,0x45c,0x45c,0x45c,0x45f,0x45f,0x45f,0x45f,0x45f,0x45f,0x45f,0x45f,
-0x61b,0x61b,0x61e,0x47a,0x62a,0x627,0x627,0x624,0x4a4,0x4a4,0x462,0x462,0x462,0x462,0x462,0xa32,
-0x62d,0x486,0x645,0x648,0x49b,0x62d,0x489,0x489,0x47a,0x495,0x495,0x61b,0x4a1,0x49e,0x621,0x474,
-0x46b,0x46b,0x46e,0x46e,0x46e,0x46e,0x46e,0x471,0x46e,0x46e,0x46e,0x465,0x4aa,0x4aa,0x4a7,0x4a7,
-0x639,0x48f,0x48c,0x636,0x633,0x630,0x642,0x47d,0x63f,0x63f,0x492,0x495,0x63c,0x63c,0x492,0x495,
-0x477,0x47a,0x47a,0x47a,0x498,0x483,0x480,0xb16,0xa38,0xa38,0xa35,0xa35,0xa35,0xa35,0xb0d,0xb0d,
-0xb0d,0xb0d,0xb13,0xc36,0xc33,0xd0b,0xd0e,0xb10,0xd0e,0xd0e,0xd0e,0xd0e,0xd0b,0xd0e,0xd0e,0xb0a,
-0x4dd,0x4dd,0x4f5,0x65a,0x4da,0x654,0x4dd,0x4f2,0x4da,0x65a,0x4ec,0x4f5,0x4f5,0x4f5,0x4ec,0x4ec,
-0x4f5,0x4f5,0x4f5,0x660,0x4da,0x4f5,0x65d,0x4da,0x4e9,0x4f5,0x4f5,0x4f5,0x4f5,0x4f5,0x4da,0x4da,
-0x4e0,0x654,0x657,0x4da,0x4f5,0x4da,0x663,0x4da,0x4f5,0x4e3,0x4fb,0x666,0x4f5,0x4f5,0x4e6,0x4ec,
-0x4f5,0x4f5,0x4f8,0x4f5,0x4ec,0x4ef,0x4ef,0x4ef,0x4ef,0xa44,0xa41,0xc39,0xd1d,0xb31,0xb34,0xb34,
-0xb2e,0xb2b,0xb2b,0xb2b,0xb2b,0xb34,0xb31,0xb31,0xb31,0xb31,0xb28,0xb2b,0xd1a,0xe25,0xe28,0xf1e,
-0x1089,0x1089,0x1089,0x66c,0x669,0x4fe,0x501,0x501,0x501,0x501,0x501,0x669,0x66c,0x66c,0x669,0x501,
-0x672,0x672,0x672,0x672,0x672,0x672,0x672,0x672,0x672,0x672,0x672,0x672,0x50a,0x50a,0x50a,0x50a,
-0x66f,0x66f,0x66f,0x66f,0x66f,0x66f,0x66f,0x66f,0x66f,0x66f,0x504,0x504,0x504,0x504,0x504,0x504,
-0x510,0x510,0x510,0x510,0x510,0x510,0x510,0x510,0x50d,0x510,0x510,0x510,0x510,0x510,0x513,0x50d,
-0x510,0x510,0x50d,0x50d,0x50d,0x50d,0x510,0x510,0x675,0x675,0x50d,0x50d,0x510,0x510,0x510,0x510,
-0x510,0x510,0x510,0x510,0x510,0x510,0x510,0x510,0x510,0x513,0x513,0x513,0x510,0x510,0x678,0x510,
-0x678,0x510,0x510,0x510,0x510,0x510,0x510,0x510,0x50d,0x510,0x50d,0x50d,0x50d,0x50d,0x50d,0x50d,
-0x510,0x510,0x50d,0x675,0x50d,0x50d,0x50d,0xa4a,0xa4a,0xa4a,0xa4a,0xa4a,0xa4a,0xa4a,0xa4a,0xa4a,
-0xb37,0xb37,0xb37,0xb37,0xb37,0xb37,0xb37,0xb37,0xb37,0xb37,0xb37,0xb37,0x67b,0x516,0x67b,0x67b,
-0x519,0x516,0x516,0x67b,0x67b,0x519,0x516,0x67b,0x519,0x516,0x516,0x67b,0x516,0x67b,0x525,0x522,
-0x516,0x67b,0x516,0x516,0x516,0x516,0x67b,0x516,0x516,0x67b,0x67b,0x67b,0x67b,0x516,0x516,0x67b,
-0x519,0x67b,0x519,0x67b,0x67b,0x67b,0x67b,0x67b,0x681,0x51c,0x67b,0x51c,0x51c,0x516,0x516,0x516,
-0x67b,0x67b,0x67b,0x67b,0x516,0x516,0x516,0x516,0x67b,0x67b,0x516,0x516,0x516,0x519,0x516,0x516,
-0x519,0x516,0x516,0x519,0x67b,0x519,0x516,0x516,0x67b,0x516,0x516,0x516,0x516,0x516,0x67b,0x516,
-0x516,0x516,0x516,0x516,0x516,0x516,0x516,0x516,0x516,0x516,0x516,0x516,0x67e,0x67b,0x519,0x516,
-0x67b,0x67b,0x67b,0x67b,0x516,0x516,0x67b,0x67b,0x516,0x519,0x67e,0x67e,0x519,0x519,0x516,0x516,
-0x519,0x519,0x516,0x516,0x519,0x519,0x516,0x516,0x516,0x516,0x516,0x516,0x519,0x519,0x67b,0x67b,
-0x519,0x519,0x67b,0x67b,0x519,0x519,0x516,0x516,0x516,0x516,0x516,0x516,0x516,0x516,0x516,0x516,
-0x516,0x67b,0x516,0x516,0x516,0x67b,0x516,0x516,0x516,0x516,0x516,0x516,0x516,0x67b,0x516,0x516,
-0x516,0x516,0x516,0x516,0x519,0x519,0x519,0x519,0x516,0x516,0x516,0x516,0x516,0x516,0x516,0x516,
-0x516,0x516,0x516,0x516,0x516,0x516,0x516,0x67b,0x516,0x516,0x516,0x516,0x516,0x516,0x516,0x516,
+0x450,0x44a,0x450,0x44a,0x450,0x44a,0x450,0x44a,0x450,0x44a,0x450,0x44a,0x450,0x44a,0x450,0x44a,
+0x450,0x44a,0x450,0x44a,0x450,0x44a,0x450,0x44a,0x450,0x44a,0x450,0x44a,0x450,0x44a,0x450,0x44a,
+0xf18,0xf15,0xf18,0xf15,0xf18,0xf15,0x45c,0x45c,0x45c,0x45c,0x45c,0x45c,0x45c,0x45c,0x45f,0x45f,
+0x45f,0x45f,0x45f,0x45f,0x45f,0x45f,0x45c,0x45c,0x45c,0x45c,0x45c,0x45c,0x51,0x51,0x45f,0x45f,
+0x45f,0x45f,0x45f,0x45f,0x51,0x51,0x45c,0x45c,0x45c,0x45c,0x45c,0x45c,0x45c,0x45c,0x45f,0x45f,
+0x45f,0x45f,0x45f,0x45f,0x45f,0x45f,0x45c,0x45c,0x45c,0x45c,0x45c,0x45c,0x45c,0x45c,0x45f,0x45f,
+0x45f,0x45f,0x45f,0x45f,0x45f,0x45f,0x45c,0x45c,0x45c,0x45c,0x45c,0x45c,0x51,0x51,0x45f,0x45f,
+0x45f,0x45f,0x45f,0x45f,0x51,0x51,0x45c,0x45c,0x45c,0x45c,0x45c,0x45c,0x45c,0x45c,0x51,0x45f,
+0x51,0x45f,0x51,0x45f,0x51,0x45f,0x45c,0x45c,0x45c,0x45c,0x45c,0x45c,0x45c,0x45c,0x45f,0x45f,
+0x45f,0x45f,0x45f,0x45f,0x45f,0x45f,0x45c,0x45c,0x45c,0x45c,0x45c,0x45c,0x45c,0x45c,0x45c,0x45c,
+0x45c,0x45c,0x45c,0x45c,0x51,0x51,0x45c,0x45c,0x45c,0x45c,0x45c,0x45c,0x45c,0x45c,0x45f,0x45f,
+0x45f,0x45f,0x45f,0x45f,0x45f,0x45f,0x45c,0x45c,0x45c,0x45c,0x45c,0x45c,0x45c,0x45c,0x45f,0x45f,
+0x45f,0x45f,0x45f,0x45f,0x45f,0x45f,0x45c,0x45c,0x45c,0x45c,0x45c,0x45c,0x45c,0x45c,0x45f,0x45f,
+0x45f,0x45f,0x45f,0x45f,0x45f,0x45f,0x45c,0x45c,0x45c,0x45c,0x45c,0x51,0x45c,0x45c,0x45f,0x45f,
+0x45f,0x45f,0x45f,0x456,0x45c,0x456,0x453,0x45c,0x45c,0x45c,0x51,0x45c,0x45c,0x45f,0x45f,0x45f,
+0x45f,0x45f,0x453,0x453,0x453,0x45c,0x45c,0x45c,0x45c,0x51,0x51,0x45c,0x45c,0x45f,0x45f,0x45f,
+0x45f,0x51,0x453,0x453,0x453,0x45c,0x45c,0x45c,0x45c,0x45c,0x45c,0x45c,0x45c,0x45f,0x45f,0x45f,
+0x45f,0x45f,0x453,0x453,0x453,0x51,0x51,0x45c,0x45c,0x45c,0x51,0x45c,0x45c,0x45f,0x45f,0x45f,
+0x45f,0x45f,0x459,0x456,0x51,0x46b,0x46b,0x46e,0x46e,0x46e,0x46e,0x46e,0x471,0x46e,0x46e,0x46e,
+0x465,0x4aa,0x4aa,0x4a7,0x4a7,0x639,0x48f,0x48c,0x636,0x633,0x630,0x642,0x47d,0x63f,0x63f,0x492,
+0x495,0x63c,0x63c,0x492,0x495,0x61b,0x61b,0x61e,0x47a,0x62a,0x627,0x627,0x624,0x4a4,0x4a4,0x462,
+0x462,0x462,0x462,0x462,0xa32,0x62d,0x486,0x645,0x648,0x49b,0x62d,0x489,0x489,0x47a,0x495,0x495,
+0x61b,0x4a1,0x49e,0x621,0x474,0x477,0x47a,0x47a,0x47a,0x498,0x483,0x480,0xb16,0xa38,0xa38,0xa35,
+0xa35,0xa35,0xa35,0xb0d,0xb0d,0xb0d,0xb0d,0xb13,0xc36,0xc33,0xd0b,0xd0e,0xb10,0xd0e,0xd0e,0xd0e,
+0xd0e,0xd0b,0xd0e,0xd0e,0xb0a,0xb04,0xb07,0xb07,0xb07,0xf1b,0x54,0x13bc,0x13bc,0x13bc,0x13bc,0x468,
+0x468,0x468,0x468,0x468,0x468,0x4b0,0xb19,0x57,0x57,0x64e,0x4b0,0x4b0,0x4b0,0x4b0,0x4b0,0x4b6,
+0x4c8,0x4b6,0x4c2,0x4bc,0x651,0x4ad,0x64b,0x64b,0x64b,0x64b,0x4ad,0x4ad,0x4ad,0x4ad,0x4ad,0x4b3,
+0x4c5,0x4b3,0x4bf,0x4b9,0x57,0xd11,0xd11,0xd11,0xd11,0xd11,0x1239,0x1239,0x1239,0x1239,0x1239,0x1239,
+0x1239,0x1239,0x57,0x57,0x57,0x4ce,0x4ce,0x4ce,0x4ce,0x4ce,0x4ce,0x4ce,0x4cb,0x4d1,0x6b4,0x4ce,
+0x906,0x927,0xa3b,0xa3b,0xa3b,0xb1c,0xb1c,0xd14,0xd14,0xd14,0xd14,0x1083,0x1086,0x1086,0x123c,0x13b6,
+0x13e0,0x13e3,0x13e3,0x15cf,0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,0x5a,
+0x5a,0x5a,0x5a,0x5a,0x4d7,0x4d7,0x4d7,0x4d7,0x4d7,0x4d7,0x4d7,0x4d7,0x4d7,0x4d7,0x4d7,0x4d7,
+0x4d7,0x4d4,0x4d4,0x4d4,0x4d4,0x4d7,0xa3e,0xa3e,0xb1f,0xb25,0xb25,0xb22,0xb22,0xb22,0xb22,0xd17,
+0xe22,0xe22,0xe22,0xe22,0x1056,0x5d,0x5d,0x5d,0x5d,0x5d,0x5d,0x5d,0x5d,0x5d,0x5d,0x5d,
+0x5d,0x5d,0x5d,0x5d,0x4dd,0x4dd,0x4f5,0x65a,0x4da,0x654,0x4dd,0x4f2,0x4da,0x65a,0x4ec,0x4f5,
+0x4f5,0x4f5,0x4ec,0x4ec,0x4f5,0x4f5,0x4f5,0x660,0x4da,0x4f5,0x65d,0x4da,0x4e9,0x4f5,0x4f5,0x4f5,
+0x4f5,0x4f5,0x4da,0x4da,0x4e0,0x654,0x657,0x4da,0x4f5,0x4da,0x663,0x4da,0x4f5,0x4e3,0x4fb,0x666,
+0x4f5,0x4f5,0x4e6,0x4ec,0x4f5,0x4f5,0x4f8,0x4f5,0x4ec,0x4ef,0x4ef,0x4ef,0x4ef,0xa44,0xa41,0xc39,
+0xd1d,0xb31,0xb34,0xb34,0xb2e,0xb2b,0xb2b,0xb2b,0xb2b,0xb34,0xb31,0xb31,0xb31,0xb31,0xb28,0xb2b,
+0xd1a,0xe25,0xe28,0xf1e,0x1089,0x1089,0x1089,0x66c,0x669,0x4fe,0x501,0x501,0x501,0x501,0x501,0x669,
+0x66c,0x66c,0x669,0x501,0x672,0x672,0x672,0x672,0x672,0x672,0x672,0x672,0x672,0x672,0x672,0x672,
+0x50a,0x50a,0x50a,0x50a,0x66f,0x66f,0x66f,0x66f,0x66f,0x66f,0x66f,0x66f,0x66f,0x66f,0x504,0x504,
+0x504,0x504,0x504,0x504,0x507,0x507,0x507,0xa47,0xe2b,0xf21,0xf21,0xf21,0xf21,0x11b5,0x15d2,0x15d2,
+0x60,0x60,0x60,0x60,0x678,0x678,0x678,0x678,0x678,0x678,0x678,0x678,0x678,0x678,0x513,0x513,
+0x510,0x510,0x510,0x510,0x510,0x510,0x510,0x510,0x510,0x510,0x510,0x510,0x50d,0x510,0x510,0x510,
+0x510,0x510,0x513,0x50d,0x510,0x510,0x50d,0x50d,0x50d,0x50d,0x510,0x510,0x675,0x675,0x50d,0x50d,
+0x510,0x510,0x510,0x510,0x510,0x510,0x510,0x510,0x510,0x510,0x510,0x510,0x510,0x513,0x513,0x513,
+0x510,0x510,0x678,0x510,0x678,0x510,0x510,0x510,0x510,0x510,0x510,0x510,0x50d,0x510,0x50d,0x50d,
+0x50d,0x50d,0x50d,0x50d,0x510,0x510,0x50d,0x675,0x50d,0x50d,0x50d,0xa4a,0xa4a,0xa4a,0xa4a,0xa4a,
+0xa4a,0xa4a,0xa4a,0xa4a,0xb37,0xb37,0xb37,0xb37,0xb37,0xb37,0xb37,0xb37,0xb37,0xb37,0xb37,0xb37,
+0x67b,0x516,0x67b,0x67b,0x519,0x516,0x516,0x67b,0x67b,0x519,0x516,0x67b,0x519,0x516,0x516,0x67b,
+0x516,0x67b,0x525,0x522,0x516,0x67b,0x516,0x516,0x516,0x516,0x67b,0x516,0x516,0x67b,0x67b,0x67b,
+0x67b,0x516,0x516,0x67b,0x519,0x67b,0x519,0x67b,0x67b,0x67b,0x67b,0x67b,0x681,0x51c,0x67b,0x51c,
+0x51c,0x516,0x516,0x516,0x67b,0x67b,0x67b,0x67b,0x516,0x516,0x516,0x516,0x67b,0x67b,0x516,0x516,
+0x519,0x516,0x516,0x519,0x516,0x516,0x519,0x67b,0x519,0x516,0x516,0x67b,0x516,0x516,0x516,0x516,
+0x516,0x67b,0x516,0x516,0x516,0x516,0x516,0x516,0x516,0x516,0x516,0x516,0x516,0x516,0x516,0x67e,
+0x67b,0x519,0x516,0x67b,0x67b,0x67b,0x67b,0x516,0x516,0x67b,0x67b,0x516,0x519,0x67e,0x67e,0x519,
+0x519,0x516,0x516,0x519,0x519,0x516,0x516,0x519,0x519,0x516,0x516,0x516,0x516,0x516,0x516,0x519,
+0x519,0x67b,0x67b,0x519,0x519,0x67b,0x67b,0x519,0x519,0x516,0x516,0x516,0x516,0x516,0x516,0x516,
+0x516,0x516,0x516,0x516,0x67b,0x516,0x516,0x516,0x67b,0x516,0x516,0x516,0x516,0x516,0x516,0x516,
+0x516,0x516,0x516,0x516,0x67b,0x516,0x516,0x516,0x516,0x516,0x516,0x519,0x519,0x519,0x519,0x516,
+0x516,0x516,0x516,0x516,0x516,0x516,0x516,0x516,0x516,0x516,0x516,0x516,0x516,0x516,0x67b,0x516,
 0x516,0x516,0x516,0x516,0x516,0x516,0x516,0x516,0x516,0x516,0x516,0x516,0x516,0x516,0x516,0x516,
-0x516,0x516,0x516,0x516,0x516,0x516,0x516,0x516,0x519,0x519,0x519,0x519,0x516,0x516,0x516,0x516,
-0x516,0x516,0x519,0x519,0x519,0x519,0x516,0x51f,0x516,0x516,0xb3a,0xb3a,0xb3a,0xb3a,0xb3a,0xb3a,
-0xb3a,0xb3a,0xb3a,0xb3a,0xb3a,0xb3a,0xb3a,0xb3a,0x528,0xa4d,0x528,0x528,0x528,0x528,0x528,0x528,
-0x534,0x531,0x534,0x531,0x528,0x528,0x528,0x528,0x528,0x528,0x684,0x528,0x528,0x528,0x528,0x528,
-0x528,0x528,0x52b,0x52b,0x528,0x528,0x528,0x528,0x52e,0x52e,0x528,0x528,0x528,0x528,0x528,0x528,
-0x528,0x777,0x774,0x528,0x528,0x528,0x528,0x528,0x528,0x528,0x528,0x528,0x528,0x528,0x528,0x528,
+0x516,0x516,0x516,0x516,0x516,0x516,0x516,0x516,0x516,0x516,0x516,0x516,0x516,0x516,0x516,0x519,
+0x519,0x519,0x519,0x516,0x516,0x516,0x516,0x516,0x516,0x519,0x519,0x519,0x519,0x516,0x51f,0x516,
+0x516,0xb3a,0xb3a,0xb3a,0xb3a,0xb3a,0xb3a,0xb3a,0xb3a,0xb3a,0xb3a,0xb3a,0xb3a,0xb3a,0xb3a,0x528,
+0xa4d,0x528,0x528,0x528,0x528,0x528,0x528,0x534,0x531,0x534,0x531,0x528,0x528,0x528,0x528,0x528,
+0x528,0x684,0x528,0x528,0x528,0x528,0x528,0x528,0x528,0x52b,0x52b,0x528,0x528,0x528,0x528,0x52e,
+0x52e,0x528,0x528,0x528,0x528,0x528,0x528,0x528,0x777,0x774,0x528,0x528,0x528,0x528,0x528,0x528,
+0x528,0x528,0x528,0x528,0x528,0x528,0x528,0x528,0x528,0x528,0x528,0x528,0x528,0x528,0x528,0x528,
+0x528,0x528,0x528,0x528,0x528,0x528,0x528,0x528,0x528,0x528,0x528,0x528,0x528,0x528,0x528,0x528,
 0x528,0x528,0x528,0x528,0x528,0x528,0x528,0x528,0x528,0x528,0x528,0x528,0x528,0x528,0x528,0x528,
-0x528,0x528,0x528,0x528,0x528,0x528,0x528,0xa4d,0xb40,0xa4d,0xa4d,0xa4d,0x537,0x537,0x537,0x537,
+0x528,0x528,0x528,0x528,0x528,0xa4d,0xb40,0xa4d,0xa4d,0xa4d,0xa4d,0xa4d,0xa4d,0xa4d,0xa4d,0xa4d,
+0xa4d,0xa4d,0xa4d,0xa4d,0xa4d,0xa4d,0xa4d,0xa4d,0xa4d,0xa4d,0xa4d,0xa4d,0xa4d,0xa4d,0xa4d,0xa4d,
+0xa4d,0xa4d,0xb40,0xb40,0xb40,0xb40,0xb40,0xb40,0xb40,0xb40,0xb40,0xb40,0xb40,0xb40,0xb40,0xb40,
+0xb40,0xb40,0xb40,0xb40,0xb40,0xb40,0xb40,0xb40,0xb40,0xb40,0xb40,0xb40,0xb40,0xb3d,0xb40,0xb3d,
+0xb3d,0xb3d,0xb3d,0xb3d,0xb3d,0xb3d,0xb3d,0xb3d,0xb3d,0xb3d,0xb3d,0xb3d,0xb3d,0xb3d,0xc3c,0xc3f,
+0xd20,0xd20,0xd20,0xd20,0xd20,0xd20,0xd20,0xd20,0xd20,0xd20,0xd20,0xe31,0xe31,0xe31,0xe31,0xe31,
+0xe31,0xe31,0xe2e,0xe2e,0xe2e,0xe2e,0xe2e,0x108c,0x123f,0x123f,0x123f,0x123f,0x123f,0x123f,0x123f,0x1242,
+0x1242,0x1242,0x1242,0x13e6,0x13e6,0x13e6,0x13e6,0x13e6,0x13e6,0x13e6,0x63,0x63,0x63,0x63,0x63,0x537,
+0x537,0x537,0x537,0x537,0x537,0x537,0x537,0x537,0x537,0x537,0x537,0x537,0x537,0x537,0x537,0x537,
 0x537,0x537,0x537,0x537,0x537,0x537,0x537,0x537,0x537,0x537,0x537,0x537,0x537,0x537,0x537,0x537,
-0x537,0x537,0x537,0x537,0x537,0x537,0x537,0x537,0x537,0x537,0x537,0x537,0x68d,0x68d,0x68d,0x68d,
-0x68d,0x68d,0x68d,0x68d,0x68d,0x68d,0x53d,0xb9d,0xb9d,0xb9d,0xb9d,0xb9d,0xb9d,0xb9d,0xb9d,0xb9d,
-0xb9d,0xb9d,0xb9d,0xb9d,0xb9d,0xb9d,0xb9d,0xb9d,0xb9d,0xb9d,0xb9d,0xca8,0x693,0x693,0x693,0x693,
+0x537,0x537,0x537,0x537,0xa50,0xa50,0x66,0x66,0x66,0x66,0x66,0x66,0x66,0x66,0x66,0x66,
+0x66,0x66,0x66,0x66,0x66,0x66,0x66,0x66,0x66,0x66,0x66,0x66,0x66,0x66,0x66,0x53a,
+0x53a,0x53a,0x53a,0x53a,0x53a,0x53a,0x53a,0x53a,0x53a,0x53a,0x69,0x69,0x69,0x69,0x69,0x69,
+0x69,0x69,0x69,0x69,0x69,0x69,0x69,0x69,0x69,0x69,0x69,0x69,0x69,0x69,0x69,0x68a,
+0x68a,0x68a,0x68a,0x68a,0x68a,0x68a,0x68a,0x68a,0x68a,0x68a,0x68a,0x68a,0x68a,0x68a,0x68a,0x68a,
+0x68a,0x68a,0x68a,0x687,0x687,0x687,0x687,0x687,0x687,0x687,0x687,0x687,0x687,0x687,0x687,0x687,
+0x687,0x687,0x687,0x687,0x687,0x687,0x687,0x687,0x687,0x687,0x687,0x687,0x687,0x687,0x687,0x687,
+0x687,0x687,0x687,0x687,0x687,0x687,0x687,0x687,0x687,0x687,0x687,0x687,0x687,0x687,0x687,0x687,
+0x687,0x687,0x687,0x687,0x687,0x687,0x687,0x687,0x687,0x690,0x690,0x690,0x690,0x690,0x690,0x690,
+0x690,0x690,0x690,0x690,0x690,0x690,0x690,0x690,0x690,0x68d,0x68d,0x68d,0x68d,0x68d,0x68d,0x68d,
+0x68d,0x68d,0x68d,0x68d,0x68d,0x68d,0x68d,0x68d,0x68d,0x68d,0x68d,0x68d,0x68d,0x68d,0x68d,0x68d,
+0x68d,0x68d,0x68d,0x53d,0xb9d,0xb9d,0xb9d,0xb9d,0xb9d,0xb9d,0xb9d,0xb9d,0xb9d,0xb9d,0xb9d,0xb9d,
+0xb9d,0xb9d,0xb9d,0xb9d,0xb9d,0xb9d,0xb9d,0xb9d,0xca8,0x693,0x693,0x693,0x693,0x693,0x693,0x693,
+0x693,0x693,0x693,0x693,0x693,0x693,0x693,0x693,0x693,0x693,0x693,0x693,0x693,0x693,0x693,0x693,
+0x693,0x693,0x693,0x693,0x693,0x693,0x693,0x693,0x693,0x693,0x693,0x693,0x693,0x693,0x693,0x693,
 0x693,0x693,0x693,0x693,0x693,0x693,0x693,0x693,0x693,0x693,0x693,0x693,0x693,0x693,0x693,0x693,
-0x540,0x543,0x543,0x543,0x543,0x543,0x543,0x543,0x543,0x543,0x543,0x543,0x693,0x693,0x693,0x693,
-0x693,0x693,0x693,0x693,0x693,0x693,0x693,0x693,0x543,0x543,0x543,0x543,0x693,0x693,0x693,0x693,
-0x693,0x693,0x693,0x693,0x693,0x693,0x693,0x693,0x693,0x693,0x693,0x693,0x696,0x696,0x696,0x696,
-0x696,0x696,0x696,0x696,0x696,0x696,0x696,0x696,0x696,0x696,0x696,0x696,0x546,0x546,0x696,0x696,
-0x696,0x696,0xb43,0xb43,0xb43,0xb43,0xb43,0xb43,0xb43,0xb43,0xb43,0xb43,0x69c,0x69c,0x549,0x699,
-0x699,0x699,0x699,0x699,0x699,0x699,0x549,0x549,0x549,0x549,0x54c,0x54c,0x54c,0x54c,0x69c,0x69c,
-0x54c,0x54c,0x69c,0x69c,0x549,0x549,0x549,0x549,0x69c,0x69c,0x54c,0x54c,0x69c,0x69c,0x549,0x549,
-0x549,0x549,0x69c,0x69c,0x699,0x549,0x54c,0x69c,0x549,0x549,0x699,0x69c,0x69c,0x69c,0x54c,0x54c,
-0x549,0x549,0x549,0x549,0x549,0x549,0x549,0x549,0x549,0x549,0x549,0x549,0x549,0x549,0x69c,0x699,
-0x69c,0x699,0x549,0x54c,0x54c,0x54c,0x54c,0x54c,0x54c,0x549,0x549,0x699,0xa53,0xa53,0xa53,0xa53,
-0xa53,0xa53,0xa53,0xa53,0xb46,0xb46,0xb46,0xb46,0xb46,0xb46,0xb46,0xb46,0x552,0x552,0x552,0x552,
-0x54f,0x6a5,0x6a5,0x54f,0x54f,0x69f,0x54f,0x54f,0x54f,0x54f,0x69f,0x69f,0x54f,0x54f,0x54f,0x54f,
-0xcab,0xcab,0xb49,0xb49,0xd26,0xa56,0x552,0x552,0x6a2,0x552,0x6a2,0x552,0x54f,0x54f,0x54f,0x54f,
+0x693,0x693,0x693,0x693,0x693,0x693,0x693,0x693,0x693,0x543,0x543,0x543,0x543,0x693,0x693,0x693,
+0x693,0x693,0x693,0x693,0x693,0x693,0x693,0x693,0x693,0x693,0x693,0x693,0x693,0x693,0x693,0x693,
+0x693,0x693,0x693,0x693,0x693,0x693,0x693,0x693,0x693,0x693,0x693,0x693,0x693,0x693,0x693,0x693,
+0x693,0x540,0x543,0x543,0x543,0x543,0x543,0x543,0x543,0x543,0x543,0x543,0x543,0x696,0x696,0x696,
+0x696,0x696,0x696,0x696,0x696,0x696,0x696,0x696,0x696,0x696,0x696,0x696,0x696,0x546,0x546,0x696,
+0x696,0x696,0x696,0xb43,0xb43,0xb43,0xb43,0xb43,0xb43,0xb43,0xb43,0xb43,0xb43,0x69c,0x69c,0x549,
+0x699,0x699,0x699,0x699,0x699,0x699,0x699,0x549,0x549,0x549,0x549,0x54c,0x54c,0x54c,0x54c,0x69c,
+0x69c,0x54c,0x54c,0x69c,0x69c,0x549,0x549,0x549,0x549,0x69c,0x69c,0x54c,0x54c,0x69c,0x69c,0x549,
+0x549,0x549,0x549,0x69c,0x69c,0x699,0x549,0x54c,0x69c,0x549,0x549,0x699,0x69c,0x69c,0x69c,0x54c,
+0x54c,0x549,0x549,0x549,0x549,0x549,0x549,0x549,0x549,0x549,0x549,0x549,0x549,0x549,0x549,0x69c,
+0x699,0x69c,0x699,0x549,0x54c,0x54c,0x54c,0x54c,0x54c,0x54c,0x549,0x549,0x699,0xa53,0xa53,0xa53,
+0xa53,0xa53,0xa53,0xa53,0xa53,0xb46,0xb46,0xb46,0xb46,0xb46,0xb46,0xb46,0xb46,0x552,0x552,0x552,
+0x552,0x54f,0x6a5,0x6a5,0x54f,0x54f,0x69f,0x54f,0x54f,0x54f,0x54f,0x69f,0x69f,0x54f,0x54f,0x54f,
+0x54f,0xcab,0xcab,0xb49,0xb49,0xd26,0xa56,0x552,0x552,0x6a2,0x552,0x6a2,0x552,0x54f,0x54f,0x54f,
 0x54f,0x54f,0x54f,0x54f,0x54f,0x54f,0x54f,0x54f,0x54f,0x54f,0x54f,0x54f,0x54f,0x54f,0x54f,0x54f,
-0x54f,0x54f,0x54f,0x54f,0x54f,0x552,0x552,0x552,0x54f,0x54f,0x54f,0x54f,0x6a5,0x54f,0x6a5,0x54f,
+0x54f,0x54f,0x54f,0x54f,0x54f,0x54f,0x552,0x552,0x552,0x54f,0x54f,0x54f,0x54f,0x6a5,0x54f,0x6a5,
 0x54f,0x54f,0x54f,0x54f,0x54f,0x54f,0x54f,0x54f,0x54f,0x54f,0x54f,0x54f,0x54f,0x54f,0x54f,0x54f,
-0x54f,0x54f,0x54f,0x54f,0x54f,0x54f,0x54f,0x54f,0x54f,0x54f,0x54f,0x54f,0x6a5,0x6a5,0x555,0x6a5,
-0x69f,0x69f,0x54f,0x69f,0x6a2,0x69f,0x69f,0x54f,0x69f,0x6a5,0x555,0x6a5,0xa56,0xa56,0xb4c,0xb4c,
-0xb4c,0xb4c,0xb4c,0xb4c,0xb4c,0xb4c,0xb4c,0xb4c,0xb4c,0xb4c,0xd23,0xd26,0x558,0x558,0x558,0x558,
-0x558,0x558,0x558,0x558,0x558,0x558,0x558,0x558,0x558,0x558,0x558,0x558,0x558,0x558,0x558,0x558,
-0x55b,0x1248,0x1248,0x1248,0x55b,0x55b,0x55b,0x55b,0x55b,0x55b,0x55b,0x55b,0x13e9,0x561,0x561,0x561,
-0x561,0x1248,0x55b,0x55b,0x561,0x561,0x124b,0x124b,0x561,0x561,0x55b,0x55b,0x55b,0x55b,0x55b,0x55b,
-0x55b,0x55b,0x55b,0x55b,0x55b,0x55b,0x55b,0x55b,0x55b,0x55b,0x55b,0x55b,0x1248,0x55b,0x55b,0x55b,
+0x54f,0x54f,0x54f,0x54f,0x54f,0x54f,0x54f,0x54f,0x54f,0x54f,0x54f,0x54f,0x54f,0x6a5,0x6a5,0x555,
+0x6a5,0x69f,0x69f,0x54f,0x69f,0x6a2,0x69f,0x69f,0x54f,0x69f,0x6a5,0x555,0x6a5,0xa56,0xa56,0xb4c,
+0xb4c,0xb4c,0xb4c,0xb4c,0xb4c,0xb4c,0xb4c,0xb4c,0xb4c,0xb4c,0xb4c,0xd23,0xd26,0xb4c,0xb4c,0xb4c,
+0xb4c,0xb4c,0xb4c,0xb4c,0xb4c,0xb4c,0xb4c,0xc42,0xc42,0xc42,0xc42,0xc42,0xc42,0xc42,0xc42,0xd23,
+0xd23,0xd23,0xd23,0xd23,0xd23,0xd23,0xd23,0xd23,0xd23,0xd23,0xf24,0x11b8,0x11b8,0xc42,0xc42,0xd23,
+0xd23,0xd23,0xd23,0xd23,0xd23,0xd23,0xd23,0xd23,0xd23,0xd23,0xd23,0xd23,0xd23,0xd23,0xd23,0xe34,
+0xf24,0xf24,0xf24,0xf24,0xf24,0xf24,0xf24,0xf24,0xf24,0xf24,0x108f,0x11bb,0x11bb,0xf27,0xf27,0xf27,
+0xf27,0x11bb,0x11bb,0x11bb,0x11bb,0x11bb,0x11b8,0x11b8,0x11b8,0x11b8,0x11bb,0x1245,0x11bb,0x11bb,0x11bb,0x11b8,
+0x11bb,0x11bb,0x11b8,0x11b8,0x11b8,0x11bb,0x11bb,0x11b8,0x11b8,0x11bb,0x11b8,0x11b8,0x11bb,0x11bb,0x11bb,0x1245,
+0x11b8,0x1245,0x1245,0x1245,0x1245,0x11b8,0x11b8,0x11bb,0x11b8,0x11b8,0x11b8,0x11b8,0x11b8,0x11b8,0x11bb,0x11bb,
+0x11bb,0x11bb,0x11bb,0x11b8,0x11bb,0x11bb,0x11bb,0x11bb,0x11b8,0x11b8,0x11bb,0x11bb,0x11bb,0x13e9,0x561,0x561,
+0x561,0x561,0x1248,0x55b,0x55b,0x561,0x561,0x124b,0x124b,0x561,0x561,0x55b,0x55b,0x55b,0x55b,0x55b,
 0x55b,0x55b,0x55b,0x55b,0x55b,0x55b,0x55b,0x55b,0x55b,0x55b,0x55b,0x55b,0x55b,0x55b,0x55b,0x55b,
-0x55b,0x6ab,0x55b,0x55b,0x55b,0x55b,0x55b,0x55b,0x55b,0x55b,0x55b,0x55b,0x55b,0x55b,0x55b,0x55b,
-0x1248,0x55b,0x1248,0x55b,0x55b,0x55b,0x55b,0x1248,0x1248,0x1248,0x55b,0x11be,0x55b,0x55b,0x55b,0x564,
-0x564,0x564,0x564,0x124e,0x124e,0x55b,0x55e,0x55e,0x55b,0x55b,0x55b,0x55b,0xb52,0xb4f,0xb52,0xb4f,
-0xb52,0xb4f,0xb52,0xb4f,0xb52,0xb4f,0xb52,0xb4f,0xb52,0xb4f,0x6a8,0x6a8,0x6a8,0x6a8,0x6a8,0x6a8,
-0x6a8,0x6a8,0x6a8,0x6a8,0x55b,0x55b,0x55b,0x55b,0x55b,0x55b,0x55b,0x55b,0x55b,0x55b,0x55b,0x55b,
-0x55b,0x55b,0x55b,0x55b,0x1248,0x55b,0x55b,0x55b,0x55b,0x55b,0x55b,0x55b,0x55b,0x55b,0x55b,0x55b,
-0x55b,0x55b,0x55b,0x1248,0x585,0x585,0x585,0x585,0x585,0x585,0x585,0x585,0x585,0x585,0x585,0x585,
-0x585,0x588,0x588,0x588,0x588,0x588,0x588,0x588,0x58e,0x58e,0x58e,0x58e,0x58e,0x58e,0x58e,0x58e,
-0x585,0x58b,0x57c,0x57f,0x58b,0x58b,0x58b,0x58b,0x58b,0x58b,0x58b,0x58b,0x58b,0x58b,0x58b,0x58b,
-0x58b,0x58b,0x58b,0x58b,0x58b,0x58b,0x58b,0x58b,0x58b,0x58b,0x58b,0x58b,0x58b,0x58b,0x58b,0x58b,
-0x58b,0x58b,0x582,0x582,0x582,0x582,0x582,0x582,0x585,0x585,0x585,0x585,0x585,0x585,0x585,0x585,
-0x585,0x585,0x585,0x585,0x585,0x585,0x585,0x585,0x585,0x585,0x585,0x585,0x585,0x585,0x585,0x585,
-0x585,0x585,0x585,0x585,0x588,0x58e,0x58b,0x585,0x588,0x58e,0x58b,0x585,0x588,0x58e,0x58b,0x585,
-0x588,0x58e,0x58b,0x585,0x588,0x58e,0x58b,0x585,0x588,0x58e,0x58b,0x585,0x588,0x58e,0x58b,0x585,
-0x588,0x58e,0x58b,0x585,0x58b,0x585,0x58b,0x585,0x58b,0x585,0x58b,0x585,0x58b,0x585,0x58b,0x585,
-0x588,0x58e,0x58b,0x585,0x588,0x58e,0x58b,0x585,0x588,0x58e,0x58b,0x585,0x588,0x58e,0x58b,0x585,
-0x58b,0x585,0x588,0x58e,0x58b,0x585,0x58b,0x585,0x588,0x58e,0x58b,0x585,0x588,0x58e,0x58b,0x585,
-0x58b,0x585,0x1251,0x1251,0x1251,0x1251,0x1251,0x1251,0x1251,0x1251,0x1251,0x1251,0x1251,0x1251,0x1251,0x1251,
-0x58b,0x585,0x58b,0x585,0x58b,0x585,0x588,0x58e,0x588,0x58e,0x58b,0x585,0x58b,0x585,0x58b,0x585,
-0x58b,0x585,0x58b,0x585,0x58b,0x585,0x58b,0x585,0x588,0x58b,0x585,0x588,0x58b,0x585,0x588,0x58e,
-0x585,0x585,0x585,0x585,0x585,0x585,0x585,0x585,0x585,0x585,0x585,0x585,0x585,0x585,0x585,0x585,
-0x585,0x585,0x585,0x585,0x585,0x585,0x585,0x588,0x588,0x588,0x588,0x588,0x588,0x588,0x588,0x588,
-0x58b,0x58b,0x58b,0x58b,0x58b,0x58b,0x58b,0x58b,0x58b,0x58b,0x58b,0x58b,0x58b,0x58b,0x58b,0x58b,
-0x58b,0x585,0x585,0x585,0x585,0x585,0x585,0x585,0x585,0x585,0x585,0x585,0x585,0x585,0x585,0x585,
-0x588,0x588,0x585,0x588,0x585,0x588,0x585,0x585,0x588,0x585,0x585,0x588,0x585,0x588,0x585,0x585,
-0x588,0x585,0x588,0x588,0x585,0x585,0x585,0x588,0x585,0x585,0x585,0x585,0x585,0x588,0x585,0x585,
-0x585,0x585,0x585,0x585,0x585,0x585,0x585,0x585,0x585,0x585,0x585,0x585,0x585,0x585,0x585,0x585,
-0x585,0x585,0x585,0x585,0x588,0x588,0x585,0x585,0x588,0x585,0x588,0x585,0x585,0x585,0x585,0x585,
-0x588,0x588,0x588,0x588,0x588,0x588,0x588,0x588,0x588,0x588,0x588,0x588,0x588,0x588,0x588,0x588,
-0x588,0x588,0x588,0x588,0x588,0x588,0x588,0x588,0x588,0x588,0x588,0x588,0x588,0x588,0x588,0x588,
-0x588,0x588,0x588,0x58e,0x58b,0x58b,0x58b,0x58b,0x58b,0x58b,0x58b,0x58b,0x58b,0x58b,0x58b,0x58b,
-0x58b,0x58b,0x58b,0x58b,0x58b,0x58b,0x58b,0x58b,0x58b,0x58b,0x58b,0x58b,0x58b,0x58b,0x58b,0x58b,
-0x58b,0x58b,0x58b,0x58b,0x58e,0x58e,0x58e,0x58e,0x58e,0x58e,0x58e,0x58e,0x58e,0x58e,0x58e,0x58e,
-0x58e,0x58e,0x58e,0x58e,0x58e,0x58e,0x58e,0x58e,0x58e,0x58b,0x58b,0x58b,0x58b,0x58b,0x58b,0x58b,
-0x58b,0x58b,0x58b,0x58b,0x591,0x591,0x591,0x591,0xf2a,0xf2a,0xf2a,0x13ec,0x13ec,0x13ec,0x13ec,0x13ec,
-0x13ec,0x13ec,0x15d5,0x15d5,0x7d4,0x7da,0x7da,0x7e6,0x7e6,0x7d7,0x7ce,0x7d7,0x7ce,0x7d7,0x7ce,0x7d7,
-0x7ce,0x7d7,0x7ce,0x7d7,0x5a0,0x5a0,0x59a,0x5a0,0x59a,0x5a0,0x59a,0x5a0,0x59a,0x5a0,0x59a,0x59d,
-0x5a3,0x5a0,0x59a,0x5a0,0x59a,0x59d,0x5a3,0x5a0,0x59a,0x5a0,0x59a,0x59d,0x5a3,0x5a0,0x59a,0x59d,
-0x5a3,0x5a0,0x59a,0x59d,0x5a3,0x5a0,0x59a,0x5a0,0x59a,0x5a0,0x59a,0x5a0,0x59a,0x5a0,0x59a,0x59d,
-0x5a3,0x5a0,0x59a,0x59d,0x5a3,0x5a0,0x59a,0x59d,0x5a3,0x5a0,0x59a,0x59d,0x5a3,0x5a0,0x59a,0x59d,
-0x5a3,0x5a0,0x59a,0x59d,0x5a3,0x5a0,0x59a,0x59d,0x5a3,0x5a0,0x59a,0x59d,0x5a3,0x5a0,0x59a,0x59d,
-0x68a,0x68a,0x68a,0x68a,0x68a,0x68a,0x68a,0x68a,0x68a,0x68a,0x68a,0x68a,0x68a,0x68a,0x68a,0x68a,
-0x68a,0x68a,0x68a,0x68a,0x687,0x687,0x687,0x687,0x687,0x687,0x687,0x687,0x687,0x687,0x687,0x687,
-0x687,0x687,0x687,0x687,0x687,0x687,0x687,0x687,0x687,0x687,0x687,0x687,0x687,0x687,0x687,0x687,
-0x687,0x687,0x687,0x687,0x687,0x687,0x690,0x690,0x690,0x690,0x690,0x690,0x690,0x690,0x690,0x690,
-0x690,0x690,0x690,0x690,0x690,0x690,0x690,0x690,0x68d,0x68d,0x68d,0x68d,0x68d,0x68d,0x68d,0x68d,
-0x68d,0x68d,0x68d,0x68d,0x68d,0x68d,0x68d,0x68d,0x693,0x693,0x693,0x693,0x693,0x693,0x693,0x693,
-0x693,0x693,0x693,0x693,0x693,0x693,0x693,0x693,0x693,0x693,0x693,0x693,0x693,0x693,0x693,0x693,
-0x693,0x693,0x693,0x693,0x693,0x693,0x693,0x693,0x6ae,0x6ae,0x6ae,0x6ae,0x6ae,0x6ae,0x6ae,0x6ae,
-0x6ae,0x6ae,0x6ae,0x6ae,0x6ae,0x6ae,0x6ae,0x6ae,0x6ae,0x6ae,0x6ae,0x6ae,0x6ae,0x6ae,0x6ae,0x6ae,
-0x6ae,0x6ae,0x6ae,0x6ae,0x6ae,0x6ae,0x6ae,0x6ae,0xba3,0x837,0x831,0x82e,0x834,0x82b,0x6c3,0x6c6,
-0x6c6,0x6c6,0x6c6,0x6c6,0x6c6,0x6c6,0x6c6,0x6c6,0x83d,0x6c3,0x6c3,0x6c3,0x6c3,0x6c3,0x6c3,0x6c3,
-0x6c3,0x6c3,0x6c3,0x6c3,0x6c3,0x6c3,0x6c3,0x6c3,0x6c3,0x6c3,0x6c3,0x6c3,0x6c3,0x6c3,0x6c3,0x6c3,
-0x6c3,0x6c3,0x6c3,0x6c3,0x6c3,0x6c3,0x6c3,0x6c3,0x6c3,0x6c3,0x83a,0x83a,0x6c9,0x84c,0x84f,0x855,
-0x77a,0x786,0x86a,0x783,0x843,0x840,0x843,0x840,0x849,0x846,0x849,0x846,0x843,0x840,0x780,0x855,
-0x843,0x840,0x843,0x840,0x843,0x840,0x843,0x840,0x85b,0x861,0x85e,0x85e,0x6cf,0x70b,0x70b,0x70b,
-0x70b,0x70b,0x70b,0x705,0x705,0x705,0x705,0x705,0x705,0x705,0x705,0x705,0x705,0x705,0x705,0x705,
-0x705,0x705,0x705,0x705,0x705,0x705,0x705,0x6d2,0x6ed,0x6cc,0x6f3,0x6f6,0x6f0,0x708,0x708,0x708,
-0x708,0x708,0x708,0x702,0x702,0x702,0x702,0x702,0x702,0x702,0x702,0x702,0x702,0x702,0x702,0x702,
-0x702,0x702,0x702,0x702,0x702,0x702,0x702,0x6d2,0x6ed,0x6cc,0x6ed,0xba6,0x76e,0x76e,0x76e,0x76e,
-0x76e,0x76e,0x76e,0x76e,0x76e,0x76e,0x76e,0x76e,0x76e,0x76e,0x76e,0x76e,0x76e,0x76e,0x76e,0x76e,
-0x76e,0x76e,0x76e,0x76e,0x76e,0x76e,0x76e,0x76e,0x76e,0x76e,0x76e,0x76e,0x76e,0x76e,0x11d9,0x11d9,
-0x11d9,0x11d9,0x11d9,0x771,0x780,0x783,0x783,0x783,0x783,0x783,0x783,0x783,0x783,0x783,0x89d,0x89d,
-0x89d,0x89d,0x789,0x789,0x858,0x867,0x867,0x867,0x867,0x864,0x77d,0x852,0xa7a,0xa7a,0xa7a,0xbb5,
-0xbd3,0xbd0,0xa95,0x828,0x78f,0x78c,0x78f,0x792,0x78c,0x78f,0x78c,0x78f,0x78c,0x78f,0x78c,0x78c,
-0x78c,0x78c,0x78c,0x78c,0x78f,0x78f,0x78c,0x78f,0x78f,0x78c,0x78f,0x78f,0x78c,0x78f,0x78f,0x78c,
-0x78f,0x78f,0x78c,0x78c,0xbd6,0x7a1,0x79b,0x7a1,0x79b,0x7a1,0x79b,0x7a1,0x79b,0x7a1,0x79b,0x79b,
-0x79e,0x79b,0x79e,0x79b,0x79e,0x79b,0x79e,0x79b,0x79e,0x79b,0x79e,0x79b,0x79e,0x79b,0x79e,0x79b,
-0x79e,0x79b,0x79e,0x79b,0x79e,0x79b,0x79e,0x7a1,0x79b,0x79e,0x79b,0x79e,0x79b,0x79e,0x79b,0x79b,
-0x79b,0x79b,0x79b,0x79b,0x79e,0x79e,0x79b,0x79e,0x79e,0x79b,0x79e,0x79e,0x79b,0x79e,0x79e,0x79b,
-0x79e,0x79e,0x79b,0x79b,0x79b,0x79b,0x79b,0x7a1,0x79b,0x7a1,0x79b,0x7a1,0x79b,0x79b,0x79b,0x79b,
-0x79b,0x79b,0x7a1,0x79b,0x79b,0x79b,0x79b,0x79b,0x79e,0x7a1,0x7a1,0x79e,0x79e,0x79e,0x79e,0x870,
-0x873,0x7a4,0x7a7,0xbbe,0x7ad,0x7ad,0x7ad,0x7ad,0x7ad,0x7ad,0x7ad,0x7ad,0x7ad,0x7ad,0x7ad,0x7ad,
-0x7ad,0x7ad,0x7ad,0x7ad,0x7ad,0x7ad,0x7ad,0x7ad,0x7ad,0x7ad,0x7ad,0x7ad,0x7ad,0x7ad,0x7ad,0x7ad,
-0x7ad,0x7ad,0x7ad,0x7ad,0x7b0,0x7ad,0x7ad,0x7ad,0x7ad,0x7ad,0x7ad,0x7ad,0x7ad,0x7ad,0x7ad,0x7ad,
-0x7ad,0x7ad,0x7ad,0x7ad,0x7ad,0x7ad,0x7ad,0x7ad,0x7ad,0x7ad,0x7ad,0x7ad,0x7ad,0x7ad,0x7ad,0x7ad,
-0x7b9,0x7b9,0x7b9,0x7b9,0x7b9,0x7b9,0x7b9,0x7b9,0x7b9,0x7b9,0x7b9,0x7b9,0x7b9,0x7b9,0x7b9,0x7b9,
-0x7b9,0x7b9,0x7b9,0x7b9,0x7b9,0x7b9,0x7b9,0x7b9,0x7b9,0x7b9,0x7b9,0x7b9,0xcb7,0xcb7,0xdda,0x7b3,
-0x87c,0x87c,0x87c,0x87c,0x87c,0x87c,0x87c,0x87c,0x87c,0x87c,0x87c,0x87c,0xcb1,0xcb1,0xcb1,0xcb1,
-0x7bc,0x7bc,0x7bc,0x7bc,0x7bc,0x7bc,0x7bc,0x7bc,0x7bc,0x7bc,0x7bc,0x7bc,0x7bc,0x7bc,0x7bc,0x7bc,
-0x882,0x882,0x882,0x882,0x882,0x882,0x882,0x882,0x882,0x882,0x882,0x882,0x882,0x882,0x882,0x882,
-0x882,0x7bf,0x7bf,0x7bf,0x7bf,0x7bf,0x7bf,0xcba,0xcba,0xcba,0xcba,0x885,0x885,0x885,0x885,0x885,
-0x7bf,0x7bf,0x7bf,0x7bf,0x7bf,0x7bf,0x7bf,0x7bf,0x7bf,0x7bf,0x7bf,0x7bf,0x7bf,0x7bf,0x7bf,0x7bf,
-0x7bf,0x7bf,0x7bf,0x7bf,0x7bf,0x7bf,0x7bf,0x7bf,0x7bf,0x7bf,0x7bf,0x7bf,0x7bf,0x7bf,0x7bf,0x7bf,
-0x7bf,0x7bf,0xcba,0xcba,0x7c2,0x7c2,0x7c2,0x7c2,0x7c2,0x7c2,0x7c2,0x7c2,0x7c2,0x7c2,0x7c2,0x7c2,
-0x7c2,0x7c2,0x7c2,0x7c2,0x7c2,0x7c2,0x7c2,0x7c2,0x7c2,0x7c2,0x7c2,0x7c2,0x7c2,0x7c2,0x7c2,0x7c2,
-0x7c2,0x7c2,0x7c2,0x7c2,0x882,0x882,0x882,0x882,0x882,0x882,0x882,0x882,0x7c5,0x7c5,0x7c5,0x7c5,
-0x7c5,0x7c5,0x7c5,0x7c5,0x7c5,0x7c5,0x7c5,0x7c5,0x7c5,0x7c5,0x7c5,0x7c5,0x7c5,0x7c5,0x7c5,0x7c5,
-0x7c5,0x7c5,0x7c5,0x7c5,0x7c5,0x7c5,0x7c5,0x7c5,0x7c5,0x7c5,0x7c5,0x7c5,0x7c5,0x7c5,0xddd,0xddd,
-0xddd,0xddd,0xddd,0xddd,0xddd,0xddd,0xddd,0xddd,0xddd,0xddd,0xddd,0xddd,0xddd,0xddd,0xddd,0xddd,
-0xddd,0xddd,0xddd,0xddd,0x104d,0x104d,0x104d,0x104d,0x7c8,0x7c8,0x7c8,0x7c8,0x7c8,0x7c8,0x7c8,0x7c8,
-0x7c8,0x7c8,0x7c8,0x7c8,0x7c8,0x7c8,0x7c8,0x7c8,0x7c8,0x7c8,0x7c8,0x7c8,0x7c8,0x7c8,0x7c8,0x7c8,
-0x7c8,0x7c8,0x7c8,0x7c8,0x7c8,0x7c8,0x7c8,0x7c8,0x7c8,0x7c8,0x7cb,0x7cb,0x7c8,0x7cb,0x7c8,0x7cb,
-0x7cb,0x7c8,0x7c8,0x7c8,0x7c8,0x7c8,0x7c8,0x7c8,0x7c8,0x7c8,0x7c8,0x7cb,0x7c8,0x7cb,0x7c8,0x7cb,
-0x7cb,0x7c8,0x7c8,0x7cb,0x7cb,0x7cb,0x7c8,0x7c8,0x7c8,0x7c8,0x13a7,0x13a7,0xbc7,0xbc7,0xbc7,0xbc7,
-0xbc7,0xbc7,0xbc7,0xbc7,0xbc7,0xbc7,0xbc7,0xbc7,0xbc7,0xbc7,0xbc7,0xbc7,0x87c,0x87c,0x87c,0x87c,
-0x87c,0x87c,0x87c,0x87c,0x87c,0x87c,0x87c,0x87c,0x87c,0x87c,0x87c,0x87c,0x87c,0x87c,0x87c,0x87c,
-0x87c,0x87c,0x87c,0x87c,0x87c,0x87c,0x87c,0x87c,0x87c,0x87c,0x87c,0x87c,0x11dc,0x11dc,0x11dc,0x11dc,
-0x11c1,0x11c1,0x11c1,0x11c1,0x11c1,0x11c1,0x11c1,0x11c1,0xcb1,0xbc1,0xbc1,0xbc1,0xbc1,0xbc1,0xbc1,0xbc1,
-0xbc1,0xbc1,0xbc1,0xbc1,0xbc1,0xbc1,0xbc1,0xbc1,0x87f,0x87f,0x87f,0x87f,0x87f,0x87f,0x87f,0x87f,
-0x87f,0x87f,0x87f,0x87f,0x87f,0x87f,0x87f,0x87f,0x87f,0x87f,0x87f,0x87f,0x87f,0x87f,0x87f,0x87f,
-0x87f,0x87f,0x87f,0x87f,0x87f,0x87f,0x87f,0x87f,0x87f,0xbc1,0xbc1,0xbc1,0xbc1,0xbc1,0xbc1,0xbc1,
-0xbc1,0xbc1,0xbc1,0xbc1,0xbc1,0xbc1,0xbc1,0xbc1,0x882,0x882,0x882,0x882,0x882,0x882,0x882,0x882,
-0x882,0x882,0x882,0x882,0x882,0x882,0x882,0x882,0x882,0x882,0x882,0x882,0x882,0x882,0x882,0x882,
-0x882,0x882,0x882,0x882,0x882,0x882,0x882,0xcba,0x8fd,0x8df,0x8df,0x8df,0x8df,0x8d9,0x8df,0x8df,
-0x8f1,0x8df,0x8df,0x8dc,0x8e8,0x8ee,0x8ee,0x8ee,0x8ee,0x8ee,0x8f1,0x8d9,0x8e5,0x8d9,0x8d9,0x8d9,
-0x8d0,0x8d0,0x8d9,0x8d9,0x8d9,0x8d9,0x8d9,0x8d9,0x8f4,0x8f4,0x8f4,0x8f4,0x8f4,0x8f4,0x8f4,0x8f4,
-0x8f4,0x8f4,0x8d9,0x8d9,0x8d9,0x8d9,0x8d9,0x8d9,0x8d9,0x8d9,0x8d9,0x8d9,0x8dc,0x8d0,0x8d9,0x8d0,
-0x8d9,0x8d0,0x8eb,0x8e2,0x8eb,0x8e2,0x8fa,0x8fa,0x909,0x909,0x909,0x909,0x909,0x909,0x909,0x909,
-0x909,0x909,0x909,0x909,0x909,0x909,0x909,0x909,0x909,0x909,0x909,0x909,0x909,0x909,0x909,0x909,
-0x909,0x909,0x909,0x909,0x909,0x909,0x909,0x909,0x90c,0x90c,0x90c,0x90c,0x90c,0x90c,0x90c,0x90c,
-0x90c,0x90c,0x90c,0x90c,0x90c,0x90c,0x90c,0x90c,0x90c,0x90c,0x90c,0x90c,0x90c,0x90c,0x90c,0x90c,
-0x90c,0x90c,0x90c,0x90c,0x90c,0x90c,0x90c,0x90c,0x90f,0x90f,0x90f,0x90f,0x90f,0x90f,0x90f,0x90f,
-0x90f,0x90f,0x90f,0x90f,0x90f,0x90f,0x90f,0x90f,0x90f,0x90f,0x90f,0x90f,0x90f,0x90f,0x90f,0x90f,
-0x90f,0x90f,0x90f,0x90f,0x90f,0x90f,0x90f,0x90f,0x918,0x918,0x918,0x918,0x918,0x918,0x918,0x918,
-0x918,0x918,0x918,0x918,0x918,0x918,0x918,0x918,0x918,0x918,0x918,0x918,0x918,0x918,0x918,0x918,
-0x918,0x918,0x918,0x918,0x918,0x918,0x912,0x912,0x91b,0x91b,0x91b,0x91b,0x91b,0x91b,0x91b,0x91b,
-0x91b,0x91b,0x91b,0x91b,0x91b,0x91b,0x91b,0x91b,0x91b,0x91b,0x91b,0x91b,0x91b,0x91b,0x91b,0x91b,
-0x91b,0x91b,0x91b,0x91b,0x91b,0x91b,0x915,0x915,0x918,0x918,0x918,0x918,0x918,0x918,0x918,0x918,
-0x918,0x918,0x918,0x918,0x918,0x918,0x918,0x918,0x918,0x918,0x918,0x918,0x918,0x918,0x918,0x918,
-0x918,0x918,0x918,0x918,0x918,0x918,0x918,0x918,0x91b,0x91b,0x91b,0x91b,0x91b,0x91b,0x91b,0x91b,
-0x91b,0x91b,0x91b,0x91b,0x91b,0x91b,0x91b,0x91b,0x91b,0x91b,0x91b,0x91b,0x91b,0x91b,0x91b,0x91b,
-0x91b,0x91b,0x91b,0x91b,0x91b,0x91b,0x91b,0x91b,0x91e,0x921,0x921,0x921,0x921,0x921,0x921,0x921,
-0x921,0x921,0x921,0x921,0x921,0x921,0x921,0x921,0x921,0x921,0x921,0x921,0x921,0x921,0x921,0x921,
-0x921,0x921,0x921,0x921,0x91e,0x921,0x921,0x921,0x921,0x921,0x921,0x921,0x921,0x921,0x921,0x921,
-0x921,0x921,0x921,0x921,0x921,0x921,0x921,0x921,0x921,0x921,0x921,0x921,0x921,0x921,0x921,0x921,
-0x9ae,0x9ae,0xf0f,0x9ae,0x9ae,0x9ae,0x9b1,0x9ae,0xf0f,0x9ae,0x9ae,0xf06,0x9a8,0x99c,0x99c,0x99c,
-0x99c,0x9ab,0x99c,0xef4,0xef4,0xef4,0x99c,0x99f,0x9a8,0x9a2,0xefa,0xf09,0xf09,0xef4,0xef4,0xf0f,
-0xa9b,0xa9b,0xa9b,0xa9b,0xa9b,0xa9b,0xa9b,0xa9b,0xa9b,0xa9b,0x9b4,0x9b4,0x9a5,0x9a5,0x9a5,0x9a5,
-0x9ae,0x9ae,0x9ae,0x9ae,0x9ae,0x9ae,0x9ab,0x9ab,0x99c,0x99c,0xf0f,0xf0f,0xf0f,0xf0f,0xef4,0xef4,
-0x9ae,0x9ae,0x9ae,0x9ae,0x9ae,0x9ae,0x9ae,0x9ae,0x9ae,0x9ae,0x9ae,0x9ae,0x9ae,0x9ae,0x9ae,0x9ae,
-0x9ae,0x9ae,0x9ae,0x9ae,0x9ae,0x9ae,0x9ae,0x9ae,0x9ae,0x9ae,0x9ae,0x9ae,0x9ae,0x9ae,0x9ae,0x9ae,
-0x9c3,0x9c3,0x9c3,0x9c3,0x9c3,0x9c3,0x9c3,0xd08,0x9c3,0x9c3,0x9c3,0x9c3,0x9c3,0x9c3,0x9c3,0x9c3,
-0x9c3,0x9c3,0x9c3,0x9c3,0x9c3,0x9c3,0x9c3,0x9c3,0x9c3,0x9c3,0x9c3,0x9c3,0x9c3,0x9c3,0x9c3,0x9c3,
-0x9c3,0x9c3,0x9c3,0x9c3,0x9c3,0x9c3,0x9c3,0x9c3,0x9c3,0x9c3,0x9c3,0xd08,0x9c3,0x9c3,0x9c3,0x9c3,
-0x9c3,0x9c3,0x9c3,0x9c3,0x9c3,0x9c3,0x9c3,0x9c3,0x9c3,0x9c3,0x9c3,0x9c3,0x9c9,0x9c9,0x9c9,0x9c9,
-0x9c9,0x9c9,0x9c9,0x9c9,0x9c9,0x9c9,0x9c9,0x9c9,0x9c9,0x9c9,0x9c9,0x9c9,0x9c9,0x9c9,0x9c9,0x9c9,
-0x9c9,0x9c9,0x9c9,0x9c9,0x9c9,0x9c9,0x9c9,0x9c9,0x9c9,0x9c9,0x9c9,0x9c9,0x9cf,0x9cf,0x9cf,0x9cf,
-0x9cf,0x9cf,0x9cf,0x9cf,0x9cf,0x9cf,0x9cf,0x9cf,0x9cf,0x9cc,0x9d2,0x9cf,0x9cf,0x9cf,0x9cf,0x9cf,
-0x9cf,0x9cf,0x9cf,0x1080,0x1080,0x1080,0x1080,0x1080,0x1080,0x1080,0x1080,0x1080,0x107d,0x9cf,0x9cf,0x9cf,
-0x9cf,0x9cf,0x9cf,0x9cf,0x9cf,0x9cf,0x9cf,0x9cf,0x9cf,0x9cf,0x9cf,0x9cf,0x9cf,0x9cf,0x9cf,0x9cf,
-0x9cf,0x9cf,0x9cf,0x9cf,0x9cf,0x9cf,0x9cf,0x9cf,0x9cf,0x9cf,0x9cf,0x9cf,0x9cf,0x9cf,0x9cf,0x9cf,
-0x9e4,0x9e4,0x9e4,0x9e4,0x9e4,0x9e4,0x9e4,0x9e4,0x9e4,0x9e4,0x9e4,0x9e4,0x9e4,0x9e4,0x9e4,0x9e4,
-0x9e4,0x9e4,0x9e4,0x9e4,0x9e4,0x9e4,0x9e4,0x9e4,0x9e4,0x9e4,0x9e4,0x9e4,0x9e4,0x9e4,0x9e4,0x9e4,
-0xa08,0xa08,0xa08,0xa0b,0xa0b,0xa08,0xa08,0xa08,0xa08,0xa08,0xa08,0xa08,0xa08,0xa08,0xa08,0xa08,
-0xa08,0xa08,0xa08,0xa08,0x9f0,0x9f0,0xa05,0x9e7,0x9e7,0x9e7,0x9e7,0x9e7,0x9e7,0x9e7,0xa05,0xa05,
-0xa08,0xa08,0xa08,0xa08,0xa08,0xa08,0xa08,0xa08,0xa08,0xa08,0xa08,0xa08,0xa08,0xa08,0xa08,0xa08,
-0xa08,0xa08,0xa08,0xa08,0xa08,0xa08,0xa08,0xa08,0xa08,0xa08,0xa08,0xa08,0xa08,0xa08,0xa08,0xa08,
-0xa26,0xa26,0xa26,0xa26,0xa26,0xa26,0xa26,0xa26,0xa26,0xa26,0xa26,0xa26,0xa26,0xa26,0xa26,0xa26,
-0xa26,0xa26,0xa26,0xa26,0xa26,0xa26,0xa26,0xa26,0xa26,0xa26,0xa26,0xa26,0xa26,0xa26,0xa26,0xa26,
-0xa26,0xa26,0xa26,0xa29,0xa26,0xa26,0xa26,0xa26,0xa26,0xa26,0xa26,0xa26,0xa26,0xa26,0xa26,0xa26,
-0xa26,0xa26,0xa26,0xa26,0xa26,0xa26,0xa26,0xa26,0xa26,0xa26,0xa26,0xa26,0xa26,0xa26,0xa26,0xa26,
-0xa4d,0xa4d,0xa4d,0xa4d,0xa4d,0xa4d,0xa4d,0xa4d,0xa4d,0xa4d,0xa4d,0xa4d,0xa4d,0xa4d,0xa4d,0xa4d,
-0xa4d,0xa4d,0xa4d,0xa4d,0xa4d,0xa4d,0xa4d,0xa4d,0xa4d,0xa4d,0xa4d,0xb40,0xb40,0xb40,0xb40,0xb40,
+0x55b,0x55b,0x55b,0x55b,0x55b,0x1248,0x55b,0x55b,0x55b,0x55b,0x55b,0x55b,0x55b,0x55b,0x55b,0x55b,
+0x55b,0x55b,0x55b,0x55b,0x55b,0x55b,0x55b,0x55b,0x55b,0x55b,0x6ab,0x55b,0x55b,0x55b,0x55b,0x55b,
+0x55b,0x55b,0x55b,0x55b,0x55b,0x55b,0x55b,0x1248,0x55b,0x1248,0x55b,0x55b,0x55b,0x55b,0x1248,0x1248,
+0x1248,0x55b,0x11be,0x55b,0x55b,0x55b,0x564,0x564,0x564,0x564,0x124e,0x124e,0x55b,0x55e,0x55e,0x55b,
+0x55b,0x55b,0x55b,0xb52,0xb4f,0xb52,0xb4f,0xb52,0xb4f,0xb52,0xb4f,0xb52,0xb4f,0xb52,0xb4f,0xb52,
+0xb4f,0x6a8,0x6a8,0x6a8,0x6a8,0x6a8,0x6a8,0x6a8,0x6a8,0x6a8,0x6a8,0x558,0x558,0x558,0x558,0x558,
+0x558,0x558,0x558,0x558,0x558,0x558,0x558,0x558,0x558,0x558,0x558,0x558,0x558,0x558,0x558,0x55b,
+0x1248,0x1248,0x1248,0x55b,0x55b,0x55b,0x55b,0x55b,0x55b,0x55b,0x55b,0x55b,0x55b,0x55b,0x55b,0x55b,
+0x55b,0x55b,0x55b,0x55b,0x55b,0x55b,0x55b,0x55b,0x55b,0x55b,0x55b,0x1248,0x55b,0x55b,0x55b,0x55b,
+0x55b,0x55b,0x55b,0x55b,0x55b,0x55b,0x55b,0x55b,0x55b,0x55b,0x1248,0xd2c,0xd2c,0xd2c,0xd2c,0xd2c,
+0xd32,0xd2f,0xe43,0xe43,0xe43,0xe43,0x12f0,0xf36,0x12f0,0x125a,0x125a,0xb7f,0xb7f,0xb7f,0xb7f,0xb7f,
+0xb7f,0xb7f,0xb7f,0xb7f,0xb7f,0xb7f,0xb7f,0xb7f,0xb7f,0xb7f,0xb7f,0xb7f,0xb7f,0xb7f,0xb7f,0xb7f,
+0xb7f,0xbac,0xba9,0xbac,0xba9,0xbac,0xba9,0x1047,0x1044,0xf3c,0xf39,0xb82,0xb82,0xb82,0xb82,0xb82,
+0xb82,0xb82,0xb82,0xb82,0xb82,0xb82,0xb82,0xb82,0xb82,0xb82,0xb82,0xa59,0xa59,0xa59,0xa59,0xa59,
 0xa59,0xa59,0xa59,0xa59,0xa59,0xa59,0xa59,0xa59,0xa59,0xa59,0xa59,0xa59,0xa59,0xa59,0xa59,0xa59,
 0xa59,0xa59,0xa59,0xa59,0xa59,0xa59,0xa59,0xa59,0xa59,0xa59,0xa59,0xa59,0xa59,0xa59,0xa59,0xa59,
-0xa6b,0xa6b,0xa6b,0xa6b,0xa6b,0xa6b,0xa6b,0xa6b,0xa6b,0xa6b,0xa6b,0xa6b,0xa6b,0xa6b,0xa6b,0xa6b,
-0xa6b,0xa6b,0xa6b,0xa6b,0xa6b,0xa6b,0xa6b,0xa6b,0xa6b,0xa6b,0xa6b,0xa6b,0xa6b,0xa6b,0xa6b,0xa6b,
-0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,
-0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,
-0xa80,0xa80,0xa80,0xa80,0xa80,0xa80,0xa80,0xa80,0xa80,0xa80,0xa80,0xa80,0xa80,0xa80,0xa80,0xa80,
-0xa80,0xa80,0xa80,0xa80,0xa80,0xa80,0xa80,0xa80,0xa80,0xa80,0xa80,0xa80,0xa80,0xa80,0xa80,0xa80,
-0xa83,0xa83,0xa83,0xa83,0xa83,0xa83,0xa83,0xa83,0xa83,0xa83,0xa83,0xa83,0xa83,0xa83,0xa83,0xa83,
-0xa83,0xa83,0xa83,0xa83,0xa83,0xa86,0xa83,0xa83,0xa83,0xa83,0xa83,0xa83,0xa83,0xa83,0xa83,0xa83,
-0xa83,0xa83,0xa83,0xa83,0xa83,0xa83,0xa83,0xa83,0xa83,0xa83,0xa83,0xa83,0xa83,0xa83,0xa83,0xa83,
-0xa83,0xa83,0xa83,0xa83,0xa83,0xa83,0xa83,0xa83,0xa89,0xa89,0xbc4,0xbc4,0xa89,0xa89,0xa89,0xa89,
-0xa89,0xa89,0xa89,0xa89,0xa89,0xa89,0xa89,0xa89,0xa89,0xa89,0xa89,0xa89,0xbc4,0xa89,0xa89,0xa89,
-0xa89,0xa89,0xa89,0xa89,0xa89,0xa89,0xa89,0xa89,0xaaa,0xaaa,0xaaa,0xaaa,0xaaa,0xaaa,0xaaa,0xaaa,
-0xaaa,0xaaa,0xaaa,0xaaa,0xaaa,0xaaa,0xaaa,0xaaa,0xaaa,0xaaa,0xaaa,0xaaa,0xaaa,0xaaa,0xaaa,0xaaa,
-0xaaa,0xaaa,0xaaa,0xaaa,0xaaa,0xaaa,0xaaa,0x13ef,0xab3,0xab3,0xab3,0xab3,0xab3,0xab3,0xc48,0xc48,
-0xab0,0xab0,0xab0,0xab0,0xab0,0xab0,0xab0,0xab0,0xab0,0xab0,0xab0,0xab0,0xab0,0xab0,0xab0,0xab0,
-0xab0,0xab0,0xab0,0xab0,0xab0,0xab0,0xab0,0xab0,0xab0,0xab0,0xc45,0xc45,0xc93,0xc93,0xc93,0xc93,
-0xc93,0xc93,0xc93,0xc93,0xc93,0xc93,0xc93,0xc93,0xc93,0xc93,0xc93,0xc93,0xab3,0xab3,0xab3,0xab3,
-0xab3,0xab3,0xab3,0xab3,0xab3,0xab3,0xab3,0xab3,0xab3,0xab3,0xab3,0xab3,0xab3,0xab3,0xab3,0xab3,
-0xab3,0xab3,0xab3,0xab3,0xab3,0xab3,0xab3,0xab3,0xab3,0xab3,0xab3,0xab3,0xab6,0xab6,0xab6,0xab6,
-0xab6,0xab6,0xab6,0xab6,0xab6,0xab6,0xab6,0xab6,0xab6,0xab6,0xab6,0xab6,0xab6,0xab6,0xab6,0xab6,
-0xab6,0xab6,0xab6,0xab6,0xab6,0xab6,0xab6,0xab6,0xab6,0xab6,0xab6,0xab6,0xac5,0xac5,0xac5,0xac5,
-0xac5,0xabc,0xac8,0xace,0xace,0xace,0xac2,0xac2,0xac2,0xacb,0xabf,0xabf,0xabf,0xabf,0xabf,0xab9,
-0xab9,0xab9,0xab9,0xab9,0xab9,0xab9,0xab9,0xace,0xace,0xace,0xace,0xace,0xac2,0xac2,0xac2,0xac2,
-0xac2,0xac2,0xac2,0xac2,0xac2,0xac2,0xac2,0xac2,0xac2,0xac2,0xac2,0xac2,0xac2,0xac2,0xac2,0xac2,
-0xac2,0xac2,0xac2,0xac2,0xac2,0xac2,0xac2,0xac2,0xac2,0xac2,0xac2,0xac2,0xac2,0xac2,0xac5,0xac5,
-0xace,0xace,0xace,0xac2,0xac2,0xace,0xace,0xace,0xace,0xace,0xace,0xace,0xac2,0xac2,0xac2,0xac2,
-0xac2,0xac2,0xac2,0xac2,0xac2,0xac2,0xac2,0xac2,0xac2,0xac2,0xac2,0xac2,0xac2,0xac2,0xac2,0xac2,
-0xac2,0xac2,0xace,0xace,0xace,0xace,0xac2,0xac2,0xac2,0xac2,0xac2,0xac2,0xac2,0xac2,0xac2,0xac2,
-0xac2,0xac2,0xac2,0xac5,0xac5,0xac5,0xac5,0xac5,0xac5,0xac2,0xac2,0xac2,0xac2,0xac2,0xac2,0xac2,
-0xac2,0xac2,0xac2,0xac2,0xac2,0xac2,0xac2,0xac2,0xac2,0xac2,0xac2,0xac2,0xac2,0xac2,0xac2,0xac2,
-0xac2,0xac2,0xac2,0xac2,0xac2,0xac2,0x15d8,0x15d8,0xada,0xad1,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,
-0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,
-0xad7,0xad7,0xad7,0xad1,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xada,0xada,0xada,0xada,0xada,0xada,
-0xada,0xada,0xada,0xada,0xada,0xada,0xada,0xada,0xada,0xada,0xada,0xada,0xada,0xada,0xada,0xada,
-0xada,0xada,0xada,0xad1,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,
-0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad1,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,
-0xada,0xada,0xada,0xada,0xada,0xada,0xada,0xada,0xada,0xada,0xada,0xada,0xada,0xada,0xada,0xada,
-0xada,0xada,0xada,0xada,0xada,0xad1,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,
-0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad4,0xad4,0xad4,0xad4,
-0xad4,0xad4,0xad4,0xad4,0xad4,0xad4,0xad4,0xad4,0xad4,0xad4,0xad4,0xad4,0xad4,0xad4,0xad4,0xad4,
-0xad4,0xad4,0xad4,0xad4,0xad4,0xad4,0xad4,0xad4,0xad4,0xad4,0xad4,0xad4,0xada,0xada,0xada,0xada,
-0xada,0xada,0xada,0xada,0xada,0xada,0xada,0xada,0xada,0xada,0xada,0xada,0xada,0xada,0xada,0xada,
-0xada,0xada,0xada,0xada,0xada,0xada,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,
-0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xada,0xada,0xada,0xada,
-0xada,0xada,0xada,0xada,0xada,0xada,0xada,0xada,0xada,0xada,0xada,0xada,0xada,0xada,0xada,0xada,
-0xada,0xada,0xada,0xada,0xada,0xada,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,
-0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,
-0xada,0xada,0xada,0xada,0xadd,0xadd,0xadd,0xadd,0xadd,0xadd,0xadd,0xadd,0xadd,0xadd,0xadd,0xadd,
-0xadd,0xadd,0xadd,0xadd,0xadd,0xadd,0xadd,0xadd,0xadd,0xadd,0xadd,0xadd,0xadd,0xadd,0xadd,0xadd,
-0xadd,0xadd,0xadd,0xadd,0xadd,0xadd,0xadd,0xae0,0xae3,0xae3,0xae3,0xae3,0xae3,0xae3,0xae3,0xae3,
-0xae3,0xae3,0xae3,0xae3,0xae3,0xae3,0xae3,0xae3,0xae3,0xae3,0xae3,0xae3,0xae3,0xae3,0xae3,0xae3,
-0xae3,0xae3,0xae3,0xae3,0xae3,0xae3,0xae3,0xae3,0xae6,0xae6,0xae6,0xae6,0xae6,0xae6,0xae6,0xae6,
-0xae6,0xae6,0xae6,0xae6,0xae6,0xae6,0xae6,0xae6,0xae6,0xae6,0xae6,0xae6,0xae6,0xae6,0xae6,0xae6,
-0xae6,0xae6,0xae6,0xae6,0xae6,0xae6,0xae6,0xae6,0xb40,0xb40,0xb40,0xb40,0xb40,0xb40,0xb40,0xb40,
-0xb40,0xb40,0xb40,0xb40,0xb40,0xb40,0xb40,0xb40,0xb40,0xb40,0xb40,0xb40,0xb40,0xb40,0xb3d,0xb40,
-0xb3d,0xb3d,0xb3d,0xb3d,0xb3d,0xb3d,0xb3d,0xb3d,0xb3d,0xb3d,0xb3d,0xb3d,0xb3d,0xb3d,0xb3d,0xc3c,
-0xc3f,0xd20,0xd20,0xd20,0xd20,0xd20,0xd20,0xd20,0xd20,0xd20,0xd20,0xd20,0xe31,0xe31,0xe31,0xe31,
-0xb4c,0xb4c,0xb4c,0xb4c,0xb4c,0xb4c,0xb4c,0xb4c,0xb4c,0xb4c,0xc42,0xc42,0xc42,0xc42,0xc42,0xc42,
-0xc42,0xc42,0xd23,0xd23,0xd23,0xd23,0xd23,0xd23,0xd23,0xd23,0xd23,0xd23,0xd23,0xf24,0x11b8,0x11b8,
-0xd2c,0xd2c,0xd2c,0xd2c,0xd2c,0xd32,0xd2f,0xe43,0xe43,0xe43,0xe43,0x12f0,0xf36,0x12f0,0x125a,0x125a,
-0xb7f,0xb7f,0xb7f,0xb7f,0xb7f,0xb7f,0xb7f,0xb7f,0xb7f,0xb7f,0xb7f,0xb7f,0xb7f,0xb7f,0xb7f,0xb7f,
-0xb7f,0xb7f,0xbac,0xba9,0xbac,0xba9,0xbac,0xba9,0x1047,0x1044,0xf3c,0xf39,0xb82,0xb82,0xb82,0xb82,
-0xb82,0xb82,0xb82,0xb82,0xb82,0xb82,0xb82,0xb82,0xb82,0xb82,0xb82,0xb82,0xb85,0xb85,0xb85,0xb85,
+0xa59,0xa59,0xa59,0xa59,0xa59,0xa59,0xa59,0xa59,0xa59,0xa59,0xa59,0xa59,0xa59,0xa59,0xa59,0xa59,
+0xa59,0xa59,0xa59,0xa59,0xa59,0xa59,0xa59,0xa59,0xa59,0xa59,0xa59,0xb85,0xb85,0xb85,0xb85,0xb85,
 0xb85,0xb85,0xb85,0xb85,0xb85,0xb85,0xb85,0xb85,0xb85,0xb85,0xb85,0xb85,0xb85,0xb85,0xb85,0xb85,
-0xb85,0xb85,0xb85,0xb85,0xb85,0xb85,0xb85,0xb85,0xb85,0xb85,0xb85,0xb85,0xb88,0xb88,0xb88,0xb8e,
-0xb8b,0xbb2,0xbaf,0xb8e,0xb8b,0xb8e,0xb8b,0xb8e,0xb8b,0xb8e,0xb8b,0xb8e,0xb8b,0xb8e,0xb8b,0xb8e,
-0xb8b,0xb8e,0xb8b,0xb8e,0xb8b,0xb88,0xb88,0xb88,0xb88,0xb88,0xb88,0xb88,0xb88,0xb88,0xb88,0xb88,
+0xb85,0xb85,0xb85,0xb85,0xb85,0xb85,0xb85,0xb85,0xb85,0xb85,0xb85,0xb85,0xb85,0xb85,0xb85,0xb85,
+0xb85,0xb85,0xb85,0xb85,0xb85,0xb85,0xb85,0xb85,0xb85,0xb85,0xb85,0xb85,0xb85,0xb85,0xb85,0xb85,
+0xb85,0xb85,0xb85,0xb85,0xb85,0xb85,0xb85,0xb85,0xb85,0xb85,0xb85,0xb88,0xb88,0xb88,0xb8e,0xb8b,
+0xbb2,0xbaf,0xb8e,0xb8b,0xb8e,0xb8b,0xb8e,0xb8b,0xb8e,0xb8b,0xb8e,0xb8b,0xb8e,0xb8b,0xb8e,0xb8b,
+0xb8e,0xb8b,0xb8e,0xb8b,0xb88,0xb88,0xb88,0xb88,0xb88,0xb88,0xb88,0xb88,0xb88,0xb88,0xb88,0xb88,
 0xb88,0xb88,0xb88,0xb88,0xb88,0xb88,0xb88,0xb88,0xb88,0xb88,0xb88,0xb88,0xb88,0xb88,0xb88,0xb88,
-0xb88,0xb88,0xb88,0xb88,0xb88,0xb88,0xb88,0xb88,0xb8e,0xb8b,0xb8e,0xb8b,0xb88,0xb88,0xb88,0xb88,
+0xb88,0xb88,0xb88,0xb88,0xb88,0xb88,0xb88,0xb88,0xb88,0xb88,0xb88,0xb8e,0xb8b,0xb8e,0xb8b,0xb88,
 0xb88,0xb88,0xb88,0xb88,0xb88,0xb88,0xb88,0xb88,0xb88,0xb88,0xb88,0xb88,0xb88,0xb88,0xb88,0xb88,
-0xb88,0xb88,0xb88,0xb88,0xb88,0xb88,0xb88,0xb88,0xb8e,0xb8b,0xb88,0xb88,0xb91,0xb91,0xb91,0xb91,
-0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb97,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,
+0xb88,0xb88,0xb88,0xb88,0xb88,0xb88,0xb88,0xb88,0xb88,0xb88,0xb88,0xb88,0xb88,0xb88,0xb88,0xb8e,
+0xb8b,0xb88,0xb88,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb97,
 0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,
-0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb97,0xb97,0xb97,0xb91,
 0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,
-0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb94,0xb91,0xb91,0xb91,
-0xbc7,0xbc7,0xbc7,0xbc7,0xbc7,0xbc7,0xbc7,0xbc7,0xbc7,0xbc7,0xbc7,0xbc7,0xbc7,0xbc7,0xbc7,0xbc7,
-0xbc7,0xbc7,0xbc7,0xbc7,0xbc7,0xbc7,0xbc7,0xbc7,0xbc7,0xbc7,0xbc7,0xbc7,0xbc7,0xbc7,0xbc7,0xbc7,
-0xc42,0xc42,0xd23,0xd23,0xd23,0xd23,0xd23,0xd23,0xd23,0xd23,0xd23,0xd23,0xd23,0xd23,0xd23,0xd23,
-0xd23,0xd23,0xe34,0xf24,0xf24,0xf24,0xf24,0xf24,0xf24,0xf24,0xf24,0xf24,0xf24,0x108f,0x11bb,0x11bb,
-0xc66,0xc66,0xc66,0xc66,0xc66,0xc66,0xc66,0xc66,0xc66,0xc66,0xc66,0xc66,0xc66,0xc66,0xc66,0xc66,
-0xc66,0xc66,0xc66,0xc66,0xc66,0xc66,0xc66,0xc66,0xc66,0xc66,0xc66,0xc66,0xc66,0xc66,0xc66,0xc66,
-0xc75,0xc75,0xc75,0xc75,0xc75,0xc75,0xc6c,0xc6c,0xc6c,0xc6c,0xc6c,0xc69,0xc7e,0xc7e,0xc7e,0xc78,
-0xc7e,0xc7e,0xc7e,0xc7e,0xc7e,0xc7e,0xc7e,0xc7e,0xc7e,0xc7e,0xc7e,0xc78,0xc7e,0xc7e,0xc7e,0xc7e,
-0xc72,0xc72,0xc7b,0xc7b,0xc7b,0xc7b,0xc6f,0xc6f,0xc6f,0xc6f,0xc6f,0xc75,0xd38,0xd38,0xd38,0xd38,
-0xd38,0xd38,0xd38,0xd38,0xd38,0xd38,0xd38,0xd38,0xd35,0xd38,0xd38,0xd38,0xd38,0xd38,0xd38,0xd38,
-0xc7e,0xc7e,0xc7e,0xc7e,0xc7e,0xc7e,0xc7e,0xc7e,0xc7e,0xc7e,0xc7e,0xc7e,0xc7e,0xc7e,0xc78,0xc7e,
-0xc7e,0xc7e,0xc7e,0xc7e,0xc7e,0xc7e,0xc7e,0xc7e,0xc7e,0xc7e,0xc7e,0xc7e,0xc7e,0xc72,0xc72,0xc72,
-0xc75,0xc75,0xc75,0xc75,0xc75,0xc75,0xc75,0xc75,0xc75,0xc75,0xc75,0xc75,0xc75,0xc75,0xc75,0xc75,
-0xc75,0xc75,0xc75,0xc75,0xc75,0xc75,0xc75,0xc75,0xc75,0xc75,0xc75,0xc75,0xc75,0xc75,0xc75,0xc75,
-0xc81,0xc81,0xc81,0xc81,0xc81,0xc81,0xc81,0xc81,0xc81,0xc81,0xc81,0xc81,0xc81,0xc81,0xd3b,0xd3b,
-0xd3b,0xd3b,0xd3b,0xd3b,0xe46,0xe46,0xe46,0xe46,0xe46,0xe46,0xe46,0xf3f,0xf3f,0xf3f,0xf3f,0xf3f,
-0xc84,0xc84,0xc84,0xc84,0xc84,0xc84,0xc84,0xc84,0xc84,0xc84,0xc84,0xc84,0xc84,0xc84,0xc84,0xc84,
-0xc84,0xc84,0xc84,0xc84,0xc84,0xc84,0xc84,0xc84,0xc84,0xc84,0xc84,0xc84,0xc84,0xc84,0xc84,0xc84,
-0xc8a,0xc8a,0xc8a,0xc8a,0xc8a,0xc8a,0xc8a,0xc8a,0xc8a,0xc8a,0xc8a,0xc8a,0xc8a,0xc8a,0xc8a,0xc8a,
-0xc8a,0xc8a,0xc8a,0xc8a,0xc8a,0xc8a,0xc8a,0xc8a,0xc8a,0xc8a,0xc8a,0xc8a,0xc8a,0xc8a,0xc8a,0xc8a,
-0xc93,0xc93,0xc93,0xc93,0xc93,0xc93,0xc93,0xc93,0xc93,0xc93,0xc93,0xc93,0xc93,0xc93,0xc93,0xc93,
-0xc93,0xc93,0xc93,0xc93,0xc93,0xc93,0xc93,0xc93,0xc93,0xc93,0xc93,0xc93,0xc93,0xc93,0xc93,0xc93,
-0xc9f,0xc9f,0xc9f,0xc9f,0xc9f,0xc9f,0xc9f,0xc9f,0xc9f,0xc9f,0xc9f,0xc9f,0xc9f,0xc9f,0xc9f,0xc9f,
-0xc9f,0xc9f,0xc9f,0xc9f,0xc9f,0xc9f,0xc9f,0xc9f,0xc9f,0xc9f,0xc9f,0xc9f,0xc9f,0xc9f,0xc9f,0xc9f,
-0xcae,0xcae,0xcae,0xcae,0xcae,0xcae,0xcae,0xcae,0xcae,0xcae,0xcae,0xcae,0xcae,0xcae,0xcae,0xcae,
-0xcae,0xcae,0xcae,0xcae,0xcae,0xcae,0xcae,0xcae,0xcae,0xcae,0xcae,0xcae,0xcae,0xcae,0xcae,0xcae,
-0xd41,0xd41,0xd41,0xd41,0xd41,0xd41,0xd41,0xd41,0xd41,0xd41,0xd41,0xd41,0xd41,0xd41,0xd41,0xd41,
-0xd41,0xd41,0xd41,0xd41,0xd41,0xd41,0xd41,0xd41,0xd41,0xd41,0xd41,0xd41,0xd41,0xd41,0xd41,0xd41,
-0xd47,0xd47,0xd47,0xd47,0xd47,0xd47,0xd47,0xd47,0xd47,0xd47,0xd47,0xd47,0xd47,0xd47,0xd47,0xd47,
-0xd47,0xd47,0xd47,0xd47,0xd47,0xd44,0xd44,0xd44,0xd44,0xd44,0xd44,0xd44,0xd44,0xd44,0xd44,0xd44,
-0xd47,0xd47,0xd47,0xd47,0xd47,0xd47,0xd47,0xd47,0xd47,0xd47,0xd47,0xd47,0xd47,0xd47,0xd47,0xd47,
-0xd47,0xd47,0xd47,0xd47,0xd47,0xd47,0xd47,0xd47,0xd47,0xd47,0xd47,0xd47,0xd47,0xd47,0xd47,0xd47,
-0xe01,0xe01,0xd59,0xd59,0xe49,0xe49,0xe49,0xe49,0xe49,0xe49,0xe49,0xf4b,0xf4b,0xf4b,0xf4b,0xf4b,
-0xf48,0xf48,0xf48,0xf48,0xf48,0xf48,0xf48,0xf48,0xf48,0xf48,0xf48,0xf48,0xf48,0xf48,0xf48,0xf48,
-0xd68,0xd65,0xd68,0xd65,0xd68,0xd65,0xd68,0xd65,0xd68,0xd65,0xd68,0xd65,0xd68,0xd65,0xd68,0xd65,
-0xd68,0xd65,0xd68,0xd65,0xd68,0xd65,0xd68,0xd65,0xd68,0xd65,0xd68,0xd65,0xd68,0xd65,0xd68,0xd65,
-0xd74,0xd74,0xd74,0xd74,0xd74,0xd74,0xd74,0xd74,0xd74,0xd74,0xd74,0xd74,0xd74,0xd74,0xd74,0xd74,
-0xd74,0xd74,0xd74,0xd74,0xd74,0xd74,0xd74,0xd74,0xd74,0xd74,0xd74,0xd74,0xd74,0xd74,0xd74,0xd74,
+0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,
+0xb91,0xb91,0xb91,0xb91,0xb97,0xb97,0xb97,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,
+0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,
+0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,
+0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,
+0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb94,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,
+0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,
+0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xc81,0xc81,0xc81,0xc81,0xc81,
+0xc81,0xc81,0xc81,0xc81,0xc81,0xc81,0xc81,0xc81,0xc81,0xd3b,0xd3b,0xd3b,0xd3b,0xd3b,0xd3b,0xe46,
+0xe46,0xe46,0xe46,0xe46,0xe46,0xe46,0xf3f,0xf3f,0xf3f,0xf3f,0xf3f,0xe46,0xe46,0xe46,0xe46,0xf3f,
+0xf3f,0xf3f,0xf3f,0xf3f,0xf3f,0xf3f,0xf3f,0xf3f,0xf3f,0xf3f,0xf3f,0xf42,0xf42,0xf42,0xf42,0xf42,
+0xf42,0xf42,0xf42,0xf42,0xf42,0xf42,0xf42,0xf42,0xf42,0xf42,0xf42,0xf3f,0xf3f,0xf42,0xf42,0xf42,
+0xf42,0xf42,0xf42,0x13fb,0x13fb,0x13fb,0xf3f,0xf3f,0xf3f,0xf3f,0xf3f,0x11c4,0x11c4,0x11c4,0x11c4,0x11c4,
+0x13fb,0x13fb,0x13fb,0x13fb,0x13fb,0x13fb,0x13fb,0x13fb,0x13fb,0x13fb,0x13fb,0x13fb,0x13fb,0x13fb,0x13fb,0x13fb,
+0x13fb,0x13fb,0x13fb,0x13fb,0x13fb,0x13fb,0x13fb,0x13fb,0x13fb,0x13fb,0xc3,0xc3,0x13fb,0x13fb,0x13fb,0x13fb,
+0x13fb,0x13fb,0x13fb,0x13fb,0x13fb,0x13fb,0x13fb,0x13fb,0x13fb,0x13fb,0x13fb,0x13fb,0x13fb,0x13fb,0x13fb,0x13fb,
+0x13fb,0x13fb,0x13fb,0x13fb,0x13fb,0x13fb,0x13fb,0x13fb,0x13fb,0x13fb,0x13fb,0x13fb,0x13fb,0x13fb,0xc3,0xc3,
+0xc3,0x13fb,0x13fb,0x13fb,0x13fb,0x13fb,0x13fb,0x13fb,0x13fb,0x13fb,0xc3,0x13fb,0x13fb,0x13fb,0x13fb,0x13fb,
+0x13fb,0x13fb,0x13fb,0xc3,0xc3,0xc3,0xc3,0xc3,0xc3,0xc3,0xc3,0xc3,0xc3,0xc3,0xc3,0xc3,
+0xc3,0xc3,0xc3,0xc3,0xc3,0xc3,0xc3,0xc3,0xc3,0xc3,0xc3,0xc3,0xc3,0x15db,0x15db,0x15db,
+0x15db,0xc3,0xc3,0xc3,0xc3,0xc3,0xc3,0xc3,0xc3,0xc3,0xc3,0xc3,0xc3,0xc3,0xc3,0xc3,
+0xc3,0xd7a,0xd7a,0xd7a,0xd7a,0xd7a,0xd7a,0xd7a,0xd7a,0xd7a,0xd7a,0xd7a,0xd7a,0xd7a,0xd7a,0xd7a,
 0xd7a,0xd7a,0xd7a,0xd7a,0xd7a,0xd7a,0xd7a,0xd7a,0xd7a,0xd7a,0xd7a,0xd7a,0xd7a,0xd7a,0xd7a,0xd7a,
 0xd7a,0xd7a,0xd7a,0xd7a,0xd7a,0xd7a,0xd7a,0xd7a,0xd7a,0xd7a,0xd7a,0xd7a,0xd7a,0xd7a,0xd7a,0xd7a,
-0xd92,0xd92,0xd92,0xd92,0xd92,0xd92,0xd92,0xd92,0xd92,0xd92,0xd92,0xd92,0xd92,0xd92,0xd92,0xd92,
-0xd92,0xd92,0xd92,0xd92,0xd92,0xd92,0xd92,0xe4c,0xe4c,0xe4c,0xe4c,0xf4e,0xf4e,0xf4e,0xf4e,0xf4e,
-0xd9b,0xd9b,0xd9b,0xd9b,0xd9b,0xd9b,0xd9b,0xd9b,0xd9b,0xd9b,0xd9b,0xd9b,0xd9b,0xd9b,0xd9b,0xd9b,
-0xd9b,0xd9b,0xd9b,0xd9b,0xd9b,0xd9b,0xd9b,0xd9b,0xd9b,0xd9b,0xd9b,0xd9b,0xd9b,0xd9b,0xd9b,0xd9b,
-0xda4,0xda4,0xda4,0xda4,0xda4,0xda4,0xda4,0xda4,0xda4,0xda4,0xda4,0xda4,0xda4,0xda4,0xda4,0xda4,
-0xda4,0xda4,0xda4,0xda4,0xda4,0xda4,0xda4,0xda4,0xda4,0xda4,0xda4,0xda4,0xda4,0xda4,0xda4,0xda4,
-0xdad,0xdad,0xdad,0xdad,0xdad,0xdad,0xdad,0xdad,0xdad,0xdad,0xdad,0xdad,0xdad,0xdad,0xdad,0xdad,
-0xdad,0xdad,0xdad,0xdad,0xdad,0xdad,0xdad,0xdad,0xdad,0xdad,0xdad,0xdad,0xdad,0xdad,0xdad,0xda7,
-0xdaa,0xdaa,0xdaa,0xdaa,0xdaa,0xdaa,0xdaa,0xdaa,0xdaa,0xdaa,0xdaa,0xdaa,0xdaa,0xdaa,0xdaa,0xdaa,
-0xdaa,0xdaa,0xdaa,0xdaa,0xdaa,0xdaa,0xdaa,0xdaa,0xdaa,0xdaa,0xdaa,0xdad,0xdad,0xdad,0xdad,0xdad,
-0xdb6,0xdb6,0xdb6,0xdb6,0xdb6,0xdb6,0xdb6,0xdb6,0xdb6,0xdb6,0xdb6,0xdb6,0xdb6,0xdb6,0xdb3,0xdb3,
-0xdb3,0xdb3,0xdb3,0xdb3,0xdb3,0xdb3,0xdb0,0xdb9,0xf5a,0xf54,0xf63,0xf51,0xdb6,0xdb6,0xf51,0xf51,
-0xdcb,0xdcb,0xdbc,0xdcb,0xdcb,0xdcb,0xdc2,0xdcb,0xdcb,0xdcb,0xdcb,0xdbc,0xdcb,0xdcb,0xdcb,0xdcb,
-0xdcb,0xdcb,0xdcb,0xdcb,0xdcb,0xdcb,0xdcb,0xdcb,0xdcb,0xdcb,0xdcb,0xdcb,0xdcb,0xdcb,0xdcb,0xdcb,
+0xf6,0xd77,0xd77,0xd77,0xd77,0xd77,0xd77,0xd77,0xd77,0xd77,0xd77,0xd77,0xd77,0xd77,0xd77,0xd77,
+0xd77,0xd77,0xd77,0xd77,0xd77,0xd77,0xd77,0xd77,0xd77,0xd77,0xd77,0xd77,0xd77,0xd77,0xd77,0xd77,
+0xf6,0xe8e,0xe8b,0xe8e,0xe8e,0xe8e,0xe8b,0xe8b,0xe8e,0xe8b,0xe8e,0xe8b,0xe8e,0xe8b,0xf75,0xf75,
+0xf75,0x10ad,0xf6c,0xf75,0xf6c,0xe8b,0xe8e,0xe8b,0xe8b,0xf6c,0xf6c,0xf6c,0xf6c,0xf6f,0xf72,0x10ad,
+0x10ad,0xd68,0xd65,0xd68,0xd65,0xd68,0xd65,0xd68,0xd65,0xd68,0xd65,0xd68,0xd65,0xd68,0xd65,0xd68,
+0xd65,0xd68,0xd65,0xd68,0xd65,0xd68,0xd65,0xd68,0xd65,0xd68,0xd65,0xd68,0xd65,0xd68,0xd65,0xd68,
+0xd65,0xd68,0xd65,0xd68,0xd65,0xd68,0xd65,0xd68,0xd65,0xd68,0xd65,0xd68,0xd65,0xd68,0xd65,0xd68,
+0xd65,0xd68,0xd65,0xd68,0xd65,0xd68,0xd65,0xd68,0xd65,0xd68,0xd65,0xd68,0xd65,0xd68,0xd65,0xd68,
+0xd65,0xd65,0xd5c,0xd5c,0xd5c,0xd5c,0xd5c,0xd5c,0x10a1,0x109e,0x10a1,0x109e,0x109b,0x109b,0x109b,0x12f6,
+0x12f3,0xea,0xea,0xea,0xea,0xea,0xd62,0xd5f,0xd5f,0xd5f,0xd5c,0xd62,0xd5f,0xd74,0xd74,0xd74,
+0xd74,0xd74,0xd74,0xd74,0xd74,0xd74,0xd74,0xd74,0xd74,0xd74,0xd74,0xd74,0xd74,0xd74,0xd74,0xd74,
+0xd74,0xd74,0xd74,0xd74,0xd74,0xd74,0xd74,0xd74,0xd74,0xd74,0xd74,0xd74,0xd74,0xd74,0xd74,0xd74,
+0xd74,0xd74,0xd74,0xf3,0x12f9,0xf3,0xf3,0xf3,0xf3,0xf3,0x12f9,0xf3,0xf3,0xdce,0xdce,0xdce,
 0xdce,0xdce,0xdce,0xdce,0xdce,0xdce,0xdce,0xdce,0xdce,0xdce,0xdce,0xdce,0xdce,0xdce,0xdce,0xdce,
 0xdce,0xdce,0xdce,0xdce,0xdce,0xdce,0xdce,0xdce,0xdce,0xdce,0xdce,0xdce,0xdce,0xdce,0xdce,0xdce,
-0xde0,0xde0,0xde0,0xde0,0xde0,0xde0,0xde0,0xde0,0xde0,0xde0,0xde0,0xde0,0xde0,0xde0,0xde0,0xde0,
-0xde0,0xde0,0xde0,0xde0,0xde0,0xde0,0xde0,0xde0,0xde0,0xde0,0xde0,0xde0,0xde0,0xde0,0xde0,0xde0,
-0xdfe,0xdfe,0xdfe,0xdfe,0xdfe,0xdfe,0xdfe,0xdfe,0xdfe,0xdfe,0xdfe,0xdfe,0xdfe,0xdfe,0xdfe,0xdfe,
-0x1053,0x1053,0x1053,0x1053,0x1053,0x1053,0x1053,0x1053,0x1053,0x1053,0x1053,0x1053,0x1053,0x1053,0x1053,0x1053,
-0xe46,0xe46,0xe46,0xe46,0xf3f,0xf3f,0xf3f,0xf3f,0xf3f,0xf3f,0xf3f,0xf3f,0xf3f,0xf3f,0xf3f,0xf3f,
-0xf42,0xf42,0xf42,0xf42,0xf42,0xf42,0xf42,0xf42,0xf42,0xf42,0xf42,0xf42,0xf42,0xf42,0xf42,0xf42,
-0xe67,0xe67,0xe67,0xe67,0xe79,0xe82,0xe85,0xe82,0xe85,0xe82,0xe85,0xe82,0xe85,0xe82,0xe85,0xe82,
-0xe82,0xe82,0xe85,0xe82,0xe82,0xe82,0xe82,0xe82,0xe82,0xe82,0xe82,0xe82,0xe82,0xe82,0xe82,0xe82,
-0xe82,0xe82,0xe82,0xe82,0xe82,0xe82,0xe82,0xe82,0xe6a,0xe79,0xe67,0xe67,0xe67,0xe67,0xe67,0xe7c,
-0xe67,0xe7c,0xe79,0xe79,0xe8e,0xe8b,0xe8e,0xe8e,0xe8e,0xe8b,0xe8b,0xe8e,0xe8b,0xe8e,0xe8b,0xe8e,
-0xe8b,0xf75,0xf75,0xf75,0x10ad,0xf6c,0xf75,0xf6c,0xe8b,0xe8e,0xe8b,0xe8b,0xf6c,0xf6c,0xf6c,0xf6c,
-0xf6f,0xf72,0x10ad,0x10ad,0xe91,0xe91,0xf87,0xf7e,0xf87,0xf7e,0xf87,0xf7e,0xf87,0xf7e,0xf87,0xf7e,
-0xf87,0xf7e,0xf87,0xf7e,0xf7e,0xf7e,0xf87,0xf7e,0xf87,0xf7e,0xf87,0xf7e,0xf87,0xf7e,0xf87,0xf7e,
-0xf87,0xf7e,0xf87,0xf7e,0xe97,0xe97,0xe97,0xe97,0xe97,0xe97,0xe97,0xe97,0xe97,0xe97,0xe97,0xe97,
-0xe97,0xe97,0xe97,0xe97,0xe97,0xe97,0xe97,0xe97,0xe97,0xe97,0xe97,0xe97,0xe97,0xe97,0xe97,0xe97,
-0xe97,0xe97,0xe97,0xe97,0xea6,0xea6,0xea6,0xea6,0xea6,0xea6,0xea6,0xea6,0xea6,0xea6,0xea6,0xea6,
-0xea6,0xea6,0xea6,0xea6,0xea6,0xea6,0xea6,0xea6,0xea6,0xea6,0xea6,0xea6,0xea6,0xea6,0xea6,0xea6,
-0xea6,0xea6,0xea6,0xea6,0xea6,0xea6,0xea6,0x1422,0x1422,0x1422,0x1422,0x1422,0x1422,0x1422,0x1422,0x1422,
-0x1422,0x1422,0x1422,0x1422,0x1422,0x1422,0x1422,0x1422,0xeac,0xeac,0xeac,0xeac,0xeac,0xeac,0xeac,0xeac,
-0xeac,0xeac,0xeac,0xeac,0xeac,0xeac,0xeac,0xeac,0xeac,0xeac,0xeac,0xeac,0xeac,0xeac,0xeac,0xeac,
-0xeac,0xeac,0xeac,0xeac,0xeac,0xeac,0xeac,0xeac,0xef4,0xf0f,0xf06,0xf03,0xf03,0xf0f,0xf0f,0xf06,
-0xf06,0xf03,0xf03,0xf03,0xf03,0xf03,0xf0f,0xf0f,0xf0f,0xef4,0xef4,0xef4,0xef4,0xf0f,0xf0f,0xf0f,
-0xf0f,0xf0f,0xf0f,0xf0f,0xf0f,0xf0f,0xf0f,0xf0f,0xf0f,0xf0f,0xef4,0xf06,0xf09,0xef4,0xef4,0xf0c,
-0xf0c,0xf0c,0xf0c,0xf0c,0xf0c,0xef7,0xf0f,0xf0c,0xf00,0xf00,0xf00,0xf00,0xf00,0xf00,0xf00,0xf00,
-0xf00,0xf00,0x1074,0x1074,0x1071,0x106e,0xefd,0xefd,0xf27,0xf27,0xf27,0xf27,0x11bb,0x11bb,0x11bb,0x11bb,
-0x11bb,0x11b8,0x11b8,0x11b8,0x11b8,0x11bb,0x1245,0x11bb,0x11bb,0x11bb,0x11b8,0x11bb,0x11bb,0x11b8,0x11b8,0x11b8,
-0x11bb,0x11bb,0x11b8,0x11b8,0x11bb,0x11b8,0x11b8,0x11bb,0xf42,0xf42,0xf42,0xf42,0xf42,0xf3f,0xf3f,0xf42,
-0xf42,0xf42,0xf42,0xf42,0xf42,0x13fb,0x13fb,0x13fb,0xf3f,0xf3f,0xf3f,0xf3f,0xf3f,0x11c4,0x11c4,0x11c4,
-0x11c4,0x11c4,0x13fb,0x13fb,0x13fb,0x13fb,0x13fb,0x13fb,0xf60,0xf60,0xf5d,0xf57,0xf5d,0xf57,0xf5d,0xf57,
-0xf5d,0xf57,0xf54,0xf54,0xf54,0xf54,0xf69,0xf66,0xf54,0x10aa,0x12fc,0x12ff,0x12ff,0x12fc,0x12fc,0x12fc,
-0x12fc,0x12fc,0x1302,0x1302,0x1416,0x140a,0x140a,0x1407,0xf87,0xf7e,0xf87,0xf7e,0xf87,0xf7e,0xf87,0xf7e,
-0xf7b,0xf78,0xf78,0xf87,0xf7e,0x1269,0x1266,0x15e1,0x1269,0x1266,0x130b,0x1308,0x1419,0x1419,0x141f,0x1419,
-0x141f,0x1419,0x141f,0x1419,0x141f,0x1419,0x141f,0x1419,0xf87,0xf7e,0xf87,0xf7e,0xf87,0xf7e,0xf87,0xf7e,
-0xf87,0xf7e,0xf87,0xf7e,0xf87,0xf7e,0xf87,0xf7e,0xf87,0xf7e,0xf87,0xf7e,0xf87,0xf7e,0xf87,0xf7e,
-0xf87,0xf7e,0xf87,0xf7e,0xf87,0xf7e,0xf87,0xf7e,0xf81,0xf7e,0xf7e,0xf7e,0xf7e,0xf7e,0xf7e,0xf7e,
-0xf7e,0xf87,0xf7e,0xf87,0xf7e,0xf87,0xf87,0xf7e,0xf8a,0xf8a,0xf90,0xf96,0xf96,0xf96,0xf96,0xf96,
-0xf96,0xf96,0xf96,0xf96,0xf96,0xf96,0xf96,0xf96,0xf96,0xf96,0xf96,0xf96,0xf96,0xf96,0xf96,0xf96,
-0xf96,0xf96,0xf96,0xf96,0xf96,0xf96,0xf96,0xf96,0xf96,0xf90,0xf8a,0xf8a,0xf8a,0xf8a,0xf90,0xf90,
-0xf8a,0xf8a,0xf93,0x1314,0x1311,0x1311,0xf96,0xf96,0xf8d,0xf8d,0xf8d,0xf8d,0xf8d,0xf8d,0xf8d,0xf8d,
-0xf8d,0xf8d,0x1317,0x1317,0x1317,0x1317,0x1317,0x1317,0xfab,0xfab,0xfab,0xfab,0xfab,0xfab,0xfab,0xfab,
-0xfab,0xfab,0xfab,0xfab,0xfab,0xfab,0xfab,0xfab,0xfab,0xfab,0xfab,0xfab,0xfab,0xfab,0xfab,0xfab,
-0xfab,0xfab,0xfab,0xfab,0xfab,0xfab,0xfab,0xfab,0xfb4,0xfb4,0xfb4,0xfb4,0xfb4,0xfb4,0xfb4,0xfb4,
-0xfb4,0xfb4,0xfb4,0xfb4,0xfb4,0xfb4,0xfb4,0xfb4,0xfb4,0xfb4,0xfb4,0xfb4,0xfb4,0xfb4,0xfb4,0xfb4,
-0xfb7,0xfb7,0xfb7,0xfba,0xfb7,0xfb7,0xfbd,0xfbd,0xfc0,0xfc0,0xfc0,0xfc0,0xfc0,0xfc0,0xfc0,0xfc0,
+0xdce,0xdce,0xdce,0x1305,0x1305,0x108,0x108,0x108,0x108,0x108,0x108,0x108,0xdd1,0x1263,0x108,0x108,
+0x108,0x108,0x108,0x108,0x108,0x108,0x108,0x108,0x108,0x108,0x108,0x108,0x1260,0xd6b,0xd6b,0xd6b,
+0xd6b,0xd6b,0xd6b,0xd6b,0xd6b,0xd6b,0xd6b,0xd6b,0xd6b,0xd6b,0xd6b,0xd6b,0xd6b,0xd6b,0xd6b,0xd6b,
+0xd6b,0xd6b,0xd6b,0xd6b,0xed,0xed,0xed,0xed,0xed,0xed,0xed,0xed,0xed,0xd6b,0xd6b,0xd6b,
+0xd6b,0xd6b,0xd6b,0xd6b,0xed,0xd6b,0xd6b,0xd6b,0xd6b,0xd6b,0xd6b,0xd6b,0xed,0xd6b,0xd6b,0xd6b,
+0xd6b,0xd6b,0xd6b,0xd6b,0xed,0xd6b,0xd6b,0xd6b,0xd6b,0xd6b,0xd6b,0xd6b,0xed,0xfc0,0xfc0,0xfc0,
 0xfc0,0xfc0,0xfc0,0xfc0,0xfc0,0xfc0,0xfc0,0xfc0,0xfc0,0xfc0,0xfc0,0xfc0,0xfc0,0xfc0,0xfc0,0xfc0,
-0xfc0,0xfc0,0xfc0,0xfc0,0xfc0,0xfc0,0xfc0,0xfc0,0xfc9,0xfc9,0xfc9,0xfc9,0xfc9,0xfc9,0xfc9,0xfc9,
-0xfc9,0xfc9,0xfc9,0xfc9,0xfcc,0xfc3,0xfd2,0xfcf,0xfc9,0xfc9,0xfc9,0xfc9,0xfc9,0xfc9,0xfc9,0xfc9,
-0xfc9,0xfc9,0xfc9,0xfc9,0xfc9,0xfc9,0xfc9,0xfc9,0xfc9,0xfc9,0xfc9,0xfc9,0xfc9,0xfc9,0xfc9,0xfc9,
-0xfc9,0xfc9,0xfc9,0xfc9,0xfc9,0xfc9,0xfc9,0xfc9,0x126f,0x126c,0xfe4,0xfde,0xfe4,0xfde,0xfe4,0xfde,
-0xfe4,0xfde,0xfe4,0xfde,0xfe4,0xfde,0xfe1,0x105c,0xfd5,0xfd5,0xfd5,0xfdb,0x131a,0x131a,0x131a,0x131a,
-0x131a,0x131a,0x131a,0x131a,0xfd8,0xfd8,0xfdb,0xfe7,0xfe4,0xfde,0xfe4,0xfde,0xfe4,0xfde,0xfe4,0xfde,
-0xfe4,0xfde,0xfe4,0xfde,0xfe4,0xfde,0xfe4,0xfde,0xfe4,0xfde,0xfe4,0xfde,0xfe4,0xfde,0xfe4,0xfde,
-0xfe4,0xfde,0xfe4,0xfde,0xfe4,0xfde,0xfe4,0xfde,0x142e,0x142b,0x142e,0x142b,0x1431,0x1431,0x15ea,0x131a,
-0xff0,0xff0,0xff3,0xff3,0xff3,0xff3,0xff3,0xff3,0xff3,0xff3,0xff3,0xff3,0xff3,0xff3,0xff3,0xff3,
-0xff3,0xff3,0xff3,0xff3,0xff3,0xff3,0xff3,0xff3,0xff3,0xff3,0xff3,0xff3,0xff3,0xff3,0xff3,0xff3,
-0xff0,0xff0,0xff0,0xff0,0xff0,0xff0,0xff0,0xff0,0xff0,0xff0,0xff0,0xff0,0x1002,0x1002,0x1002,0x1002,
-0x1002,0x1002,0xff9,0xff9,0xff9,0xff9,0xff9,0xffc,0xffc,0xffc,0x1050,0x1005,0x1014,0x1014,0x1014,0x1014,
-0x1014,0x1014,0x1014,0x1014,0x1014,0x1014,0x1014,0x1014,0x1014,0x1014,0x1014,0x1014,0xfff,0xfff,0xfff,0xfff,
-0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0x1002,0x1002,0x1002,0x1002,0x1002,0x1002,0x1002,0x1002,0x1002,0x1002,
-0x1002,0x1002,0x1002,0x1002,0x1002,0x1002,0x1002,0x1002,0x1002,0x1002,0x1002,0x1002,0x1023,0x1023,0x1023,0x1023,
-0x1023,0x1023,0x1023,0x1023,0x1023,0x1023,0x1023,0x1023,0x1023,0x1023,0x1023,0x1023,0x1023,0x1023,0x1023,0x1023,
-0x1023,0x1023,0x1023,0x1023,0x1023,0x1023,0x1023,0x1023,0x1023,0x1023,0x1023,0x1023,0x1035,0x1035,0x1035,0x1035,
-0x1035,0x1035,0x1035,0x1035,0x1035,0x1035,0x1035,0x1035,0x1035,0x1035,0x1035,0x1035,0x1035,0x1035,0x1035,0x1035,
-0x1035,0x1035,0x1035,0x1035,0x1035,0x1035,0x1035,0x1035,0x1035,0x1035,0x1035,0x1035,0x103e,0x103e,0x103e,0x103e,
-0x103e,0x103e,0x103e,0x103e,0x103e,0x103e,0x103e,0x103e,0x103e,0x103e,0x103e,0x103e,0x103e,0x103e,0x103e,0x103e,
-0x103e,0x103e,0x103e,0x103e,0x103e,0x103e,0x103e,0x103e,0x103e,0x103e,0x103e,0x103e,0x1041,0x1041,0x1041,0x1041,
-0x1041,0x1041,0x1041,0x1041,0x1041,0x1041,0x1041,0x1041,0x1041,0x1041,0x1041,0x1041,0x1041,0x1041,0x1041,0x1041,
-0x1041,0x1041,0x1041,0x1041,0x1041,0x1041,0x1041,0x1041,0x1041,0x1041,0x1041,0x1041,0x10bf,0x10bf,0x10bf,0x10bf,
-0x10bf,0x10bf,0x10bf,0x10bf,0x10bf,0x10bf,0x10bf,0x10bf,0x10bf,0x10bf,0x10bf,0x10bf,0x10bf,0x10bf,0x10bf,0x10bf,
-0x10bf,0x10bf,0x10b6,0x10b6,0x10b9,0x10b9,0x10bf,0x10b6,0x10b6,0x10b6,0x10b6,0x10b6,0x10c2,0x10c2,0x10c2,0x10c2,
-0x10c2,0x10c2,0x10c2,0x10c2,0x10c2,0x10c2,0x10c2,0x10c2,0x10c2,0x10c2,0x10c2,0x10c2,0x10c2,0x10c2,0x10c2,0x10c2,
-0x10c2,0x10c2,0x10c2,0x10c2,0x10c2,0x10c2,0x10c2,0x10c2,0x10c2,0x10c2,0x10c2,0x10c2,0x10dd,0x10dd,0x10dd,0x10dd,
-0x10dd,0x10dd,0x10dd,0x10dd,0x10dd,0x10dd,0x10dd,0x10dd,0x10dd,0x10dd,0x10dd,0x10dd,0x10dd,0x10dd,0x10dd,0x10dd,
-0x10dd,0x10dd,0x10dd,0x10dd,0x10dd,0x10dd,0x10dd,0x10dd,0x10dd,0x10dd,0x10dd,0x10dd,0x10e9,0x10e9,0x10e9,0x10e9,
+0xfc0,0xfc0,0xfc0,0xfc0,0xfc0,0xfc0,0xfc0,0xfc0,0xfc0,0xfc0,0xfc0,0xfc0,0xfc0,0xdb6,0xdb6,0xdb6,
+0xdb6,0xdb6,0xdb6,0xdb6,0xdb6,0xdb6,0xdb6,0xdb6,0xdb6,0xdb6,0xdb6,0xdb3,0xdb3,0xdb3,0xdb3,0xdb3,
+0xdb3,0xdb3,0xdb3,0xdb0,0xdb9,0xf5a,0xf54,0xf63,0xf51,0xdb6,0xdb6,0xf51,0xf51,0xf60,0xf60,0xf5d,
+0xf57,0xf5d,0xf57,0xf5d,0xf57,0xf5d,0xf57,0xf54,0xf54,0xf54,0xf54,0xf69,0xf66,0xf54,0x10aa,0x12fc,
+0x12ff,0x12ff,0x12fc,0x12fc,0x12fc,0x12fc,0x12fc,0x1302,0x1302,0x1416,0x140a,0x140a,0x1407,0x140d,0x1413,0x1410,
+0x102,0x102,0x102,0x102,0x102,0x102,0x102,0x102,0x102,0x102,0x102,0x102,0x102,0x102,0x102,0x102,
+0x102,0x102,0x102,0x102,0x102,0x102,0x102,0x102,0x102,0x102,0x102,0x102,0x102,0x102,0x102,0x102,
+0x102,0x102,0x102,0x102,0x102,0x102,0x102,0x102,0x102,0x102,0x102,0x102,0x102,0x102,0x102,0x102,
+0x102,0x102,0x102,0x102,0x102,0x102,0x102,0x102,0x102,0x102,0x102,0x102,0x102,0xa6b,0xa6b,0xa6b,
+0xa6b,0xa6b,0xa6b,0xa6b,0xa6b,0xa6b,0xa6b,0xa6b,0xa6b,0xa6b,0xa6b,0xa6b,0xa6b,0xa6b,0xa6b,0xa6b,
+0xa6b,0xa6b,0xa6b,0xa6b,0xa6b,0xa6b,0xa6b,0x6c,0xa6b,0xa6b,0xa6b,0xa6b,0xa6e,0xa6b,0xa6b,0xa6b,
+0xa6b,0xa6b,0xa6b,0xa6b,0xa6b,0xa6b,0xa6b,0xa6b,0xa6b,0xa6b,0xa6b,0xa6b,0xa6b,0xa6b,0xa6b,0xa6b,
+0xa6b,0xa6b,0xa6b,0xa6b,0xa6b,0xa6b,0xa6b,0xa6b,0xa6b,0xa6b,0xa6b,0xa6b,0xa6b,0xa6b,0xa6b,0xa6b,
+0xa6b,0xa6b,0xa6b,0xa6b,0xa6b,0xa6b,0xa6b,0xa6b,0xa6b,0xa6b,0xa6b,0xa6b,0xa6b,0xa6b,0xa6b,0xa6b,
+0xa6e,0x6c,0x6c,0x6c,0x6c,0x6c,0x6c,0x6c,0x6c,0x6c,0x6c,0x6c,0x6c,0xa71,0xa71,0xa71,
+0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,
+0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,
+0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,
+0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0x6f,0x6f,0x6f,
+0x6f,0x6f,0x6f,0x6f,0x6f,0x6f,0x6f,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0xa74,0xa74,0xa77,0xa77,0xa74,0xa74,0xa74,0xa74,0xa74,
+0xa74,0xa74,0xa74,0x72,0x72,0x72,0x72,0x6c9,0x84c,0x84f,0x855,0x77a,0x786,0x86a,0x783,0x843,
+0x840,0x843,0x840,0x849,0x846,0x849,0x846,0x843,0x840,0x780,0x855,0x843,0x840,0x843,0x840,0x843,
+0x840,0x843,0x840,0x85b,0x861,0x85e,0x85e,0x780,0x783,0x783,0x783,0x783,0x783,0x783,0x783,0x783,
+0x783,0x89d,0x89d,0x89d,0x89d,0x789,0x789,0x858,0x867,0x867,0x867,0x867,0x864,0x77d,0x852,0xa7a,
+0xa7a,0xa7a,0xbb5,0xbd3,0xbd0,0xa95,0x828,0x75,0x792,0x78c,0x792,0x78c,0x792,0x78c,0x792,0x78c,
+0x792,0x78c,0x78c,0x78f,0x78c,0x78f,0x78c,0x78f,0x78c,0x78f,0x78c,0x78f,0x78c,0x78f,0x78c,0x78f,
+0x78c,0x78f,0x78c,0x78f,0x78c,0x78f,0x78c,0x78f,0x78c,0x78f,0x792,0x78c,0x78f,0x78c,0x78f,0x78c,
+0x78f,0x78c,0x78c,0x78c,0x78c,0x78c,0x78c,0x78f,0x78f,0x78c,0x78f,0x78f,0x78c,0x78f,0x78f,0x78c,
+0x78f,0x78f,0x78c,0x78f,0x78f,0x78c,0x78c,0x78c,0x792,0x78c,0x792,0x78c,0x792,0x78c,0x78c,0x78c,
+0x78c,0x78c,0x78c,0x792,0x78c,0x78c,0x78c,0x78c,0x78c,0x78f,0xbbb,0xbbb,0x75,0x75,0x8a0,0x8a0,
+0x86d,0x86d,0x795,0x798,0xbb8,0xbd6,0x7a1,0x79b,0x7a1,0x79b,0x7a1,0x79b,0x7a1,0x79b,0x7a1,0x79b,
+0x79b,0x79e,0x79b,0x79e,0x79b,0x79e,0x79b,0x79e,0x79b,0x79e,0x79b,0x79e,0x79b,0x79e,0x79b,0x79e,
+0x79b,0x79e,0x79b,0x79e,0x79b,0x79e,0x7a1,0x79b,0x79e,0x79b,0x79e,0x79b,0x79e,0x79b,0x79b,0x79b,
+0x79b,0x79b,0x79b,0x79e,0x79e,0x79b,0x79e,0x79e,0x79b,0x79e,0x79e,0x79b,0x79e,0x79e,0x79b,0x79e,
+0x79e,0x79b,0x79b,0x79b,0x79b,0x79b,0x7a1,0x79b,0x7a1,0x79b,0x7a1,0x79b,0x79b,0x79b,0x79b,0x79b,
+0x79b,0x7a1,0x79b,0x79b,0x79b,0x79b,0x79b,0x79e,0x7a1,0x7a1,0x79e,0x79e,0x79e,0x79e,0x870,0x873,
+0x7a4,0x7a7,0xbbe,0x78,0x78,0x78,0x78,0x78,0x7aa,0x7aa,0x7aa,0x7aa,0x7aa,0x7aa,0x7aa,0x7aa,
+0x7aa,0x7aa,0x7aa,0x7aa,0x7aa,0x7aa,0x7aa,0x7aa,0x7aa,0x7aa,0x7aa,0x7aa,0x7aa,0x7aa,0x7aa,0x7aa,
+0x7aa,0x7aa,0x7aa,0x7aa,0x7aa,0x7aa,0x7aa,0x7aa,0x7aa,0x7aa,0x7aa,0x7aa,0x7aa,0x7aa,0x7aa,0x7aa,
+0x104a,0x78,0x78,0x7b,0x7ad,0x7ad,0x7ad,0x7ad,0x7ad,0x7ad,0x7ad,0x7ad,0x7ad,0x7ad,0x7ad,0x7ad,
+0x7ad,0x7ad,0x7ad,0x7ad,0x7ad,0x7ad,0x7ad,0x7ad,0x7ad,0x7ad,0x7ad,0x7ad,0x7ad,0x7ad,0x7ad,0x7ad,
+0x7ad,0x7ad,0x7ad,0x7ad,0x7ad,0x7ad,0x7ad,0x7ad,0x7b0,0x7ad,0x7ad,0x7ad,0x7ad,0x7ad,0x7ad,0x7ad,
+0x7ad,0x7ad,0x7ad,0x7ad,0x7ad,0x7ad,0x7ad,0x7ad,0x7ad,0x7ad,0x7ad,0x7ad,0x7ad,0x7ad,0x7ad,0x7ad,
+0x7ad,0x7ad,0x7ad,0x7ad,0x7b,0x876,0x876,0x879,0x879,0x879,0x879,0x879,0x879,0x879,0x879,0x879,
+0x879,0x879,0x879,0x879,0x879,0xa7d,0xa7d,0xa7d,0xa7d,0xa7d,0xa7d,0xa7d,0xa7d,0xa7d,0xa7d,0xa7d,
+0xa7d,0xa7d,0xa7d,0xa7d,0xa7d,0xa7d,0xa7d,0xa7d,0xa7d,0xa7d,0xa7d,0xa7d,0xa7d,0x12cc,0x12cc,0x12cc,
+0x7e,0x7e,0x7e,0x7e,0x7e,0xdfe,0xdfe,0xdfe,0xdfe,0xdfe,0xdfe,0xdfe,0xdfe,0xdfe,0xdfe,0xdfe,
+0xdfe,0xdfe,0xdfe,0xdfe,0xdfe,0x1053,0x1053,0x1053,0x1053,0x1053,0x1053,0x1053,0x1053,0x1053,0x1053,0x1053,
+0x1053,0x1053,0x1053,0x1053,0x1053,0x1053,0x1053,0x1053,0x1053,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,
+0xe4,0xe4,0xe4,0xe4,0xe4,0xbca,0xbca,0xbca,0xbca,0xbca,0xbca,0xbca,0xbca,0xbca,0xbca,0xbca,
+0xbca,0xbca,0xbca,0xbca,0xbca,0x7b6,0x7b6,0x7b6,0x7b6,0x7b6,0x7b6,0x7b6,0x7b6,0x7b6,0x7b6,0x7b6,
+0x7b6,0x7b6,0x7b6,0x7b6,0x7b6,0x7b6,0x7b6,0x7b6,0x7b6,0x7b6,0x7b6,0x7b6,0x7b6,0x7b6,0x7b6,0x7b6,
+0x7b6,0x7b6,0xcb4,0xcb4,0x81,0x87c,0x87c,0x87c,0x87c,0x87c,0x87c,0x87c,0x87c,0x87c,0x87c,0x87c,
+0x87c,0x87c,0x87c,0x87c,0x87c,0x87c,0x87c,0x87c,0x87c,0x87c,0x87c,0x87c,0x87c,0x87c,0x87c,0x87c,
+0x87c,0x87c,0x87c,0x87c,0x87c,0x11dc,0x11dc,0x11dc,0x11dc,0x11c1,0x11c1,0x11c1,0x11c1,0x11c1,0x11c1,0x11c1,
+0x11c1,0xcb1,0xbc1,0xbc1,0xbc1,0xbc1,0xbc1,0xbc1,0xbc1,0xbc1,0xbc1,0xbc1,0xbc1,0xbc1,0xbc1,0xbc1,
+0xbc1,0x7b9,0x7b9,0x7b9,0x7b9,0x7b9,0x7b9,0x7b9,0x7b9,0x7b9,0x7b9,0x7b9,0x7b9,0x7b9,0x7b9,0x7b9,
+0x7b9,0x7b9,0x7b9,0x7b9,0x7b9,0x7b9,0x7b9,0x7b9,0x7b9,0x7b9,0x7b9,0x7b9,0x7b9,0xcb7,0xcb7,0xdda,
+0x7b3,0x87f,0x87f,0x87f,0x87f,0x87f,0x87f,0x87f,0x87f,0x87f,0x87f,0x87f,0x87f,0x87f,0x87f,0x87f,
+0x87f,0x87f,0x87f,0x87f,0x87f,0x87f,0x87f,0x87f,0x87f,0x87f,0x87f,0x87f,0x87f,0x87f,0x87f,0x87f,
+0x87f,0x87f,0x87f,0x87f,0x87f,0x87f,0x87f,0x87f,0x87f,0x87f,0x87f,0x87f,0x87f,0x87f,0x87f,0x87f,
+0x87f,0x87f,0xbc1,0xbc1,0xbc1,0xbc1,0xbc1,0xbc1,0xbc1,0xbc1,0xbc1,0xbc1,0xbc1,0xbc1,0xbc1,0xbc1,
+0xbc1,0x87c,0x87c,0x87c,0x87c,0x87c,0x87c,0x87c,0x87c,0x87c,0x87c,0x87c,0x87c,0xcb1,0xcb1,0xcb1,
+0xcb1,0x7bc,0x7bc,0x7bc,0x7bc,0x7bc,0x7bc,0x7bc,0x7bc,0x7bc,0x7bc,0x7bc,0x7bc,0x7bc,0x7bc,0x7bc,
+0x7bc,0x7bc,0x7bc,0x7bc,0x7bc,0x7bc,0x7bc,0x7bc,0x7bc,0x7bc,0x7bc,0x7bc,0x7bc,0x7bc,0x7bc,0x7bc,
+0x7bc,0x7bc,0x7bc,0x7bc,0x7bc,0x7bc,0x7bc,0x7bc,0x7bc,0x7bc,0x7bc,0x7bc,0x7bc,0x7bc,0x7bc,0x7bc,
+0x81,0x7c2,0x7c2,0x7c2,0x7c2,0x7c2,0x7c2,0x7c2,0x7c2,0x7c2,0x7c2,0x7c2,0x7c2,0x7c2,0x7c2,0x7c2,
+0x7c2,0x7c2,0x7c2,0x7c2,0x7c2,0x7c2,0x7c2,0x7c2,0x7c2,0x7c2,0x7c2,0x7c2,0x7c2,0x7c2,0x7c2,0x7c2,
+0x7c2,0x7c2,0x7c2,0x7c2,0x7c2,0x7c2,0x7c2,0x7c2,0x7c2,0x7c2,0x7c2,0x7c2,0x7c2,0x7c2,0x7c2,0x7c2,
+0x7c2,0x7c2,0x7c2,0x7c2,0x7c2,0x7c2,0x7c2,0x7c2,0x7c2,0x7c2,0x7c2,0x7c2,0x7c2,0x7c2,0x7c2,0x7c2,
+0x7c2,0x882,0x882,0x882,0x882,0x882,0x882,0x882,0x882,0x882,0x882,0x882,0x882,0x882,0x882,0x882,
+0x882,0x882,0x882,0x882,0x882,0x882,0x882,0x882,0x882,0x882,0x7bf,0x7bf,0x7bf,0x7bf,0x7bf,0x7bf,
+0xcba,0xcba,0xcba,0xcba,0x885,0x885,0x885,0x885,0x885,0x7bf,0x7bf,0x7bf,0x7bf,0x7bf,0x7bf,0x7bf,
+0x7bf,0x7bf,0x7bf,0x7bf,0x7bf,0x7bf,0x7bf,0x7bf,0x7bf,0x7bf,0x7bf,0x7bf,0x7bf,0x7bf,0x7bf,0x7bf,
+0x7bf,0x7bf,0x7bf,0x7bf,0x7bf,0x7bf,0x7bf,0x7bf,0x7bf,0x7bf,0x7bf,0x7bf,0x7bf,0x7bf,0x7bf,0x7bf,
+0x7bf,0x7bf,0x7bf,0x7bf,0x7bf,0x7bf,0x7bf,0x7bf,0x7bf,0x7bf,0x7bf,0x7bf,0x7bf,0x7bf,0x7bf,0x7bf,
+0x7bf,0x7bf,0x7bf,0x7bf,0x7bf,0x7bf,0x7bf,0x7bf,0x7bf,0xcba,0xcba,0x882,0x882,0x882,0x882,0x882,
+0x882,0x882,0x882,0x882,0x882,0x882,0x882,0x882,0x882,0x882,0x882,0x882,0x882,0x882,0x882,0x882,
+0x882,0x882,0x882,0x882,0x882,0x882,0x882,0x882,0x882,0x882,0xcba,0xa80,0xa80,0xa80,0xa80,0xa80,
+0xa80,0xa80,0xa80,0xa80,0xa80,0xa80,0xa80,0xa80,0xa80,0xa80,0xa80,0xa80,0xa80,0xa80,0xa80,0xa80,
+0xa80,0xa80,0xa80,0xa80,0xa80,0xa80,0xa80,0xa80,0xa80,0xa80,0xa80,0xa80,0xa80,0xa80,0xa80,0xa80,
+0xa80,0xa80,0xa80,0xa80,0xa80,0xa80,0xa80,0xa80,0xa80,0xa80,0xa80,0xa80,0xa80,0xa80,0xa80,0xa80,
+0xa80,0xa80,0xa80,0xa80,0xa80,0xa80,0xa80,0xa80,0xa80,0xa80,0xa80,0x23a,0x23a,0x23a,0x23a,0x23a,
+0x23a,0x23a,0x23a,0x23a,0x23a,0xc84,0xc84,0xc84,0xc84,0xc84,0xc84,0xc84,0xc84,0xc84,0xc84,0xc84,
+0xc84,0xc84,0xc84,0xc84,0xc84,0xc84,0xc84,0xc84,0xc84,0xc84,0xc84,0xc84,0xc84,0xc84,0xc84,0xc84,
+0xc84,0xc84,0xc84,0xc84,0xc84,0xc84,0xc84,0xc84,0xc84,0xc84,0xc84,0xc84,0xc84,0xc84,0xc84,0xc84,
+0xc84,0xc84,0xc84,0xc84,0xc84,0xc84,0xc84,0xc84,0xc84,0xc84,0xc84,0xc84,0xc84,0xc84,0xc84,0xc84,
+0xc84,0xc84,0xc84,0xc84,0xc84,0x7c5,0x7c5,0x7c5,0x7c5,0x7c5,0x7c5,0x7c5,0x7c5,0x7c5,0x7c5,0x7c5,
+0x7c5,0x7c5,0x7c5,0x7c5,0x7c5,0x7c5,0x7c5,0x7c5,0x7c5,0x7c5,0x7c5,0x7c5,0x7c5,0x7c5,0x7c5,0x7c5,
+0x7c5,0x7c5,0x7c5,0x7c5,0x7c5,0x7c5,0x7c5,0x7c5,0x7c5,0x7c5,0x7c5,0x7c5,0x7c5,0x7c5,0x7c5,0x7c5,
+0x7c5,0x7c5,0x7c5,0x7c5,0x7c5,0x7c5,0x7c5,0x7c5,0x7c5,0x7c5,0x7c5,0x7c5,0x7c5,0x7c5,0x7c5,0x7c5,
+0x7c5,0x7c5,0x7c5,0x7c5,0x7c5,0xddd,0xddd,0xddd,0xddd,0xddd,0xddd,0xddd,0xddd,0xddd,0xddd,0xddd,
+0xddd,0xddd,0xddd,0xddd,0xddd,0xddd,0xddd,0xddd,0xddd,0xddd,0xddd,0x104d,0x104d,0x104d,0x104d,0x11df,
+0x11df,0x11df,0x11df,0x11df,0x11df,0x11df,0x11df,0x13a4,0x1674,0x1674,0x1674,0x1674,0x1674,0x1674,0x1674,0x1674,
+0x1674,0x23d,0x23d,0x23d,0x23d,0x23d,0x23d,0x23d,0x23d,0x23d,0x23d,0x23d,0x23d,0x23d,0x23d,0x23d,
+0x23d,0x23d,0x23d,0x23d,0x23d,0x23d,0x23d,0x23d,0x23d,0x23d,0x23d,0x23d,0x23d,0x23d,0x23d,0x23d,
+0x23d,0x23d,0x23d,0x23d,0x23d,0x23d,0x23d,0x23d,0x23d,0x23d,0x23d,0xa83,0xa83,0xa83,0xa83,0xa83,
+0xa83,0xa83,0xa83,0xa83,0xa83,0xa83,0xa83,0xa83,0xa83,0xa83,0xa83,0xa83,0xa83,0xa83,0xa83,0xa83,
+0xa86,0xa83,0xa83,0xa83,0xa83,0xa83,0xa83,0xa83,0xa83,0xa83,0xa83,0xa83,0xa83,0xa83,0xa83,0xa83,
+0xa83,0xa83,0xa83,0xa83,0xa83,0xa83,0xa83,0xa83,0xa83,0xa83,0xa83,0xa83,0xa83,0xa83,0xa83,0xa83,
+0xa83,0xa83,0xa83,0xa83,0xa83,0xa83,0xa83,0xa83,0xa83,0xa83,0xa83,0xa83,0xa83,0xa83,0xa83,0xa83,
+0xa83,0xa83,0xa83,0xa83,0xa83,0xa83,0xa83,0xa83,0xa83,0xa83,0xa83,0xa83,0xa83,0xa83,0xa83,0xa83,
+0xa83,0x84,0x84,0x84,0xa89,0xa89,0xa89,0xa89,0xa89,0xa89,0xa89,0xa89,0xa89,0xa89,0xa89,0xa89,
+0xa89,0xa89,0xa89,0xa89,0xa89,0xa89,0xbc4,0xbc4,0xa89,0xa89,0xa89,0xa89,0xa89,0xa89,0xa89,0xa89,
+0xa89,0xa89,0xa89,0xa89,0xa89,0xa89,0xa89,0xa89,0xbc4,0xa89,0xa89,0xa89,0xa89,0xa89,0xa89,0xa89,
+0xa89,0xa89,0xa89,0xa89,0xbc4,0xa89,0xa89,0xa89,0xbc4,0xa89,0x87,0x87,0x87,0x87,0x87,0x87,
+0x87,0x87,0x87,0x10e9,0x10e9,0x10e9,0x10e9,0x10e9,0x10e9,0x10e9,0x10e9,0x10e9,0x10e9,0x10e9,0x10e9,0x10e9,
 0x10e9,0x10e9,0x10e9,0x10e9,0x10e9,0x10e9,0x10e9,0x10e9,0x10e9,0x10e9,0x10e9,0x10e9,0x10e9,0x10e9,0x10e9,0x10e9,
-0x10e9,0x10e9,0x10e9,0x10e9,0x10e9,0x10e9,0x10e9,0x10e9,0x10e9,0x10e9,0x10e6,0x10ec,0x10f8,0x10f8,0x10f8,0x10f8,
+0x10e9,0x10e9,0x10e9,0x10e9,0x10e9,0x10e9,0x10e9,0x10e9,0x10e9,0x10e9,0x10e9,0x10e9,0x10e9,0x10e9,0x10e9,0x10e9,
+0x10e9,0x10e6,0x10ec,0xfc9,0xfc9,0xfc9,0xfc9,0xfc9,0xfc9,0xfc9,0xfc9,0xfc9,0xfc9,0xfc9,0xfc9,0xfc9,
+0xfc9,0xfc9,0xfc9,0xfc9,0xfc9,0xfc9,0xfc9,0xfc9,0xfc9,0xfc9,0xfc9,0xfc9,0xfc9,0xfc9,0xfc9,0xfc9,
+0xfc9,0xfc9,0xfc9,0xfc9,0xfc9,0xfc9,0xfc9,0xfc9,0xfc9,0xfc9,0xfc9,0xfc9,0xfc9,0xfc9,0xfc9,0xfc9,
+0xfc9,0xfc9,0xfc9,0xfc9,0xfc9,0xfc9,0xfc9,0xfc9,0xfc9,0xfc9,0xfc9,0xfc9,0xfc9,0xfc9,0xfc9,0xfc9,
+0xfc9,0xfc9,0xfc9,0xfcc,0xfc3,0xfd2,0xfcf,0xfc9,0xfc9,0xfc9,0xfc9,0xfc9,0xfc9,0xfc9,0xfc9,0xfc9,
+0xfc9,0xfc9,0xfc9,0xfc9,0xfc9,0xfc9,0xfc9,0xfc6,0xfc6,0xfc6,0xfc6,0xfc6,0xfc6,0xfc6,0xfc6,0xfc6,
+0xfc6,0xfc9,0xfc9,0x129,0x129,0x129,0x129,0x129,0x129,0x129,0x129,0x129,0x129,0x129,0x129,0x129,
+0x129,0x129,0x129,0x129,0x129,0x129,0x129,0xfe4,0xfde,0xfe4,0xfde,0xfe4,0xfde,0xfe4,0xfde,0xfe4,
+0xfde,0xfe4,0xfde,0xfe4,0xfde,0xfe4,0xfde,0xfe4,0xfde,0xfe4,0xfde,0xfe4,0xfde,0xfe4,0xfde,0xfe4,
+0xfde,0xfe4,0xfde,0xfe4,0xfde,0xfe4,0xfde,0x126f,0x126c,0xfe4,0xfde,0xfe4,0xfde,0xfe4,0xfde,0xfe4,
+0xfde,0xfe4,0xfde,0xfe4,0xfde,0xfe1,0x105c,0xfd5,0xfd5,0xfd5,0xfdb,0x131a,0x131a,0x131a,0x131a,0x131a,
+0x131a,0x131a,0x131a,0xfd8,0xfd8,0xfdb,0xfe7,0xfe4,0xfde,0xfe4,0xfde,0xfe4,0xfde,0xfe4,0xfde,0xfe4,
+0xfde,0xfe4,0xfde,0xfe4,0xfde,0xfe4,0xfde,0xfe4,0xfde,0xfe4,0xfde,0xfe4,0xfde,0xfe4,0xfde,0x142e,
+0x142b,0x142e,0x142b,0x1431,0x1431,0x15ea,0x131a,0x10f8,0x10f8,0x10f8,0x10f8,0x10f8,0x10f8,0x10f8,0x10f8,0x10f8,
 0x10f8,0x10f8,0x10f8,0x10f8,0x10f8,0x10f8,0x10f8,0x10f8,0x10f8,0x10f8,0x10f8,0x10f8,0x10f8,0x10f8,0x10f8,0x10f8,
-0x10f8,0x10f8,0x10f8,0x10f8,0x10f8,0x10f8,0x10f8,0x10f8,0x10f8,0x10f8,0x10f8,0x10f8,0x1107,0x1107,0x1107,0x1116,
+0x10f8,0x10f8,0x10f8,0x10f8,0x10f8,0x10f8,0x10f8,0x10f8,0x10f8,0x10f8,0x10f8,0x10f8,0x10f8,0x10f8,0x10f8,0x10f8,
+0x10f8,0x10f8,0x10f8,0x10f8,0x10f8,0x10f8,0x10f8,0x10ef,0x10ef,0x10f2,0x10fb,0x10f5,0x10f5,0x10f5,0x10fb,0x156,
+0x156,0x156,0x156,0x156,0x156,0x156,0x156,0xd92,0xd92,0xd92,0xd92,0xd92,0xd92,0xd92,0xd92,0xd92,
+0xd92,0xd92,0xd92,0xd92,0xd92,0xd92,0xd92,0xd92,0xd92,0xd92,0xd92,0xd92,0xd92,0xd92,0xe4c,0xe4c,
+0xe4c,0xe4c,0xf4e,0xf4e,0xf4e,0xf4e,0xf4e,0xe91,0xe91,0xf87,0xf7e,0xf87,0xf7e,0xf87,0xf7e,0xf87,
+0xf7e,0xf87,0xf7e,0xf87,0xf7e,0xf87,0xf7e,0xf7e,0xf7e,0xf87,0xf7e,0xf87,0xf7e,0xf87,0xf7e,0xf87,
+0xf7e,0xf87,0xf7e,0xf87,0xf7e,0xf87,0xf7e,0xf87,0xf7e,0xf87,0xf7e,0xf87,0xf7e,0xf87,0xf7e,0xf87,
+0xf7e,0xf87,0xf7e,0xf87,0xf7e,0xf87,0xf7e,0xf87,0xf7e,0xf87,0xf7e,0xf87,0xf7e,0xf87,0xf7e,0xf87,
+0xf7e,0xf87,0xf7e,0xf87,0xf7e,0xf87,0xf7e,0xf87,0xf7e,0xf81,0xf7e,0xf7e,0xf7e,0xf7e,0xf7e,0xf7e,
+0xf7e,0xf7e,0xf87,0xf7e,0xf87,0xf7e,0xf87,0xf87,0xf7e,0xf87,0xf7e,0xf87,0xf7e,0xf87,0xf7e,0xf7b,
+0xf78,0xf78,0xf87,0xf7e,0x1269,0x1266,0x15e1,0x1269,0x1266,0x130b,0x1308,0x1419,0x1419,0x141f,0x1419,0x141f,
+0x1419,0x141f,0x1419,0x141f,0x1419,0x141f,0x1419,0x1269,0x1266,0x1269,0x1266,0x1269,0x1266,0x1269,0x1266,0x1269,
+0x1266,0x130b,0x141f,0x141f,0x141f,0x114,0x114,0x141f,0x141f,0x15e4,0x15e4,0x15e4,0x15de,0x15e4,0x15de,0x114,
+0x114,0x114,0x114,0x114,0x114,0x114,0x114,0x114,0x114,0x114,0x114,0x114,0x114,0x114,0x114,0x114,
+0x114,0x114,0x114,0x114,0x114,0x114,0x114,0x114,0x114,0x114,0x114,0x114,0x114,0x114,0x114,0x114,
+0x114,0x114,0x114,0x114,0x114,0x114,0x114,0x114,0x114,0x114,0x114,0x114,0x114,0x114,0x114,0x114,
+0x114,0x114,0x114,0x114,0x114,0x114,0x141c,0x130e,0x130e,0x1266,0xf84,0xf84,0xf84,0xf84,0xf84,0xdcb,
+0xdcb,0xdbc,0xdcb,0xdcb,0xdcb,0xdc2,0xdcb,0xdcb,0xdcb,0xdcb,0xdbc,0xdcb,0xdcb,0xdcb,0xdcb,0xdcb,
+0xdcb,0xdcb,0xdcb,0xdcb,0xdcb,0xdcb,0xdcb,0xdcb,0xdcb,0xdcb,0xdcb,0xdcb,0xdcb,0xdcb,0xdcb,0xdcb,
+0xdcb,0xdcb,0xdc8,0xdc8,0xdbf,0xdbf,0xdc8,0xdc5,0xdc5,0xdc5,0xdc5,0x105,0x105,0x105,0x105,0x1200,
+0x1200,0x1200,0x1200,0x1200,0x1200,0x1200,0x1200,0x1203,0x1200,0x159,0x159,0x159,0x159,0x159,0x159,0xe97,
+0xe97,0xe97,0xe97,0xe97,0xe97,0xe97,0xe97,0xe97,0xe97,0xe97,0xe97,0xe97,0xe97,0xe97,0xe97,0xe97,
+0xe97,0xe97,0xe97,0xe97,0xe97,0xe97,0xe97,0xe97,0xe97,0xe97,0xe97,0xe97,0xe97,0xe97,0xe97,0xe97,
+0xe97,0xe97,0xe97,0xe97,0xe97,0xe97,0xe97,0xe97,0xe97,0xe97,0xe97,0xe97,0xe97,0xe97,0xe97,0xe97,
+0xe97,0xe97,0xe97,0xe94,0xe94,0xe9a,0xe9a,0x117,0x117,0x117,0x117,0x117,0x117,0x117,0x117,0xff0,
+0xff0,0xff3,0xff3,0xff3,0xff3,0xff3,0xff3,0xff3,0xff3,0xff3,0xff3,0xff3,0xff3,0xff3,0xff3,0xff3,
+0xff3,0xff3,0xff3,0xff3,0xff3,0xff3,0xff3,0xff3,0xff3,0xff3,0xff3,0xff3,0xff3,0xff3,0xff3,0xff3,
+0xff3,0xff3,0xff3,0xff3,0xff3,0xff3,0xff3,0xff3,0xff3,0xff3,0xff3,0xff3,0xff3,0xff3,0xff3,0xff3,
+0xff3,0xff3,0xff3,0xff0,0xff0,0xff0,0xff0,0xff0,0xff0,0xff0,0xff0,0xff0,0xff0,0xff0,0xff0,0xfea,
+0x12c,0x12c,0x12c,0x12c,0x12c,0x12c,0x12c,0x12c,0x12c,0xff6,0xff6,0xfed,0xfed,0xfed,0xfed,0xfed,
+0xfed,0xfed,0xfed,0xfed,0xfed,0x12c,0x12c,0x12c,0x12c,0x12c,0x12c,0x10fe,0x10fe,0x10fe,0x10fe,0x10fe,
+0x10fe,0x10fe,0x10fe,0x10fe,0x10fe,0x10fe,0x10fe,0x10fe,0x10fe,0x10fe,0x10fe,0x10fe,0x10fe,0x1104,0x1215,0x1104,
+0x1104,0x1104,0x1104,0x1101,0x1101,0x1101,0x1104,0x15ed,0x15f0,0x15c,0x15c,0xfff,0xfff,0xfff,0xfff,0xfff,
+0xfff,0xfff,0xfff,0xfff,0xfff,0x1002,0x1002,0x1002,0x1002,0x1002,0x1002,0x1002,0x1002,0x1002,0x1002,0x1002,
+0x1002,0x1002,0x1002,0x1002,0x1002,0x1002,0x1002,0x1002,0x1002,0x1002,0x1002,0x1002,0x1002,0x1002,0x1002,0x1002,
+0x1002,0xff9,0xff9,0xff9,0xff9,0xff9,0xffc,0xffc,0xffc,0x1050,0x1005,0x1014,0x1014,0x1014,0x1014,0x1014,
+0x1014,0x1014,0x1014,0x1014,0x1014,0x1014,0x1014,0x1014,0x1014,0x1014,0x1014,0x1008,0x1008,0x1008,0x1008,0x1008,
+0x1008,0x1008,0x1008,0x1008,0x1008,0x1008,0x100e,0x1011,0x12f,0x12f,0x12f,0x12f,0x12f,0x12f,0x12f,0x12f,
+0x12f,0x12f,0x12f,0x100b,0x11e5,0x11e5,0x11e5,0x11e5,0x11e5,0x11e5,0x11e5,0x11e5,0x11e5,0x11e5,0x11e5,0x11e5,
+0x11e5,0x11e5,0x11e5,0x11e5,0x11e5,0x11e5,0x11e5,0x11e5,0x11e5,0x11e5,0x11e5,0x11e5,0x11e5,0x11e5,0x11e5,0x11e5,
+0x11e5,0x15f,0x15f,0x15f,0x1107,0x1107,0x1107,0x1116,0x111c,0x111c,0x111c,0x111c,0x111c,0x111c,0x111c,0x111c,
+0x111c,0x111c,0x111c,0x111c,0x111c,0x111c,0x111c,0x111c,0x111c,0x111c,0x111c,0x111c,0x111c,0x111c,0x111c,0x111c,
 0x111c,0x111c,0x111c,0x111c,0x111c,0x111c,0x111c,0x111c,0x111c,0x111c,0x111c,0x111c,0x111c,0x111c,0x111c,0x111c,
-0x111c,0x111c,0x111c,0x111c,0x111c,0x111c,0x111c,0x111c,0x111c,0x111c,0x111c,0x111c,0x111c,0x111c,0x111c,0x110a,
-0x1116,0x1116,0x1107,0x1107,0x1107,0x1107,0x1116,0x1116,0x1107,0x1116,0x1116,0x1116,0x1128,0x1128,0x1128,0x1128,
-0x1128,0x1128,0x1128,0x1128,0x1128,0x1128,0x1128,0x1128,0x1128,0x1128,0x1128,0x1128,0x112b,0x1128,0x1128,0x1128,
-0x1128,0x1128,0x1128,0x1122,0x1122,0x1122,0x1128,0x1125,0x1437,0x143a,0x143d,0x143d,0x113a,0x113a,0x113a,0x113a,
-0x113a,0x113a,0x113a,0x113a,0x113a,0x113a,0x113a,0x113a,0x113a,0x113a,0x113a,0x113a,0x112e,0x113a,0x112e,0x112e,
-0x112e,0x1143,0x1143,0x112e,0x112e,0x1143,0x113a,0x1143,0x1143,0x113a,0x112e,0x1131,0x113a,0x113a,0x113a,0x113a,
+0x111c,0x111c,0x111c,0x111c,0x111c,0x111c,0x111c,0x110a,0x1116,0x1116,0x1107,0x1107,0x1107,0x1107,0x1116,0x1116,
+0x1107,0x1116,0x1116,0x1116,0x1119,0x110d,0x110d,0x110d,0x110d,0x110d,0x110d,0x1110,0x111f,0x111f,0x110d,0x110d,
+0x110d,0x110d,0x162,0x1206,0x1113,0x1113,0x1113,0x1113,0x1113,0x1113,0x1113,0x1113,0x1113,0x1113,0x162,0x162,
+0x162,0x162,0x110d,0x110d,0x1521,0x1521,0x1521,0x1521,0x1521,0x151b,0x1524,0x1521,0x1521,0x1521,0x1521,0x1521,
+0x1521,0x1521,0x1521,0x1521,0x151e,0x151e,0x151e,0x151e,0x151e,0x151e,0x151e,0x151e,0x151e,0x151e,0x1521,0x1521,
+0x1521,0x1521,0x1521,0x1fb,0x1023,0x1023,0x1023,0x1023,0x1023,0x1023,0x1023,0x1023,0x1023,0x1023,0x1023,0x1023,
+0x1023,0x1023,0x1023,0x1023,0x1023,0x1023,0x1023,0x1023,0x1023,0x1023,0x1023,0x1023,0x1023,0x1023,0x1023,0x1023,
+0x1023,0x1023,0x1023,0x1023,0x1023,0x1023,0x1023,0x1023,0x1023,0x1023,0x1023,0x1023,0x1023,0x1017,0x1017,0x1017,
+0x1017,0x1017,0x1017,0x1020,0x1020,0x1017,0x1017,0x1020,0x1020,0x1017,0x1017,0x132,0x132,0x132,0x132,0x132,
+0x132,0x132,0x132,0x132,0x1023,0x1023,0x1023,0x1017,0x1023,0x1023,0x1023,0x1023,0x1023,0x1023,0x1023,0x1023,
+0x1017,0x1020,0x132,0x132,0x101d,0x101d,0x101d,0x101d,0x101d,0x101d,0x101d,0x101d,0x101d,0x101d,0x132,0x132,
+0x101a,0x1026,0x1026,0x1026,0x1128,0x1128,0x1128,0x1128,0x1128,0x1128,0x1128,0x1128,0x1128,0x1128,0x1128,0x1128,
+0x1128,0x1128,0x1128,0x1128,0x112b,0x1128,0x1128,0x1128,0x1128,0x1128,0x1128,0x1122,0x1122,0x1122,0x1128,0x1125,
+0x1437,0x143a,0x143d,0x143d,0x113a,0x113a,0x113a,0x113a,0x113a,0x113a,0x113a,0x113a,0x113a,0x113a,0x113a,0x113a,
+0x113a,0x113a,0x113a,0x113a,0x113a,0x113a,0x113a,0x113a,0x113a,0x113a,0x113a,0x113a,0x113a,0x113a,0x113a,0x113a,
 0x113a,0x113a,0x113a,0x113a,0x113a,0x113a,0x113a,0x113a,0x113a,0x113a,0x113a,0x113a,0x113a,0x113a,0x113a,0x113a,
-0x113a,0x113a,0x113a,0x113a,0x113a,0x113a,0x113a,0x113a,0x113a,0x113a,0x113a,0x113a,0x1155,0x1155,0x1155,0x1155,
+0x113a,0x113a,0x113a,0x113a,0x112e,0x113a,0x112e,0x112e,0x112e,0x1143,0x1143,0x112e,0x112e,0x1143,0x113a,0x1143,
+0x1143,0x113a,0x112e,0x1131,0x113d,0x1131,0x113d,0x165,0x165,0x165,0x165,0x165,0x165,0x165,0x165,0x165,
+0x165,0x165,0x165,0x165,0x165,0x165,0x165,0x165,0x165,0x165,0x165,0x165,0x165,0x165,0x165,0x113a,
+0x113a,0x1140,0x1134,0x1137,0x1356,0x1356,0x1356,0x1356,0x1356,0x1356,0x1356,0x1356,0x1356,0x1356,0x1356,0x1353,
+0x134d,0x134d,0x1353,0x1353,0x135c,0x135c,0x1356,0x1359,0x1359,0x1353,0x1350,0x1b3,0x1b3,0x1b3,0x1b3,0x1b3,
+0x1b3,0x1b3,0x1b3,0x1b3,0x192,0x1290,0x1290,0x1290,0x1290,0x1290,0x1290,0x192,0x192,0x1290,0x1290,0x1290,
+0x1290,0x1290,0x1290,0x192,0x192,0x1290,0x1290,0x1290,0x1290,0x1290,0x1290,0x192,0x192,0x192,0x192,0x192,
+0x192,0x192,0x192,0x192,0x1290,0x1290,0x1290,0x1290,0x1290,0x1290,0x1290,0x192,0x1290,0x1290,0x1290,0x1290,
+0x1290,0x1290,0x1290,0x192,0x14d0,0x14d0,0x14d0,0x14d0,0x14d0,0x14d0,0x14d0,0x14d0,0x14d0,0x14d0,0x14d0,0x14d0,
+0x14d0,0x14d0,0x14d0,0x14d0,0x14d0,0x14d0,0x14d0,0x14d0,0x14d0,0x14d0,0x14d0,0x14d0,0x14d0,0x14d0,0x14d0,0x14ca,
+0x14d3,0x14d3,0x14d3,0x14d3,0x1620,0x1620,0x1620,0x1620,0x14d0,0x14cd,0x1e6,0x1e6,0x1e6,0x1e6,0x1e6,0x1e6,
+0x1e6,0x1e6,0x1e6,0x1e6,0x164a,0x164a,0x164a,0x164a,0x164a,0x164a,0x164a,0x164a,0x164a,0x164a,0x164a,0x164a,
+0x164a,0x164a,0x164a,0x164a,0x164a,0x164a,0x164a,0x164a,0x164a,0x164a,0x164a,0x164a,0x164a,0x164a,0x164a,0x164a,
+0x164a,0x164a,0x164a,0x164a,0x164a,0x164a,0x164a,0x164a,0x164a,0x164a,0x164a,0x164a,0x164a,0x164a,0x164a,0x164a,
+0x164a,0x164a,0x164a,0x164a,0x164a,0x164a,0x164a,0x164a,0x164a,0x164a,0x164a,0x164a,0x164a,0x164a,0x164a,0x164a,
+0x164a,0x164a,0x164a,0x164a,0x1155,0x1155,0x1155,0x1155,0x1155,0x1155,0x1155,0x1155,0x1155,0x1155,0x1155,0x1155,
 0x1155,0x1155,0x1155,0x1155,0x1155,0x1155,0x1155,0x1155,0x1155,0x1155,0x1155,0x1155,0x1155,0x1155,0x1155,0x1155,
-0x1155,0x1155,0x1155,0x1155,0x1155,0x1155,0x1155,0x1155,0x1155,0x1155,0x1155,0x1155,0x116d,0x116d,0x116d,0x116d,
-0x116d,0x116d,0x116d,0x116d,0x116d,0x116d,0x116d,0x116d,0x116d,0x116d,0x116d,0x116d,0x116d,0x116d,0x116d,0x116d,
-0x116d,0x116d,0x116d,0x116d,0x116d,0x116d,0x116d,0x116d,0x116d,0x116a,0x116a,0x116a,0x1176,0x1176,0x1176,0x1176,
-0x1176,0x1176,0x1176,0x1176,0x1176,0x1176,0x1176,0x1176,0x1176,0x1176,0x1176,0x1176,0x1176,0x1176,0x1176,0x1176,
-0x1176,0x1176,0x1176,0x1176,0x1176,0x1176,0x1176,0x1176,0x1176,0x1176,0x1176,0x1176,0x1185,0x1185,0x1185,0x1185,
-0x1185,0x1185,0x1185,0x1185,0x1185,0x1185,0x1185,0x1185,0x1185,0x1185,0x1185,0x1185,0x1185,0x1185,0x1185,0x1185,
-0x1185,0x1185,0x1185,0x1185,0x1185,0x1185,0x1185,0x1185,0x1185,0x1185,0x1185,0x1185,0x11a0,0x11a0,0x11a0,0x11a0,
-0x11a0,0x11a0,0x11a0,0x11a0,0x11a0,0x11a0,0x11a0,0x11a3,0x11a0,0x11a0,0x11a0,0x11a0,0x119d,0x119d,0x119d,0x1191,
-0x1191,0x1191,0x1191,0x119d,0x119d,0x1197,0x1194,0x119a,0x119a,0x118b,0x11a6,0x11a6,0x118e,0x118e,0x119d,0x11a0,
-0x11a0,0x11a0,0x11a0,0x11a0,0x11a0,0x11a0,0x11a0,0x11a0,0x11a0,0x11a0,0x11a0,0x11a0,0x11a0,0x11a0,0x11a0,0x11a0,
-0x11a0,0x11a0,0x11a0,0x11a0,0x11a0,0x11a0,0x11a3,0x11a0,0x11a3,0x11a0,0x11a0,0x11a0,0x11a9,0x11a9,0x11a9,0x11a9,
-0x11a9,0x11a9,0x11a9,0x11a9,0x11a9,0x11a9,0x11a9,0x11a9,0x11a9,0x11a9,0x11a9,0x11a9,0x11a9,0x11a9,0x11a9,0x11a9,
-0x11a9,0x11a9,0x11a9,0x11a9,0x11a9,0x11a9,0x11a9,0x11a9,0x11a9,0x11a9,0x11a9,0x11a9,0x11af,0x11af,0x11af,0x11ac,
-0x11ac,0x11ac,0x11a9,0x11a9,0x11a9,0x11a9,0x11ac,0x11a9,0x11a9,0x11a9,0x11af,0x11ac,0x11af,0x11ac,0x11a9,0x11a9,
-0x11a9,0x11a9,0x11a9,0x11a9,0x11a9,0x11a9,0x11a9,0x11a9,0x11a9,0x11a9,0x11a9,0x11a9,0x11a9,0x11a9,0x11a9,0x11a9,
-0x11a9,0x11a9,0x11a9,0x11a9,0x11a9,0x11a9,0x11a9,0x11a9,0x11a9,0x11af,0x11ac,0x11ac,0x11a9,0x11a9,0x11a9,0x11a9,
-0x11bb,0x11bb,0x1245,0x11b8,0x1245,0x1245,0x1245,0x1245,0x11b8,0x11b8,0x11bb,0x11b8,0x11b8,0x11b8,0x11b8,0x11b8,
-0x11b8,0x11bb,0x11bb,0x11bb,0x11bb,0x11bb,0x11b8,0x11bb,0x11bb,0x11bb,0x11bb,0x11b8,0x11b8,0x11bb,0x11bb,0x11bb,
-0x12c9,0x12c9,0x11d6,0x12c9,0x12c9,0x12c9,0x11d6,0x12c9,0x12c9,0x12c9,0x11d0,0x11d0,0x11d0,0x11d0,0x11d0,0x12c3,
-0x12c6,0x12c6,0x12c6,0x12c6,0x12c6,0x12c6,0x12c6,0x11d3,0x12c6,0x12c6,0x12c6,0x12c6,0x12c6,0x12c6,0x12c6,0x11d3,
-0x11f1,0x11f1,0x11f1,0x11f1,0x11f1,0x11f1,0x11f1,0x11f1,0x11f1,0x11f1,0x11f1,0x11f1,0x11f1,0x11f1,0x11f1,0x11f1,
-0x11f1,0x11f1,0x11f1,0x11f1,0x11f1,0x11f1,0x11f1,0x11f1,0x11f1,0x11f1,0x11f1,0x11f1,0x11f1,0x11f1,0x11f1,0x11f1,
-0x128d,0x128d,0x128d,0x128d,0x128d,0x128d,0x128d,0x128d,0x128d,0x128d,0x128d,0x128d,0x128d,0x128d,0x128d,0x128d,
-0x128d,0x128d,0x128d,0x128d,0x128d,0x128d,0x128d,0x128d,0x128d,0x128d,0x128d,0x128d,0x128d,0x128d,0x128d,0x128d,
-0x12a2,0x1293,0x12a2,0x12a5,0x12a5,0x12a5,0x12a5,0x12a5,0x12a5,0x12a5,0x12a5,0x12a5,0x12a5,0x12a5,0x12a5,0x12a5,
-0x12a5,0x12a5,0x12a5,0x12a5,0x12a5,0x12a5,0x12a5,0x12a5,0x12a5,0x12a5,0x12a5,0x12a5,0x12a5,0x12a5,0x12a5,0x12a5,
-0x1293,0x1293,0x1293,0x1293,0x1293,0x1293,0x1293,0x1293,0x12ab,0x12ab,0x12ab,0x12ab,0x12ab,0x12ab,0x12ab,0x12ab,
-0x12ab,0x12ab,0x12ab,0x12ab,0x12ab,0x12ab,0x12ab,0x12ab,0x12ab,0x12ab,0x12ab,0x12ab,0x12ab,0x12ab,0x12ab,0x12ab,
-0x12ab,0x12ab,0x12ab,0x12ab,0x12ab,0x12ab,0x12ab,0x12ab,0x12b4,0x12b4,0x12b4,0x12b4,0x12b4,0x12b4,0x12b4,0x12b4,
-0x12b4,0x12b4,0x12b4,0x12b4,0x12b4,0x12b4,0x12b4,0x12b4,0x12b4,0x12b4,0x12b4,0x12b4,0x12b4,0x12b1,0x12b1,0x12b4,
-0x12b4,0x12b4,0x12b4,0x12b4,0x12b1,0x12b4,0x12b4,0x12b4,0x12b1,0x12b4,0x12b1,0x12b4,0x12b1,0x12b4,0x12b4,0x12b4,
-0x12b4,0x12b4,0x12b4,0x12b4,0x12b4,0x12b4,0x12b4,0x12b1,0x12b4,0x12b1,0x12b1,0x12b4,0x12b4,0x12b4,0x12b4,0x12b4,
-0x12b4,0x12b4,0x12b4,0x12b4,0x12b4,0x12b4,0x12b4,0x12b4,0x12b1,0x12b1,0x12b1,0x12b1,0x12b1,0x12b1,0x12b1,0x12b4,
-0x12b4,0x12b4,0x12b4,0x12b4,0x12b4,0x12b4,0x12b4,0x12b4,0x12b4,0x12b4,0x12b4,0x12b4,0x12b4,0x12b4,0x12b4,0x12b1,
-0x12b1,0x12b1,0x12b1,0x12b1,0x12b1,0x12b1,0x12b1,0x12b1,0x12b1,0x12b4,0x12b4,0x12b4,0x12b4,0x12b4,0x12b4,0x12b4,
-0x12b4,0x12b4,0x12b4,0x12b4,0x12b4,0x12b4,0x12b1,0x12b1,0x12b1,0x12b1,0x12b1,0x12b1,0x12b1,0x12b1,0x12b1,0x12b1,
-0x12b1,0x12b1,0x1449,0x1449,0x12b4,0x12b4,0x12b4,0x12b4,0x12b4,0x12b4,0x12b4,0x12b4,0x12b4,0x12b4,0x12b4,0x12b4,
-0x12b4,0x12b4,0x12b4,0x12b4,0x12b4,0x12b4,0x12b4,0x12b4,0x12b4,0x12b4,0x12b4,0x12b4,0x12b4,0x12b4,0x12b4,0x12b4,
-0x12b4,0x12b4,0x12b4,0x12b4,0x12b4,0x144c,0x144c,0x144c,0x144c,0x144c,0x144c,0x144c,0x144c,0x144c,0x144c,0x144c,
-0x144c,0x15f6,0x15f6,0x15f6,0x12b4,0x12b4,0x12b4,0x12b4,0x12b4,0x12b4,0x144c,0x12b4,0x12b4,0x12b4,0x12b4,0x12b4,
-0x12b4,0x12b4,0x12b4,0x12b4,0x12b4,0x12b4,0x12b4,0x12b4,0x12b4,0x12b4,0x12b4,0x12b4,0x12b4,0x12b4,0x12b4,0x12b4,
-0x12b4,0x12b4,0x12b4,0x12b4,0x12b4,0x12b4,0x12b4,0x12b4,0x12b4,0x144c,0x15f6,0x15f6,0x12b4,0x12b4,0x12b4,0x12b4,
-0x12b4,0x12b4,0x12b4,0x12b4,0x12b4,0x12b4,0x12b4,0x12b4,0x12b4,0x12b4,0x12b4,0x12b4,0x12b4,0x12b4,0x12b4,0x12b4,
-0x144c,0x144c,0x144c,0x144c,0x144c,0x144c,0x144c,0x144c,0x1449,0x1449,0x144c,0x144c,0x12b4,0x12b4,0x12b4,0x12b4,
-0x12b4,0x144c,0x12b4,0x12b4,0x12b4,0x12b4,0x12b4,0x144c,0x144c,0x144c,0x144c,0x15f6,0x15f6,0x15f6,0x15f6,0x15f6,
-0x144c,0x144c,0x144c,0x144c,0x144c,0x144c,0x144c,0x144c,0x144c,0x144c,0x144c,0x144c,0x12b4,0x12b4,0x12b4,0x12b4,
-0x12b4,0x12b4,0x12b4,0x12b4,0x12b4,0x12b4,0x12b4,0x12b4,0x12b4,0x12b4,0x12b4,0x12b4,0x12b4,0x144c,0x144c,0x144c,
-0x144c,0x144c,0x144c,0x144c,0x15f6,0x15f6,0x15f6,0x15f3,0x15f3,0x15f3,0x15f3,0x15f3,0x12b4,0x12b4,0x12b4,0x12b4,
-0x12b4,0x12b4,0x12b4,0x12b4,0x12b4,0x12b4,0x12b4,0x12b4,0x12b4,0x12b4,0x12b4,0x12b4,0x12b4,0x12b4,0x12b4,0x12b4,
-0x12b4,0x12b4,0x12b4,0x12b4,0x12b4,0x12b4,0x12b4,0x12b4,0x12b4,0x12b4,0x12b4,0x144c,0x12b4,0x144c,0x12b4,0x12b4,
-0x12b4,0x12b4,0x12b4,0x12b4,0x12b4,0x12b4,0x12b4,0x12b4,0x12b4,0x12b4,0x12b4,0x12b4,0x12b4,0x12b4,0x12b4,0x12b4,
-0x12b4,0x12b4,0x12b4,0x12b4,0x12b4,0x12b4,0x12b4,0x12b4,0x12b4,0x12b4,0x12b4,0x12b4,0x144c,0x12b4,0x12b4,0x12b4,
-0x12b4,0x144c,0x144c,0x15f6,0x1320,0x1320,0x1320,0x1320,0x1449,0x1449,0x1449,0x1449,0x1449,0x1449,0x144c,0x15f6,
-0x15f6,0x15f6,0x15f6,0x15f6,0x12b4,0x12b4,0x12b4,0x12b4,0x12b4,0x12b4,0x12b4,0x12b4,0x12b4,0x12b4,0x12b4,0x12b4,
-0x12b4,0x12b4,0x12b4,0x12b4,0x144c,0x144c,0x144c,0x144c,0x144c,0x144c,0x144c,0x144c,0x144c,0x144c,0x144c,0x144c,
-0x144c,0x144c,0x144c,0x144c,0x144c,0x144c,0x144c,0x144c,0x1449,0x1449,0x1449,0x1449,0x1449,0x1449,0x144c,0x12b4,
-0x12b4,0x12b4,0x12b4,0x12b4,0x1323,0x12b7,0x12b7,0x12b7,0x12b7,0x12b7,0x12b7,0x12b7,0x12b7,0x12b7,0x12b7,0x12b7,
-0x12b7,0x12b7,0x12b7,0x12b7,0x12b7,0x1323,0x12b7,0x12b7,0x12b7,0x1323,0x12b7,0x1323,0x12b7,0x1323,0x12b7,0x1323,
-0x12b7,0x12b7,0x12b7,0x1323,0x12b7,0x12b7,0x12b7,0x12b7,0x12b7,0x12b7,0x1323,0x1323,0x12b7,0x12b7,0x12b7,0x12b7,
-0x1323,0x12b7,0x1323,0x1323,0x12b7,0x12b7,0x12b7,0x12b7,0x1323,0x12b7,0x12b7,0x12b7,0x12b7,0x12b7,0x12b7,0x12b7,
-0x12b7,0x12b7,0x12b7,0x12b7,0x12b7,0x144f,0x144f,0x15f9,0x15f9,0x12b7,0x12b7,0x12b7,0x12b7,0x12b7,0x12b7,0x12b7,
-0x12b7,0x12b7,0x12b7,0x12b7,0x1539,0x1539,0x1539,0x1539,0x1539,0x1539,0x1539,0x1539,0x1539,0x1539,0x1539,0x1539,
-0x1539,0x1539,0x1539,0x1539,0x12ba,0x12ba,0x12ba,0x12ba,0x12ba,0x12ba,0x12ba,0x12ba,0x12ba,0x12ba,0x12ba,0x12ba,
-0x12ba,0x12ba,0x12ba,0x12ba,0x12ba,0x12ba,0x12ba,0x12ba,0x12ba,0x12ba,0x12ba,0x12ba,0x12ba,0x12ba,0x12ba,0x12ba,
-0x12ba,0x12ba,0x12ba,0x12ba,0x12bd,0x12bd,0x12bd,0x12bd,0x12bd,0x12bd,0x12bd,0x12bd,0x12bd,0x12bd,0x12bd,0x12bd,
-0x12bd,0x12bd,0x12bd,0x12bd,0x12bd,0x12bd,0x12bd,0x12bd,0x12bd,0x12bd,0x12bd,0x12bd,0x12bd,0x12bd,0x12bd,0x12bd,
-0x12bd,0x12bd,0x12bd,0x12bd,0x12db,0x12db,0x12db,0x12db,0x12db,0x12db,0x12db,0x12db,0x12db,0x12db,0x12db,0x12db,
-0x12db,0x12db,0x12db,0x12db,0x12db,0x12db,0x12db,0x12db,0x12db,0x12db,0x12db,0x12db,0x12db,0x12db,0x12db,0x12db,
-0x12db,0x12db,0x12db,0x12db,0x1335,0x1335,0x1335,0x1347,0x1347,0x1347,0x1347,0x1347,0x1347,0x1347,0x1347,0x1347,
-0x1347,0x1347,0x1347,0x1347,0x1347,0x1347,0x1347,0x1347,0x1347,0x1347,0x1347,0x1347,0x1347,0x1347,0x1347,0x1347,
-0x1347,0x1347,0x1347,0x1347,0x1362,0x1362,0x1362,0x1362,0x1362,0x1362,0x1362,0x1362,0x1362,0x1362,0x1362,0x1362,
-0x1362,0x1362,0x1362,0x1362,0x1362,0x1362,0x1362,0x1362,0x1362,0x1362,0x1362,0x1362,0x1362,0x1362,0x1362,0x1362,
-0x1362,0x1362,0x1362,0x1362,0x136b,0x136b,0x136b,0x136b,0x136b,0x136b,0x136b,0x136b,0x136b,0x136b,0x136b,0x136b,
-0x136b,0x136b,0x136b,0x136b,0x136b,0x136b,0x136b,0x136b,0x136b,0x136b,0x136b,0x136b,0x136b,0x136b,0x136b,0x136b,
-0x136b,0x136b,0x136b,0x136b,0x1371,0x1371,0x137d,0x1383,0x1383,0x1383,0x1383,0x1383,0x1383,0x1383,0x1383,0x1383,
-0x1383,0x1383,0x1383,0x1383,0x1383,0x1383,0x1383,0x1383,0x1383,0x1383,0x1383,0x1383,0x1383,0x1383,0x1383,0x1383,
-0x1383,0x1383,0x1383,0x1383,0x1383,0x1383,0x1383,0x137d,0x137d,0x137d,0x1371,0x1371,0x1371,0x1371,0x1371,0x1371,
-0x1371,0x1371,0x1371,0x137d,0x13a1,0x13a1,0x13a1,0x13a1,0x13a1,0x13a1,0x13a1,0x13a1,0x13a1,0x13a1,0x13a1,0x13a1,
-0x13a1,0x13a1,0x13a1,0x13a1,0x13a1,0x13a1,0x13a1,0x13a1,0x13a1,0x13a1,0x13a1,0x13a1,0x13a1,0x13a1,0x13a1,0x13a1,
-0x13a1,0x13a1,0x13a1,0x13a1,0x144c,0x144c,0x144c,0x144c,0x144c,0x144c,0x144c,0x144c,0x144c,0x144c,0x144c,0x144c,
-0x144c,0x144c,0x144c,0x144c,0x144c,0x144c,0x144c,0x144c,0x1449,0x1449,0x1449,0x1449,0x1449,0x1449,0x1449,0x1449,
-0x144c,0x144c,0x144c,0x144c,0x144c,0x144c,0x144c,0x144c,0x144c,0x144c,0x144c,0x144c,0x144c,0x144c,0x144c,0x144c,
-0x144c,0x144c,0x144c,0x144c,0x144c,0x144c,0x144c,0x144c,0x144c,0x144c,0x144c,0x144c,0x144c,0x144c,0x144c,0x144c,
-0x146d,0x146d,0x146d,0x146d,0x146d,0x146d,0x146d,0x146d,0x146d,0x146d,0x146d,0x146d,0x146d,0x146d,0x146d,0x146d,
-0x146d,0x146d,0x146d,0x146d,0x146d,0x146d,0x146d,0x146d,0x146d,0x146d,0x146d,0x146d,0x146d,0x146d,0x146d,0x146d,
-0x147f,0x147f,0x147f,0x147f,0x147f,0x147f,0x147f,0x147f,0x147f,0x147f,0x147f,0x147f,0x147f,0x147f,0x147f,0x147f,
-0x147f,0x147f,0x147f,0x147f,0x147f,0x147f,0x147f,0x147f,0x147f,0x147f,0x147f,0x147f,0x147f,0x147f,0x147f,0x147f,
-0x1485,0x1485,0x1485,0x1485,0x1485,0x1485,0x1485,0x1485,0x1485,0x1485,0x1485,0x1485,0x1485,0x1485,0x1485,0x1485,
-0x1485,0x1485,0x1485,0x1485,0x1485,0x1485,0x1485,0x1485,0x1485,0x1485,0x1485,0x1485,0x1485,0x1485,0x1485,0x1485,
-0x1488,0x1488,0x1488,0x1488,0x1488,0x1488,0x1488,0x1488,0x1488,0x1488,0x1488,0x1488,0x1488,0x1488,0x1488,0x1488,
-0x1488,0x1488,0x1488,0x1488,0x1488,0x1488,0x1488,0x1488,0x1488,0x1488,0x1488,0x1488,0x1488,0x1488,0x1488,0x1488,
-0x14c7,0x14c7,0x14c7,0x14c7,0x14c7,0x14c7,0x14c7,0x14c7,0x14c7,0x14c7,0x14c7,0x14c7,0x14c7,0x14c7,0x14c7,0x14c7,
-0x14c7,0x14c7,0x14c7,0x14c7,0x14c7,0x14c7,0x14c7,0x14c7,0x14c7,0x14c7,0x14c7,0x14c7,0x14c7,0x14c7,0x14c7,0x14b8,
-0x14d0,0x14d0,0x14d0,0x14d0,0x14d0,0x14d0,0x14d0,0x14d0,0x14d0,0x14d0,0x14d0,0x14d0,0x14d0,0x14d0,0x14d0,0x14d0,
-0x14d0,0x14d0,0x14d0,0x14d0,0x14d0,0x14d0,0x14d0,0x14d0,0x14d0,0x14d0,0x14d0,0x14ca,0x14d3,0x14d3,0x14d3,0x14d3,
-0x14d6,0x14d6,0x14d6,0x14d6,0x14d6,0x14d6,0x14d6,0x14d6,0x14d6,0x14d6,0x14d6,0x14d6,0x14d6,0x14d6,0x14d6,0x14d6,
+0x1155,0x1155,0x1155,0x1155,0x1155,0x1155,0x1155,0x114f,0x114f,0x1146,0x114f,0x114f,0x1146,0x114f,0x114f,0x1158,
+0x1152,0x1149,0x168,0x168,0x114c,0x114c,0x114c,0x114c,0x114c,0x114c,0x114c,0x114c,0x114c,0x114c,0x168,0x168,
+0x168,0x168,0x168,0x168,0x91e,0x921,0x921,0x921,0x921,0x921,0x921,0x921,0x921,0x921,0x921,0x921,
+0x921,0x921,0x921,0x921,0x921,0x921,0x921,0x921,0x921,0x921,0x921,0x921,0x921,0x921,0x921,0x921,
+0x91e,0x921,0x921,0x921,0x921,0x921,0x921,0x921,0x921,0x921,0x921,0x921,0x921,0x921,0x921,0x921,
+0x921,0x921,0x921,0x921,0x921,0x921,0x921,0x921,0x921,0x921,0x921,0x921,0x91e,0x921,0x921,0x921,
+0x921,0x921,0x921,0x921,0x921,0x921,0x921,0x921,0x921,0x921,0x921,0x921,0x921,0x921,0x921,0x921,
+0x921,0x921,0x921,0x921,0x921,0x921,0x921,0x921,0x91e,0x921,0x921,0x921,0x921,0x921,0x921,0x921,
+0x921,0x921,0x921,0x921,0x921,0x921,0x921,0x921,0x921,0x921,0x921,0x921,0x921,0x921,0x921,0x921,
+0x921,0x921,0x921,0x921,0x8a,0x8a,0x8a,0x8a,0x8a,0x8a,0x8a,0x8a,0x8a,0x8a,0x8a,0x8a,
+0x115e,0x115e,0x115e,0x115e,0x115e,0x115e,0x115e,0x115e,0x115e,0x115e,0x115e,0x115e,0x115e,0x115e,0x115e,0x115e,
+0x16b,0x16b,0x16b,0x16b,0x115b,0x115b,0x115b,0x115b,0x115b,0x115b,0x115b,0x115b,0x115b,0x115b,0x115b,0x115b,
+0x115b,0x115b,0x115b,0x115b,0x115b,0x115b,0x115b,0x115b,0x115b,0x115b,0x115b,0x115b,0x115b,0x115b,0x115b,0x115b,
+0x115b,0x115b,0x115b,0x115b,0x115b,0x115b,0x115b,0x115b,0x115b,0x115b,0x115b,0x115b,0x115b,0x115b,0x115b,0x115b,
+0x115b,0x115b,0x115b,0x115b,0x115b,0x16b,0x16b,0x16b,0x16b,0x909,0x909,0x909,0x909,0x909,0x909,0x909,
+0x909,0x909,0x909,0x909,0x909,0x909,0x909,0x909,0x909,0x909,0x909,0x909,0x909,0x909,0x909,0x909,
+0x909,0x909,0x909,0x909,0x909,0x909,0x909,0x909,0x909,0x909,0x909,0x909,0x909,0x909,0x909,0x909,
+0x909,0x909,0x909,0x909,0x909,0x909,0x909,0x909,0x909,0x909,0x909,0x909,0x909,0x909,0x909,0x909,
+0x909,0x909,0x909,0x909,0x909,0x909,0x909,0x909,0x909,0x90c,0x90c,0x90c,0x90c,0x90c,0x90c,0x90c,
+0x90c,0x90c,0x90c,0x90c,0x90c,0x90c,0x90c,0x90c,0x90c,0x90c,0x90c,0x90c,0x90c,0x90c,0x90c,0x90c,
+0x90c,0x90c,0x90c,0x90c,0x90c,0x90c,0x90c,0x90c,0x90c,0x90c,0x90c,0x90c,0x90c,0x90c,0x90c,0x90c,
+0x90c,0x90c,0x90c,0x90c,0x90c,0x90c,0x90c,0x90c,0x90c,0x90c,0x90c,0x90c,0x90c,0x90c,0x90c,0x90c,
+0x90c,0x90c,0x90c,0x90c,0x90c,0x90c,0x90c,0x90c,0x90c,0x90f,0x90f,0x90f,0x90f,0x90f,0x90f,0x90f,
+0x90f,0x90f,0x90f,0x90f,0x90f,0x90f,0x90f,0x90f,0x90f,0x90f,0x90f,0x90f,0x90f,0x90f,0x90f,0x90f,
+0x90f,0x90f,0x90f,0x90f,0x90f,0x90f,0x90f,0x90f,0x90f,0x90f,0x90f,0x90f,0x90f,0x90f,0x90f,0x90f,
+0x90f,0x90f,0x90f,0x90f,0x90f,0x90f,0x90f,0x90f,0x90f,0x90f,0x90f,0x90f,0x90f,0x90f,0x90f,0x90f,
+0x90f,0x90f,0x90f,0x90f,0x90f,0x90f,0x90f,0x90f,0x90f,0x6ae,0x6ae,0x6ae,0x6ae,0x6ae,0x6ae,0x6ae,
+0x6ae,0x6ae,0x6ae,0x6ae,0x6ae,0x6ae,0x6ae,0x6ae,0x6ae,0x6ae,0x6ae,0x6ae,0x6ae,0x6ae,0x6ae,0x6ae,
+0x6ae,0x6ae,0x6ae,0x6ae,0x6ae,0x6ae,0x6ae,0x6ae,0x6ae,0x6ae,0x6ae,0x6ae,0x6ae,0x6ae,0x6ae,0x6ae,
+0x6ae,0x6ae,0x6ae,0x6ae,0x6ae,0x6ae,0x6ae,0x6ae,0x6ae,0x6ae,0x6ae,0x6ae,0x6ae,0x6ae,0x6ae,0x6ae,
+0x6ae,0x6ae,0x6ae,0x6ae,0x6ae,0x6ae,0x6ae,0x6ae,0x6ae,0x7c8,0x7c8,0x7c8,0x7c8,0x7c8,0x7c8,0x7c8,
+0x7c8,0x7c8,0x7c8,0x7c8,0x7c8,0x7c8,0x7c8,0x7c8,0x7c8,0x7c8,0x7c8,0x7c8,0x7c8,0x7c8,0x7c8,0x7c8,
+0x7c8,0x7c8,0x7c8,0x7c8,0x7c8,0x7c8,0x7c8,0x7c8,0x7c8,0x7c8,0x7c8,0x7c8,0x7c8,0x7c8,0x7c8,0x7c8,
+0x7c8,0x7c8,0x7c8,0x7c8,0x7c8,0x7c8,0x7c8,0x7c8,0x7c8,0x7c8,0x7c8,0x7c8,0x7c8,0x7c8,0x7c8,0x7c8,
+0x7c8,0x7c8,0x7c8,0x7c8,0x7c8,0x7c8,0x7c8,0x7c8,0x7c8,0x7cb,0x7cb,0x7c8,0x7cb,0x7c8,0x7cb,0x7cb,
+0x7c8,0x7c8,0x7c8,0x7c8,0x7c8,0x7c8,0x7c8,0x7c8,0x7c8,0x7c8,0x7cb,0x7c8,0x7cb,0x7c8,0x7cb,0x7cb,
+0x7c8,0x7c8,0x7cb,0x7cb,0x7cb,0x7c8,0x7c8,0x7c8,0x7c8,0x13a7,0x13a7,0xbc7,0xbc7,0xbc7,0xbc7,0xbc7,
+0xbc7,0xbc7,0xbc7,0xbc7,0xbc7,0xbc7,0xbc7,0xbc7,0xbc7,0xbc7,0xbc7,0xbc7,0xbc7,0xbc7,0xbc7,0xbc7,
+0xbc7,0xbc7,0xbc7,0xbc7,0xbc7,0xbc7,0xbc7,0xbc7,0xbc7,0xbc7,0xbc7,0xbc7,0xbc7,0xbc7,0xbc7,0xbc7,
+0xbc7,0xbc7,0xbc7,0xbc7,0xbc7,0xbc7,0x11e2,0x11e2,0x11e2,0x240,0x240,0xde0,0xde0,0xde0,0xde0,0xde0,
+0xde0,0xde0,0xde0,0xde0,0xde0,0xde0,0xde0,0xde0,0xde0,0xde0,0xde0,0xde0,0xde0,0xde0,0xde0,0xde0,
+0xde0,0xde0,0xde0,0xde0,0xde0,0xde0,0xde0,0xde0,0xde0,0xde0,0xde0,0xde0,0xde0,0xde0,0xde0,0xde0,
+0xde0,0xde0,0xde0,0xde0,0xde0,0xde0,0xde0,0xde0,0xde0,0xde0,0xde0,0xde0,0xde0,0xde0,0xde0,0xde0,
+0xde0,0xde0,0xde0,0xde0,0xde0,0xde0,0xde0,0xde0,0xde0,0xde0,0xde0,0x240,0x240,0x240,0x240,0x240,
+0x240,0x240,0x240,0x240,0x240,0x240,0x240,0x240,0x240,0x240,0x240,0x240,0x240,0x240,0x240,0x240,
+0x240,0x240,0x240,0x240,0x240,0x240,0x240,0x240,0x240,0x240,0x240,0x240,0x240,0x240,0x240,0x240,
+0x240,0x579,0x579,0x579,0x579,0x579,0x579,0x579,0x8d,0x8d,0x8d,0x8d,0x8d,0x8d,0x8d,0x8d,
+0x8d,0x8d,0x8d,0x8d,0x567,0x567,0x567,0x567,0x567,0x8d,0x8d,0x8d,0x8d,0x8d,0xa5c,0x56a,
+0x570,0x576,0x576,0x576,0x576,0x576,0x576,0x576,0x576,0x576,0x56d,0x570,0x570,0x570,0x570,0x570,
+0x570,0x570,0x570,0x570,0x570,0x570,0x570,0x570,0x8d,0x570,0x570,0x570,0x570,0x570,0x8d,0x570,
+0x8d,0x570,0x570,0x8d,0x570,0x570,0x8d,0x570,0x570,0x570,0x570,0x570,0x570,0x570,0x570,0x570,
+0x573,0x58b,0x585,0x58b,0x585,0x588,0x58e,0x58b,0x585,0x588,0x58e,0x58b,0x585,0x588,0x58e,0x58b,
+0x585,0x588,0x58e,0x58b,0x585,0x588,0x58e,0x58b,0x585,0x588,0x58e,0x58b,0x585,0x588,0x58e,0x58b,
+0x585,0x588,0x58e,0x58b,0x585,0x588,0x58e,0x58b,0x585,0x588,0x58e,0x58b,0x585,0x588,0x58e,0x58b,
+0x585,0x58b,0x585,0x58b,0x585,0x58b,0x585,0x58b,0x585,0x58b,0x585,0x58b,0x585,0x588,0x58e,0x58b,
+0x585,0x588,0x58e,0x58b,0x585,0x588,0x58e,0x58b,0x585,0x588,0x58e,0x58b,0x585,0x58b,0x585,0x588,
+0x58e,0x58b,0x585,0x58b,0x585,0x588,0x58e,0x58b,0x585,0x588,0x58e,0x58b,0x585,0x58b,0x585,0x1251,
+0x1251,0x1251,0x1251,0x1251,0x1251,0x1251,0x1251,0x1251,0x1251,0x1251,0x1251,0x1251,0x1251,0x90,0x90,0x90,
+0x90,0x90,0x90,0x90,0x90,0x90,0x90,0x90,0x90,0x90,0x90,0x90,0x90,0x90,0x58b,0x585,
+0x588,0x58e,0x58b,0x585,0x58b,0x585,0x58b,0x585,0x58b,0x58b,0x585,0x58b,0x585,0x58b,0x585,0x58b,
+0x585,0x588,0x58e,0x588,0x58e,0x58b,0x585,0x58b,0x585,0x58b,0x585,0x58b,0x585,0x58b,0x585,0x58b,
+0x585,0x58b,0x585,0x588,0x58b,0x585,0x588,0x58b,0x585,0x588,0x58e,0x58b,0x58b,0x58b,0x58b,0x58b,
+0x58b,0x58b,0x58b,0x58b,0x58b,0x58b,0x58b,0x58b,0x58b,0x58b,0x58b,0x58b,0x58b,0x58b,0x58b,0x58b,
+0x58b,0x58b,0x58b,0x58b,0x58b,0x58b,0x58b,0x58b,0x58b,0x58b,0x58b,0x58b,0x58b,0x58b,0x58b,0x58b,
+0x58b,0x58b,0x58b,0x58b,0x58b,0x58b,0x58b,0x58b,0x58b,0x58b,0x58b,0x58b,0x58b,0x58b,0x58b,0x58b,
+0x58b,0x58b,0x58b,0x58b,0x58b,0x58b,0x58b,0x58b,0x58b,0x58b,0x58b,0x582,0x582,0x582,0x582,0x582,
+0x582,0x585,0x585,0x585,0x585,0x585,0x585,0x585,0x585,0x585,0x585,0x585,0x585,0x585,0x585,0x585,
+0x585,0x585,0x585,0x585,0x585,0x585,0x585,0x585,0x585,0x585,0x585,0x585,0x585,0x588,0x588,0x588,
+0x588,0x588,0x588,0x588,0x588,0x588,0x588,0x588,0x588,0x588,0x588,0x588,0x588,0x588,0x588,0x588,
+0x588,0x588,0x588,0x588,0x588,0x588,0x588,0x588,0x588,0x588,0x588,0x588,0x588,0x588,0x588,0x588,
+0x588,0x588,0x588,0x588,0x588,0x588,0x58e,0x58e,0x58e,0x58e,0x58e,0x58e,0x58e,0x58e,0x58e,0x58e,
+0x58e,0x58e,0x58e,0x58e,0x58e,0x58e,0x58e,0x58e,0x58e,0x58e,0x58e,0x58e,0x58b,0x58b,0x58b,0x58b,
+0x58b,0x58b,0x58b,0x58b,0x58b,0x58b,0x58b,0x58b,0x58b,0x58b,0x58b,0x58b,0x58b,0x585,0x585,0x585,
+0x585,0x585,0x585,0x585,0x585,0x585,0x585,0x585,0x585,0x585,0x585,0x585,0x585,0x585,0x585,0x585,
+0x585,0x585,0x585,0x585,0x585,0x585,0x585,0x585,0x585,0x588,0x588,0x588,0x588,0x588,0x588,0x588,
+0x58e,0x58e,0x58e,0x58e,0x58e,0x58e,0x58e,0x58e,0x585,0x58b,0x57c,0x57f,0x90,0x90,0x90,0x90,
+0x90,0x90,0x90,0x90,0x90,0x90,0x90,0x90,0x90,0x90,0x90,0x90,0x588,0x585,0x588,0x588,
+0x588,0x588,0x588,0x588,0x585,0x588,0x585,0x585,0x588,0x588,0x585,0x585,0x588,0x588,0x585,0x588,
+0x585,0x588,0x585,0x585,0x588,0x585,0x585,0x588,0x585,0x588,0x585,0x585,0x588,0x585,0x588,0x588,
+0x585,0x585,0x585,0x588,0x585,0x585,0x585,0x585,0x585,0x588,0x585,0x585,0x588,0x585,0x588,0x588,
+0x588,0x585,0x588,0x588,0x588,0x588,0x90,0x90,0x588,0x588,0x588,0x588,0x585,0x585,0x588,0x585,
+0x585,0x585,0x585,0x588,0x585,0x585,0x585,0x585,0x585,0x585,0x585,0x585,0x585,0x585,0x585,0x585,
+0x585,0x585,0x585,0x585,0x585,0x585,0x585,0x585,0x585,0x585,0x588,0x588,0x585,0x585,0x588,0x585,
+0x588,0x585,0x585,0x585,0x585,0x585,0x588,0x588,0x588,0x585,0x585,0x90,0x90,0x90,0x90,0x90,
+0x90,0x90,0x90,0xaa4,0xaa4,0xaa4,0xaa4,0xaa4,0xaa4,0xaa4,0xaa4,0xaa4,0xaa4,0xaa4,0xaa4,0xaa4,
+0xaa4,0xaa4,0xaa4,0xaa4,0xaa4,0xaa4,0xaa4,0xaa4,0xaa4,0xaa4,0xaa4,0xaa4,0xaa4,0xaa4,0xaa4,0xaa4,
+0xaa4,0xaa4,0xaa4,0x58b,0x58b,0x8be,0x58b,0x58b,0x58b,0x58b,0x58b,0x58b,0x58b,0x582,0x582,0xb55,
+0xcc9,0x90,0x90,0xba0,0xba0,0xba0,0xba0,0xba0,0xba0,0xba0,0xba0,0xba0,0xba0,0xba0,0xba0,0xba0,
+0xba0,0xba0,0xba0,0xdf8,0xde9,0xde3,0xdf5,0xdf2,0xdec,0xdec,0xdfb,0xde6,0xdef,0x10b,0x10b,0x10b,
+0x10b,0x10b,0x10b,0x591,0x591,0x591,0x591,0xf2a,0xf2a,0xf2a,0x13ec,0x13ec,0x13ec,0x13ec,0x13ec,0x13ec,
+0x13ec,0x15d5,0x15d5,0x7d4,0x7da,0x7da,0x7e6,0x7e6,0x7d7,0x7ce,0x7d7,0x7ce,0x7d7,0x7ce,0x7d7,0x7ce,
+0x7d7,0x7ce,0x7d7,0x7ce,0x7e0,0x7dd,0x7e0,0x7dd,0xbd9,0xbd9,0xcc0,0xcbd,0x7d1,0x7d1,0x7d1,0x7d1,
+0x7e3,0x7e3,0x7e3,0x7fb,0x7fe,0x80d,0x93,0x801,0x804,0x810,0x810,0x7f8,0x7ef,0x7e9,0x7ef,0x7e9,
+0x7ef,0x7e9,0x7ec,0x7ec,0x807,0x807,0x80a,0x807,0x807,0x807,0x93,0x807,0x7f5,0x7f2,0x7ec,0x93,
+0x93,0x93,0x93,0x597,0x5a3,0x597,0xb58,0x597,0x96,0x597,0x5a3,0x597,0x5a3,0x597,0x5a3,0x597,
+0x5a3,0x597,0x5a3,0x5a0,0x5a0,0x59a,0x5a0,0x59a,0x5a0,0x59a,0x5a0,0x59a,0x5a0,0x59a,0x59d,0x5a3,
+0x5a0,0x59a,0x5a0,0x59a,0x59d,0x5a3,0x5a0,0x59a,0x5a0,0x59a,0x59d,0x5a3,0x5a0,0x59a,0x59d,0x5a3,
+0x5a0,0x59a,0x59d,0x5a3,0x5a0,0x59a,0x59d,0x5a3,0x5a0,0x59a,0x59d,0x5a3,0x5a0,0x59a,0x5a0,0x59a,
+0x5a0,0x59a,0x5a0,0x59a,0x5a0,0x59a,0x59d,0x5a3,0x5a0,0x59a,0x59d,0x5a3,0x5a0,0x59a,0x59d,0x5a3,
+0x5a0,0x59a,0x59d,0x5a3,0x5a0,0x59a,0x59d,0x5a3,0x5a0,0x59a,0x59d,0x5a3,0x5a0,0x59a,0x59d,0x5a3,
+0x5a0,0x59a,0x59d,0x5a3,0x5a0,0x59a,0x59d,0x5a3,0x5a0,0x59a,0x59d,0x5a3,0x5a0,0x59a,0x59d,0x5a3,
+0x5a0,0x59a,0x59d,0x5a3,0x5a0,0x59a,0x5a0,0x59a,0x5a0,0x59a,0x59d,0x5a3,0x5a0,0x59a,0x5a0,0x59a,
+0x5a0,0x59a,0x5a0,0x59a,0x96,0x96,0x594,0x9c,0x6ff,0x6de,0x6cf,0x6d8,0x6d5,0x6cf,0x6e1,0x6d2,
+0x6cc,0x6cf,0x6ed,0x6e4,0x6db,0x6fc,0x6cf,0x6f9,0x6f9,0x6f9,0x6f9,0x6f9,0x6f9,0x6f9,0x6f9,0x6f9,
+0x6f9,0x6ea,0x6e7,0x6ed,0x6ed,0x6ed,0x6ff,0x6cf,0x70b,0x70b,0x70b,0x70b,0x70b,0x70b,0x705,0x705,
+0x705,0x705,0x705,0x705,0x705,0x705,0x705,0x705,0x705,0x705,0x705,0x705,0x705,0x705,0x705,0x705,
+0x705,0x705,0x6d2,0x6ed,0x6cc,0x6f3,0x6f6,0x6f0,0x708,0x708,0x708,0x708,0x708,0x708,0x702,0x702,
+0x702,0x702,0x702,0x702,0x702,0x702,0x702,0x702,0x702,0x702,0x702,0x702,0x702,0x702,0x702,0x702,
+0x702,0x702,0x6d2,0x6ed,0x6cc,0x6ed,0xba6,0xba3,0x837,0x831,0x82e,0x834,0x82b,0x6c3,0x6c6,0x6c6,
+0x6c6,0x6c6,0x6c6,0x6c6,0x6c6,0x6c6,0x6c6,0x83d,0x6c3,0x6c3,0x6c3,0x6c3,0x6c3,0x6c3,0x6c3,0x6c3,
+0x6c3,0x6c3,0x6c3,0x6c3,0x6c3,0x6c3,0x6c3,0x6c3,0x6c3,0x6c3,0x6c3,0x6c3,0x6c3,0x6c3,0x6c3,0x6c3,
+0x6c3,0x6c3,0x6c3,0x6c3,0x6c3,0x6c3,0x83a,0x83a,0x6c0,0x6bd,0x6bd,0x6bd,0x6bd,0x6bd,0x6bd,0x6bd,
+0x6bd,0x6bd,0x6bd,0x6bd,0x6bd,0x6bd,0x6bd,0x6bd,0x6bd,0x6bd,0x6bd,0x6bd,0x6bd,0x6bd,0x6bd,0x6bd,
+0x6bd,0x6bd,0x6bd,0x6bd,0x6bd,0x6bd,0x6bd,0x9c,0x9c,0x6bd,0x6bd,0x6bd,0x6bd,0x6bd,0x6bd,0x9c,
+0x9c,0x6bd,0x6bd,0x6bd,0x6bd,0x6bd,0x6bd,0x9c,0x9c,0x6bd,0x6bd,0x6bd,0x6bd,0x6bd,0x6bd,0x9c,
+0x9c,0x6bd,0x6bd,0x6bd,0x9c,0x9c,0x9c,0x6d5,0x6d8,0x6ed,0x6f0,0x6cf,0x6d8,0x6d8,0x9c,0x6b7,
+0x6ba,0x6ba,0x6ba,0x6ba,0x6b7,0x6b7,0x9c,0x99,0x99,0x99,0x99,0x99,0x99,0x99,0x99,0x99,
+0xa5f,0xa5f,0xa5f,0x924,0x6b1,0x5a6,0x5a6,0xc87,0xc87,0xc87,0xc87,0xc87,0xc87,0xc87,0xc87,0xc87,
+0xc87,0xc87,0xc87,0xc6,0xc87,0xc87,0xc87,0xc87,0xc87,0xc87,0xc87,0xc87,0xc87,0xc87,0xc87,0xc87,
+0xc87,0xc87,0xc87,0xc87,0xc6,0xc87,0xc87,0xc6,0xc87,0xc87,0xc87,0xc87,0xc87,0xc87,0xc87,0xc87,
+0xc87,0xc87,0xc87,0xc87,0xc87,0xc87,0xc6,0xc6,0xc6,0xc6,0xc6,0xc6,0xc6,0xc6,0xc6,0xc6,
+0xc6,0xc6,0xc6,0xc6,0xc6,0xc6,0xc8a,0xc8a,0xc8a,0xc8a,0xc8a,0xc8a,0xc8a,0xc8a,0xc8a,0xc8a,
+0xc8a,0xc8a,0xc8a,0xc8a,0xc8a,0xc8a,0xc9,0xc9,0xc9,0xc9,0xc9,0xcc6,0xcc6,0xcc6,0xcc,0xcc,
+0xcc,0xcc,0xcc3,0xcc3,0xcc3,0xcc3,0xcc3,0xcc3,0xcc3,0xcc3,0xcc3,0xcc3,0xcc3,0xcc3,0xcc3,0xcc3,
+0xcc3,0xcc3,0xcc,0xcc,0xcc,0xcc3,0xcc3,0xcc3,0xcc3,0xcc3,0xcc3,0xcc3,0xcc3,0xcc3,0xd47,0xd47,
+0xd47,0xd47,0xd47,0xd47,0xd47,0xd47,0xd47,0xd47,0xd47,0xd47,0xd47,0xd47,0xd47,0xd47,0xd44,0xd44,
+0xd44,0xd44,0xd44,0xd44,0xd44,0xd44,0xd44,0xd44,0xd44,0x13fe,0x13fe,0xde,0xde,0xde,0x1029,0x1029,
+0x1029,0x1029,0x1029,0x1029,0x1029,0x1029,0x1029,0x1029,0x1029,0x1029,0x135,0x135,0x135,0x135,0x1434,0x135,
+0x135,0x135,0x135,0x135,0x135,0x135,0x135,0x135,0x135,0x135,0x135,0x135,0x135,0x135,0x135,0x102c,
+0x102c,0x102c,0x102c,0x102c,0x102c,0x102c,0x102c,0x102c,0x102c,0x102c,0x102c,0x102c,0x102c,0x102c,0x102c,0x102f,
+0x138,0x138,0x1032,0x1032,0x1032,0x1032,0x1032,0x1032,0x1032,0x1032,0x1032,0x1032,0x1032,0x1032,0x1032,0x1032,
+0x1032,0x1032,0x13b,0x13b,0x13b,0x1035,0x1035,0x1035,0x1035,0x1035,0x1035,0x1035,0x1035,0x1035,0x1035,0x1035,
+0x1035,0x1035,0x1035,0x1035,0x1035,0x13e,0x13e,0x13e,0x13e,0x13e,0x13e,0x13e,0x13e,0x13e,0x13e,0x13e,
+0x13e,0x13e,0x13e,0x13e,0x15bd,0x15b4,0x15b4,0x15b4,0x15b4,0x15b4,0x15b4,0x15b4,0x15b4,0x15b4,0x15b4,0x15b4,
+0x15b4,0x15b4,0x15b4,0x15b4,0x1ce,0x1ce,0x1ce,0x1ce,0xaaa,0xaaa,0xaaa,0xaaa,0xaaa,0xaaa,0xaaa,0xaaa,
+0xaaa,0xaaa,0xaaa,0xaaa,0xaaa,0xaaa,0xaaa,0xaaa,0x13ef,0xaa7,0xaa7,0xaa7,0xaa7,0x9f,0x9f,0x9f,
+0x9f,0x9f,0x9f,0x9f,0x9f,0x9f,0x9f,0x9f,0x9f,0xaad,0xaad,0xaad,0xaad,0xaad,0xaad,0xaad,
+0xaad,0xaad,0xaad,0xaad,0xaad,0xaad,0xaad,0xaad,0xaad,0xa2,0xa2,0xa2,0xa2,0xa2,0x1536,0x1536,
+0x1536,0x1536,0x1536,0x1536,0x1536,0x1536,0x1536,0x1536,0x1536,0x1536,0x1536,0x1536,0x1536,0x1536,0x1533,0x1533,
+0x1533,0x1533,0x1533,0x201,0x201,0x201,0x201,0x201,0xc90,0xc90,0xc90,0xc90,0xc90,0xc90,0xc90,0xc90,
+0xc90,0xc90,0xc90,0xc90,0xc90,0xc90,0xc90,0xc90,0xcf,0xc8d,0xda4,0xda4,0xda4,0xda4,0xda4,0xda4,
+0xda4,0xda4,0xda4,0xda4,0xda4,0xda4,0xda4,0xda4,0xda4,0xda4,0xff,0xff,0xff,0xff,0xda4,0xda4,
+0xda4,0xda4,0xda4,0xda4,0xda4,0xda4,0xda1,0xda4,0xda4,0xda4,0xda4,0xda4,0xff,0xff,0xff,0xff,
+0xff,0xff,0xff,0xff,0xff,0xff,0xab3,0xab3,0xab3,0xab3,0xab3,0xab3,0xab3,0xab3,0xab3,0xab3,
+0xab3,0xab3,0xab3,0xab3,0xab3,0xab3,0xc48,0xc48,0xab0,0xab0,0xab0,0xab0,0xab0,0xab0,0xab0,0xab0,
+0xab0,0xab0,0xab0,0xab0,0xab0,0xab0,0xab0,0xab0,0xc45,0xc45,0xc93,0xc93,0xc93,0xc93,0xc93,0xc93,
+0xc93,0xc93,0xc93,0xc93,0xc93,0xc93,0xc93,0xc93,0xc93,0xc93,0xc99,0xc99,0xc99,0xc99,0xc99,0xc99,
+0xc99,0xc99,0xc99,0xc99,0xc99,0xc99,0xc99,0xc99,0xc99,0xc99,0xd2,0xd2,0xc96,0xc96,0xc96,0xc96,
+0xc96,0xc96,0xc96,0xc96,0xc96,0xc96,0xd2,0xd2,0xd2,0xd2,0xd2,0xd2,0x1485,0x1485,0x1485,0x1485,
+0x1485,0x1485,0x1485,0x1485,0x1485,0x1485,0x1485,0x1485,0x1485,0x1485,0x1485,0x1485,0x1d7,0x1d7,0x1d7,0x1d7,
+0x1d7,0x1d7,0x1d7,0x1d7,0x146d,0x146d,0x146d,0x146d,0x146d,0x146d,0x146d,0x146d,0x146d,0x146d,0x146d,0x146d,
+0x146d,0x146d,0x146d,0x146d,0x1cb,0x1cb,0x1cb,0x1cb,0x1cb,0x1cb,0x1cb,0x1cb,0x1cb,0x1cb,0x1cb,0x146a,
 0x14d6,0x14d6,0x14d6,0x14d6,0x14d6,0x14d6,0x14d6,0x14d6,0x14d6,0x14d6,0x14d6,0x14d6,0x14d6,0x14d6,0x14d6,0x14d6,
-0x14f1,0x14f1,0x14f1,0x14f1,0x14f1,0x14f1,0x14f1,0x14f1,0x14e8,0x14f1,0x14f1,0x14f1,0x14f1,0x14f1,0x14f1,0x14f1,
+0x1e9,0x1e9,0x1e9,0x1e9,0x1e9,0x1e9,0x1e9,0x1e9,0x1e9,0x1e9,0x1e9,0x1e9,0x1e9,0x1e9,0x1e9,0x1e9,
+0xc9c,0xc9c,0xc9c,0xc9c,0xc9c,0xc9c,0xd5,0xd5,0xc9c,0xd5,0xc9c,0xc9c,0xc9c,0xc9c,0xc9c,0xc9c,
+0xc9c,0xc9c,0xc9c,0xc9c,0xc9c,0xc9c,0xc9c,0xc9c,0xc9c,0xc9c,0xd5,0xc9c,0xc9c,0xd5,0xd5,0xd5,
+0xc9c,0xd5,0xd5,0xc9c,0x1167,0x1167,0x1167,0x1167,0x1167,0x1167,0x1167,0x1167,0x1167,0x1167,0x1167,0x1167,
+0x1167,0x1167,0x1167,0x1167,0x16e,0x1164,0x1161,0x1161,0x1161,0x1161,0x1161,0x1161,0x1161,0x1161,0x155a,0x155a,
+0x155a,0x155a,0x155a,0x155a,0x155a,0x155a,0x155a,0x155a,0x155a,0x155a,0x155a,0x155a,0x155a,0x155a,0x1557,0x1557,
+0x1557,0x1557,0x1557,0x1557,0x1557,0x1557,0x1557,0x152a,0x152a,0x152a,0x152a,0x152a,0x152a,0x152a,0x152a,0x152a,
+0x152a,0x152a,0x152a,0x152a,0x152a,0x152a,0x152a,0x1fe,0x1fe,0x1fe,0x1fe,0x1fe,0x1fe,0x1fe,0x1527,0x1527,
+0x1527,0x1527,0x1527,0x1527,0x1527,0x1527,0x1527,0x1653,0x1653,0x1653,0x1653,0x1653,0x1653,0x1653,0x1653,0x1653,
+0x1653,0x1653,0x1653,0x1653,0x1653,0x1653,0x1653,0x228,0x1653,0x1653,0x228,0x228,0x228,0x228,0x228,0x1650,
+0x1650,0x1650,0x1650,0x1650,0xea3,0xea3,0xea3,0xea3,0xea3,0xea3,0xea3,0xea3,0xea3,0xea3,0xea3,0xea3,
+0xea3,0xea3,0xea3,0xea3,0xe9d,0xe9d,0xe9d,0xe9d,0x10b0,0x10b0,0x11a,0x11a,0x11a,0xea0,0x103b,0x103b,
+0x103b,0x103b,0x103b,0x103b,0x103b,0x103b,0x103b,0x103b,0x103b,0x103b,0x103b,0x103b,0x103b,0x103b,0x141,0x141,
+0x141,0x141,0x141,0x1038,0x1362,0x1362,0x1362,0x1362,0x1362,0x1362,0x1362,0x1362,0x1362,0x1362,0x1362,0x1362,
+0x1362,0x1362,0x1362,0x1362,0x135f,0x135f,0x135f,0x135f,0x135f,0x135f,0x135f,0x135f,0x135f,0x135f,0x135f,0x135f,
+0x135f,0x135f,0x135f,0x135f,0x1b6,0x1b6,0x1b6,0x1b6,0x1605,0x1605,0x135f,0x135f,0x1605,0x1605,0x1605,0x1605,
+0x1605,0x1605,0x1605,0x1605,0x1605,0x1605,0x1605,0x1605,0x1605,0x1605,0x1605,0x1605,0x1b6,0x1b6,0x1605,0x1605,
+0x1605,0x1605,0x1605,0x1605,0x1605,0x1605,0x1605,0x1605,0x1605,0x1605,0x1605,0x1605,0xd8c,0xd80,0xd80,0xd80,
+0xf9,0xd80,0xd80,0xf9,0xf9,0xf9,0xf9,0xf9,0xd80,0xd80,0xd80,0xd80,0xd8c,0xd8c,0xd8c,0xd8c,
+0xf9,0xd8c,0xd8c,0xd8c,0xf9,0xd8c,0xd8c,0xd8c,0xd8c,0xd8c,0xd8c,0xd8c,0xd8c,0xd8c,0xd8c,0xd8c,
+0xd8c,0xd8c,0xd8c,0xd8c,0xd8c,0xf9,0xf9,0xf9,0xf9,0xd7d,0xd7d,0xd7d,0xf9,0xf9,0xf9,0xf9,
+0xd83,0xd86,0xd86,0xd86,0xd86,0xd86,0xd86,0xd86,0xd86,0xf9,0xf9,0xf9,0xf9,0xf9,0xf9,0xf9,
+0xf9,0xd89,0xd89,0xd89,0xd89,0xd89,0xd89,0xd8f,0xd8f,0xd86,0xf9,0xf9,0xf9,0xf9,0xf9,0xf9,
+0xf9,0x116d,0x116d,0x116d,0x116d,0x116d,0x116d,0x116d,0x116d,0x116d,0x116d,0x116d,0x116d,0x116d,0x116d,0x116d,
+0x116d,0x116a,0x116a,0x116a,0x1530,0x1530,0x1530,0x1530,0x1530,0x1530,0x1530,0x1530,0x1530,0x1530,0x1530,0x1530,
+0x1530,0x1530,0x1530,0x1530,0x152d,0x152d,0x152d,0x14f1,0x14f1,0x14f1,0x14f1,0x14f1,0x14f1,0x14f1,0x14f1,0x14e8,
 0x14f1,0x14f1,0x14f1,0x14f1,0x14f1,0x14f1,0x14f1,0x14f1,0x14f1,0x14f1,0x14f1,0x14f1,0x14f1,0x14f1,0x14f1,0x14f1,
-0x14fa,0x14fa,0x14fa,0x14fa,0x14fa,0x14fa,0x14fa,0x14fa,0x14fa,0x14fa,0x14fa,0x14fa,0x14fa,0x14fa,0x14fa,0x14fa,
-0x14fa,0x14fa,0x14fa,0x14fa,0x14fa,0x14fa,0x14fa,0x14fa,0x14fa,0x14fa,0x14fa,0x14fa,0x14fa,0x14fa,0x14fa,0x14fa,
-0x150c,0x150c,0x150c,0x150c,0x150c,0x150c,0x150c,0x150c,0x150c,0x150c,0x150c,0x150c,0x150c,0x150c,0x150c,0x150c,
-0x1509,0x1509,0x1509,0x14fd,0x14fd,0x14fd,0x14fd,0x14fd,0x14fd,0x14fd,0x14fd,0x1509,0x1509,0x14fd,0x1509,0x1500,
-0x150c,0x150c,0x150c,0x150c,0x150c,0x150c,0x150c,0x150c,0x150c,0x150c,0x150c,0x150c,0x150c,0x150c,0x150c,0x150c,
-0x150c,0x150c,0x150c,0x150c,0x150c,0x150c,0x150c,0x150c,0x150c,0x150c,0x150c,0x150c,0x150c,0x150c,0x150c,0x150c,
-0x1530,0x1530,0x1530,0x1530,0x1530,0x1530,0x1530,0x1530,0x1530,0x1530,0x1530,0x1530,0x1530,0x1530,0x1530,0x1530,
-0x1530,0x1530,0x1530,0x1530,0x1530,0x1530,0x1530,0x1530,0x1530,0x1530,0x1530,0x1530,0x1530,0x152d,0x152d,0x152d,
-0x1539,0x1539,0x1539,0x1539,0x1539,0x1539,0x1539,0x1539,0x1539,0x1539,0x1539,0x1539,0x1539,0x1539,0x1539,0x1539,
-0x1539,0x1539,0x1539,0x1539,0x1539,0x1539,0x153f,0x153f,0x153f,0x153c,0x153c,0x153c,0x1539,0x1539,0x1539,0x1539,
-0x154e,0x154e,0x154e,0x154e,0x154e,0x154e,0x154e,0x154e,0x154e,0x154e,0x154e,0x154e,0x154e,0x154e,0x154e,0x154e,
-0x1542,0x1542,0x1542,0x1542,0x1542,0x1542,0x1542,0x1554,0x1554,0x1548,0x1545,0x1545,0x1545,0x1545,0x1545,0x1545,
-0x154e,0x154e,0x154e,0x154e,0x154e,0x154e,0x154e,0x154e,0x154e,0x154e,0x154e,0x154e,0x154e,0x154e,0x154e,0x154e,
-0x154e,0x154e,0x154e,0x154e,0x154e,0x154e,0x154e,0x154e,0x154e,0x154e,0x154e,0x154e,0x154e,0x154e,0x154e,0x154e,
-0x155a,0x155a,0x155a,0x155a,0x155a,0x155a,0x155a,0x155a,0x155a,0x155a,0x155a,0x155a,0x155a,0x155a,0x155a,0x155a,
-0x155a,0x155a,0x155a,0x155a,0x155a,0x155a,0x155a,0x1557,0x1557,0x1557,0x1557,0x1557,0x1557,0x1557,0x1557,0x1557,
-0x155d,0x155d,0x155d,0x155d,0x155d,0x155d,0x155d,0x155d,0x155d,0x155d,0x155d,0x155d,0x155d,0x155d,0x155d,0x155d,
-0x155d,0x155d,0x155d,0x155d,0x155d,0x155d,0x155d,0x155d,0x155d,0x155d,0x155d,0x155d,0x155d,0x155d,0x155d,0x155d,
-0x1581,0x1581,0x1581,0x1581,0x1581,0x1581,0x1581,0x1581,0x1581,0x1581,0x1581,0x1581,0x1581,0x1581,0x1581,0x1581,
-0x1581,0x1581,0x1581,0x1581,0x1581,0x1581,0x1581,0x1581,0x1581,0x1581,0x1581,0x1581,0x1581,0x1581,0x1581,0x1581,
-0x158a,0x158a,0x158a,0x158a,0x158a,0x158a,0x158a,0x158a,0x158a,0x158a,0x158a,0x158a,0x158a,0x158a,0x158a,0x158a,
-0x158a,0x158a,0x158a,0x158a,0x158a,0x158a,0x158a,0x158a,0x158a,0x158a,0x158a,0x158a,0x158a,0x158a,0x158a,0x158a,
-0x15a2,0x15a2,0x15a2,0x15a2,0x15a2,0x15a2,0x15a2,0x15a2,0x15a2,0x15a2,0x15a2,0x15a2,0x15a2,0x15a2,0x15a2,0x15a2,
-0x158d,0x159c,0x159c,0x158d,0x158d,0x158d,0x158d,0x158d,0x158d,0x159c,0x158d,0x159f,0x159f,0x158d,0x159f,0x158d,
-0x15a2,0x15a2,0x15a2,0x15a2,0x15a2,0x15a2,0x15a2,0x15a2,0x15a2,0x15a2,0x15a2,0x15a2,0x15a2,0x15a2,0x15a2,0x15a2,
-0x15a2,0x15a2,0x15a2,0x15a2,0x15a2,0x15a2,0x15a2,0x15a2,0x15a2,0x15a2,0x15a2,0x15a2,0x15a2,0x15a2,0x15a2,0x15a2,
-0x15ab,0x15ab,0x15ab,0x15ab,0x15ab,0x15ab,0x15ab,0x15ab,0x15ab,0x15ab,0x15ab,0x15ab,0x15ab,0x15ab,0x15ab,0x15ab,
-0x15ab,0x15ab,0x15ab,0x15ab,0x15ab,0x15ab,0x15ab,0x15ab,0x15ab,0x15ab,0x15ab,0x15ab,0x15ab,0x15ab,0x15ab,0x15ab,
-0x15b1,0x15b1,0x15b1,0x15b1,0x15b1,0x15b1,0x15b1,0x15b1,0x15b1,0x15b1,0x15b1,0x15b1,0x15b1,0x15b1,0x15b1,0x15b1,
-0x15b1,0x15b1,0x15b1,0x15b1,0x15b1,0x15b1,0x15b1,0x15b1,0x15b1,0x15b1,0x15b1,0x15b1,0x15b1,0x15b1,0x15b1,0x15b1,
-0x1605,0x1605,0x1605,0x1605,0x1605,0x1605,0x1605,0x1605,0x1605,0x1605,0x1605,0x1605,0x1605,0x1605,0x1605,0x1605,
-0x1605,0x1605,0x1605,0x1605,0x1605,0x1605,0x1605,0x1605,0x1605,0x1605,0x1605,0x1605,0x1605,0x1605,0x1605,0x1605,
-0x1641,0x1641,0x1641,0x1641,0x1641,0x1641,0x1641,0x1641,0x1641,0x1641,0x1641,0x1641,0x1641,0x1641,0x1641,0x1641,
-0x1641,0x1641,0x1641,0x1641,0x1641,0x1641,0x1641,0x1641,0x1641,0x1641,0x1641,0x1641,0x1641,0x1641,0x1641,0x1641,
-0x1641,0x1641,0x1647,0x1644,0x1641,0x1641,0x1641,0x1641,0x1641,0x1641,0x1641,0x1641,0x1641,0x1641,0x1641,0x1641,
-0x1641,0x1641,0x1641,0x1641,0x164a,0x164a,0x164a,0x164a,0x164a,0x164a,0x164a,0x164a,0x164a,0x164a,0x164a,0x164a,
-0x164a,0x164a,0x164a,0x164a,0x164a,0x164a,0x164a,0x164a,0x164a,0x164a,0x164a,0x164a,0x164a,0x164a,0x164a,0x164a,
-0x164a,0x164a,0x164a,0x164a,0x164d,0x164d,0x164d,0x164d,0x164d,0x164d,0x164d,0x164d,0x164d,0x164d,0x164d,0x164d,
-0x164d,0x164d,0x164d,0x164d,0x164d,0x164d,0x164d,0x164d,0x164d,0x164d,0x164d,0x164d,0x164d,0x164d,0x164d,0x164d,
-0x164d,0x164d,0x164d,0x164d,0x165f,0x165f,0x165f,0x165f,0x165f,0x165f,0x165f,0x165f,0x165f,0x165f,0x165f,0x165f,
-0x165f,0x165f,0x165f,0x165f,0x165f,0x165f,0x165f,0x165f,0x165f,0x165f,0x165f,0x165f,0x165f,0x165f,0x165f,0x165f,
-0x165f,0x165f,0x165f,0x165f,0x1662,0x1662,0x1662,0x1662,0x1662,0x1662,0x1662,0x1662,0x1662,0x1662,0x1662,0x1662,
-0x1662,0x1662,0x1662,0x1662,0x1662,0x1662,0x1662,0x1662,0x1662,0x1662,0x1662,0x1662,0x1662,0x1662,0x1662,0x1662,
-0x1662,0x1662,0x1662,0x1662,0x1668,0x1668,0x1668,0x1668,0x1668,0x1668,0x1668,0x1668,0x1668,0x1668,0x1668,0x1668,
-0x1668,0x1668,0x1668,0x1668,0x1668,0x1668,0x1668,0x1668,0x1668,0x1668,0x1668,0x1668,0x1668,0x1668,0x1668,0x1668,
-0x1668,0x1668,0x1668,0x1668,0x1668,0x1668,0x1668,0x166b,0x166b,0x166b,0x166b,0x1668,0x1668,0x1668,0x1668,0x1668,
-0x1668,0x1668,0x1668,0x1668,0x1668,0x1668,0x1668,0x1668,0x1668,0x166b,0x166b,0x166b,0x166b,0x166b,0x166b,0x166b,
-0x166b,0x1668,0x166b,0x166b,0x166b,0x166b,0x166b,0x166b,0x166b,0x166b,0x166b,0x166b,0x166b,0x166b,0x166b,0x166b,
-0x166b,0x166b,0x166b,0x166b,0x166b,0x166b,0x166b,0x166b,0x166b,0x166b,0x166b,0x166b,0x166b,0x166b,0x166b,0x166b,
-0x166b,0x166b,0x166b,0x166b,0x1677,0x1677,0x1677,0x1677,0x1677,0x1677,0x1677,0x1677,0x1677,0x1677,0x1677,0x1677,
-0x1677,0x1677,0x1677,0x1677,0x1677,0x1677,0x1677,0x1677,0x1677,0x1677,0x1677,0x1677,0x1677,0x1677,0x1677,0x1677,
-0x1677,0x1677,0x1677,0x1677,0,0,0,0
+0x14e5,0x14e5,0x1ef,0x1ef,0x1ef,0x1ef,0x14e8,0x14e8,0x14e8,0x14e8,0x14e8,0x14ee,0x14ee,0x14ee,0x14ee,0x14ee,
+0x14ee,0x14eb,0x1ef,0x1ef,0x1ef,0x1ef,0x1ef,0x1ef,0x1ef,0x1ef,0x1ef,0x1176,0x1176,0x1176,0x1176,0x1176,
+0x1176,0x1176,0x1176,0x1176,0x1176,0x1176,0x1176,0x1176,0x1176,0x1176,0x1176,0x171,0x171,0x171,0x1170,0x1173,
+0x1173,0x1173,0x1173,0x1173,0x1173,0x117c,0x117c,0x117c,0x117c,0x117c,0x117c,0x117c,0x117c,0x117c,0x117c,0x117c,
+0x117c,0x117c,0x117c,0x117c,0x117c,0x174,0x174,0x1179,0x1179,0x1179,0x1179,0x1179,0x1179,0x1179,0x1179,0x1182,
+0x1182,0x1182,0x1182,0x1182,0x1182,0x1182,0x1182,0x1182,0x1182,0x1182,0x1182,0x1182,0x1182,0x1182,0x1182,0x177,
+0x177,0x177,0x177,0x177,0x117f,0x117f,0x117f,0x117f,0x117f,0x117f,0x117f,0x117f,0x1566,0x1566,0x1566,0x1566,
+0x1566,0x1566,0x1566,0x1566,0x1566,0x1566,0x1566,0x1566,0x1566,0x1566,0x1566,0x1566,0x20a,0x20a,0x20a,0x20a,
+0x20a,0x20a,0x20a,0x1563,0x1563,0x1563,0x1563,0x20a,0x20a,0x20a,0x20a,0x20a,0x20a,0x20a,0x20a,0x20a,
+0x1560,0x1560,0x1560,0x1560,0x1560,0x1560,0x1560,0x1185,0x1185,0x1185,0x1185,0x1185,0x1185,0x1185,0x1185,0x1185,
+0x1185,0x1185,0x1185,0x1185,0x1185,0x1185,0x1185,0x17a,0x17a,0x17a,0x17a,0x17a,0x17a,0x17a,0x1662,0x1662,
+0x1662,0x1662,0x1662,0x1662,0x1662,0x1662,0x1662,0x1662,0x1662,0x1662,0x1662,0x1662,0x1662,0x1662,0x22e,0x22e,
+0x22e,0x22e,0x22e,0x22e,0x22e,0x22e,0x22e,0x22e,0x22e,0x22e,0x22e,0x165f,0x165f,0x165f,0x165f,0x165f,
+0x165f,0x165f,0x165f,0x165f,0x165f,0x165f,0x165f,0x165f,0x165f,0x165f,0x165f,0x22e,0x22e,0x22e,0x22e,0x22e,
+0x22e,0x22e,0x165c,0x165c,0x165c,0x165c,0x165c,0x165c,0x1188,0x1188,0x1188,0x1188,0x1188,0x1188,0x1188,0x1188,
+0x1188,0x1188,0x1188,0x1188,0x1188,0x1188,0x1188,0x1188,0x17d,0x12a2,0x1293,0x12a2,0x12a5,0x12a5,0x12a5,0x12a5,
+0x12a5,0x12a5,0x12a5,0x12a5,0x12a5,0x12a5,0x12a5,0x12a5,0x12a5,0x12a5,0x12a5,0x12a5,0x1293,0x1293,0x1293,0x1293,
+0x1293,0x1293,0x1293,0x1293,0x1296,0x12a8,0x12a8,0x129c,0x129c,0x129c,0x129c,0x129c,0x195,0x195,0x1299,0x1299,
+0x1299,0x1299,0x1299,0x1299,0x1299,0x1299,0x1299,0x1299,0x1299,0x1299,0x1299,0x1299,0x129f,0x129f,0x129f,0x129f,
+0x129f,0x129f,0x129f,0x129f,0x129f,0x129f,0x195,0x195,0x195,0x195,0x195,0x195,0x195,0x195,0x195,0x195,
+0x195,0x195,0x195,0x195,0x195,0x1443,0x118e,0x118e,0x119d,0x11a0,0x11a0,0x11a0,0x11a0,0x11a0,0x11a0,0x11a0,
+0x11a0,0x11a0,0x11a0,0x11a0,0x11a0,0x11a0,0x11a3,0x11a0,0x11a3,0x11a0,0x11a0,0x11a0,0x11a0,0x11a0,0x11a0,0x11a0,
+0x11a0,0x11a0,0x11a0,0x11a0,0x11a3,0x11a0,0x11a0,0x11a0,0x11a0,0x119d,0x119d,0x119d,0x1191,0x1191,0x1191,0x1191,
+0x119d,0x119d,0x1197,0x1194,0x119a,0x119a,0x118b,0x11a6,0x11a6,0x180,0x180,0x180,0x180,0x180,0x180,0x180,
+0x180,0x180,0x180,0x180,0x180,0x180,0x180,0x138c,0x138c,0x138c,0x138c,0x138c,0x138c,0x138c,0x138c,0x138c,
+0x138c,0x138c,0x138c,0x138c,0x138c,0x138c,0x138c,0x1bf,0x1bf,0x1bf,0x1bf,0x1bf,0x1bf,0x1bf,0x1389,0x1389,
+0x1389,0x1389,0x1389,0x1389,0x1389,0x1389,0x1389,0x1389,0x1bf,0x1bf,0x1bf,0x1bf,0x1bf,0x1bf,0x1335,0x1335,
+0x1335,0x1347,0x1347,0x1347,0x1347,0x1347,0x1347,0x1347,0x1347,0x1347,0x1347,0x1347,0x1347,0x1347,0x1347,0x1347,
+0x1347,0x1335,0x1335,0x1335,0x1335,0x1335,0x1344,0x1335,0x1338,0x1338,0x1335,0x1335,0x1335,0x133b,0x133b,0x1b0,
+0x1341,0x1341,0x1341,0x1341,0x1341,0x1341,0x1341,0x1341,0x1341,0x1341,0x133e,0x134a,0x134a,0x134a,0x1b0,0x1b0,
+0x1b0,0x1b0,0x1b0,0x1b0,0x1b0,0x1b0,0x1b0,0x1b0,0x1b0,0x1b0,0x14e2,0x14e2,0x14e2,0x14e2,0x14e2,0x14e2,
+0x14e2,0x14e2,0x14e2,0x14e2,0x14e2,0x14e2,0x14e2,0x14e2,0x14e2,0x14e2,0x14d9,0x14dc,0x14df,0x14e2,0x1ec,0x1ec,
+0x1ec,0x1ec,0x1ec,0x1ec,0x1ec,0x1ec,0x1ec,0x1371,0x1371,0x137d,0x1383,0x1383,0x1383,0x1383,0x1383,0x1383,
+0x1383,0x1383,0x1383,0x1383,0x1383,0x1383,0x1383,0x1383,0x1383,0x1383,0x137d,0x137d,0x137d,0x1371,0x1371,0x1371,
+0x1371,0x1371,0x1371,0x1371,0x1371,0x1371,0x137d,0x1380,0x1383,0x1383,0x1383,0x1383,0x1386,0x1386,0x1374,0x1377,
+0x160b,0x1608,0x1608,0x1608,0x145e,0x1bc,0x1bc,0x137a,0x137a,0x137a,0x137a,0x137a,0x137a,0x137a,0x137a,0x137a,
+0x137a,0x145b,0x1611,0x1614,0x160e,0x1617,0x1617,0x213,0x1587,0x1587,0x1587,0x1587,0x1587,0x1587,0x1587,0x1587,
+0x1587,0x1587,0x1587,0x1587,0x1587,0x1587,0x1587,0x213,0x213,0x213,0x213,0x213,0x213,0x213,0x213,0x213,
+0x213,0x213,0x14b2,0x14b2,0x14b2,0x14b2,0x14b2,0x14b2,0x14b2,0x14b2,0x14b2,0x14b2,0x14b2,0x14b2,0x14b2,0x14b2,
+0x14b2,0x14b2,0x1e0,0x14b2,0x14b2,0x14b2,0x14b2,0x14b2,0x14b2,0x14b2,0x14b2,0x14b2,0x14b2,0x14b2,0x14b2,0x14b2,
+0x14ac,0x14ac,0x14ac,0x14a0,0x14a0,0x14ac,0x14ac,0x14a0,0x14af,0x14a3,0x14a0,0x14b5,0x14b5,0x14a9,0x14b5,0x14b5,
+0x14a6,0x1e0,0x1e0,0x1e0,0x1e0,0x1e0,0x1e0,0x1e0,0x1e0,0x1e0,0x1e0,0x1e0,0x1e0,0x1e0,0x1e0,0x1e0,
+0x1e0,0x1656,0x1656,0x1656,0x1656,0x1656,0x1656,0x1656,0x22b,0x1656,0x22b,0x1656,0x1656,0x1656,0x1656,0x22b,
+0x1656,0x1656,0x1656,0x1656,0x1656,0x1656,0x1656,0x1656,0x1656,0x1656,0x1656,0x1656,0x1656,0x1656,0x22b,0x1656,
+0x1656,0x1656,0x1656,0x1656,0x1656,0x1656,0x1656,0x1656,0x1659,0x22b,0x22b,0x22b,0x22b,0x22b,0x22b,0x14c7,
+0x14c7,0x14c7,0x14c7,0x14c7,0x14c7,0x14c7,0x14c7,0x14c7,0x14c7,0x14c7,0x14c7,0x14c7,0x14c7,0x14c7,0x14c7,0x14b8,
+0x14c4,0x14c4,0x14c4,0x14b8,0x14b8,0x14b8,0x14b8,0x14b8,0x14b8,0x14bb,0x14be,0x1e3,0x1e3,0x1e3,0x1e3,0x1e3,
+0x14c1,0x14c1,0x14c1,0x14c1,0x14c1,0x14c1,0x14c1,0x14c1,0x14c1,0x14c1,0x1e3,0x1e3,0x1e3,0x1e3,0x1e3,0x1e3,
+0x161a,0x148b,0x1491,0x1491,0x1dd,0x149a,0x149a,0x149a,0x149a,0x149a,0x149a,0x149a,0x149a,0x1dd,0x1dd,0x149a,
+0x149a,0x149a,0x149a,0x149a,0x149a,0x149a,0x149a,0x149a,0x149a,0x149a,0x149a,0x149a,0x1dd,0x149a,0x149a,0x149a,
+0x149a,0x149a,0x149a,0x1dd,0x149a,0x149a,0x1dd,0x149a,0x149a,0x149a,0x149a,0x149a,0x1dd,0x1dd,0x148e,0x149a,
+0x148b,0x1491,0x1491,0x1491,0x1491,0x1dd,0x1dd,0x1491,0x1491,0x1dd,0x1dd,0x1494,0x1494,0x1497,0x1dd,0x1dd,
+0x161d,0x1dd,0x1dd,0x1dd,0x1dd,0x1dd,0x1dd,0x148b,0x1dd,0x1dd,0x1dd,0x1dd,0x1dd,0x149d,0x149a,0x149a,
+0x1491,0x1491,0x1dd,0x1dd,0x148e,0x148e,0x148e,0x148e,0x148e,0x148e,0x148e,0x1dd,0x1dd,0x1dd,0x1dd,0x1dd,
+0x1dd,0x1dd,0x1dd,0x1dd,0x1dd,0x1dd,0x15a2,0x15a2,0x15a2,0x15a2,0x15a2,0x15a2,0x15a2,0x15a2,0x15a2,0x15a2,
+0x15a2,0x15a2,0x15a2,0x15a2,0x15a2,0x15a2,0x158d,0x159c,0x159c,0x158d,0x158d,0x158d,0x158d,0x158d,0x158d,0x159c,
+0x158d,0x159f,0x159f,0x158d,0x159f,0x158d,0x159c,0x1593,0x1590,0x15a2,0x15a2,0x1596,0x15a2,0x219,0x219,0x219,
+0x219,0x219,0x219,0x219,0x219,0x1599,0x1599,0x1599,0x1599,0x1599,0x1599,0x1599,0x1599,0x1599,0x1599,0x219,
+0x219,0x219,0x219,0x219,0x219,0x1581,0x1581,0x1581,0x1581,0x1581,0x1581,0x1581,0x1581,0x1581,0x1581,0x1581,
+0x1581,0x1581,0x1581,0x1581,0x1581,0x1569,0x157b,0x157b,0x1569,0x1569,0x1569,0x1569,0x210,0x210,0x157b,0x157b,
+0x157e,0x157e,0x1569,0x1569,0x157b,0x156f,0x156c,0x1572,0x1584,0x1584,0x1575,0x1575,0x1578,0x1578,0x1578,0x1584,
+0x1629,0x1629,0x1629,0x1629,0x1629,0x1629,0x1629,0x1629,0x1626,0x1626,0x1626,0x1626,0x1623,0x1623,0x210,0x210,
+0x210,0x210,0x210,0x210,0x210,0x210,0x210,0x210,0x210,0x210,0x210,0x210,0x210,0x210,0x150c,0x150c,
+0x150c,0x150c,0x150c,0x150c,0x150c,0x150c,0x150c,0x150c,0x150c,0x150c,0x150c,0x150c,0x150c,0x150c,0x1509,0x1509,
+0x1509,0x14fd,0x14fd,0x14fd,0x14fd,0x14fd,0x14fd,0x14fd,0x14fd,0x1509,0x1509,0x14fd,0x1509,0x1500,0x14fd,0x150f,
+0x150f,0x1503,0x150c,0x1f5,0x1f5,0x1f5,0x1f5,0x1f5,0x1f5,0x1f5,0x1f5,0x1f5,0x1f5,0x1f5,0x1506,0x1506,
+0x1506,0x1506,0x1506,0x1506,0x1506,0x1506,0x1506,0x1506,0x1f5,0x1f5,0x1f5,0x1f5,0x1f5,0x1f5,0x13a1,0x13a1,
+0x13a1,0x13a1,0x13a1,0x13a1,0x13a1,0x13a1,0x13a1,0x13a1,0x13a1,0x13a1,0x13a1,0x13a1,0x13a1,0x13a1,0x1392,0x139b,
+0x1392,0x139b,0x139b,0x1392,0x1392,0x1392,0x1392,0x1392,0x1392,0x139e,0x1395,0x1c5,0x1c5,0x1c5,0x1c5,0x1c5,
+0x1c5,0x1c5,0x1c5,0x1398,0x1398,0x1398,0x1398,0x1398,0x1398,0x1398,0x1398,0x1398,0x1398,0x1c5,0x1c5,0x1c5,
+0x1c5,0x1c5,0x1c5,0x163b,0x163b,0x163b,0x163b,0x163b,0x163b,0x163b,0x163b,0x163b,0x163b,0x163b,0x163b,0x163b,
+0x163b,0x163b,0x163b,0x21f,0x21f,0x21f,0x162c,0x162c,0x162c,0x1638,0x1638,0x162c,0x162c,0x162c,0x162c,0x1638,
+0x162c,0x162c,0x162c,0x162c,0x162f,0x21f,0x21f,0x21f,0x21f,0x1635,0x1635,0x1635,0x1635,0x1635,0x1635,0x1635,
+0x1635,0x1635,0x1635,0x1632,0x1632,0x163e,0x163e,0x163e,0x1632,0x15b1,0x15b1,0x15b1,0x15b1,0x15b1,0x15b1,0x15b1,
+0x15b1,0x15b1,0x15b1,0x15b1,0x15b1,0x15b1,0x15b1,0x15b1,0x15b1,0x15ab,0x15ab,0x15ab,0x15ab,0x15ab,0x15ab,0x15ab,
+0x15ab,0x15ab,0x15ab,0x15ab,0x15ab,0x15ab,0x15ab,0x15ab,0x15ab,0x15a8,0x15a8,0x15a8,0x15a8,0x15a8,0x15a8,0x15a8,
+0x15a8,0x15a8,0x15a8,0x15a5,0x15a5,0x15a5,0x15a5,0x15a5,0x15a5,0x21c,0x21c,0x21c,0x21c,0x21c,0x21c,0x21c,
+0x21c,0x21c,0x21c,0x21c,0x21c,0x15ae,0x155d,0x155d,0x155d,0x155d,0x155d,0x155d,0x155d,0x155d,0x155d,0x155d,
+0x155d,0x155d,0x155d,0x155d,0x155d,0x155d,0x207,0x207,0x207,0x207,0x207,0x207,0x207,0xea6,0xea6,0xea6,
+0xea6,0xea6,0xea6,0xea6,0xea6,0xea6,0xea6,0xea6,0xea6,0xea6,0xea6,0xea6,0xea6,0x1422,0x1422,0x1422,
+0x1422,0x1422,0x1422,0x1422,0x1422,0x1422,0x1422,0x1422,0x1422,0x1422,0x1422,0x1422,0x1422,0x15e7,0x11d,0x11d,
+0x11d,0x11d,0x11d,0x11d,0x11d,0x11d,0x11d,0x11d,0x11d,0x11d,0x11d,0x11d,0x11d,0x11d,0xeac,0xeac,
+0xeac,0xeac,0xeac,0xeac,0xeac,0xeac,0xeac,0xeac,0xeac,0xeac,0xeac,0xeac,0xeac,0xeac,0x1428,0x1428,
+0x1428,0x1428,0x1428,0x1428,0x1428,0x1428,0x1428,0x1428,0x1428,0x1428,0x120,0xea9,0xea9,0xea9,0xea9,0x1425,
+0x120,0x120,0x120,0x120,0x120,0x120,0x120,0x120,0x120,0x120,0x120,0x164d,0x164d,0x164d,0x164d,0x164d,
+0x164d,0x164d,0x164d,0x164d,0x164d,0x164d,0x164d,0x164d,0x164d,0x164d,0x164d,0x225,0x225,0x225,0x225,0x225,
+0x225,0x225,0x225,0x225,0x225,0x225,0x225,0x11a9,0x11a9,0x11a9,0x11a9,0x11a9,0x11a9,0x11a9,0x11a9,0x11a9,
+0x11a9,0x11a9,0x11a9,0x11a9,0x11a9,0x11a9,0x11a9,0x11af,0x11af,0x11af,0x11ac,0x11ac,0x11ac,0x11a9,0x11a9,0x11ac,
+0x11a9,0x11a9,0x11a9,0x11af,0x11ac,0x11af,0x11ac,0x11a9,0x11a9,0x11a9,0x11a9,0x11a9,0x11a9,0x11a9,0x11a9,0x11a9,
+0x11af,0x11ac,0x11ac,0x11a9,0x11a9,0x11a9,0x11a9,0x11a9,0x11a9,0x11a9,0x11a9,0x11a9,0x11a9,0x11a9,0x11a9,0x11a9,
+0x11a9,0x11a9,0x183,0x1641,0x1641,0x1641,0x1641,0x1641,0x1641,0x1641,0x1641,0x1641,0x1641,0x1641,0x1641,0x1641,
+0x1641,0x1641,0x1641,0x1647,0x1644,0x1641,0x1641,0x1641,0x1641,0x1641,0x1641,0x1641,0x222,0x222,0x222,0x222,
+0x222,0x222,0x222,0x222,0x222,0x222,0x222,0x222,0x222,0x222,0x222,0x222,0x12ab,0x12ab,0x12ab,0x12ab,
+0x12ab,0x12ab,0x12ab,0x12ab,0x12ab,0x12ab,0x12ab,0x12ab,0x12ab,0x12ab,0x12ab,0x12ab,0x198,0x198,0x198,0x198,
+0x198,0x198,0x198,0x1515,0x1515,0x1515,0x1515,0x1515,0x1515,0x1515,0x1515,0x1515,0x1515,0x1515,0x1515,0x1515,
+0x1515,0x1515,0x1515,0x1f8,0x1512,0x1512,0x1512,0x1512,0x1512,0x1512,0x1512,0x1512,0x1512,0x1512,0x1f8,0x1f8,
+0x1f8,0x1f8,0x1518,0x1518,0x1464,0x1464,0x1464,0x1464,0x1464,0x1464,0x1464,0x1464,0x1464,0x1464,0x1464,0x1464,
+0x1464,0x1464,0x1464,0x1464,0x1c8,0x1c8,0x1461,0x1461,0x1461,0x1461,0x1461,0x1467,0x1c8,0x1c8,0x1c8,0x1c8,
+0x1c8,0x1c8,0x1c8,0x1c8,0x1c8,0x1c8,0x154e,0x154e,0x154e,0x154e,0x154e,0x154e,0x154e,0x154e,0x154e,0x154e,
+0x154e,0x154e,0x154e,0x154e,0x154e,0x154e,0x1542,0x1542,0x1542,0x1542,0x1542,0x1542,0x1542,0x1554,0x1554,0x1548,
+0x1545,0x1545,0x1545,0x1545,0x1545,0x1545,0x154e,0x154e,0x1551,0x1551,0x1554,0x1545,0x204,0x204,0x204,0x204,
+0x204,0x204,0x204,0x204,0x204,0x204,0x154b,0x154b,0x154b,0x154b,0x154b,0x154b,0x154b,0x154b,0x154b,0x154b,
+0x204,0x1545,0x1545,0x1545,0x1545,0x1545,0x204,0x154e,0x154e,0x154e,0x154e,0x154e,0x154e,0x154e,0x154e,0x154e,
+0x154e,0x154e,0x154e,0x154e,0x204,0x204,0x204,0x204,0x204,0x154e,0x154e,0x154e,0x136b,0x136b,0x136b,0x136b,
+0x136b,0x136b,0x136b,0x136b,0x136b,0x136b,0x136b,0x136b,0x136b,0x136b,0x136b,0x136b,0x1b9,0x1b9,0x1b9,0x1b9,
+0x1b9,0x1b9,0x1b9,0x1b9,0x1b9,0x1b9,0x1b9,0x136b,0x1368,0x1368,0x1368,0x1368,0x1368,0x1368,0x1368,0x1368,
+0x1368,0x1368,0x1368,0x1368,0x1368,0x1368,0x1368,0x1368,0x1b9,0x1b9,0x1b9,0x1b9,0x1b9,0x1b9,0x1b9,0x1b9,
+0x1b9,0x1b9,0x1b9,0x1b9,0x1b9,0x1b9,0x1b9,0x1365,0x1365,0x1365,0x136e,0x136e,0x136e,0x136e,0x136e,0x136e,
+0x136e,0x136e,0x136e,0x136e,0x136e,0x136e,0x136e,0x12d8,0x12d5,0x19b,0x19b,0x19b,0x19b,0x19b,0x19b,0x19b,
+0x19b,0x19b,0x19b,0x19b,0x19b,0x19b,0x19b,0x19b,0x19b,0x147f,0x147f,0x147f,0x147f,0x147f,0x147f,0x147f,
+0x147f,0x147f,0x147f,0x147f,0x147f,0x147f,0x147f,0x147f,0x147f,0x1d4,0x1d4,0x1d4,0x1d4,0x1d4,0x1d4,0x1d4,
+0x147f,0x147f,0x147f,0x147f,0x147f,0x147f,0x147f,0x147f,0x147f,0x147f,0x1d4,0x1d4,0x147c,0x1476,0x1479,0x1482,
+0x15b7,0x15b7,0x15b7,0x15b7,0x20d,0x20d,0x20d,0x20d,0x20d,0x20d,0x20d,0x20d,0x20d,0x20d,0x20d,0x20d,
+0xab6,0xab6,0xab6,0xab6,0xab6,0xab6,0xab6,0xab6,0xab6,0xab6,0xab6,0xab6,0xab6,0xab6,0xab6,0xab6,
+0xa5,0xa5,0xa5,0xa5,0xa5,0xa5,0xa5,0xa5,0xa5,0xa5,0xac2,0xac2,0xac2,0xac2,0xac2,0xac2,
+0xac2,0xac2,0xac2,0xac2,0xac2,0xac2,0xac2,0xac2,0xac2,0xac2,0xa8,0xa8,0xf2d,0xac2,0xac2,0xac2,
+0xac2,0xac2,0xac2,0xac2,0xac2,0xac2,0xac2,0xac2,0xac2,0xac2,0xac2,0xac5,0xac5,0xac5,0xac5,0xac5,
+0xabc,0xac8,0xace,0xace,0xace,0xac2,0xac2,0xac2,0xacb,0xabf,0xabf,0xabf,0xab9,0xab9,0xab9,0xab9,
+0xab9,0xab9,0xab9,0xab9,0xace,0xace,0xace,0xace,0xace,0xac2,0xac2,0xace,0xace,0xace,0xace,0xace,
+0xace,0xace,0xac2,0xac2,0xac2,0xac2,0xac2,0xac2,0xac2,0xac2,0xac2,0xac2,0xace,0xace,0xace,0xace,
+0xac2,0xac2,0xac5,0xac2,0xac2,0xac2,0xac2,0xac2,0xac2,0xac2,0xac2,0xac2,0xac2,0xac2,0xac2,0xac2,
+0xac2,0xac2,0x15d8,0x15d8,0x15d8,0x15d8,0x15d8,0x15d8,0x15d8,0x15d8,0x15d8,0xa8,0xa8,0xa8,0xa8,0xa8,
+0xa8,0xa8,0xa8,0xa8,0xa8,0xa8,0xa8,0xa8,0xa8,0xa8,0xa8,0xd41,0xd41,0xd41,0xd41,0xd41,
+0xd41,0xd41,0xd41,0xd41,0xd41,0xd41,0xd41,0xd41,0xd41,0xd41,0xd41,0xd3e,0xd3e,0xd3e,0xd41,0xdb,
+0xdb,0xdb,0xdb,0xdb,0xdb,0xdb,0xdb,0xdb,0xdb,0xc9f,0xc9f,0xc9f,0xc9f,0xc9f,0xc9f,0xc9f,
+0xc9f,0xc9f,0xc9f,0xc9f,0xc9f,0xc9f,0xc9f,0xc9f,0xc9f,0xd8,0xd8,0xd8,0xd8,0xd8,0xd8,0xd8,
+0xd8,0xd8,0xeaf,0xeaf,0xeaf,0xeaf,0xeaf,0xeaf,0xeaf,0xeaf,0xeaf,0xeaf,0xeaf,0xeaf,0xeaf,0xeaf,
+0xeaf,0xeaf,0x123,0x123,0x123,0x123,0x123,0x123,0x123,0x123,0x123,0x123,0x123,0x123,0x123,0x123,
+0xada,0xada,0xada,0xada,0xada,0xada,0xada,0xada,0xada,0xada,0xada,0xada,0xada,0xada,0xada,0xada,
+0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,
+0xada,0xada,0xada,0xada,0xada,0xada,0xada,0xada,0xada,0xada,0xada,0xada,0xad7,0xad7,0xad7,0xad7,
+0xad7,0xab,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xada,0xab,
+0xada,0xada,0xab,0xab,0xada,0xab,0xab,0xada,0xada,0xab,0xab,0xada,0xada,0xada,0xada,0xab,
+0xada,0xada,0xada,0xada,0xada,0xada,0xad7,0xad7,0xad7,0xad7,0xab,0xad7,0xab,0xad7,0xad7,0xad7,
+0xc4b,0xad7,0xad7,0xab,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xada,
+0xada,0xab,0xada,0xada,0xada,0xada,0xab,0xab,0xada,0xada,0xada,0xada,0xada,0xab,0xada,0xada,
+0xada,0xada,0xada,0xada,0xada,0xab,0xad7,0xad7,0xada,0xada,0xada,0xada,0xada,0xab,0xada,0xab,
+0xab,0xab,0xada,0xada,0xada,0xada,0xada,0xada,0xab,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,
+0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xd29,0xd29,0xab,0xab,0xada,0xada,0xada,0xada,0xada,
+0xada,0xada,0xada,0xad1,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,
+0xad7,0xad7,0xad1,0xad7,0xad7,0xad7,0xad7,0xada,0xada,0xada,0xada,0xada,0xada,0xada,0xada,0xada,
+0xada,0xada,0xada,0xada,0xada,0xad1,0xad7,0xad7,0xad7,0xad7,0xad7,0xad1,0xad7,0xad7,0xad7,0xad7,
+0xad7,0xad7,0xada,0xada,0xada,0xada,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,
+0xad7,0xad7,0xad7,0xad7,0xad7,0xad1,0xada,0xada,0xada,0xada,0xada,0xada,0xada,0xada,0xada,0xada,
+0xada,0xada,0xada,0xada,0xada,0xad1,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad1,
+0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xe3a,0xe37,0xab,0xab,0xad4,0xad4,0xad4,0xad4,0xad4,0xad4,
+0xad4,0xad4,0xad4,0xad4,0xad4,0xad4,0xad4,0xad4,0xad4,0xad4,0x166b,0x166b,0x166b,0x166b,0x166b,0x166b,
+0x166b,0x166b,0x166b,0x166b,0x166b,0x166b,0x166b,0x166b,0x166b,0x166b,0x1668,0x1668,0x1668,0x1668,0x1668,0x1668,
+0x1668,0x1668,0x1668,0x1668,0x1668,0x1668,0x1668,0x1668,0x1668,0x1668,0x166b,0x166b,0x166b,0x166b,0x1668,0x1668,
+0x1668,0x1668,0x1668,0x166b,0x166b,0x166b,0x166b,0x166b,0x1668,0x166b,0x166b,0x166b,0x166b,0x166b,0x166b,0x166b,
+0x166b,0x166b,0x166b,0x1668,0x166b,0x166b,0x166e,0x1671,0x166e,0x166e,0x166b,0x234,0x234,0x234,0x234,0x234,
+0x234,0x234,0x234,0x234,0x234,0x234,0x1668,0x1668,0x1668,0x1668,0x1668,0x1668,0x1668,0x1668,0x1668,0x1668,
+0x1668,0x1668,0x1668,0x1668,0x1668,0x14fa,0x14fa,0x14fa,0x14fa,0x14fa,0x14fa,0x14fa,0x14fa,0x14fa,0x14fa,0x14fa,
+0x14fa,0x14fa,0x14fa,0x14fa,0x14fa,0x1f2,0x1f2,0x14f7,0x14f7,0x14f7,0x14f7,0x14f7,0x14f7,0x14f7,0x14f7,0x14f7,
+0x14f4,0x14f4,0x14f4,0x14f4,0x14f4,0x14f4,0x14f4,0x1f2,0x1f2,0x1f2,0x1f2,0x1f2,0x1f2,0x1f2,0x1f2,0x1f2,
+0x1332,0x1332,0x1332,0x1332,0x1ad,0x1332,0x1332,0x1332,0x1332,0x1332,0x1332,0x1332,0x1332,0x1332,0x1332,0x1332,
+0x1332,0x1332,0x1332,0x1332,0x1332,0x1ad,0x1332,0x1332,0x1ad,0x1332,0x1ad,0x1ad,0x1332,0x1ad,0x1332,0x1332,
+0x1332,0x1332,0x1332,0x1332,0x1332,0x1ad,0x1332,0x1332,0x1332,0x1332,0x1ad,0x1332,0x1ad,0x1332,0x1ad,0x1ad,
+0x1ad,0x1ad,0x1332,0x1ad,0x1ad,0x1ad,0x1ad,0x1332,0x1ad,0x1332,0x1ad,0x1332,0x1ad,0x1332,0x1332,0x1332,
+0x1ad,0x1332,0x1332,0x1ad,0x1332,0x1ad,0x1ad,0x1332,0x1ad,0x1332,0x1ad,0x1332,0x1ad,0x1332,0x1ad,0x1332,
+0x1332,0x1ad,0x1332,0x1ad,0x1ad,0x1332,0x1332,0x1332,0x1332,0x1ad,0x1332,0x1332,0x1332,0x1332,0x1ad,0x1332,
+0x1332,0x1332,0x1332,0x1ad,0x1332,0x1ad,0x1332,0x1332,0x1332,0x1332,0x1332,0x1332,0x1332,0x1332,0x1332,0x1332,
+0x1ad,0x1332,0x1332,0x1332,0x1332,0x1332,0x1332,0x1332,0x1332,0x1332,0x1332,0x1332,0x1332,0x1ad,0x1ad,0x1ad,
+0x1ad,0x1332,0x1332,0x1332,0x1ad,0x1332,0x1332,0x1332,0x1332,0x1332,0x1ad,0x1332,0x1332,0x1332,0x1332,0x1332,
+0x1ad,0x1ad,0x1ad,0x1ad,0x1ad,0x1ad,0x1ad,0x1ad,0x1ad,0x1ad,0x1ad,0x1ad,0x1ad,0x1ad,0x1ad,0x1ad,
+0x132f,0x132f,0x1ad,0x1ad,0x1ad,0x1ad,0x1ad,0x1ad,0x1ad,0x1ad,0x1ad,0x1ad,0x1ad,0x1ad,0x1ad,0x1ad,
+0x103e,0x103e,0x103e,0x103e,0x103e,0x103e,0x103e,0x103e,0x103e,0x103e,0x103e,0x103e,0x103e,0x103e,0x103e,0x103e,
+0x144,0x144,0x144,0x144,0x1041,0x1041,0x1041,0x1041,0x1041,0x1041,0x1041,0x1041,0x1041,0x1041,0x1041,0x1041,
+0x1041,0x1041,0x1041,0x1041,0x147,0x147,0x147,0x147,0x147,0x147,0x147,0x147,0x147,0x147,0x147,0x147,
+0x12ae,0x12ae,0x12ae,0x12ae,0x12ae,0x12ae,0x12ae,0x12ae,0x12ae,0x12ae,0x12ae,0x12ae,0x12ae,0x12ae,0x12ae,0x19e,
+0x12ae,0x12ae,0x12ae,0x12ae,0x12ae,0x12ae,0x12ae,0x12ae,0x12ae,0x12ae,0x12ae,0x12ae,0x12ae,0x12ae,0x1446,0x19e,
+0x12ae,0x12ae,0x12ae,0x12ae,0x12ae,0x12ae,0x12ae,0x12ae,0x12ae,0x12ae,0x12ae,0x12ae,0x12ae,0x12ae,0x12ae,0x1446,
+0x1446,0x1446,0x1446,0x1446,0x1446,0x1446,0x1446,0x1446,0x1446,0x1446,0x1446,0x1446,0x1446,0x1446,0x1446,0x19e,
+0x19e,0x19e,0x19e,0x19e,0x19e,0x19e,0x19e,0x19e,0x19e,0x11ca,0x11ca,0x11ca,0x11ca,0x11ca,0x11ca,0x11ca,
+0x11ca,0x11ca,0x11ca,0x11ca,0x1440,0x1440,0x186,0x186,0x186,0x11ca,0x11ca,0x11ca,0x11ca,0x11ca,0x11ca,0x11ca,
+0x11ca,0x11ca,0x11ca,0x11ca,0x11ca,0x11ca,0x11ca,0x11ca,0x11ca,0x11cd,0x11cd,0x11cd,0x11b2,0x186,0x12c9,0x11d6,
+0x12c9,0x12c9,0x12c9,0x12c9,0x12c9,0x12c9,0x12c9,0x12c9,0x12c9,0x12c9,0x12c9,0x11d6,0x12c9,0x11d6,0x12c9,0x12c9,
+0x11d6,0x12c9,0x12c9,0x12c9,0x11d6,0x12c9,0x12c9,0x12c9,0x11d0,0x11d0,0x11d0,0x11d0,0x11d0,0x12c3,0x12c6,0x12c6,
+0x12c6,0x12c6,0x12c6,0x12c6,0x12c6,0x11d3,0x12c6,0x12c6,0x12c6,0x12c6,0x12c6,0x12c6,0x12c6,0x11d3,0x12c6,0x12c6,
+0x12c6,0x12c6,0x12c6,0x12c6,0x12c6,0x12c6,0x12c6,0x12c6,0x131d,0x131d,0x186,0x186,0x186,0x186,0x12c6,0x12c6,
+0x12c6,0x12c6,0x12c6,0x12c6,0x12c6,0x12c6,0x12c6,0x11d3,0x12c6,0x11d3,0x11d3,0x12c6,0x12c6,0x11d3,0x12c6,0x12c6,
+0x12c6,0x12c6,0x12c6,0x12c6,0x12c6,0x12c6,0x12c6,0x12c6,0x11c7,0x11c7,0x11c7,0x11c7,0x12c0,0x12c0,0x11d0,0x12c0,
+0x12c0,0x12c0,0x12c0,0x12c0,0x12c0,0x12c0,0x12c0,0x12c0,0x12c0,0x186,0x186,0x186,0x186,0x186,0x186,0x186,
+0x186,0x186,0x186,0x186,0x186,0x186,0x186,0x186,0x186,0x1272,0x1272,0x1272,0x1272,0x1272,0x1272,0x1272,
+0x1272,0x1272,0x1272,0x1272,0x1272,0x1272,0x1272,0x1272,0x1272,0x11ee,0x12d2,0x12d2,0x189,0x189,0x189,0x189,
+0x189,0x189,0x189,0x189,0x189,0x189,0x189,0x189,0x189,0x11eb,0x11eb,0x11eb,0x11eb,0x11eb,0x11eb,0x11eb,
+0x11eb,0x11eb,0x11eb,0x11eb,0x11eb,0x11eb,0x11eb,0x11eb,0x11eb,0x12d2,0x12d2,0x12d2,0x12d2,0x12d2,0x12d2,0x12d2,
+0x12d2,0x12d2,0x189,0x189,0x189,0x189,0x189,0x11e8,0x11e8,0x11e8,0x11e8,0x11e8,0x11e8,0x11e8,0x11e8,0x11e8,
+0x189,0x189,0x189,0x189,0x189,0x189,0x189,0x12cf,0x12cf,0x189,0x189,0x189,0x189,0x189,0x189,0x189,
+0x189,0x189,0x189,0x189,0x189,0x189,0x189,0x189,0x189,0x12b4,0x12b4,0x12b4,0x12b4,0x12b4,0x12b4,0x12b4,
+0x12b4,0x12b4,0x12b4,0x12b4,0x12b4,0x12b4,0x12b4,0x12b4,0x12b4,0x144c,0x144c,0x144c,0x144c,0x144c,0x144c,0x144c,
+0x144c,0x144c,0x144c,0x144c,0x144c,0x15f6,0x15f6,0x15f6,0x12b4,0x12b4,0x12b4,0x12b4,0x12b4,0x12b4,0x144c,0x12b4,
+0x12b4,0x12b4,0x12b4,0x12b4,0x12b4,0x12b4,0x12b4,0x12b4,0x12b4,0x12b4,0x12b4,0x12b4,0x144c,0x15f6,0x15f6,0x12b4,
+0x12b4,0x12b4,0x12b4,0x144c,0x144c,0x144c,0x144c,0x144c,0x144c,0x144c,0x144c,0x1449,0x1449,0x144c,0x144c,0x12b4,
+0x12b4,0x12b4,0x12b4,0x12b4,0x12b1,0x12b1,0x12b4,0x12b4,0x12b4,0x12b4,0x12b4,0x12b1,0x12b4,0x12b4,0x12b4,0x12b4,
+0x12b4,0x144c,0x12b4,0x12b4,0x12b4,0x12b4,0x12b4,0x144c,0x144c,0x144c,0x144c,0x15f6,0x15f6,0x15f6,0x15f6,0x144c,
+0x144c,0x144c,0x144c,0x144c,0x144c,0x144c,0x144c,0x144c,0x144c,0x144c,0x144c,0x12b4,0x144c,0x144c,0x144c,0x144c,
+0x144c,0x144c,0x144c,0x15f6,0x15f6,0x15f6,0x15f3,0x15f3,0x15f3,0x15f3,0x15f3,0x12b4,0x144c,0x12b4,0x12b4,0x12b4,
+0x12b4,0x12b4,0x12b4,0x12b4,0x12b4,0x12b4,0x12b4,0x12b4,0x12b4,0x12b4,0x12b4,0x12b1,0x12b4,0x12b1,0x12b4,0x12b1,
+0x12b4,0x12b4,0x12b4,0x12b4,0x12b4,0x12b4,0x12b4,0x12b4,0x12b4,0x12b4,0x12b1,0x12b1,0x12b4,0x12b4,0x12b4,0x12b4,
+0x12b4,0x12b4,0x12b4,0x12b4,0x12b4,0x12b4,0x12b4,0x12b4,0x12b4,0x144c,0x12b4,0x12b4,0x12b4,0x12b4,0x144c,0x144c,
+0x15f6,0x12b1,0x12b1,0x12b1,0x12b1,0x12b1,0x12b1,0x12b1,0x12b4,0x12b4,0x12b4,0x12b4,0x12b4,0x12b4,0x12b4,0x12b4,
+0x12b4,0x12b1,0x12b1,0x12b1,0x12b1,0x12b1,0x12b1,0x12b1,0x12b1,0x12b1,0x12b4,0x12b4,0x12b4,0x12b4,0x12b4,0x12b4,
+0x12b4,0x12b4,0x12b4,0x12b4,0x12b4,0x12b1,0x12b1,0x12b1,0x12b1,0x12b1,0x12b1,0x12b1,0x12b1,0x12b1,0x12b1,0x12b1,
+0x12b1,0x1449,0x1449,0x1320,0x1320,0x1320,0x1320,0x1449,0x1449,0x1449,0x1449,0x1449,0x1449,0x144c,0x15f6,0x15f6,
+0x15f6,0x15f6,0x15f6,0x144c,0x144c,0x144c,0x144c,0x144c,0x144c,0x144c,0x144c,0x144c,0x144c,0x1a1,0x144c,0x144c,
+0x144c,0x144c,0x144c,0x144c,0x144c,0x144c,0x144c,0x144c,0x144c,0x144c,0x144c,0x144c,0x144c,0x144c,0x1449,0x1449,
+0x1449,0x1449,0x1449,0x1449,0x1449,0x1449,0x144c,0x144c,0x144c,0x144c,0x1449,0x1449,0x1449,0x1449,0x1449,0x1449,
+0x144c,0x12b4,0x12b4,0x12b4,0x12b4,0x12b4,0x1323,0x12b7,0x12b7,0x12b7,0x12b7,0x12b7,0x12b7,0x12b7,0x12b7,0x12b7,
+0x12b7,0x12b7,0x12b7,0x12b7,0x12b7,0x12b7,0x1323,0x12b7,0x12b7,0x12b7,0x1323,0x12b7,0x1323,0x12b7,0x1323,0x12b7,
+0x1323,0x12b7,0x12b7,0x12b7,0x1323,0x12b7,0x12b7,0x12b7,0x12b7,0x12b7,0x12b7,0x1323,0x1323,0x12b7,0x12b7,0x12b7,
+0x12b7,0x1323,0x12b7,0x1323,0x1323,0x12b7,0x12b7,0x12b7,0x12b7,0x1323,0x12b7,0x12b7,0x12b7,0x12b7,0x12b7,0x12b7,
+0x12b7,0x12b7,0x12b7,0x12b7,0x12b7,0x144f,0x144f,0x15f9,0x15f9,0x12b7,0x12b7,0x12b7,0x12b7,0x12b7,0x12b7,0x12b7,
+0x12b7,0x12b7,0x12b7,0x12b7,0x1539,0x1539,0x1539,0x1539,0x1539,0x1539,0x1539,0x1539,0x1539,0x1539,0x1539,0x1539,
+0x1539,0x1539,0x1539,0x1539,0x153f,0x153f,0x153f,0x153c,0x153c,0x153c,0x1539,0x1539,0x1539,0x1539,0x12ba,0x12ba,
+0x12ba,0x12ba,0x12ba,0x12ba,0x12ba,0x12ba,0x12ba,0x12ba,0x12ba,0x12ba,0x12ba,0x12ba,0x12ba,0x12ba,0x1452,0x1452,
+0x1452,0x1452,0x1452,0x1452,0x1452,0x1452,0x1452,0x1452,0x15fc,0x1a4,0x1a4,0x1a4,0x1a4,0x1a4,0x1a4,0x1a4,
+0x1a4,0x1a4,0x1a4,0x1a4,0x1a4,0x1a4,0x1a4,0x1a4,0x1452,0x1452,0x1452,0x1452,0x1452,0x1452,0x1452,0x1452,
+0x1452,0x1452,0x1452,0x1452,0x1452,0x1a4,0x1a4,0x1a4,0x1a4,0x1a4,0x1a4,0x1a4,0x1a4,0x1a4,0x1a4,0x1a4,
+0x1a4,0x12bd,0x12bd,0x12bd,0x12bd,0x12bd,0x12bd,0x12bd,0x12bd,0x12bd,0x12bd,0x12bd,0x12bd,0x12bd,0x12bd,0x12bd,
+0x12bd,0x1a7,0x1a7,0x1a7,0x1a7,0x1a7,0x1a7,0x1a7,0x1a7,0x1a7,0x1a7,0x1a7,0x1a7,0x1488,0x1488,0x1488,
+0x1488,0x1488,0x1488,0x1488,0x1488,0x1488,0x1488,0x1488,0x1488,0x1488,0x1488,0x1488,0x1488,0x1da,0x1da,0x1da,
+0x1da,0x1da,0x1da,0x1da,0x1da,0x1da,0x1da,0x1da,0x1da,0x1da,0x1da,0x1da,0x1da,0x158a,0x158a,0x158a,
+0x158a,0x158a,0x158a,0x158a,0x158a,0x158a,0x158a,0x158a,0x158a,0x216,0x216,0x216,0x216,0x158a,0x158a,0x158a,
+0x158a,0x158a,0x158a,0x158a,0x158a,0x158a,0x158a,0x158a,0x158a,0x158a,0x158a,0x158a,0x158a,0x216,0x216,0x216,
+0x216,0x216,0x216,0x216,0x216,0x216,0x216,0x216,0x216,0x216,0x216,0x216,0x216,0x231,0x231,0x231,
+0x231,0x231,0x231,0x231,0x231,0x231,0x231,0x231,0x231,0x231,0x231,0x231,0x231,0x1665,0x1665,0x1665,
+0x1665,0x1665,0x1665,0x1665,0x1665,0x1665,0x231,0x231,0x231,0x231,0x231,0x231,0x231,0x231,0x231,0x231,
+0x231,0x231,0x231,0x231,0x231,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0x8c1,0x8c1,0xae3,0xae3,0xae3,0xae3,0xae3,0xae3,0xae3,0xae3,0xae3,0xae3,0xae3,
+0xae3,0xae3,0xae3,0xae3,0xae3,0x243,0x243,0x243,0x243,0x243,0x243,0x243,0x243,0x243,0x237,0x237,
+0x237,0x237,0x237,0x237,0x237,0x237,0x237,0x237,0x237,0x237,0x237,0x237,0x237,0x237,0x11f1,0x11f1,
+0x11f1,0x11f1,0x11f1,0x11f1,0x11f1,0x11f1,0x11f1,0x11f1,0x11f1,0x11f1,0x11f1,0x11f1,0x11f1,0x11f1,0x249,0x249,
+0x249,0x249,0x249,0x249,0x249,0x249,0x249,0x249,0x249,0x12db,0x12db,0x12db,0x12db,0x12db,0x12db,0x12db,
+0x12db,0x12db,0x12db,0x12db,0x12db,0x12db,0x12db,0x12db,0x12db,0x24c,0x24c,0x1677,0x1677,0x1677,0x1677,0x1677,
+0x1677,0x1677,0x1677,0x1677,0x1677,0x1677,0x1677,0x1677,0x1677,0x1677,0x1677,0x24f,0x24f,0x24f,0x24f,0x24f,
+0x24f,0x24f,0x24f,0x24f,0x24f,0x24f,0x24f,0x24f,0x24f,0xae6,0xae6,0xae6,0xae6,0xae6,0xae6,0xae6,
+0xae6,0xae6,0xae6,0xae6,0xae6,0xae6,0xae6,0xae6,0xae6,0x246,0x246,0x237,0x237,0x237,0x237,0x237,
+0x237,0x237,0x237,0x237,0x237,0x237,0x237,0x237,0x237,0x8c1,0x8c1,0xae,0xae0,0xae,0xae,0xae,
+0xae,0xae,0xae,0xae,0xae,0xae,0xae,0xae,0xae,0xae,0xae,0xae,0xae,0xadd,0xadd,0xadd,
+0xadd,0xadd,0xadd,0xadd,0xadd,0xadd,0xadd,0xadd,0xadd,0xadd,0xadd,0xadd,0xadd,0xae0,3,3,
+3,3,3,3,3,3,3,3,3,3,3,3,3,3,0xcae,0xcae,
+0xcae,0xcae,0xcae,0xcae,0xcae,0xcae,0xcae,0xcae,0xcae,0xcae,0xcae,0xcae,0xcae,0xcae,0x918,0x918,
+0x918,0x918,0x918,0x918,0x918,0x918,0x918,0x918,0x918,0x918,0x918,0x918,0x918,0x918,0x912,0x912,
+0x91b,0x91b,0x91b,0x91b,0x91b,0x91b,0x91b,0x91b,0x91b,0x91b,0x91b,0x91b,0x91b,0x91b,0x91b,0x91b,
+0x915,0x915,0x915,0
 };
 
-static const UTrie2 propsVectorsTrie={
+static const UCPTrie propsVectorsTrie={
     propsVectorsTrie_index,
-    propsVectorsTrie_index+4640,
-    NULL,
-    4640,
-    22632,
-    0xa40,
-    0x12a0,
-    0x0,
-    0x0,
+    { propsVectorsTrie_data16 },
+    4202,
+    20164,
     0x110000,
-    0x6a84,
-    NULL, 0, FALSE, FALSE, 0, NULL
+    0,
+    0,
+    0, NULL
 };
 
 static const uint32_t propsVectors[5754]={
@@ -0,0 +1,435 @@
+/*
+******************************************************************************
+*
+*   Copyright (C) 2016, International Business Machines
+*   Corporation and others.  All Rights Reserved.
+*
+******************************************************************************
+*   file name:  ucptrie.cpp
+*   encoding:   US-ASCII
+*   tab size:   8 (not used)
+*   indentation:4
+*
+*   created on: 2016jan12 (starting from a copy of utrie2.cpp)
+*
+*   This is a common implementation of a Unicode trie.
+*   It is a kind of compressed, serializable table of 8-, 16- or 32-bit values
+*   associated with Unicode code points (0..0x10ffff).
+*   See ucptrie.h for a comparison with UTrie2.
+*
+*   This file contains only the runtime and enumeration code, for read-only access.
+*   See ucptrie_builder.cpp for the builder code.
+*/
+
+#include "unicode/utypes.h"
+#include "cmemory.h"
+#include "ucptrie.h"
+#include "ucptrie_impl.h"
+
+/* Public UCPTrie API implementation ---------------------------------------- */
+
+static inline uint32_t
+getValue(const UCPTrie *trie, int32_t i) {
+    switch(trie->valueWidth) {
+    case UCPTRIE_VALUE_BITS_16:
+        return trie->data.ptr16[i];
+    case UCPTRIE_VALUE_BITS_32:
+        return trie->data.ptr32[i];
+    default:
+        return trie->data.ptr8[i];
+    }
+}
+
+static inline int32_t
+getFastLimit(const UCPTrie *trie) {
+    return trie->type==UCPTRIE_TYPE_FAST ? 0x10000 : UCPTRIE_SMALL_LIMIT;
+}
+
+U_CAPI uint32_t U_EXPORT2
+ucptrie_get(const UCPTrie *trie, UChar32 c) {
+    int32_t dataIndex;
+    if(trie->type==UCPTRIE_TYPE_FAST) {
+        dataIndex=_UCPTRIE_CP_INDEX(trie, 0xffff, c);
+    } else {
+        dataIndex=_UCPTRIE_CP_INDEX(trie, UCPTRIE_SMALL_MAX, c);
+    }
+    return getValue(trie, dataIndex);
+}
+
+U_CAPI UCPTrie * U_EXPORT2
+ucptrie_openFromBinary(UCPTrieType type, UCPTrieValueWidth valueWidth,
+                       const void *data, int32_t length, int32_t *pActualLength,
+                       UErrorCode *pErrorCode) {
+    const UCPTrieHeader *header;
+    const uint16_t *p16;
+    int32_t actualLength, fastIndexLength;
+
+    UCPTrie tempTrie;
+    UCPTrie *trie;
+
+    if(U_FAILURE(*pErrorCode)) {
+        return NULL;
+    }
+
+    if( length<=0 || (U_POINTER_MASK_LSB(data, 3)!=0) ||
+        type<0 || UCPTRIE_TYPE_COUNT<=type ||
+        valueWidth<0 || UCPTRIE_VALUE_BITS_COUNT<=valueWidth
+    ) {
+        *pErrorCode=U_ILLEGAL_ARGUMENT_ERROR;
+        return NULL;
+    }
+
+    /* enough data for a trie header? */
+    if(length<(int32_t)sizeof(UCPTrieHeader)) {
+        *pErrorCode=U_INVALID_FORMAT_ERROR;
+        return NULL;
+    }
+
+    /* check the signature and the options */
+    header=(const UCPTrieHeader *)data;
+    if( header->signature!=UCPTRIE_SIG ||
+        (header->options&UCPTRIE_OPTIONS_RESERVED_MASK)!=0 ||
+        type!=(UCPTrieType)(header->options>>UCPTRIE_OPTIONS_TYPE_SHIFT) ||
+        valueWidth!=(UCPTrieValueWidth)(header->options&UCPTRIE_OPTIONS_VALUE_BITS_MASK)
+    ) {
+        *pErrorCode=U_INVALID_FORMAT_ERROR;
+        return NULL;
+    }
+
+    /* get the length values */
+    uprv_memset(&tempTrie, 0, sizeof(tempTrie));
+    tempTrie.indexLength=header->indexLength;
+    tempTrie.dataLength=header->dataLength;
+    tempTrie.highStart=header->highStart;
+    tempTrie.type=(int8_t)type;
+    tempTrie.valueWidth=(int8_t)valueWidth;
+    fastIndexLength= type==UCPTRIE_TYPE_FAST ? UCPTRIE_BMP_INDEX_LENGTH : UCPTRIE_SMALL_INDEX_LENGTH;
+    if( tempTrie.indexLength<fastIndexLength ||
+        tempTrie.dataLength<UCPTRIE_HIGH_VALUE_NEG_DATA_OFFSET ||
+        tempTrie.dataLength>UCPTRIE_MAX_DATA_LENGTH ||
+        tempTrie.highStart<getFastLimit(&tempTrie) || tempTrie.highStart>0x110000 ||
+        (tempTrie.highStart&(UCPTRIE_CP_PER_INDEX_1_ENTRY-1))!=0
+    ) {
+        *pErrorCode=U_INVALID_FORMAT_ERROR;
+        return NULL;
+    }
+
+    /* calculate the actual length */
+    actualLength=(int32_t)sizeof(UCPTrieHeader)+tempTrie.indexLength*2;
+    switch(valueWidth) {
+    case UCPTRIE_VALUE_BITS_16:
+        actualLength+=tempTrie.dataLength*2;
+        break;
+    case UCPTRIE_VALUE_BITS_32:
+        actualLength+=tempTrie.dataLength*4;
+        break;
+    default:
+        actualLength+=tempTrie.dataLength;
+        break;
+    }
+    actualLength=(actualLength+3)&~3;
+    if(length<actualLength) {
+        *pErrorCode=U_INVALID_FORMAT_ERROR;  /* not enough bytes */
+        return NULL;
+    }
+
+    /* allocate the trie */
+    trie=(UCPTrie *)uprv_malloc(sizeof(UCPTrie));
+    if(trie==NULL) {
+        *pErrorCode=U_MEMORY_ALLOCATION_ERROR;
+        return NULL;
+    }
+    uprv_memcpy(trie, &tempTrie, sizeof(tempTrie));
+
+    /* set the pointers to its index and data arrays */
+    p16=(const uint16_t *)(header+1);
+    trie->index=p16;
+    p16+=trie->indexLength;
+    trie->data.ptr0=p16;
+
+    if(pActualLength!=NULL) {
+        *pActualLength=actualLength;
+    }
+    return trie;
+}
+
+U_CAPI void U_EXPORT2
+ucptrie_close(UCPTrie *trie) {
+    if(trie!=NULL) {
+        uprv_free(trie->memory);
+        uprv_free(trie);
+    }
+}
+
+U_CAPI int32_t U_EXPORT2
+ucptrie_toBinary(const UCPTrie *trie, void *data, int32_t capacity, UErrorCode *pErrorCode) {
+    UCPTrieHeader *header;
+    uint8_t *bytes;
+    int32_t dataLengthInBytes, length;
+
+    /* argument check */
+    if(U_FAILURE(*pErrorCode)) {
+        return 0;
+    }
+    if( trie==NULL ||
+        capacity<0 || (capacity>0 && (data==NULL || (U_POINTER_MASK_LSB(data, 3)!=0)))
+    ) {
+        *pErrorCode=U_ILLEGAL_ARGUMENT_ERROR;
+        return 0;
+    }
+
+    switch(trie->valueWidth) {
+    case UCPTRIE_VALUE_BITS_16:
+        dataLengthInBytes=trie->dataLength*2;
+        break;
+    case UCPTRIE_VALUE_BITS_32:
+        dataLengthInBytes=trie->dataLength*4;
+        break;
+    default:
+        dataLengthInBytes=trie->dataLength;
+        break;
+    }
+    length=(int32_t)sizeof(UCPTrieHeader)+trie->indexLength*2+dataLengthInBytes;
+    length=(length+3)&~3;
+    if(capacity<length) {
+        *pErrorCode=U_BUFFER_OVERFLOW_ERROR;
+        return length;
+    }
+
+    /* set the header fields */
+    header=(UCPTrieHeader *)data;
+    header->signature=UCPTRIE_SIG; /* "Tri3" */
+    header->options=(uint16_t)((trie->type<<UCPTRIE_OPTIONS_TYPE_SHIFT)|trie->valueWidth);
+    header->indexLength=(uint16_t)trie->indexLength;
+    header->dataLength=trie->dataLength;
+    header->highStart=trie->highStart;
+
+    /* write the index and data arrays, and pad with 0 */
+    bytes=(uint8_t *)(header+1);
+    uprv_memcpy(bytes, trie->index, trie->indexLength*2);
+    bytes+=trie->indexLength*2;
+    uprv_memcpy(bytes, trie->data.ptr0, dataLengthInBytes);
+    bytes+=dataLengthInBytes;
+    while(bytes<(uint8_t *)data+length) {
+        *bytes++=0;
+    }
+    return length;
+}
+
+U_CAPI int32_t U_EXPORT2
+ucptrie_swap(const UDataSwapper *ds,
+             const void *inData, int32_t length, void *outData,
+             UErrorCode *pErrorCode) {
+    const UCPTrieHeader *inTrie;
+    UCPTrieHeader trie;
+    int32_t dataLengthInBytes, size;
+    UCPTrieType type;
+    UCPTrieValueWidth valueWidth;
+
+    if(U_FAILURE(*pErrorCode)) {
+        return 0;
+    }
+    if(ds==NULL || inData==NULL || (length>=0 && outData==NULL)) {
+        *pErrorCode=U_ILLEGAL_ARGUMENT_ERROR;
+        return 0;
+    }
+
+    /* setup and swapping */
+    if(length>=0 && length<(int32_t)sizeof(UCPTrieHeader)) {
+        *pErrorCode=U_INDEX_OUTOFBOUNDS_ERROR;
+        return 0;
+    }
+
+    inTrie=(const UCPTrieHeader *)inData;
+    trie.signature=ds->readUInt32(inTrie->signature);
+    trie.options=ds->readUInt16(inTrie->options);
+    trie.indexLength=ds->readUInt16(inTrie->indexLength);
+    trie.dataLength=(int32_t)ds->readUInt32((uint32_t)inTrie->dataLength);
+
+    type=(UCPTrieType)(trie.options>>UCPTRIE_OPTIONS_TYPE_SHIFT);
+    valueWidth=(UCPTrieValueWidth)(trie.options&UCPTRIE_OPTIONS_VALUE_BITS_MASK);
+
+    if( trie.signature!=UCPTRIE_SIG ||
+        (trie.options&UCPTRIE_OPTIONS_RESERVED_MASK)!=0 ||
+        type<0 || UCPTRIE_TYPE_COUNT<=type ||
+        valueWidth<0 || UCPTRIE_VALUE_BITS_COUNT<=valueWidth ||
+        trie.indexLength<UCPTRIE_SMALL_INDEX_LENGTH ||
+        trie.dataLength<UCPTRIE_HIGH_VALUE_NEG_DATA_OFFSET
+    ) {
+        *pErrorCode=U_INVALID_FORMAT_ERROR; /* not a UCPTrie */
+        return 0;
+    }
+
+    switch(valueWidth) {
+    case UCPTRIE_VALUE_BITS_16:
+        dataLengthInBytes=trie.dataLength*2;
+        break;
+    case UCPTRIE_VALUE_BITS_32:
+        dataLengthInBytes=trie.dataLength*4;
+        break;
+    default:
+        dataLengthInBytes=trie.dataLength;
+        break;
+    }
+    size=(int32_t)sizeof(UCPTrieHeader)+trie.indexLength*2+dataLengthInBytes;
+    size=(size+3)&~3;
+
+    if(length>=0) {
+        UCPTrieHeader *outTrie;
+        const uint16_t *inIndex;
+        uint16_t *outIndex;
+
+        if(length<size) {
+            *pErrorCode=U_INDEX_OUTOFBOUNDS_ERROR;
+            return 0;
+        }
+
+        outTrie=(UCPTrieHeader *)outData;
+
+        /* swap the header */
+        ds->swapArray32(ds, &inTrie->signature, 4, &outTrie->signature, pErrorCode);
+        ds->swapArray16(ds, &inTrie->options, 4, &outTrie->options, pErrorCode);
+        ds->swapArray32(ds, &inTrie->dataLength, 8, &outTrie->dataLength, pErrorCode);
+
+        /* swap the index and the data */
+        inIndex=(const uint16_t *)(inTrie+1);
+        outIndex=(uint16_t *)(outTrie+1);
+        ds->swapArray16(ds, inIndex, trie.indexLength*2, outIndex, pErrorCode);
+        switch(valueWidth) {
+        case UCPTRIE_VALUE_BITS_16:
+            ds->swapArray16(ds, inIndex+trie.indexLength, dataLengthInBytes,
+                                outIndex+trie.indexLength, pErrorCode);
+            break;
+        case UCPTRIE_VALUE_BITS_32:
+            ds->swapArray32(ds, inIndex+trie.indexLength, dataLengthInBytes,
+                                outIndex+trie.indexLength, pErrorCode);
+            break;
+        default:
+            if(inTrie!=outTrie) {
+                uprv_memmove(outIndex+trie.indexLength, inIndex+trie.indexLength, dataLengthInBytes);
+            }
+            break;
+        }
+
+        /* copy the padding */
+        if(inTrie!=outTrie) {
+            int32_t unpaddedSize=(int32_t)sizeof(UCPTrieHeader)+trie.indexLength*2+dataLengthInBytes;
+            uprv_memmove((char *)outTrie+unpaddedSize, (const char *)inTrie+unpaddedSize,
+                         size-unpaddedSize);
+        }
+    }
+
+    return size;
+}
+
+/* enumeration -------------------------------------------------------------- */
+
+/* default UTrie2EnumValue() returns the input value itself */
+static uint32_t U_CALLCONV
+enumSameValue(const void * /*context*/, uint32_t value) {
+    return value;
+}
+
+namespace {
+
+/**
+ * Accumulates ranges of code points with the same (transformed) value
+ * and calls the UTrie2EnumRange function for each.
+ */
+struct RangeEnumerator {
+    RangeEnumerator(const UCPTrie *t, UTrie2EnumValue *ev, UTrie2EnumRange *er, const void *ctx) :
+        trie(t), enumValue(ev), enumRange(er), context(ctx),
+        prevBlock(-1), prevBlockLength(0), prevBlockValue(0),
+        start(0), value(0), stopped(FALSE) {}
+
+    /**
+     * Adds the code points [c..c+blockLength[ with the data block at dataIndex.
+     * If they all have the same value, then the block is remembered
+     * so that further code points with the same data block are skipped quickly.
+     */
+    void addBlock(UChar32 c, int32_t dataIndex, int32_t blockLength) {
+        if(dataIndex==prevBlock && blockLength==prevBlockLength && prevBlockValue==value) {
+            return;  // the whole block has the current value
+        }
+        for(int32_t i=0; i<blockLength; ++i) {
+            add(c+i, getValue(trie, dataIndex+i));
+            if(stopped) {
+                return;
+            }
+        }
+        if(start<=c) {
+            // The whole block is in the current range.
+            prevBlock=dataIndex;
+            prevBlockLength=blockLength;
+            prevBlockValue=value;
+        } else {
+            prevBlock=-1;
+        }
+    }
+
+    /** Adds the code point c with the raw value rawValue. */
+    void add(UChar32 c, uint32_t rawValue) {
+        uint32_t v=enumValue(context, rawValue);
+        if(c==0) {
+            value=v;
+        } else if(v!=value) {
+            if(!enumRange(context, start, c-1, value)) {
+                stopped=TRUE;
+            }
+            start=c;
+            value=v;
+        }
+    }
+
+    /** Adds the range [c..0x10ffff] with the raw value rawValue and finishes. */
+    void finish(UChar32 c, uint32_t rawValue) {
+        if(c<=0x10ffff) {
+            add(c, rawValue);
+            if(stopped) {
+                return;
+            }
+        }
+        enumRange(context, start, 0x10ffff, value);
+    }
+
+    const UCPTrie *trie;
+    UTrie2EnumValue *enumValue;
+    UTrie2EnumRange *enumRange;
+    const void *context;
+    int32_t prevBlock, prevBlockLength;
+    uint32_t prevBlockValue;
+    UChar32 start;
+    uint32_t value;
+    UBool stopped;
+};
+
+}  // namespace
+
+U_CAPI void U_EXPORT2
+ucptrie_enum(const UCPTrie *trie,
+             UTrie2EnumValue *enumValue, UTrie2EnumRange *enumRange, const void *context) {
+    if(enumRange==NULL) {
+        return;
+    }
+    if(enumValue==NULL) {
+        enumValue=enumSameValue;
+    }
+    RangeEnumerator e(trie, enumValue, enumRange, context);
+    int32_t fastLimit=getFastLimit(trie);
+    UChar32 c;
+    for(c=0; c<fastLimit; c+=UCPTRIE_FAST_DATA_BLOCK_LENGTH) {
+        e.addBlock(c, trie->index[c>>UCPTRIE_FAST_SHIFT], UCPTRIE_FAST_DATA_BLOCK_LENGTH);
+        if(e.stopped) {
+            return;
+        }
+    }
+    int32_t i1=(fastLimit>>UCPTRIE_FAST_SHIFT)-(fastLimit>>UCPTRIE_SHIFT_1);
+    for(; c<trie->highStart; c+=UCPTRIE_SMALL_DATA_BLOCK_LENGTH) {
+        int32_t i2=trie->index[i1+(c>>UCPTRIE_SHIFT_1)]+((c>>UCPTRIE_SHIFT_2)&UCPTRIE_INDEX_2_MASK);
+        e.addBlock(c, trie->index[i2], UCPTRIE_SMALL_DATA_BLOCK_LENGTH);
+        if(e.stopped) {
+            return;
+        }
+    }
+    e.finish(c, getValue(trie, trie->dataLength-UCPTRIE_HIGH_VALUE_NEG_DATA_OFFSET));
+}
@@ -0,0 +1,497 @@
+/*
+******************************************************************************
+*
+*   Copyright (C) 2016, International Business Machines
+*   Corporation and others.  All Rights Reserved.
+*
+******************************************************************************
+*   file name:  ucptrie.h
+*   encoding:   US-ASCII
+*   tab size:   8 (not used)
+*   indentation:4
+*
+*   created on: 2016jan12 (starting from a copy of utrie2.h)
+*/
+
+#ifndef __UCPTRIE_H__
+#define __UCPTRIE_H__
+
+#include "unicode/utypes.h"
+#include "utrie2.h"
+
+U_CDECL_BEGIN
+
+/**
+ * \file
+ *
+ * This is a code point trie: a kind of compressed, serializable table
+ * of 8-, 16- or 32-bit values associated with Unicode code points (0..0x10ffff).
+ * (A map from code points to integers.)
+ *
+ * Compared with UTrie2:
+ * - There are no separate values for lead surrogate code _units_,
+ *   and there is no special UTF-8 support in the data layout.
+ * - The data is always in its own array, separate from the index.
+ *   Index values are data offsets; they are not shifted.
+ * - There are two types of tries:
+ *   The "fast" type splits all BMP code points 10:6 bits into
+ *   one index and one data table lookup, without any further range checks.
+ *   The "small" type does this only for code points below U+1000
+ *   and is otherwise smaller.
+ * - Code points from the end of the fast range up to highStart
+ *   use a three-table lookup (two index tables and one data table)
+ *   with small data blocks of 16 values, which compact better
+ *   than the 32-value UTrie2 data blocks.
+ * - For the last single-value code point range (ending with U+10ffff),
+ *   the starting code point ("highStart") and the value are stored.
+ * - Data values can be 8 bits wide.
+ *
+ * A trie is built with a UMutableCPTrie and then made immutable
+ * with umutablecptrie_buildImmutable().
+ */
+
+/**
+ * Immutable trie structure.
+ * Use only with public API macros and functions.
+ */
+struct UCPTrie;
+typedef struct UCPTrie UCPTrie;
+
+/**
+ * Selectors for the type of a UCPTrie.
+ */
+enum UCPTrieType {
+    /**
+     * Fast/simple/larger BMP data structure.
+     * Use the UCPTRIE_FAST_... macros.
+     */
+    UCPTRIE_TYPE_FAST,
+    /**
+     * Small/slower BMP data structure.
+     * Use the UCPTRIE_SMALL_... macros.
+     */
+    UCPTRIE_TYPE_SMALL,
+    /** Number of trie types. */
+    UCPTRIE_TYPE_COUNT
+};
+typedef enum UCPTrieType UCPTrieType;
+
+/**
+ * Selectors for the width of a UCPTrie data value.
+ */
+enum UCPTrieValueWidth {
+    /** 16 bits per UCPTrie data value. */
+    UCPTRIE_VALUE_BITS_16,
+    /** 32 bits per UCPTrie data value. */
+    UCPTRIE_VALUE_BITS_32,
+    /**
+     * 8 bits per UCPTrie data value.
+     * The index is still 16-bit.
+     */
+    UCPTRIE_VALUE_BITS_8,
+    /** Number of selectors for the width of UCPTrie data values. */
+    UCPTRIE_VALUE_BITS_COUNT
+};
+typedef enum UCPTrieValueWidth UCPTrieValueWidth;
+
+/**
+ * Open an immutable trie from its serialized from, stored in 32-bit-aligned memory.
+ * Inverse of ucptrie_toBinary().
+ * The memory must remain valid and unchanged as long as the trie is used.
+ * You must ucptrie_close() the trie once you are done using it.
+ *
+ * @param type selects the trie type; results in an
+ *             U_INVALID_FORMAT_ERROR if it does not match the serialized form
+ * @param valueWidth selects the data entry size; results in an
+ *                   U_INVALID_FORMAT_ERROR if it does not match the serialized form
+ * @param data a pointer to 32-bit-aligned memory containing the serialized form of a UCPTrie
+ * @param length the number of bytes available at data;
+ *               can be more than necessary
+ * @param pActualLength receives the actual number of bytes at data taken up by the trie data;
+ *                      can be NULL
+ * @param pErrorCode an in/out ICU UErrorCode
+ * @return the trie
+ *
+ * @see umutablecptrie_buildImmutable
+ * @see ucptrie_toBinary
+ */
+U_CAPI UCPTrie * U_EXPORT2
+ucptrie_openFromBinary(UCPTrieType type, UCPTrieValueWidth valueWidth,
+                       const void *data, int32_t length, int32_t *pActualLength,
+                       UErrorCode *pErrorCode);
+
+/**
+ * Close a trie and release associated memory.
+ *
+ * @param trie the trie
+ */
+U_CAPI void U_EXPORT2
+ucptrie_close(UCPTrie *trie);
+
+/**
+ * Get a value from a code point as stored in the trie.
+ * Easier to use than the UCPTRIE_FAST_GET() and UCPTRIE_SMALL_GET() macros
+ * but slower: This function works on all UCPTrie objects,
+ * of either type and with any value width.
+ *
+ * @param trie the trie
+ * @param c the code point
+ * @return the value, or the error value if c is not in the range 0..U+10ffff
+ */
+U_CAPI uint32_t U_EXPORT2
+ucptrie_get(const UCPTrie *trie, UChar32 c);
+
+/**
+ * Enumerate efficiently all values in a trie.
+ * Works just like utrie2_enum(), with the same callback functions:
+ *
+ * For each entry in the trie, the value to be delivered is passed through
+ * the UTrie2EnumValue function.
+ * The value is unchanged if that function pointer is NULL.
+ *
+ * For each contiguous range of code points with a given (transformed) value,
+ * the UTrie2EnumRange function is called.
+ *
+ * @param trie a pointer to the trie
+ * @param enumValue a pointer to a function that may transform the trie entry value,
+ *                  or NULL if the values from the trie are to be used directly
+ * @param enumRange a pointer to a function that is called for each contiguous range
+ *                  of code points with the same (transformed) value
+ * @param context an opaque pointer that is passed on to the callback functions
+ */
+U_CAPI void U_EXPORT2
+ucptrie_enum(const UCPTrie *trie,
+             UTrie2EnumValue *enumValue, UTrie2EnumRange *enumRange, const void *context);
+
+/**
+ * Serialize a trie into 32-bit aligned memory.
+ *
+ * @param trie the trie
+ * @param data a pointer to 32-bit-aligned memory to be filled with the trie data,
+ *             can be NULL if capacity==0
+ * @param capacity the number of bytes available at data,
+ *                 or 0 for preflighting
+ * @param pErrorCode an in/out ICU UErrorCode; among other possible error codes:
+ * - U_BUFFER_OVERFLOW_ERROR if the data storage block is too small for serialization
+ * - U_ILLEGAL_ARGUMENT_ERROR if the data and capacity parameters are bad
+ * @return the number of bytes written or needed for the trie
+ *
+ * @see ucptrie_openFromBinary()
+ */
+U_CAPI int32_t U_EXPORT2
+ucptrie_toBinary(const UCPTrie *trie, void *data, int32_t capacity, UErrorCode *pErrorCode);
+
+/**
+ * Swap a serialized UCPTrie.
+ * @internal
+ */
+U_CAPI int32_t U_EXPORT2
+ucptrie_swap(const UDataSwapper *ds,
+             const void *inData, int32_t length, void *outData,
+             UErrorCode *pErrorCode);
+
+/* Building a trie ---------------------------------------------------------- */
+
+/**
+ * Mutable trie structure, used only for building a UCPTrie.
+ */
+struct UMutableCPTrie;
+typedef struct UMutableCPTrie UMutableCPTrie;
+
+/**
+ * Open an empty, mutable trie. 32-bit data values are used while building.
+ * umutablecptrie_buildImmutable() takes a valueWidth parameter
+ * which determines the data value width of the immutable trie.
+ * You must umutablecptrie_close() the trie once you are done using it.
+ *
+ * @param initialValue the initial value that is set for all code points
+ * @param errorValue the value for out-of-range code points
+ * @param pErrorCode an in/out ICU UErrorCode
+ * @return the trie
+ */
+U_CAPI UMutableCPTrie * U_EXPORT2
+umutablecptrie_open(uint32_t initialValue, uint32_t errorValue, UErrorCode *pErrorCode);
+
+/**
+ * Open a mutable trie with the code point values of a UTrie2.
+ * The lead surrogate code unit values of the UTrie2 are not used.
+ * You must umutablecptrie_close() the trie once you are done using it.
+ *
+ * @param trie2 the UTrie2 whose values are copied
+ * @param pErrorCode an in/out ICU UErrorCode
+ * @return the trie
+ */
+U_CAPI UMutableCPTrie * U_EXPORT2
+umutablecptrie_fromUTrie2(const UTrie2 *trie2, UErrorCode *pErrorCode);
+
+/**
+ * Close a mutable trie and release associated memory.
+ *
+ * @param trie the trie
+ */
+U_CAPI void U_EXPORT2
+umutablecptrie_close(UMutableCPTrie *trie);
+
+/**
+ * Get the value for a code point.
+ *
+ * @param trie the trie
+ * @param c the code point
+ * @return the value, or the error value if c is not in the range 0..U+10ffff
+ */
+U_CAPI uint32_t U_EXPORT2
+umutablecptrie_get(const UMutableCPTrie *trie, UChar32 c);
+
+/**
+ * Set a value for a code point.
+ *
+ * @param trie the trie
+ * @param c the code point
+ * @param value the value
+ * @param pErrorCode an in/out ICU UErrorCode; among other possible error codes:
+ * - U_ILLEGAL_ARGUMENT_ERROR if c is not in the range 0..U+10ffff
+ */
+U_CAPI void U_EXPORT2
+umutablecptrie_set(UMutableCPTrie *trie, UChar32 c, uint32_t value, UErrorCode *pErrorCode);
+
+/**
+ * Set a value for each code point in [start..end].
+ *
+ * @param trie the trie
+ * @param start the first code point to get the value
+ * @param end the last code point to get the value (inclusive)
+ * @param value the value
+ * @param pErrorCode an in/out ICU UErrorCode; among other possible error codes:
+ * - U_ILLEGAL_ARGUMENT_ERROR if start or end is not in the range 0..U+10ffff
+ *                            or if start>end
+ */
+U_CAPI void U_EXPORT2
+umutablecptrie_setRange(UMutableCPTrie *trie,
+                        UChar32 start, UChar32 end,
+                        uint32_t value, UErrorCode *pErrorCode);
+
+/**
+ * Compact the data and build an immutable trie.
+ * The mutable trie is not modified and can be used for building more tries.
+ * You must ucptrie_close() the immutable trie once you are done using it.
+ *
+ * @param trie the mutable trie
+ * @param type selects the trie type
+ * @param valueWidth selects the data entry size; if smaller than 32 bits, then
+ *                   the values stored in the trie will be truncated
+ * @param pErrorCode an in/out ICU UErrorCode; among other possible error codes:
+ * - U_INDEX_OUTOFBOUNDS_ERROR if the compacted index or data arrays are too long
+ *                             for 16-bit index values
+ * @return the immutable trie
+ */
+U_CAPI UCPTrie * U_EXPORT2
+umutablecptrie_buildImmutable(const UMutableCPTrie *trie,
+                              UCPTrieType type, UCPTrieValueWidth valueWidth,
+                              UErrorCode *pErrorCode);
+
+/* Public UCPTrie API macros ------------------------------------------------ */
+
+/*
+ * The dataAccess parameter of the following macros is one of
+ * UCPTRIE_16, UCPTRIE_32 or UCPTRIE_8, and must match the trie's value width.
+ */
+
+/** Returns a 16-bit data value from the trie's data array. */
+#define UCPTRIE_16(trie, i) ((trie)->data.ptr16[i])
+
+/** Returns a 32-bit data value from the trie's data array. */
+#define UCPTRIE_32(trie, i) ((trie)->data.ptr32[i])
+
+/** Returns an 8-bit data value from the trie's data array. */
+#define UCPTRIE_8(trie, i) ((trie)->data.ptr8[i])
+
+/**
+ * Return a trie value from a code point, with range checking.
+ * Returns the trie error value if c is not in the range 0..U+10ffff.
+ *
+ * @param trie (const UCPTrie *, in) the trie; must have type UCPTRIE_TYPE_FAST
+ * @param dataAccess UCPTRIE_16, UCPTRIE_32, or UCPTRIE_8 according to the trie's value width
+ * @param c (UChar32, in) the input code point
+ * @return The code point's trie value.
+ */
+#define UCPTRIE_FAST_GET(trie, dataAccess, c) dataAccess(trie, _UCPTRIE_CP_INDEX(trie, 0xffff, c))
+
+/**
+ * Return a trie value from a code point, with range checking.
+ * Returns the trie error value if c is not in the range 0..U+10ffff.
+ *
+ * @param trie (const UCPTrie *, in) the trie; must have type UCPTRIE_TYPE_SMALL
+ * @param dataAccess UCPTRIE_16, UCPTRIE_32, or UCPTRIE_8 according to the trie's value width
+ * @param c (UChar32, in) the input code point
+ * @return The code point's trie value.
+ */
+#define UCPTRIE_SMALL_GET(trie, dataAccess, c) \
+    dataAccess(trie, _UCPTRIE_CP_INDEX(trie, UCPTRIE_SMALL_MAX, c))
+
+/**
+ * Return a trie value from a BMP code point (U+0000..U+ffff), without range checking.
+ * Surrogate code points get their own values, like any other BMP code point.
+ *
+ * @param trie (const UCPTrie *, in) the trie; must have type UCPTRIE_TYPE_FAST
+ * @param dataAccess UCPTRIE_16, UCPTRIE_32, or UCPTRIE_8 according to the trie's value width
+ * @param c (UChar32, in) the input code point, must be U+0000<=c<=U+ffff
+ * @return The code point's trie value.
+ */
+#define UCPTRIE_FAST_BMP_GET(trie, dataAccess, c) dataAccess(trie, _UCPTRIE_FAST_INDEX(trie, c))
+
+/**
+ * Return a trie value from a supplementary code point (U+10000..U+10ffff).
+ *
+ * @param trie (const UCPTrie *, in) the trie; must have type UCPTRIE_TYPE_FAST
+ * @param dataAccess UCPTRIE_16, UCPTRIE_32, or UCPTRIE_8 according to the trie's value width
+ * @param c (UChar32, in) the input code point, must be U+10000<=c<=U+10ffff
+ * @return The code point's trie value.
+ */
+#define UCPTRIE_FAST_SUPP_GET(trie, dataAccess, c) \
+    dataAccess(trie, \
+               (c)>=(trie)->highStart ? \
+                   (trie)->dataLength-UCPTRIE_HIGH_VALUE_NEG_DATA_OFFSET : \
+                   _UCPTRIE_SMALL_INDEX(trie, 0xffff, c))
+
+/**
+ * UTF-16: Get the next code point (UChar32 c, out), post-increment src,
+ * and get a value from the trie.
+ * An unpaired surrogate gets the value of its surrogate code point.
+ *
+ * @param trie (const UCPTrie *, in) the trie; must have type UCPTRIE_TYPE_FAST
+ * @param dataAccess UCPTRIE_16, UCPTRIE_32, or UCPTRIE_8 according to the trie's value width
+ * @param src (const UChar *, in/out) the source text pointer
+ * @param limit (const UChar *, in) the limit pointer for the text, or NULL if NUL-terminated
+ * @param c (UChar32, out) variable for the code point
+ * @param result (out) variable for the trie lookup result
+ */
+#define UCPTRIE_FAST_U16_NEXT(trie, dataAccess, src, limit, c, result) { \
+    (c)=*(src)++; \
+    if(!U16_IS_LEAD(c) || (src)==(limit) || !U16_IS_TRAIL(*(src))) { \
+        (result)=UCPTRIE_FAST_BMP_GET(trie, dataAccess, c); \
+    } else { \
+        (c)=U16_GET_SUPPLEMENTARY((c), *(src)++); \
+        (result)=UCPTRIE_FAST_SUPP_GET(trie, dataAccess, c); \
+    } \
+}
+
+/* Internal definitions ----------------------------------------------------- */
+
+/*
+ * Trie structure definition.
+ *
+ * The index is always 16 bits wide.
+ * The data array is 8, 16 or 32 bits wide according to the valueWidth.
+ * Its last two values are the highValue and the errorValue.
+ */
+struct UCPTrie {
+    /* protected: used by macros and functions for reading values */
+    const uint16_t *index;
+    union {
+        const void *ptr0;
+        const uint16_t *ptr16;
+        const uint32_t *ptr32;
+        const uint8_t *ptr8;
+    } data;
+
+    int32_t indexLength, dataLength;
+    /** Start of the last range which ends at U+10ffff. */
+    UChar32 highStart;
+
+    int8_t type;            /* UCPTrieType */
+    int8_t valueWidth;      /* UCPTrieValueWidth */
+    int16_t padding;
+
+    /* private: used by the builder and unserialization functions */
+    void *memory;           /* owned memory; NULL if the arrays are not owned */
+};
+
+/**
+ * Trie constants, defining shift widths, index array lengths, etc.
+ *
+ * These are needed for the runtime macros but users can treat these as
+ * implementation details and skip to the actual public API further above.
+ */
+enum {
+    /** Shift size for getting the index of a fast-type data block. */
+    UCPTRIE_FAST_SHIFT=6,
+
+    /** Number of entries in a fast-type data block. 64=0x40 */
+    UCPTRIE_FAST_DATA_BLOCK_LENGTH=1<<UCPTRIE_FAST_SHIFT,
+
+    /** Mask for getting the lower bits for the in-fast-data-block offset. */
+    UCPTRIE_FAST_DATA_MASK=UCPTRIE_FAST_DATA_BLOCK_LENGTH-1,
+
+    /** Number of index entries for the BMP in a fast-type trie. 1024=0x400 */
+    UCPTRIE_BMP_INDEX_LENGTH=0x10000>>UCPTRIE_FAST_SHIFT,
+
+    /** The small-type trie uses the fast-type lookup below this code point. */
+    UCPTRIE_SMALL_LIMIT=0x1000,
+    UCPTRIE_SMALL_MAX=UCPTRIE_SMALL_LIMIT-1,
+
+    /** Number of fast-type index entries in a small-type trie. 64=0x40 */
+    UCPTRIE_SMALL_INDEX_LENGTH=UCPTRIE_SMALL_LIMIT>>UCPTRIE_FAST_SHIFT,
+
+    /** Shift size for getting the index-1 table offset. */
+    UCPTRIE_SHIFT_1=10,
+
+    /** Shift size for getting the index-2 table offset. */
+    UCPTRIE_SHIFT_2=4,
+
+    /** Number of code points per index-1 table entry. 1024=0x400 */
+    UCPTRIE_CP_PER_INDEX_1_ENTRY=1<<UCPTRIE_SHIFT_1,
+
+    /** Number of entries in an index-2 block. 64=0x40 */
+    UCPTRIE_INDEX_2_BLOCK_LENGTH=1<<(UCPTRIE_SHIFT_1-UCPTRIE_SHIFT_2),
+
+    /** Mask for getting the lower bits for the in-index-2-block offset. */
+    UCPTRIE_INDEX_2_MASK=UCPTRIE_INDEX_2_BLOCK_LENGTH-1,
+
+    /** Number of entries in a small data block. 16=0x10 */
+    UCPTRIE_SMALL_DATA_BLOCK_LENGTH=1<<UCPTRIE_SHIFT_2,
+
+    /** Mask for getting the lower bits for the in-small-data-block offset. */
+    UCPTRIE_SMALL_DATA_MASK=UCPTRIE_SMALL_DATA_BLOCK_LENGTH-1,
+
+    /** Offset from dataLength (to be subtracted) for fetching the value returned for out-of-range code points. */
+    UCPTRIE_ERROR_VALUE_NEG_DATA_OFFSET=1,
+
+    /** Offset from dataLength (to be subtracted) for fetching the value for code points >= highStart. */
+    UCPTRIE_HIGH_VALUE_NEG_DATA_OFFSET=2
+};
+
+/* Internal functions and macros -------------------------------------------- */
+
+/** Internal trie getter from a code point in the fast range. Returns the data index. */
+#define _UCPTRIE_FAST_INDEX(trie, c) \
+    ((int32_t)(trie)->index[(c)>>UCPTRIE_FAST_SHIFT]+((c)&UCPTRIE_FAST_DATA_MASK))
+
+/**
+ * Internal trie getter from a code point at or above the fast range (above fastMax)
+ * and below highStart. Returns the data index.
+ * The index-1 table follows the fast-range index entries
+ * and starts with the entry for the first code point after the fast range.
+ */
+#define _UCPTRIE_SMALL_INDEX(trie, fastMax, c) \
+    ((int32_t)(trie)->index[ \
+        (trie)->index[(((fastMax)+1)>>UCPTRIE_FAST_SHIFT)-(((fastMax)+1)>>UCPTRIE_SHIFT_1)+ \
+                      ((c)>>UCPTRIE_SHIFT_1)]+ \
+        (((c)>>UCPTRIE_SHIFT_2)&UCPTRIE_INDEX_2_MASK)]+ \
+    ((c)&UCPTRIE_SMALL_DATA_MASK))
+
+/**
+ * Internal trie getter from a code point, with checking that c is in 0..10FFFF.
+ * Returns the data index.
+ */
+#define _UCPTRIE_CP_INDEX(trie, fastMax, c) \
+    ((uint32_t)(c)<=(uint32_t)(fastMax) ? \
+        _UCPTRIE_FAST_INDEX(trie, c) : \
+        (uint32_t)(c)<=0x10ffff ? \
+            ((c)>=(trie)->highStart ? \
+                (trie)->dataLength-UCPTRIE_HIGH_VALUE_NEG_DATA_OFFSET : \
+                _UCPTRIE_SMALL_INDEX(trie, fastMax, c)) : \
+            (trie)->dataLength-UCPTRIE_ERROR_VALUE_NEG_DATA_OFFSET)
+
+U_CDECL_END
+
+#endif
@@ -0,0 +1,552 @@
+/*
+******************************************************************************
+*
+*   Copyright (C) 2016, International Business Machines
+*   Corporation and others.  All Rights Reserved.
+*
+******************************************************************************
+*   file name:  ucptrie_builder.cpp
+*   encoding:   US-ASCII
+*   tab size:   8 (not used)
+*   indentation:4
+*
+*   created on: 2016jan12 (starting from a copy of utrie2_builder.cpp)
+*
+*   This is a common implementation of a Unicode trie.
+*   It is a kind of compressed, serializable table of 8-, 16- or 32-bit values
+*   associated with Unicode code points (0..0x10ffff).
+*   See ucptrie.h for a comparison with UTrie2.
+*
+*   This file contains only the builder code.
+*   See ucptrie.cpp for the runtime and enumeration code.
+*/
+
+#include "unicode/utypes.h"
+#include "cmemory.h"
+#include "ucptrie.h"
+#include "ucptrie_impl.h"
+#include "utrie2.h"
+
+U_NAMESPACE_USE
+
+/* Building a trie ----------------------------------------------------------*/
+
+enum {
+    /** Number of small data blocks (16 code points each) for all of Unicode. */
+    UMUTABLECPTRIE_BLOCK_COUNT=0x110000>>UCPTRIE_SHIFT_2,
+
+    /** The block's code points all have the value in the index entry. */
+    UMUTABLECPTRIE_ALL_SAME=0,
+    /** The index entry is the offset of the block's values in the data array. */
+    UMUTABLECPTRIE_MIXED=1
+};
+
+/*
+ * Build-time trie structure.
+ *
+ * Each block of 16 code points either has a single value
+ * stored directly in the index, or its own 16 values in the data array.
+ * When a whole block is set to a single value again, its data values
+ * are abandoned; they are never compacted at build time
+ * because the immutable trie is always built from the per-code point values.
+ */
+struct UMutableCPTrie {
+    uint32_t *data;
+    int32_t dataCapacity, dataLength;
+    uint32_t initialValue, errorValue;
+
+    uint32_t index[UMUTABLECPTRIE_BLOCK_COUNT];
+    uint8_t flags[UMUTABLECPTRIE_BLOCK_COUNT];
+};
+
+U_CAPI UMutableCPTrie * U_EXPORT2
+umutablecptrie_open(uint32_t initialValue, uint32_t errorValue, UErrorCode *pErrorCode) {
+    UMutableCPTrie *trie;
+    int32_t i;
+
+    if(U_FAILURE(*pErrorCode)) {
+        return NULL;
+    }
+
+    trie=(UMutableCPTrie *)uprv_malloc(sizeof(UMutableCPTrie));
+    if(trie==NULL) {
+        *pErrorCode=U_MEMORY_ALLOCATION_ERROR;
+        return NULL;
+    }
+    trie->data=NULL;
+    trie->dataCapacity=trie->dataLength=0;
+    trie->initialValue=initialValue;
+    trie->errorValue=errorValue;
+    for(i=0; i<UMUTABLECPTRIE_BLOCK_COUNT; ++i) {
+        trie->index[i]=initialValue;
+    }
+    uprv_memset(trie->flags, UMUTABLECPTRIE_ALL_SAME, sizeof(trie->flags));
+    return trie;
+}
+
+/* UTrie2EnumRange() callback, copies a range of values */
+static UBool U_CALLCONV
+copyRange(const void *context, UChar32 start, UChar32 end, uint32_t value) {
+    UMutableCPTrie *trie=(UMutableCPTrie *)context;
+    UErrorCode errorCode=U_ZERO_ERROR;
+    if(value!=trie->initialValue) {
+        umutablecptrie_setRange(trie, start, end, value, &errorCode);
+    }
+    if(U_FAILURE(errorCode)) {
+        /* signal the caller to check for a failed allocation */
+        trie->dataCapacity=-1;
+        return FALSE;
+    }
+    return TRUE;
+}
+
+U_CAPI UMutableCPTrie * U_EXPORT2
+umutablecptrie_fromUTrie2(const UTrie2 *trie2, UErrorCode *pErrorCode) {
+    UMutableCPTrie *trie;
+
+    if(U_FAILURE(*pErrorCode)) {
+        return NULL;
+    }
+    if(trie2==NULL) {
+        *pErrorCode=U_ILLEGAL_ARGUMENT_ERROR;
+        return NULL;
+    }
+    trie=umutablecptrie_open(trie2->initialValue, trie2->errorValue, pErrorCode);
+    if(U_FAILURE(*pErrorCode)) {
+        return NULL;
+    }
+    utrie2_enum(trie2, NULL, copyRange, trie);
+    if(trie->dataCapacity<0) {
+        umutablecptrie_close(trie);
+        *pErrorCode=U_MEMORY_ALLOCATION_ERROR;
+        return NULL;
+    }
+    return trie;
+}
+
+U_CAPI void U_EXPORT2
+umutablecptrie_close(UMutableCPTrie *trie) {
+    if(trie!=NULL) {
+        uprv_free(trie->data);
+        uprv_free(trie);
+    }
+}
+
+U_CAPI uint32_t U_EXPORT2
+umutablecptrie_get(const UMutableCPTrie *trie, UChar32 c) {
+    int32_t block;
+    if((uint32_t)c>0x10ffff) {
+        return trie->errorValue;
+    }
+    block=c>>UCPTRIE_SHIFT_2;
+    if(trie->flags[block]==UMUTABLECPTRIE_ALL_SAME) {
+        return trie->index[block];
+    } else {
+        return trie->data[trie->index[block]+(c&UCPTRIE_SMALL_DATA_MASK)];
+    }
+}
+
+/**
+ * Makes the block with the given index a mixed block with its own data values.
+ * @return FALSE if the data array could not be grown
+ */
+static UBool
+ensureMixedBlock(UMutableCPTrie *trie, int32_t block) {
+    uint32_t *p;
+    uint32_t value;
+    int32_t i;
+
+    if(trie->flags[block]!=UMUTABLECPTRIE_ALL_SAME) {
+        return TRUE;
+    }
+    if((trie->dataLength+UCPTRIE_SMALL_DATA_BLOCK_LENGTH)>trie->dataCapacity) {
+        int32_t capacity;
+        uint32_t *data;
+        if(trie->dataCapacity==0) {
+            capacity=0x4000;
+        } else if(trie->dataCapacity<0x110000) {
+            capacity=2*trie->dataCapacity;
+        } else {
+            capacity=trie->dataCapacity+0x10000;
+        }
+        data=(uint32_t *)uprv_malloc(capacity*4);
+        if(data==NULL) {
+            return FALSE;
+        }
+        if(trie->dataLength>0) {
+            uprv_memcpy(data, trie->data, (size_t)trie->dataLength*4);
+        }
+        uprv_free(trie->data);
+        trie->data=data;
+        trie->dataCapacity=capacity;
+    }
+    value=trie->index[block];
+    p=trie->data+trie->dataLength;
+    for(i=0; i<UCPTRIE_SMALL_DATA_BLOCK_LENGTH; ++i) {
+        p[i]=value;
+    }
+    trie->flags[block]=UMUTABLECPTRIE_MIXED;
+    trie->index[block]=(uint32_t)trie->dataLength;
+    trie->dataLength+=UCPTRIE_SMALL_DATA_BLOCK_LENGTH;
+    return TRUE;
+}
+
+U_CAPI void U_EXPORT2
+umutablecptrie_set(UMutableCPTrie *trie, UChar32 c, uint32_t value, UErrorCode *pErrorCode) {
+    int32_t block;
+
+    if(U_FAILURE(*pErrorCode)) {
+        return;
+    }
+    if((uint32_t)c>0x10ffff) {
+        *pErrorCode=U_ILLEGAL_ARGUMENT_ERROR;
+        return;
+    }
+    block=c>>UCPTRIE_SHIFT_2;
+    if(trie->flags[block]==UMUTABLECPTRIE_ALL_SAME && trie->index[block]==value) {
+        return;
+    }
+    if(!ensureMixedBlock(trie, block)) {
+        *pErrorCode=U_MEMORY_ALLOCATION_ERROR;
+        return;
+    }
+    trie->data[trie->index[block]+(c&UCPTRIE_SMALL_DATA_MASK)]=value;
+}
+
+U_CAPI void U_EXPORT2
+umutablecptrie_setRange(UMutableCPTrie *trie,
+                        UChar32 start, UChar32 end,
+                        uint32_t value, UErrorCode *pErrorCode) {
+    UChar32 limit;
+
+    if(U_FAILURE(*pErrorCode)) {
+        return;
+    }
+    if((uint32_t)start>0x10ffff || (uint32_t)end>0x10ffff || start>end) {
+        *pErrorCode=U_ILLEGAL_ARGUMENT_ERROR;
+        return;
+    }
+    limit=end+1;
+    /* set partial blocks and whole blocks separately */
+    while(start<limit) {
+        int32_t block=start>>UCPTRIE_SHIFT_2;
+        if((start&UCPTRIE_SMALL_DATA_MASK)==0 && (limit-start)>=UCPTRIE_SMALL_DATA_BLOCK_LENGTH) {
+            trie->flags[block]=UMUTABLECPTRIE_ALL_SAME;
+            trie->index[block]=value;
+            start+=UCPTRIE_SMALL_DATA_BLOCK_LENGTH;
+        } else {
+            umutablecptrie_set(trie, start, value, pErrorCode);
+            if(U_FAILURE(*pErrorCode)) {
+                return;
+            }
+            ++start;
+        }
+    }
+}
+
+/* compaction --------------------------------------------------------------- */
+
+namespace {
+
+/**
+ * Finds an earlier occurrence of a block of values in the data array being compacted.
+ * Remembers each position where a window of blockLength values starts,
+ * in an open-addressing hash table keyed by the hash of the window contents.
+ */
+class BlockFinder {
+public:
+    BlockFinder(int32_t blockLen) : blockLength(blockLen), indexedLength(0) {
+        uprv_memset(positions, 0xff, sizeof(positions));  // all -1
+    }
+
+    /** Indexes all windows that fit into the first dataLength values. */
+    void update(const uint32_t *data, int32_t dataLength) {
+        for(; (indexedLength+blockLength)<=dataLength; ++indexedLength) {
+            uint32_t hash=hashBlock(data+indexedLength);
+            int32_t i=(int32_t)(hash&TABLE_MASK);
+            while(positions[i]>=0) {
+                i=(i+1)&TABLE_MASK;
+            }
+            hashes[i]=hash;
+            positions[i]=indexedLength;
+        }
+    }
+
+    /** @return the start of an indexed window with the block's values, or -1 */
+    int32_t find(const uint32_t *data, const uint32_t *block) const {
+        uint32_t hash=hashBlock(block);
+        int32_t i=(int32_t)(hash&TABLE_MASK);
+        while(positions[i]>=0) {
+            if(hashes[i]==hash &&
+                    uprv_memcmp(data+positions[i], block, (size_t)blockLength*4)==0) {
+                return positions[i];
+            }
+            i=(i+1)&TABLE_MASK;
+        }
+        return -1;
+    }
+
+private:
+    enum {
+        // More than twice the maximum data length, for a load factor below 1/2.
+        TABLE_LENGTH=0x20000,
+        TABLE_MASK=TABLE_LENGTH-1
+    };
+
+    uint32_t hashBlock(const uint32_t *p) const {
+        uint32_t hash=0;
+        for(int32_t i=0; i<blockLength; ++i) {
+            hash=(hash*37)+p[i];
+        }
+        return hash*0x9e3779b1;
+    }
+
+    int32_t blockLength;
+    int32_t indexedLength;
+    uint32_t hashes[TABLE_LENGTH];
+    int32_t positions[TABLE_LENGTH];
+};
+
+/**
+ * Compacts the data array: Each data block is stored at most once,
+ * and a new block overlaps with the end of the data so far where possible.
+ */
+class DataCompactor : public UMemory {
+public:
+    DataCompactor() : length(0), fastFinder(UCPTRIE_FAST_DATA_BLOCK_LENGTH),
+                      smallFinder(UCPTRIE_SMALL_DATA_BLOCK_LENGTH) {}
+
+    /**
+     * Adds the block and returns its offset in the compacted data array,
+     * or -1 if the offset does not fit into a 16-bit index entry.
+     */
+    int32_t addBlock(const uint32_t *block, int32_t blockLength) {
+        BlockFinder &finder= blockLength==UCPTRIE_FAST_DATA_BLOCK_LENGTH ? fastFinder : smallFinder;
+        int32_t offset=finder.find(data, block);
+        if(offset>=0) {
+            return offset;
+        }
+        int32_t overlap=blockLength-1;
+        while(overlap>0 &&
+                (overlap>length ||
+                 uprv_memcmp(data+length-overlap, block, (size_t)overlap*4)!=0)) {
+            --overlap;
+        }
+        offset=length-overlap;
+        if(offset>0xffff) {
+            return -1;
+        }
+        for(int32_t i=overlap; i<blockLength; ++i) {
+            data[length++]=block[i];
+        }
+        if(blockLength==UCPTRIE_FAST_DATA_BLOCK_LENGTH) {
+            fastFinder.update(data, length);
+        }
+        smallFinder.update(data, length);
+        return offset;
+    }
+
+    uint32_t data[UCPTRIE_MAX_DATA_LENGTH];
+    int32_t length;
+
+private:
+    BlockFinder fastFinder, smallFinder;
+};
+
+/** Copies the values of the code points [c..c+length[ into block[]. */
+void
+getValues(const UMutableCPTrie *trie, UChar32 c, uint32_t *block, int32_t length) {
+    for(int32_t i=0; i<length; i+=UCPTRIE_SMALL_DATA_BLOCK_LENGTH) {
+        int32_t b=(c+i)>>UCPTRIE_SHIFT_2;
+        if(trie->flags[b]==UMUTABLECPTRIE_ALL_SAME) {
+            uint32_t value=trie->index[b];
+            for(int32_t j=0; j<UCPTRIE_SMALL_DATA_BLOCK_LENGTH; ++j) {
+                block[i+j]=value;
+            }
+        } else {
+            uprv_memcpy(block+i, trie->data+trie->index[b], UCPTRIE_SMALL_DATA_BLOCK_LENGTH*4);
+        }
+    }
+}
+
+/** @return TRUE if all code points in the block have the given value */
+UBool
+isBlockAllValue(const UMutableCPTrie *trie, int32_t b, uint32_t value) {
+    if(trie->flags[b]==UMUTABLECPTRIE_ALL_SAME) {
+        return trie->index[b]==value;
+    }
+    const uint32_t *p=trie->data+trie->index[b];
+    for(int32_t j=0; j<UCPTRIE_SMALL_DATA_BLOCK_LENGTH; ++j) {
+        if(p[j]!=value) {
+            return FALSE;
+        }
+    }
+    return TRUE;
+}
+
+}  // namespace
+
+U_CAPI UCPTrie * U_EXPORT2
+umutablecptrie_buildImmutable(const UMutableCPTrie *trie,
+                              UCPTrieType type, UCPTrieValueWidth valueWidth,
+                              UErrorCode *pErrorCode) {
+    if(U_FAILURE(*pErrorCode)) {
+        return NULL;
+    }
+    if( trie==NULL ||
+        type<0 || UCPTRIE_TYPE_COUNT<=type ||
+        valueWidth<0 || UCPTRIE_VALUE_BITS_COUNT<=valueWidth
+    ) {
+        *pErrorCode=U_ILLEGAL_ARGUMENT_ERROR;
+        return NULL;
+    }
+
+    /*
+     * Find the start of the last range of code points with the same value,
+     * rounded up to the index-1 granularity, but not below the fast range.
+     */
+    UChar32 fastLimit= type==UCPTRIE_TYPE_FAST ? 0x10000 : UCPTRIE_SMALL_LIMIT;
+    uint32_t highValue=umutablecptrie_get(trie, 0x10ffff);
+    int32_t b=UMUTABLECPTRIE_BLOCK_COUNT;
+    while(b>0 && isBlockAllValue(trie, b-1, highValue)) {
+        --b;
+    }
+    UChar32 highStart=
+        ((b<<UCPTRIE_SHIFT_2)+UCPTRIE_CP_PER_INDEX_1_ENTRY-1)&~(UCPTRIE_CP_PER_INDEX_1_ENTRY-1);
+    if(highStart<fastLimit) {
+        highStart=fastLimit;
+    }
+
+    int32_t fastIndexLength=fastLimit>>UCPTRIE_FAST_SHIFT;
+    int32_t index1Length=(highStart-fastLimit)>>UCPTRIE_SHIFT_1;
+    int32_t maxIndexLength=fastIndexLength+index1Length+index1Length*UCPTRIE_INDEX_2_BLOCK_LENGTH;
+    uint16_t *index=(uint16_t *)uprv_malloc(maxIndexLength*2);
+    DataCompactor *compactor=new DataCompactor();
+    if(index==NULL || compactor==NULL) {
+        uprv_free(index);
+        delete compactor;
+        *pErrorCode=U_MEMORY_ALLOCATION_ERROR;
+        return NULL;
+    }
+
+    /* compact the data blocks and fill in the index */
+    uint32_t block[UCPTRIE_FAST_DATA_BLOCK_LENGTH];
+    UChar32 c;
+    int32_t i, offset;
+    for(c=0; c<fastLimit && U_SUCCESS(*pErrorCode); c+=UCPTRIE_FAST_DATA_BLOCK_LENGTH) {
+        getValues(trie, c, block, UCPTRIE_FAST_DATA_BLOCK_LENGTH);
+        offset=compactor->addBlock(block, UCPTRIE_FAST_DATA_BLOCK_LENGTH);
+        if(offset<0) {
+            *pErrorCode=U_INDEX_OUTOFBOUNDS_ERROR;
+        }
+        index[c>>UCPTRIE_FAST_SHIFT]=(uint16_t)offset;
+    }
+    int32_t indexLength=fastIndexLength+index1Length;
+    uint16_t index2Block[UCPTRIE_INDEX_2_BLOCK_LENGTH];
+    for(i=0; i<index1Length && U_SUCCESS(*pErrorCode); ++i) {
+        c=fastLimit+(i<<UCPTRIE_SHIFT_1);
+        for(int32_t j=0; j<UCPTRIE_INDEX_2_BLOCK_LENGTH; ++j) {
+            getValues(trie, c+(j<<UCPTRIE_SHIFT_2), block, UCPTRIE_SMALL_DATA_BLOCK_LENGTH);
+            offset=compactor->addBlock(block, UCPTRIE_SMALL_DATA_BLOCK_LENGTH);
+            if(offset<0) {
+                *pErrorCode=U_INDEX_OUTOFBOUNDS_ERROR;
+                break;
+            }
+            index2Block[j]=(uint16_t)offset;
+        }
+        /* find an identical index-2 block, or one that overlaps with the end */
+        int32_t index2Start=fastIndexLength+index1Length;
+        int32_t i2;
+        for(i2=index2Start; i2<indexLength; ++i2) {
+            int32_t n=indexLength-i2;
+            if(n>UCPTRIE_INDEX_2_BLOCK_LENGTH) {
+                n=UCPTRIE_INDEX_2_BLOCK_LENGTH;
+            }
+            if(uprv_memcmp(index+i2, index2Block, n*2)==0) {
+                break;
+            }
+        }
+        if(i2>0xffff) {
+            *pErrorCode=U_INDEX_OUTOFBOUNDS_ERROR;
+            break;
+        }
+        for(int32_t j=indexLength-i2; j<UCPTRIE_INDEX_2_BLOCK_LENGTH; ++j) {
+            index[indexLength++]=index2Block[j];
+        }
+        index[fastIndexLength+i]=(uint16_t)i2;
+    }
+    if(indexLength>0xffff) {
+        *pErrorCode=U_INDEX_OUTOFBOUNDS_ERROR;
+    }
+    if(U_FAILURE(*pErrorCode)) {
+        uprv_free(index);
+        delete compactor;
+        return NULL;
+    }
+    int32_t dataLength=compactor->length;
+    compactor->data[dataLength++]=highValue;
+    compactor->data[dataLength++]=trie->errorValue;
+
+    /* allocate the immutable trie with its index and data arrays in one block of memory */
+    int32_t dataLengthInBytes;
+    switch(valueWidth) {
+    case UCPTRIE_VALUE_BITS_16:
+        dataLengthInBytes=dataLength*2;
+        break;
+    case UCPTRIE_VALUE_BITS_32:
+        dataLengthInBytes=dataLength*4;
+        break;
+    default:
+        dataLengthInBytes=dataLength;
+        break;
+    }
+    int32_t indexLengthInBytes=((indexLength*2)+3)&~3;  /* align the data */
+    UCPTrie *newTrie=(UCPTrie *)uprv_malloc(sizeof(UCPTrie));
+    uint8_t *memory=(uint8_t *)uprv_malloc(indexLengthInBytes+dataLengthInBytes);
+    if(newTrie==NULL || memory==NULL) {
+        uprv_free(newTrie);
+        uprv_free(memory);
+        uprv_free(index);
+        delete compactor;
+        *pErrorCode=U_MEMORY_ALLOCATION_ERROR;
+        return NULL;
+    }
+    uprv_memset(newTrie, 0, sizeof(UCPTrie));
+    uprv_memcpy(memory, index, indexLength*2);
+    newTrie->index=(const uint16_t *)memory;
+    newTrie->indexLength=indexLength;
+    newTrie->dataLength=dataLength;
+    newTrie->highStart=highStart;
+    newTrie->type=(int8_t)type;
+    newTrie->valueWidth=(int8_t)valueWidth;
+    newTrie->memory=memory;
+
+    const uint32_t *src=compactor->data;
+    switch(valueWidth) {
+    case UCPTRIE_VALUE_BITS_16: {
+        uint16_t *dest16=(uint16_t *)(memory+indexLengthInBytes);
+        for(i=0; i<dataLength; ++i) {
+            dest16[i]=(uint16_t)src[i];
+        }
+        newTrie->data.ptr0=dest16;
+        break;
+    }
+    case UCPTRIE_VALUE_BITS_32: {
+        uint32_t *dest32=(uint32_t *)(memory+indexLengthInBytes);
+        uprv_memcpy(dest32, src, dataLength*4);
+        newTrie->data.ptr0=dest32;
+        break;
+    }
+    default: {
+        uint8_t *dest8=memory+indexLengthInBytes;
+        for(i=0; i<dataLength; ++i) {
+            dest8[i]=(uint8_t)src[i];
+        }
+        newTrie->data.ptr0=dest8;
+        break;
+    }
+    }
+    uprv_free(index);
+    delete compactor;
+    return newTrie;
+}
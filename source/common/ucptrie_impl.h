@@ -0,0 +1,79 @@
+/*
+******************************************************************************
+*
+*   Copyright (C) 2016, International Business Machines
+*   Corporation and others.  All Rights Reserved.
+*
+******************************************************************************
+*   file name:  ucptrie_impl.h
+*   encoding:   US-ASCII
+*   tab size:   8 (not used)
+*   indentation:4
+*
+*   created on: 2016jan12
+*
+*   Definitions needed for both runtime and builder code for UCPTrie,
+*   used by ucptrie.cpp and ucptrie_builder.cpp.
+*/
+
+#ifndef __UCPTRIE_IMPL_H__
+#define __UCPTRIE_IMPL_H__
+
+#include "ucptrie.h"
+
+/*
+ * UCPTrie signature values,
+ * in platform endianness and opposite endianness.
+ */
+#define UCPTRIE_SIG     0x54726933
+#define UCPTRIE_OE_SIG  0x33697254
+
+/**
+ * Trie data structure in serialized form:
+ *
+ * UCPTrieHeader header;
+ * uint16_t index[header.indexLength];
+ * uint16_t data[header.dataLength];  -- or uint32_t or uint8_t data[...]
+ * -- padded to a multiple of 4 bytes
+ * @internal
+ */
+typedef struct UCPTrieHeader {
+    /** "Tri3" in big-endian US-ASCII (0x54726933) */
+    uint32_t signature;
+
+    /**
+     * options bit field:
+     * 15.. 8   reserved (0)
+     *  7.. 4   UCPTrieType type
+     *  3.. 0   UCPTrieValueWidth valueWidth
+     */
+    uint16_t options;
+
+    /** Total length of the index tables. */
+    uint16_t indexLength;
+
+    /** Data length, including the highValue and the errorValue. */
+    int32_t dataLength;
+
+    /** First code point of the single-value range ending with U+10ffff. */
+    int32_t highStart;
+} UCPTrieHeader;
+
+/**
+ * Constants for use with UCPTrieHeader.options.
+ * @internal
+ */
+enum {
+    UCPTRIE_OPTIONS_TYPE_SHIFT=4,
+    UCPTRIE_OPTIONS_VALUE_BITS_MASK=0xf,
+    UCPTRIE_OPTIONS_RESERVED_MASK=0xff00
+};
+
+/**
+ * Maximum data length: All index values are 16-bit data offsets,
+ * the largest one is followed by one data block,
+ * and the highValue and the errorValue are appended.
+ */
+#define UCPTRIE_MAX_DATA_LENGTH (0xffff+UCPTRIE_FAST_DATA_BLOCK_LENGTH+2)
+
+#endif
@@ -1,6 +1,6 @@
 /*
 **********************************************************************
-*   Copyright (C) 1997-2015, International Business Machines
+*   Copyright (C) 1997-2016, International Business Machines
 *   Corporation and others.  All Rights Reserved.
 **********************************************************************
 *
@@ -29,6 +29,8 @@
 */
 
 #include "unicode/utypes.h"
+#include "unicode/bytestrie.h"
+#include "unicode/bytestriebuilder.h"
 #include "unicode/ustring.h"
 #include "unicode/uloc.h"
 
@@ -42,6 +44,7 @@
 #include "uarrsort.h"
 #include "uenumimp.h"
 #include "uassert.h"
+#include "ucln_cmn.h"
 
 #include <stdio.h> /* for sprintf */
 
@@ -1170,6 +1173,107 @@ static int16_t _findIndex(const char* const* list, const char* key)
     return -1;
 }
 
+/*
+ * BytesTries mapping each code in LANGUAGES_3 and COUNTRIES_3 to its index
+ * (the first one for duplicates), for the frequent 3-letter to 2-letter code
+ * conversions. Built once from the tables. If that fails, then they remain NULL
+ * and the lookups fall back to _findIndex().
+ */
+static uint8_t *gLanguages3Trie = NULL;
+static uint8_t *gCountries3Trie = NULL;
+static icu::UInitOnce gCodeTriesInitOnce = U_INITONCE_INITIALIZER;
+
+U_CDECL_BEGIN
+
+static UBool U_CALLCONV
+uloc_codes_cleanup(void) {
+    uprv_free(gLanguages3Trie);
+    gLanguages3Trie = NULL;
+    uprv_free(gCountries3Trie);
+    gCountries3Trie = NULL;
+    gCodeTriesInitOnce.reset();
+    return TRUE;
+}
+
+static int32_t U_CALLCONV
+_compareListEntries(const void *context, const void *left, const void *right) {
+    const char* const* list = (const char* const*)context;
+    return uprv_strcmp(list[*(const int16_t *)left], list[*(const int16_t *)right]);
+}
+
+U_CDECL_END
+
+static uint8_t *
+_buildIndexTrie(const char* const* list, UErrorCode &errorCode) {
+    /* Collect the indexes of the entries of both NULL-terminated arrays. */
+    int32_t limit = 0;
+    int32_t count = 0;
+    for (int32_t pass = 0; pass < 2; ++pass) {
+        while (list[limit] != NULL) {
+            ++limit;
+            ++count;
+        }
+        ++limit;
+    }
+    icu::MaybeStackArray<int16_t, 1024> indexes;
+    if (count > indexes.getCapacity() && indexes.resize(count) == NULL) {
+        errorCode = U_MEMORY_ALLOCATION_ERROR;
+        return NULL;
+    }
+    count = 0;
+    for (int32_t i = 0; i < limit; ++i) {
+        if (list[i] != NULL) {
+            indexes[count++] = (int16_t)i;
+        }
+    }
+    /* A stable sort keeps the first of duplicate codes first. */
+    uprv_sortArray(indexes.getAlias(), count, sizeof(int16_t),
+                   _compareListEntries, list, TRUE, &errorCode);
+    icu::BytesTrieBuilder builder(errorCode);
+    for (int32_t i = 0; i < count && U_SUCCESS(errorCode); ++i) {
+        if (i == 0 || uprv_strcmp(list[indexes[i]], list[indexes[i - 1]]) != 0) {
+            builder.add(list[indexes[i]], indexes[i], errorCode);
+        }
+    }
+    icu::StringPiece trie = builder.buildStringPiece(USTRINGTRIE_BUILD_SMALL, errorCode);
+    if (U_FAILURE(errorCode)) {
+        return NULL;
+    }
+    uint8_t *bytes = (uint8_t *)uprv_malloc(trie.length());
+    if (bytes == NULL) {
+        errorCode = U_MEMORY_ALLOCATION_ERROR;
+        return NULL;
+    }
+    uprv_memcpy(bytes, trie.data(), trie.length());
+    return bytes;
+}
+
+static void U_CALLCONV
+_initCodeTries() {
+    ucln_common_registerCleanup(UCLN_COMMON_ULOC_CODES, uloc_codes_cleanup);
+    UErrorCode errorCode = U_ZERO_ERROR;
+    gLanguages3Trie = _buildIndexTrie(LANGUAGES_3, errorCode);
+    errorCode = U_ZERO_ERROR;
+    gCountries3Trie = _buildIndexTrie(COUNTRIES_3, errorCode);
+}
+
+/*
+ * Like _findIndex(), for LANGUAGES_3 (isLanguage==TRUE) or COUNTRIES_3.
+ */
+static int16_t _findAlpha3Index(UBool isLanguage, const char* key)
+{
+    umtx_initOnce(gCodeTriesInitOnce, &_initCodeTries);
+    const uint8_t *trieBytes = isLanguage ? gLanguages3Trie : gCountries3Trie;
+    if (trieBytes == NULL) {
+        return _findIndex(isLanguage ? LANGUAGES_3 : COUNTRIES_3, key);
+    }
+    icu::BytesTrie trie(trieBytes);
+    if (USTRINGTRIE_HAS_VALUE(trie.next(key, -1))) {
+        return (int16_t)trie.getValue();
+    }
+    return -1;
+}
+
 /* count the length of src while copying it to dest; return strlen(src) */
 static inline int32_t
 _copyCount(char *dest, int32_t destCapacity, const char *src) {
@@ -1249,7 +1353,7 @@ ulocimp_getLanguage(const char *localeID,
 
     if(i==3) {
         /* convert 3 character code to 2 character code if possible *CWB*/
-        offset=_findIndex(LANGUAGES_3, lang);
+        offset=_findAlpha3Index(TRUE, lang);
         if(offset>=0) {
             i=_copyCount(language, languageCapacity, LANGUAGES[offset]);
         }
@@ -1322,7 +1426,7 @@ ulocimp_getCountry(const char *localeID,
         UBool gotCountry = FALSE;
         /* convert 3 character code to 2 character code if possible *CWB*/
         if(idLen==3) {
-            offset=_findIndex(COUNTRIES_3, cnty);
+            offset=_findAlpha3Index(FALSE, cnty);
             if(offset>=0) {
                 idLen=_copyCount(country, countryCapacity, COUNTRIES[offset]);
                 gotCountry = TRUE;
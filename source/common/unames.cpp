@@ -105,6 +105,22 @@ static UDataMemory *uCharNamesData=NULL;
 static UCharNames *uCharNames=NULL;
 static icu::UInitOnce gCharNamesInitOnce = U_INITONCE_INITIALIZER;
 
+/*
+ * Hash tables from regular names to code points, per name choice;
+ * U_EXTENDED_CHAR_NAME uses the U_UNICODE_CHAR_NAME table.
+ * A table is built only after NAME_INDEX_MIN_LOOKUPS lookups.
+ * See the hashed name index section below.
+ */
+static uint32_t *gNameIndex[U_CHAR_NAME_CHOICE_COUNT]={ NULL };
+static uint32_t gNameIndexMask[U_CHAR_NAME_CHOICE_COUNT]={ 0 };
+static icu::UInitOnce gNameIndexInitOnce[U_CHAR_NAME_CHOICE_COUNT]={
+    U_INITONCE_INITIALIZER, U_INITONCE_INITIALIZER, U_INITONCE_INITIALIZER, U_INITONCE_INITIALIZER
+};
+static u_atomic_int32_t gNameLookupCount[U_CHAR_NAME_CHOICE_COUNT]={
+    ATOMIC_INT32_T_INITIALIZER(0), ATOMIC_INT32_T_INITIALIZER(0),
+    ATOMIC_INT32_T_INITIALIZER(0), ATOMIC_INT32_T_INITIALIZER(0)
+};
+
 /*
  * Maximum length of character names (regular & 1.0).
  */
@@ -170,6 +186,13 @@ static UBool U_CALLCONV unames_cleanup(void)
         uCharNames = NULL;
     }
     gCharNamesInitOnce.reset();
+    for(int32_t i=0; i<U_CHAR_NAME_CHOICE_COUNT; ++i) {
+        uprv_free(gNameIndex[i]);
+        gNameIndex[i]=NULL;
+        gNameIndexMask[i]=0;
+        gNameIndexInitOnce[i].reset();
+        umtx_storeRelease(gNameLookupCount[i], 0);
+    }
     gMaxNameLength=0;
     return TRUE;
 }
@@ -841,6 +864,46 @@ writeFactorSuffix(const uint16_t *factors, uint16_t count,
     return bufferPos;
 }
 
+/*
+ * matchFactorSuffix() finds the indexes of the factorized elements
+ * that spell otherName, starting with the i-th factor.
+ * Since an element may be a prefix of another one of the same factor
+ * (for example, "G" and "GG"), all matching elements are tried in order,
+ * which yields the lowest matching code point.
+ * On success, *pOffset is set to the offset of the code point from the range start.
+ */
+static UBool
+matchFactorSuffix(const uint16_t *factors, uint16_t count,
+                  const char *elementBases[8], uint16_t i,
+                  const char *otherName, uint32_t offset, uint32_t *pOffset) {
+    const char *s, *t;
+    uint16_t idx;
+    char c;
+
+    if(i==count) {
+        *pOffset=offset;
+        return (UBool)(*otherName==0);
+    }
+    s=elementBases[i];
+    for(idx=0; idx<factors[i]; ++idx) {
+        /* does this element match at the current position? */
+        t=otherName;
+        while((c=*s++)!=0 && c==*t) {
+            ++t;
+        }
+        if(c==0) {
+            if(matchFactorSuffix(factors, count, elementBases, (uint16_t)(i+1),
+                                 t, offset*factors[i]+idx, pOffset)) {
+                return TRUE;
+            }
+        } else {
+            /* skip the rest of the element string */
+            while(*s++!=0) {}
+        }
+    }
+    return FALSE;
+}
+
 /*
  * Important:
  * Parts of findAlgName() are almost the same as some of getAlgName().
@@ -1121,9 +1184,8 @@ findAlgName(AlgorithmicRange *range, UCharNameChoice nameChoice, const char *oth
         const char *elementBases[8], *elements[8];
         const uint16_t *factors=(const uint16_t *)(range+1);
         uint16_t count=range->variant;
-        const char *s=(const char *)(factors+count), *t;
-        UChar32 start, limit;
-        uint16_t i, idx;
+        const char *s=(const char *)(factors+count);
+        uint32_t offset;
 
         char c;
 
@@ -1136,52 +1198,14 @@ findAlgName(AlgorithmicRange *range, UCharNameChoice nameChoice, const char *oth
             }
         }
 
-        start=(UChar32)range->start;
-        limit=(UChar32)(range->end+1);
-
-        /* initialize the suffix elements for enumeration; indexes should all be set to 0 */
+        /* get the first element string of each factor */
         writeFactorSuffix(factors, count, s, 0,
                           indexes, elementBases, elements, buffer, sizeof(buffer));
 
-        /* compare the first suffix */
-        if(0==uprv_strcmp(otherName, buffer)) {
-            return start;
-        }
-
-        /* enumerate and compare the rest of the suffixes */
-        while(++start<limit) {
-            /* increment the indexes in lexical order bound by the factors */
-            i=count;
-            for (;;) {
-                idx=(uint16_t)(indexes[--i]+1);
-                if(idx<factors[i]) {
-                    /* skip one index and its element string */
-                    indexes[i]=idx;
-                    s=elements[i];
-                    while(*s++!=0) {}
-                    elements[i]=s;
-                    break;
-                } else {
-                    /* reset this index to 0 and its element string to the first one */
-                    indexes[i]=0;
-                    elements[i]=elementBases[i];
-                }
-            }
-
-            /* to make matters a little easier, just compare all elements of the suffix */
-            t=otherName;
-            for(i=0; i<count; ++i) {
-                s=elements[i];
-                while((c=*s++)!=0) {
-                    if(c!=*t++) {
-                        s=""; /* does not match */
-                        i=99;
-                    }
-                }
-            }
-            if(i<99 && *t==0) {
-                return start;
-            }
+        /* match the suffix elements directly instead of enumerating all suffixes */
+        if(matchFactorSuffix(factors, count, elementBases, 0, otherName, 0, &offset) &&
+                offset<=range->end-range->start) {
+            return (UChar32)(range->start+offset);
         }
         break;
     }
@@ -1193,6 +1217,128 @@ findAlgName(AlgorithmicRange *range, UCharNameChoice nameChoice, const char *oth
     return 0xffff;
 }
 
+/* hashed name index -------------------------------------------------------- */
+
+/*
+ * u_charFromName() looks up regular character names in a hash table
+ * per name choice instead of enumerating and comparing all names.
+ * A table is built from the names data after NAME_INDEX_MIN_LOOKUPS
+ * lookups with its name choice. Building it takes about as long as
+ * 200 linear lookups, and the table for the modern names of Unicode 8
+ * takes 256kB, so a process that looks up only a few names keeps
+ * searching linearly.
+ * An entry contains a code point and the high bits of the hash of its name
+ * (to skip most mismatches); the name of a candidate code point is
+ * expanded again and compared with the input, so that the table does not
+ * need to store names.
+ */
+#define NAME_INDEX_MIN_LOOKUPS 100
+#define NAME_INDEX_EMPTY 0xffffffff
+#define NAME_INDEX_CP_MASK 0x1fffff
+#define NAME_INDEX_TAG_MASK 0xffe00000
+
+/*
+ * Extended names are the modern names for all code points that have one,
+ * so they share the table of the modern names.
+ */
+static inline UCharNameChoice
+getNameIndexChoice(UCharNameChoice nameChoice) {
+    return nameChoice==U_EXTENDED_CHAR_NAME ? U_UNICODE_CHAR_NAME : nameChoice;
+}
+
+static uint32_t
+hashName(const char *name, int32_t length) {
+    /* spread the bits of the weak string hash so that both the slot and the tag are useful */
+    uint32_t hash=(uint32_t)ustr_hashCharsN(name, length)*0x9e3779b1;
+    return hash^(hash>>15);
+}
+
+static void
+addNameIndexEntry(uint32_t *table, uint32_t mask, const char *name, int32_t length, UChar32 code) {
+    uint32_t hash=hashName(name, length);
+    uint32_t slot=hash&mask;
+    while(table[slot]!=NAME_INDEX_EMPTY) {
+        slot=(slot+1)&mask;
+    }
+    table[slot]=(hash&NAME_INDEX_TAG_MASK)|(uint32_t)code;
+}
+
+/*
+ * Enumerates the regular names of all groups for one name choice,
+ * and either counts them (table==NULL) or adds them to the table.
+ */
+static int32_t
+enumNameIndexEntries(UCharNames *names, UCharNameChoice nameChoice, uint32_t *table, uint32_t mask) {
+    uint16_t offsets[LINES_PER_GROUP+2], lengths[LINES_PER_GROUP+2];
+    char buffer[200];
+    const uint16_t *groups=GET_GROUPS(names);
+    uint16_t groupCount=*groups++;
+    int32_t count=0;
+    uint16_t i, line, length;
+
+    for(i=0; i<groupCount; ++i, groups=NEXT_GROUP(groups)) {
+        const uint8_t *s=(uint8_t *)names+names->groupStringOffset+GET_GROUP_OFFSET(groups);
+        UChar32 start=(UChar32)groups[GROUP_MSB]<<GROUP_SHIFT;
+        s=expandGroupLengths(s, offsets, lengths);
+        for(line=0; line<LINES_PER_GROUP; ++line) {
+            length=expandName(names, s+offsets[line], lengths[line], nameChoice, buffer, sizeof(buffer));
+            if(length>0 && length<sizeof(buffer)) {
+                if(table!=NULL) {
+                    addNameIndexEntry(table, mask, buffer, length, start+line);
+                }
+                ++count;
+            }
+        }
+    }
+    return count;
+}
+
+static void U_CALLCONV
+loadNameIndex(UCharNameChoice nameChoice, UErrorCode &status) {
+    /* at most half of the slots are used, for short probe sequences */
+    int32_t count=enumNameIndexEntries(uCharNames, nameChoice, NULL, 0);
+    uint32_t capacity=64;
+    while(capacity<(uint32_t)count*2) {
+        capacity<<=1;
+    }
+    uint32_t *table=(uint32_t *)uprv_malloc(capacity*4);
+    if(table==NULL) {
+        status=U_MEMORY_ALLOCATION_ERROR;
+        return;
+    }
+    uprv_memset(table, 0xff, capacity*4);
+    enumNameIndexEntries(uCharNames, nameChoice, table, capacity-1);
+    gNameIndex[nameChoice]=table;
+    gNameIndexMask[nameChoice]=capacity-1;
+}
+
+/*
+ * Returns the lowest code point with the given name,
+ * or 0xffff if there is none.
+ */
+static UChar32
+findNameInIndex(UCharNameChoice nameChoice, const char *otherName, int32_t length) {
+    const uint32_t *table=gNameIndex[nameChoice];
+    uint32_t mask=gNameIndexMask[nameChoice];
+    uint32_t hash=hashName(otherName, length);
+    uint32_t slot=hash&mask, entry;
+    UChar32 code, result=0xffff;
+    char buffer[200];
+
+    while((entry=table[slot])!=NAME_INDEX_EMPTY) {
+        if(((entry^hash)&NAME_INDEX_TAG_MASK)==0) {
+            code=(UChar32)(entry&NAME_INDEX_CP_MASK);
+            if((result==0xffff || code<result) &&
+                    getName(uCharNames, code, nameChoice, buffer, sizeof(buffer))==length &&
+                    uprv_memcmp(buffer, otherName, length)==0) {
+                result=code;
+            }
+        }
+        slot=(slot+1)&mask;
+    }
+    return result;
+}
+
 /* sets of name characters, maximum name lengths ---------------------------- */
 
 #define SET_ADD(set, c) ((set)[(uint8_t)c>>5]|=((uint32_t)1<<((uint8_t)c&0x1f)))
@@ -1613,9 +1759,23 @@ u_charFromName(UCharNameChoice nameChoice,
     }
 
     /* normal character name */
-    findName.otherName=upper;
-    findName.code=error;
-    enumNames(uCharNames, 0, UCHAR_MAX_VALUE + 1, DO_FIND_NAME, &findName, nameChoice);
+    UCharNameChoice indexChoice = getNameIndexChoice(nameChoice);
+    UBool haveIndex = FALSE;
+    /* stop counting at the threshold so that the count cannot overflow */
+    if (umtx_loadAcquire(gNameLookupCount[indexChoice]) >= NAME_INDEX_MIN_LOOKUPS ||
+            umtx_atomic_inc(&gNameLookupCount[indexChoice]) > NAME_INDEX_MIN_LOOKUPS) {
+        UErrorCode indexErrorCode = U_ZERO_ERROR;
+        umtx_initOnce(gNameIndexInitOnce[indexChoice], &loadNameIndex, indexChoice, indexErrorCode);
+        haveIndex = U_SUCCESS(indexErrorCode);
+    }
+    if (haveIndex) {
+        findName.code = findNameInIndex(indexChoice, upper, (int32_t)uprv_strlen(upper));
+    } else {
+        /* no index (yet), compare with all names */
+        findName.otherName=upper;
+        findName.code=error;
+        enumNames(uCharNames, 0, UCHAR_MAX_VALUE + 1, DO_FIND_NAME, &findName, nameChoice);
+    }
     if (findName.code == error) {
          *pErrorCode = U_ILLEGAL_CHAR_FOUND;
     }
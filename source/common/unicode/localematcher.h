@@ -0,0 +1,220 @@
+/*
+*******************************************************************************
+*
+*   Copyright (C) 2016, International Business Machines
+*   Corporation and others.  All Rights Reserved.
+*
+*******************************************************************************
+*   file name:  localematcher.h
+*   encoding:   US-ASCII
+*   tab size:   8 (not used)
+*   indentation:4
+*/
+
+#ifndef __LOCALEMATCHER_H__
+#define __LOCALEMATCHER_H__
+
+#include "unicode/utypes.h"
+#include "unicode/locid.h"
+#include "unicode/uobject.h"
+
+/**
+ * \file
+ * \brief C++ API: Locale matcher: Picks the best matching supported locale for a user's desired locales.
+ */
+
+#ifndef U_HIDE_DRAFT_API
+
+struct UHashtable;
+
+U_NAMESPACE_BEGIN
+
+struct LocaleMatcherEntry;
+
+/**
+ * Immutable class that picks the best match between a user's desired locales
+ * (for example, from an HTTP Accept-Language header)
+ * and an application's supported locales.
+ *
+ * Unlike uloc_acceptLanguage(), which only strips subtags until it finds
+ * an available locale ID, the matcher compares locales by their likely subtags
+ * (so that "zh-TW" matches "zh-Hant" and "en" matches "en-US"),
+ * and prefers supported locales whose region is in the same part of the world
+ * (so that "es-MX" matches "es-419" rather than "es-ES").
+ *
+ * The supported locales are analyzed once when the matcher is created.
+ * The getBestMatch() functions do not modify the matcher,
+ * so that a single instance can be shared by all threads of an application.
+ *
+ * Example:
+ * \code
+ * UErrorCode errorCode = U_ZERO_ERROR;
+ * Locale supported[] = { Locale("en", "US"), Locale("en", "GB"), Locale("es", "419"), Locale("fr") };
+ * LocaleMatcher matcher(supported, 4, errorCode);
+ * const Locale *best = matcher.getBestMatchForHTTP("es-MX, fr;q=0.8, en;q=0.5", errorCode);
+ * // best is supported[2], es_419
+ * \endcode
+ *
+ * The LocaleMatcher class is not intended for public subclassing.
+ * @draft ICU 57
+ */
+class U_COMMON_API LocaleMatcher U_FINAL : public UObject {
+public:
+    /**
+     * Distance values returned by getDistance().
+     * Smaller values indicate better matches.
+     * @draft ICU 57
+     */
+    enum {
+        /**
+         * The desired and supported locales have the same likely subtags.
+         * @draft ICU 57
+         */
+        DISTANCE_EXACT = 0,
+        /**
+         * The region of the supported locale contains the desired region,
+         * for example es-013 (Central America) for es-MX.
+         * @draft ICU 57
+         */
+        DISTANCE_CONTAINING_REGION = 3,
+        /**
+         * The two regions are in the same part of the world,
+         * for example en-GB and en-IE.
+         * @draft ICU 57
+         */
+        DISTANCE_NEARBY_REGION = 4,
+        /**
+         * The regions differ, for example pt-BR and pt-PT.
+         * @draft ICU 57
+         */
+        DISTANCE_REGION = 5,
+        /**
+         * Added to the distance for each desired locale that precedes
+         * the one that is compared, so that a good match for a more-preferred
+         * locale wins over a slightly better one for a less-preferred locale.
+         * @draft ICU 57
+         */
+        DISTANCE_DEMOTION_PER_DESIRED_LOCALE = 10,
+        /**
+         * The scripts differ, for example zh-Hant and zh-Hans.
+         * @draft ICU 57
+         */
+        DISTANCE_SCRIPT = 40,
+        /**
+         * Supported locales with a distance at or above this threshold
+         * are not considered to be matches.
+         * @draft ICU 57
+         */
+        DISTANCE_THRESHOLD = 50,
+        /**
+         * The languages differ.
+         * @draft ICU 57
+         */
+        DISTANCE_LANGUAGE = 80
+    };
+
+    /**
+     * Constructs a matcher for the given supported locales.
+     * The first one is the default locale, which is returned
+     * when none of them matches the desired locales.
+     * @param supportedLocales the supported locales, in order of preference;
+     *                         the matcher keeps copies of them
+     * @param length the number of supported locales; must be at least 1
+     * @param errorCode ICU error code
+     * @draft ICU 57
+     */
+    LocaleMatcher(const Locale *supportedLocales, int32_t length, UErrorCode &errorCode);
+
+    /**
+     * Destructor.
+     * @draft ICU 57
+     */
+    virtual ~LocaleMatcher();
+
+    /**
+     * Returns the number of supported locales.
+     * @return the number of supported locales
+     * @draft ICU 57
+     */
+    int32_t getSupportedLocalesCount() const { return length; }
+
+    /**
+     * Returns the supported locale with the given index.
+     * @param i index, 0..getSupportedLocalesCount()-1
+     * @return the matcher's copy of the supported locale
+     * @draft ICU 57
+     */
+    const Locale &getSupportedLocale(int32_t i) const { return supportedLocales[i]; }
+
+    /**
+     * Returns the supported locale which best matches the desired locale.
+     * @param desiredLocale the user's desired locale
+     * @param errorCode ICU error code
+     * @return the best-matching supported locale,
+     *         or the default locale if none matches,
+     *         or NULL if an error occurred
+     * @draft ICU 57
+     */
+    const Locale *getBestMatch(const Locale &desiredLocale, UErrorCode &errorCode) const;
+
+    /**
+     * Returns the supported locale which best matches any of the desired locales.
+     * Matches for earlier desired locales are preferred over
+     * somewhat better matches for later ones.
+     * @param desiredLocales the user's desired locales, in order of preference
+     * @param length the number of desired locales
+     * @param errorCode ICU error code
+     * @return the best-matching supported locale,
+     *         or the default locale if none matches,
+     *         or NULL if an error occurred
+     * @draft ICU 57
+     */
+    const Locale *getBestMatch(const Locale *desiredLocales, int32_t length,
+                               UErrorCode &errorCode) const;
+
+    /**
+     * Returns the supported locale which best matches the language tags in
+     * an HTTP Accept-Language header value, like "de-CH, fr;q=0.8, en;q=0.5".
+     * The language ranges are ordered by their quality values;
+     * ranges with q=0 and the "*" range are ignored.
+     * @param httpAcceptLanguage the Accept-Language header value
+     * @param errorCode ICU error code
+     * @return the best-matching supported locale,
+     *         or the default locale if none matches,
+     *         or NULL if an error occurred
+     * @draft ICU 57
+     */
+    const Locale *getBestMatchForHTTP(const char *httpAcceptLanguage, UErrorCode &errorCode) const;
+
+    /**
+     * Returns the distance between a desired and a supported locale,
+     * from DISTANCE_EXACT to DISTANCE_LANGUAGE.
+     * @param desiredLocale the user's desired locale
+     * @param supportedLocale an application's supported locale
+     * @param errorCode ICU error code
+     * @return the distance
+     * @draft ICU 57
+     */
+    static int32_t getDistance(const Locale &desiredLocale, const Locale &supportedLocale,
+                               UErrorCode &errorCode);
+
+private:
+    LocaleMatcher(const LocaleMatcher &other);  // forbid copying of this class
+    LocaleMatcher &operator=(const LocaleMatcher &other);  // forbid copying of this class
+
+    int32_t getBestIndex(const Locale &desiredLocale, int32_t *pDistance) const;
+
+    Locale *supportedLocales;
+    LocaleMatcherEntry *entries;
+    int32_t length;
+    // Maps each supported locale ID to its first index.
+    UHashtable *indexesByName;
+    // Maps each maximized language subtag to the first index with that language.
+    UHashtable *indexesByLanguage;
+};
+
+U_NAMESPACE_END
+
+#endif  /* U_HIDE_DRAFT_API */
+
+#endif  /* __LOCALEMATCHER_H__ */
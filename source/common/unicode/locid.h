@@ -1,7 +1,7 @@
 /*
 ******************************************************************************
 *
-*   Copyright (C) 1996-2015, International Business Machines
+*   Copyright (C) 1996-2016, International Business Machines
 *   Corporation and others.  All Rights Reserved.
 *
 ******************************************************************************
@@ -752,6 +752,9 @@ private:
 
     UBool fIsBogus;
 
+    // hash code of fullName, updated whenever fullName changes
+    int32_t fHashCode;
+
     static const Locale &getLocale(int locid);
 
     /**
@@ -1,7 +1,7 @@
 /*
 ******************************************************************************
 *
-*   Copyright (C) 1999-2013, International Business Machines
+*   Copyright (C) 1999-2016, International Business Machines
 *   Corporation and others.  All Rights Reserved.
 *
 ******************************************************************************
@@ -551,6 +551,43 @@ ubidi_openSized(int32_t maxLength, int32_t maxRunCount, UErrorCode *pErrorCode);
 U_STABLE void U_EXPORT2
 ubidi_close(UBiDi *pBiDi);
 
+#ifndef U_HIDE_DRAFT_API
+/**
+ * Preallocate memory for internal structures of an existing
+ * <code>UBiDi</code> object, so that subsequent calls to
+ * <code>ubidi_setPara()</code> or <code>ubidi_setLine()</code>
+ * for texts of up to <code>maxLength</code> and
+ * visual runs of up to <code>maxRunCount</code> do not allocate
+ * or grow this memory.<p>
+ * <code>ubidi_setPara()</code> otherwise grows the memory to the exact
+ * size of each text that is longer than all previous ones,
+ * which can mean many reallocations when processing a sequence of texts
+ * of similar lengths, for example the paragraphs of a document.<p>
+ * Unlike with <code>ubidi_openSized()</code>, the object is not limited
+ * to the preallocated sizes if it was opened with <code>ubidi_open()</code>.
+ * The memory for the paragraphs, isolates and bracket pairs of a text
+ * is still allocated as needed, and kept for subsequent texts.<p>
+ * Any text or line that was set on the object is discarded;
+ * like <code>ubidi_setPara()</code>, this function must not be called
+ * on a parent object that still has children.
+ *
+ * @param pBiDi is a <code>UBiDi</code> object.
+ *
+ * @param maxLength is the text or line length to preallocate memory for;
+ *        0 for none.
+ *
+ * @param maxRunCount is the number of same-level runs to preallocate memory for;
+ *        0 for none.
+ *
+ * @param pErrorCode must be a valid pointer to an error code value.
+ *
+ * @see ubidi_openSized
+ * @draft ICU 57
+ */
+U_DRAFT void U_EXPORT2
+ubidi_reserve(UBiDi *pBiDi, int32_t maxLength, int32_t maxRunCount, UErrorCode *pErrorCode);
+#endif  /* U_HIDE_DRAFT_API */
+
 #if U_SHOW_CPLUSPLUS_API
 
 U_NAMESPACE_BEGIN
@@ -1318,6 +1355,67 @@ ubidi_getDirection(const UBiDi *pBiDi);
 U_STABLE UBiDiDirection U_EXPORT2
 ubidi_getBaseDirection(const UChar *text,  int32_t length );
 
+#ifndef U_HIDE_DRAFT_API
+/**
+ * Splits a text into at most <code>maxParts</code> parts of whole paragraphs,
+ * for processing the parts independently, for example in parallel
+ * on several threads with one <code>UBiDi</code> object per thread.
+ * Each part ends with the first paragraph limit after its share of
+ * <code>length/maxParts</code> code units of the text,
+ * so the parts are of similar lengths when the text has many short paragraphs.
+ * A text without paragraph separators is returned as a single part.<p>
+ * A paragraph ends after a character with bidirectional character type B,
+ * except that a CR LF sequence is not split,
+ * just like with <code>ubidi_setPara()</code>.<p>
+ * Paragraphs are resolved independently of each other,
+ * so calling <code>ubidi_setPara()</code> on each part yields the same
+ * paragraph levels and embedding levels as calling it on the whole text,
+ * unless <code>ubidi_setContext()</code>, <code>UBIDI_OPTION_STREAMING</code>,
+ * <code>ubidi_setClassCallback()</code> or one of the inverse reordering modes is used.
+ * The parts are visually independent, too, if
+ * <code>ubidi_orderParagraphsLTR()</code> is set or each part is displayed
+ * on lines of its own.<p>
+ *
+ * Example:
+ * \code
+ *     int32_t limits[8], count, i;
+ *     count=ubidi_splitParagraphs(text, length, limits, 8, &errorCode);
+ *     for(i=0; i<count; ++i) {
+ *         // in thread i, with its own UBiDi object:
+ *         int32_t start= i==0 ? 0 : limits[i-1];
+ *         ubidi_setPara(pBiDi[i], text+start, limits[i]-start,
+ *                       UBIDI_DEFAULT_LTR, NULL, &errorCodes[i]);
+ *     }
+ * \endcode
+ *
+ * @param text is a pointer to the text.
+ *
+ * @param length is the length of the text;
+ *               if <code>length==-1</code> then the text
+ *               must be zero-terminated.
+ *
+ * @param limits receives the limits of the parts, in ascending order;
+ *               the first part starts at 0 and the last one ends at
+ *               the length of the text.
+ *
+ * @param maxParts is the capacity of the <code>limits</code> array;
+ *                 must be at least 1.
+ *
+ * @param pErrorCode must be a valid pointer to an error code value.
+ *
+ * @return The number of parts, at most <code>maxParts</code>;
+ *         0 for an empty text.
+ *
+ * @see ubidi_setPara
+ * @see ubidi_countParagraphs
+ * @draft ICU 57
+ */
+U_DRAFT int32_t U_EXPORT2
+ubidi_splitParagraphs(const UChar *text, int32_t length,
+                      int32_t *limits, int32_t maxParts,
+                      UErrorCode *pErrorCode);
+#endif  /* U_HIDE_DRAFT_API */
+
 /**
  * Get the pointer to the text.
  *
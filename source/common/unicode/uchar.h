@@ -1,6 +1,6 @@
 /*
 **********************************************************************
-*   Copyright (C) 1997-2015, International Business Machines
+*   Copyright (C) 1997-2016, International Business Machines
 *   Corporation and others.  All Rights Reserved.
 **********************************************************************
 *
@@ -2112,6 +2112,144 @@ u_isUWhiteSpace(UChar32 c);
 U_STABLE int32_t U_EXPORT2
 u_getIntPropertyValue(UChar32 c, UProperty which);
 
+#ifndef U_HIDE_DRAFT_API
+
+/**
+ * Gets the general category of each code point of a UTF-16 string, in one call.
+ * The result is the same as calling u_charType() for each code point,
+ * but faster.
+ * An unpaired surrogate gets the value for its surrogate code point (U_SURROGATE).
+ *
+ * If the number of code points is greater than the capacity,
+ * then the first capacity values are written,
+ * the function sets U_BUFFER_OVERFLOW_ERROR and returns the number of code points.
+ *
+ * @param s UTF-16 string
+ * @param length length of s, or -1 if it is NUL-terminated
+ * @param types destination array, receives one UCharCategory value per code point
+ * @param capacity number of int8_t values available at types; can be 0 for preflighting
+ * @param pErrorCode ICU error code in/out parameter.
+ *                   Must fulfill U_SUCCESS before the function call.
+ * @return the number of code points in s
+ * @see u_charType
+ * @draft ICU 57
+ */
+U_DRAFT int32_t U_EXPORT2
+u_strCharTypes(const UChar *s, int32_t length,
+               int8_t *types, int32_t capacity,
+               UErrorCode *pErrorCode);
+
+/**
+ * Gets the general category of each code point of a UTF-8 string, in one call.
+ * Same as u_strCharTypes() but for UTF-8.
+ * Each ill-formed sequence counts as one code point and
+ * gets the value for U+FFFD (U_OTHER_SYMBOL).
+ *
+ * @param s UTF-8 string
+ * @param length length of s in bytes, or -1 if it is NUL-terminated
+ * @param types destination array, receives one UCharCategory value per code point
+ * @param capacity number of int8_t values available at types; can be 0 for preflighting
+ * @param pErrorCode ICU error code in/out parameter.
+ *                   Must fulfill U_SUCCESS before the function call.
+ * @return the number of code points in s, counting each ill-formed sequence as one
+ * @see u_strCharTypes
+ * @draft ICU 57
+ */
+U_DRAFT int32_t U_EXPORT2
+u_strCharTypesUTF8(const char *s, int32_t length,
+                   int8_t *types, int32_t capacity,
+                   UErrorCode *pErrorCode);
+
+/**
+ * Gets a property value for each code point of a UTF-16 string, in one call.
+ * The result is the same as calling u_getIntPropertyValue(c, which)
+ * for each code point, but the property is looked up only once.
+ * An unpaired surrogate gets the value for its surrogate code point.
+ *
+ * If the number of code points is greater than the capacity,
+ * then the first capacity values are written,
+ * the function sets U_BUFFER_OVERFLOW_ERROR and returns the number of code points.
+ *
+ * @param s UTF-16 string
+ * @param length length of s, or -1 if it is NUL-terminated
+ * @param which UProperty selector constant, see u_getIntPropertyValue()
+ * @param values destination array, receives one property value per code point
+ * @param capacity number of int32_t values available at values; can be 0 for preflighting
+ * @param pErrorCode ICU error code in/out parameter.
+ *                   Must fulfill U_SUCCESS before the function call.
+ * @return the number of code points in s
+ * @see u_getIntPropertyValue
+ * @draft ICU 57
+ */
+U_DRAFT int32_t U_EXPORT2
+u_strGetIntPropertyValues(const UChar *s, int32_t length, UProperty which,
+                          int32_t *values, int32_t capacity,
+                          UErrorCode *pErrorCode);
+
+/**
+ * Gets a property value for each code point of a UTF-8 string, in one call.
+ * Same as u_strGetIntPropertyValues() but for UTF-8.
+ * Each ill-formed sequence counts as one code point and
+ * gets the value for U+FFFD.
+ *
+ * @param s UTF-8 string
+ * @param length length of s in bytes, or -1 if it is NUL-terminated
+ * @param which UProperty selector constant, see u_getIntPropertyValue()
+ * @param values destination array, receives one property value per code point
+ * @param capacity number of int32_t values available at values; can be 0 for preflighting
+ * @param pErrorCode ICU error code in/out parameter.
+ *                   Must fulfill U_SUCCESS before the function call.
+ * @return the number of code points in s, counting each ill-formed sequence as one
+ * @see u_strGetIntPropertyValues
+ * @draft ICU 57
+ */
+U_DRAFT int32_t U_EXPORT2
+u_strGetIntPropertyValuesUTF8(const char *s, int32_t length, UProperty which,
+                              int32_t *values, int32_t capacity,
+                              UErrorCode *pErrorCode);
+
+/**
+ * Returns the length of the initial substring of a UTF-16 string
+ * whose code points all have the same value for a property.
+ * "The same value" means u_getIntPropertyValue(c, which)==value,
+ * except for UCHAR_GENERAL_CATEGORY_MASK where value is a set of
+ * U_GC_XX_MASK bits and the span continues while
+ * (U_MASK(u_charType(c))&value)!=0.
+ *
+ * For example, u_strSpanIntPropertyValue(s, length, UCHAR_GENERAL_CATEGORY_MASK, U_GC_L_MASK)
+ * spans letters, and u_strSpanIntPropertyValue(s, length, UCHAR_WHITE_SPACE, 0)
+ * spans non-white space characters.
+ *
+ * @param s UTF-16 string
+ * @param length length of s, or -1 if it is NUL-terminated
+ * @param which UProperty selector constant, see u_getIntPropertyValue()
+ * @param value the property value (or general category mask) to span
+ * @return the length of the initial substring, in UTF-16 code units
+ * @see u_getIntPropertyValue
+ * @draft ICU 57
+ */
+U_DRAFT int32_t U_EXPORT2
+u_strSpanIntPropertyValue(const UChar *s, int32_t length, UProperty which, int32_t value);
+
+/**
+ * Returns the length of the initial substring of a UTF-8 string
+ * whose code points all have the same value for a property.
+ * Same as u_strSpanIntPropertyValue() but for UTF-8.
+ * Each ill-formed sequence is treated like U+FFFD.
+ *
+ * @param s UTF-8 string
+ * @param length length of s in bytes, or -1 if it is NUL-terminated
+ * @param which UProperty selector constant, see u_getIntPropertyValue()
+ * @param value the property value (or general category mask) to span
+ * @return the length of the initial substring, in bytes
+ * @see u_strSpanIntPropertyValue
+ * @draft ICU 57
+ */
+U_DRAFT int32_t U_EXPORT2
+u_strSpanIntPropertyValueUTF8(const char *s, int32_t length, UProperty which, int32_t value);
+
+#endif  /* U_HIDE_DRAFT_API */
+
 /**
  * Get the minimum value for an enumerated/integer/binary Unicode property.
  * Can be used together with u_getIntPropertyMaxValue
@@ -1,6 +1,6 @@
 /*
 ***************************************************************************
-* Copyright (C) 1999-2015, International Business Machines Corporation
+* Copyright (C) 1999-2016, International Business Machines Corporation
 * and others. All Rights Reserved.
 ***************************************************************************
 *   Date        Name        Description
@@ -298,7 +298,8 @@ class U_COMMON_API UnicodeSet U_FINAL : public UnicodeFilter {
 
 private:
     enum { // constants
-        kIsBogus = 1       // This set is bogus (i.e. not valid)
+        kIsBogus = 1,      // This set is bogus (i.e. not valid)
+        kIsListAlias = 2   // list points into a binary image, see createFromBinary()
     };
     uint8_t fFlags;         // Bit flag (see constants above)
 public:
@@ -1442,6 +1443,57 @@ public:
      */
     int32_t serialize(uint16_t *dest, int32_t destCapacity, UErrorCode& ec) const;
 
+#ifndef U_HIDE_DRAFT_API
+    /**
+     * Writes a binary image of this set for createFromBinary().
+     * Unlike serialize(), the image includes the strings of the set,
+     * and for a set that is or would be frozen without string spans,
+     * the lookup tables that freeze() computes,
+     * so that createFromBinary() need not compute them again.
+     *
+     * The image is in platform endianness and must be 4-byte-aligned.
+     * It can be written to a file and memory-mapped later
+     * by programs using the same ICU version; a different ICU version
+     * recomputes the lookup tables if their format has changed.
+     *
+     * @param data pointer to 4-byte-aligned memory for the image.
+     *             May be NULL only if capacity is zero.
+     * @param capacity size of data in bytes, or zero. Must not be negative.
+     * @param errorCode ICU error code. Set to U_BUFFER_OVERFLOW_ERROR
+     *                  if the image does not fit into capacity bytes.
+     * @return the length of the image in bytes (a multiple of 4),
+     *         or 0 on error other than U_BUFFER_OVERFLOW_ERROR
+     * @see createFromBinary
+     * @draft ICU 57
+     */
+    int32_t toBinary(void *data, int32_t capacity, UErrorCode &errorCode) const;
+
+    /**
+     * Creates a frozen set from a binary image that was written by toBinary().
+     * The set uses the code point ranges and strings of the image in place,
+     * without copying them, and with little more work than copying
+     * the lookup tables if the image has them.
+     * The data must remain valid and unchanged while the set
+     * and any UnicodeString from its getString() are in use,
+     * but it may be read-only, for example a memory-mapped file.
+     *
+     * Clones are independent of the data.
+     *
+     * @param data pointer to the 4-byte-aligned image
+     * @param length number of bytes available at data;
+     *               can be more than necessary
+     * @param pActualLength receives the actual number of bytes of the image;
+     *                      can be NULL
+     * @param errorCode ICU error code. Set to U_INVALID_FORMAT_ERROR
+     *                  if the data is not a valid image.
+     * @return the frozen set, to be deleted by the caller; NULL on failure
+     * @see toBinary
+     * @draft ICU 57
+     */
+    static UnicodeSet * U_EXPORT2 createFromBinary(const void *data, int32_t length,
+                                                   int32_t *pActualLength, UErrorCode &errorCode);
+#endif  /* U_HIDE_DRAFT_API */
+
     /**
      * Reallocate this objects internal structures to take up the least
      * possible space, without changing this object's value.
@@ -1,7 +1,7 @@
 /*
 *******************************************************************************
 *
-*   Copyright (C) 2002-2014, International Business Machines
+*   Copyright (C) 2002-2016, International Business Machines
 *   Corporation and others.  All Rights Reserved.
 *
 *******************************************************************************
@@ -1123,4 +1123,57 @@ U_STABLE UBool U_EXPORT2
 uset_getSerializedRange(const USerializedSet* set, int32_t rangeIndex,
                         UChar32* pStart, UChar32* pEnd);
 
+#ifndef U_HIDE_DRAFT_API
+/**
+ * Writes a binary image of the set for uset_openFromBinary().
+ * Unlike uset_serialize(), the image includes the strings of the set,
+ * and for a set that is or would be frozen without string spans,
+ * the lookup tables that uset_freeze() computes,
+ * so that uset_openFromBinary() need not compute them again.
+ *
+ * The image is in platform endianness and must be 4-byte-aligned.
+ * It can be written to a file and memory-mapped later
+ * by programs using the same ICU version; a different ICU version
+ * recomputes the lookup tables if their format has changed.
+ *
+ * @param set the set
+ * @param data pointer to 4-byte-aligned memory for the image.
+ *             May be NULL only if capacity is zero.
+ * @param capacity size of data in bytes, or zero. Must not be negative.
+ * @param pErrorCode pointer to the error code. Set to U_BUFFER_OVERFLOW_ERROR
+ *                   if the image does not fit into capacity bytes.
+ * @return the length of the image in bytes (a multiple of 4),
+ *         or 0 on error other than U_BUFFER_OVERFLOW_ERROR
+ * @see uset_openFromBinary
+ * @draft ICU 57
+ */
+U_DRAFT int32_t U_EXPORT2
+uset_toBinary(const USet *set, void *data, int32_t capacity, UErrorCode *pErrorCode);
+
+/**
+ * Opens a frozen set from a binary image that was written by uset_toBinary().
+ * The set uses the code point ranges and strings of the image in place,
+ * without copying them, and with little more work than copying
+ * the lookup tables if the image has them.
+ * The data must remain valid and unchanged until the set is closed,
+ * but it may be read-only, for example a memory-mapped file.
+ *
+ * uset_clone() and uset_cloneAsThawed() return sets that are independent of the data.
+ *
+ * @param data pointer to the 4-byte-aligned image
+ * @param length number of bytes available at data;
+ *               can be more than necessary
+ * @param pActualLength receives the actual number of bytes of the image;
+ *                      can be NULL
+ * @param pErrorCode pointer to the error code. Set to U_INVALID_FORMAT_ERROR
+ *                   if the data is not a valid image.
+ * @return the frozen set, to be closed with uset_close(); NULL on failure
+ * @see uset_toBinary
+ * @draft ICU 57
+ */
+U_DRAFT USet * U_EXPORT2
+uset_openFromBinary(const void *data, int32_t length, int32_t *pActualLength,
+                    UErrorCode *pErrorCode);
+#endif  /* U_HIDE_DRAFT_API */
+
 #endif
@@ -1,6 +1,6 @@
 /*
 **********************************************************************
-*   Copyright (C) 1998-2014, International Business Machines
+*   Copyright (C) 1998-2016, International Business Machines
 *   Corporation and others.  All Rights Reserved.
 **********************************************************************
 *
@@ -1457,6 +1457,49 @@ u_strFromUTF8Lenient(UChar *dest,
                      int32_t srcLength,
                      UErrorCode *pErrorCode);
 
+#ifndef U_HIDE_DRAFT_API
+/**
+ * Checks whether a string is well-formed UTF-8.
+ * Ill-formed are non-shortest forms, surrogate code points,
+ * code points above U+10FFFF, and truncated or otherwise broken byte sequences.
+ * Noncharacters are well-formed.
+ *
+ * This is much faster than converting the string,
+ * especially for text that is mostly ASCII.
+ *
+ * @param s             The UTF-8 string.
+ * @param length        The length of the string, or -1 if it is NUL-terminated.
+ * @param pErrorCode    Pointer to a standard ICU error code. Its input value must
+ *                      pass the U_SUCCESS() test, or else the function returns
+ *                      immediately. Check for U_FAILURE() on output or use with
+ *                      function chaining. (See User Guide for details.)
+ * @return The offset of the first byte of the first ill-formed sequence,
+ *         or -1 if the whole string is well-formed.
+ * @see u_validateUTF16
+ * @draft ICU 57
+ */
+U_DRAFT int32_t U_EXPORT2
+u_validateUTF8(const char *s, int32_t length, UErrorCode *pErrorCode);
+
+/**
+ * Checks whether a string is well-formed UTF-16,
+ * that is, whether it contains no unpaired surrogates.
+ *
+ * @param s             The UTF-16 string.
+ * @param length        The length of the string, or -1 if it is NUL-terminated.
+ * @param pErrorCode    Pointer to a standard ICU error code. Its input value must
+ *                      pass the U_SUCCESS() test, or else the function returns
+ *                      immediately. Check for U_FAILURE() on output or use with
+ *                      function chaining. (See User Guide for details.)
+ * @return The offset of the first unpaired surrogate,
+ *         or -1 if the whole string is well-formed.
+ * @see u_validateUTF8
+ * @draft ICU 57
+ */
+U_DRAFT int32_t U_EXPORT2
+u_validateUTF16(const UChar *s, int32_t length, UErrorCode *pErrorCode);
+#endif  /* U_HIDE_DRAFT_API */
+
 /**
  * Convert a UTF-16 string to UTF-32.
  * If the input string is not well-formed, then the U_INVALID_CHAR_FOUND error code is set.
@@ -1,6 +1,6 @@
 /*
 **********************************************************************
-*   Copyright (C) 1999-2015, International Business Machines
+*   Copyright (C) 1999-2016, International Business Machines
 *   Corporation and others.  All Rights Reserved.
 **********************************************************************
 *   Date        Name        Description
@@ -14,6 +14,7 @@
 #include "unicode/uniset.h"
 #include "unicode/utf8.h"
 #include "unicode/utf16.h"
+#include "unicode/ustring.h"
 #include "ruleiter.h"
 #include "cmemory.h"
 #include "cstring.h"
@@ -256,7 +257,9 @@ UnicodeSet::UnicodeSet(const UnicodeSet& o, UBool /* asThawed */) :
  */
 UnicodeSet::~UnicodeSet() {
     _dbgdt(this); // first!
-    uprv_free(list);
+    if (!(fFlags & kIsListAlias)) {
+        uprv_free(list);
+    }
     delete bmpSet;
     if (buffer) {
         uprv_free(buffer);
@@ -1626,6 +1629,249 @@ int32_t UnicodeSet::serialize(uint16_t *dest, int32_t destCapacity, UErrorCode&
     return destLength;
 }
 
+//----------------------------------------------------------------
+// Binary image
+//----------------------------------------------------------------
+
+//
+//  Binary image of a set, see toBinary() and createFromBinary().
+//
+//  All fields are in platform endianness, so that the image
+//  can be memory-mapped and used in place.
+//
+//    UnicodeSetBinaryHeader header;
+//    UChar32  list[header.listLength];          The inversion list, ending with UNICODESET_HIGH.
+//    int32_t  stringLimits[header.stringCount]; The limit of each string in strings[];
+//                                               each string starts at the previous one's limit.
+//    UChar    strings[];                        The strings in the order of getString(),
+//                                               padded with zeros to a multiple of 4 bytes.
+//    uint8_t  tables[header.tablesLength];      BMPSet lookup tables, padded with zeros
+//                                               to a multiple of 4 bytes; see BMPSet::getTables().
+//
+//  formatVersion[0] changes with incompatible changes of the layout.
+//  formatVersion[1] is the BMPSet::TABLES_VERSION of the tables;
+//  createFromBinary() ignores tables of a different version or length.
+//
+struct UnicodeSetBinaryHeader {
+    uint32_t signature;         // USET_BINARY_SIG
+    uint8_t  formatVersion[4];  // 1.BMPSet::TABLES_VERSION.0.0
+    int32_t  length;            // Total length in bytes, including the header.
+    int32_t  listLength;        // Number of list values, including the final UNICODESET_HIGH.
+    int32_t  stringCount;
+    int32_t  tablesLength;      // Length in bytes of the BMPSet tables; 0 if there are none.
+    int32_t  reserved[2];
+};
+
+static const uint32_t USET_BINARY_SIG = 0x55536574;  // "USet"
+
+int32_t UnicodeSet::toBinary(void *data, int32_t capacity, UErrorCode &errorCode) const {
+    if (U_FAILURE(errorCode)) {
+        return 0;
+    }
+    if (isBogus() || capacity < 0 ||
+            (capacity > 0 && (data == NULL || U_POINTER_MASK_LSB(data, 3) != 0))) {
+        errorCode = U_ILLEGAL_ARGUMENT_ERROR;
+        return 0;
+    }
+
+    int32_t stringCount = strings->size();
+    int32_t stringsLength = 0;
+    int32_t i;
+    for (i = 0; i < stringCount; ++i) {
+        stringsLength += getString(i)->length();
+    }
+    // Write the BMPSet tables if createFromBinary() will use them:
+    // if this set is frozen and has a BMPSet,
+    // or if it is not frozen yet and freeze() would certainly create one.
+    int32_t tablesLength = (isFrozen() ? bmpSet != NULL : stringCount == 0) ?
+        BMPSet::getTablesLength() : 0;
+
+    int32_t length = (int32_t)sizeof(UnicodeSetBinaryHeader) +
+        (len + stringCount) * 4 + ((stringsLength * U_SIZEOF_UCHAR + 3) & ~3) +
+        ((tablesLength + 3) & ~3);
+    if (capacity < length) {
+        errorCode = U_BUFFER_OVERFLOW_ERROR;
+        return length;
+    }
+
+    UnicodeSetBinaryHeader *header = (UnicodeSetBinaryHeader *)data;
+    header->signature = USET_BINARY_SIG;
+    header->formatVersion[0] = 1;
+    header->formatVersion[1] = BMPSet::TABLES_VERSION;
+    header->formatVersion[2] = 0;
+    header->formatVersion[3] = 0;
+    header->length = length;
+    header->listLength = len;
+    header->stringCount = stringCount;
+    header->tablesLength = tablesLength;
+    header->reserved[0] = header->reserved[1] = 0;
+
+    int32_t *p32 = (int32_t *)(header + 1);
+    uprv_memcpy(p32, list, len * 4);
+    p32 += len;
+    int32_t limit = 0;
+    for (i = 0; i < stringCount; ++i) {
+        limit += getString(i)->length();
+        *p32++ = limit;
+    }
+    UChar *p16 = (UChar *)p32;
+    for (i = 0; i < stringCount; ++i) {
+        const UnicodeString &s = *getString(i);
+        u_memcpy(p16, s.getBuffer(), s.length());
+        p16 += s.length();
+    }
+    uint8_t *p8 = (uint8_t *)p16;
+    while (U_POINTER_MASK_LSB(p8, 3) != 0) {
+        *p8++ = 0;
+    }
+    if (tablesLength > 0) {
+        if (bmpSet != NULL) {
+            bmpSet->getTables(p8);
+        } else {
+            BMPSet tempBMPSet(list, len);
+            tempBMPSet.getTables(p8);
+        }
+        p8 += tablesLength;
+        while (U_POINTER_MASK_LSB(p8, 3) != 0) {
+            *p8++ = 0;
+        }
+    }
+    return length;
+}
+
+UnicodeSet * U_EXPORT2
+UnicodeSet::createFromBinary(const void *data, int32_t length,
+                             int32_t *pActualLength, UErrorCode &errorCode) {
+    if (U_FAILURE(errorCode)) {
+        return NULL;
+    }
+    if (data == NULL || length <= 0 || U_POINTER_MASK_LSB(data, 3) != 0) {
+        errorCode = U_ILLEGAL_ARGUMENT_ERROR;
+        return NULL;
+    }
+
+    // Check the header and that all parts fit into the image,
+    // then that the list and the strings are well-formed,
+    // because the set uses them as they are.
+    const UnicodeSetBinaryHeader *header = (const UnicodeSetBinaryHeader *)data;
+    int32_t headerLength = (int32_t)sizeof(UnicodeSetBinaryHeader);
+    if (length < headerLength ||
+            header->signature != USET_BINARY_SIG ||
+            header->formatVersion[0] != 1 ||
+            header->length < headerLength || length < header->length ||
+            (header->length & 3) != 0 ||
+            header->listLength < 1 || header->stringCount < 0 ||
+            header->tablesLength < 0) {
+        errorCode = U_INVALID_FORMAT_ERROR;
+        return NULL;
+    }
+    int32_t listLength = header->listLength;
+    int32_t stringCount = header->stringCount;
+    int32_t remaining = (header->length - headerLength) / 4;
+    if (remaining < listLength || (remaining -= listLength) < stringCount) {
+        errorCode = U_INVALID_FORMAT_ERROR;
+        return NULL;
+    }
+    remaining -= stringCount;
+    const UChar32 *imageList = (const UChar32 *)(header + 1);
+    const int32_t *stringLimits = (const int32_t *)(imageList + listLength);
+    const UChar *imageStrings = (const UChar *)(stringLimits + stringCount);
+
+    int32_t i;
+    UChar32 prev = -1;
+    for (i = 0; i < listLength - 1; ++i) {
+        if (imageList[i] <= prev || UNICODESET_HIGH <= imageList[i]) {
+            errorCode = U_INVALID_FORMAT_ERROR;
+            return NULL;
+        }
+        prev = imageList[i];
+    }
+    if (imageList[listLength - 1] != UNICODESET_HIGH) {
+        errorCode = U_INVALID_FORMAT_ERROR;
+        return NULL;
+    }
+    int32_t prevStart = 0, start = 0;
+    for (i = 0; i < stringCount; ++i) {
+        // Strings have more than one code point, fit into the rest of the image,
+        // and are in ascending order.
+        int32_t limit = stringLimits[i];
+        if (limit <= start || remaining * 2 < limit ||
+                u_countChar32(imageStrings + start, limit - start) < 2 ||
+                (i > 0 && u_strCompare(imageStrings + prevStart, start - prevStart,
+                                       imageStrings + start, limit - start, FALSE) >= 0)) {
+            errorCode = U_INVALID_FORMAT_ERROR;
+            return NULL;
+        }
+        prevStart = start;
+        start = limit;
+    }
+    remaining -= (start + 1) / 2;
+    const uint8_t *tables = NULL;
+    if (header->tablesLength > 0) {
+        if (remaining < (header->tablesLength + 3) / 4) {
+            errorCode = U_INVALID_FORMAT_ERROR;
+            return NULL;
+        }
+        if (header->formatVersion[1] == BMPSet::TABLES_VERSION &&
+                header->tablesLength == BMPSet::getTablesLength()) {
+            tables = (const uint8_t *)(imageStrings + start + (start & 1));
+        }
+    }
+
+    UnicodeSet *set = new UnicodeSet();
+    if (set == NULL || set->isBogus()) {
+        delete set;
+        errorCode = U_MEMORY_ALLOCATION_ERROR;
+        return NULL;
+    }
+    uprv_free(set->list);
+    set->list = (UChar32 *)imageList;
+    set->len = set->capacity = listLength;
+    set->fFlags |= kIsListAlias;
+    start = 0;
+    for (i = 0; i < stringCount; ++i) {
+        // Read-only aliases of the image strings.
+        UnicodeString *s = new UnicodeString(FALSE, imageStrings + start, stringLimits[i] - start);
+        if (s == NULL) {
+            errorCode = U_MEMORY_ALLOCATION_ERROR;
+            break;
+        }
+        set->strings->addElement(s, errorCode);
+        if (U_FAILURE(errorCode)) {
+            delete s;
+            break;
+        }
+        start = stringLimits[i];
+    }
+
+    // Freeze the set like freeze() but without modifying the list.
+    if (U_SUCCESS(errorCode) && !set->strings->isEmpty()) {
+        set->stringSpan = new UnicodeSetStringSpan(*set, *set->strings, UnicodeSetStringSpan::ALL);
+        if (set->stringSpan != NULL && !set->stringSpan->needsStringSpanUTF16()) {
+            delete set->stringSpan;
+            set->stringSpan = NULL;
+        }
+    }
+    if (U_SUCCESS(errorCode) && set->stringSpan == NULL) {
+        if (tables != NULL) {
+            set->bmpSet = new BMPSet(set->list, set->len, tables);
+        } else {
+            set->bmpSet = new BMPSet(set->list, set->len);
+        }
+        if (set->bmpSet == NULL) {
+            errorCode = U_MEMORY_ALLOCATION_ERROR;
+        }
+    }
+    if (U_FAILURE(errorCode)) {
+        delete set;
+        return NULL;
+    }
+    if (pActualLength != NULL) {
+        *pActualLength = header->length;
+    }
+    return set;
+}
+
 //----------------------------------------------------------------
 // Implementation: Utility methods
 //----------------------------------------------------------------
@@ -1695,7 +1941,7 @@ void UnicodeSet::swapBuffers(void) {
 
 void UnicodeSet::setToBogus() {
     clear(); // Remove everything in the set.
-    fFlags = kIsBogus;
+    fFlags = (uint8_t)(kIsBogus | (fFlags & kIsListAlias));
 }
 
 //----------------------------------------------------------------
@@ -1,7 +1,7 @@
 /*
 *******************************************************************************
 *
-*   Copyright (C) 2002-2014, International Business Machines
+*   Copyright (C) 2002-2016, International Business Machines
 *   Corporation and others.  All Rights Reserved.
 *
 *******************************************************************************
@@ -26,6 +26,7 @@
 #include "unicode/unorm2.h"
 #include "unicode/uscript.h"
 #include "unicode/ustring.h"
+#include "unicode/utf8.h"
 #include "cstring.h"
 #include "normalizer2impl.h"
 #include "umutex.h"
@@ -469,6 +470,179 @@ u_getIntPropertyValue(UChar32 c, UProperty which) {
     return 0;  // undefined
 }
 
+namespace {
+
+/**
+ * Looks up the implementation of a property once,
+ * for getting its values for many code points.
+ * get(c) returns the same values as u_getIntPropertyValue(c, which).
+ */
+class IntPropertyGetter {
+public:
+    IntPropertyGetter(UProperty w) : which(w), binProp(NULL), intProp(NULL) {
+        if(UCHAR_BINARY_START<=which && which<UCHAR_BINARY_LIMIT) {
+            binProp=&binProps[which];
+        } else if(UCHAR_INT_START<=which && which<UCHAR_INT_LIMIT) {
+            intProp=&intProps[which-UCHAR_INT_START];
+        }
+    }
+
+    int32_t get(UChar32 c) const {
+        if(binProp!=NULL) {
+            return binProp->contains(*binProp, c, which);
+        } else if(intProp!=NULL) {
+            return intProp->getValue(*intProp, c, which);
+        } else if(which==UCHAR_GENERAL_CATEGORY_MASK) {
+            return U_MASK(u_charType(c));
+        } else {
+            return 0;  // undefined
+        }
+    }
+
+private:
+    UProperty which;
+    const BinaryProperty *binProp;
+    const IntProperty *intProp;
+};
+
+UBool checkBulkArgs(const void *s, int32_t length, const int32_t *values, int32_t capacity,
+                    UErrorCode *pErrorCode) {
+    if(U_FAILURE(*pErrorCode)) {
+        return FALSE;
+    }
+    if( (s==NULL && length!=0) || length<-1 ||
+        capacity<0 || (values==NULL && capacity>0)
+    ) {
+        *pErrorCode=U_ILLEGAL_ARGUMENT_ERROR;
+        return FALSE;
+    }
+    return TRUE;
+}
+
+/**
+ * Returns the general category mask for spanning which=value,
+ * or 0 if which is not a general category property.
+ */
+uint32_t getSpanCharTypesMask(UProperty which, int32_t value) {
+    if(which==UCHAR_GENERAL_CATEGORY_MASK) {
+        return (uint32_t)value;
+    } else if(which==UCHAR_GENERAL_CATEGORY && 0<=value && value<U_CHAR_CATEGORY_COUNT) {
+        return U_MASK(value);
+    } else {
+        return 0;
+    }
+}
+
+}  // namespace
+
+U_CAPI int32_t U_EXPORT2
+u_strGetIntPropertyValues(const UChar *s, int32_t length, UProperty which,
+                          int32_t *values, int32_t capacity,
+                          UErrorCode *pErrorCode) {
+    if(!checkBulkArgs(s, length, values, capacity, pErrorCode)) {
+        return 0;
+    }
+    if(length<0) {
+        length=u_strlen(s);
+    }
+    IntPropertyGetter getter(which);
+    int32_t count=0;
+    for(int32_t i=0; i<length;) {
+        UChar32 c;
+        U16_NEXT(s, i, length, c);
+        int32_t value=getter.get(c);
+        if(count<capacity) {
+            values[count]=value;
+        }
+        ++count;
+    }
+    if(count>capacity) {
+        *pErrorCode=U_BUFFER_OVERFLOW_ERROR;
+    }
+    return count;
+}
+
+U_CAPI int32_t U_EXPORT2
+u_strGetIntPropertyValuesUTF8(const char *s, int32_t length, UProperty which,
+                              int32_t *values, int32_t capacity,
+                              UErrorCode *pErrorCode) {
+    if(!checkBulkArgs(s, length, values, capacity, pErrorCode)) {
+        return 0;
+    }
+    if(length<0) {
+        length=(int32_t)uprv_strlen(s);
+    }
+    IntPropertyGetter getter(which);
+    const uint8_t *s8=reinterpret_cast<const uint8_t *>(s);
+    int32_t count=0;
+    for(int32_t i=0; i<length;) {
+        UChar32 c;
+        U8_NEXT(s8, i, length, c);
+        if(c<0) {
+            c=0xfffd;
+        }
+        int32_t value=getter.get(c);
+        if(count<capacity) {
+            values[count]=value;
+        }
+        ++count;
+    }
+    if(count>capacity) {
+        *pErrorCode=U_BUFFER_OVERFLOW_ERROR;
+    }
+    return count;
+}
+
+U_CAPI int32_t U_EXPORT2
+u_strSpanIntPropertyValue(const UChar *s, int32_t length, UProperty which, int32_t value) {
+    if(s==NULL || length<-1) {
+        return 0;
+    }
+    if(length<0) {
+        length=u_strlen(s);
+    }
+    if(which==UCHAR_GENERAL_CATEGORY || which==UCHAR_GENERAL_CATEGORY_MASK) {
+        return uprv_spanCharTypes(s, length, getSpanCharTypesMask(which, value));
+    }
+    IntPropertyGetter getter(which);
+    for(int32_t i=0; i<length;) {
+        int32_t prev=i;
+        UChar32 c;
+        U16_NEXT(s, i, length, c);
+        if(getter.get(c)!=value) {
+            return prev;
+        }
+    }
+    return length;
+}
+
+U_CAPI int32_t U_EXPORT2
+u_strSpanIntPropertyValueUTF8(const char *s, int32_t length, UProperty which, int32_t value) {
+    if(s==NULL || length<-1) {
+        return 0;
+    }
+    if(length<0) {
+        length=(int32_t)uprv_strlen(s);
+    }
+    if(which==UCHAR_GENERAL_CATEGORY || which==UCHAR_GENERAL_CATEGORY_MASK) {
+        return uprv_spanCharTypesUTF8(s, length, getSpanCharTypesMask(which, value));
+    }
+    IntPropertyGetter getter(which);
+    const uint8_t *s8=reinterpret_cast<const uint8_t *>(s);
+    for(int32_t i=0; i<length;) {
+        int32_t prev=i;
+        UChar32 c;
+        U8_NEXT(s8, i, length, c);
+        if(c<0) {
+            c=0xfffd;
+        }
+        if(getter.get(c)!=value) {
+            return prev;
+        }
+    }
+    return length;
+}
+
 U_CAPI int32_t U_EXPORT2
 u_getIntPropertyMinValue(UProperty /*which*/) {
     return 0; /* all binary/enum/int properties have a minimum value of 0 */
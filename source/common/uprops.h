@@ -1,7 +1,7 @@
 /*
 *******************************************************************************
 *
-*   Copyright (C) 2002-2012, International Business Machines
+*   Copyright (C) 2002-2016, International Business Machines
 *   Corporation and others.  All Rights Reserved.
 *
 *******************************************************************************
@@ -264,6 +264,25 @@ u_isgraphPOSIX(UChar32 c);
 U_CFUNC UBool
 u_isprintPOSIX(UChar32 c);
 
+/**
+ * Returns the length of the initial substring of s (in UTF-16 code units)
+ * whose code points all have general categories in the mask (U_GC_XX_MASK bits).
+ * length must be >=0.
+ * @internal
+ */
+U_CFUNC int32_t
+uprv_spanCharTypes(const UChar *s, int32_t length, uint32_t mask);
+
+/**
+ * Returns the length of the initial substring of s (in bytes)
+ * whose code points all have general categories in the mask (U_GC_XX_MASK bits).
+ * Each ill-formed sequence is treated like U+FFFD.
+ * length must be >=0.
+ * @internal
+ */
+U_CFUNC int32_t
+uprv_spanCharTypesUTF8(const char *s, int32_t length, uint32_t mask);
+
 /** Turn a bit index into a bit flag. @internal */
 #define FLAG(n) ((uint32_t)1<<(n))
 
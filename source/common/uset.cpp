@@ -1,7 +1,7 @@
 /*
 *******************************************************************************
 *
-*   Copyright (C) 2002-2011, International Business Machines
+*   Copyright (C) 2002-2016, International Business Machines
 *   Corporation and others.  All Rights Reserved.
 *
 *******************************************************************************
@@ -337,6 +337,23 @@ uset_serialize(const USet* set, uint16_t* dest, int32_t destCapacity, UErrorCode
     return ((const UnicodeSet*) set)->UnicodeSet::serialize(dest, destCapacity,* ec);
 }
 
+U_CAPI int32_t U_EXPORT2
+uset_toBinary(const USet *set, void *data, int32_t capacity, UErrorCode *pErrorCode) {
+    if (pErrorCode==NULL || U_FAILURE(*pErrorCode)) {
+        return 0;
+    }
+    return ((const UnicodeSet*) set)->UnicodeSet::toBinary(data, capacity, *pErrorCode);
+}
+
+U_CAPI USet * U_EXPORT2
+uset_openFromBinary(const void *data, int32_t length, int32_t *pActualLength,
+                    UErrorCode *pErrorCode) {
+    if (pErrorCode==NULL || U_FAILURE(*pErrorCode)) {
+        return NULL;
+    }
+    return (USet *)UnicodeSet::createFromBinary(data, length, pActualLength, *pErrorCode);
+}
+
 U_CAPI UBool U_EXPORT2
 uset_getSerializedSet(USerializedSet* fillSet, const uint16_t* src, int32_t srcLength) {
     int32_t length;
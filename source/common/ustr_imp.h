@@ -1,6 +1,6 @@
 /*  
 **********************************************************************
-*   Copyright (C) 1999-2015, International Business Machines
+*   Copyright (C) 1999-2016, International Business Machines
 *   Corporation and others.  All Rights Reserved.
 **********************************************************************
 *   file name:  ustr_imp.h
@@ -144,6 +144,30 @@ UStringCaseMapper(const UCaseMap *csm,
 
 #endif
 
+/**
+ * Marks a Latin-1 character in the ustrcase_latin1ToLower[] etc. tables
+ * which needs the full ucase functions for its mapping.
+ */
+#define USTRCASE_LATIN1_SPECIAL 0xffff
+
+/**
+ * Latin-1 fast path tables for string case mapping, for UTF-16 and UTF-8.
+ * Each maps c<=0xff to its full lowercase/uppercase/case folding
+ * if that is a single BMP code point which does not depend on the context,
+ * for the root locale and default case folding options.
+ * Otherwise the entry is USTRCASE_LATIN1_SPECIAL, for example for U+00DF sharp s.
+ */
+U_CFUNC const UChar ustrcase_latin1ToLower[256];
+U_CFUNC const UChar ustrcase_latin1ToUpper[256];
+U_CFUNC const UChar ustrcase_latin1Fold[256];
+
+/**
+ * Returns TRUE if the Latin-1 fast path tables can be used for the locale of this UCaseMap.
+ * Turkic and Lithuanian case mappings differ for some Latin-1 letters.
+ */
+U_CFUNC UBool
+ustrcase_isLatin1FastPathLocale(const UCaseMap *csm);
+
 /** Implements UStringCaseMapper. */
 U_CFUNC int32_t U_CALLCONV
 ustrcase_internalToLower(const UCaseMap *csm,
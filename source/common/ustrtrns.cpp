@@ -1,7 +1,7 @@
 /*
 ******************************************************************************
 *
-*   Copyright (C) 2001-2014, International Business Machines
+*   Copyright (C) 2001-2016, International Business Machines
 *   Corporation and others.  All Rights Reserved.
 *
 ******************************************************************************
@@ -396,6 +396,172 @@ utf8_nextCharSafeBodyPointer(const uint8_t **ps, const uint8_t *limit, UChar32 c
     return c;
 }
 
+/*
+ * Word-at-a-time scanning for UTF validation and conversion.
+ * Machine words are loaded via memcpy() which compiles to a plain
+ * (possibly unaligned) load, and their bytes or UChars are tested in parallel.
+ */
+typedef size_t UTFWord;
+
+/* 0x80 in each byte of a word */
+#define UTF_WORD_HIGH_BITS (((UTFWord)~(UTFWord)0/0xff)*0x80)
+
+/* 0x0001 / 0x8000 / 0xf800 / 0xd800 in each UChar of a word */
+#define UTF_WORD_U16_ONES (((UTFWord)~(UTFWord)0/0xffff))
+#define UTF_WORD_U16_HIGH_BITS (UTF_WORD_U16_ONES*0x8000)
+#define UTF_WORD_U16_F800 (UTF_WORD_U16_ONES*0xf800)
+#define UTF_WORD_U16_D800 (UTF_WORD_U16_ONES*0xd800)
+
+/*
+ * Returns TRUE if the sizeof(UTFWord) bytes starting at s are all ASCII.
+ */
+static inline UBool
+isASCIIWord(const uint8_t *s) {
+    UTFWord w;
+    uprv_memcpy(&w, s, sizeof(UTFWord));
+    return (w&UTF_WORD_HIGH_BITS)==0;
+}
+
+/*
+ * Returns a pointer to the first non-ASCII byte in [s, limit[, or limit.
+ */
+static inline const uint8_t *
+skipASCII(const uint8_t *s, const uint8_t *limit) {
+    while((limit-s)>=(int32_t)sizeof(UTFWord) && isASCIIWord(s)) {
+        s+=sizeof(UTFWord);
+    }
+    while(s<limit && *s<=0x7f) {
+        ++s;
+    }
+    return s;
+}
+
+/*
+ * For a 3-byte lead byte's low 4 bits, the bits for (first trail byte>>5) values
+ * that are valid: E0 requires A0..BF, ED requires 80..9F, others 80..BF.
+ */
+static const uint8_t utf8Lead3T1Bits[16]={
+    0x20, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
+    0x30, 0x30, 0x30, 0x30, 0x30, 0x10, 0x30, 0x30
+};
+
+/*
+ * For a first trail byte's high 4 bits, the bits for (4-byte lead byte&7) values
+ * that are valid: F0 requires 90..BF, F4 requires 80..8F, F1..F3 allow 80..BF.
+ */
+static const uint8_t utf8Lead4T1Bits[16]={
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0x1e, 0x0f, 0x0f, 0x0f, 0, 0, 0, 0
+};
+
+/*
+ * Returns the offset of the first ill-formed sequence in [start, limit[,
+ * or -1 if the text is well-formed UTF-8.
+ * Strict: Non-shortest forms, surrogates and code points beyond U+10FFFF are ill-formed.
+ */
+static int32_t
+validateUTF8(const uint8_t *start, const uint8_t *limit) {
+    const uint8_t *s=start;
+    while(s<limit) {
+        uint8_t b=*s;
+        int32_t length;
+        if(b<=0x7f) {
+            /* Skip single ASCII bytes (e.g., spaces) inline, longer runs by words. */
+            if(++s<limit && *s<=0x7f) {
+                s=skipASCII(s, limit);
+            }
+            continue;
+        }
+        length=(int32_t)(limit-s);
+        if(b<0xe0) {
+            if(b>=0xc2 && length>=2 && U8_IS_TRAIL(s[1])) {
+                s+=2;
+                continue;
+            }
+        } else if(b<0xf0) {
+            if( length>=3 && (utf8Lead3T1Bits[b&0xf]&(1<<(s[1]>>5))) &&
+                U8_IS_TRAIL(s[1]) && U8_IS_TRAIL(s[2])
+            ) {
+                s+=3;
+                continue;
+            }
+        } else if(b<=0xf4) {
+            if( length>=4 && (utf8Lead4T1Bits[s[1]>>4]&(1<<(b&7))) &&
+                U8_IS_TRAIL(s[2]) && U8_IS_TRAIL(s[3])
+            ) {
+                s+=4;
+                continue;
+            }
+        }
+        return (int32_t)(s-start);
+    }
+    return -1;
+}
+
+/*
+ * Returns the offset of the first unpaired surrogate in [start, limit[,
+ * or -1 if the text is well-formed UTF-16.
+ */
+static int32_t
+validateUTF16(const UChar *start, const UChar *limit) {
+    const UChar *s=start;
+    UTFWord w;
+    while(s<limit) {
+        /* Skip whole words without surrogates: test for any (c&0xf800)==0xd800. */
+        while((limit-s)>=(int32_t)(sizeof(UTFWord)/U_SIZEOF_UCHAR)) {
+            uprv_memcpy(&w, s, sizeof(UTFWord));
+            w=(w&UTF_WORD_U16_F800)^UTF_WORD_U16_D800;  /* surrogates become 0 */
+            if(((w-UTF_WORD_U16_ONES)&~w&UTF_WORD_U16_HIGH_BITS)!=0) {
+                break;
+            }
+            s+=sizeof(UTFWord)/U_SIZEOF_UCHAR;
+        }
+        if(s==limit) {
+            break;
+        }
+        UChar c=*s++;
+        if(U16_IS_SURROGATE(c)) {
+            if(U16_IS_SURROGATE_LEAD(c) && s<limit && U16_IS_TRAIL(*s)) {
+                ++s;
+            } else {
+                return (int32_t)(s-1-start);
+            }
+        }
+    }
+    return -1;
+}
+
+U_CAPI int32_t U_EXPORT2
+u_validateUTF8(const char *s, int32_t length, UErrorCode *pErrorCode) {
+    if(U_FAILURE(*pErrorCode)) {
+        return -1;
+    }
+    if((s==NULL && length!=0) || length<-1) {
+        *pErrorCode=U_ILLEGAL_ARGUMENT_ERROR;
+        return -1;
+    }
+    if(length<0) {
+        length=(int32_t)uprv_strlen(s);
+    }
+    const uint8_t *s8=(const uint8_t *)s;
+    return validateUTF8(s8, s8+length);
+}
+
+U_CAPI int32_t U_EXPORT2
+u_validateUTF16(const UChar *s, int32_t length, UErrorCode *pErrorCode) {
+    if(U_FAILURE(*pErrorCode)) {
+        return -1;
+    }
+    if((s==NULL && length!=0) || length<-1) {
+        *pErrorCode=U_ILLEGAL_ARGUMENT_ERROR;
+        return -1;
+    }
+    if(length<0) {
+        length=u_strlen(s);
+    }
+    return validateUTF16(s, s+length);
+}
+
 U_CAPI UChar* U_EXPORT2
 u_strFromUTF8WithSub(UChar *dest,
               int32_t destCapacity,
@@ -563,6 +729,19 @@ u_strFromUTF8WithSub(UChar *dest,
                 if(ch <= 0x7f){
                     *pDest++=(UChar)ch;
                     ++pSrc;
+                    /*
+                     * Copy following ASCII bytes a word at a time.
+                     * Each one takes one iteration's worth of input and output,
+                     * and the loop condition below needs count>=1 left.
+                     */
+                    while(count > (int32_t)sizeof(UTFWord) && isASCIIWord(pSrc)) {
+                        for(int32_t i = 0; i < (int32_t)sizeof(UTFWord); ++i) {
+                            pDest[i] = pSrc[i];
+                        }
+                        pDest += sizeof(UTFWord);
+                        pSrc += sizeof(UTFWord);
+                        count -= sizeof(UTFWord);
+                    }
                 } else {
                     if(ch > 0xe0) {
                         if( /* handle U+1000..U+CFFF inline */
@@ -1,6 +1,6 @@
 /*
 *******************************************************************************
-*   Copyright (C) 2010-2015, International Business Machines
+*   Copyright (C) 2010-2016, International Business Machines
 *   Corporation and others.  All Rights Reserved.
 *******************************************************************************
 *   file name:  uts46.cpp
@@ -421,31 +421,50 @@ UTS46::processUTF8(const StringPiece &src,
         dest.Flush();
         return;
     }
-    UnicodeString destString;
+    MaybeStackArray<char, 256> scratch;
+    if(srcLength>scratch.getCapacity() && scratch.resize(srcLength)==NULL) {
+        errorCode=U_MEMORY_ALLOCATION_ERROR;
+        return;
+    }
+    UBool disallowNonLDHDot=(options&UIDNA_USE_STD3_RULES)!=0;
+    // The ASCII fastpath processes runs of ASCII labels directly in UTF-8.
+    // When it reaches a label that it cannot handle, it processes that label
+    // in UTF-16, together with any following labels up to the next ASCII dot,
+    // and then continues after that dot.
+    UBool isOkBiDiASCII=TRUE;  // for all labels handled by the fastpath
+    int32_t destLength=0;  // only for the domain name length check
+    UBool isASCIIDest=TRUE;
+    UBool endsWithDot=FALSE;
+    int32_t start=0;  // start of the current fastpath run
     int32_t labelStart=0;
-    if(srcLength<=256) {  // length of stackArray[]
-        // ASCII fastpath
-        char stackArray[256];
+    for(;;) {
         int32_t destCapacity;
-        char *destArray=dest.GetAppendBuffer(srcLength, srcLength+20,
-                                             stackArray, UPRV_LENGTHOF(stackArray), &destCapacity);
-        UBool disallowNonLDHDot=(options&UIDNA_USE_STD3_RULES)!=0;
+        char *destArray=dest.GetAppendBuffer(srcLength-start, srcLength-start+20,
+                                             scratch.getAlias(), scratch.getCapacity(),
+                                             &destCapacity);
         int32_t i;
-        for(i=0;; ++i) {
+        for(i=labelStart;; ++i) {
             if(i==srcLength) {
-                if(toASCII) {
-                    if((i-labelStart)>63) {
-                        info.labelErrors|=UIDNA_ERROR_LABEL_TOO_LONG;
-                    }
+                if(toASCII && (i-labelStart)>63) {
+                    info.labelErrors|=UIDNA_ERROR_LABEL_TOO_LONG;
+                }
+                info.errors|=info.labelErrors;
+                dest.Append(destArray, i-start);
+                if(start==0) {
+                    // Pure ASCII fastpath.
                     // There is a trailing dot if labelStart==i.
-                    if(!isLabel && i>=254 && (i>254 || labelStart<i)) {
+                    if(toASCII && !isLabel && i>=254 && (i>254 || labelStart<i)) {
                         info.errors|=UIDNA_ERROR_DOMAIN_NAME_TOO_LONG;
                     }
+                    dest.Flush();
+                    return;
                 }
-                info.errors|=info.labelErrors;
-                dest.Append(destArray, i);
-                dest.Flush();
-                return;
+                if(isOkBiDiASCII) {
+                    isOkBiDiASCII=isASCIIOkBiDi(srcArray+start, i-start);
+                }
+                destLength+=i-start;
+                endsWithDot= labelStart==i;
+                break;
             }
             char c=srcArray[i];
             if((int8_t)c<0) {  // (uint8_t)c>0x7f
@@ -453,11 +472,11 @@ UTS46::processUTF8(const StringPiece &src,
             }
             int cData=asciiData[(int)c];  // Cast: gcc warns about indexing with a char.
             if(cData>0) {
-                destArray[i]=c+0x20;  // Lowercase an uppercase ASCII letter.
+                destArray[i-start]=c+0x20;  // Lowercase an uppercase ASCII letter.
             } else if(cData<0 && disallowNonLDHDot) {
                 break;  // Replacing with U+FFFD can be complicated for toASCII.
             } else {
-                destArray[i]=c;
+                destArray[i-start]=c;
                 if(c==0x2d) {  // hyphen
                     if(i==(labelStart+3) && srcArray[i-1]==0x2d) {
                         // "??--..." is Punycode or forbidden.
@@ -487,35 +506,85 @@ UTS46::processUTF8(const StringPiece &src,
                 }
             }
         }
+        if(i==srcLength) {
+            break;
+        }
         info.errors|=info.labelErrors;
-        // Convert the processed ASCII prefix of the current label to UTF-16.
-        int32_t mappingStart=i-labelStart;
-        destString=UnicodeString::fromUTF8(StringPiece(destArray+labelStart, mappingStart));
-        // Output the previous ASCII labels and process the rest of src in UTF-16.
-        dest.Append(destArray, labelStart);
-        processUnicode(UnicodeString::fromUTF8(StringPiece(src, labelStart)), 0, mappingStart,
-                       isLabel, toASCII,
-                       destString, info, errorCode);
-    } else {
-        // src is too long for the ASCII fastpath implementation.
-        processUnicode(UnicodeString::fromUTF8(src), 0, 0,
+        // Process the current label in UTF-16, through the next ASCII dot.
+        // Including that dot makes processUnicode() treat the label as a
+        // non-final one. Without a following dot, a preceding one makes it
+        // permit an empty last label as in UTF-16 processing of the whole name.
+        int32_t limit=srcLength;
+        if(!isLabel) {
+            for(int32_t j=i; j<srcLength; ++j) {
+                if(srcArray[j]==0x2e) {
+                    limit=j+1;
+                    break;
+                }
+            }
+        }
+        int32_t labelStart16= labelStart>0 && limit==srcLength ? 1 : 0;
+        int32_t mappingStart=labelStart16+(i-labelStart);
+        UnicodeString src16, destString;
+        // The UTF-16 string is at most as long as the UTF-8 one.
+        // Leave room for the NUL terminator to avoid a warning.
+        UChar *src16Array=src16.getBuffer(labelStart16+(limit-labelStart)+1);
+        UChar *destString16=destString.getBuffer(mappingStart);
+        if(src16Array==NULL || destString16==NULL) {
+            errorCode=U_MEMORY_ALLOCATION_ERROR;
+            return;
+        }
+        if(labelStart16>0) {
+            src16Array[0]=destString16[0]=0x2e;
+        }
+        // Copy the processed ASCII prefix of the current label.
+        for(int32_t j=labelStart16; j<mappingStart; ++j) {
+            destString16[j]=(UChar)(uint8_t)destArray[labelStart-start-labelStart16+j];
+        }
+        destString.releaseBuffer(mappingStart);
+        int32_t src16Length;
+        u_strFromUTF8WithSub(src16Array+labelStart16, src16.getCapacity()-labelStart16, &src16Length,
+                             srcArray+labelStart, limit-labelStart,
+                             0xfffd, NULL, &errorCode);
+        src16.releaseBuffer(U_SUCCESS(errorCode) ? labelStart16+src16Length : 0);
+        if(U_FAILURE(errorCode)) {
+            return;
+        }
+        // Output the previous ASCII labels of this run.
+        dest.Append(destArray, labelStart-start);
+        if(labelStart>start) {
+            if(isOkBiDiASCII) {
+                isOkBiDiASCII=isASCIIOkBiDi(srcArray+start, labelStart-start);
+            }
+            destLength+=labelStart-start;
+        }
+        processUnicode(src16, labelStart16, mappingStart,
                        isLabel, toASCII,
                        destString, info, errorCode);
-    }
-    destString.toUTF8(dest);  // calls dest.Flush()
-    if(toASCII && !isLabel) {
-        // length==labelStart==254 means that there is a trailing dot (ok) and
-        // destString is empty (do not index at 253-labelStart).
-        int32_t length=labelStart+destString.length();
-        if( length>=254 && isASCIIString(destString) &&
-            (length>254 ||
-             (labelStart<254 && destString[253-labelStart]!=0x2e))
-        ) {
-            info.errors|=UIDNA_ERROR_DOMAIN_NAME_TOO_LONG;
+        if(U_FAILURE(errorCode)) {
+            return;
+        }
+        UnicodeString output=destString.tempSubString(labelStart16);
+        output.toUTF8(dest);
+        if(isASCIIDest) {
+            isASCIIDest=isASCIIString(output);
+            destLength+=output.length();
+        }
+        if(limit==srcLength) {
+            // An empty output follows a dot if labelStart>0.
+            endsWithDot= output.isEmpty() || output[output.length()-1]==0x2e;
+            break;
         }
+        start=labelStart=limit;
+    }
+    dest.Flush();
+    if( toASCII && !isLabel && isASCIIDest &&
+        destLength>=254 && (destLength>254 || !endsWithDot)
+    ) {
+        info.errors|=UIDNA_ERROR_DOMAIN_NAME_TOO_LONG;
     }
     if( info.isBiDi && U_SUCCESS(errorCode) && (info.errors&severeErrors)==0 &&
-        (!info.isOkBiDi || (labelStart>0 && !isASCIIOkBiDi(srcArray, labelStart)))
+        (!info.isOkBiDi || !isOkBiDiASCII)
     ) {
         info.errors|=UIDNA_ERROR_BIDI;
     }
@@ -1090,9 +1159,10 @@ isASCIIOkBiDi(const UChar *s, int32_t length) {
     return TRUE;
 }
 
-// UTF-8 version, called for source ASCII prefix.
+// UTF-8 version, called for source runs of ASCII labels.
 // Can contain uppercase A-Z.
-// s[length-1] must be the trailing dot.
+// s[length-1] is normally the trailing dot;
+// otherwise the last label is checked as well.
 static UBool
 isASCIIOkBiDi(const char *s, int32_t length) {
     int32_t labelStart=0;
@@ -1119,6 +1189,14 @@ isASCIIOkBiDi(const char *s, int32_t length) {
             }
         }
     }
+    // s may end with a label that is not followed by a dot.
+    if(labelStart<length) {
+        char c=s[length-1];
+        if(!(0x61<=c && c<=0x7a) && !(0x41<=c && c<=0x5a) && !(0x30<=c && c<=0x39)) {
+            // Last character in the label is not an L or EN.
+            return FALSE;
+        }
+    }
     return TRUE;
 }
 
@@ -1,6 +1,6 @@
 /*
 *******************************************************************************
-* Copyright (C) 2013-2015, International Business Machines
+* Copyright (C) 2013-2016, International Business Machines
 * Corporation and others.  All Rights Reserved.
 *******************************************************************************
 * collationtailoring.cpp
@@ -36,7 +36,7 @@ CollationTailoring::CollationTailoring(const CollationSettings *baseSettings)
           ownedData(NULL),
           builder(NULL), memory(NULL), bundle(NULL),
           trie(NULL), unsafeBackwardSet(NULL),
-          maxExpansions(NULL) {
+          maxExpansions(NULL), contextChars(NULL), prefixedChars(NULL) {
     if(baseSettings != NULL) {
         U_ASSERT(baseSettings->reorderCodesLength == 0);
         U_ASSERT(baseSettings->reorderTable == NULL);
@@ -50,6 +50,7 @@ CollationTailoring::CollationTailoring(const CollationSettings *baseSettings)
     rules.getTerminatedBuffer();  // ensure NUL-termination
     version[0] = version[1] = version[2] = version[3] = 0;
     maxExpansionsInitOnce.reset();
+    contextCharsInitOnce.reset();
 }
 
 CollationTailoring::~CollationTailoring() {
@@ -62,6 +63,9 @@ CollationTailoring::~CollationTailoring() {
     delete unsafeBackwardSet;
     uhash_close(maxExpansions);
     maxExpansionsInitOnce.reset();
+    delete contextChars;
+    delete prefixedChars;
+    contextCharsInitOnce.reset();
 }
 
 UBool
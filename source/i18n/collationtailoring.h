@@ -1,6 +1,6 @@
 /*
 *******************************************************************************
-* Copyright (C) 2013-2014, International Business Machines
+* Copyright (C) 2013-2016, International Business Machines
 * Corporation and others.  All Rights Reserved.
 *******************************************************************************
 * collationtailoring.h
@@ -81,6 +81,9 @@ struct U_I18N_API CollationTailoring : public SharedObject {
     UnicodeSet *unsafeBackwardSet;
     mutable UHashtable *maxExpansions;
     mutable UInitOnce maxExpansionsInitOnce;
+    mutable UnicodeSet *contextChars;
+    mutable UnicodeSet *prefixedChars;
+    mutable UInitOnce contextCharsInitOnce;
 
 private:
     /**
@@ -1,6 +1,6 @@
 /*
  **********************************************************************
- *   Copyright (C) 2005-2015, International Business Machines
+ *   Copyright (C) 2005-2016, International Business Machines
  *   Corporation and others.  All Rights Reserved.
  **********************************************************************
  */
@@ -150,7 +150,7 @@ void CharsetDetector::setRecognizers(UErrorCode &status)
 CharsetDetector::CharsetDetector(UErrorCode &status)
   : textIn(new InputText(status)), resultArray(NULL),
     resultCount(0), fStripTags(FALSE), fFreshTextSet(FALSE),
-    fEnabledRecognizers(NULL)
+    fEnabledRecognizers(NULL), fStopConfidence(0), fNextRecognizer(0), fBestConfidence(0)
 {
     if (U_FAILURE(status)) {
         return;
@@ -200,6 +200,12 @@ void CharsetDetector::setText(const char *in, int32_t len)
     fFreshTextSet = TRUE;
 }
 
+void CharsetDetector::appendText(const char *in, int32_t len, UErrorCode &status)
+{
+    textIn->appendText(in, len, status);
+    fFreshTextSet = TRUE;
+}
+
 UBool CharsetDetector::setStripTagsFlag(UBool flag)
 {
     UBool temp = fStripTags;
@@ -213,6 +219,24 @@ UBool CharsetDetector::getStripTagsFlag() const
     return fStripTags;
 }
 
+void CharsetDetector::setStopConfidence(int32_t confidence, UErrorCode &status)
+{
+    if (U_FAILURE(status)) {
+        return;
+    }
+    if (confidence < 0 || confidence > 100) {
+        status = U_ILLEGAL_ARGUMENT_ERROR;
+        return;
+    }
+    fStopConfidence = confidence;
+    fFreshTextSet = TRUE;
+}
+
+int32_t CharsetDetector::getStopConfidence() const
+{
+    return fStopConfidence;
+}
+
 void CharsetDetector::setDeclaredEncoding(const char *encoding, int32_t len) const
 {
     textIn->setDeclaredEncoding(encoding,len);
@@ -229,11 +253,12 @@ int32_t CharsetDetector::getDetectableCount()
 
 const CharsetMatch *CharsetDetector::detect(UErrorCode &status)
 {
-    int32_t maxMatchesFound = 0;
+    // Only the best match is needed. Confidence values are at most 100, and
+    // of matches with equal confidence the one from the earlier recognizer wins,
+    // so no later recognizer can replace a match with confidence 100.
+    runRecognizers(fStopConfidence > 0 ? fStopConfidence : 100, status);
 
-    detectAll(maxMatchesFound, status);
-
-    if(maxMatchesFound > 0) {
+    if(U_SUCCESS(status) && resultCount > 0) {
         return resultArray[0];
     } else {
         return NULL;
@@ -241,36 +266,59 @@ const CharsetMatch *CharsetDetector::detect(UErrorCode &status)
 }
 
 const CharsetMatch * const *CharsetDetector::detectAll(int32_t &maxMatchesFound, UErrorCode &status)
+{
+    runRecognizers(fStopConfidence, status);
+    if (U_FAILURE(status)) {
+        return NULL;
+    }
+
+    maxMatchesFound = resultCount;
+
+    return resultArray;
+}
+
+/*
+ * Run the recognizers that have not yet been run on the current input text,
+ * until one of them reports a match with at least stopConfidence
+ * (if stopConfidence > 0).
+ * The matches are sorted by decreasing confidence; the sort is stable,
+ * so that the result is the same whether the recognizers were run
+ * in one or in several steps.
+ * Sets an error if no input text has been set.
+ */
+void CharsetDetector::runRecognizers(int32_t stopConfidence, UErrorCode &status)
 {
     if(!textIn->isSet()) {
         status = U_MISSING_RESOURCE_ERROR;// TODO:  Need to set proper status code for input text not set
 
-        return NULL;
-    } else if (fFreshTextSet) {
-        CharsetRecognizer *csr;
-        int32_t            i;
+        return;
+    }
 
+    if (fFreshTextSet) {
         textIn->MungeInput(fStripTags);
-
-        // Iterate over all possible charsets, remember all that
-        // give a match quality > 0.
         resultCount = 0;
-        for (i = 0; i < fCSRecognizers_size; i += 1) {
-            csr = fCSRecognizers[i]->recognizer;
-            if (csr->match(textIn, resultArray[resultCount])) {
-                resultCount++;
-            }
-        }
-
-        if (resultCount > 1) {
-            uprv_sortArray(resultArray, resultCount, sizeof resultArray[0], charsetMatchComparator, NULL, TRUE, &status);
-        }
+        fNextRecognizer = 0;
+        fBestConfidence = 0;
         fFreshTextSet = FALSE;
     }
 
-    maxMatchesFound = resultCount;
+    // Iterate over the remaining charsets, remember all that
+    // give a match quality > 0.
+    int32_t previousCount = resultCount;
+    while (fNextRecognizer < fCSRecognizers_size &&
+            (stopConfidence <= 0 || fBestConfidence < stopConfidence)) {
+        CharsetRecognizer *csr = fCSRecognizers[fNextRecognizer++]->recognizer;
+        if (csr->match(textIn, resultArray[resultCount])) {
+            int32_t confidence = resultArray[resultCount++]->getConfidence();
+            if (confidence > fBestConfidence) {
+                fBestConfidence = confidence;
+            }
+        }
+    }
 
-    return resultArray;
+    if (resultCount > 1 && resultCount > previousCount) {
+        uprv_sortArray(resultArray, resultCount, sizeof resultArray[0], charsetMatchComparator, NULL, TRUE, &status);
+    }
 }
 
 void CharsetDetector::setDetectableCharset(const char *encoding, UBool enabled, UErrorCode &status)
@@ -1,6 +1,6 @@
 /*
  **********************************************************************
- *   Copyright (C) 2005-2013, International Business Machines
+ *   Copyright (C) 2005-2016, International Business Machines
  *   Corporation and others.  All Rights Reserved.
  **********************************************************************
  */
@@ -32,6 +32,13 @@ private:
                                 // been changed from the default. The array index is
                                 // corresponding to fCSRecognizers. See setDetectableCharset().
 
+    int32_t fStopConfidence;    // If > 0, detectAll() stops running recognizers
+                                // after the first match with at least this confidence.
+    int32_t fNextRecognizer;    // Index of the next recognizer to run on the current text.
+    int32_t fBestConfidence;    // Highest confidence of the matches so far.
+
+    void runRecognizers(int32_t stopConfidence, UErrorCode &status);
+
 public:
     CharsetDetector(UErrorCode &status);
 
@@ -39,6 +46,8 @@ public:
 
     void setText(const char *in, int32_t len);
 
+    void appendText(const char *in, int32_t len, UErrorCode &status);
+
     const CharsetMatch * const *detectAll(int32_t &maxMatchesFound, UErrorCode &status);
 
     const CharsetMatch *detect(UErrorCode& status);
@@ -49,6 +58,10 @@ public:
 
     UBool getStripTagsFlag() const;
 
+    void setStopConfidence(int32_t confidence, UErrorCode &status);
+
+    int32_t getStopConfidence() const;
+
 //    const char *getCharsetName(int32_t index, UErrorCode& status) const;
 
     static int32_t getDetectableCount();
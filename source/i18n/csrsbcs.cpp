@@ -1,6 +1,6 @@
 /*
  **********************************************************************
- *   Copyright (C) 2005-2015, International Business Machines
+ *   Copyright (C) 2005-2016, International Business Machines
  *   Corporation and others.  All Rights Reserved.
  **********************************************************************
  */
@@ -8,10 +8,13 @@
 #include "unicode/utypes.h"
 
 #include "cmemory.h"
+#include "uassert.h"
+#include "umutex.h"
 
 #if !UCONFIG_NO_CONVERSION
 #include "csrsbcs.h"
 #include "csmatch.h"
+#include "inputext.h"
 
 #define N_GRAM_SIZE 3
 #define N_GRAM_MASK 0xFFFFFF
@@ -19,128 +22,6 @@
 
 U_NAMESPACE_BEGIN
 
-NGramParser::NGramParser(const int32_t *theNgramList, const uint8_t *theCharMap)
- : ngram(0), byteIndex(0)
-{
-    ngramList = theNgramList;
-    charMap   = theCharMap;
-
-    ngramCount = hitCount = 0;
-}
-
-NGramParser::~NGramParser()
-{
-}
-
-/*
- * Binary search for value in table, which must have exactly 64 entries.
- */
-
-int32_t NGramParser::search(const int32_t *table, int32_t value)
-{
-    int32_t index = 0;
-
-    if (table[index + 32] <= value) {
-        index += 32;
-    }
-
-    if (table[index + 16] <= value) {
-        index += 16;
-    }
-
-    if (table[index + 8] <= value) {
-        index += 8;
-    }
-
-    if (table[index + 4] <= value) {
-        index += 4;
-    }
-
-    if (table[index + 2] <= value) {
-        index += 2;
-    }
-
-    if (table[index + 1] <= value) {
-        index += 1;
-    }
-
-    if (table[index] > value) {
-        index -= 1;
-    }
-
-    if (index < 0 || table[index] != value) {
-        return -1;
-    }
-
-    return index;
-}
-
-void NGramParser::lookup(int32_t thisNgram)
-{
-    ngramCount += 1;
-
-    if (search(ngramList, thisNgram) >= 0) {
-        hitCount += 1;
-    }
-
-}
-
-void NGramParser::addByte(int32_t b)
-{
-    ngram = ((ngram << 8) + b) & N_GRAM_MASK;
-    lookup(ngram);
-}
-
-int32_t NGramParser::nextByte(InputText *det)
-{
-    if (byteIndex >= det->fInputLen) {
-        return -1;
-    }
-
-    return det->fInputBytes[byteIndex++];
-}
-
-void NGramParser::parseCharacters(InputText *det)
-{
-    int32_t b;
-    bool ignoreSpace = FALSE;
-
-    while ((b = nextByte(det)) >= 0) {
-        uint8_t mb = charMap[b];
-
-        // TODO: 0x20 might not be a space in all character sets...
-        if (mb != 0) {
-            if (!(mb == 0x20 && ignoreSpace)) {
-                addByte(mb);
-            }
-
-            ignoreSpace = (mb == 0x20);
-        }
-    }
-}
-
-int32_t NGramParser::parse(InputText *det)
-{
-    parseCharacters(det);
-
-    // TODO: Is this OK? The buffer could have ended in the middle of a word...
-    addByte(0x20);
-
-    double rawPercent = (double) hitCount / (double) ngramCount;
-
-    //            if (rawPercent <= 2.0) {
-    //                return 0;
-    //            }
-
-    // TODO - This is a bit of a hack to take care of a case
-    // were we were getting a confidence of 135...
-    if (rawPercent > 0.33) {
-        return 98;
-    }
-
-    return (int32_t) (rawPercent * 300.0);
-}
-
 #if !UCONFIG_ONLY_HTML_CONVERSION
 static const uint8_t unshapeMap_IBM420[] = {
 /*           -0    -1    -2    -3    -4    -5    -6    -7    -8    -9    -A    -B    -C    -D    -E    -F   */
@@ -162,80 +43,16 @@ static const uint8_t unshapeMap_IBM420[] = {
 /* F- */    0xF0, 0xF1, 0xF2, 0xF3, 0xF4, 0xF5, 0xF6, 0xF7, 0xF8, 0xF9, 0xFA, 0xFB, 0xFC, 0xFD, 0xFE, 0xFF, 
 };
 
-NGramParser_IBM420::NGramParser_IBM420(const int32_t *theNgramList, const uint8_t *theCharMap):NGramParser(theNgramList, theCharMap)
-{
-	alef = 0x00;
-}
-
-NGramParser_IBM420::~NGramParser_IBM420() {}
-
-int32_t NGramParser_IBM420::isLamAlef(int32_t b)
+static int32_t isLamAlef(int32_t b)
 {
-	if(b == 0xB2 || b == 0xB3){
-         	return 0x47;        		
-        }else if(b == 0xB4 || b == 0xB5){
-         	return 0x49;
-        }else if(b == 0xB8 || b == 0xB9){
-         	return 0x56;
-        }else
-         	return 0x00;
-}
-
-/*
-* Arabic shaping needs to be done manually. Cannot call ArabicShaping class
-* because CharsetDetector is dealing with bytes not Unicode code points. We could
-* convert the bytes to Unicode code points but that would leave us dependent
-* on CharsetICU which we try to avoid. IBM420 converter amongst different versions
-* of JDK can produce different results and therefore is also avoided.
-*/ 
-int32_t NGramParser_IBM420::nextByte(InputText *det)
-{
-	
-    if (byteIndex >= det->fInputLen || det->fInputBytes[byteIndex] == 0) {
-        return -1;
-    }              
-    int next;
-             
-    alef = isLamAlef(det->fInputBytes[byteIndex]);
-    if(alef != 0x00)
-        next = 0xB1 & 0xFF;
-    else
-        next = unshapeMap_IBM420[det->fInputBytes[byteIndex]& 0xFF] & 0xFF;
-            
-    byteIndex++;
-             
-    return next;
-}
-
-void NGramParser_IBM420::parseCharacters(InputText *det)
-{
-	int32_t b;
-    bool ignoreSpace = FALSE;
-
-    while ((b = nextByte(det)) >= 0) {
-        uint8_t mb = charMap[b];
-
-        // TODO: 0x20 might not be a space in all character sets...
-        if (mb != 0) {
-            if (!(mb == 0x20 && ignoreSpace)) {
-                addByte(mb);
-            }
-            ignoreSpace = (mb == 0x20);
-        }
-		
-		if(alef != 0x00){
-            mb = charMap[alef & 0xFF];
-                     
-            // TODO: 0x20 might not be a space in all character sets...
-            if (mb != 0) {
-                if (!(mb == 0x20 && ignoreSpace)) {
-                    addByte(mb);                    
-                }
-                         
-                ignoreSpace = (mb == 0x20);
-            }
-                	 
-        }
+    if (b == 0xB2 || b == 0xB3) {
+        return 0x47;
+    } else if (b == 0xB4 || b == 0xB5) {
+        return 0x49;
+    } else if (b == 0xB8 || b == 0xB9) {
+        return 0x56;
+    } else {
+        return 0x00;
     }
 }
 #endif
@@ -250,16 +67,6 @@ CharsetRecog_sbcs::~CharsetRecog_sbcs()
     // nothing to do
 }
 
-int32_t CharsetRecog_sbcs::match_sbcs(InputText *det, const int32_t ngrams[],  const uint8_t byteMap[]) const
-{
-    NGramParser parser(ngrams, byteMap);
-    int32_t result;
-
-    result = parser.parse(det);
-
-    return result;
-}
-
 static const uint8_t charMap_8859_1[] = {
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
@@ -883,6 +690,293 @@ static const int32_t ngrams_8859_9_tr[] = {
     0x6E206B, 0x6E6461, 0x6E6465, 0x6E6520, 0x6E6920, 0x6E696E, 0x6EFD20, 0x72696E, 0x72FD6E, 0x766520, 0x796120, 0x796F72, 0xFD6E20, 0xFD6E64, 0xFD6EFD, 0xFDF0FD,
 };
 
+/*
+ * All of the n-gram tables above are scored together. Each table has an
+ * index below; the tables sharing a charMap are numbered consecutively,
+ * and each charMap belongs to one scoring pass. A pass maps every input
+ * byte through each of its charMaps in turn and looks the resulting trigrams
+ * up in one combined hash table, whose values are the bit sets of the n-gram
+ * tables that contain the trigram. The EBCDIC tables get passes of their own,
+ * since their recognizers are not enabled by default.
+ */
+enum {
+    NGRAMS_8859_1       = 0,
+    NGRAMS_8859_2       = NGRAMS_8859_1 + ARRAY_SIZE(ngrams_8859_1),
+    NGRAMS_8859_5_RU    = NGRAMS_8859_2 + ARRAY_SIZE(ngrams_8859_2),
+    NGRAMS_8859_6_AR,
+    NGRAMS_8859_7_EL,
+    NGRAMS_8859_8_I_HE,
+    NGRAMS_8859_8_HE,
+    NGRAMS_8859_9_TR,
+    NGRAMS_WINDOWS_1251,
+    NGRAMS_WINDOWS_1256,
+    NGRAMS_KOI8_R,
+#if !UCONFIG_ONLY_HTML_CONVERSION
+    NGRAMS_IBM424_HE_RTL,
+    NGRAMS_IBM424_HE_LTR,
+    NGRAMS_IBM420_AR_RTL,
+    NGRAMS_IBM420_AR_LTR,
+#endif
+    NGRAM_TABLE_COUNT
+};
+
+enum {
+    NGRAM_PASS_ASCII,
+#if !UCONFIG_ONLY_HTML_CONVERSION
+    NGRAM_PASS_IBM424,
+    NGRAM_PASS_IBM420,
+#endif
+    NGRAM_PASS_COUNT
+};
+
+struct NGramCharMap {
+    const uint8_t *charMap;
+    int32_t        firstTable;  // The tables scored with this charMap are
+    int32_t        limitTable;  //   [firstTable, limitTable).
+    int32_t        pass;
+};
+
+static const NGramCharMap ngramCharMaps[] = {
+    { charMap_8859_1,       NGRAMS_8859_1,        NGRAMS_8859_2,        NGRAM_PASS_ASCII },
+    { charMap_8859_2,       NGRAMS_8859_2,        NGRAMS_8859_5_RU,     NGRAM_PASS_ASCII },
+    { charMap_8859_5,       NGRAMS_8859_5_RU,     NGRAMS_8859_6_AR,     NGRAM_PASS_ASCII },
+    { charMap_8859_6,       NGRAMS_8859_6_AR,     NGRAMS_8859_7_EL,     NGRAM_PASS_ASCII },
+    { charMap_8859_7,       NGRAMS_8859_7_EL,     NGRAMS_8859_8_I_HE,   NGRAM_PASS_ASCII },
+    { charMap_8859_8,       NGRAMS_8859_8_I_HE,   NGRAMS_8859_9_TR,     NGRAM_PASS_ASCII },
+    { charMap_8859_9,       NGRAMS_8859_9_TR,     NGRAMS_WINDOWS_1251,  NGRAM_PASS_ASCII },
+    { charMap_windows_1251, NGRAMS_WINDOWS_1251,  NGRAMS_WINDOWS_1256,  NGRAM_PASS_ASCII },
+    { charMap_windows_1256, NGRAMS_WINDOWS_1256,  NGRAMS_KOI8_R,        NGRAM_PASS_ASCII },
+    { charMap_KOI8_R,       NGRAMS_KOI8_R,        NGRAMS_KOI8_R + 1,    NGRAM_PASS_ASCII },
+#if !UCONFIG_ONLY_HTML_CONVERSION
+    { charMap_IBM424_he,    NGRAMS_IBM424_HE_RTL, NGRAMS_IBM420_AR_RTL, NGRAM_PASS_IBM424 },
+    { charMap_IBM420_ar,    NGRAMS_IBM420_AR_RTL, NGRAM_TABLE_COUNT,    NGRAM_PASS_IBM420 },
+#endif
+};
+
+/*
+ * Open addressing hash table of all of the trigrams in all of the tables.
+ * There are at most 64 * NGRAM_TABLE_COUNT distinct trigrams, so the table
+ * stays less than half full and most lookups probe a single slot.
+ * Empty slots have a negative key; trigrams are 24 bit values.
+ */
+#define NGRAM_HASH_BITS 12
+#define NGRAM_HASH_SIZE (1 << NGRAM_HASH_BITS)
+#define NGRAM_HASH_MASK (NGRAM_HASH_SIZE - 1)
+
+static int32_t  gNGramKeys[NGRAM_HASH_SIZE];
+static uint32_t gNGramTables[NGRAM_HASH_SIZE];
+static icu::UInitOnce gNGramInitOnce = U_INITONCE_INITIALIZER;
+
+static inline int32_t ngramHash(int32_t ngram)
+{
+    return (int32_t) (((uint32_t) ngram * 0x9E3779B1u) >> (32 - NGRAM_HASH_BITS));
+}
+
+static void addNGrams(int32_t table, const int32_t ngrams[])
+{
+    for (int32_t i = 0; i < 64; i += 1) {
+        int32_t index = ngramHash(ngrams[i]);
+
+        while (gNGramKeys[index] >= 0 && gNGramKeys[index] != ngrams[i]) {
+            index = (index + 1) & NGRAM_HASH_MASK;
+        }
+
+        gNGramKeys[index]    = ngrams[i];
+        gNGramTables[index] |= (uint32_t) 1 << table;
+    }
+}
+
+static void U_CALLCONV initNGramHash()
+{
+    U_ASSERT(NGRAM_TABLE_COUNT <= InputText::MAX_NGRAM_TABLES);
+    U_ASSERT(64 * NGRAM_TABLE_COUNT <= NGRAM_HASH_SIZE / 2);
+
+    uprv_memset(gNGramKeys, 0xFF, sizeof(gNGramKeys));
+    uprv_memset(gNGramTables, 0, sizeof(gNGramTables));
+
+    int32_t table = NGRAMS_8859_1;
+    uint32_t i;
+
+    for (i = 0; i < ARRAY_SIZE(ngrams_8859_1); i += 1) {
+        addNGrams(table++, ngrams_8859_1[i].ngrams);
+    }
+
+    for (i = 0; i < ARRAY_SIZE(ngrams_8859_2); i += 1) {
+        addNGrams(table++, ngrams_8859_2[i].ngrams);
+    }
+
+    addNGrams(NGRAMS_8859_5_RU,     ngrams_8859_5_ru);
+    addNGrams(NGRAMS_8859_6_AR,     ngrams_8859_6_ar);
+    addNGrams(NGRAMS_8859_7_EL,     ngrams_8859_7_el);
+    addNGrams(NGRAMS_8859_8_I_HE,   ngrams_8859_8_I_he);
+    addNGrams(NGRAMS_8859_8_HE,     ngrams_8859_8_he);
+    addNGrams(NGRAMS_8859_9_TR,     ngrams_8859_9_tr);
+    addNGrams(NGRAMS_WINDOWS_1251,  ngrams_windows_1251);
+    addNGrams(NGRAMS_WINDOWS_1256,  ngrams_windows_1256);
+    addNGrams(NGRAMS_KOI8_R,        ngrams_KOI8_R);
+#if !UCONFIG_ONLY_HTML_CONVERSION
+    addNGrams(NGRAMS_IBM424_HE_RTL, ngrams_IBM424_he_rtl);
+    addNGrams(NGRAMS_IBM424_HE_LTR, ngrams_IBM424_he_ltr);
+    addNGrams(NGRAMS_IBM420_AR_RTL, ngrams_IBM420_ar_rtl);
+    addNGrams(NGRAMS_IBM420_AR_LTR, ngrams_IBM420_ar_ltr);
+#endif
+}
+
+/*
+ * Returns the bit set of the n-gram tables that contain the given trigram.
+ */
+static inline uint32_t lookupNGram(int32_t ngram)
+{
+    int32_t index = ngramHash(ngram);
+    int32_t key;
+
+    while ((key = gNGramKeys[index]) != ngram) {
+        if (key < 0) {
+            return 0;
+        }
+
+        index = (index + 1) & NGRAM_HASH_MASK;
+    }
+
+    return gNGramTables[index];
+}
+
+/*
+ * Trigram state for the bytes of the input as seen through one charMap.
+ */
+struct NGramState {
+    int32_t  ngram;
+    int32_t  ngramCount;
+    UBool    ignoreSpace;
+    int32_t  firstTable;
+    uint32_t tables;     // Bit set of the tables scored with this charMap.
+
+    void init(const NGramCharMap &map) {
+        ngram       = 0;
+        ngramCount  = 0;
+        ignoreSpace = FALSE;
+        firstTable  = map.firstTable;
+        tables      = (((uint32_t) 1 << (map.limitTable - map.firstTable)) - 1) << map.firstTable;
+    }
+
+    inline void addByte(int32_t b, int32_t hitCounts[]) {
+        ngram = ((ngram << 8) + b) & N_GRAM_MASK;
+        ngramCount += 1;
+
+        uint32_t hits = lookupNGram(ngram) & tables;
+
+        if (hits != 0) {
+            hits >>= firstTable;
+
+            for (int32_t table = firstTable; hits != 0; table += 1, hits >>= 1) {
+                hitCounts[table] += hits & 1;
+            }
+        }
+    }
+
+    inline void addCharacter(uint8_t mb, int32_t hitCounts[]) {
+        // TODO: 0x20 might not be a space in all character sets...
+        if (mb != 0) {
+            if (!(mb == 0x20 && ignoreSpace)) {
+                addByte(mb, hitCounts);
+            }
+
+            ignoreSpace = (mb == 0x20);
+        }
+    }
+};
+
+static void scoreNGrams(InputText *det, int32_t pass)
+{
+    NGramState states[ARRAY_SIZE(ngramCharMaps)];
+    const uint8_t *charMaps[ARRAY_SIZE(ngramCharMaps)];
+    int32_t hitCounts[NGRAM_TABLE_COUNT];
+    int32_t stateCount = 0;
+    int32_t i, s;
+
+    for (i = 0; i < (int32_t) ARRAY_SIZE(ngramCharMaps); i += 1) {
+        if (ngramCharMaps[i].pass == pass) {
+            states[stateCount].init(ngramCharMaps[i]);
+            charMaps[stateCount++] = ngramCharMaps[i].charMap;
+        }
+    }
+
+    uprv_memset(hitCounts, 0, sizeof(hitCounts));
+
+#if !UCONFIG_ONLY_HTML_CONVERSION
+    if (pass == NGRAM_PASS_IBM420) {
+        /*
+        * Arabic shaping needs to be done manually. Cannot call ArabicShaping class
+        * because CharsetDetector is dealing with bytes not Unicode code points. We could
+        * convert the bytes to Unicode code points but that would leave us dependent
+        * on CharsetICU which we try to avoid. IBM420 converter amongst different versions
+        * of JDK can produce different results and therefore is also avoided.
+        */
+        U_ASSERT(stateCount == 1);
+
+        for (i = 0; i < det->fInputLen && det->fInputBytes[i] != 0; i += 1) {
+            int32_t b    = det->fInputBytes[i];
+            int32_t alef = isLamAlef(b);
+
+            states[0].addCharacter(charMaps[0][alef != 0x00 ? 0xB1 : unshapeMap_IBM420[b]], hitCounts);
+
+            if (alef != 0x00) {
+                states[0].addCharacter(charMaps[0][alef], hitCounts);
+            }
+        }
+    } else
+#endif
+    {
+        for (i = 0; i < det->fInputLen; i += 1) {
+            uint8_t b = det->fInputBytes[i];
+
+            for (s = 0; s < stateCount; s += 1) {
+                states[s].addCharacter(charMaps[s][b], hitCounts);
+            }
+        }
+    }
+
+    for (s = 0; s < stateCount; s += 1) {
+        NGramState &state = states[s];
+
+        // TODO: Is this OK? The buffer could have ended in the middle of a word...
+        state.addByte(0x20, hitCounts);
+
+        for (int32_t table = state.firstTable; (state.tables >> table) != 0; table += 1) {
+            double rawPercent = (double) hitCounts[table] / (double) state.ngramCount;
+
+            // TODO - This is a bit of a hack to take care of a case
+            // were we were getting a confidence of 135...
+            if (rawPercent > 0.33) {
+                det->fNGramConfidence[table] = 98;
+            } else {
+                det->fNGramConfidence[table] = (int32_t) (rawPercent * 300.0);
+            }
+        }
+    }
+}
+
+int32_t CharsetRecog_sbcs::match_sbcs(InputText *det, int32_t ngramTable) const
+{
+    int32_t pass = NGRAM_PASS_ASCII;
+
+#if !UCONFIG_ONLY_HTML_CONVERSION
+    if (ngramTable >= NGRAMS_IBM420_AR_RTL) {
+        pass = NGRAM_PASS_IBM420;
+    } else if (ngramTable >= NGRAMS_IBM424_HE_RTL) {
+        pass = NGRAM_PASS_IBM424;
+    }
+#endif
+
+    if ((det->fNGramPasses & ((uint32_t) 1 << pass)) == 0) {
+        umtx_initOnce(gNGramInitOnce, &initNGramHash);
+        scoreNGrams(det, pass);
+        det->fNGramPasses |= (uint32_t) 1 << pass;
+    }
+
+    return det->fNGramConfidence[ngramTable];
+}
+
 CharsetRecog_8859_1::~CharsetRecog_8859_1()
 {
     // nothing to do
@@ -893,9 +987,8 @@ UBool CharsetRecog_8859_1::match(InputText *textIn, CharsetMatch *results) const
     uint32_t i;
     int32_t bestConfidenceSoFar = -1;
     for (i=0; i < ARRAY_SIZE(ngrams_8859_1) ; i++) {
-        const int32_t *ngrams = ngrams_8859_1[i].ngrams;
         const char    *lang   = ngrams_8859_1[i].lang;
-        int32_t confidence = match_sbcs(textIn, ngrams, charMap_8859_1);
+        int32_t confidence = match_sbcs(textIn, NGRAMS_8859_1 + i);
         if (confidence > bestConfidenceSoFar) {
             results->set(textIn, this, confidence, name, lang);
             bestConfidenceSoFar = confidence;
@@ -920,9 +1013,8 @@ UBool CharsetRecog_8859_2::match(InputText *textIn, CharsetMatch *results) const
     uint32_t i;
     int32_t bestConfidenceSoFar = -1;
     for (i=0; i < ARRAY_SIZE(ngrams_8859_2) ; i++) {
-        const int32_t *ngrams = ngrams_8859_2[i].ngrams;
         const char    *lang   = ngrams_8859_2[i].lang;
-        int32_t confidence = match_sbcs(textIn, ngrams, charMap_8859_2);
+        int32_t confidence = match_sbcs(textIn, NGRAMS_8859_2 + i);
         if (confidence > bestConfidenceSoFar) {
             results->set(textIn, this, confidence, name, lang);
             bestConfidenceSoFar = confidence;
@@ -959,7 +1051,7 @@ const char *CharsetRecog_8859_5_ru::getLanguage() const
 
 UBool CharsetRecog_8859_5_ru::match(InputText *textIn, CharsetMatch *results) const
 {
-    int32_t confidence = match_sbcs(textIn, ngrams_8859_5_ru, charMap_8859_5);
+    int32_t confidence = match_sbcs(textIn, NGRAMS_8859_5_RU);
     results->set(textIn, this, confidence);
     return (confidence > 0);
 }
@@ -986,7 +1078,7 @@ const char *CharsetRecog_8859_6_ar::getLanguage() const
 
 UBool CharsetRecog_8859_6_ar::match(InputText *textIn, CharsetMatch *results) const
 {
-    int32_t confidence = match_sbcs(textIn, ngrams_8859_6_ar, charMap_8859_6);
+    int32_t confidence = match_sbcs(textIn, NGRAMS_8859_6_AR);
     results->set(textIn, this, confidence);
     return (confidence > 0);
 }
@@ -1014,7 +1106,7 @@ const char *CharsetRecog_8859_7_el::getLanguage() const
 UBool CharsetRecog_8859_7_el::match(InputText *textIn, CharsetMatch *results) const
 {
     const char *name = textIn->fC1Bytes? "windows-1253" : "ISO-8859-7";
-    int32_t confidence = match_sbcs(textIn, ngrams_8859_7_el, charMap_8859_7);
+    int32_t confidence = match_sbcs(textIn, NGRAMS_8859_7_EL);
     results->set(textIn, this, confidence, name, "el");
     return (confidence > 0);
 }
@@ -1047,7 +1139,7 @@ const char *CharsetRecog_8859_8_I_he::getLanguage() const
 UBool CharsetRecog_8859_8_I_he::match(InputText *textIn, CharsetMatch *results) const
 {
     const char *name = textIn->fC1Bytes? "windows-1255" : "ISO-8859-8-I";
-    int32_t confidence = match_sbcs(textIn, ngrams_8859_8_I_he, charMap_8859_8);
+    int32_t confidence = match_sbcs(textIn, NGRAMS_8859_8_I_HE);
     results->set(textIn, this, confidence, name, "he");
     return (confidence > 0);
 }
@@ -1065,7 +1157,7 @@ const char *CharsetRecog_8859_8_he::getLanguage() const
 UBool CharsetRecog_8859_8_he::match(InputText *textIn, CharsetMatch *results) const
 {
     const char *name = textIn->fC1Bytes? "windows-1255" : "ISO-8859-8";
-    int32_t confidence = match_sbcs(textIn, ngrams_8859_8_he, charMap_8859_8);
+    int32_t confidence = match_sbcs(textIn, NGRAMS_8859_8_HE);
     results->set(textIn, this, confidence, name, "he");
     return (confidence > 0);
 }
@@ -1093,7 +1185,7 @@ const char *CharsetRecog_8859_9_tr::getLanguage() const
 UBool CharsetRecog_8859_9_tr::match(InputText *textIn, CharsetMatch *results) const
 {
     const char *name = textIn->fC1Bytes? "windows-1254" : "ISO-8859-9";
-    int32_t confidence = match_sbcs(textIn, ngrams_8859_9_tr, charMap_8859_9);
+    int32_t confidence = match_sbcs(textIn, NGRAMS_8859_9_TR);
     results->set(textIn, this, confidence, name, "tr");
     return (confidence > 0);
 }
@@ -1115,7 +1207,7 @@ const char *CharsetRecog_windows_1256::getLanguage() const
 
 UBool CharsetRecog_windows_1256::match(InputText *textIn, CharsetMatch *results) const
 {
-    int32_t confidence = match_sbcs(textIn, ngrams_windows_1256, charMap_windows_1256);
+    int32_t confidence = match_sbcs(textIn, NGRAMS_WINDOWS_1256);
     results->set(textIn, this, confidence);
     return (confidence > 0);
 }
@@ -1137,7 +1229,7 @@ const char *CharsetRecog_windows_1251::getLanguage() const
 
 UBool CharsetRecog_windows_1251::match(InputText *textIn, CharsetMatch *results) const
 {
-    int32_t confidence = match_sbcs(textIn, ngrams_windows_1251, charMap_windows_1251);
+    int32_t confidence = match_sbcs(textIn, NGRAMS_WINDOWS_1251);
     results->set(textIn, this, confidence);
     return (confidence > 0);
 }
@@ -1159,7 +1251,7 @@ const char *CharsetRecog_KOI8_R::getLanguage() const
 
 UBool CharsetRecog_KOI8_R::match(InputText *textIn, CharsetMatch *results) const
 {
-    int32_t confidence = match_sbcs(textIn, ngrams_KOI8_R, charMap_KOI8_R);
+    int32_t confidence = match_sbcs(textIn, NGRAMS_KOI8_R);
     results->set(textIn, this, confidence);
     return (confidence > 0);
 }
@@ -1187,7 +1279,7 @@ const char *CharsetRecog_IBM424_he_rtl::getName() const
 
 UBool CharsetRecog_IBM424_he_rtl::match(InputText *textIn, CharsetMatch *results) const
 {
-    int32_t confidence = match_sbcs(textIn, ngrams_IBM424_he_rtl, charMap_IBM424_he);
+    int32_t confidence = match_sbcs(textIn, NGRAMS_IBM424_HE_RTL);
     results->set(textIn, this, confidence);
     return (confidence > 0);
 }
@@ -1204,7 +1296,7 @@ const char *CharsetRecog_IBM424_he_ltr::getName() const
 
 UBool CharsetRecog_IBM424_he_ltr::match(InputText *textIn, CharsetMatch *results) const
 {
-    int32_t confidence = match_sbcs(textIn, ngrams_IBM424_he_ltr, charMap_IBM424_he);
+    int32_t confidence = match_sbcs(textIn, NGRAMS_IBM424_HE_LTR);
     results->set(textIn, this, confidence);
     return (confidence > 0);
 }
@@ -1219,16 +1311,6 @@ const char *CharsetRecog_IBM420_ar::getLanguage() const
     return "ar";
 }
 
-    
-int32_t CharsetRecog_IBM420_ar::match_sbcs(InputText *det, const int32_t ngrams[],  const uint8_t byteMap[]) const
-{
-    NGramParser_IBM420 parser(ngrams, byteMap);
-    int32_t result;
-    
-    result = parser.parse(det);
-        
-    return result;
-}
 
 CharsetRecog_IBM420_ar_rtl::~CharsetRecog_IBM420_ar_rtl()
 {
@@ -1242,7 +1324,7 @@ const char *CharsetRecog_IBM420_ar_rtl::getName() const
 
 UBool CharsetRecog_IBM420_ar_rtl::match(InputText *textIn, CharsetMatch *results) const
 {
-    int32_t confidence = match_sbcs(textIn, ngrams_IBM420_ar_rtl, charMap_IBM420_ar);
+    int32_t confidence = match_sbcs(textIn, NGRAMS_IBM420_AR_RTL);
     results->set(textIn, this, confidence);
     return (confidence > 0);
 }
@@ -1259,7 +1341,7 @@ const char *CharsetRecog_IBM420_ar_ltr::getName() const
 
 UBool CharsetRecog_IBM420_ar_ltr::match(InputText *textIn, CharsetMatch *results) const
 {
-    int32_t confidence = match_sbcs(textIn, ngrams_IBM420_ar_ltr, charMap_IBM420_ar);
+    int32_t confidence = match_sbcs(textIn, NGRAMS_IBM420_AR_LTR);
     results->set(textIn, this, confidence);
     return (confidence > 0);
 }
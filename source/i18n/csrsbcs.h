@@ -1,6 +1,6 @@
 /*
  **********************************************************************
- *   Copyright (C) 2005-2015, International Business Machines
+ *   Copyright (C) 2005-2016, International Business Machines
  *   Corporation and others.  All Rights Reserved.
  **********************************************************************
  */
@@ -16,57 +16,6 @@
 
 U_NAMESPACE_BEGIN
 
-class NGramParser : public UMemory
-{
-private:
-    int32_t ngram;
-    const int32_t *ngramList;    
-
-    int32_t ngramCount;
-    int32_t hitCount;
-
-protected:
-	int32_t byteIndex;
-    const uint8_t *charMap;
-
-	void addByte(int32_t b);
-
-public:
-    NGramParser(const int32_t *theNgramList, const uint8_t *theCharMap);
-    virtual ~NGramParser();
-
-private:
-    /*
-    * Binary search for value in table, which must have exactly 64 entries.
-    */
-    int32_t search(const int32_t *table, int32_t value);
-
-    void lookup(int32_t thisNgram);
-    
-    virtual int32_t nextByte(InputText *det);
-	virtual void parseCharacters(InputText *det);
-
-public:
-    int32_t parse(InputText *det);
-
-};
-
-#if !UCONFIG_ONLY_HTML_CONVERSION
-class NGramParser_IBM420 : public NGramParser
-{
-public:
-    NGramParser_IBM420(const int32_t *theNgramList, const uint8_t *theCharMap);
-    ~NGramParser_IBM420();
-
-private:
-    int32_t alef;
-    int32_t isLamAlef(int32_t b);
-    int32_t nextByte(InputText *det);
-    void parseCharacters(InputText *det);
-};
-#endif
-
-
 class CharsetRecog_sbcs : public CharsetRecognizer
 {
 public:
@@ -74,7 +23,14 @@ public:
     virtual ~CharsetRecog_sbcs();
     virtual const char *getName() const = 0;
     virtual UBool match(InputText *det, CharsetMatch *results) const = 0;
-    virtual int32_t match_sbcs(InputText *det, const int32_t ngrams[], const uint8_t charMap[]) const;
+
+protected:
+    /*
+     * Confidence that the input is in the language of the given n-gram table.
+     * The first call for an input scores all of the tables that share a
+     * scoring pass, in one pass over the bytes; later calls look the result up.
+     */
+    int32_t match_sbcs(InputText *det, int32_t ngramTable) const;
 };
 
 class CharsetRecog_8859_1 : public CharsetRecog_sbcs
@@ -265,8 +221,6 @@ public:
     virtual ~CharsetRecog_IBM420_ar();
 
     const char *getLanguage() const;
-	int32_t match_sbcs(InputText *det, const int32_t ngrams[], const uint8_t charMap[]) const;
-    
 };
 
 class CharsetRecog_IBM420_ar_rtl : public CharsetRecog_IBM420_ar {
@@ -1,6 +1,6 @@
 /*
  **********************************************************************
- *   Copyright (C) 2005-2013, International Business Machines
+ *   Copyright (C) 2005-2016, International Business Machines
  *   Corporation and others.  All Rights Reserved.
  **********************************************************************
  */
@@ -136,6 +136,12 @@ UBool CharsetRecog_UTF_32::match(InputText* textIn, CharsetMatch *results) const
 
         if (ch < 0 || ch >= 0x10FFFF || (ch >= 0xD800 && ch <= 0xDFFF)) {
             numInvalid += 1;
+
+            // Any match needs more than ten times as many valid as invalid characters.
+            // Stop once that is impossible; typically after a small part of the input.
+            if (numInvalid * 11 >= limit / 4) {
+                break;
+            }
         } else {
             numValid += 1;
         }
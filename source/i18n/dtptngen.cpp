@@ -34,6 +34,9 @@
 #include "hash.h"
 #include "uresimp.h"
 #include "dtptngen_impl.h"
+#include "shareddtptngen.h"
+#include "unifiedcache.h"
+#include "umutex.h"
 
 #if U_CHARSET_FAMILY==U_EBCDIC_FAMILY
 /**
@@ -242,8 +245,44 @@ DateTimePatternGenerator::createInstance(UErrorCode& status) {
     return createInstance(Locale::getDefault(), status);
 }
 
+SharedDateTimePatternGenerator::~SharedDateTimePatternGenerator() {
+    delete ptr;
+}
+
+template<> U_I18N_API
+const SharedDateTimePatternGenerator *LocaleCacheKey<SharedDateTimePatternGenerator>::createObject(
+        const void * /*unusedCreationContext*/, UErrorCode &status) const {
+    DateTimePatternGenerator *dtpg = DateTimePatternGenerator::makeInstance(fLoc, status);
+    if (U_FAILURE(status)) {
+        return NULL;
+    }
+    SharedDateTimePatternGenerator *shared = new SharedDateTimePatternGenerator(dtpg);
+    if (shared == NULL) {
+        delete dtpg;
+        status = U_MEMORY_ALLOCATION_ERROR;
+        return NULL;
+    }
+    shared->addRef();
+    return shared;
+}
+
 DateTimePatternGenerator* U_EXPORT2
 DateTimePatternGenerator::createInstance(const Locale& locale, UErrorCode& status) {
+    const SharedDateTimePatternGenerator *shared = NULL;
+    UnifiedCache::getByLocale(locale, shared, status);
+    if (U_FAILURE(status)) {
+        return NULL;
+    }
+    DateTimePatternGenerator *result = (*shared)->clone();
+    shared->removeRef();
+    if (result == NULL) {
+        status = U_MEMORY_ALLOCATION_ERROR;
+    }
+    return result;
+}
+
+DateTimePatternGenerator* U_EXPORT2
+DateTimePatternGenerator::makeInstance(const Locale& locale, UErrorCode& status) {
     if (U_FAILURE(status)) {
         return NULL;
     }
@@ -267,7 +306,8 @@ DateTimePatternGenerator::createEmptyInstance(UErrorCode& status) {
 
 DateTimePatternGenerator::DateTimePatternGenerator(UErrorCode &status) :
     skipMatcher(NULL),
-    fAvailableFormatKeyHash(NULL)
+    fAvailableFormatKeyHash(NULL),
+    fBestPatternCache(NULL)
 {
     fp = new FormatParser();
     dtMatcher = new DateTimeMatcher();
@@ -280,7 +320,8 @@ DateTimePatternGenerator::DateTimePatternGenerator(UErrorCode &status) :
 
 DateTimePatternGenerator::DateTimePatternGenerator(const Locale& locale, UErrorCode &status) :
     skipMatcher(NULL),
-    fAvailableFormatKeyHash(NULL)
+    fAvailableFormatKeyHash(NULL),
+    fBestPatternCache(NULL)
 {
     fp = new FormatParser();
     dtMatcher = new DateTimeMatcher();
@@ -297,7 +338,8 @@ DateTimePatternGenerator::DateTimePatternGenerator(const Locale& locale, UErrorC
 DateTimePatternGenerator::DateTimePatternGenerator(const DateTimePatternGenerator& other) :
     UObject(),
     skipMatcher(NULL),
-    fAvailableFormatKeyHash(NULL)
+    fAvailableFormatKeyHash(NULL),
+    fBestPatternCache(NULL)
 {
     fp = new FormatParser();
     dtMatcher = new DateTimeMatcher();
@@ -339,6 +381,7 @@ DateTimePatternGenerator::operator=(const DateTimePatternGenerator& other) {
     UErrorCode status = U_ZERO_ERROR;
     patternMap->copyFrom(*other.patternMap, status);
     copyHashtable(other.fAvailableFormatKeyHash, status);
+    SharedObject::copyPtr(other.fBestPatternCache, fBestPatternCache);
     return *this;
 }
 
@@ -378,6 +421,7 @@ DateTimePatternGenerator::~DateTimePatternGenerator() {
     if (distanceInfo != NULL) delete distanceInfo;
     if (patternMap != NULL) delete patternMap;
     if (skipMatcher != NULL) delete skipMatcher;
+    SharedObject::clearPtr(fBestPatternCache);
 }
 
 void
@@ -394,6 +438,18 @@ DateTimePatternGenerator::initData(const Locale& locale, UErrorCode &status) {
     addCLDRData(locale, status);
     setDateTimeFromCalendar(locale, status);
     setDecimalSymbols(locale, status);
+    // Clones share the memo; create it up front so that those of a
+    // cached generator all share the same one.
+    if (U_SUCCESS(status)) {
+        DTBestPatternCache *cache = new DTBestPatternCache(status);
+        if (cache == NULL) {
+            status = U_MEMORY_ALLOCATION_ERROR;
+        } else if (U_FAILURE(status)) {
+            delete cache;
+        } else {
+            SharedObject::copyPtr(cache, fBestPatternCache);
+        }
+    }
 } // DateTimePatternGenerator::initData
 
 UnicodeString
@@ -738,6 +794,7 @@ DateTimePatternGenerator::initHashtable(UErrorCode& err) {
 
 void
 DateTimePatternGenerator::setAppendItemFormat(UDateTimePatternField field, const UnicodeString& value) {
+    resetBestPatternCache();
     appendItemFormats[field] = value;
     // NUL-terminate for the C API.
     appendItemFormats[field].getTerminatedBuffer();
@@ -750,6 +807,7 @@ DateTimePatternGenerator::getAppendItemFormat(UDateTimePatternField field) const
 
 void
 DateTimePatternGenerator::setAppendItemName(UDateTimePatternField field, const UnicodeString& value) {
+    resetBestPatternCache();
     appendItemNames[field] = value;
     // NUL-terminate for the C API.
     appendItemNames[field].getTerminatedBuffer();
@@ -774,6 +832,33 @@ DateTimePatternGenerator::getBestPattern(const UnicodeString& patternForm, UErro
 
 UnicodeString
 DateTimePatternGenerator::getBestPattern(const UnicodeString& patternForm, UDateTimePatternMatchOptions options, UErrorCode& status) {
+    UnicodeString resultPattern;
+    if (U_FAILURE(status)) {
+        return resultPattern;
+    }
+    if (fBestPatternCache == NULL) {
+        UErrorCode cacheStatus = U_ZERO_ERROR;
+        DTBestPatternCache *cache = new DTBestPatternCache(cacheStatus);
+        if (cache != NULL && U_SUCCESS(cacheStatus)) {
+            SharedObject::copyPtr(cache, fBestPatternCache);
+        } else {
+            delete cache;
+        }
+    }
+    if (fBestPatternCache != NULL && fBestPatternCache->get(patternForm, options, resultPattern)) {
+        return resultPattern;
+    }
+    resultPattern = computeBestPattern(patternForm, options, status);
+    if (fBestPatternCache != NULL && U_SUCCESS(status)) {
+        // Memoizing is an optimization only; ignore any failure.
+        UErrorCode cacheStatus = U_ZERO_ERROR;
+        fBestPatternCache->put(patternForm, options, resultPattern, cacheStatus);
+    }
+    return resultPattern;
+}
+
+UnicodeString
+DateTimePatternGenerator::computeBestPattern(const UnicodeString& patternForm, UDateTimePatternMatchOptions options, UErrorCode& status) {
     const UnicodeString *bestPattern=NULL;
     UnicodeString dtFormat;
     UnicodeString resultPattern;
@@ -833,6 +918,13 @@ DateTimePatternGenerator::getBestPattern(const UnicodeString& patternForm, UDate
     return resultPattern;
 }
 
+// Called before any change which may affect getBestPattern() results.
+// Other clones keep using the old memo; this one gets a new one on demand.
+void
+DateTimePatternGenerator::resetBestPatternCache() {
+    SharedObject::clearPtr(fBestPatternCache);
+}
+
 UnicodeString
 DateTimePatternGenerator::replaceFieldTypes(const UnicodeString& pattern,
                                             const UnicodeString& skeleton,
@@ -852,6 +944,7 @@ DateTimePatternGenerator::replaceFieldTypes(const UnicodeString& pattern,
 
 void
 DateTimePatternGenerator::setDecimal(const UnicodeString& newDecimal) {
+    resetBestPatternCache();
     this->decimal = newDecimal;
     // NUL-terminate for the C API.
     this->decimal.getTerminatedBuffer();
@@ -874,6 +967,7 @@ DateTimePatternGenerator::addCanonicalItems() {
 
 void
 DateTimePatternGenerator::setDateTimeFormat(const UnicodeString& dtFormat) {
+    resetBestPatternCache();
     dateTimeFormat = dtFormat;
     // NUL-terminate for the C API.
     dateTimeFormat.getTerminatedBuffer();
@@ -944,6 +1038,7 @@ DateTimePatternGenerator::addPatternWithSkeleton(
     UErrorCode& status)
 {
 
+    resetBestPatternCache();
     UnicodeString basePattern;
     PtnSkeleton   skeleton;
     UDateTimePatternConflict conflictingStatus = UDATPG_NO_CONFLICT;
@@ -2216,6 +2311,71 @@ DTRedundantEnumeration::~DTRedundantEnumeration() {
     delete fPatterns;
 }
 
+// A UMutex must be statically initialized, so the memos take turns
+// using these rather than each having its own.
+// The number of mutexes must be a power of 2.
+static UMutex gBestPatternCacheMutexes[] = {
+    U_MUTEX_INITIALIZER, U_MUTEX_INITIALIZER, U_MUTEX_INITIALIZER, U_MUTEX_INITIALIZER,
+    U_MUTEX_INITIALIZER, U_MUTEX_INITIALIZER, U_MUTEX_INITIALIZER, U_MUTEX_INITIALIZER
+};
+static u_atomic_int32_t gBestPatternCacheCount = ATOMIC_INT32_T_INITIALIZER(0);
+
+static UMutex *nextBestPatternCacheMutex() {
+    int32_t i = umtx_atomic_inc(&gBestPatternCacheCount);
+    return &gBestPatternCacheMutexes[i & (UPRV_LENGTHOF(gBestPatternCacheMutexes) - 1)];
+}
+
+// Upper bound on the number of memoized patterns per generator,
+// so that arbitrary skeletons cannot grow the memo without limit.
+static const int32_t kMaxBestPatterns = 1000;
+
+DTBestPatternCache::DTBestPatternCache(UErrorCode& status) :
+        fPatterns(status), fMutex(nextBestPatternCacheMutex()) {
+    if (U_SUCCESS(status)) {
+        fPatterns.setValueDeleter(uprv_deleteUObject);
+    }
+}
+
+DTBestPatternCache::~DTBestPatternCache() {
+}
+
+// The key is the skeleton prefixed by the match options,
+// which fit into one UChar (one bit per field).
+static inline UnicodeString
+bestPatternKey(const UnicodeString& skeleton, UDateTimePatternMatchOptions options) {
+    UnicodeString key((UChar)options);
+    return key.append(skeleton);
+}
+
+UBool
+DTBestPatternCache::get(const UnicodeString& skeleton, UDateTimePatternMatchOptions options,
+                        UnicodeString& pattern) const {
+    UnicodeString key = bestPatternKey(skeleton, options);
+    Mutex lock(fMutex);
+    const UnicodeString *value = (const UnicodeString *)fPatterns.get(key);
+    if (value == NULL) {
+        return FALSE;
+    }
+    pattern = *value;
+    return TRUE;
+}
+
+void
+DTBestPatternCache::put(const UnicodeString& skeleton, UDateTimePatternMatchOptions options,
+                        const UnicodeString& pattern, UErrorCode& status) const {
+    UnicodeString key = bestPatternKey(skeleton, options);
+    Mutex lock(fMutex);
+    if (fPatterns.count() >= kMaxBestPatterns || fPatterns.get(key) != NULL) {
+        return;
+    }
+    UnicodeString *value = new UnicodeString(pattern);
+    if (value == NULL) {
+        status = U_MEMORY_ALLOCATION_ERROR;
+        return;
+    }
+    fPatterns.put(key, value, status);
+}
+
 U_NAMESPACE_END
 
 
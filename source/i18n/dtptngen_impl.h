@@ -9,6 +9,9 @@
 *******************************************************************************
 */
 
+#include "hash.h"
+#include "sharedobject.h"
+#include "umutex.h"
 #include "uvector.h"
 
 #ifndef __DTPTNGEN_IMPL_H__
@@ -257,6 +260,25 @@ private:
     UVector *fPatterns;
 };
 
+// Memo of DateTimePatternGenerator::getBestPattern() results, keyed by
+// match options and skeleton. It is shared between a generator and its
+// clones (notably those handed out by createInstance()) until the
+// generator is modified, so all access is synchronized. Each memo gets
+// one of a few static mutexes, so that the memos of different generators
+// mostly do not contend.
+class DTBestPatternCache : public SharedObject {
+public:
+    DTBestPatternCache(UErrorCode& status);
+    virtual ~DTBestPatternCache();
+    UBool get(const UnicodeString& skeleton, UDateTimePatternMatchOptions options,
+              UnicodeString& pattern) const;
+    void put(const UnicodeString& skeleton, UDateTimePatternMatchOptions options,
+             const UnicodeString& pattern, UErrorCode& status) const;
+private:
+    mutable Hashtable fPatterns;
+    UMutex *fMutex;
+};
+
 U_NAMESPACE_END
 
 #endif
@@ -1,6 +1,6 @@
 /*
  **********************************************************************
- *   Copyright (C) 2005-2009, International Business Machines
+ *   Copyright (C) 2005-2016, International Business Machines
  *   Corporation and others.  All Rights Reserved.
  **********************************************************************
  */
@@ -20,6 +20,10 @@ U_NAMESPACE_BEGIN
 
 #define BUFFER_SIZE 8192
 
+// Maximum number of bytes retained by appendText().
+// Later text is ignored; detection of streamed input only needs its beginning.
+#define MAX_APPENDED_LENGTH 0x10000
+
 #define ARRAY_SIZE(array) (sizeof array / sizeof array[0])
 
 #define NEW_ARRAY(type,count) (type *) uprv_malloc((count) * sizeof(type))
@@ -32,7 +36,10 @@ InputText::InputText(UErrorCode &status)
                                                  //   Value is percent, not absolute.
       fDeclaredEncoding(0),
       fRawInput(0),
-      fRawLength(0)
+      fRawLength(0),
+      fOwnedInput(0),
+      fOwnedCapacity(0),
+      fNGramPasses(0)
 {
     if (fInputBytes == NULL || fByteStats == NULL) {
         status = U_MEMORY_ALLOCATION_ERROR;
@@ -41,6 +48,7 @@ InputText::InputText(UErrorCode &status)
 
 InputText::~InputText()
 {
+    DELETE_ARRAY(fOwnedInput);
     DELETE_ARRAY(fDeclaredEncoding);
     DELETE_ARRAY(fByteStats);
     DELETE_ARRAY(fInputBytes);
@@ -54,6 +62,61 @@ void InputText::setText(const char *in, int32_t len)
     fRawLength = len == -1? (int32_t)uprv_strlen(in) : len;
 }
 
+void InputText::appendText(const char *in, int32_t len, UErrorCode &status)
+{
+    if (U_FAILURE(status)) {
+        return;
+    }
+    if (in == NULL ? len != 0 : len < -1) {
+        status = U_ILLEGAL_ARGUMENT_ERROR;
+        return;
+    }
+    if (len == -1) {
+        len = (int32_t)uprv_strlen(in);
+    }
+
+    // Text that was set with setText() is copied, up to the maximum length.
+    int32_t oldLength = fRawInput != NULL ? fRawLength : 0;
+    if (oldLength > MAX_APPENDED_LENGTH) {
+        oldLength = MAX_APPENDED_LENGTH;
+    }
+    if (len > MAX_APPENDED_LENGTH - oldLength) {
+        len = MAX_APPENDED_LENGTH - oldLength;
+    }
+    int32_t newLength = oldLength + len;
+
+    if (fOwnedInput == NULL || newLength > fOwnedCapacity) {
+        int32_t newCapacity = fOwnedCapacity > 0 ? 2 * fOwnedCapacity : 1024;
+        if (newCapacity < newLength) {
+            newCapacity = newLength;
+        }
+        if (newCapacity > MAX_APPENDED_LENGTH) {
+            newCapacity = MAX_APPENDED_LENGTH;
+        }
+        uint8_t *newInput = NEW_ARRAY(uint8_t, newCapacity);
+        if (newInput == NULL) {
+            status = U_MEMORY_ALLOCATION_ERROR;
+            return;
+        }
+        if (oldLength > 0) {
+            uprv_memcpy(newInput, fRawInput, oldLength);
+        }
+        DELETE_ARRAY(fOwnedInput);
+        fOwnedInput    = newInput;
+        fOwnedCapacity = newCapacity;
+    } else if (fRawInput != fOwnedInput && oldLength > 0) {
+        uprv_memcpy(fOwnedInput, fRawInput, oldLength);
+    }
+    if (len > 0) {
+        uprv_memcpy(fOwnedInput + oldLength, in, len);
+    }
+
+    fInputLen  = 0;
+    fC1Bytes   = FALSE;
+    fRawInput  = fOwnedInput;
+    fRawLength = newLength;
+}
+
 void InputText::setDeclaredEncoding(const char* encoding, int32_t len)
 {
     if(encoding) {
@@ -157,6 +220,9 @@ void InputText::MungeInput(UBool fStripTags) {
             break;
         }
     }
+
+    // The single byte charset n-gram scores belong to the previous input.
+    fNGramPasses = 0;
 }
 
 U_NAMESPACE_END
@@ -1,6 +1,6 @@
 /*
  **********************************************************************
- *   Copyright (C) 2005-2008, International Business Machines
+ *   Copyright (C) 2005-2016, International Business Machines
  *   Corporation and others.  All Rights Reserved.
  **********************************************************************
  */
@@ -32,6 +32,7 @@ public:
     ~InputText();
 
     void setText(const char *in, int32_t len);
+    void appendText(const char *in, int32_t len, UErrorCode &status);
     void setDeclaredEncoding(const char *encoding, int32_t len);
     UBool isSet() const; 
     void MungeInput(UBool fStripTags);
@@ -53,6 +54,18 @@ public:
     //   buffer here.
     int32_t                  fRawLength;    // Length of data in fRawInput array.
 
+    uint8_t                 *fOwnedInput;   // Buffer for text passed to appendText().
+    //  fRawInput points here once text has been appended.
+    int32_t                  fOwnedCapacity; // Capacity of the fOwnedInput buffer.
+
+    enum { MAX_NGRAM_TABLES = 32 };
+
+    // N-gram confidences of the single byte charsets, indexed by n-gram table.
+    //  Filled in by CharsetRecog_sbcs the first time one of its recognizers
+    //  runs, and invalidated by MungeInput().
+    int32_t                  fNGramConfidence[MAX_NGRAM_TABLES];
+    uint32_t                 fNGramPasses;  // Bit set of the scoring passes done.
+
 };
 
 U_NAMESPACE_END
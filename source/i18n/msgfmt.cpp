@@ -196,10 +196,13 @@ public:
         len += sLength;
     }
     void append(const UnicodeString& s, int32_t start, int32_t length) {
-        append(s.tempSubString(start, length));
+        // start and length are always within the string.
+        append(s.getBuffer() + start, length);
     }
     void formatAndAppend(const Format* formatter, const Formattable& arg, UErrorCode& ec) {
-        UnicodeString s;
+        // Most formatted arguments fit into the stack buffer.
+        UChar buffer[64];
+        UnicodeString s(buffer, 0, UPRV_LENGTHOF(buffer));
         formatter->format(arg, s, ec);
         if (U_SUCCESS(ec)) {
             append(s);
@@ -242,7 +245,9 @@ MessageFormat::MessageFormat(const UnicodeString& pattern,
   cachedFormatters(NULL),
   customFormatArgStarts(NULL),
   pluralProvider(*this, UPLURAL_TYPE_CARDINAL),
-  ordinalProvider(*this, UPLURAL_TYPE_ORDINAL)
+  ordinalProvider(*this, UPLURAL_TYPE_ORDINAL),
+  compiledMessage(NULL),
+  lazyInit(new MessageFormatInitOnce())
 {
     setLocaleIDs(fLocale.getName(), fLocale.getName());
     applyPattern(pattern, success);
@@ -264,7 +269,9 @@ MessageFormat::MessageFormat(const UnicodeString& pattern,
   cachedFormatters(NULL),
   customFormatArgStarts(NULL),
   pluralProvider(*this, UPLURAL_TYPE_CARDINAL),
-  ordinalProvider(*this, UPLURAL_TYPE_ORDINAL)
+  ordinalProvider(*this, UPLURAL_TYPE_ORDINAL),
+  compiledMessage(NULL),
+  lazyInit(new MessageFormatInitOnce())
 {
     setLocaleIDs(fLocale.getName(), fLocale.getName());
     applyPattern(pattern, success);
@@ -287,7 +294,9 @@ MessageFormat::MessageFormat(const UnicodeString& pattern,
   cachedFormatters(NULL),
   customFormatArgStarts(NULL),
   pluralProvider(*this, UPLURAL_TYPE_CARDINAL),
-  ordinalProvider(*this, UPLURAL_TYPE_ORDINAL)
+  ordinalProvider(*this, UPLURAL_TYPE_ORDINAL),
+  compiledMessage(NULL),
+  lazyInit(new MessageFormatInitOnce())
 {
     setLocaleIDs(fLocale.getName(), fLocale.getName());
     applyPattern(pattern, parseError, success);
@@ -309,7 +318,9 @@ MessageFormat::MessageFormat(const MessageFormat& that)
   cachedFormatters(NULL),
   customFormatArgStarts(NULL),
   pluralProvider(*this, UPLURAL_TYPE_CARDINAL),
-  ordinalProvider(*this, UPLURAL_TYPE_ORDINAL)
+  ordinalProvider(*this, UPLURAL_TYPE_ORDINAL),
+  compiledMessage(NULL),
+  lazyInit(new MessageFormatInitOnce())
 {
     // This will take care of creating the hash tables (since they are NULL).
     UErrorCode ec = U_ZERO_ERROR;
@@ -317,6 +328,7 @@ MessageFormat::MessageFormat(const MessageFormat& that)
     if (U_FAILURE(ec)) {
         resetPattern();
     }
+    compileMessage();
 }
 
 MessageFormat::~MessageFormat()
@@ -328,6 +340,8 @@ MessageFormat::~MessageFormat()
     uprv_free(formatAliases);
     delete defaultNumberFormat;
     delete defaultDateFormat;
+    delete compiledMessage;
+    delete lazyInit;
 }
 
 //--------------------------------------------------------------------
@@ -382,6 +396,7 @@ MessageFormat::operator=(const MessageFormat& that)
         if (U_FAILURE(ec)) {
             resetPattern();
         }
+        compileMessage();
     }
     return *this;
 }
@@ -454,6 +469,9 @@ MessageFormat::setLocale(const Locale& theLocale)
         setLocaleIDs(fLocale.getName(), fLocale.getName());
         pluralProvider.reset();
         ordinalProvider.reset();
+        if (lazyInit != NULL) {
+            lazyInit->reset();
+        }
     }
 }
 
@@ -492,9 +510,12 @@ MessageFormat::applyPattern(const UnicodeString& pattern,
     if (U_FAILURE(ec)) {
         resetPattern();
     }
+    compileMessage();
 }
 
 void MessageFormat::resetPattern() {
+    delete compiledMessage;
+    compiledMessage = NULL;
     msgPattern.clear();
     uhash_close(cachedFormatters);
     cachedFormatters = NULL;
@@ -563,6 +584,10 @@ void MessageFormat::setArgStartFormat(int32_t argStart,
     if (formatter == NULL) {
         formatter = new DummyFormat();
     }
+    // The compiled message may point to the formatter which is replaced here.
+    // The caller recompiles it after setting all of its formatters.
+    delete compiledMessage;
+    compiledMessage = NULL;
     uhash_iput(cachedFormatters, argStart, formatter, &status);
 }
 
@@ -600,6 +625,58 @@ Format* MessageFormat::getCachedFormatter(int32_t argumentNumber) const {
     }
 }
 
+void MessageFormat::compileMessage() {
+    delete compiledMessage;
+    compiledMessage = NULL;
+    if (msgPattern.countParts() == 0) {
+        return;
+    }
+    LocalPointer<CompiledMessage> compiled(new CompiledMessage());
+    if (compiled.isNull()) {
+        return;
+    }
+    // Same iteration as in format() for msgStart=0.
+    const UnicodeString& msgString = msgPattern.getPatternString();
+    int32_t prevIndex = msgPattern.getPart(0).getLimit();
+    for (int32_t i = 1;; ++i) {
+        const MessagePattern::Part& part = msgPattern.getPart(i);
+        UMessagePatternPartType type = part.getType();
+        compiled->literals.append(msgString, prevIndex, part.getIndex() - prevIndex);
+        if (type == UMSGPAT_PART_TYPE_MSG_LIMIT) {
+            break;
+        }
+        prevIndex = part.getLimit();
+        if (type != UMSGPAT_PART_TYPE_ARG_START) {
+            continue;
+        }
+        int32_t capacity = compiled->args.getCapacity();
+        if (compiled->argCount == capacity &&
+                compiled->args.resize(2 * capacity, compiled->argCount) == NULL) {
+            return;  // Format without the compiled message.
+        }
+        CompiledMessage::Arg &arg = compiled->args[compiled->argCount++];
+        const MessagePattern::Part& namePart = msgPattern.getPart(i + 1);
+        arg.literalLimit = compiled->literals.length();
+        arg.argStart = i;
+        // Same as in format(): An ARG_NAME part has value 0,
+        // so a named argument takes the first of numbered arguments.
+        arg.argNumber = namePart.getValue();
+        arg.nameStart = compiled->names.length();
+        arg.nameLength = namePart.getLength();
+        compiled->names.append(msgString, namePart.getIndex(), namePart.getLength());
+        arg.argType = part.getArgType();
+        arg.formatter = getCachedFormatter(i);
+        arg.useDefaultFormat = arg.argType == UMSGPAT_ARG_TYPE_NONE ||
+            (cachedFormatters != NULL && uhash_iget(cachedFormatters, i) != NULL);
+        i = msgPattern.getLimitPartIndex(i);
+        prevIndex = msgPattern.getPart(i).getLimit();
+    }
+    if (compiled->literals.isBogus() || compiled->names.isBogus()) {
+        return;
+    }
+    compiledMessage = compiled.orphan();
+}
+
 // -------------------------------------
 // Adopts the new formats array and updates the array count.
 // This MessageFormat instance owns the new formats.
@@ -629,7 +706,7 @@ MessageFormat::adoptFormats(Format** newFormats,
     for (; formatNumber < count; ++formatNumber) {
         delete newFormats[formatNumber];
     }
-
+    compileMessage();
 }
 
 // -------------------------------------
@@ -667,6 +744,7 @@ MessageFormat::setFormats(const Format** newFormats,
     if (U_FAILURE(status)) {
         resetPattern();
     }
+    compileMessage();
 }
 
 // -------------------------------------
@@ -682,6 +760,7 @@ MessageFormat::adoptFormat(int32_t n, Format *newFormat) {
             if (n == formatNumber) {
                 UErrorCode status = U_ZERO_ERROR;
                 setCustomArgStartFormat(partIndex, p.orphan(), status);
+                compileMessage();
                 return;
             }
             ++formatNumber;
@@ -724,6 +803,7 @@ MessageFormat::adoptFormat(const UnicodeString& formatName,
             setCustomArgStartFormat(partIndex, f, status);
         }
     }
+    compileMessage();
 }
 
 // -------------------------------------
@@ -741,6 +821,7 @@ MessageFormat::setFormat(int32_t n, const Format& newFormat) {
                 if (new_format) {
                     UErrorCode status = U_ZERO_ERROR;
                     setCustomArgStartFormat(partIndex, new_format, status);
+                    compileMessage();
                 }
                 return;
             }
@@ -795,6 +876,7 @@ MessageFormat::setFormat(const UnicodeString& formatName,
             setCustomArgStartFormat(partIndex, new_format, status);
         }
     }
+    compileMessage();
 }
 
 // -------------------------------------
@@ -922,6 +1004,20 @@ MessageFormat::format(const UnicodeString* argumentNames,
     return format(arguments, argumentNames, count, appendTo, NULL, success);
 }
 
+Appendable&
+MessageFormat::format(const UnicodeString* argumentNames,
+                      const Formattable* arguments,
+                      int32_t count,
+                      Appendable& appendTo,
+                      UErrorCode& success) const {
+    if (U_FAILURE(success)) {
+        return appendTo;
+    }
+    AppendableWrapper app(appendTo);
+    format(0, NULL, arguments, argumentNames, count, app, NULL, success);
+    return appendTo;
+}
+
 // Does linear search to find the match for an ArgName.
 const Formattable* MessageFormat::getArgFromListByName(const Formattable* arguments,
                                                        const UnicodeString *argumentNames,
@@ -1006,6 +1102,10 @@ void MessageFormat::format(int32_t msgStart, const void *plNumber,
     if (U_FAILURE(success)) {
         return;
     }
+    if (msgStart == 0 && plNumber == NULL && compiledMessage != NULL) {
+        formatCompiled(arguments, argumentNames, cnt, appendTo, success);
+        return;
+    }
 
     const UnicodeString& msgString = msgPattern.getPatternString();
     int32_t prevIndex = msgPattern.getPart(msgStart).getLimit();
@@ -1056,7 +1156,6 @@ void MessageFormat::format(int32_t msgStart, const void *plNumber,
         }
         ++i;
         int32_t prevDestLength = appendTo.length();
-        const Format* formatter = NULL;
         if (noArg) {
             appendTo.append(
                 UnicodeString(LEFT_CURLY_BRACE).append(argName).append(RIGHT_CURLY_BRACE));
@@ -1075,74 +1174,14 @@ void MessageFormat::format(int32_t msgStart, const void *plNumber,
                 // that formats the number without subtracting the offset.
                 appendTo.formatAndAppend(pluralNumber.formatter, *arg, success);
             }
-        } else if ((formatter = getCachedFormatter(i -2))) {
-            // Handles all ArgType.SIMPLE, and formatters from setFormat() and its siblings.
-            if (dynamic_cast<const ChoiceFormat*>(formatter) ||
-                dynamic_cast<const PluralFormat*>(formatter) ||
-                dynamic_cast<const SelectFormat*>(formatter)) {
-                // We only handle nested formats here if they were provided via
-                // setFormat() or its siblings. Otherwise they are not cached and instead
-                // handled below according to argType.
-                UnicodeString subMsgString;
-                formatter->format(*arg, subMsgString, success);
-                if (subMsgString.indexOf(LEFT_CURLY_BRACE) >= 0 ||
-                    (subMsgString.indexOf(SINGLE_QUOTE) >= 0 && !MessageImpl::jdkAposMode(msgPattern))
-                ) {
-                    MessageFormat subMsgFormat(subMsgString, fLocale, success);
-                    subMsgFormat.format(0, NULL, arguments, argumentNames, cnt, appendTo, ignore, success);
-                } else {
-                    appendTo.append(subMsgString);
-                }
-            } else {
-                appendTo.formatAndAppend(formatter, *arg, success);
-            }
-        } else if (argType == UMSGPAT_ARG_TYPE_NONE || (cachedFormatters && uhash_iget(cachedFormatters, i - 2))) {
-            // We arrive here if getCachedFormatter returned NULL, but there was actually an element in the hash table.
-            // This can only happen if the hash table contained a DummyFormat, so the if statement above is a check
-            // for the hash table containind DummyFormat.
-            if (arg->isNumeric()) {
-                const NumberFormat* nf = getDefaultNumberFormat(success);
-                appendTo.formatAndAppend(nf, *arg, success);
-            } else if (arg->getType() == Formattable::kDate) {
-                const DateFormat* df = getDefaultDateFormat(success);
-                appendTo.formatAndAppend(df, *arg, success);
-            } else {
-                appendTo.append(arg->getString(success));
-            }
-        } else if (argType == UMSGPAT_ARG_TYPE_CHOICE) {
-            if (!arg->isNumeric()) {
-                success = U_ILLEGAL_ARGUMENT_ERROR;
-                return;
-            }
-            // We must use the Formattable::getDouble() variant with the UErrorCode parameter
-            // because only this one converts non-double numeric types to double.
-            const double number = arg->getDouble(success);
-            int32_t subMsgStart = ChoiceFormat::findSubMessage(msgPattern, i, number);
-            formatComplexSubMessage(subMsgStart, NULL, arguments, argumentNames,
-                                    cnt, appendTo, success);
-        } else if (UMSGPAT_ARG_TYPE_HAS_PLURAL_STYLE(argType)) {
-            if (!arg->isNumeric()) {
-                success = U_ILLEGAL_ARGUMENT_ERROR;
-                return;
-            }
-            const PluralSelectorProvider &selector =
-                argType == UMSGPAT_ARG_TYPE_PLURAL ? pluralProvider : ordinalProvider;
-            // We must use the Formattable::getDouble() variant with the UErrorCode parameter
-            // because only this one converts non-double numeric types to double.
-            double offset = msgPattern.getPluralOffset(i);
-            PluralSelectorContext context(i, argName, *arg, offset, success);
-            int32_t subMsgStart = PluralFormat::findSubMessage(
-                    msgPattern, i, selector, &context, arg->getDouble(success), success);
-            formatComplexSubMessage(subMsgStart, &context, arguments, argumentNames,
-                                    cnt, appendTo, success);
-        } else if (argType == UMSGPAT_ARG_TYPE_SELECT) {
-            int32_t subMsgStart = SelectFormat::findSubMessage(msgPattern, i, arg->getString(success), success);
-            formatComplexSubMessage(subMsgStart, NULL, arguments, argumentNames,
-                                    cnt, appendTo, success);
         } else {
-            // This should never happen.
-            success = U_INTERNAL_PROGRAM_ERROR;
-            return;
+            // We arrive at the default formats if getCachedFormatter returned NULL,
+            // but there was actually an element in the hash table.
+            // This can only happen if the hash table contained a DummyFormat.
+            formatArg(i - 2, argType, getCachedFormatter(i - 2),
+                      argType == UMSGPAT_ARG_TYPE_NONE ||
+                          (cachedFormatters && uhash_iget(cachedFormatters, i - 2)),
+                      argName, *arg, arguments, argumentNames, cnt, appendTo, ignore, success);
         }
         ignore = updateMetaData(appendTo, prevDestLength, ignore, arg);
         prevIndex = msgPattern.getPart(argLimit).getLimit();
@@ -1150,6 +1189,123 @@ void MessageFormat::format(int32_t msgStart, const void *plNumber,
     }
 }
 
+void MessageFormat::formatArg(int32_t argStart,
+                              UMessagePatternArgType argType,
+                              const Format* formatter,
+                              UBool useDefault,
+                              const UnicodeString& argName,
+                              const Formattable& arg,
+                              const Formattable* arguments,
+                              const UnicodeString *argumentNames,
+                              int32_t cnt,
+                              AppendableWrapper& appendTo,
+                              FieldPosition* ignore,
+                              UErrorCode& success) const {
+    // Index of the part after the argument name.
+    int32_t i = argStart + 2;
+    if (formatter != NULL) {
+        // Handles all ArgType.SIMPLE, and formatters from setFormat() and its siblings.
+        if (dynamic_cast<const ChoiceFormat*>(formatter) ||
+            dynamic_cast<const PluralFormat*>(formatter) ||
+            dynamic_cast<const SelectFormat*>(formatter)) {
+            // We only handle nested formats here if they were provided via
+            // setFormat() or its siblings. Otherwise they are not cached and instead
+            // handled below according to argType.
+            UnicodeString subMsgString;
+            formatter->format(arg, subMsgString, success);
+            if (subMsgString.indexOf(LEFT_CURLY_BRACE) >= 0 ||
+                (subMsgString.indexOf(SINGLE_QUOTE) >= 0 && !MessageImpl::jdkAposMode(msgPattern))
+            ) {
+                MessageFormat subMsgFormat(subMsgString, fLocale, success);
+                subMsgFormat.format(0, NULL, arguments, argumentNames, cnt, appendTo, ignore, success);
+            } else {
+                appendTo.append(subMsgString);
+            }
+        } else {
+            appendTo.formatAndAppend(formatter, arg, success);
+        }
+    } else if (useDefault) {
+        if (arg.isNumeric()) {
+            const NumberFormat* nf = getDefaultNumberFormat(success);
+            appendTo.formatAndAppend(nf, arg, success);
+        } else if (arg.getType() == Formattable::kDate) {
+            const DateFormat* df = getDefaultDateFormat(success);
+            appendTo.formatAndAppend(df, arg, success);
+        } else {
+            appendTo.append(arg.getString(success));
+        }
+    } else if (argType == UMSGPAT_ARG_TYPE_CHOICE) {
+        if (!arg.isNumeric()) {
+            success = U_ILLEGAL_ARGUMENT_ERROR;
+            return;
+        }
+        // We must use the Formattable::getDouble() variant with the UErrorCode parameter
+        // because only this one converts non-double numeric types to double.
+        const double number = arg.getDouble(success);
+        int32_t subMsgStart = ChoiceFormat::findSubMessage(msgPattern, i, number);
+        formatComplexSubMessage(subMsgStart, NULL, arguments, argumentNames,
+                                cnt, appendTo, success);
+    } else if (UMSGPAT_ARG_TYPE_HAS_PLURAL_STYLE(argType)) {
+        if (!arg.isNumeric()) {
+            success = U_ILLEGAL_ARGUMENT_ERROR;
+            return;
+        }
+        const PluralSelectorProvider &selector =
+            argType == UMSGPAT_ARG_TYPE_PLURAL ? pluralProvider : ordinalProvider;
+        // We must use the Formattable::getDouble() variant with the UErrorCode parameter
+        // because only this one converts non-double numeric types to double.
+        double offset = msgPattern.getPluralOffset(i);
+        PluralSelectorContext context(i, argName, arg, offset, success);
+        int32_t subMsgStart = PluralFormat::findSubMessage(
+                msgPattern, i, selector, &context, arg.getDouble(success), success);
+        formatComplexSubMessage(subMsgStart, &context, arguments, argumentNames,
+                                cnt, appendTo, success);
+    } else if (argType == UMSGPAT_ARG_TYPE_SELECT) {
+        int32_t subMsgStart = SelectFormat::findSubMessage(msgPattern, i, arg.getString(success), success);
+        formatComplexSubMessage(subMsgStart, NULL, arguments, argumentNames,
+                                cnt, appendTo, success);
+    } else {
+        // This should never happen.
+        success = U_INTERNAL_PROGRAM_ERROR;
+    }
+}
+
+void MessageFormat::formatCompiled(const Formattable* arguments,
+                                   const UnicodeString *argumentNames,
+                                   int32_t cnt,
+                                   AppendableWrapper& appendTo,
+                                   UErrorCode& success) const {
+    const CompiledMessage &compiled = *compiledMessage;
+    const UChar *literals = compiled.literals.getBuffer();
+    const UChar *names = compiled.names.getBuffer();
+    int32_t prevLimit = 0;
+    for (int32_t n = 0; n < compiled.argCount && U_SUCCESS(success); ++n) {
+        const CompiledMessage::Arg &compiledArg = compiled.args[n];
+        appendTo.append(literals + prevLimit, compiledArg.literalLimit - prevLimit);
+        prevLimit = compiledArg.literalLimit;
+        // Read-only alias, does not copy the name.
+        UnicodeString argName(FALSE, names + compiledArg.nameStart, compiledArg.nameLength);
+        const Formattable* arg;
+        if (argumentNames == NULL) {
+            int32_t argNumber = compiledArg.argNumber;
+            arg = (0 <= argNumber && argNumber < cnt) ? arguments + argNumber : NULL;
+        } else {
+            arg = getArgFromListByName(arguments, argumentNames, cnt, argName);
+        }
+        if (arg == NULL) {
+            appendTo.append(
+                UnicodeString(LEFT_CURLY_BRACE).append(argName).append(RIGHT_CURLY_BRACE));
+        } else {
+            formatArg(compiledArg.argStart, compiledArg.argType, compiledArg.formatter,
+                      compiledArg.useDefaultFormat, argName, *arg,
+                      arguments, argumentNames, cnt, appendTo, NULL, success);
+        }
+    }
+    if (U_SUCCESS(success)) {
+        appendTo.append(literals + prevLimit, compiled.literals.length() - prevLimit);
+    }
+}
+
 
 void MessageFormat::formatComplexSubMessage(int32_t msgStart,
                                             const void *plNumber,
@@ -1799,19 +1955,27 @@ MessageFormat::createIntegerFormat(const Locale& locale, UErrorCode& status) con
  * Semantically const but may modify *this.
  */
 const NumberFormat* MessageFormat::getDefaultNumberFormat(UErrorCode& ec) const {
-    if (defaultNumberFormat == NULL) {
-        MessageFormat* t = (MessageFormat*) this;
-        t->defaultNumberFormat = NumberFormat::createInstance(fLocale, ec);
-        if (U_FAILURE(ec)) {
-            delete t->defaultNumberFormat;
-            t->defaultNumberFormat = NULL;
-        } else if (t->defaultNumberFormat == NULL) {
+    if (lazyInit == NULL) {
+        if (U_SUCCESS(ec)) {
             ec = U_MEMORY_ALLOCATION_ERROR;
         }
+        return NULL;
     }
+    umtx_initOnce(lazyInit->numberFormatOnce, &initDefaultNumberFormat,
+                  const_cast<MessageFormat *>(this), ec);
     return defaultNumberFormat;
 }
 
+void U_CALLCONV MessageFormat::initDefaultNumberFormat(MessageFormat *mf, UErrorCode& ec) {
+    mf->defaultNumberFormat = NumberFormat::createInstance(mf->fLocale, ec);
+    if (U_FAILURE(ec)) {
+        delete mf->defaultNumberFormat;
+        mf->defaultNumberFormat = NULL;
+    } else if (mf->defaultNumberFormat == NULL) {
+        ec = U_MEMORY_ALLOCATION_ERROR;
+    }
+}
+
 /**
  * Return the default date format.  Used to format a date
  * argument when subformats[i].format is NULL.  Returns NULL
@@ -1820,16 +1984,24 @@ const NumberFormat* MessageFormat::getDefaultNumberFormat(UErrorCode& ec) const
  * Semantically const but may modify *this.
  */
 const DateFormat* MessageFormat::getDefaultDateFormat(UErrorCode& ec) const {
-    if (defaultDateFormat == NULL) {
-        MessageFormat* t = (MessageFormat*) this;
-        t->defaultDateFormat = DateFormat::createDateTimeInstance(DateFormat::kShort, DateFormat::kShort, fLocale);
-        if (t->defaultDateFormat == NULL) {
+    if (lazyInit == NULL) {
+        if (U_SUCCESS(ec)) {
             ec = U_MEMORY_ALLOCATION_ERROR;
         }
+        return NULL;
     }
+    umtx_initOnce(lazyInit->dateFormatOnce, &initDefaultDateFormat,
+                  const_cast<MessageFormat *>(this), ec);
     return defaultDateFormat;
 }
 
+void U_CALLCONV MessageFormat::initDefaultDateFormat(MessageFormat *mf, UErrorCode& ec) {
+    mf->defaultDateFormat = DateFormat::createDateTimeInstance(DateFormat::kShort, DateFormat::kShort, mf->fLocale);
+    if (mf->defaultDateFormat == NULL) {
+        ec = U_MEMORY_ALLOCATION_ERROR;
+    }
+}
+
 UBool
 MessageFormat::usesNamedArguments() const {
     return msgPattern.hasNamedArguments();
@@ -1928,12 +2100,16 @@ UnicodeString MessageFormat::PluralSelectorProvider::select(void *ctx, double nu
     if (U_FAILURE(ec)) {
         return UnicodeString(FALSE, OTHER_STRING, 5);
     }
+    if (msgFormat.lazyInit == NULL) {
+        ec = U_MEMORY_ALLOCATION_ERROR;
+        return UnicodeString(FALSE, OTHER_STRING, 5);
+    }
     MessageFormat::PluralSelectorProvider* t = const_cast<MessageFormat::PluralSelectorProvider*>(this);
-    if(rules == NULL) {
-        t->rules = PluralRules::forLocale(msgFormat.fLocale, type, ec);
-        if (U_FAILURE(ec)) {
-            return UnicodeString(FALSE, OTHER_STRING, 5);
-        }
+    umtx_initOnce(type == UPLURAL_TYPE_CARDINAL ?
+                      msgFormat.lazyInit->pluralRulesOnce : msgFormat.lazyInit->ordinalRulesOnce,
+                  &initRules, t, ec);
+    if (U_FAILURE(ec)) {
+        return UnicodeString(FALSE, OTHER_STRING, 5);
     }
     // Select a sub-message according to how the number is formatted,
     // which is specified in the selected sub-message.
@@ -1967,6 +2143,11 @@ UnicodeString MessageFormat::PluralSelectorProvider::select(void *ctx, double nu
     }
 }
 
+void U_CALLCONV MessageFormat::PluralSelectorProvider::initRules(PluralSelectorProvider *provider,
+                                                                UErrorCode& ec) {
+    provider->rules = PluralRules::forLocale(provider->msgFormat.fLocale, provider->type, ec);
+}
+
 void MessageFormat::PluralSelectorProvider::reset() {
     delete rules;
     rules = NULL;
@@ -1,6 +1,6 @@
 /*
 *******************************************************************************
-* Copyright (C) 2007-2008, International Business Machines Corporation and
+* Copyright (C) 2007-2016, International Business Machines Corporation and
 * others. All Rights Reserved.                                                *
 *******************************************************************************
 *
@@ -17,6 +17,8 @@
 #if !UCONFIG_NO_FORMATTING
     
 #include "unicode/msgfmt.h"
+#include "cmemory.h"
+#include "umutex.h"
 #include "uvector.h"
 #include "unicode/strenum.h"
 
@@ -36,6 +38,69 @@ private:
     UVector *fFormatNames;
 };
 
+/**
+ * The top-level message of a MessageFormat, compiled for repeated formatting.
+ * The literal text between the arguments is stored with the syntax apostrophes
+ * already removed, and each argument has its number, name and formatter
+ * resolved from the MessagePattern and the cached formatters.
+ *
+ * The MessageFormat rebuilds it whenever its pattern or one of its formats changes.
+ * Otherwise it is not modified, so that concurrent format() calls can share it.
+ */
+class CompiledMessage : public UMemory {
+public:
+    struct Arg {
+        /** Limit of the literal text before this argument, in literals. */
+        int32_t literalLimit;
+        /** MessagePattern index of the ARG_START part. */
+        int32_t argStart;
+        /** Argument number, or 0 for a named argument, like the ARG_NAME part value. */
+        int32_t argNumber;
+        /** The argument name or number string, in names. */
+        int32_t nameStart, nameLength;
+        UMessagePatternArgType argType;
+        /** The cached formatter, or NULL. Owned by the MessageFormat. */
+        const Format *formatter;
+        /** TRUE if the argument is formatted with a default number or date format. */
+        UBool useDefaultFormat;
+    };
+
+    CompiledMessage() : argCount(0) {}
+
+    UnicodeString literals;
+    UnicodeString names;
+    MaybeStackArray<Arg, 8> args;
+    int32_t argCount;
+};
+
+/**
+ * Per-instance state for creating the default number and date formats
+ * and the plural rules of a MessageFormat on first use.
+ * Each is created at most once until the MessageFormat locale changes,
+ * without any global lock, so that concurrent format() calls
+ * neither race nor contend with those of other MessageFormat objects.
+ */
+class MessageFormatInitOnce : public UMemory {
+public:
+    MessageFormatInitOnce() { reset(); }
+
+    void reset() {
+        numberFormatOnce.reset();
+        numberFormatOnce.fErrCode = U_ZERO_ERROR;
+        dateFormatOnce.reset();
+        dateFormatOnce.fErrCode = U_ZERO_ERROR;
+        pluralRulesOnce.reset();
+        pluralRulesOnce.fErrCode = U_ZERO_ERROR;
+        ordinalRulesOnce.reset();
+        ordinalRulesOnce.fErrCode = U_ZERO_ERROR;
+    }
+
+    UInitOnce numberFormatOnce;
+    UInitOnce dateFormatOnce;
+    UInitOnce pluralRulesOnce;
+    UInitOnce ordinalRulesOnce;
+};
+
 U_NAMESPACE_END
 
 #endif
@@ -26,6 +26,7 @@
 #include "uresimp.h" // struct UResourceBundle
 #include "zonemeta.h"
 #include "umutex.h"
+#include "sharedobject.h"
 
 #ifdef U_DEBUG_TZ
 # include <stdio.h>
@@ -94,9 +95,7 @@ UOBJECT_DEFINE_RTTI_IMPLEMENTATION(OlsonTimeZone)
  * Construct a GMT+0 zone with no transitions.  This is done when a
  * constructor fails so the resultant object is well-behaved.
  */
-void OlsonTimeZone::constructEmpty() {
-    canonicalID = NULL;
-
+void OlsonTimeZoneData::constructEmpty() {
     transitionCountPre32 = transitionCount32 = transitionCountPost32 = 0;
     transitionTimesPre32 = transitionTimes32 = transitionTimesPost32 = NULL;
 
@@ -105,6 +104,7 @@ void OlsonTimeZone::constructEmpty() {
     typeCount = 1;
     typeOffsets = ZEROS;
 
+    delete finalZone;
     finalZone = NULL;
 }
 
@@ -112,17 +112,18 @@ void OlsonTimeZone::constructEmpty() {
  * Construct from a resource bundle
  * @param top the top-level zoneinfo resource bundle.  This is used
  * to lookup the rule that `res' may refer to, if there is one.
- * @param res the resource bundle of the zone to be constructed
+ * @param res the resource bundle of the zone data to be loaded
  * @param ec input-output error code
  */
-OlsonTimeZone::OlsonTimeZone(const UResourceBundle* top,
-                             const UResourceBundle* res,
-                             const UnicodeString& tzid,
-                             UErrorCode& ec) :
-  BasicTimeZone(tzid), finalZone(NULL)
+OlsonTimeZoneData::OlsonTimeZoneData(const UResourceBundle* top,
+                                     const UResourceBundle* res,
+                                     UErrorCode& ec) :
+  finalZone(NULL), finalStartMillis(DBL_MAX), finalStartYear(INT32_MAX),
+  finalTransTimes(NULL), finalTransDst(NULL), finalTransCount(0),
+  finalTransInitialDst(0), finalTransLimit(0)
 {
-    clearTransitionRules();
-    U_DEBUG_TZ_MSG(("OlsonTimeZone(%s)\n", ures_getKey((UResourceBundle*)res)));
+    finalTransInitOnce.reset();
+    U_DEBUG_TZ_MSG(("OlsonTimeZoneData(%s)\n", ures_getKey((UResourceBundle*)res)));
     if ((top == NULL || res == NULL) && U_SUCCESS(ec)) {
         ec = U_ILLEGAL_ARGUMENT_ERROR;
     }
@@ -203,7 +204,7 @@ OlsonTimeZone::OlsonTimeZone(const UResourceBundle* top,
         int32_t ruleYear = ures_getInt(&r, &ec);
         if (U_SUCCESS(ec)) {
             UnicodeString ruleID(TRUE, ruleIdUStr, len);
-            UResourceBundle *rule = TimeZone::loadRule(top, ruleID, NULL, ec);
+            UResourceBundle *rule = OlsonTimeZone::loadRule(top, ruleID, NULL, ec);
             const int32_t *ruleData = ures_getIntVector(rule, &len, &ec); 
             if (U_SUCCESS(ec) && len == 11) {
                 UnicodeString emptyStr;
@@ -250,6 +251,78 @@ OlsonTimeZone::OlsonTimeZone(const UResourceBundle* top,
             ec = U_ZERO_ERROR;
         }
         ures_close(&r);
+    }
+
+    if (U_FAILURE(ec)) {
+        constructEmpty();
+    }
+}
+
+OlsonTimeZoneData::~OlsonTimeZoneData() {
+    uprv_free(finalTransTimes);
+    delete finalZone;
+}
+
+/**
+ * Construct a GMT+0 zone with no transitions.  This is done when a
+ * constructor fails so the resultant object is well-behaved.
+ */
+void OlsonTimeZone::constructEmpty() {
+    canonicalID = NULL;
+
+    transitionCountPre32 = transitionCount32 = transitionCountPost32 = 0;
+    transitionTimesPre32 = transitionTimes32 = transitionTimesPost32 = NULL;
+
+    typeMapData = NULL;
+
+    typeCount = 1;
+    typeOffsets = ZEROS;
+
+    finalZone = NULL;
+    SharedObject::clearPtr(zoneData);
+}
+
+/**
+ * Refer to the given zone data, and copy the fields needed for
+ * offset lookups from it.
+ */
+void OlsonTimeZone::setZoneData(const OlsonTimeZoneData* data) {
+    SharedObject::copyPtr(data, zoneData);
+
+    transitionTimesPre32 = data->transitionTimesPre32;
+    transitionTimes32 = data->transitionTimes32;
+    transitionTimesPost32 = data->transitionTimesPost32;
+
+    transitionCountPre32 = data->transitionCountPre32;
+    transitionCount32 = data->transitionCount32;
+    transitionCountPost32 = data->transitionCountPost32;
+
+    typeCount = data->typeCount;
+    typeOffsets = data->typeOffsets;
+    typeMapData = data->typeMapData;
+
+    finalZone = data->finalZone;
+    finalStartYear = data->finalStartYear;
+    finalStartMillis = data->finalStartMillis;
+}
+
+/**
+ * Construct from shared zone data
+ * @param data the zone data
+ * @param tzid the time zone ID
+ * @param ec input-output error code
+ */
+OlsonTimeZone::OlsonTimeZone(const OlsonTimeZoneData* data,
+                             const UnicodeString& tzid,
+                             UErrorCode& ec) :
+  BasicTimeZone(tzid), finalZone(NULL), zoneData(NULL)
+{
+    clearTransitionRules();
+    if (data == NULL && U_SUCCESS(ec)) {
+        ec = U_ILLEGAL_ARGUMENT_ERROR;
+    }
+    if (U_SUCCESS(ec)) {
+        setZoneData(data);
 
         // initialize canonical ID
         canonicalID = ZoneMeta::getCanonicalCLDRID(tzid, ec);
@@ -264,7 +337,7 @@ OlsonTimeZone::OlsonTimeZone(const UResourceBundle* top,
  * Copy constructor
  */
 OlsonTimeZone::OlsonTimeZone(const OlsonTimeZone& other) :
-    BasicTimeZone(other), finalZone(0) {
+    BasicTimeZone(other), finalZone(NULL), zoneData(NULL) {
     *this = other;
 }
 
@@ -272,27 +345,13 @@ OlsonTimeZone::OlsonTimeZone(const OlsonTimeZone& other) :
  * Assignment operator
  */
 OlsonTimeZone& OlsonTimeZone::operator=(const OlsonTimeZone& other) {
+    if (other.zoneData != NULL) {
+        setZoneData(other.zoneData);
+    } else {
+        constructEmpty();
+    }
     canonicalID = other.canonicalID;
 
-    transitionTimesPre32 = other.transitionTimesPre32;
-    transitionTimes32 = other.transitionTimes32;
-    transitionTimesPost32 = other.transitionTimesPost32;
-
-    transitionCountPre32 = other.transitionCountPre32;
-    transitionCount32 = other.transitionCount32;
-    transitionCountPost32 = other.transitionCountPost32;
-
-    typeCount = other.typeCount;
-    typeOffsets = other.typeOffsets;
-    typeMapData = other.typeMapData;
-
-    delete finalZone;
-    finalZone = (other.finalZone != 0) ?
-        (SimpleTimeZone*) other.finalZone->clone() : 0;
-
-    finalStartYear = other.finalStartYear;
-    finalStartMillis = other.finalStartMillis;
-
     clearTransitionRules();
 
     return *this;
@@ -303,7 +362,7 @@ OlsonTimeZone& OlsonTimeZone::operator=(const OlsonTimeZone& other) {
  */
 OlsonTimeZone::~OlsonTimeZone() {
     deleteTransitionRules();
-    delete finalZone;
+    SharedObject::clearPtr(zoneData);
 }
 
 /**
@@ -392,7 +451,9 @@ void OlsonTimeZone::getOffset(UDate date, UBool local, int32_t& rawoff,
         return;
     }
     if (finalZone != NULL && date >= finalStartMillis) {
-        finalZone->getOffset(date, local, rawoff, dstoff, ec);
+        if (local || !zoneData->getFinalOffset(date, rawoff, dstoff)) {
+            finalZone->getOffset(date, local, rawoff, dstoff, ec);
+        }
     } else {
         getHistoricalOffset(date, local, kFormer, kLatter, rawoff, dstoff);
     }
@@ -487,10 +548,28 @@ OlsonTimeZone::getHistoricalOffset(UDate date, UBool local,
             rawoff = initialRawOffset() * U_MILLIS_PER_SECOND;
             dstoff = initialDstOffset() * U_MILLIS_PER_SECOND;
         } else {
-            // Linear search from the end is the fastest approach, since
-            // most lookups will happen at/near the end.
+            // Binary search for the last transition which could possibly
+            // apply.  For local time, a transition is shifted by at most
+            // MAX_OFFSET_SECONDS, so any transition later than that cannot
+            // match.  The linear search below then only needs to look at
+            // the few transitions within the safety margin.
+            // Most lookups happen after the last transition, so check
+            // that first.
+            double limit = local ? sec + MAX_OFFSET_SECONDS : sec;
+            int16_t start = 0, end = transCount;
+            if ((double)transitionTimeInSeconds(transCount - 1) <= limit) {
+                start = transCount;
+            }
+            while (start < end) {
+                int16_t mid = (int16_t)((start + end) >> 1);
+                if ((double)transitionTimeInSeconds(mid) <= limit) {
+                    start = mid + 1;
+                } else {
+                    end = mid;
+                }
+            }
             int16_t transIdx;
-            for (transIdx = transCount - 1; transIdx >= 0; transIdx--) {
+            for (transIdx = start - 1; transIdx >= 0; transIdx--) {
                 int64_t transition = transitionTimeInSeconds(transIdx);
 
                 if (local && (sec >= (transition - MAX_OFFSET_SECONDS))) {
@@ -614,6 +693,11 @@ OlsonTimeZone::hasSameRules(const TimeZone &other) const {
         return FALSE;
     }
 
+    // Zones sharing the same data are equal.
+    if (zoneData != NULL && zoneData == z->zoneData) {
+        return TRUE;
+    }
+
     // [sic] pointer comparison: typeMapData points into
     // memory-mapped or DLL space, so if two zones have the same
     // pointer, they are equal.
@@ -686,6 +770,92 @@ OlsonTimeZone::deleteTransitionRules(void) {
     clearTransitionRules();
 }
 
+// Final rule transitions are precomputed for dates before Jan 1 of
+// this year.  Later dates fall back to the SimpleTimeZone rules.
+#define FINAL_TRANSITION_LIMIT_YEAR 2100
+
+/*
+ * Lazy final rule transitions initializer
+ */
+
+static void U_CALLCONV initFinalTrans(OlsonTimeZoneData *This) {
+    This->initFinalTransitions();
+}
+
+UBool
+OlsonTimeZoneData::getFinalOffset(UDate date, int32_t& rawoff, int32_t& dstoff) const {
+    OlsonTimeZoneData *ncThis = const_cast<OlsonTimeZoneData *>(this);
+    umtx_initOnce(ncThis->finalTransInitOnce, &initFinalTrans, ncThis);
+    if (finalTransTimes == NULL || !(date < finalTransLimit)) {
+        return FALSE;
+    }
+    // Binary search for the last transition at or before the date
+    int32_t start = 0, end = finalTransCount;
+    while (start < end) {
+        int32_t mid = (start + end) >> 1;
+        if (finalTransTimes[mid] <= date) {
+            start = mid + 1;
+        } else {
+            end = mid;
+        }
+    }
+    rawoff = finalZone->getRawOffset();
+    dstoff = (start > 0) ? finalTransDst[start - 1] : finalTransInitialDst;
+    return TRUE;
+}
+
+void
+OlsonTimeZoneData::initFinalTransitions() {
+    if (finalZone == NULL || finalStartYear >= FINAL_TRANSITION_LIMIT_YEAR) {
+        return;
+    }
+    UErrorCode status = U_ZERO_ERROR;
+    UDate limit = Grego::fieldsToDay(FINAL_TRANSITION_LIMIT_YEAR, 0, 1) * U_MILLIS_PER_DAY;
+    int32_t raw = finalZone->getRawOffset();
+    int32_t rawBefore, rawAfter, dstBefore, dstAfter;
+    finalZone->getOffset(finalStartMillis, FALSE, rawAfter, dstAfter, status);
+    if (U_FAILURE(status) || rawAfter != raw) {
+        return;
+    }
+
+    // A final rule has at most two transitions per year.
+    int32_t capacity = (FINAL_TRANSITION_LIMIT_YEAR - finalStartYear + 1) * 2;
+    UDate *times = (UDate *)uprv_malloc(capacity * (sizeof(UDate) + sizeof(int32_t)));
+    if (times == NULL) {
+        return;
+    }
+    int32_t *dsts = (int32_t *)(times + capacity);
+    int32_t count = 0;
+    int32_t initialDst = dstAfter;
+    int32_t prevDst = dstAfter;
+
+    TimeZoneTransition tzt;
+    UDate base = finalStartMillis;
+    while (finalZone->getNextTransition(base, FALSE, tzt) && tzt.getTime() < limit) {
+        base = tzt.getTime();
+        // Cross-check the transition against the offsets the rule itself
+        // computes on both sides of it; on any mismatch, the table is not
+        // used and lookups keep going through finalZone.
+        finalZone->getOffset(base - 1, FALSE, rawBefore, dstBefore, status);
+        finalZone->getOffset(base, FALSE, rawAfter, dstAfter, status);
+        if (U_FAILURE(status) || count >= capacity
+                || rawBefore != raw || rawAfter != raw || dstBefore != prevDst) {
+            uprv_free(times);
+            return;
+        }
+        times[count] = base;
+        dsts[count] = dstAfter;
+        prevDst = dstAfter;
+        count++;
+    }
+
+    finalTransTimes = times;
+    finalTransDst = dsts;
+    finalTransCount = count;
+    finalTransInitialDst = initialDst;
+    finalTransLimit = limit;
+}
+
 /*
  * Lazy transition rules initializer
  */
@@ -16,6 +16,7 @@
 #if !UCONFIG_NO_FORMATTING
 
 #include "unicode/basictz.h"
+#include "sharedobject.h"
 #include "umutex.h"
 
 struct UResourceBundle;
@@ -24,6 +25,79 @@ U_NAMESPACE_BEGIN
 
 class SimpleTimeZone;
 
+/**
+ * The data of one zone in zoneinfo64: its transitions, types and
+ * final rule.  Loaded once per zone data entry and shared by all
+ * OlsonTimeZone objects using it, including links and clones.
+ * Immutable, except for the final rule transitions table, which is
+ * computed on first use.
+ */
+class OlsonTimeZoneData : public SharedObject {
+public:
+    /**
+     * Construct from a resource bundle.  If the data is malformed,
+     * the result describes a GMT+0 zone with no transitions.
+     * @param top the top-level zoneinfo resource bundle.  This is used
+     * to lookup the rule that `res' may refer to, if there is one.
+     * @param res the resource bundle of the zone data
+     * @param ec input-output error code
+     */
+    OlsonTimeZoneData(const UResourceBundle* top,
+                      const UResourceBundle* res,
+                      UErrorCode& ec);
+
+    virtual ~OlsonTimeZoneData();
+
+    int16_t transitionCount() const;
+
+    /*
+     * Looks up the UTC offsets of a date at or after finalStartMillis
+     * in the precomputed final rule transitions.  Returns FALSE if the
+     * date is not covered by the table.
+     */
+    UBool getFinalOffset(UDate date, int32_t& rawoff, int32_t& dstoff) const;
+
+    // See the OlsonTimeZone fields of the same names.
+    int16_t transitionCountPre32;
+    int16_t transitionCount32;
+    int16_t transitionCountPost32;
+    const int32_t *transitionTimesPre32; // alias into res; do not delete
+    const int32_t *transitionTimes32; // alias into res; do not delete
+    const int32_t *transitionTimesPost32; // alias into res; do not delete
+    int16_t typeCount;
+    const int32_t *typeOffsets; // alias into res; do not delete
+    const uint8_t *typeMapData; // alias into res; do not delete
+    SimpleTimeZone *finalZone; // owned, may be NULL
+    double finalStartMillis;
+    int32_t finalStartYear;
+
+  public:    // Internal, for access from plain C code
+    void initFinalTransitions();
+  private:
+
+    void constructEmpty();
+
+    /*
+     * Transitions of finalZone from finalStartMillis on, so that UTC
+     * offset lookups in the final rule range are a binary search
+     * instead of a SimpleTimeZone rule evaluation.
+     */
+    UDate *finalTransTimes;     // owned; finalTransDst is in the same block
+    int32_t *finalTransDst;     // DST offset at and after each transition
+    int32_t finalTransCount;
+    int32_t finalTransInitialDst; // DST offset at finalStartMillis
+    UDate finalTransLimit;      // dates at or after this are not covered
+    UInitOnce finalTransInitOnce;
+
+    OlsonTimeZoneData(const OlsonTimeZoneData &);
+    OlsonTimeZoneData &operator=(const OlsonTimeZoneData &);
+};
+
+inline int16_t
+OlsonTimeZoneData::transitionCount() const {
+    return transitionCountPre32 + transitionCount32 + transitionCountPost32;
+}
+
 /**
  * A time zone based on the Olson tz database.  Olson time zones change
  * behavior over time.  The raw offset, rules, presence or absence of
@@ -114,15 +188,12 @@ class SimpleTimeZone;
 class U_I18N_API OlsonTimeZone: public BasicTimeZone {
  public:
     /**
-     * Construct from a resource bundle.
-     * @param top the top-level zoneinfo resource bundle.  This is used
-     * to lookup the rule that `res' may refer to, if there is one.
-     * @param res the resource bundle of the zone to be constructed
+     * Construct from zone data shared with other zones.
+     * @param data the zone data; this object keeps a reference to it
      * @param tzid the time zone ID
      * @param ec input-output error code
      */
-    OlsonTimeZone(const UResourceBundle* top,
-                  const UResourceBundle* res,
+    OlsonTimeZone(const OlsonTimeZoneData* data,
                   const UnicodeString& tzid,
                   UErrorCode& ec);
 
@@ -281,6 +352,9 @@ class U_I18N_API OlsonTimeZone: public BasicTimeZone {
     const UChar *getCanonicalID() const;
 
 private:
+    // Loads the final rule via the protected TimeZone::loadRule().
+    friend class OlsonTimeZoneData;
+
     /**
      * Default constructor.  Creates a time zone with an empty ID and
      * a fixed GMT offset of zero.
@@ -291,6 +365,8 @@ private:
 
     void constructEmpty();
 
+    void setZoneData(const OlsonTimeZoneData* data);
+
     void getHistoricalOffset(UDate date, UBool local,
         int32_t NonExistingTimeOpt, int32_t DuplicatedTimeOpt,
         int32_t& rawoff, int32_t& dstoff) const;
@@ -363,7 +439,7 @@ private:
     /**
      * A SimpleTimeZone that governs the behavior for date >= finalMillis.
      */
-    SimpleTimeZone *finalZone; // owned, may be NULL
+    const SimpleTimeZone *finalZone; // alias into zoneData, may be NULL
 
     /**
      * For date >= finalMillis, the finalZone will be used.
@@ -375,6 +451,12 @@ private:
      */
     int32_t finalStartYear;
 
+    /**
+     * The shared zone data the fields above are copied from.  The
+     * copies save an indirection on every offset lookup.
+     */
+    const OlsonTimeZoneData *zoneData; // shared, may be NULL
+
     /*
      * Canonical (CLDR) ID of this zone
      */
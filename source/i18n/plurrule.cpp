@@ -1,6 +1,6 @@
 /*
 *******************************************************************************
-* Copyright (C) 2007-2015, International Business Machines Corporation and
+* Copyright (C) 2007-2016, International Business Machines Corporation and
 * others. All Rights Reserved.
 *******************************************************************************
 *
@@ -63,19 +63,22 @@ UOBJECT_DEFINE_RTTI_IMPLEMENTATION(PluralKeywordEnumeration)
 
 PluralRules::PluralRules(UErrorCode& /*status*/)
 :   UObject(),
-    mRules(NULL)
+    mRules(NULL),
+    mIntegerTable(NULL)
 {
 }
 
 PluralRules::PluralRules(const PluralRules& other)
 : UObject(other),
-    mRules(NULL)
+    mRules(NULL),
+    mIntegerTable(NULL)
 {
     *this=other;
 }
 
 PluralRules::~PluralRules() {
     delete mRules;
+    SharedObject::clearPtr(mIntegerTable);
 }
 
 SharedPluralRules::~SharedPluralRules() {
@@ -97,6 +100,8 @@ PluralRules::operator=(const PluralRules& other) {
         else {
             mRules = new RuleChain(*other.mRules);
         }
+        // The copied rules are the same, so the integer table can be shared.
+        SharedObject::copyPtr(other.mIntegerTable, mIntegerTable);
     }
 
     return *this;
@@ -232,17 +237,41 @@ PluralRules::internalForLocale(const Locale& locale, UPluralType type, UErrorCod
         //        should we silently use default rules?
         //        Original impl used default rules.
         //        Ask the question to ICU Core.
+    // The cardinal rules are created once per locale for the cache,
+    // and forLocale() copies share their integer table.
+    if (U_SUCCESS(status) && type == UPLURAL_TYPE_CARDINAL) {
+        newObj->createIntegerTable();
+    }
 
     return newObj;
 }
 
+void
+PluralRules::createIntegerTable() {
+    SharedObject::clearPtr(mIntegerTable);
+    if (mRules != NULL) {
+        SharedObject::copyPtr(PluralIntegerTable::createInstance(mRules), mIntegerTable);
+    }
+}
+
 UnicodeString
 PluralRules::select(int32_t number) const {
+    if (mIntegerTable != NULL &&
+            -PluralIntegerTable::LIMIT < number && number < PluralIntegerTable::LIMIT) {
+        return mIntegerTable->getKeyword(number < 0 ? -number : number);
+    }
     return select(FixedDecimal(number));
 }
 
 UnicodeString
 PluralRules::select(double number) const {
+    if (mIntegerTable != NULL &&
+            -PluralIntegerTable::LIMIT < number && number < PluralIntegerTable::LIMIT) {
+        int32_t i = (int32_t)number;
+        if (i == number) {
+            return mIntegerTable->getKeyword(i < 0 ? -i : i);
+        }
+    }
     return select(FixedDecimal(number));
 }
 
@@ -251,6 +280,9 @@ PluralRules::select(const FixedDecimal &number) const {
     if (mRules == NULL) {
         return UnicodeString(TRUE, PLURAL_DEFAULT_RULE, -1);
     }
+    else if (mIntegerTable != NULL && PluralIntegerTable::covers(number)) {
+        return mIntegerTable->getKeyword((int32_t)number.intValue);
+    }
     else {
         return mRules->select(number);
     }
@@ -903,6 +935,45 @@ RuleChain::select(const FixedDecimal &number) const {
     return UnicodeString(TRUE, PLURAL_KEYWORD_OTHER, 5);
 }
 
+PluralIntegerTable *
+PluralIntegerTable::createInstance(const RuleChain *rules) {
+    int32_t count = 0;
+    for (const RuleChain *rc = rules; rc != NULL; rc = rc->fNext) {
+        ++count;
+    }
+    if (count >= 0xff) {
+        return NULL;
+    }
+    LocalPointer<PluralIntegerTable> table(new PluralIntegerTable());
+    if (table.isNull()) {
+        return NULL;
+    }
+    table->keywords = new UnicodeString[count + 1];
+    if (table->keywords == NULL) {
+        return NULL;
+    }
+    int32_t i = 0;
+    for (const RuleChain *rc = rules; rc != NULL; rc = rc->fNext) {
+        table->keywords[i++] = rc->fKeyword;
+    }
+    table->keywords[count].setTo(TRUE, PLURAL_KEYWORD_OTHER, 5);
+    // Same evaluation as in RuleChain::select().
+    for (int32_t n = 0; n < LIMIT; ++n) {
+        FixedDecimal number(n, 0, 0);
+        uint8_t index = 0;
+        for (const RuleChain *rc = rules;
+                rc != NULL && !rc->ruleHeader->isFulfilled(number); rc = rc->fNext) {
+            ++index;
+        }
+        table->indexes[n] = index;
+    }
+    return table.orphan();
+}
+
+PluralIntegerTable::~PluralIntegerTable() {
+    delete[] keywords;
+}
+
 static UnicodeString tokenString(tokenType tok) {
     UnicodeString s;
     switch (tok) {
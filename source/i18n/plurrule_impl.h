@@ -1,6 +1,6 @@
 /*
 *******************************************************************************
-* Copyright (C) 2007-2015, International Business Machines Corporation and
+* Copyright (C) 2007-2016, International Business Machines Corporation and
 * others. All Rights Reserved.
 *******************************************************************************
 *
@@ -24,6 +24,7 @@
 #include "unicode/utypes.h"
 #include "uvector.h"
 #include "hash.h"
+#include "sharedobject.h"
 
 class PluralRulesTest;
 
@@ -272,6 +273,48 @@ public:
     UBool         isKeyword(const UnicodeString& keyword) const;
 };
 
+/**
+ * The plural keywords of the integers 0..LIMIT-1, evaluated once from a RuleChain,
+ * so that PluralRules::select() need not walk the rules for small integers.
+ * Immutable after creation, and shared by copies of the PluralRules.
+ */
+class PluralIntegerTable : public SharedObject {
+public:
+    static const int32_t LIMIT = 1000;
+
+    /**
+     * Evaluates the rules for each integer below LIMIT.
+     * Returns NULL if there are too many keywords, or on memory allocation failure;
+     * the rules are then evaluated for each number as usual.
+     */
+    static PluralIntegerTable *createInstance(const RuleChain *rules);
+    virtual ~PluralIntegerTable();
+
+    /**
+     * @param number A non-negative integer below LIMIT.
+     */
+    const UnicodeString &getKeyword(int32_t number) const {
+        return keywords[indexes[number]];
+    }
+
+    /**
+     * Returns TRUE if the number has no visible fraction digits
+     * and is in the range of the table, as required for getKeyword(number.intValue).
+     */
+    static UBool covers(const FixedDecimal &number) {
+        return number.hasIntegerValue && number.visibleDecimalDigitCount == 0 &&
+            number.decimalDigits == 0 && number.intValue < LIMIT;
+    }
+
+private:
+    PluralIntegerTable() : keywords(NULL) {}
+
+    /** The RuleChain keywords in order, followed by "other" for numbers which match no rule. */
+    UnicodeString *keywords;
+    /** Index of each integer's keyword in keywords[]. */
+    uint8_t indexes[LIMIT];
+};
+
 class PluralKeywordEnumeration : public StringEnumeration {
 public:
     PluralKeywordEnumeration(RuleChain *header, UErrorCode& status);
@@ -1,6 +1,6 @@
 /*
 *******************************************************************************
-* Copyright (C) 1996-2015, International Business Machines
+* Copyright (C) 1996-2016, International Business Machines
 * Corporation and others.  All Rights Reserved.
 *******************************************************************************
 * rulebasedcollator.cpp
@@ -1620,6 +1620,52 @@ RuleBasedCollator::initMaxExpansions(UErrorCode &errorCode) const {
     return U_SUCCESS(errorCode);
 }
 
+void
+RuleBasedCollator::computeContextChars(const CollationTailoring *t, UErrorCode &errorCode) {
+    UnicodeSet contractions;
+    ContractionsAndExpansions(&contractions, NULL, NULL, TRUE).forData(t->data, errorCode);
+    if(U_FAILURE(errorCode)) { return; }
+    LocalPointer<UnicodeSet> contextChars(new UnicodeSet(), errorCode);
+    LocalPointer<UnicodeSet> prefixedChars(new UnicodeSet(), errorCode);
+    if(U_FAILURE(errorCode)) { return; }
+    UnicodeSetIterator iter(contractions);
+    while(iter.next()) {
+        if(iter.isString()) {
+            contextChars->addAll(iter.getString());
+        }
+    }
+    const CollationData *d = t->data;
+    for(int32_t i = 0; i < contextChars->getRangeCount(); ++i) {
+        UChar32 end = contextChars->getRangeEnd(i);
+        for(UChar32 c = contextChars->getRangeStart(i); c <= end; ++c) {
+            uint32_t ce32 = d->getCE32(c);
+            if(ce32 == Collation::FALLBACK_CE32) {
+                ce32 = d->base->getCE32(c);
+            }
+            if(Collation::isPrefixCE32(ce32)) {
+                prefixedChars->add(c);
+            }
+        }
+    }
+    contextChars->freeze();
+    prefixedChars->freeze();
+    if(contextChars->isBogus() || prefixedChars->isBogus()) {
+        errorCode = U_MEMORY_ALLOCATION_ERROR;
+        return;
+    }
+    t->contextChars = contextChars.orphan();
+    t->prefixedChars = prefixedChars.orphan();
+}
+
+void
+RuleBasedCollator::internalGetContextChars(const UnicodeSet *&contextChars,
+                                           const UnicodeSet *&prefixedChars,
+                                           UErrorCode &errorCode) const {
+    umtx_initOnce(tailoring->contextCharsInitOnce, computeContextChars, tailoring, errorCode);
+    contextChars = tailoring->contextChars;
+    prefixedChars = tailoring->prefixedChars;
+}
+
 CollationElementIterator *
 RuleBasedCollator::createCollationElementIterator(const UnicodeString& source) const {
     UErrorCode errorCode = U_ZERO_ERROR;
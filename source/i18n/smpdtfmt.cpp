@@ -621,6 +621,7 @@ SimpleDateFormat& SimpleDateFormat::operator=(const SimpleDateFormat& other)
     fHaveDefaultCentury          = other.fHaveDefaultCentury;
 
     fPattern = other.fPattern;
+    fNumericParsePlan = other.fNumericParsePlan;
 
     // TimeZoneFormat in ICU4C only depends on a locale for now
     if (fLocale != other.fLocale) {
@@ -906,6 +907,7 @@ SimpleDateFormat::initialize(const Locale& locale,
     {
         status = U_MISSING_RESOURCE_ERROR;
     }
+    compileNumericParsePlan();
 }
 
 /* Initialize the fields we use to disambiguate ambiguous years. Separate
@@ -1855,6 +1857,7 @@ void SimpleDateFormat::adoptNumberFormat(NumberFormat *formatToAdopt) {
         freeSharedNumberFormatters(fSharedNumberFormatters);
         fSharedNumberFormatters = NULL;
     }
+    compileNumericParsePlan();
 }
 
 void SimpleDateFormat::adoptNumberFormat(const UnicodeString& fields, NumberFormat *formatToAdopt, UErrorCode &status){
@@ -1974,6 +1977,19 @@ SimpleDateFormat::parse(const UnicodeString& text, Calendar& cal, ParsePosition&
     }
     int32_t start = pos;
 
+    // Fast path for all-numeric patterns like "yyyy-MM-dd HH:mm:ss.SSS".
+    // It does not handle leap month patterns, calendar conversion or
+    // numbering system overrides.
+    if (!fNumericParsePlan.isEmpty() && fSharedNumberFormatters == NULL &&
+            fSymbols->fLeapMonthPatterns == NULL &&
+            uprv_strcmp(fCalendar->getType(), "gregorian") == 0 &&
+            (&cal == fCalendar || uprv_strcmp(cal.getType(), "gregorian") == 0)) {
+        int32_t end = parseNumeric(text, pos, cal);
+        if (end >= 0) {
+            parsePos.setIndex(end);
+            return;
+        }
+    }
 
     UBool ambiguousYear[] = { FALSE };
     int32_t saveHebrewMonth = -1;
@@ -2326,6 +2342,206 @@ ExitParse:
 
 //----------------------------------------------------------------------
 
+// In fNumericParsePlan, a field is stored as kNumericPlanField followed by
+// (UDateFormatField << 8) | count; any other unit is a literal to match.
+static const UChar kNumericPlanField = 0xFFFF;
+
+// Limit on the number of fields in fNumericParsePlan.
+static const int32_t kMaxNumericPlanFields = 10;
+
+// Maximum number of digits of a field parsed by the fast path,
+// so that values cannot overflow.
+static const int32_t kMaxNumericPlanDigits = 9;
+
+static inline UBool isASCIILetter(UChar c) {
+    return (0x41 <= c && c <= 0x5A) || (0x61 <= c && c <= 0x7A);
+}
+
+void SimpleDateFormat::compileNumericParsePlan()
+{
+    fNumericParsePlan.remove();
+
+    // The number format must parse nothing but the plain ASCII digits
+    // of a non-negative integer.
+    const DecimalFormat *df = dynamic_cast<const DecimalFormat *>(fNumberFormat);
+    if (df == NULL || !df->isParseIntegerOnly() || df->isGroupingUsed() ||
+            df->isLenient() || df->isScientificNotation() ||
+            df->getMultiplier() != 1 || df->getFormatWidth() != 0) {
+        return;
+    }
+    UnicodeString affix;
+    if (!df->getPositivePrefix(affix).isEmpty() || !df->getPositiveSuffix(affix).isEmpty()) {
+        return;
+    }
+    const DecimalFormatSymbols *dfs = df->getDecimalFormatSymbols();
+    if (dfs == NULL ||
+            dfs->getConstSymbol(DecimalFormatSymbols::kZeroDigitSymbol) != UnicodeString((UChar)0x30)) {
+        return;
+    }
+    UChar exponentChar = dfs->getConstSymbol(DecimalFormatSymbols::kExponentialSymbol).charAt(0);
+
+    UnicodeString plan;
+    int32_t fieldCount = 0;
+    UBool inQuote = FALSE;
+    UBool afterField = FALSE;
+    int32_t length = fPattern.length();
+    for (int32_t i = 0; i < length; ++i) {
+        UChar ch = fPattern.charAt(i);
+        if (ch == QUOTE) {
+            if ((i + 1) < length && fPattern.charAt(i + 1) == QUOTE) {
+                ++i;    // '' is a literal quote
+            } else {
+                inQuote = !inQuote;
+                continue;
+            }
+        } else if (!inQuote && isSyntaxChar(ch)) {
+            int32_t count = 1;
+            while ((i + 1) < length && fPattern.charAt(i + 1) == ch) {
+                ++count;
+                ++i;
+            }
+            UDateFormatField patternCharIndex = DateFormatSymbols::getPatternCharIndex(ch);
+            switch (patternCharIndex) {
+            case UDAT_MONTH_FIELD:
+                if (count > 2) {
+                    return;
+                }
+                break;
+            case UDAT_YEAR_FIELD:
+            case UDAT_DATE_FIELD:
+            case UDAT_HOUR_OF_DAY0_FIELD:
+            case UDAT_MINUTE_FIELD:
+            case UDAT_SECOND_FIELD:
+            case UDAT_FRACTIONAL_SECOND_FIELD:
+                break;
+            default:
+                return;
+            }
+            // Abutting numeric fields are parsed with fixed widths.
+            if (afterField || ++fieldCount > kMaxNumericPlanFields) {
+                return;
+            }
+            plan.append(kNumericPlanField).append((UChar)((patternCharIndex << 8) | uprv_min(count, 0xff)));
+            afterField = TRUE;
+            continue;
+        }
+        // Plain ASCII literals which the number format does not consume,
+        // and no other whitespace than single spaces inside the pattern:
+        // the general code matches other whitespace leniently.
+        if (ch < 0x20 || ch > 0x7E || isASCIILetter(ch) || (0x30 <= ch && ch <= 0x39) ||
+                ch == exponentChar || (ch == 0x20 && (i + 1) == length)) {
+            return;
+        }
+        plan.append(ch);
+        afterField = FALSE;
+    }
+    if (fieldCount > 0 && !inQuote) {
+        fNumericParsePlan = plan;
+    }
+}
+
+int32_t SimpleDateFormat::parseNumeric(const UnicodeString& text, int32_t start, Calendar& cal) const
+{
+    // Nothing is set on the calendar until the whole plan has matched,
+    // so that the general code starts from scratch after a fallback.
+    UCalendarDateFields fields[kMaxNumericPlanFields];
+    int32_t values[kMaxNumericPlanFields];
+    int32_t fieldCount = 0;
+    UErrorCode status = U_ZERO_ERROR;
+    const UChar *plan = fNumericParsePlan.getBuffer();
+    int32_t planLength = fNumericParsePlan.length();
+    int32_t textLength = text.length();
+    int32_t pos = start;
+    UBool afterField = FALSE;
+
+    for (int32_t i = 0; i < planLength; ++i) {
+        if (plan[i] != kNumericPlanField) {
+            if (pos >= textLength || text.charAt(pos) != plan[i]) {
+                return -1;
+            }
+            ++pos;
+            afterField = FALSE;
+            continue;
+        }
+        UDateFormatField patternCharIndex = (UDateFormatField)(plan[++i] >> 8);
+        int32_t count = plan[i] & 0xff;
+        int32_t digitStart = pos;
+        int32_t value = 0;
+        UChar c;
+        while (pos < textLength && (c = text.charAt(pos)) >= 0x30 && c <= 0x39) {
+            if (pos - digitStart == kMaxNumericPlanDigits) {
+                return -1;
+            }
+            value = value * 10 + (c - 0x30);
+            ++pos;
+        }
+        int32_t digits = pos - digitStart;
+        if (digits == 0) {
+            return -1;
+        }
+        UCalendarDateFields field = fgPatternIndexToCalendarField[patternCharIndex];
+
+        // Same field handling and range checks as in subParse():
+        // M is parsed in its numeric special case, which checks the range
+        // unless whitespace is allowed; d, m and s are parsed as generic
+        // fields, which check the range unless numeric parsing is allowed.
+        int32_t bias = gFieldRangeBias[patternCharIndex];
+        switch (patternCharIndex) {
+        case UDAT_YEAR_FIELD:
+            if (count < 3 && digits == 2) {
+                return -1;  // two-digit year, needs the default century
+            }
+            break;
+        case UDAT_MONTH_FIELD:
+            if (!getBooleanAttribute(UDAT_PARSE_ALLOW_WHITESPACE, status) &&
+                    (value > cal.getMaximum(field) + bias || value < cal.getMinimum(field) + bias)) {
+                return -1;
+            }
+            --value;
+            break;
+        case UDAT_HOUR_OF_DAY0_FIELD:
+            if (value > 24) {
+                return -1;
+            }
+            break;
+        case UDAT_FRACTIONAL_SECOND_FIELD:
+            // Fractional seconds left-justify
+            for (; digits < 3; ++digits) {
+                value *= 10;
+            }
+            for (; digits > 3; --digits) {
+                value /= 10;
+            }
+            break;
+        default:
+            if (!getBooleanAttribute(UDAT_PARSE_ALLOW_NUMERIC, status) &&
+                    (value > cal.getMaximum(field) + bias || value < cal.getMinimum(field) + bias)) {
+                return -1;
+            }
+            break;
+        }
+        fields[fieldCount] = field;
+        values[fieldCount++] = value;
+        afterField = TRUE;
+    }
+
+    // The number format would continue with letters (exponent) or
+    // non-ASCII digits after a trailing field.
+    if (afterField && pos < textLength) {
+        UChar c = text.charAt(pos);
+        if (c > 0x7E || isASCIILetter(c)) {
+            return -1;
+        }
+    }
+
+    for (int32_t i = 0; i < fieldCount; ++i) {
+        cal.set(fields[i], values[i]);
+    }
+    return pos;
+}
+
+//----------------------------------------------------------------------
+
 static int32_t
 matchStringWithOptionalDot(const UnicodeString &text,
                             int32_t index,
@@ -3491,6 +3707,7 @@ void
 SimpleDateFormat::applyPattern(const UnicodeString& pattern)
 {
     fPattern = pattern;
+    compileNumericParsePlan();
 }
 
 //----------------------------------------------------------------------
@@ -3502,6 +3719,7 @@ SimpleDateFormat::applyLocalizedPattern(const UnicodeString& pattern,
     translatePattern(pattern, fPattern,
                      fSymbols->fLocalPatternChars,
                      UnicodeString(DateFormatSymbols::getPatternUChars()), status);
+    compileNumericParsePlan();
 }
 
 //----------------------------------------------------------------------
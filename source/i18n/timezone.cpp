@@ -84,6 +84,7 @@ static char gStrBuf[256];
 #include "cmemory.h"
 #include "unicode/strenum.h"
 #include "uassert.h"
+#include "uhash.h"
 #include "zonemeta.h"
 
 #define kZONEINFO "zoneinfo64"
@@ -132,10 +133,50 @@ static icu::UInitOnce gSystemZonesInitOnce = U_INITONCE_INITIALIZER;
 static icu::UInitOnce gCanonicalZonesInitOnce = U_INITONCE_INITIALIZER;
 static icu::UInitOnce gCanonicalLocationZonesInitOnce = U_INITONCE_INITIALIZER;
 
+// Zone ID lookup tables, indexed like the Names and Zones arrays.
+static UHashtable* gZoneIDIndex = NULL;     // zone ID -> index + 1
+static icu::UnicodeString* gZoneIDs = NULL; // aliases into Names
+static int32_t* gZoneDataIndex = NULL;      // index of the zone data, links dereferenced
+static int32_t gZoneCount = 0;
+static icu::UInitOnce gZoneIndexInitOnce = U_INITONCE_INITIALIZER;
+
+// Zone data shared by all OlsonTimeZone objects, by zone data index,
+// loaded on first use.  Not kept in the UnifiedCache: cached calendars
+// and formats own zones, and a cached object must not hold references
+// to other objects in the same cache.
+// An entry is never evicted once loaded: This table keeps one reference
+// to each loaded OlsonTimeZoneData until u_cleanup() (timeZone_cleanup()),
+// so the data of all zones used by the process stays in memory.
+// Each OlsonTimeZone holds its own reference, so a zone that outlives
+// the cleanup keeps its data.
+static const icu::OlsonTimeZoneData** gZoneData = NULL;
+static UMutex gZoneDataLock = U_MUTEX_INITIALIZER;
+
+static void deleteZoneIndex() {
+    U_NAMESPACE_USE
+    if (gZoneData != NULL) {
+        for (int32_t i = 0; i < gZoneCount; ++i) {
+            SharedObject::clearPtr(gZoneData[i]);
+        }
+        uprv_free(gZoneData);
+        gZoneData = NULL;
+    }
+    uhash_close(gZoneIDIndex);
+    gZoneIDIndex = NULL;
+    delete[] gZoneIDs;
+    gZoneIDs = NULL;
+    uprv_free(gZoneDataIndex);
+    gZoneDataIndex = NULL;
+    gZoneCount = 0;
+}
+
 U_CDECL_BEGIN
 static UBool U_CALLCONV timeZone_cleanup(void)
 {
     U_NAMESPACE_USE
+    deleteZoneIndex();
+    gZoneIndexInitOnce.reset();
+
     delete DEFAULT_ZONE;
     DEFAULT_ZONE = NULL;
     gDefaultZoneInitOnce.reset();
@@ -170,45 +211,64 @@ U_CDECL_END
 
 U_NAMESPACE_BEGIN
 
-static int32_t findInStringArray(UResourceBundle* array, const UnicodeString& id, UErrorCode &status)
-{
-    UnicodeString copy;
-    const UChar *u;
-    int32_t len;
-
-    int32_t start = 0;
-    int32_t limit = ures_getSize(array);
-    int32_t mid;
-    int32_t lastMid = INT32_MAX;
-    if(U_FAILURE(status) || (limit < 1)) {
-        return -1;
-    }
-    U_DEBUG_TZ_MSG(("fisa: Looking for %s, between %d and %d\n", U_DEBUG_TZ_STR(UnicodeString(id).getTerminatedBuffer()), start, limit));
+static void U_CALLCONV initZoneIndex(UErrorCode &status) {
+    ucln_i18n_registerCleanup(UCLN_I18N_TIMEZONE, timeZone_cleanup);
+    UResourceBundle *top = ures_openDirect(0, kZONEINFO, &status);
+    UResourceBundle *names = ures_getByKey(top, kNAMES, NULL, &status);
+    UResourceBundle *zones = ures_getByKey(top, kZONES, NULL, &status);
+    UResourceBundle res;
+    ures_initStackObject(&res);
 
-    for (;;) {
-        mid = (int32_t)((start + limit) / 2);
-        if (lastMid == mid) {   /* Have we moved? */
-            break;  /* We haven't moved, and it wasn't found. */
-        }
-        lastMid = mid;
-        u = ures_getStringByIndex(array, mid, &len, &status);
-        if (U_FAILURE(status)) {
-            break;
+    int32_t count = ures_getSize(names);
+    if (U_SUCCESS(status) && count != ures_getSize(zones)) {
+        status = U_INVALID_FORMAT_ERROR;
+    }
+    if (U_SUCCESS(status)) {
+        gZoneIDIndex = uhash_openSize(uhash_hashUnicodeString, uhash_compareUnicodeString,
+                                      NULL, count, &status);
+        gZoneIDs = new UnicodeString[count];
+        gZoneDataIndex = (int32_t *)uprv_malloc(count * sizeof(int32_t));
+        gZoneData = (const OlsonTimeZoneData **)uprv_malloc(count * sizeof(gZoneData[0]));
+        if (U_SUCCESS(status) && (gZoneIDs == NULL || gZoneDataIndex == NULL || gZoneData == NULL)) {
+            status = U_MEMORY_ALLOCATION_ERROR;
         }
-        U_DEBUG_TZ_MSG(("tz: compare to %s, %d .. [%d] .. %d\n", U_DEBUG_TZ_STR(u), start, mid, limit));
-        copy.setTo(TRUE, u, len);
-        int r = id.compare(copy);
-        if(r==0) {
-            U_DEBUG_TZ_MSG(("fisa: found at %d\n", mid));
-            return mid;
-        } else if(r<0) {
-            limit = mid;
-        } else {
-            start = mid;
+    }
+    if (U_SUCCESS(status)) {
+        uprv_memset(gZoneData, 0, count * sizeof(gZoneData[0]));
+        gZoneCount = count;
+    }
+    for (int32_t i = 0; i < count && U_SUCCESS(status); ++i) {
+        int32_t len = 0;
+        const UChar *id = ures_getStringByIndex(names, i, &len, &status);
+        gZoneIDs[i].setTo(TRUE, id, len);
+        uhash_puti(gZoneIDIndex, &gZoneIDs[i], i + 1, &status);
+
+        // A link is an int resource holding the index of its target zone.
+        ures_getByIndex(zones, i, &res, &status);
+        gZoneDataIndex[i] = (ures_getType(&res) == URES_INT) ? ures_getInt(&res, &status) : i;
+        if (U_SUCCESS(status) && (gZoneDataIndex[i] < 0 || gZoneDataIndex[i] >= count)) {
+            status = U_INVALID_FORMAT_ERROR;
         }
     }
-    U_DEBUG_TZ_MSG(("fisa: not found\n"));
-    return -1;
+    ures_close(&res);
+    ures_close(zones);
+    ures_close(names);
+    ures_close(top);
+    if (U_FAILURE(status)) {
+        deleteZoneIndex();
+    }
+}
+
+/**
+ * Returns the index of a system zone ID in the Names array, or -1
+ * if the ID is not found.
+ */
+static int32_t findZoneIndex(const UnicodeString& id, UErrorCode &status) {
+    umtx_initOnce(gZoneIndexInitOnce, &initZoneIndex, status);
+    if (U_FAILURE(status)) {
+        return -1;
+    }
+    return uhash_geti(gZoneIDIndex, &id) - 1;
 }
 
 /**
@@ -219,11 +279,10 @@ static int32_t findInStringArray(UResourceBundle* array, const UnicodeString& id
  * @return the zone's bundle if found, or undefined if error.  Reuses oldbundle.
  */
 static UResourceBundle* getZoneByName(const UResourceBundle* top, const UnicodeString& id, UResourceBundle *oldbundle, UErrorCode& status) {
-    // load the Rules object
-    UResourceBundle *tmp = ures_getByKey(top, kNAMES, NULL, &status);
+    UResourceBundle *tmp = NULL;
 
     // search for the string
-    int32_t idx = findInStringArray(tmp, id, status);
+    int32_t idx = findZoneIndex(id, status);
 
     if((idx == -1) && U_SUCCESS(status)) {
         // not found
@@ -231,7 +290,6 @@ static UResourceBundle* getZoneByName(const UResourceBundle* top, const UnicodeS
         //ures_close(oldbundle);
         //oldbundle = NULL;
     } else {
-        U_DEBUG_TZ_MSG(("gzbn: oldbundle= size %d, type %d, %s\n", ures_getSize(tmp), ures_getType(tmp), u_errorName(status)));
         tmp = ures_getByKey(top, kZONES, tmp, &status); // get Zones object from top
         U_DEBUG_TZ_MSG(("gzbn: loaded ZONES, size %d, type %d, path %s %s\n", ures_getSize(tmp), ures_getType(tmp), ures_getPath(tmp), u_errorName(status)));
         oldbundle = ures_getByIndex(tmp, idx, oldbundle, &status); // get nth Zone object
@@ -374,25 +432,65 @@ TimeZone::operator==(const TimeZone& that) const
 // -------------------------------------
 
 namespace {
+
+/**
+ * Returns the data of a system zone by the index of the zone data in
+ * the Zones array, loading it on first use.  Links share the data of
+ * their target zone.  The caller must call removeRef() on the result.
+ */
+const OlsonTimeZoneData*
+getZoneData(int32_t dataIdx, UErrorCode& ec) {
+    Mutex lock(&gZoneDataLock);
+    if (gZoneData[dataIdx] == NULL) {
+        UResourceBundle res;
+        ures_initStackObject(&res);
+        UResourceBundle *top = ures_openDirect(0, kZONEINFO, &ec);
+        UResourceBundle *zones = ures_getByKey(top, kZONES, NULL, &ec);
+        ures_getByIndex(zones, dataIdx, &res, &ec);
+        OlsonTimeZoneData *data = NULL;
+        if (U_SUCCESS(ec)) {
+            data = new OlsonTimeZoneData(top, &res, ec);
+            if (data == NULL) {
+                ec = U_MEMORY_ALLOCATION_ERROR;
+            } else if (U_FAILURE(ec)) {
+                delete data;
+            } else {
+                SharedObject::copyPtr((const OlsonTimeZoneData *)data, gZoneData[dataIdx]);
+            }
+        }
+        ures_close(&res);
+        ures_close(zones);
+        ures_close(top);
+        if (U_FAILURE(ec)) {
+            return NULL;
+        }
+    }
+    gZoneData[dataIdx]->addRef();
+    return gZoneData[dataIdx];
+}
+
 TimeZone*
 createSystemTimeZone(const UnicodeString& id, UErrorCode& ec) {
     if (U_FAILURE(ec)) {
         return NULL;
     }
     TimeZone* z = 0;
-    UResourceBundle res;
-    ures_initStackObject(&res);
-    U_DEBUG_TZ_MSG(("pre-err=%s\n", u_errorName(ec)));
-    UResourceBundle *top = openOlsonResource(id, res, ec);
-    U_DEBUG_TZ_MSG(("post-err=%s\n", u_errorName(ec)));
+    int32_t idx = findZoneIndex(id, ec);
+    if (idx < 0 && U_SUCCESS(ec)) {
+        ec = U_MISSING_RESOURCE_ERROR;
+    }
+    const OlsonTimeZoneData *data = NULL;
     if (U_SUCCESS(ec)) {
-        z = new OlsonTimeZone(top, &res, id, ec);
+        data = getZoneData(gZoneDataIndex[idx], ec);
+    }
+    if (U_SUCCESS(ec)) {
+        z = new OlsonTimeZone(data, id, ec);
         if (z == NULL) {
-          U_DEBUG_TZ_MSG(("cstz: olson time zone failed to initialize - err %s\n", u_errorName(ec)));
+            U_DEBUG_TZ_MSG(("cstz: olson time zone failed to initialize - err %s\n", u_errorName(ec)));
+            ec = U_MEMORY_ALLOCATION_ERROR;
         }
     }
-    ures_close(&res);
-    ures_close(top);
+    SharedObject::clearPtr(data);
     if (U_FAILURE(ec)) {
         U_DEBUG_TZ_MSG(("cstz: failed to create, err %s\n", u_errorName(ec)));
         delete z;
@@ -1049,53 +1147,24 @@ TimeZone::getEquivalentID(const UnicodeString& id, int32_t index) {
 
 const UChar*
 TimeZone::findID(const UnicodeString& id) {
-    const UChar *result = NULL;
     UErrorCode ec = U_ZERO_ERROR;
-    UResourceBundle *rb = ures_openDirect(NULL, kZONEINFO, &ec);
-
-    // resolve zone index by name
-    UResourceBundle *names = ures_getByKey(rb, kNAMES, NULL, &ec);
-    int32_t idx = findInStringArray(names, id, ec);
-    result = ures_getStringByIndex(names, idx, NULL, &ec);
-    if (U_FAILURE(ec)) {
-        result = NULL;
+    int32_t idx = findZoneIndex(id, ec);
+    if (idx < 0) {
+        return NULL;
     }
-    ures_close(names);
-    ures_close(rb);
-    return result;
+    // The IDs alias NUL-terminated strings in the zoneinfo64 data.
+    return gZoneIDs[idx].getBuffer();
 }
 
 
 const UChar*
 TimeZone::dereferOlsonLink(const UnicodeString& id) {
-    const UChar *result = NULL;
     UErrorCode ec = U_ZERO_ERROR;
-    UResourceBundle *rb = ures_openDirect(NULL, kZONEINFO, &ec);
-
-    // resolve zone index by name
-    UResourceBundle *names = ures_getByKey(rb, kNAMES, NULL, &ec);
-    int32_t idx = findInStringArray(names, id, ec);
-    result = ures_getStringByIndex(names, idx, NULL, &ec);
-
-    // open the zone bundle by index
-    ures_getByKey(rb, kZONES, rb, &ec);
-    ures_getByIndex(rb, idx, rb, &ec); 
-
-    if (U_SUCCESS(ec)) {
-        if (ures_getType(rb) == URES_INT) {
-            // this is a link - dereference the link
-            int32_t deref = ures_getInt(rb, &ec);
-            const UChar* tmp = ures_getStringByIndex(names, deref, NULL, &ec);
-            if (U_SUCCESS(ec)) {
-                result = tmp;
-            }
-        }
+    int32_t idx = findZoneIndex(id, ec);
+    if (idx < 0) {
+        return NULL;
     }
-
-    ures_close(names);
-    ures_close(rb);
-
-    return result;
+    return gZoneIDs[gZoneDataIndex[idx]].getBuffer();
 }
 
 const UChar*
@@ -1113,11 +1182,10 @@ TimeZone::getRegion(const UnicodeString& id, UErrorCode& status) {
     UResourceBundle *rb = ures_openDirect(NULL, kZONEINFO, &status);
 
     // resolve zone index by name
-    UResourceBundle *res = ures_getByKey(rb, kNAMES, NULL, &status);
-    int32_t idx = findInStringArray(res, id, status);
+    int32_t idx = findZoneIndex(id, status);
 
     // get region mapping
-    ures_getByKey(rb, kREGIONS, res, &status);
+    UResourceBundle *res = ures_getByKey(rb, kREGIONS, NULL, &status);
     const UChar *tmp = ures_getStringByIndex(res, idx, NULL, &status);
     if (U_SUCCESS(status)) {
         result = tmp;
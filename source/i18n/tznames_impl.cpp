@@ -15,6 +15,7 @@
 
 #include "unicode/ustring.h"
 #include "unicode/timezone.h"
+#include "unicode/utf16.h"
 
 #include "tznames_impl.h"
 #include "cmemory.h"
@@ -27,6 +28,10 @@
 #include "ucln_in.h"
 #include "uvector.h"
 #include "olsontz.h"
+#include "unifiedcache.h"
+#include "unicode/ucharstrie.h"
+#include "unicode/ucharstriebuilder.h"
+#include "uarrsort.h"
 
 
 U_NAMESPACE_BEGIN
@@ -913,8 +918,9 @@ TimeZoneNamesImpl::TimeZoneNamesImpl(const Locale& locale, UErrorCode& status)
   fZoneStrings(NULL),
   fTZNamesMap(NULL),
   fMZNamesMap(NULL),
-  fNamesTrieFullyLoaded(FALSE),
-  fNamesTrie(TRUE, deleteZNameInfo) {
+  fNamesTrie(TRUE, deleteZNameInfo),
+  fAllNamesTrie(NULL) {
+    fAllNamesTrieInitOnce.reset();
     initialize(locale, status);
 }
 
@@ -997,6 +1003,7 @@ TimeZoneNamesImpl::cleanup() {
         uhash_close(fTZNamesMap);
         fTZNamesMap = NULL;
     }
+    SharedObject::clearPtr(fAllNamesTrie);
 }
 
 UBool
@@ -1189,6 +1196,17 @@ static void mergeTimeZoneKey(const UnicodeString& mzID, char* result) {
     result[keyLen + prefixLen] = '\0';
 }
 
+// Convert a time zone ID to its zoneStrings key, replacing "/" with ":"
+static void timeZoneKey(const UnicodeString& tzID, char* result) {
+    UnicodeString uKey(tzID);
+    for (int32_t i = 0; i < uKey.length(); i++) {
+        if (uKey.charAt(i) == (UChar)0x2F) {
+            uKey.setCharAt(i, (UChar)0x3A);
+        }
+    }
+    uKey.extract(0, uKey.length(), result, ZID_KEY_MAX + 1, US_INV);
+}
+
 /*
  * This method updates the cache and must be called with a lock
  */
@@ -1280,14 +1298,7 @@ TimeZoneNamesImpl::loadTimeZoneNames(const UnicodeString& tzID) {
     if (cacheVal == NULL) {
         char key[ZID_KEY_MAX + 1];
         UErrorCode status = U_ZERO_ERROR;
-        // Replace "/" with ":".
-        UnicodeString uKey(tzID);
-        for (int32_t i = 0; i < uKey.length(); i++) {
-            if (uKey.charAt(i) == (UChar)0x2F) {
-                uKey.setCharAt(i, (UChar)0x3A);
-            }
-        }
-        uKey.extract(0, uKey.length(), key, sizeof(key), US_INV);
+        timeZoneKey(tzID, key);
         tznames = TZNames::createInstance(fZoneStrings, key, tzID);
 
         if (tznames == NULL) {
@@ -1336,70 +1347,292 @@ TimeZoneNamesImpl::loadTimeZoneNames(const UnicodeString& tzID) {
     return tznames;
 }
 
-TimeZoneNames::MatchInfoCollection*
-TimeZoneNamesImpl::find(const UnicodeString& text, int32_t start, uint32_t types, UErrorCode& status) const {
-    ZNameSearchHandler handler(types);
+// ---------------------------------------------------
+// TimeZoneNamesTrie
+//
+// All time zone and meta zone names of a locale,
+// case folded into a UCharsTrie.
+// ---------------------------------------------------
+class TimeZoneNamesTrie : public SharedObject {
+public:
+    virtual ~TimeZoneNamesTrie();
 
-    TimeZoneNamesImpl *nonConstThis = const_cast<TimeZoneNamesImpl *>(this);
+    static TimeZoneNamesTrie* createInstance(const Locale& locale, UErrorCode& status);
 
-    umtx_lock(&gLock);
-    {
-        fNamesTrie.search(text, start, (TextTrieMapSearchResultHandler *)&handler, status);
+    TimeZoneNames::MatchInfoCollection* find(const UnicodeString& text, int32_t start,
+        uint32_t types, UErrorCode& status) const;
+
+private:
+    TimeZoneNamesTrie() : fTrie(NULL), fNameInfos(NULL) {}
+
+    static void addNames(ZNames* znames, const UChar* tzID, const UChar* mzID,
+        UVector& names, UVector& nameInfos, UErrorCode& status);
+
+    UCharsTrie* fTrie;      // NULL if there are no names
+    ZNameInfo* fNameInfos;  // grouped by name; a trie value is (first index << 8) | count
+};
+
+TimeZoneNamesTrie::~TimeZoneNamesTrie() {
+    delete fTrie;
+    uprv_free(fNameInfos);
+}
+
+void
+TimeZoneNamesTrie::addNames(ZNames* znames, const UChar* tzID, const UChar* mzID,
+                            UVector& names, UVector& nameInfos, UErrorCode& status) {
+    for (int32_t i = 0; ALL_NAME_TYPES[i] != UTZNM_UNKNOWN && U_SUCCESS(status); i++) {
+        const UChar* name = znames->getName(ALL_NAME_TYPES[i]);
+        if (name == NULL) {
+            continue;
+        }
+        UnicodeString *foldedName = new UnicodeString(name, -1);
+        ZNameInfo *nameinfo = (ZNameInfo *)uprv_malloc(sizeof(ZNameInfo));
+        if (foldedName == NULL || nameinfo == NULL) {
+            delete foldedName;
+            uprv_free(nameinfo);
+            status = U_MEMORY_ALLOCATION_ERROR;
+            return;
+        }
+        foldedName->foldCase();
+        nameinfo->type = ALL_NAME_TYPES[i];
+        nameinfo->tzID = tzID;
+        nameinfo->mzID = mzID;
+        names.addElement(foldedName, status);
+        if (U_FAILURE(status)) {
+            delete foldedName;
+            uprv_free(nameinfo);
+            return;
+        }
+        nameInfos.addElement(nameinfo, status);
+        if (U_FAILURE(status)) {
+            uprv_free(nameinfo);
+        }
     }
-    umtx_unlock(&gLock);
+}
 
+U_CDECL_BEGIN
+static int32_t U_CALLCONV
+compareNameIndexes(const void *context, const void *left, const void *right) {
+    const UVector *names = (const UVector *)context;
+    const UnicodeString *l = (const UnicodeString *)names->elementAt(*(const int32_t *)left);
+    const UnicodeString *r = (const UnicodeString *)names->elementAt(*(const int32_t *)right);
+    return l->compare(*r);
+}
+U_CDECL_END
+
+TimeZoneNamesTrie*
+TimeZoneNamesTrie::createInstance(const Locale& locale, UErrorCode& status) {
     if (U_FAILURE(status)) {
         return NULL;
     }
+    UErrorCode tmpsts = U_ZERO_ERROR;   // OK with fallback warning..
+    UResourceBundle *zoneStrings = ures_open(U_ICUDATA_ZONE, locale.getName(), &tmpsts);
+    zoneStrings = ures_getByKeyWithFallback(zoneStrings, gZoneStrings, zoneStrings, &tmpsts);
+    if (U_FAILURE(tmpsts)) {
+        status = tmpsts;
+        ures_close(zoneStrings);
+        return NULL;
+    }
 
-    int32_t maxLen = 0;
-    TimeZoneNames::MatchInfoCollection* matches = handler.getMatches(maxLen);
-    if (matches != NULL && ((maxLen == (text.length() - start)) || fNamesTrieFullyLoaded)) {
-        // perfect match
-        return matches;
+    UVector names(uprv_deleteUObject, NULL, status);
+    UVector nameInfos(deleteZNameInfo, NULL, status);
+    char key[ZID_KEY_MAX + 1];
+
+    // Meta zone names
+    StringEnumeration *mzIDs = TimeZoneNamesImpl::_getAvailableMetaZoneIDs(status);
+    if (U_SUCCESS(status)) {
+        const UnicodeString *mzID;
+        while ((mzID = mzIDs->snext(status)) && U_SUCCESS(status)) {
+            if (mzID->length() > (ZID_KEY_MAX - MZ_PREFIX_LEN)) {
+                continue;
+            }
+            const UChar *mzKey = ZoneMeta::findMetaZoneID(*mzID);
+            mergeTimeZoneKey(*mzID, key);
+            ZNames *znames = ZNames::createInstance(zoneStrings, key);
+            if (znames != NULL && mzKey != NULL) {
+                addNames(znames, NULL, mzKey, names, nameInfos, status);
+            }
+            delete znames;
+        }
     }
+    delete mzIDs;
 
-    delete matches;
+    // Time zone names, including exemplar locations
+    StringEnumeration *tzIDs = TimeZone::createTimeZoneIDEnumeration(UCAL_ZONE_TYPE_CANONICAL, NULL, NULL, status);
+    if (U_SUCCESS(status)) {
+        const UnicodeString *tzID;
+        while ((tzID = tzIDs->snext(status)) && U_SUCCESS(status)) {
+            if (tzID->length() > ZID_KEY_MAX) {
+                continue;
+            }
+            const UChar *tzKey = ZoneMeta::findTimeZoneID(*tzID);
+            timeZoneKey(*tzID, key);
+            TZNames *tznames = TZNames::createInstance(zoneStrings, key, *tzID);
+            if (tznames != NULL && tzKey != NULL) {
+                addNames(tznames, tzKey, NULL, names, nameInfos, status);
+            }
+            delete tznames;
+        }
+    }
+    delete tzIDs;
+    ures_close(zoneStrings);
 
-    // All names are not yet loaded into the trie
-    umtx_lock(&gLock);
-    {
-        if (!fNamesTrieFullyLoaded) {
-            const UnicodeString *id;
+    if (U_FAILURE(status)) {
+        return NULL;
+    }
+    TimeZoneNamesTrie *result = new TimeZoneNamesTrie();
+    if (result == NULL) {
+        status = U_MEMORY_ALLOCATION_ERROR;
+        return NULL;
+    }
+    int32_t count = names.size();
+    if (count == 0) {
+        return result;
+    }
 
-            // load strings for all zones
-            StringEnumeration *tzIDs = TimeZone::createTimeZoneIDEnumeration(UCAL_ZONE_TYPE_CANONICAL, NULL, NULL, status);
-            if (U_SUCCESS(status)) {
-                while ((id = tzIDs->snext(status))) {
-                    if (U_FAILURE(status)) {
-                        break;
-                    }
-                    // loadStrings also load related metazone strings
-                    nonConstThis->loadStrings(*id);
-                }
+    // Sort the names, and add each distinct name with its group of
+    // name infos to the trie.
+    MaybeStackArray<int32_t, 64> order;
+    result->fNameInfos = (ZNameInfo *)uprv_malloc(count * sizeof(ZNameInfo));
+    if ((count > order.getCapacity() && order.resize(count) == NULL) || result->fNameInfos == NULL) {
+        status = U_MEMORY_ALLOCATION_ERROR;
+        delete result;
+        return NULL;
+    }
+    for (int32_t i = 0; i < count; i++) {
+        order[i] = i;
+    }
+    uprv_sortArray(order.getAlias(), count, sizeof(int32_t),
+                   compareNameIndexes, &names, FALSE, &status);
+    UCharsTrieBuilder builder(status);
+    int32_t infoCount = 0;
+    for (int32_t i = 0; i < count && U_SUCCESS(status);) {
+        const UnicodeString &name = *(const UnicodeString *)names.elementAt(order[i]);
+        int32_t first = infoCount;
+        do {
+            if (infoCount - first < 0xff) {
+                result->fNameInfos[infoCount++] = *(const ZNameInfo *)nameInfos.elementAt(order[i]);
             }
-            if (tzIDs != NULL) {
-                delete tzIDs;
+            i++;
+        } while (i < count && name == *(const UnicodeString *)names.elementAt(order[i]));
+        builder.add(name, (first << 8) | (infoCount - first), status);
+    }
+    if (U_SUCCESS(status)) {
+        result->fTrie = builder.build(USTRINGTRIE_BUILD_SMALL, status);
+    }
+    if (U_FAILURE(status)) {
+        delete result;
+        return NULL;
+    }
+    return result;
+}
+
+TimeZoneNames::MatchInfoCollection*
+TimeZoneNamesTrie::find(const UnicodeString& text, int32_t start, uint32_t types, UErrorCode& status) const {
+    if (U_FAILURE(status) || fTrie == NULL) {
+        return NULL;
+    }
+    TimeZoneNames::MatchInfoCollection *matches = NULL;
+    UCharsTrie trie(*fTrie);    // shares the trie data, but has its own state
+    UStringTrieResult result = USTRINGTRIE_NO_VALUE;
+    UnicodeString folded;
+    int32_t index = start;
+    while (index < text.length() && USTRINGTRIE_HAS_NEXT(result)) {
+        // Fold case one code point at a time; folding may change the length.
+        UChar32 c = text.char32At(index);
+        index += U16_LENGTH(c);
+        folded.setTo(c).foldCase();
+        for (int32_t i = 0; i < folded.length() && USTRINGTRIE_HAS_NEXT(result); i++) {
+            result = trie.next(folded.charAt(i));
+        }
+        if (!USTRINGTRIE_HAS_VALUE(result)) {
+            continue;
+        }
+        int32_t value = trie.getValue();
+        const ZNameInfo *nameinfo = fNameInfos + (value >> 8);
+        const ZNameInfo *limit = nameinfo + (value & 0xff);
+        for (; nameinfo < limit; nameinfo++) {
+            if ((nameinfo->type & types) == 0) {
+                continue;
             }
-            if (U_SUCCESS(status)) {
-                nonConstThis->fNamesTrieFullyLoaded = TRUE;
+            if (matches == NULL) {
+                matches = new TimeZoneNames::MatchInfoCollection();
+                if (matches == NULL) {
+                    status = U_MEMORY_ALLOCATION_ERROR;
+                    return NULL;
+                }
+            }
+            if (nameinfo->tzID) {
+                matches->addZone(nameinfo->type, index - start, UnicodeString(nameinfo->tzID, -1), status);
+            } else {
+                U_ASSERT(nameinfo->mzID);
+                matches->addMetaZone(nameinfo->type, index - start, UnicodeString(nameinfo->mzID, -1), status);
             }
         }
+        if (U_FAILURE(status)) {
+            delete matches;
+            return NULL;
+        }
     }
-    umtx_unlock(&gLock);
+    return matches;
+}
 
+template<>
+const TimeZoneNamesTrie *LocaleCacheKey<TimeZoneNamesTrie>::createObject(
+        const void * /*unused*/, UErrorCode &status) const {
+    TimeZoneNamesTrie *result = TimeZoneNamesTrie::createInstance(fLoc, status);
     if (U_FAILURE(status)) {
         return NULL;
     }
+    result->addRef();
+    return result;
+}
+
+static void U_CALLCONV initAllNamesTrie(TimeZoneNamesImpl *This, UErrorCode &status) {
+    This->loadAllNamesTrie(status);
+}
+
+void
+TimeZoneNamesImpl::loadAllNamesTrie(UErrorCode& status) {
+    const UnifiedCache *cache = UnifiedCache::getInstance(status);
+    if (U_FAILURE(status)) {
+        return;
+    }
+    cache->get(LocaleCacheKey<TimeZoneNamesTrie>(fLocale), fAllNamesTrie, status);
+}
+
+TimeZoneNames::MatchInfoCollection*
+TimeZoneNamesImpl::find(const UnicodeString& text, int32_t start, uint32_t types, UErrorCode& status) const {
+    ZNameSearchHandler handler(types);
+
+    TimeZoneNamesImpl *nonConstThis = const_cast<TimeZoneNamesImpl *>(this);
 
+    // Names loaded so far, e.g. those of the default zone
     umtx_lock(&gLock);
     {
-        // now try it again
         fNamesTrie.search(text, start, (TextTrieMapSearchResultHandler *)&handler, status);
     }
     umtx_unlock(&gLock);
 
-    return handler.getMatches(maxLen);
+    if (U_FAILURE(status)) {
+        return NULL;
+    }
+
+    int32_t maxLen = 0;
+    TimeZoneNames::MatchInfoCollection* matches = handler.getMatches(maxLen);
+    if (matches != NULL && maxLen == (text.length() - start)) {
+        // perfect match
+        return matches;
+    }
+
+    delete matches;
+
+    // All names of the locale, shared by all TimeZoneNamesImpl instances
+    umtx_initOnce(nonConstThis->fAllNamesTrieInitOnce, &initAllNamesTrie, nonConstThis, status);
+    if (U_FAILURE(status)) {
+        return NULL;
+    }
+    return fAllNamesTrie->find(text, start, types, status);
 }
 
 static const UChar gEtcPrefix[]         = { 0x45, 0x74, 0x63, 0x2F }; // "Etc/"
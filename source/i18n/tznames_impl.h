@@ -161,6 +161,7 @@ private:
 class ZNames;
 class TZNames;
 class TextTrieMap;
+class TimeZoneNamesTrie;
 
 class TimeZoneNamesImpl : public TimeZoneNames {
 public:
@@ -200,9 +201,13 @@ private:
     UHashtable* fTZNamesMap;
     UHashtable* fMZNamesMap;
 
-    UBool fNamesTrieFullyLoaded;
     TextTrieMap fNamesTrie;
 
+    // All names of the locale, loaded on the first find() which
+    // cannot be answered with the names loaded so far.
+    const TimeZoneNamesTrie* fAllNamesTrie;
+    UInitOnce fAllNamesTrieInitOnce;
+
     void initialize(const Locale& locale, UErrorCode& status);
     void cleanup();
 
@@ -210,6 +215,9 @@ private:
 
     ZNames* loadMetaZoneNames(const UnicodeString& mzId);
     TZNames* loadTimeZoneNames(const UnicodeString& mzId);
+
+public:    // Internal, for access from plain C code
+    void loadAllNamesTrie(UErrorCode& status);
 };
 
 class TZDBNames;
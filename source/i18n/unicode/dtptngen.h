@@ -32,6 +32,7 @@ class DistanceInfo;
 class PatternMap;
 class PtnSkeleton;
 class SharedDateTimePatternGenerator;
+class DTBestPatternCache;
 
 /**
  * This class provides flexible generation of date format patterns, like "yy-MM-dd". 
@@ -474,6 +475,18 @@ public:
      */
     static UClassID U_EXPORT2 getStaticClassID(void);
 
+#ifndef U_HIDE_INTERNAL_API
+    /**
+     * Creates a new generator from a Locale for the cache.
+     * createInstance() returns clones of the cached generators.
+     * @param locale the locale.
+     * @param status any error returned here.
+     * @return the new generator.
+     * @internal For ICU use only.
+     */
+    static DateTimePatternGenerator* U_EXPORT2 makeInstance(const Locale& locale, UErrorCode& status);
+#endif  /* U_HIDE_INTERNAL_API */
+
 private:
     /**
      * Constructor.
@@ -515,6 +528,7 @@ private:
     UnicodeString hackPattern;
     UnicodeString emptyString;
     UChar fDefaultHourFormatChar;
+    const DTBestPatternCache *fBestPatternCache;  // shared with clones, may be NULL
     
     /* internal flags masks for adjustFieldTypes etc. */
     enum {
@@ -544,6 +558,8 @@ private:
     UBool isAvailableFormatSet(const UnicodeString &key) const;
     void copyHashtable(Hashtable *other, UErrorCode &status);
     UBool isCanonicalItem(const UnicodeString& item) const;
+    UnicodeString computeBestPattern(const UnicodeString& patternForm, UDateTimePatternMatchOptions options, UErrorCode& status);
+    void resetBestPatternCache();
 } ;// end class DateTimePatternGenerator
 
 U_NAMESPACE_END
@@ -41,8 +41,11 @@ U_CDECL_END
 
 U_NAMESPACE_BEGIN
 
+class Appendable;
 class AppendableWrapper;
+class CompiledMessage;
 class DateFormat;
+class MessageFormatInitOnce;
 class NumberFormat;
 
 /**
@@ -718,6 +721,38 @@ public:
                           int32_t count,
                           UnicodeString& appendTo,
                           UErrorCode& status) const;
+
+#ifndef U_HIDE_DRAFT_API
+    /**
+     * Formats the given array of arguments and appends the result
+     * to an Appendable, for example one which converts the text to UTF-8
+     * or writes it into a caller-provided buffer.
+     *
+     * The top-level message is compiled when the pattern or one of the formats
+     * is set: Its literal text, argument names and argument formatters
+     * are resolved once, and formatting writes the literal text directly
+     * to the Appendable without creating temporary strings.
+     * Concurrent calls on the same MessageFormat are safe as long as
+     * it is not modified, and its formats are not modified either.
+     *
+     * @param argumentNames NULL if the arguments are numbered.
+     *                  Otherwise the argument name array, with the same
+     *                  length as the arguments array.
+     * @param arguments An array of objects to be formatted.
+     * @param count     The number of elements of 'arguments',
+     *                  and of 'argumentNames' if that is not NULL.
+     * @param appendTo  Output parameter to receive the result.
+     *                  The result is appended to existing contents.
+     * @param status    Input/output error code.
+     * @return          Reference to 'appendTo' parameter.
+     * @draft ICU 57
+     */
+    Appendable& format(const UnicodeString* argumentNames,
+                       const Formattable* arguments,
+                       int32_t count,
+                       Appendable& appendTo,
+                       UErrorCode& status) const;
+#endif  /* U_HIDE_DRAFT_API */
     /**
      * Parses the given string into an array of output arguments.
      *
@@ -880,6 +915,8 @@ private:
 
         void reset();
     private:
+        static void U_CALLCONV initRules(PluralSelectorProvider *provider, UErrorCode& ec);
+
         const MessageFormat &msgFormat;
         PluralRules* rules;
         UPluralType type;
@@ -923,6 +960,18 @@ private:
     PluralSelectorProvider pluralProvider;
     PluralSelectorProvider ordinalProvider;
 
+    /**
+     * The top-level message compiled for format(), or NULL if it could not be built.
+     * Rebuilt by compileMessage() whenever the pattern or the formats change.
+     */
+    CompiledMessage *compiledMessage;
+
+    /**
+     * Creates the default formats and the plural rules once each.
+     * NULL if it could not be allocated.
+     */
+    MessageFormatInitOnce *lazyInit;
+
     /**
      * Method to retrieve default formats (or NULL on failure).
      * These are semantically const, but may modify *this.
@@ -930,6 +979,9 @@ private:
     const NumberFormat* getDefaultNumberFormat(UErrorCode&) const;
     const DateFormat*   getDefaultDateFormat(UErrorCode&) const;
 
+    static void U_CALLCONV initDefaultNumberFormat(MessageFormat *mf, UErrorCode& ec);
+    static void U_CALLCONV initDefaultDateFormat(MessageFormat *mf, UErrorCode& ec);
+
     /**
      * Finds the word s, in the keyword list and returns the located index.
      * @param s the keyword to be searched for.
@@ -977,6 +1029,44 @@ private:
                 FieldPosition* pos,
                 UErrorCode& success) const;
 
+    /**
+     * Formats the top-level message via the compiledMessage.
+     * Same parameters as the format() variant above with msgStart=0 and plNumber=NULL.
+     */
+    void formatCompiled(const Formattable* arguments,
+                        const UnicodeString *argumentNames,
+                        int32_t cnt,
+                        AppendableWrapper& appendTo,
+                        UErrorCode& success) const;
+
+    /**
+     * Formats one argument which is not the plural number of the enclosing plural argument.
+     * @param argStart      Index to the ARG_START msgPattern part.
+     * @param argType       The argument type.
+     * @param formatter     The cached formatter for the argument, or NULL.
+     * @param useDefault    TRUE if the argument has no cached formatter but is formatted
+     *                      with a default number or date format.
+     * @param argName       The argument name or number string.
+     * @param arg           The argument value.
+     */
+    void formatArg(int32_t argStart,
+                   UMessagePatternArgType argType,
+                   const Format* formatter,
+                   UBool useDefault,
+                   const UnicodeString& argName,
+                   const Formattable& arg,
+                   const Formattable* arguments,
+                   const UnicodeString *argumentNames,
+                   int32_t cnt,
+                   AppendableWrapper& appendTo,
+                   FieldPosition* pos,
+                   UErrorCode& success) const;
+
+    /**
+     * (Re)builds the compiledMessage from the msgPattern and the cached formatters.
+     */
+    void compileMessage();
+
     UnicodeString getArgName(int32_t partIndex);
 
     void setArgStartFormat(int32_t argStart, Format* formatter, UErrorCode& status);
@@ -1,6 +1,6 @@
 /*
 *******************************************************************************
-* Copyright (C) 2008-2015, International Business Machines Corporation and
+* Copyright (C) 2008-2016, International Business Machines Corporation and
 * others. All Rights Reserved.
 *******************************************************************************
 *
@@ -45,6 +45,7 @@ class PluralRuleParser;
 class PluralKeywordEnumeration;
 class AndConstraint;
 class SharedPluralRules;
+class PluralIntegerTable;
 
 /**
  * Defines rules for mapping non-negative numeric values onto a small set of
@@ -492,12 +493,14 @@ public:
 
 private:
     RuleChain  *mRules;
+    const PluralIntegerTable *mIntegerTable;
 
     PluralRules();   // default constructor not implemented
     void            parseDescription(const UnicodeString& ruleData, UErrorCode &status);
     int32_t         getNumberValue(const UnicodeString& token) const;
     UnicodeString   getRuleFromResource(const Locale& locale, UPluralType type, UErrorCode& status);
     RuleChain      *rulesForKeyword(const UnicodeString &keyword) const;
+    void            createIntegerTable();
 
     friend class PluralRuleParser;
 };
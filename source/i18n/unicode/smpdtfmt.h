@@ -1474,6 +1474,21 @@ private:
      */
     void initNumberFormatters(const Locale &locale,UErrorCode &status);
 
+    /**
+     * Compile fPattern into fNumericParsePlan if it qualifies for the
+     * numeric parse fast path, otherwise empty fNumericParsePlan.
+     * Must be called whenever fPattern or fNumberFormat changes.
+     */
+    void compileNumericParsePlan();
+
+    /**
+     * Parse text using fNumericParsePlan: ASCII digits are converted
+     * directly, without the NumberFormat, and the fields are set on cal.
+     * @return the parse end position, or -1 if the text must be parsed
+     *         (and any error reported) by the general parse code.
+     */
+    int32_t parseNumeric(const UnicodeString& text, int32_t start, Calendar& cal) const;
+
     /**
      * Parse the given override string and set up structures for number formats
      */
@@ -1519,6 +1534,12 @@ private:
      */
     UnicodeString       fPattern;
 
+    /**
+     * fPattern compiled for the numeric parse fast path; empty if fPattern
+     * or fNumberFormat does not qualify. See compileNumericParsePlan().
+     */
+    UnicodeString       fNumericParsePlan;
+
     /**
      * The numbering system override for dates.
      */
@@ -1,6 +1,6 @@
 /*
 ******************************************************************************
-* Copyright (C) 1996-2015, International Business Machines Corporation and
+* Copyright (C) 1996-2016, International Business Machines Corporation and
 * others. All Rights Reserved.
 ******************************************************************************
 */
@@ -762,6 +762,17 @@ public:
      */
     void internalAddContractions(UChar32 c, UnicodeSet &set, UErrorCode &errorCode) const;
 
+    /**
+     * Gets the code points that occur in contraction strings and prefix
+     * mappings, including the prefixes, and the subset of them that have
+     * prefix mappings. The sets are owned by the collator's tailoring data
+     * and computed on first use. Used by string search.
+     * @internal
+     */
+    void internalGetContextChars(const UnicodeSet *&contextChars,
+                                 const UnicodeSet *&prefixedChars,
+                                 UErrorCode &errorCode) const;
+
     /**
      * Implements from-rule constructors, and ucol_openRules().
      * @internal
@@ -856,6 +867,8 @@ private:
     static void computeMaxExpansions(const CollationTailoring *t, UErrorCode &errorCode);
     UBool initMaxExpansions(UErrorCode &errorCode) const;
 
+    static void computeContextChars(const CollationTailoring *t, UErrorCode &errorCode);
+
     void setFastLatinOptions(CollationSettings &ownedSettings) const;
 
     const CollationData *data;
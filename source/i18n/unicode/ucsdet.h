@@ -121,6 +121,32 @@ U_NAMESPACE_END
 U_STABLE void U_EXPORT2
 ucsdet_setText(UCharsetDetector *ucsd, const char *textIn, int32_t len, UErrorCode *status);
 
+#ifndef U_HIDE_DRAFT_API
+/**
+  * Append input byte data whose charset is to be detected,
+  * for input that arrives in pieces, like a network stream.
+  *
+  * Unlike with ucsdet_setText(), the text is copied, so that the caller's
+  * buffer can be reused for the next piece. Text set earlier with
+  * ucsdet_setText() is copied as well and the new text is appended to it.
+  * ucsdet_detect() can be called after each piece to decide
+  * whether more input is needed.
+  *
+  * Only the first 64k bytes of input are retained; further text is ignored.
+  * Call ucsdet_setText() to start over with new input.
+  *
+  * @param ucsd   the charset detector to be used.
+  * @param textIn the input text of unknown encoding.
+  * @param len    the length of the input text, or -1 if the text
+  *               is NUL terminated.
+  * @param status any error conditions are reported back in this variable.
+  *
+  * @draft ICU 57
+  */
+U_DRAFT void U_EXPORT2
+ucsdet_appendText(UCharsetDetector *ucsd, const char *textIn, int32_t len, UErrorCode *status);
+#endif  /* U_HIDE_DRAFT_API */
+
 
 /** Set the declared encoding for charset detection.
  *  The declared encoding of an input text is an encoding obtained
@@ -373,6 +399,41 @@ ucsdet_isInputFilterEnabled(const UCharsetDetector *ucsd);
 U_STABLE  UBool U_EXPORT2
 ucsdet_enableInputFilter(UCharsetDetector *ucsd, UBool filter);
 
+#ifndef U_HIDE_DRAFT_API
+/**
+ * Set a confidence at which detection stops early.
+ * If it is greater than 0, then ucsdet_detect() and ucsdet_detectAll() stop
+ * running the charset recognizers as soon as one of them reports a match with
+ * at least this confidence, and ucsdet_detectAll() returns only the matches found so far.
+ * This saves time when the input can be identified with certainty early,
+ * for example by a byte order mark or by valid UTF-8 multi-byte sequences.
+ *
+ * With the default of 0, ucsdet_detectAll() returns all matches.
+ * ucsdet_detect() returns the same result for 0 and for 100.
+ *
+ * @param ucsd       the charset detector to be modified.
+ * @param confidence the stop confidence, from 0 to 100.
+ * @param status     any error conditions are reported back in this variable;
+ *                   U_ILLEGAL_ARGUMENT_ERROR if the confidence is out of range.
+ *
+ * @draft ICU 57
+ */
+U_DRAFT void U_EXPORT2
+ucsdet_setStopConfidence(UCharsetDetector *ucsd, int32_t confidence, UErrorCode *status);
+
+/**
+ * Get the confidence at which detection stops early.
+ *
+ * @param ucsd   the charset detector.
+ * @param status any error conditions are reported back in this variable.
+ * @return the stop confidence, or 0 if detection does not stop early.
+ * @see ucsdet_setStopConfidence
+ * @draft ICU 57
+ */
+U_DRAFT int32_t U_EXPORT2
+ucsdet_getStopConfidence(const UCharsetDetector *ucsd, UErrorCode *status);
+#endif  /* U_HIDE_DRAFT_API */
+
 #ifndef U_HIDE_INTERNAL_API
 /**
   *  Get an iterator over the set of detectable charsets -
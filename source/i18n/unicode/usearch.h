@@ -1,6 +1,6 @@
 /*
 **********************************************************************
-*   Copyright (C) 2001-2011,2014 IBM and others. All rights reserved.
+*   Copyright (C) 2001-2011,2014,2016 IBM and others. All rights reserved.
 **********************************************************************
 *   Date        Name        Description
 *  06/28/2001   synwee      Creation.
@@ -758,6 +758,120 @@ U_STABLE int32_t U_EXPORT2 usearch_previous(UStringSearch *strsrch,
 */
 U_STABLE void U_EXPORT2 usearch_reset(UStringSearch *strsrch);
 
+#ifndef U_HIDE_DRAFT_API
+/* multiple pattern search ---------------------------------------------- */
+
+/**
+* Data structure for searching a text for several patterns at once.
+* @draft ICU 57
+*/
+struct UMultiStringSearch;
+/**
+* Data structure for searching a text for several patterns at once.
+* @draft ICU 57
+*/
+typedef struct UMultiStringSearch UMultiStringSearch;
+
+/**
+* Creates a search iterator that finds the matches of all of the given
+* patterns in a text with a single pass over its collation elements, which
+* is much faster than a <tt>UStringSearch</tt> per pattern when there are
+* many patterns.
+* <p>
+* For each pattern, the matches and their boundaries are the same as those
+* that <tt>usearch_next</tt> finds with a <tt>UStringSearch</tt> that was
+* created from the same collator, with default attributes. Matches of one
+* pattern do not overlap, but matches of different patterns may overlap.
+* <p>
+* The patterns, the text and the collator are not copied and must not be
+* modified or destroyed while the search iterator is in use.
+* @param patterns       the patterns to search for
+* @param patternLengths the lengths of the patterns; -1 for a NUL-terminated pattern
+* @param patternCount   the number of patterns
+* @param text           the text to be searched
+* @param textLength     the length of the text; -1 for a NUL-terminated text
+* @param collator       the collator to use for the search
+* @param status         for errors if it occurs; U_ILLEGAL_ARGUMENT_ERROR
+*                       if a pattern is empty or all of its collation
+*                       elements have a primary weight of zero
+* @return the search iterator data structure, or NULL if there is an error
+* @draft ICU 57
+*/
+U_DRAFT UMultiStringSearch * U_EXPORT2
+usearch_openMulti(const UChar * const *patterns,
+                  const int32_t       *patternLengths,
+                  int32_t              patternCount,
+                  const UChar         *text,
+                  int32_t              textLength,
+                  const UCollator     *collator,
+                  UErrorCode          *status);
+
+/**
+* Destroys a multiple pattern search iterator.
+* The collator is not destroyed.
+* @param ms the search iterator data structure to clean up
+* @draft ICU 57
+*/
+U_DRAFT void U_EXPORT2
+usearch_closeMulti(UMultiStringSearch *ms);
+
+/**
+* Sets the text to be searched, and restarts the search at its beginning.
+* @param ms         the search iterator data structure
+* @param text       the new text to be searched
+* @param textLength the length of the text; -1 for a NUL-terminated text
+* @param status     for errors if it occurs
+* @draft ICU 57
+*/
+U_DRAFT void U_EXPORT2
+usearch_setMultiText(UMultiStringSearch *ms,
+                     const UChar        *text,
+                     int32_t             textLength,
+                     UErrorCode         *status);
+
+/**
+* Finds the next match of any of the patterns.
+* Matches are returned in the order in which the search finds the last
+* collation elements of their patterns in the text.
+* @param ms           the search iterator data structure
+* @param patternIndex out parameter, the index of the matched pattern in the
+*                     array that was passed to <tt>usearch_openMulti</tt>;
+*                     may be NULL
+* @param matchStart   out parameter, the starting index of the match; may be NULL
+* @param matchLimit   out parameter, the index of the first position following
+*                     the match; may be NULL
+* @param status       for errors if it occurs
+* @return TRUE if a match was found, FALSE at the end of the text.
+*         If there is no match, then the out parameters are set to -1.
+* @draft ICU 57
+*/
+U_DRAFT UBool U_EXPORT2
+usearch_nextMulti(UMultiStringSearch *ms,
+                  int32_t            *patternIndex,
+                  int32_t            *matchStart,
+                  int32_t            *matchLimit,
+                  UErrorCode         *status);
+
+#if U_SHOW_CPLUSPLUS_API
+
+U_NAMESPACE_BEGIN
+
+/**
+ * \class LocalUMultiStringSearchPointer
+ * "Smart pointer" class, closes a UMultiStringSearch via usearch_closeMulti().
+ * For most methods see the LocalPointerBase base class.
+ *
+ * @see LocalPointerBase
+ * @see LocalPointer
+ * @draft ICU 57
+ */
+U_DEFINE_LOCAL_OPEN_POINTER(LocalUMultiStringSearchPointer, UMultiStringSearch, usearch_closeMulti);
+
+U_NAMESPACE_END
+
+#endif
+#endif  /* U_HIDE_DRAFT_API */
+
 #ifndef U_HIDE_INTERNAL_API
 /**
   *  Simple forward search for the pattern, starting at a specified index,
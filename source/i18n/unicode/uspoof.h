@@ -132,6 +132,8 @@
  *  a set of identifiers, and then quickly test whether a new identifier is
  *  confusable with an identifier already in the set.  The uspoof_getSkeleton()
  *  family of functions will produce the skeleton from an identifier.
+ *  uspoof_openSkeletonIndexBuilder() and uspoof_openSkeletonIndex() provide
+ *  such a data structure in a form that can be stored and memory-mapped.
  *
  *  Note that skeletons are not guaranteed to be stable between versions 
  *  of Unicode or ICU, so an applications should not rely on creating a permanent,
@@ -975,6 +977,251 @@ uspoof_getSkeletonUnicodeString(const USpoofChecker *sc,
                                 UErrorCode *status);
 #endif   /* U_SHOW_CPLUSPLUS_API */
 
+#ifndef U_HIDE_DRAFT_API
+
+struct USpoofSkeletonIndex;
+/**
+ * A read-only index of identifier skeletons, see uspoof_openSkeletonIndex().
+ * @draft ICU 57
+ */
+typedef struct USpoofSkeletonIndex USpoofSkeletonIndex;
+
+struct USpoofSkeletonIndexBuilder;
+/**
+ * A builder for a USpoofSkeletonIndex, see uspoof_openSkeletonIndexBuilder().
+ * @draft ICU 57
+ */
+typedef struct USpoofSkeletonIndexBuilder USpoofSkeletonIndexBuilder;
+
+/**
+ * Open a builder for a skeleton index.
+ *
+ * A skeleton index answers the question "which of a large set of existing
+ * identifiers are confusable with this one" with a single skeleton computation
+ * and a lookup, rather than with one uspoof_areConfusable() call per
+ * existing identifier.
+ * Each identifier added to the builder is reduced to a 64-bit hash of its skeleton
+ * and stored together with a caller-supplied value, typically a row number or an
+ * ID that refers to the identifier in the caller's own storage.
+ *
+ * The builder serializes the index into a flat, 32-bit-aligned block of memory
+ * that contains no pointers, so that it can be written to a file and later
+ * memory-mapped and shared by multiple processes, see uspoof_openSkeletonIndex().
+ *
+ * @param sc      The USpoofChecker whose confusable data is used for the skeletons.
+ *                The builder uses a clone of it; sc may be closed after this call.
+ * @param type    The type of skeleton, as for uspoof_getSkeleton().
+ *                Allowed options are USPOOF_SINGLE_SCRIPT_CONFUSABLE and
+ *                USPOOF_ANY_CASE.  The two flags may be ORed.
+ * @param status  The error code, set if an error occurred.
+ * @return        The builder. Close it with uspoof_closeSkeletonIndexBuilder().
+ * @see uspoof_getSkeleton
+ * @draft ICU 57
+ */
+U_DRAFT USpoofSkeletonIndexBuilder * U_EXPORT2
+uspoof_openSkeletonIndexBuilder(const USpoofChecker *sc, uint32_t type, UErrorCode *status);
+
+/**
+ * Close a skeleton index builder and release its memory.
+ * @param builder The builder to be closed; may be NULL.
+ * @draft ICU 57
+ */
+U_DRAFT void U_EXPORT2
+uspoof_closeSkeletonIndexBuilder(USpoofSkeletonIndexBuilder *builder);
+
+/**
+ * Add an identifier to a skeleton index.
+ * The same identifier or value may be added more than once.
+ *
+ * @param builder The skeleton index builder.
+ * @param id      The identifier, in UTF-16 format.
+ * @param length  The length of the identifier, expressed in 16 bit
+ *                UTF-16 code units, or -1 if the string is zero terminated.
+ * @param value   The value to be returned by uspoof_findConfusables()
+ *                for identifiers that are confusable with this one.
+ * @param status  The error code, set if an error occurred.
+ * @draft ICU 57
+ */
+U_DRAFT void U_EXPORT2
+uspoof_addToSkeletonIndex(USpoofSkeletonIndexBuilder *builder,
+                          const UChar *id, int32_t length,
+                          int32_t value,
+                          UErrorCode *status);
+
+/**
+ * Add an identifier to a skeleton index.
+ * The same identifier or value may be added more than once.
+ *
+ * @param builder The skeleton index builder.
+ * @param id      The identifier, in UTF-8 format.
+ * @param length  The length of the identifier, in bytes,
+ *                or -1 if the string is zero terminated.
+ * @param value   The value to be returned by uspoof_findConfusables()
+ *                for identifiers that are confusable with this one.
+ * @param status  The error code, set if an error occurred.
+ *                Possible errors include U_INVALID_CHAR_FOUND for invalid
+ *                UTF-8 sequences.
+ * @draft ICU 57
+ */
+U_DRAFT void U_EXPORT2
+uspoof_addToSkeletonIndexUTF8(USpoofSkeletonIndexBuilder *builder,
+                              const char *id, int32_t length,
+                              int32_t value,
+                              UErrorCode *status);
+
+/**
+ * Serialize the skeleton index built so far into a chunk of memory.
+ * The builder is not modified and may continue to be used.
+ *
+ * The serialized form is in the platform's endianness. It must be
+ * opened with uspoof_openSkeletonIndex() using confusable data of the
+ * same version as the data of the checker the index was built with.
+ *
+ * @param builder  The skeleton index builder.
+ * @param data     A pointer to 32-bit-aligned memory to be filled with the index,
+ *                 can be NULL if capacity==0
+ * @param capacity The number of bytes available at data,
+ *                 or 0 for preflighting
+ * @param status   The error code; possible errors include:
+ * - U_BUFFER_OVERFLOW_ERROR if the data storage block is too small
+ * - U_INDEX_OUTOFBOUNDS_ERROR if the index would be larger than 2GB
+ * @return the number of bytes written or needed for the index
+ * @draft ICU 57
+ */
+U_DRAFT int32_t U_EXPORT2
+uspoof_serializeSkeletonIndex(USpoofSkeletonIndexBuilder *builder,
+                              void *data, int32_t capacity,
+                              UErrorCode *status);
+
+/**
+ * Open a skeleton index from its serialized form.
+ * The data is not copied; it must remain valid and unchanged while
+ * the index is open. It may be a read-only, memory-mapped file.
+ *
+ * The index is immutable. It may be used concurrently from multiple threads.
+ *
+ * @param sc      A USpoofChecker with the same confusable data as the one
+ *                the index was built with. The index uses a clone of it;
+ *                sc may be closed after this call.
+ * @param data    A pointer to 32-bit-aligned memory with the serialized index,
+ *                as written by uspoof_serializeSkeletonIndex().
+ * @param length  The number of bytes available at data.
+ * @param status  The error code; possible errors include:
+ * - U_INVALID_FORMAT_ERROR if the data is not a skeleton index
+ *   or was written on a platform with different endianness
+ * - U_INVALID_STATE_ERROR if the index was built with different confusable data
+ * @return        The index. Close it with uspoof_closeSkeletonIndex().
+ * @draft ICU 57
+ */
+U_DRAFT USpoofSkeletonIndex * U_EXPORT2
+uspoof_openSkeletonIndex(const USpoofChecker *sc,
+                         const void *data, int32_t length,
+                         UErrorCode *status);
+
+/**
+ * Close a skeleton index. The serialized data is not released.
+ * @param index The index to be closed; may be NULL.
+ * @draft ICU 57
+ */
+U_DRAFT void U_EXPORT2
+uspoof_closeSkeletonIndex(USpoofSkeletonIndex *index);
+
+/**
+ * Get the number of identifiers in a skeleton index.
+ * @param index The skeleton index.
+ * @return the number of identifiers that were added to the index
+ * @draft ICU 57
+ */
+U_DRAFT int32_t U_EXPORT2
+uspoof_getSkeletonIndexSize(const USpoofSkeletonIndex *index);
+
+/**
+ * Find the identifiers in a skeleton index that are confusable with
+ * the given one, that is, whose skeletons are identical to its skeleton.
+ * The values that were added with those identifiers are returned in ascending order.
+ *
+ * The index compares 64-bit skeleton hashes, so the result may
+ * in extremely rare cases contain an identifier whose skeleton only has the
+ * same hash. If that matters, verify the candidates with uspoof_areConfusable()
+ * or by comparing their skeletons.
+ *
+ * @param index    The skeleton index.
+ * @param id       The identifier, in UTF-16 format.
+ * @param length   The length of the identifier, expressed in 16 bit
+ *                 UTF-16 code units, or -1 if the string is zero terminated.
+ * @param values   The output buffer for the values of the matching identifiers,
+ *                 can be NULL if capacity==0
+ * @param capacity The number of values that fit into the output buffer,
+ *                 or 0 for preflighting
+ * @param status   The error code; set to U_BUFFER_OVERFLOW_ERROR if there are
+ *                 more matches than fit into the output buffer.
+ * @return         The number of matching identifiers, which may be larger than capacity.
+ * @draft ICU 57
+ */
+U_DRAFT int32_t U_EXPORT2
+uspoof_findConfusables(const USpoofSkeletonIndex *index,
+                       const UChar *id, int32_t length,
+                       int32_t *values, int32_t capacity,
+                       UErrorCode *status);
+
+/**
+ * Find the identifiers in a skeleton index that are confusable with
+ * the given one. See uspoof_findConfusables().
+ *
+ * @param index    The skeleton index.
+ * @param id       The identifier, in UTF-8 format.
+ * @param length   The length of the identifier, in bytes,
+ *                 or -1 if the string is zero terminated.
+ * @param values   The output buffer for the values of the matching identifiers,
+ *                 can be NULL if capacity==0
+ * @param capacity The number of values that fit into the output buffer,
+ *                 or 0 for preflighting
+ * @param status   The error code; set to U_BUFFER_OVERFLOW_ERROR if there are
+ *                 more matches than fit into the output buffer, or to
+ *                 U_INVALID_CHAR_FOUND for invalid UTF-8 sequences.
+ * @return         The number of matching identifiers, which may be larger than capacity.
+ * @draft ICU 57
+ */
+U_DRAFT int32_t U_EXPORT2
+uspoof_findConfusablesUTF8(const USpoofSkeletonIndex *index,
+                           const char *id, int32_t length,
+                           int32_t *values, int32_t capacity,
+                           UErrorCode *status);
+
+#if U_SHOW_CPLUSPLUS_API
+
+U_NAMESPACE_BEGIN
+
+/**
+ * \class LocalUSpoofSkeletonIndexBuilderPointer
+ * "Smart pointer" class, closes a USpoofSkeletonIndexBuilder via uspoof_closeSkeletonIndexBuilder().
+ * For most methods see the LocalPointerBase base class.
+ *
+ * @see LocalPointerBase
+ * @see LocalPointer
+ * @draft ICU 57
+ */
+U_DEFINE_LOCAL_OPEN_POINTER(LocalUSpoofSkeletonIndexBuilderPointer,
+                            USpoofSkeletonIndexBuilder, uspoof_closeSkeletonIndexBuilder);
+
+/**
+ * \class LocalUSpoofSkeletonIndexPointer
+ * "Smart pointer" class, closes a USpoofSkeletonIndex via uspoof_closeSkeletonIndex().
+ * For most methods see the LocalPointerBase base class.
+ *
+ * @see LocalPointerBase
+ * @see LocalPointer
+ * @draft ICU 57
+ */
+U_DEFINE_LOCAL_OPEN_POINTER(LocalUSpoofSkeletonIndexPointer,
+                            USpoofSkeletonIndex, uspoof_closeSkeletonIndex);
+
+U_NAMESPACE_END
+
+#endif   /* U_SHOW_CPLUSPLUS_API */
+
+#endif  /* U_HIDE_DRAFT_API */
+
 /**
   * Get the set of Candidate Characters for Inclusion in Identifiers, as defined
   * in Unicode UAX #31, http://www.unicode.org/reports/tr31/#Table_Candidate_Characters_for_Inclusion_in_Identifiers
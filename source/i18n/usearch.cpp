@@ -1,6 +1,6 @@
 /*
 **********************************************************************
-*   Copyright (C) 2001-2015 IBM and others. All rights reserved.
+*   Copyright (C) 2001-2016 IBM and others. All rights reserved.
 **********************************************************************
 *   Date        Name        Description
 *  07/02/2001   synwee      Creation.
@@ -15,9 +15,13 @@
 #include "unicode/ustring.h"
 #include "unicode/uchar.h"
 #include "unicode/utf16.h"
+#include "unicode/tblcoll.h"
+#include "unicode/uniset.h"
+#include "unicode/usetiter.h"
 #include "normalizer2impl.h"
 #include "usrchimp.h"
 #include "cmemory.h"
+#include "uarrsort.h"
 #include "ucln_in.h"
 #include "uassert.h"
 #include "ustr_imp.h"
@@ -93,6 +97,97 @@ inline int hashFromCE32(uint32_t ce)
     return hc;
 }
 
+// skip table -----------------------------------------------------------
+
+// Character classes in USearchSkipTable::classes, one byte per BMP code point.
+// The low bits hold an upper bound for the number of pattern primary weights
+// that the character can contribute to a match.
+#define SKIP_COUNT_MASK_            0x3f
+// The count is not bounded; a run with such a character is always searched.
+#define SKIP_COUNT_UNBOUNDED_       0x3f
+// The character cannot be part of a match and ends a run.
+#define SKIP_BLOCKER_               0x80
+// Only a blocker if the next character is a starter (lccc==0).
+#define SKIP_BLOCKER_BEFORE_STARTER_ 0x40
+// Not classified yet.
+#define SKIP_UNSET_                 0xff
+// Shorter texts are searched without a skip table.
+#define SKIP_MIN_TEXT_LENGTH_       512
+
+/**
+* Per-pattern data for skipping over text that cannot contain a match,
+* see usearch_search().
+*/
+struct USearchSkipTable : public UMemory {
+    const RuleBasedCollator *collator;
+    // code points in contraction and prefix mappings, and those of them
+    // with prefix mappings; owned by the collator
+    const UnicodeSet *contextChars;
+    const UnicodeSet *prefixedChars;
+
+    UBool      isPatternSet;
+    // number of non-zero pattern primary weights; 0 disables skipping
+    int32_t    patternPrimaryCount;
+    // collator settings that the classes were computed with
+    UBool      toShift;
+    uint32_t   variableTop;
+    // bit set of the 16-bit primary weights in the pattern
+    uint32_t   patternPrimaries[0x10000 / 32];
+    // lazily allocated blocks of 256 character classes
+    uint8_t   *classes[0x100];
+
+    USearchSkipTable(const RuleBasedCollator *coll) :
+                         collator(coll), contextChars(NULL), prefixedChars(NULL),
+                         isPatternSet(FALSE), patternPrimaryCount(0),
+                         toShift(FALSE), variableTop(0) {
+        uprv_memset(classes, 0, sizeof(classes));
+    }
+    ~USearchSkipTable() {
+        resetPattern();
+    }
+
+    inline UBool isPatternPrimary(uint32_t primary) const {
+        return (patternPrimaries[primary >> 5] & ((uint32_t)1 << (primary & 0x1f))) != 0;
+    }
+
+    void resetPattern() {
+        for (int32_t i = 0; i < UPRV_LENGTHOF(classes); ++i) {
+            uprv_free(classes[i]);
+            classes[i] = NULL;
+        }
+        isPatternSet = FALSE;
+        patternPrimaryCount = 0;
+    }
+
+    void setPattern(const int64_t *pces, int32_t pcesLength,
+                    UBool shifted, uint32_t varTop) {
+        resetPattern();
+        uprv_memset(patternPrimaries, 0, sizeof(patternPrimaries));
+        for (int32_t i = 0; i < pcesLength; ++i) {
+            uint32_t primary = (uint32_t)(pces[i] >> 48) & 0xffff;
+            if (primary != 0) {
+                patternPrimaries[primary >> 5] |= (uint32_t)1 << (primary & 0x1f);
+                ++patternPrimaryCount;
+            }
+        }
+        toShift = shifted;
+        variableTop = varTop;
+        isPatternSet = TRUE;
+    }
+};
+
+/**
+* Discards the skip table data for the current pattern.
+* @param strsrch string search data
+*/
+static
+inline void resetSkipTable(UStringSearch *strsrch)
+{
+    if (strsrch->skipTable != NULL) {
+        strsrch->skipTable->resetPattern();
+    }
+}
+
 U_CDECL_BEGIN
 static UBool U_CALLCONV
 usearch_cleanup(void) {
@@ -461,6 +556,7 @@ inline int16_t initializePattern(UStringSearch *strsrch, UErrorCode *status)
 
         strsrch->pattern.pces = NULL;
     }
+    resetSkipTable(strsrch);
 
     // since intializePattern is an internal method status is a success.
     return initializePatternCETable(strsrch, status);
@@ -2710,6 +2806,7 @@ U_CAPI UStringSearch * U_EXPORT2 usearch_openFromCollator(
         result->pattern.textLength = patternlength;
         result->pattern.ces         = NULL;
         result->pattern.pces        = NULL;
+        result->skipTable           = NULL;
 
         result->search->breakIter  = breakiter;
 #if !UCONFIG_NO_BREAK_ITERATION
@@ -2762,6 +2859,7 @@ U_CAPI void U_EXPORT2 usearch_close(UStringSearch *strsrch)
             uprv_free(strsrch->pattern.pces);
         }
 
+        delete strsrch->skipTable;
         delete strsrch->textProcessedIter;
         ucol_closeElements(strsrch->textIter);
         ucol_closeElements(strsrch->utilIter);
@@ -3019,6 +3117,8 @@ U_CAPI void U_EXPORT2 usearch_setCollator(      UStringSearch *strsrch,
         }
 
         if (strsrch) {
+            delete strsrch->skipTable;
+            strsrch->skipTable = NULL;
             delete strsrch->textProcessedIter;
             strsrch->textProcessedIter = NULL;
             ucol_closeElements(strsrch->textIter);
@@ -3831,44 +3931,23 @@ UChar32 codePointBefore(const USearch &search, int32_t index) {
 
 }  // namespace
 
-U_CAPI UBool U_EXPORT2 usearch_search(UStringSearch  *strsrch,
-                                       int32_t        startIdx,
-                                       int32_t        *matchStart,
-                                       int32_t        *matchLimit,
-                                       UErrorCode     *status)
+/*
+ * Finds the first match in the text, trying match starts in CE order from
+ * the current position of the text iterator.
+ * Match candidates whose first CE is before minStart are not tried, and the
+ * search stops at the first CE at or after searchLimit.
+ * Sets *atEnd if the search ran out of text, in which case there is no
+ * later match either.
+ */
+static UBool searchFromIterator(UStringSearch  *strsrch,
+                                int32_t        minStart,
+                                int32_t        searchLimit,
+                                int32_t        *matchStart,
+                                int32_t        *matchLimit,
+                                UBool          *atEnd,
+                                UErrorCode     *status)
 {
-    if (U_FAILURE(*status)) {
-        return FALSE;
-    }
-
-    // TODO:  reject search patterns beginning with a combining char.
-
-#ifdef USEARCH_DEBUG
-    if (getenv("USEARCH_DEBUG") != NULL) {
-        printf("Pattern CEs\n");
-        for (int ii=0; ii<strsrch->pattern.cesLength; ii++) {
-            printf(" %8x", strsrch->pattern.ces[ii]);
-        }
-        printf("\n");
-    }
-
-#endif
-    // Input parameter sanity check.
-    //  TODO:  should input indicies clip to the text length
-    //         in the same way that UText does.
-    if(strsrch->pattern.cesLength == 0         ||
-       startIdx < 0                           ||
-       startIdx > strsrch->search->textLength ||
-       strsrch->pattern.ces == NULL) {
-           *status = U_ILLEGAL_ARGUMENT_ERROR;
-           return FALSE;
-    }
-
-    if (strsrch->pattern.pces == NULL) {
-        initializePatternPCETable(strsrch, status);
-    }
-
-    ucol_setOffset(strsrch->textIter, startIdx, status);
+    *atEnd = FALSE;
     CEIBuffer ceb(strsrch, status);
 
 
@@ -3914,6 +3993,14 @@ U_CAPI UBool U_EXPORT2 usearch_search(UStringSearch  *strsrch,
             found = FALSE;
             break;
         }
+        if (firstCEI->lowIndex >= searchLimit) {
+            // The caller searches the rest of the text separately.
+            found = FALSE;
+            break;
+        }
+        if (firstCEI->lowIndex < minStart) {
+            continue;
+        }
         
         for (patIx=0; patIx<strsrch->pattern.pcesLength; patIx++) {
             patCE = strsrch->pattern.pces[patIx];
@@ -3945,6 +4032,7 @@ U_CAPI UBool U_EXPORT2 usearch_search(UStringSearch  *strsrch,
 
         if (!found) {
             // No match at all, we have run off the end of the target text.
+            *atEnd = TRUE;
             break;
         }
 
@@ -4131,6 +4219,350 @@ U_CAPI UBool U_EXPORT2 usearch_search(UStringSearch  *strsrch,
     return found;
 }
 
+//
+//  Skipping over text that cannot contain a match.
+//
+//  searchFromIterator() tries one match start per text CE, so its cost is
+//  proportional to the number of CEs in the text. A Boyer-Moore style shift
+//  over CEs would not help: CEs have to be generated one at a time anyway,
+//  and one character can expand to any number of them. Instead, we classify
+//  text characters by the non-zero primary weights of their CEs, like a
+//  bad-character table, and only generate CEs for the parts of the text
+//  that could hold a match.
+//
+//  A non-zero primary that does not occur in the pattern cannot be part of
+//  a match, with any strength or element comparison type. A character with
+//  such a primary is a "blocker" if its CEs also do not depend on its
+//  context: it is not part of any contraction or prefix mapping, and it
+//  starts and ends a canonical ordering segment (lccc==0, and tccc==0 or the
+//  next character is a starter). Blockers split the text into runs.
+//  A match lies within a single run, and the CEs of a run are the same
+//  whether the text iterator starts in front of it or anywhere before it.
+//  Each run is searched only if its characters can supply at least as many
+//  pattern primaries as the pattern has. A character that starts contractions
+//  is counted with the most pattern primaries of any of them.
+//
+
+/*
+ * Counts the non-zero primary weights of the string that occur in the pattern,
+ * with the same variable weighting as UCollationPCE::processCE().
+ * Sets *hasOtherPrimary if the string has a non-zero primary that is not in
+ * the pattern, and *endsShifted if its CEs end in shifted state.
+ */
+static int32_t countPatternPrimaries(UStringSearch *strsrch,
+                                     const USearchSkipTable *table,
+                                     const UChar *s, int32_t length,
+                                     UBool *hasOtherPrimary,
+                                     UBool *endsShifted,
+                                     UErrorCode *status)
+{
+    UCollationElements *coleiter = strsrch->utilIter;
+    int32_t count = 0;
+    UBool   isShifted = FALSE;
+    int32_t ce;
+
+    *hasOtherPrimary = FALSE;
+    ucol_setText(coleiter, s, length, status);
+    while ((ce = ucol_next(coleiter, status)) != UCOL_NULLORDER &&
+           U_SUCCESS(*status)) {
+        uint32_t primary = ucol_primaryOrder(ce);
+        if (table->toShift && table->variableTop > (uint32_t)ce && primary != 0) {
+            isShifted = TRUE;
+        } else if (primary != 0) {
+            isShifted = FALSE;
+            if (table->isPatternPrimary(primary)) {
+                ++count;
+            } else {
+                *hasOtherPrimary = TRUE;
+            }
+        }
+    }
+    *endsShifted = isShifted;
+    return count;
+}
+
+static inline uint8_t getSkipClass(UStringSearch *strsrch, USearchSkipTable *table,
+                                   UChar c, UErrorCode *status);
+
+/*
+ * Classifies a BMP code unit for the skip table and caches the result.
+ */
+static uint8_t setSkipClass(UStringSearch *strsrch, USearchSkipTable *table,
+                            UChar c, UErrorCode *status)
+{
+    if (U_FAILURE(*status)) {
+        return SKIP_COUNT_UNBOUNDED_;
+    }
+    uint8_t *block = table->classes[c >> 8];
+    if (block == NULL) {
+        block = (uint8_t *)uprv_malloc(0x100);
+        if (block == NULL) {
+            *status = U_MEMORY_ALLOCATION_ERROR;
+            return SKIP_COUNT_UNBOUNDED_;
+        }
+        uprv_memset(block, SKIP_UNSET_, 0x100);
+        table->classes[c >> 8] = block;
+    }
+
+    // Surrogate code units are not classified:
+    // runs with supplementary characters are always searched.
+    // Neither are characters with prefix mappings, whose CEs depend on
+    // the characters before them.
+    uint8_t cls = SKIP_COUNT_UNBOUNDED_;
+    if (!U16_IS_SURROGATE(c) && !table->prefixedChars->contains(c)) {
+        UBool hasOtherPrimary, endsShifted;
+        int32_t count = countPatternPrimaries(strsrch, table, &c, 1,
+                                              &hasOtherPrimary, &endsShifted, status);
+        UBool isContextual = FALSE;
+        if (table->contextChars->contains(c)) {
+            // The character may start or continue a contraction.
+            // Allow for the CEs of the contractions that start with it;
+            // those it continues are counted for their first characters.
+            isContextual = TRUE;
+            UnicodeSet contractions;
+            table->collator->internalAddContractions(c, contractions, *status);
+            UnicodeSetIterator iter(contractions);
+            while (iter.next() && U_SUCCESS(*status)) {
+                if (iter.isString()) {
+                    const UnicodeString &s = iter.getString();
+                    UBool other, shifted;
+                    int32_t contractionCount = countPatternPrimaries(
+                            strsrch, table, s.getBuffer(), s.length(), &other, &shifted, status);
+                    if (count < contractionCount) {
+                        count = contractionCount;
+                    }
+                }
+            }
+        }
+        UnicodeString decomposition;
+        if (strsrch->nfd->getDecomposition(c, decomposition) &&
+                table->contextChars->containsSome(decomposition)) {
+            // The text iterator may decompose the character
+            // and match contractions with its parts.
+            isContextual = TRUE;
+            int32_t sum = 0;
+            for (int32_t i = 0; i < decomposition.length() && sum < SKIP_COUNT_UNBOUNDED_; ++i) {
+                int32_t partCount = getSkipClass(strsrch, table, decomposition.charAt(i), status) &
+                                    SKIP_COUNT_MASK_;
+                sum = partCount == SKIP_COUNT_UNBOUNDED_ ? SKIP_COUNT_UNBOUNDED_ : sum + partCount;
+            }
+            if (count < sum) {
+                count = sum;
+            }
+        }
+        if (count < SKIP_COUNT_UNBOUNDED_) {
+            cls = (uint8_t)count;
+            // A blocker must not leave the PCE iterator in shifted state,
+            // which would drop primary ignorables after it.
+            if (!isContextual && hasOtherPrimary && !endsShifted) {
+                uint16_t fcd16 = g_nfcImpl->getFCD16(c);
+                if (fcd16 <= 0xff) {
+                    cls |= SKIP_BLOCKER_;
+                    if (fcd16 != 0) {
+                        cls |= SKIP_BLOCKER_BEFORE_STARTER_;
+                    }
+                }
+            }
+        }
+    }
+    if (U_FAILURE(*status)) {
+        return SKIP_COUNT_UNBOUNDED_;
+    }
+    block[c & 0xff] = cls;
+    return cls;
+}
+
+static inline uint8_t getSkipClass(UStringSearch *strsrch, USearchSkipTable *table,
+                                   UChar c, UErrorCode *status)
+{
+    const uint8_t *block = table->classes[c >> 8];
+    if (block != NULL && block[c & 0xff] != SKIP_UNSET_) {
+        return block[c & 0xff];
+    }
+    return setSkipClass(strsrch, table, c, status);
+}
+
+/*
+ * Returns the skip table for the current pattern, creating or updating it
+ * as necessary, or NULL if the pattern cannot use one.
+ */
+static USearchSkipTable *getSkipTable(UStringSearch *strsrch, UErrorCode *status)
+{
+    if (U_FAILURE(*status) || strsrch->utilIter == NULL) {
+        return NULL;
+    }
+    const UCollator *coll = strsrch->collator;
+    // Digit substrings collate by their numeric value,
+    // which does not fit a per-character classification.
+    if (ucol_getAttribute(coll, UCOL_NUMERIC_COLLATION, status) == UCOL_ON) {
+        return NULL;
+    }
+
+    USearchSkipTable *table = strsrch->skipTable;
+    if (table == NULL) {
+        const RuleBasedCollator *rbc = RuleBasedCollator::rbcFromUCollator(coll);
+        if (rbc == NULL) {
+            return NULL;
+        }
+        table = new USearchSkipTable(rbc);
+        if (table == NULL) {
+            *status = U_MEMORY_ALLOCATION_ERROR;
+            return NULL;
+        }
+        rbc->internalGetContextChars(table->contextChars, table->prefixedChars, *status);
+        if (U_FAILURE(*status)) {
+            delete table;
+            return NULL;
+        }
+        strsrch->skipTable = table;
+    }
+
+    // The PCE iterator reads the variable weighting from the collator,
+    // so the classes must follow changes that bypass usearch_reset().
+    UBool    toShift     = ucol_getAttribute(coll, UCOL_ALTERNATE_HANDLING, status) ==
+                                                                UCOL_SHIFTED;
+    uint32_t variableTop = ucol_getVariableTop(coll, status);
+    if (U_FAILURE(*status)) {
+        return NULL;
+    }
+    if (!table->isPatternSet || table->toShift != toShift ||
+            table->variableTop != variableTop) {
+        table->setPattern(strsrch->pattern.pces, strsrch->pattern.pcesLength,
+                          toShift, variableTop);
+    }
+    return table->patternPrimaryCount > 0 ? table : NULL;
+}
+
+/*
+ * Finds the first match like searchFromIterator(), but only searches the
+ * runs of text between blockers that can hold a match.
+ * The text iterator must be set to the start of the search.
+ */
+static UBool searchSkipping(UStringSearch    *strsrch,
+                            USearchSkipTable *table,
+                            int32_t          *matchStart,
+                            int32_t          *matchLimit,
+                            UErrorCode       *status)
+{
+    const UChar *text       = strsrch->search->text;
+          int32_t textLength = strsrch->search->textLength;
+          int32_t required   = table->patternPrimaryCount;
+    // ucol_setOffset() may have backed up over unsafe characters.
+          int32_t runStart   = ucol_getOffset(strsrch->textIter);
+          int32_t minStart   = 0;
+          int32_t i          = runStart;
+
+    for (;;) {
+        // Find the end of the run, and add up the pattern primaries in it.
+        int32_t count = 0;
+        for (; i < textLength; ++i) {
+            uint8_t cls = getSkipClass(strsrch, table, text[i], status);
+            if ((cls & SKIP_BLOCKER_) != 0) {
+                if ((cls & SKIP_BLOCKER_BEFORE_STARTER_) == 0 || i + 1 == textLength) {
+                    break;
+                }
+                int32_t next = i + 1;
+                UChar32 c;
+                U16_NEXT(text, next, textLength, c);
+                if (g_nfcImpl->getFCD16(c) <= 0xff) {
+                    break;
+                }
+            }
+            if (count < required) {
+                count += cls & SKIP_COUNT_MASK_;
+            }
+        }
+        if (U_FAILURE(*status)) {
+            return FALSE;
+        }
+        int32_t runLimit = i;
+
+        if (count >= required) {
+            if (minStart != 0) {
+                // Not the first run: restart the iterator after the blocker.
+                ucol_setOffset(strsrch->textIter, runStart, status);
+            }
+            UBool atEnd;
+            if (searchFromIterator(strsrch, minStart,
+                                   runLimit < textLength ? runLimit : textLength + 1,
+                                   matchStart, matchLimit, &atEnd, status)) {
+                return TRUE;
+            }
+            if (atEnd || U_FAILURE(*status)) {
+                return FALSE;
+            }
+        }
+        if (runLimit == textLength) {
+            break;
+        }
+        // Continue after the blocker.
+        i = runStart = minStart = runLimit + 1;
+    }
+
+    if (matchStart != NULL) {
+        *matchStart = -1;
+    }
+    if (matchLimit != NULL) {
+        *matchLimit = -1;
+    }
+    return FALSE;
+}
+
+U_CAPI UBool U_EXPORT2 usearch_search(UStringSearch  *strsrch,
+                                       int32_t        startIdx,
+                                       int32_t        *matchStart,
+                                       int32_t        *matchLimit,
+                                       UErrorCode     *status)
+{
+    if (U_FAILURE(*status)) {
+        return FALSE;
+    }
+
+    // TODO:  reject search patterns beginning with a combining char.
+
+#ifdef USEARCH_DEBUG
+    if (getenv("USEARCH_DEBUG") != NULL) {
+        printf("Pattern CEs\n");
+        for (int ii=0; ii<strsrch->pattern.cesLength; ii++) {
+            printf(" %8x", strsrch->pattern.ces[ii]);
+        }
+        printf("\n");
+    }
+
+#endif
+    // Input parameter sanity check.
+    //  TODO:  should input indicies clip to the text length
+    //         in the same way that UText does.
+    if(strsrch->pattern.cesLength == 0         ||
+       startIdx < 0                           ||
+       startIdx > strsrch->search->textLength ||
+       strsrch->pattern.ces == NULL) {
+           *status = U_ILLEGAL_ARGUMENT_ERROR;
+           return FALSE;
+    }
+
+    if (strsrch->pattern.pces == NULL) {
+        initializePatternPCETable(strsrch, status);
+    }
+
+    ucol_setOffset(strsrch->textIter, startIdx, status);
+
+    // Classifying the text characters costs more than searching short texts.
+    USearchSkipTable *skipTable = NULL;
+    if (strsrch->search->textLength - startIdx >= SKIP_MIN_TEXT_LENGTH_) {
+        skipTable = getSkipTable(strsrch, status);
+        if (U_FAILURE(*status)) {
+            return FALSE;
+        }
+    }
+    if (skipTable != NULL) {
+        return searchSkipping(strsrch, skipTable, matchStart, matchLimit, status);
+    }
+    UBool atEnd;
+    return searchFromIterator(strsrch, 0, strsrch->search->textLength + 1,
+                              matchStart, matchLimit, &atEnd, status);
+}
+
 U_CAPI UBool U_EXPORT2 usearch_searchBackwards(UStringSearch  *strsrch,
                                                 int32_t        startIdx,
                                                 int32_t        *matchStart,
@@ -4943,4 +5375,638 @@ UBool usearch_handlePreviousCanonical(UStringSearch *strsrch,
 #endif
 }
 
+// multiple pattern search -----------------------------------------------
+
+//
+//  usearch_nextMulti() makes one pass over the processed CEs of the text for
+//  all patterns. With the standard element comparison, the upper 32 bits
+//  (the primary and secondary weights) of each text CE must equal those of
+//  the pattern CE that it matches. The sequences of these "keys", for the
+//  pattern CEs with non-zero primary weights, go into an Aho-Corasick
+//  automaton that finds all of them in the text in a single pass.
+//  Each time it finds a pattern's keys, that pattern's own UStringSearch
+//  checks for a match starting at the CE where the pattern would start,
+//  which yields the same matches as usearch_next().
+//
+//  A collation element iterator keeps its own copy of the text, so the
+//  pattern searches are opened with their patterns as text. For a check,
+//  they borrow the text state of a single search over the text.
+//
+
+struct MultiTextCE {
+    int64_t ce;
+    int32_t lowIndex;
+};
+
+struct UMultiStringSearch : public UMemory {
+    const UCollator     *collator;
+    int32_t              patternCount;
+    LocalMemory<UStringSearch *> searches;
+    // search over the text, for the text state that the pattern searches borrow
+    UStringSearch       *textSearch;
+    // per pattern: number of CEs before the first one with a non-zero primary
+    LocalMemory<int32_t> leads;
+    // per pattern: next pattern with the same keys, or -1
+    LocalMemory<int32_t> nextSamePattern;
+    // per pattern: text index where the next match may start
+    LocalMemory<int32_t> minStarts;
+
+    // Automaton nodes; node 0 is the root.
+    int32_t              nodeCount;
+    LocalMemory<int32_t> nodeDepths;
+    LocalMemory<int32_t> nodeFailures;
+    // first pattern whose keys end at the node, or -1
+    LocalMemory<int32_t> nodeOutputs;
+    // nearest node with an output along the failure links, or 0
+    LocalMemory<int32_t> nodeDictLinks;
+    // edges out of node n are edgeStarts[n]..edgeStarts[n+1]-1, sorted by key
+    LocalMemory<int32_t> edgeStarts;
+    LocalMemory<uint32_t> edgeKeys;
+    LocalMemory<int32_t> edgeTargets;
+    // open addressing hash table of the edges out of the root,
+    // which is where most transitions start; a key of 0 marks an empty slot
+    LocalMemory<uint32_t> rootKeys;
+    LocalMemory<int32_t> rootTargets;
+    int32_t              rootShift;
+    int32_t              maxDepth;
+    int32_t              maxLead;
+
+    // Text iteration state.
+    UCollationElements  *textIter;
+    UCollationPCE       *textPCE;
+    UBool                atEnd;
+    int32_t              state;
+    // number of text CEs, and of those with non-zero primaries, so far
+    int32_t              pceCount;
+    int32_t              primaryCount;
+    // CE indexes of the last recentMask+1 >= maxDepth CEs with non-zero primaries
+    LocalMemory<int32_t> recentPrimaries;
+    int32_t              recentMask;
+    // the text CEs from textCEsBase to pceCount-1
+    MaybeStackArray<MultiTextCE, 64> textCEs;
+    int32_t              textCEsBase;
+    // verified matches that have not been returned yet, as
+    // (pattern index, start, limit) triples
+    MaybeStackArray<int32_t, 3 * 8> pending;
+    int32_t              pendingStart;
+    int32_t              pendingLength;
+
+    UMultiStringSearch() :
+            collator(NULL), patternCount(0), textSearch(NULL), nodeCount(0), rootShift(31),
+            maxDepth(0), maxLead(0), textIter(NULL), textPCE(NULL), recentMask(0) {
+        reset();
+    }
+    ~UMultiStringSearch() {
+        if (searches.isValid()) {
+            for (int32_t i = 0; i < patternCount; ++i) {
+                usearch_close(searches[i]);
+            }
+        }
+        usearch_close(textSearch);
+        delete textPCE;
+        ucol_closeElements(textIter);
+    }
+
+    void reset() {
+        atEnd = FALSE;
+        state = 0;
+        pceCount = primaryCount = 0;
+        textCEsBase = 0;
+        pendingStart = pendingLength = 0;
+    }
+
+    inline int32_t getChild(int32_t node, uint32_t key) const {
+        if (node == 0) {
+            uint32_t mask = ((uint32_t)1 << (32 - rootShift)) - 1;
+            for (uint32_t slot = (key * 0x9e3779b1) >> rootShift;; slot = (slot + 1) & mask) {
+                if (rootKeys[slot] == key) {
+                    return rootTargets[slot];
+                } else if (rootKeys[slot] == 0) {
+                    return -1;
+                }
+            }
+        }
+        int32_t start = edgeStarts[node];
+        int32_t limit = edgeStarts[node + 1];
+        while (start < limit) {
+            int32_t mid = (start + limit) / 2;
+            if (key < edgeKeys[mid]) {
+                limit = mid;
+            } else if (key > edgeKeys[mid]) {
+                start = mid + 1;
+            } else {
+                return edgeTargets[mid];
+            }
+        }
+        return -1;
+    }
+};
+
+namespace {
+
+struct MultiPatternKeys {
+    const int32_t  *starts;
+    const uint32_t *keys;
+};
+
+int32_t U_CALLCONV
+compareMultiPatternKeys(const void *context, const void *left, const void *right) {
+    const MultiPatternKeys *pk = (const MultiPatternKeys *)context;
+    int32_t l = *(const int32_t *)left;
+    int32_t r = *(const int32_t *)right;
+    int32_t lLength = pk->starts[l + 1] - pk->starts[l];
+    int32_t rLength = pk->starts[r + 1] - pk->starts[r];
+    const uint32_t *lKeys = pk->keys + pk->starts[l];
+    const uint32_t *rKeys = pk->keys + pk->starts[r];
+    for (int32_t i = 0; i < lLength && i < rLength; ++i) {
+        if (lKeys[i] != rKeys[i]) {
+            return lKeys[i] < rKeys[i] ? -1 : 1;
+        }
+    }
+    return lLength - rLength;
+}
+
+}
+
+/*
+ * Builds the automaton from the keys of the patterns.
+ * keyStarts[p]..keyStarts[p+1]-1 are the indexes of pattern p's keys.
+ */
+static void buildMultiAutomaton(UMultiStringSearch *ms,
+                                const int32_t *keyStarts, const uint32_t *keys,
+                                UErrorCode *status)
+{
+    int32_t patternCount = ms->patternCount;
+    int32_t keyCount     = keyStarts[patternCount];
+    int32_t nodeCapacity = keyCount + 1;
+    LocalMemory<int32_t> order((int32_t *)uprv_malloc(patternCount * sizeof(int32_t)));
+    LocalMemory<int32_t> path((int32_t *)uprv_malloc(nodeCapacity * sizeof(int32_t)));
+    // edges in the order of creation, and their source nodes
+    LocalMemory<int32_t> edgeSources((int32_t *)uprv_malloc(keyCount * sizeof(int32_t)));
+    LocalMemory<uint32_t> unsortedKeys((uint32_t *)uprv_malloc(keyCount * sizeof(uint32_t)));
+    ms->nodeDepths.adoptInstead((int32_t *)uprv_malloc(nodeCapacity * sizeof(int32_t)));
+    ms->nodeFailures.adoptInstead((int32_t *)uprv_malloc(nodeCapacity * sizeof(int32_t)));
+    ms->nodeOutputs.adoptInstead((int32_t *)uprv_malloc(nodeCapacity * sizeof(int32_t)));
+    ms->nodeDictLinks.adoptInstead((int32_t *)uprv_malloc(nodeCapacity * sizeof(int32_t)));
+    ms->edgeStarts.adoptInstead((int32_t *)uprv_malloc((nodeCapacity + 1) * sizeof(int32_t)));
+    ms->edgeKeys.adoptInstead((uint32_t *)uprv_malloc(nodeCapacity * sizeof(uint32_t)));
+    ms->edgeTargets.adoptInstead((int32_t *)uprv_malloc(nodeCapacity * sizeof(int32_t)));
+    if (order.isNull() || path.isNull() || edgeSources.isNull() || unsortedKeys.isNull() ||
+            ms->nodeDepths.isNull() || ms->nodeFailures.isNull() ||
+            ms->nodeOutputs.isNull() || ms->nodeDictLinks.isNull() ||
+            ms->edgeStarts.isNull() || ms->edgeKeys.isNull() || ms->edgeTargets.isNull()) {
+        *status = U_MEMORY_ALLOCATION_ERROR;
+        return;
+    }
+
+    // Insert the patterns in the order of their keys, so that the edges
+    // out of each node are created in key order, and a pattern shares the
+    // nodes of its common prefix with the previous one.
+    for (int32_t p = 0; p < patternCount; ++p) {
+        order[p] = p;
+    }
+    MultiPatternKeys pk = { keyStarts, keys };
+    uprv_sortArray(order.getAlias(), patternCount, sizeof(int32_t),
+                   compareMultiPatternKeys, &pk, FALSE, status);
+    if (U_FAILURE(*status)) {
+        return;
+    }
+    int32_t nodeCount = 1;
+    ms->nodeDepths[0]  = 0;
+    ms->nodeOutputs[0] = -1;
+    path[0] = 0;
+    int32_t previous = -1;
+    for (int32_t i = 0; i < patternCount; ++i) {
+        int32_t p = order[i];
+        int32_t length = keyStarts[p + 1] - keyStarts[p];
+        const uint32_t *pKeys = keys + keyStarts[p];
+        int32_t common = 0;
+        if (previous >= 0) {
+            int32_t previousLength = keyStarts[previous + 1] - keyStarts[previous];
+            const uint32_t *previousKeys = keys + keyStarts[previous];
+            while (common < length && common < previousLength &&
+                    pKeys[common] == previousKeys[common]) {
+                ++common;
+            }
+        }
+        for (int32_t d = common; d < length; ++d) {
+            int32_t node = nodeCount++;
+            ms->nodeDepths[node]  = d + 1;
+            ms->nodeOutputs[node] = -1;
+            edgeSources[node - 1]  = path[d];
+            unsortedKeys[node - 1] = pKeys[d];
+            path[d + 1] = node;
+        }
+        int32_t node = path[length];
+        ms->nextSamePattern[p] = ms->nodeOutputs[node];
+        ms->nodeOutputs[node]  = p;
+        if (ms->maxDepth < length) {
+            ms->maxDepth = length;
+        }
+        previous = p;
+    }
+    ms->nodeCount = nodeCount;
+
+    // Group the edges by source node, keeping their key order.
+    // The edge into node n was created as edge n-1.
+    int32_t *edgeStarts = ms->edgeStarts.getAlias();
+    uprv_memset(edgeStarts, 0, (nodeCount + 1) * sizeof(int32_t));
+    for (int32_t e = 0; e < nodeCount - 1; ++e) {
+        ++edgeStarts[edgeSources[e] + 1];
+    }
+    for (int32_t n = 0; n < nodeCount; ++n) {
+        edgeStarts[n + 1] += edgeStarts[n];
+    }
+    for (int32_t e = 0; e < nodeCount - 1; ++e) {
+        // path[] is reused as the fill level of each node's edges.
+        path[edgeSources[e]] = 0;
+    }
+    for (int32_t e = 0; e < nodeCount - 1; ++e) {
+        int32_t source = edgeSources[e];
+        int32_t index = edgeStarts[source] + path[source]++;
+        ms->edgeKeys[index]    = unsortedKeys[e];
+        ms->edgeTargets[index] = e + 1;
+    }
+
+    // Hash the root edges into a table that is at most half full.
+    int32_t rootEdgeCount = edgeStarts[1];
+    int32_t rootBits = 1;
+    while ((1 << rootBits) < 2 * rootEdgeCount) {
+        ++rootBits;
+    }
+    ms->rootShift = 32 - rootBits;
+    ms->rootKeys.adoptInstead((uint32_t *)uprv_malloc(sizeof(uint32_t) << rootBits));
+    ms->rootTargets.adoptInstead((int32_t *)uprv_malloc(sizeof(int32_t) << rootBits));
+    if (ms->rootKeys.isNull() || ms->rootTargets.isNull()) {
+        *status = U_MEMORY_ALLOCATION_ERROR;
+        return;
+    }
+    uprv_memset(ms->rootKeys.getAlias(), 0, sizeof(uint32_t) << rootBits);
+    for (int32_t e = 0; e < rootEdgeCount; ++e) {
+        uint32_t key = ms->edgeKeys[e];
+        uint32_t slot = (key * 0x9e3779b1) >> ms->rootShift;
+        while (ms->rootKeys[slot] != 0) {
+            slot = (slot + 1) & ((1 << rootBits) - 1);
+        }
+        ms->rootKeys[slot]    = key;
+        ms->rootTargets[slot] = ms->edgeTargets[e];
+    }
+
+    // Set the failure and dictionary links in breadth-first order.
+    // Nodes at one depth do not depend on each other, and the
+    // queue of nodes is reused from path[].
+    int32_t *queue = path.getAlias();
+    int32_t queueStart = 0, queueLimit = 0;
+    ms->nodeFailures[0]  = 0;
+    ms->nodeDictLinks[0] = 0;
+    queue[queueLimit++] = 0;
+    while (queueStart < queueLimit) {
+        int32_t node = queue[queueStart++];
+        for (int32_t e = edgeStarts[node]; e < edgeStarts[node + 1]; ++e) {
+            int32_t child = ms->edgeTargets[e];
+            int32_t failure = 0;
+            if (node != 0) {
+                int32_t f = ms->nodeFailures[node];
+                for (;;) {
+                    int32_t next = ms->getChild(f, ms->edgeKeys[e]);
+                    if (next >= 0) {
+                        failure = next;
+                        break;
+                    }
+                    if (f == 0) {
+                        break;
+                    }
+                    f = ms->nodeFailures[f];
+                }
+            }
+            ms->nodeFailures[child]  = failure;
+            ms->nodeDictLinks[child] = ms->nodeOutputs[failure] >= 0 ?
+                                           failure : ms->nodeDictLinks[failure];
+            queue[queueLimit++] = child;
+        }
+    }
+}
+
+/*
+ * Checks for a match of pattern p at the text index where the automaton
+ * found its keys, and queues it.
+ */
+static void verifyMultiCandidate(UMultiStringSearch *ms, int32_t p, int32_t start,
+                                 UErrorCode *status)
+{
+    // Matches of one pattern do not overlap, as with usearch_next().
+    if (start < ms->minStarts[p]) {
+        return;
+    }
+    UStringSearch      *strsrch           = ms->searches[p];
+    UStringSearch      *textSearch        = ms->textSearch;
+    USearch            *search            = strsrch->search;
+    UCollationElements *textIter          = strsrch->textIter;
+    UCollationPCE      *textProcessedIter = strsrch->textProcessedIter;
+    strsrch->search            = textSearch->search;
+    strsrch->textIter          = textSearch->textIter;
+    strsrch->textProcessedIter = textSearch->textProcessedIter;
+    ucol_setOffset(strsrch->textIter, start, status);
+    int32_t mStart, mLimit;
+    UBool   atEnd;
+    UBool   found = searchFromIterator(strsrch, start, start + 1,
+                                       &mStart, &mLimit, &atEnd, status);
+    // The PCE iterator is created on first use.
+    textSearch->textProcessedIter = strsrch->textProcessedIter;
+    strsrch->search            = search;
+    strsrch->textIter          = textIter;
+    strsrch->textProcessedIter = textProcessedIter;
+    if (!found) {
+        return;
+    }
+    ms->minStarts[p] = mLimit;
+    int32_t length = 3 * ms->pendingLength;
+    if (length + 3 > ms->pending.getCapacity() &&
+            ms->pending.resize(2 * ms->pending.getCapacity(), length) == NULL) {
+        *status = U_MEMORY_ALLOCATION_ERROR;
+        return;
+    }
+    ms->pending[length]     = p;
+    ms->pending[length + 1] = mStart;
+    ms->pending[length + 2] = mLimit;
+    ++ms->pendingLength;
+}
+
+/*
+ * Appends the next text CE,
+ * dropping the ones that no candidate can start at any more.
+ */
+static void appendMultiTextCE(UMultiStringSearch *ms, int64_t ce, int32_t lowIndex,
+                              UErrorCode *status)
+{
+    int32_t length = ms->pceCount - ms->textCEsBase;
+    if (length == ms->textCEs.getCapacity()) {
+        // The next candidate starts at most maxLead CEs before the
+        // CE of the (maxDepth-1)-th primary before the current one.
+        int32_t keep = ms->primaryCount - (ms->maxDepth - 1);
+        int32_t newBase = ms->textCEsBase;
+        if (keep == ms->primaryCount) {
+            // Only the CE being appended can start a pattern's keys.
+            newBase = ms->pceCount - ms->maxLead;
+        } else if (keep >= 0) {
+            newBase = ms->recentPrimaries[keep & ms->recentMask] - ms->maxLead;
+        }
+        if (newBase < ms->textCEsBase) {
+            newBase = ms->textCEsBase;
+        }
+        MultiTextCE *textCEs = ms->textCEs.getAlias();
+        length -= newBase - ms->textCEsBase;
+        uprv_memmove(textCEs, textCEs + (newBase - ms->textCEsBase),
+                     length * sizeof(MultiTextCE));
+        ms->textCEsBase = newBase;
+        if (2 * length > ms->textCEs.getCapacity() &&
+                ms->textCEs.resize(2 * ms->textCEs.getCapacity(), length) == NULL) {
+            *status = U_MEMORY_ALLOCATION_ERROR;
+            return;
+        }
+    }
+    ms->textCEs[length].ce       = ce;
+    ms->textCEs[length].lowIndex = lowIndex;
+    ++ms->pceCount;
+}
+
+U_CAPI UMultiStringSearch * U_EXPORT2
+usearch_openMulti(const UChar * const *patterns,
+                  const int32_t       *patternLengths,
+                  int32_t              patternCount,
+                  const UChar         *text,
+                  int32_t              textLength,
+                  const UCollator     *collator,
+                  UErrorCode          *status)
+{
+    if (U_FAILURE(*status)) {
+        return NULL;
+    }
+    if (patterns == NULL || patternLengths == NULL || patternCount <= 0 ||
+            text == NULL || collator == NULL) {
+        *status = U_ILLEGAL_ARGUMENT_ERROR;
+        return NULL;
+    }
+    LocalPointer<UMultiStringSearch> ms(new UMultiStringSearch(), *status);
+    if (U_FAILURE(*status)) {
+        return NULL;
+    }
+    ms->collator = collator;
+    ms->searches.adoptInstead(
+        (UStringSearch **)uprv_malloc(patternCount * sizeof(UStringSearch *)));
+    ms->leads.adoptInstead((int32_t *)uprv_malloc(patternCount * sizeof(int32_t)));
+    ms->nextSamePattern.adoptInstead((int32_t *)uprv_malloc(patternCount * sizeof(int32_t)));
+    ms->minStarts.adoptInstead((int32_t *)uprv_malloc(patternCount * sizeof(int32_t)));
+    LocalMemory<int32_t> keyStarts((int32_t *)uprv_malloc((patternCount + 1) * sizeof(int32_t)));
+    if (ms->searches.isNull() || ms->leads.isNull() || ms->nextSamePattern.isNull() ||
+            ms->minStarts.isNull() || keyStarts.isNull()) {
+        *status = U_MEMORY_ALLOCATION_ERROR;
+        return NULL;
+    }
+
+    // Open a search for each pattern, and collect the pattern keys.
+    MaybeStackArray<uint32_t, 256> keys;
+    int32_t keyCount = 0;
+    for (int32_t p = 0; p < patternCount; ++p) {
+        ms->searches[p] = usearch_openFromCollator(patterns[p], patternLengths[p],
+                                                   patterns[p], patternLengths[p],
+                                                   collator, NULL, status);
+        ms->patternCount = p + 1;
+        if (U_FAILURE(*status)) {
+            return NULL;
+        }
+        UStringSearch *strsrch = ms->searches[p];
+        initializePatternPCETable(strsrch, status);
+        if (U_FAILURE(*status)) {
+            return NULL;
+        }
+        const int64_t *pces       = strsrch->pattern.pces;
+        int32_t        pcesLength = strsrch->pattern.pcesLength;
+        keyStarts[p] = keyCount;
+        ms->leads[p] = -1;
+        for (int32_t i = 0; i < pcesLength; ++i) {
+            if ((pces[i] >> 48) == 0) {
+                continue;
+            }
+            if (ms->leads[p] < 0) {
+                ms->leads[p] = i;
+            }
+            if (keyCount == keys.getCapacity() &&
+                    keys.resize(2 * keyCount, keyCount) == NULL) {
+                *status = U_MEMORY_ALLOCATION_ERROR;
+                return NULL;
+            }
+            keys[keyCount++] = (uint32_t)(pces[i] >> 32);
+        }
+        if (ms->leads[p] < 0) {
+            // Without a primary weight, the automaton cannot find the pattern.
+            *status = U_ILLEGAL_ARGUMENT_ERROR;
+            return NULL;
+        }
+        if (ms->maxLead < ms->leads[p]) {
+            ms->maxLead = ms->leads[p];
+        }
+    }
+    keyStarts[patternCount] = keyCount;
+    ms->textSearch = usearch_openFromCollator(patterns[0], patternLengths[0],
+                                              text, textLength, collator, NULL, status);
+    if (U_FAILURE(*status)) {
+        return NULL;
+    }
+
+    buildMultiAutomaton(ms.getAlias(), keyStarts.getAlias(), keys.getAlias(), status);
+    int32_t recentCapacity = 1;
+    while (recentCapacity < ms->maxDepth) {
+        recentCapacity *= 2;
+    }
+    ms->recentMask = recentCapacity - 1;
+    ms->recentPrimaries.adoptInstead((int32_t *)uprv_malloc(recentCapacity * sizeof(int32_t)));
+    if (U_SUCCESS(*status) && ms->recentPrimaries.isNull()) {
+        *status = U_MEMORY_ALLOCATION_ERROR;
+    }
+    usearch_setMultiText(ms.getAlias(), text, textLength, status);
+    if (U_FAILURE(*status)) {
+        return NULL;
+    }
+    return ms.orphan();
+}
+
+U_CAPI void U_EXPORT2
+usearch_closeMulti(UMultiStringSearch *ms)
+{
+    delete ms;
+}
+
+U_CAPI void U_EXPORT2
+usearch_setMultiText(UMultiStringSearch *ms,
+                     const UChar        *text,
+                     int32_t             textLength,
+                     UErrorCode         *status)
+{
+    if (U_FAILURE(*status)) {
+        return;
+    }
+    if (ms == NULL || text == NULL || textLength < -1 || textLength == 0) {
+        *status = U_ILLEGAL_ARGUMENT_ERROR;
+        return;
+    }
+    if (textLength == -1) {
+        textLength = u_strlen(text);
+    }
+    if (ms->textIter == NULL) {
+        ms->textIter = ucol_openElements(ms->collator, text, textLength, status);
+        if (U_FAILURE(*status)) {
+            return;
+        }
+        ms->textPCE = new UCollationPCE(ms->textIter);
+        if (ms->textPCE == NULL) {
+            *status = U_MEMORY_ALLOCATION_ERROR;
+            return;
+        }
+    } else {
+        ucol_setText(ms->textIter, text, textLength, status);
+        ms->textPCE->init(ms->textIter);
+    }
+    usearch_setText(ms->textSearch, text, textLength, status);
+    for (int32_t p = 0; p < ms->patternCount; ++p) {
+        ms->minStarts[p] = 0;
+    }
+    ms->reset();
+}
+
+U_CAPI UBool U_EXPORT2
+usearch_nextMulti(UMultiStringSearch *ms,
+                  int32_t            *patternIndex,
+                  int32_t            *matchStart,
+                  int32_t            *matchLimit,
+                  UErrorCode         *status)
+{
+    if (U_SUCCESS(*status) && ms == NULL) {
+        *status = U_ILLEGAL_ARGUMENT_ERROR;
+    }
+    while (U_SUCCESS(*status)) {
+        if (ms->pendingStart < ms->pendingLength) {
+            const int32_t *match = ms->pending.getAlias() + 3 * ms->pendingStart++;
+            if (patternIndex != NULL) {
+                *patternIndex = match[0];
+            }
+            if (matchStart != NULL) {
+                *matchStart = match[1];
+            }
+            if (matchLimit != NULL) {
+                *matchLimit = match[2];
+            }
+            return TRUE;
+        }
+        ms->pendingStart = ms->pendingLength = 0;
+        if (ms->atEnd) {
+            break;
+        }
+
+        int32_t low;
+        int64_t pce = ms->textPCE->nextProcessed(&low, NULL, status);
+        if (pce == UCOL_PROCESSED_NULLORDER || U_FAILURE(*status)) {
+            ms->atEnd = TRUE;
+            continue;
+        }
+        appendMultiTextCE(ms, pce, low, status);
+        if ((pce >> 48) == 0 || U_FAILURE(*status)) {
+            continue;
+        }
+        ms->recentPrimaries[ms->primaryCount++ & ms->recentMask] = ms->pceCount - 1;
+
+        // Advance the automaton.
+        uint32_t key   = (uint32_t)(pce >> 32);
+        int32_t  state = ms->state;
+        for (;;) {
+            int32_t next = ms->getChild(state, key);
+            if (next >= 0) {
+                state = next;
+                break;
+            }
+            if (state == 0) {
+                break;
+            }
+            state = ms->nodeFailures[state];
+        }
+        ms->state = state;
+
+        // Verify the patterns whose keys end here.
+        int32_t node = ms->nodeOutputs[state] >= 0 ? state : ms->nodeDictLinks[state];
+        for (; node != 0; node = ms->nodeDictLinks[node]) {
+            int32_t firstPrimary = ms->primaryCount - ms->nodeDepths[node];
+            int32_t firstIndex   = ms->recentPrimaries[firstPrimary & ms->recentMask];
+            for (int32_t p = ms->nodeOutputs[node]; p >= 0; p = ms->nextSamePattern[p]) {
+                int32_t index = firstIndex - ms->leads[p];
+                if (index < ms->textCEsBase) {
+                    continue;
+                }
+                // The CEs before the first primary must match as well. Check them here:
+                // after the restart at the candidate start, the first CE may differ
+                // from the one in a pass over the whole text.
+                const MultiTextCE *textCE = ms->textCEs.getAlias() + (index - ms->textCEsBase);
+                const int64_t *pces = ms->searches[p]->pattern.pces;
+                int32_t k = 0;
+                while (k < ms->leads[p] && textCE[k].ce == pces[k]) {
+                    ++k;
+                }
+                if (k == ms->leads[p]) {
+                    verifyMultiCandidate(ms, p, textCE->lowIndex, status);
+                }
+            }
+        }
+    }
+
+    if (patternIndex != NULL) {
+        *patternIndex = -1;
+    }
+    if (matchStart != NULL) {
+        *matchStart = -1;
+    }
+    if (matchLimit != NULL) {
+        *matchLimit = -1;
+    }
+    return FALSE;
+}
+
 #endif /* #if !UCONFIG_NO_COLLATION */
@@ -1,6 +1,6 @@
 /*
 ***************************************************************************
-* Copyright (C) 2008-2015, International Business Machines Corporation
+* Copyright (C) 2008-2016, International Business Machines Corporation
 * and others. All Rights Reserved.
 ***************************************************************************
 *   file name:  uspoof.cpp
@@ -25,6 +25,7 @@
 #include "scriptset.h"
 #include "uassert.h"
 #include "ucln_in.h"
+#include "ustr_imp.h"
 #include "uspoof_impl.h"
 #include "umutex.h"
 
@@ -651,6 +652,171 @@ cleanupAndReturn:
 }
 
 
+//------------------------------------------------------------------------------------------
+//
+//  Skeleton generation
+//
+//     The skeleton of a string is NFD(map(NFD(string))), where map() replaces each
+//     code point by its prototype from the confusables data.
+//
+//     ASCII characters are not changed by NFD and are normalization boundaries,
+//     so the text is processed in segments: ASCII characters whose prototypes are
+//     also ASCII are mapped directly to the output, and only the segments between
+//     them are normalized.
+//
+//------------------------------------------------------------------------------------------
+
+static int32_t
+getSkeletonTableMask(uint32_t type, UErrorCode &status) {
+    switch (type) {
+      case 0:
+        return USPOOF_ML_TABLE_FLAG;
+      case USPOOF_SINGLE_SCRIPT_CONFUSABLE:
+        return USPOOF_SL_TABLE_FLAG;
+      case USPOOF_ANY_CASE:
+        return USPOOF_MA_TABLE_FLAG;
+      case USPOOF_SINGLE_SCRIPT_CONFUSABLE | USPOOF_ANY_CASE:
+        return USPOOF_SA_TABLE_FLAG;
+      default:
+        status = U_ILLEGAL_ARGUMENT_ERROR;
+        return 0;
+    }
+}
+
+// Returns TRUE if c is an ASCII character whose prototype is also all ASCII.
+// proto is then set to the prototype, or to NULL if c maps to itself.
+static inline UBool
+getASCIIPrototype(const SpoofImpl *This, int32_t tableMask, UChar32 c,
+                  const UChar *&proto, int32_t &protoLength) {
+    if (c >= 0x80) {
+        return FALSE;
+    }
+    proto = This->getConfusable(c, tableMask, protoLength);
+    if (proto != NULL) {
+        for (int32_t i = 0; i < protoLength; i++) {
+            if (proto[i] >= 0x80) {
+                return FALSE;
+            }
+        }
+    }
+    return TRUE;
+}
+
+// Appends the skeleton of a segment of text that does not contain ASCII characters
+// with ASCII prototypes, except possibly at its start.
+static void
+appendSkeletonSegment(const SpoofImpl *This, int32_t tableMask,
+                      const UnicodeString &segment, UnicodeString &dest, UErrorCode &status) {
+    UnicodeString nfdSegment;
+    const UnicodeString *input = &segment;
+    if (!gNfdNormalizer->isNormalized(segment, status)) {
+        gNfdNormalizer->normalize(segment, nfdSegment, status);
+        input = &nfdSegment;
+    }
+    if (U_FAILURE(status)) {
+        return;
+    }
+
+    // Apply the skeleton mapping to the NFD normalized input,
+    // then append the NFD normalized result.
+    UnicodeString skelStr;
+    const UChar *s = input->getBuffer();
+    int32_t length = input->length();
+    for (int32_t i = 0; i < length;) {
+        UChar32 c;
+        U16_NEXT(s, i, length, c);
+        This->confusableLookup(c, tableMask, skelStr);
+    }
+    gNfdNormalizer->normalizeSecondAndAppend(dest, skelStr, status);
+}
+
+static void
+appendSkeleton(const SpoofImpl *This, int32_t tableMask,
+               const UChar *s, int32_t length, UnicodeString &dest, UErrorCode &status) {
+    const UChar *limit = s + length;
+    const UChar *proto;
+    int32_t protoLength;
+    while (s < limit && U_SUCCESS(status)) {
+        if (getASCIIPrototype(This, tableMask, *s, proto, protoLength)) {
+            if (proto == NULL) {
+                dest.append(*s);
+            } else {
+                dest.append(proto, protoLength);
+            }
+            ++s;
+            continue;
+        }
+        const UChar *segmentLimit = s + 1;
+        while (segmentLimit < limit &&
+                !getASCIIPrototype(This, tableMask, *segmentLimit, proto, protoLength)) {
+            ++segmentLimit;
+        }
+        appendSkeletonSegment(This, tableMask,
+                              UnicodeString(FALSE, s, (int32_t)(segmentLimit - s)), dest, status);
+        s = segmentLimit;
+    }
+}
+
+static int32_t
+getSkeletonUTF8(const SpoofImpl *This, int32_t tableMask,
+                const char *s, int32_t length, char *dest, int32_t destCapacity,
+                UErrorCode &status) {
+    const char *limit = s + length;
+    const UChar *proto;
+    int32_t protoLength;
+    int32_t destLength = 0;
+    UnicodeString skelStr;
+    while (s < limit && U_SUCCESS(status)) {
+        uint8_t b = (uint8_t)*s;
+        if (getASCIIPrototype(This, tableMask, b, proto, protoLength)) {
+            if (proto == NULL) {
+                if (destLength < destCapacity) {
+                    dest[destLength] = (char)b;
+                }
+                ++destLength;
+            } else {
+                for (int32_t i = 0; i < protoLength; i++) {
+                    if (destLength < destCapacity) {
+                        dest[destLength] = (char)proto[i];
+                    }
+                    ++destLength;
+                }
+            }
+            ++s;
+            continue;
+        }
+        // Segments only end before ASCII bytes, never inside a UTF-8 sequence.
+        const char *segmentLimit = s + 1;
+        while (segmentLimit < limit &&
+                !getASCIIPrototype(This, tableMask, (uint8_t)*segmentLimit, proto, protoLength)) {
+            ++segmentLimit;
+        }
+        skelStr.remove();
+        appendSkeletonSegment(This, tableMask,
+                              UnicodeString::fromUTF8(StringPiece(s, (int32_t)(segmentLimit - s))),
+                              skelStr, status);
+        if (U_FAILURE(status)) {
+            break;
+        }
+        int32_t segmentLength = 0;
+        UErrorCode segmentStatus = U_ZERO_ERROR;
+        if (destLength < destCapacity) {
+            u_strToUTF8(dest + destLength, destCapacity - destLength, &segmentLength,
+                        skelStr.getBuffer(), skelStr.length(), &segmentStatus);
+        } else {
+            u_strToUTF8(NULL, 0, &segmentLength,
+                        skelStr.getBuffer(), skelStr.length(), &segmentStatus);
+        }
+        if (U_FAILURE(segmentStatus) && segmentStatus != U_BUFFER_OVERFLOW_ERROR) {
+            status = segmentStatus;
+        }
+        destLength += segmentLength;
+        s = segmentLimit;
+    }
+    return u_terminateChars(dest, destCapacity, destLength, &status);
+}
+
+
 U_CAPI int32_t U_EXPORT2
 uspoof_getSkeleton(const USpoofChecker *sc,
                    uint32_t type,
@@ -658,7 +824,7 @@ uspoof_getSkeleton(const USpoofChecker *sc,
                    UChar *dest, int32_t destCapacity,
                    UErrorCode *status) {
 
-    SpoofImpl::validateThis(sc, *status);
+    const SpoofImpl *This = SpoofImpl::validateThis(sc, *status);
     if (U_FAILURE(*status)) {
         return 0;
     }
@@ -666,12 +832,22 @@ uspoof_getSkeleton(const USpoofChecker *sc,
         *status = U_ILLEGAL_ARGUMENT_ERROR;
         return 0;
     }
+    int32_t tableMask = getSkeletonTableMask(type, *status);
+    if (U_FAILURE(*status)) {
+        return 0;
+    }
+    if (length == -1) {
+        length = u_strlen(id);
+    }
 
-    UnicodeString idStr((length==-1), id, length);  // Aliasing constructor
+    // Write the skeleton directly into the caller's buffer
+    // unless that overlaps with the input.
     UnicodeString destStr;
-    uspoof_getSkeletonUnicodeString(sc, type, idStr, destStr, status);
-    destStr.extract(dest, destCapacity, *status);
-    return destStr.length();
+    if (dest != NULL && (dest + destCapacity <= id || id + length <= dest)) {
+        destStr.setTo(dest, 0, destCapacity);
+    }
+    appendSkeleton(This, tableMask, id, length, destStr, *status);
+    return destStr.extract(dest, destCapacity, *status);
 }
 
 
@@ -686,41 +862,19 @@ uspoof_getSkeletonUnicodeString(const USpoofChecker *sc,
     if (U_FAILURE(*status)) {
         return dest;
     }
-
-   int32_t tableMask = 0;
-   switch (type) {
-      case 0:
-        tableMask = USPOOF_ML_TABLE_FLAG;
-        break;
-      case USPOOF_SINGLE_SCRIPT_CONFUSABLE:
-        tableMask = USPOOF_SL_TABLE_FLAG;
-        break;
-      case USPOOF_ANY_CASE:
-        tableMask = USPOOF_MA_TABLE_FLAG;
-        break;
-      case USPOOF_SINGLE_SCRIPT_CONFUSABLE | USPOOF_ANY_CASE:
-        tableMask = USPOOF_SA_TABLE_FLAG;
-        break;
-      default:
-        *status = U_ILLEGAL_ARGUMENT_ERROR;
+    int32_t tableMask = getSkeletonTableMask(type, *status);
+    if (U_FAILURE(*status)) {
         return dest;
     }
 
-    UnicodeString nfdId;
-    gNfdNormalizer->normalize(id, nfdId, *status);
-
-    // Apply the skeleton mapping to the NFD normalized input string
-    // Accumulate the skeleton, possibly unnormalized, in a UnicodeString.
-    int32_t inputIndex = 0;
-    UnicodeString skelStr;
-    int32_t normalizedLen = nfdId.length();
-    for (inputIndex=0; inputIndex < normalizedLen; ) {
-        UChar32 c = nfdId.char32At(inputIndex);
-        inputIndex += U16_LENGTH(c);
-        This->confusableLookup(c, tableMask, skelStr);
+    UnicodeString idCopy;
+    const UnicodeString *input = &id;
+    if (&id == &dest) {
+        idCopy = id;
+        input = &idCopy;
     }
-
-    gNfdNormalizer->normalize(skelStr, dest, *status);
+    dest.remove();
+    appendSkeleton(This, tableMask, input->getBuffer(), input->length(), dest, *status);
     return dest;
 }
 
@@ -731,7 +885,7 @@ uspoof_getSkeletonUTF8(const USpoofChecker *sc,
                        const char *id,  int32_t length,
                        char *dest, int32_t destCapacity,
                        UErrorCode *status) {
-    SpoofImpl::validateThis(sc, *status);
+    const SpoofImpl *This = SpoofImpl::validateThis(sc, *status);
     if (U_FAILURE(*status)) {
         return 0;
     }
@@ -739,18 +893,14 @@ uspoof_getSkeletonUTF8(const USpoofChecker *sc,
         *status = U_ILLEGAL_ARGUMENT_ERROR;
         return 0;
     }
-
-    UnicodeString srcStr = UnicodeString::fromUTF8(StringPiece(id, length>=0 ? length : uprv_strlen(id)));
-    UnicodeString destStr;
-    uspoof_getSkeletonUnicodeString(sc, type, srcStr, destStr, status);
+    int32_t tableMask = getSkeletonTableMask(type, *status);
     if (U_FAILURE(*status)) {
         return 0;
     }
-
-    int32_t lengthInUTF8 = 0;
-    u_strToUTF8(dest, destCapacity, &lengthInUTF8,
-                destStr.getBuffer(), destStr.length(), status);
-    return lengthInUTF8;
+    if (length == -1) {
+        length = (int32_t)uprv_strlen(id);
+    }
+    return getSkeletonUTF8(This, tableMask, id, length, dest, destCapacity, *status);
 }
 
 
@@ -1,7 +1,7 @@
 /*
 ******************************************************************************
 *
-*   Copyright (C) 2008-2015, International Business Machines
+*   Copyright (C) 2008-2016, International Business Machines
 *   Corporation and others.  All Rights Reserved.
 *
 ******************************************************************************
@@ -25,6 +25,7 @@
 #include "unicode/uregex.h"
 #include "unicode/ustring.h"
 #include "cmemory.h"
+#include "ucptrie.h"
 #include "uspoof_impl.h"
 #include "uhash.h"
 #include "uvector.h"
@@ -58,6 +59,8 @@ U_NAMESPACE_USE
 //     5.  Build the run-time key and value tables.  These are parallel tables, and are built
 //         at the same time
 //
+//     6.  Build the trie that maps code points to their entries in the key table.
+//
 
 SPUString::SPUString(UnicodeString *s) {
     fStr = s;
@@ -516,6 +519,23 @@ void ConfusabledataBuilder::outputData(UErrorCode &status) {
     rawData->fCFUStringLengthsSize = lengthTableLength / 2;
     fSpoofImpl->fSpoofData->fCFUStringLengths =
         reinterpret_cast<SpoofStringLengthsElement *>(stringLengths);
+
+    // The Confusables Trie, derived from the Key Table.
+    UCPTrie *trie = fSpoofImpl->fSpoofData->buildConfusableTrie(status);
+    int32_t trieLength = ucptrie_toBinary(trie, NULL, 0, &status);
+    if (status == U_BUFFER_OVERFLOW_ERROR) {
+        status = U_ZERO_ERROR;
+    }
+    void *trieData = fSpoofImpl->fSpoofData->reserveSpace(trieLength, status);
+    ucptrie_toBinary(trie, trieData, trieLength, &status);
+    ucptrie_close(trie);
+    if (U_FAILURE(status)) {
+        return;
+    }
+    rawData = fSpoofImpl->fSpoofData->fRawData;
+    rawData->fCFUTrie = (int32_t)((char *)trieData - (char *)rawData);
+    rawData->fCFUTrieLength = trieLength;
+    fSpoofImpl->fSpoofData->initPtrs(status);
 }
 
 
@@ -1,6 +1,6 @@
 /*
 **********************************************************************
-*   Copyright (C) 2008-2015, International Business Machines
+*   Copyright (C) 2008-2016, International Business Machines
 *   Corporation and others.  All Rights Reserved.
 **********************************************************************
 */
@@ -10,6 +10,7 @@
 #include "unicode/uchar.h"
 #include "unicode/uniset.h"
 #include "unicode/utf16.h"
+#include "ucptrie.h"
 #include "utrie2.h"
 #include "cmemory.h"
 #include "cstring.h"
@@ -130,71 +131,46 @@ SpoofImpl *SpoofImpl::validateThis(USpoofChecker *sc, UErrorCode &status) {
 //
 //---------------------------------------------------------------------------------------
 int32_t SpoofImpl::confusableLookup(UChar32 inChar, int32_t tableMask, UnicodeString &dest) const {
+    int32_t stringLen;
+    const UChar *src = getConfusable(inChar, tableMask, stringLen);
+    if (src == NULL) {
+        // The input char maps to itself.
+        dest.append(inChar);
+        return 0;
+    }
+    dest.append(src, stringLen);
+    return stringLen;
+}
 
-    // Binary search the spoof data key table for the inChar
-    int32_t  *low   = fSpoofData->fCFUKeys;
-    int32_t  *mid   = NULL;
-    int32_t  *limit = low + fSpoofData->fRawData->fCFUKeysSize;
-    UChar32   midc;
-    do {
-        int32_t delta = ((int32_t)(limit-low))/2;
-        mid = low + delta;
-        midc = *mid & 0x1fffff;
-        if (inChar == midc) {
-            goto foundChar;
-        } else if (inChar < midc) {
-            limit = mid;
-        } else {
-            low = mid;
-        }
-    } while (low < limit-1);
-    mid = low;
-    midc = *mid & 0x1fffff;
-    if (inChar != midc) {
+
+const UChar *SpoofImpl::getConfusable(UChar32 inChar, int32_t tableMask, int32_t &stringLen) const {
+    const SpoofData *data = fSpoofData;
+
+    // The trie yields the first key table entry for the inChar, plus one.
+    int32_t keyTableIndex = (int32_t)UCPTRIE_FAST_GET(data->fCFUTrie, UCPTRIE_16, inChar) - 1;
+    if (keyTableIndex < 0) {
         // Char not found.  It maps to itself.
-        int i = 0;
-        dest.append(inChar);
-        return i;
-    } 
-  foundChar:
-    int32_t keyFlags = *mid & 0xff000000;
-    if ((keyFlags & tableMask) == 0) {
+        return NULL;
+    }
+    int32_t key = data->fCFUKeys[keyTableIndex];
+    while ((key & tableMask) == 0) {
         // We found the right key char, but the entry doesn't pertain to the
-        //  table we need.  See if there is an adjacent key that does
-        if (keyFlags & USPOOF_KEY_MULTIPLE_VALUES) {
-            int32_t *altMid;
-            for (altMid = mid-1; (*altMid&0x00ffffff) == inChar; altMid--) {
-                keyFlags = *altMid & 0xff000000;
-                if (keyFlags & tableMask) {
-                    mid = altMid;
-                    goto foundKey;
-                }
-            }
-            for (altMid = mid+1; (*altMid&0x00ffffff) == inChar; altMid++) {
-                keyFlags = *altMid & 0xff000000;
-                if (keyFlags & tableMask) {
-                    mid = altMid;
-                    goto foundKey;
-                }
-            }
+        //  table we need.  See if there is a following key that does.
+        if (++keyTableIndex >= data->fRawData->fCFUKeysSize ||
+                ((key = data->fCFUKeys[keyTableIndex]) & 0x00ffffff) != inChar) {
+            // No key entry for this char & table.
+            // The input char maps to itself.
+            return NULL;
         }
-        // No key entry for this char & table.
-        // The input char maps to itself.
-        int i = 0;
-        dest.append(inChar);
-        return i;
     }
 
-  foundKey:
-    int32_t  stringLen = USPOOF_KEY_LENGTH_FIELD(keyFlags) + 1;
-    int32_t keyTableIndex = (int32_t)(mid - fSpoofData->fCFUKeys);
+    stringLen = USPOOF_KEY_LENGTH_FIELD(key) + 1;
 
     // Value is either a UChar  (for strings of length 1) or
     //                 an index into the string table (for longer strings)
-    uint16_t value = fSpoofData->fCFUValues[keyTableIndex];
+    const uint16_t *value = data->fCFUValues + keyTableIndex;
     if (stringLen == 1) {
-        dest.append((UChar)value);
-        return 1;
+        return reinterpret_cast<const UChar *>(value);
     }
 
     // String length of 4 from the above lookup is used for all strings of length >= 4.
@@ -205,20 +181,18 @@ int32_t SpoofImpl::confusableLookup(UChar32 inChar, int32_t tableMask, UnicodeSt
 
     int32_t ix;
     if (stringLen == 4) {
-        int32_t stringLengthsLimit = fSpoofData->fRawData->fCFUStringLengthsSize;
+        int32_t stringLengthsLimit = data->fRawData->fCFUStringLengthsSize;
         for (ix = 0; ix < stringLengthsLimit; ix++) {
-            if (fSpoofData->fCFUStringLengths[ix].fLastString >= value) {
-                stringLen = fSpoofData->fCFUStringLengths[ix].fStrLength;
+            if (data->fCFUStringLengths[ix].fLastString >= *value) {
+                stringLen = data->fCFUStringLengths[ix].fStrLength;
                 break;
             }
         }
         U_ASSERT(ix < stringLengthsLimit);
     }
 
-    U_ASSERT(value + stringLen <= fSpoofData->fRawData->fCFUStringTableLen);
-    UChar *src = &fSpoofData->fCFUStrings[value];
-    dest.append(src, stringLen);
-    return stringLen;
+    U_ASSERT(*value + stringLen <= data->fRawData->fCFUStringTableLen);
+    return data->fCFUStrings + *value;
 }
 
 
@@ -535,6 +509,9 @@ SpoofData::SpoofData(UDataMemory *udm, UErrorCode &status)
             const_cast<void *>(udata_getMemory(udm)));
     validateDataVersion(fRawData, status);
     initPtrs(status);
+    if (U_SUCCESS(status) && fCFUTrie == NULL) {
+        fCFUTrie = buildConfusableTrie(status);
+    }
 }
 
 
@@ -556,6 +533,9 @@ SpoofData::SpoofData(const void *data, int32_t length, UErrorCode &status)
     }
     validateDataVersion(fRawData, status);
     initPtrs(status);
+    if (U_SUCCESS(status) && fCFUTrie == NULL) {
+        fCFUTrie = buildConfusableTrie(status);
+    }
 }
 
 
@@ -602,6 +582,7 @@ void SpoofData::reset() {
    fCFUValues = NULL;
    fCFUStringLengths = NULL;
    fCFUStrings = NULL;
+   fCFUTrie = NULL;
    fAnyCaseTrie = NULL;
    fLowerCaseTrie = NULL;
    fScriptSets = NULL;
@@ -643,6 +624,12 @@ void SpoofData::initPtrs(UErrorCode &status) {
     if (fRawData->fCFUStringTable != 0) {
         fCFUStrings = (UChar *)((char *)fRawData + fRawData->fCFUStringTable);
     }
+    if (fRawData->fCFUTrie != 0) {
+        // Reopen the trie each time; the builder may have moved the raw data.
+        ucptrie_close(fCFUTrie);
+        fCFUTrie = ucptrie_openFromBinary(UCPTRIE_TYPE_FAST, UCPTRIE_VALUE_BITS_16,
+            (char *)fRawData + fRawData->fCFUTrie, fRawData->fCFUTrieLength, NULL, &status);
+    }
 
     if (fAnyCaseTrie ==  NULL && fRawData->fAnyCaseTrie != 0) {
         fAnyCaseTrie = utrie2_openFromSerialized(UTRIE2_16_VALUE_BITS,
@@ -659,7 +646,43 @@ void SpoofData::initPtrs(UErrorCode &status) {
 }
 
 
+//  SpoofData::buildConfusableTrie()
+//            Build the trie that maps each code point with confusable data
+//            to its first entry in the key table.
+//
+UCPTrie *SpoofData::buildConfusableTrie(UErrorCode &status) const {
+    if (U_FAILURE(status)) {
+        return NULL;
+    }
+    int32_t numKeys = fCFUKeys != NULL ? fRawData->fCFUKeysSize : 0;
+    if (numKeys >= 0xffff) {
+        // The trie values are 16 bits wide.
+        status = U_INVALID_FORMAT_ERROR;
+        return NULL;
+    }
+    UMutableCPTrie *mutableTrie = umutablecptrie_open(0, 0, &status);
+    UChar32 previousChar = -1;
+    for (int32_t i = 0; i < numKeys && U_SUCCESS(status); i++) {
+        UChar32 c = fCFUKeys[i] & 0x00ffffff;
+        if (c != previousChar) {
+            umutablecptrie_set(mutableTrie, c, (uint32_t)(i + 1), &status);
+            previousChar = c;
+        }
+    }
+    UCPTrie *trie = umutablecptrie_buildImmutable(
+        mutableTrie, UCPTRIE_TYPE_FAST, UCPTRIE_VALUE_BITS_16, &status);
+    umutablecptrie_close(mutableTrie);
+    if (U_FAILURE(status)) {
+        ucptrie_close(trie);
+        return NULL;
+    }
+    return trie;
+}
+
+
 SpoofData::~SpoofData() {
+    ucptrie_close(fCFUTrie);
+    fCFUTrie = NULL;
     utrie2_close(fAnyCaseTrie);
     fAnyCaseTrie = NULL;
     utrie2_close(fLowerCaseTrie);
@@ -848,6 +871,13 @@ uspoof_swap(const UDataSwapper *ds, const void *inData, int32_t length, void *ou
     sectionLength = ds->readUInt32(spoofDH->fScriptSetsLength) * sizeof(ScriptSet);
     ds->swapArray32(ds, inBytes+sectionStart, sectionLength, outBytes+sectionStart, status);
 
+    // Confusables Trie.  Not present in data built by older versions.
+    sectionStart  = ds->readUInt32(spoofDH->fCFUTrie);
+    sectionLength = ds->readUInt32(spoofDH->fCFUTrieLength);
+    if (sectionStart != 0) {
+        ucptrie_swap(ds, inBytes+sectionStart, sectionLength, outBytes+sectionStart, status);
+    }
+
     // And, last, swap the header itself.
     //   int32_t   fMagic             // swap this
     //   uint8_t   fFormatVersion[4]  // Do not swap this, just copy
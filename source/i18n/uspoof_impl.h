@@ -1,6 +1,6 @@
 /*
 ***************************************************************************
-* Copyright (C) 2008-2013, International Business Machines Corporation
+* Copyright (C) 2008-2016, International Business Machines Corporation
 * and others. All Rights Reserved.
 ***************************************************************************
 *
@@ -18,6 +18,7 @@
 #include "unicode/uscript.h"
 #include "unicode/udata.h"
 
+#include "ucptrie.h"
 #include "utrie2.h"
 
 #if !UCONFIG_NO_NORMALIZATION
@@ -68,6 +69,15 @@ public:
      */  
     int32_t confusableLookup(UChar32 inChar, int32_t tableMask, UnicodeString &destBuf) const;
 
+    /** Get the confusable skeleton transform for a single code point,
+     *  without copying it.
+     *  @param    tableMask  bit flag specifying which confusable table to use.
+     *  @param    length     receives the length in UTF-16 code units of the substitution string.
+     *  @return   A pointer into the spoof data to the substitution string,
+     *            or NULL if inChar maps to itself.
+     */
+    const UChar *getConfusable(UChar32 inChar, int32_t tableMask, int32_t &length) const;
+
     /** Set and Get AllowedLocales, implementations of the corresponding API */
     void setAllowedLocales(const char *localesList, UErrorCode &status);
     const char * getAllowedLocales(UErrorCode &status);
@@ -136,7 +146,7 @@ public:
 //        The key table is sorted in ascending code point order.  (not on the
 //        32 bit int value, the flag bits do not participate in the sorting.)
 //
-//        Lookup is done by means of a binary search in the key table.
+//        Lookup is done by means of the confusables trie, see below.
 //
 //    The corresponding values are kept in a parallel array of 16 bit ints.
 //        If the value string is of length 1, it is literally in the value array.
@@ -161,6 +171,14 @@ public:
 //            uint16_t      index of the _last_ string with this length
 //            uint16_t      the length
 //
+//    Confusables Trie
+//       A UCPTrie (fast type, 16-bit values) mapping each code point to one plus the
+//       index of its first entry in the key table, or to 0 if the code point has no
+//       entry and maps to itself.  Any further entries for the same code point, for
+//       other tables, follow it in the key table.
+//       The trie is optional in the data; older data has no such section, and the
+//       trie is then built from the key table when the data is loaded.
+//
 
 // Flag bits in the Key entries
 #define USPOOF_SL_TABLE_FLAG (1<<24)
@@ -233,6 +251,10 @@ class SpoofData: public UMemory {
     // Reset all fields to an initial state.
     // Called from the top of all constructors.
     void reset();
+
+    // Build the confusables trie from the key table.
+    // Used by the builder, and when loading data that has no serialized trie.
+    UCPTrie *buildConfusableTrie(UErrorCode &status) const;
     
     SpoofDataHeader             *fRawData;          // Ptr to the raw memory-mapped data
     UBool                       fDataOwned;         // True if the raw data is owned, and needs
@@ -249,6 +271,7 @@ class SpoofData: public UMemory {
     uint16_t                    *fCFUValues;
     SpoofStringLengthsElement   *fCFUStringLengths;
     UChar                       *fCFUStrings;
+    UCPTrie                     *fCFUTrie;
 
     // Whole Script Confusable Data
     UTrie2                      *fAnyCaseTrie;
@@ -298,12 +321,18 @@ struct SpoofDataHeader {
 
     int32_t       fScriptSets;            // byte offset to array of ScriptSets
     int32_t       fScriptSetsLength;      // Number of ScriptSets (24 bytes each)
+
+    // Runtime lookup structure for the confusable data, derived from the key table.
+    //   Optional; both fields are 0 in data that does not have it.
+
+    int32_t       fCFUTrie;               // byte offset to the serialized Confusables Trie
+    int32_t       fCFUTrieLength;         // Length (bytes) of the serialized Confusables Trie
     
 
     // The following sections are for data from xidmodifications.txt
     
     
-    int32_t       unused[15];              // Padding, Room for Expansion
+    int32_t       unused[13];              // Padding, Room for Expansion
     
  }; 
 
@@ -0,0 +1,559 @@
+/*
+***************************************************************************
+* Copyright (C) 2016, International Business Machines Corporation
+* and others. All Rights Reserved.
+***************************************************************************
+*   file name:  uspoof_index.cpp
+*   encoding:   US-ASCII
+*   tab size:   8 (not used)
+*   indentation:4
+*
+*   created on: 2016feb02
+*
+*   Skeleton index: finds the identifiers in a large, prebuilt set
+*   that are confusable with a given identifier.
+*/
+#include "unicode/utypes.h"
+#include "unicode/uspoof.h"
+#include "unicode/utf8.h"
+#include "unicode/utf16.h"
+#include "cmemory.h"
+#include "uarrsort.h"
+#include "uassert.h"
+#include "uspoof_impl.h"
+
+#if !UCONFIG_NO_NORMALIZATION
+
+U_NAMESPACE_USE
+
+//
+//  Serialized skeleton index.
+//
+//  All fields are 32 bits wide and in platform endianness, so that the index
+//  can be memory-mapped and used in place.
+//
+//    SkeletonIndexHeader header;
+//    int32_t  buckets[(1<<header.fBucketBits)+1];  Start index of each bucket's entries;
+//                                                  buckets[i+1] is the limit of bucket i.
+//    uint32_t hashes[2*header.fNumEntries];        64-bit skeleton hashes, high word first,
+//                                                  in ascending order.
+//    int32_t  values[header.fNumEntries];          The caller's values, parallel to the hashes,
+//                                                  ascending for equal hashes.
+//
+//  An entry's bucket is given by the top fBucketBits bits of its hash.
+//  The skeleton hash is the 64-bit FNV-1a hash of the UTF-8 form of the skeleton,
+//  so that identifiers added and looked up in either encoding hash the same.
+//
+struct SkeletonIndexHeader {
+    uint32_t      fMagic;               // SKELETON_INDEX_MAGIC
+    uint8_t       fFormatVersion[4];    // 1.0.0.0
+    int32_t       fLength;              // Total length in bytes, including the header.
+    uint32_t      fType;                // Skeleton type, as for uspoof_getSkeleton().
+    uint32_t      fDataChecksum;        // Checksum of the confusable data used for the skeletons.
+    int32_t       fNumEntries;          // Number of identifiers.
+    int32_t       fBucketBits;          // log2 of the number of buckets.
+    int32_t       fBuckets;             // Byte offset of the buckets array.
+    int32_t       fHashes;              // Byte offset of the hashes array.
+    int32_t       fValues;              // Byte offset of the values array.
+    int32_t       fReserved[6];
+};
+
+static const uint32_t SKELETON_INDEX_MAGIC = 0x536b4978;  // "SkIx"
+static const int32_t MAX_BUCKET_BITS = 24;
+static const uint32_t SKELETON_TYPE_MASK = USPOOF_SINGLE_SCRIPT_CONFUSABLE | USPOOF_ANY_CASE;
+
+static const uint64_t FNV_OFFSET_BASIS = UINT64_C(0xcbf29ce484222325);
+static const uint64_t FNV_PRIME = UINT64_C(0x100000001b3);
+
+static inline uint64_t
+hashBytes(uint64_t h, const uint8_t *p, int32_t length) {
+    for (int32_t i = 0; i < length; ++i) {
+        h = (h ^ p[i]) * FNV_PRIME;
+    }
+    return h;
+}
+
+// Checksum of the confusable mapping tables, to detect an index
+// that is used with different data than it was built with.
+static uint32_t
+getDataChecksum(const SpoofImpl *This) {
+    const SpoofData *data = This->fSpoofData;
+    const SpoofDataHeader *raw = data->fRawData;
+    uint64_t h = FNV_OFFSET_BASIS;
+    h = hashBytes(h, (const uint8_t *)data->fCFUKeys, raw->fCFUKeysSize * 4);
+    h = hashBytes(h, (const uint8_t *)data->fCFUValues, raw->fCFUStringIndexSize * 2);
+    h = hashBytes(h, (const uint8_t *)data->fCFUStrings, raw->fCFUStringTableLen * 2);
+    h = hashBytes(h, (const uint8_t *)data->fCFUStringLengths, raw->fCFUStringLengthsSize * 4);
+    return (uint32_t)(h ^ (h >> 32));
+}
+
+static uint64_t
+getSkeletonHash(const USpoofChecker *sc, uint32_t type,
+                const UChar *id, int32_t length, UErrorCode &status) {
+    MaybeStackArray<UChar, 64> skeleton;
+    int32_t skeletonLength = uspoof_getSkeleton(sc, type, id, length,
+                                                skeleton.getAlias(), skeleton.getCapacity(), &status);
+    if (status == U_BUFFER_OVERFLOW_ERROR) {
+        if (skeleton.resize(skeletonLength) == NULL) {
+            status = U_MEMORY_ALLOCATION_ERROR;
+            return 0;
+        }
+        status = U_ZERO_ERROR;
+        uspoof_getSkeleton(sc, type, id, length,
+                           skeleton.getAlias(), skeleton.getCapacity(), &status);
+    }
+    if (U_FAILURE(status)) {
+        return 0;
+    }
+    const UChar *s = skeleton.getAlias();
+    uint64_t h = FNV_OFFSET_BASIS;
+    for (int32_t i = 0; i < skeletonLength;) {
+        UChar32 c;
+        U16_NEXT(s, i, skeletonLength, c);
+        uint8_t buffer[U8_MAX_LENGTH];
+        int32_t bufferLength = 0;
+        U8_APPEND_UNSAFE(buffer, bufferLength, c);
+        h = hashBytes(h, buffer, bufferLength);
+    }
+    return h;
+}
+
+static uint64_t
+getSkeletonHashUTF8(const USpoofChecker *sc, uint32_t type,
+                    const char *id, int32_t length, UErrorCode &status) {
+    MaybeStackArray<char, 128> skeleton;
+    int32_t skeletonLength = uspoof_getSkeletonUTF8(sc, type, id, length,
+                                                    skeleton.getAlias(), skeleton.getCapacity(), &status);
+    if (status == U_BUFFER_OVERFLOW_ERROR) {
+        if (skeleton.resize(skeletonLength) == NULL) {
+            status = U_MEMORY_ALLOCATION_ERROR;
+            return 0;
+        }
+        status = U_ZERO_ERROR;
+        uspoof_getSkeletonUTF8(sc, type, id, length,
+                               skeleton.getAlias(), skeleton.getCapacity(), &status);
+    }
+    if (U_FAILURE(status)) {
+        return 0;
+    }
+    return hashBytes(FNV_OFFSET_BASIS, (const uint8_t *)skeleton.getAlias(), skeletonLength);
+}
+
+
+U_NAMESPACE_BEGIN
+
+struct SkeletonIndexEntry {
+    uint32_t hashHigh;
+    uint32_t hashLow;
+    int32_t  value;
+};
+
+static int32_t U_CALLCONV
+compareEntries(const void * /*context*/, const void *left, const void *right) {
+    const SkeletonIndexEntry *l = static_cast<const SkeletonIndexEntry *>(left);
+    const SkeletonIndexEntry *r = static_cast<const SkeletonIndexEntry *>(right);
+    if (l->hashHigh != r->hashHigh) {
+        return l->hashHigh < r->hashHigh ? -1 : 1;
+    }
+    if (l->hashLow != r->hashLow) {
+        return l->hashLow < r->hashLow ? -1 : 1;
+    }
+    if (l->value != r->value) {
+        return l->value < r->value ? -1 : 1;
+    }
+    return 0;
+}
+
+//
+//  Class SkeletonIndexBuilder corresponds to the plain C API opaque type
+//  USpoofSkeletonIndexBuilder.  One can be cast to the other.
+//
+class SkeletonIndexBuilder : public UMemory {
+public:
+    SkeletonIndexBuilder(const USpoofChecker *sc, uint32_t type, UErrorCode &status);
+    ~SkeletonIndexBuilder();
+
+    void add(uint64_t hash, int32_t value, UErrorCode &status);
+    int32_t serialize(void *data, int32_t capacity, UErrorCode &status);
+
+    USpoofChecker       *fChecker;       // Clone of the caller's checker.
+    uint32_t             fType;
+    uint32_t             fDataChecksum;
+    SkeletonIndexEntry  *fEntries;
+    int32_t              fLength;
+    int32_t              fCapacity;
+    UBool                fSorted;
+};
+
+SkeletonIndexBuilder::SkeletonIndexBuilder(const USpoofChecker *sc, uint32_t type,
+                                           UErrorCode &status) :
+        fChecker(NULL), fType(type), fDataChecksum(0),
+        fEntries(NULL), fLength(0), fCapacity(0), fSorted(TRUE) {
+    const SpoofImpl *impl = SpoofImpl::validateThis(sc, status);
+    if (impl == NULL) {
+        return;
+    }
+    fDataChecksum = getDataChecksum(impl);
+    fChecker = uspoof_clone(sc, &status);
+}
+
+SkeletonIndexBuilder::~SkeletonIndexBuilder() {
+    uspoof_close(fChecker);
+    uprv_free(fEntries);
+}
+
+void SkeletonIndexBuilder::add(uint64_t hash, int32_t value, UErrorCode &status) {
+    if (U_FAILURE(status)) {
+        return;
+    }
+    if (fLength == fCapacity) {
+        int32_t newCapacity = fCapacity == 0 ? 1024 : fCapacity < 0x40000000 ? 2 * fCapacity : 0x7fffffff;
+        if (newCapacity == fCapacity) {
+            status = U_INDEX_OUTOFBOUNDS_ERROR;
+            return;
+        }
+        SkeletonIndexEntry *newEntries = (SkeletonIndexEntry *)
+            uprv_realloc(fEntries, (size_t)newCapacity * sizeof(SkeletonIndexEntry));
+        if (newEntries == NULL) {
+            status = U_MEMORY_ALLOCATION_ERROR;
+            return;
+        }
+        fEntries = newEntries;
+        fCapacity = newCapacity;
+    }
+    SkeletonIndexEntry &entry = fEntries[fLength++];
+    entry.hashHigh = (uint32_t)(hash >> 32);
+    entry.hashLow = (uint32_t)hash;
+    entry.value = value;
+    fSorted = FALSE;
+}
+
+int32_t SkeletonIndexBuilder::serialize(void *data, int32_t capacity, UErrorCode &status) {
+    if (U_FAILURE(status)) {
+        return 0;
+    }
+    if (capacity < 0 || (data == NULL && capacity > 0) || ((size_t)data & 3) != 0) {
+        status = U_ILLEGAL_ARGUMENT_ERROR;
+        return 0;
+    }
+
+    // About two entries per bucket.
+    int32_t bucketBits = 0;
+    while (bucketBits < MAX_BUCKET_BITS && ((int32_t)1 << (bucketBits + 1)) <= fLength) {
+        ++bucketBits;
+    }
+    int32_t numBuckets = (int32_t)1 << bucketBits;
+    int64_t totalLength = (int64_t)sizeof(SkeletonIndexHeader) +
+                          4 * ((int64_t)numBuckets + 1) + 12 * (int64_t)fLength;
+    if (totalLength > 0x7fffffff) {
+        status = U_INDEX_OUTOFBOUNDS_ERROR;
+        return 0;
+    }
+    int32_t length = (int32_t)totalLength;
+    if (capacity < length) {
+        status = U_BUFFER_OVERFLOW_ERROR;
+        return length;
+    }
+
+    if (!fSorted) {
+        uprv_sortArray(fEntries, fLength, sizeof(SkeletonIndexEntry),
+                       compareEntries, NULL, FALSE, &status);
+        if (U_FAILURE(status)) {
+            return 0;
+        }
+        fSorted = TRUE;
+    }
+
+    SkeletonIndexHeader *header = static_cast<SkeletonIndexHeader *>(data);
+    uprv_memset(header, 0, sizeof(SkeletonIndexHeader));
+    header->fMagic = SKELETON_INDEX_MAGIC;
+    header->fFormatVersion[0] = 1;
+    header->fLength = length;
+    header->fType = fType;
+    header->fDataChecksum = fDataChecksum;
+    header->fNumEntries = fLength;
+    header->fBucketBits = bucketBits;
+    header->fBuckets = (int32_t)sizeof(SkeletonIndexHeader);
+    header->fHashes = header->fBuckets + 4 * (numBuckets + 1);
+    header->fValues = header->fHashes + 8 * fLength;
+
+    char *base = static_cast<char *>(data);
+    int32_t *buckets = reinterpret_cast<int32_t *>(base + header->fBuckets);
+    uint32_t *hashes = reinterpret_cast<uint32_t *>(base + header->fHashes);
+    int32_t *values = reinterpret_cast<int32_t *>(base + header->fValues);
+    int32_t i = 0;
+    for (int32_t bucket = 0; bucket < numBuckets; ++bucket) {
+        buckets[bucket] = i;
+        while (i < fLength &&
+                (bucketBits == 0 ? 0 : (int32_t)(fEntries[i].hashHigh >> (32 - bucketBits))) == bucket) {
+            ++i;
+        }
+    }
+    U_ASSERT(i == fLength);
+    buckets[numBuckets] = fLength;
+    for (i = 0; i < fLength; ++i) {
+        hashes[2 * i] = fEntries[i].hashHigh;
+        hashes[2 * i + 1] = fEntries[i].hashLow;
+        values[i] = fEntries[i].value;
+    }
+    return length;
+}
+
+//
+//  Class SkeletonIndex corresponds to the plain C API opaque type
+//  USpoofSkeletonIndex.  One can be cast to the other.
+//  It only aliases the serialized data.
+//
+class SkeletonIndex : public UMemory {
+public:
+    SkeletonIndex(const USpoofChecker *sc, const void *data, int32_t length, UErrorCode &status);
+    ~SkeletonIndex();
+
+    int32_t find(uint64_t hash, int32_t *dest, int32_t capacity, UErrorCode &status) const;
+
+    USpoofChecker              *fChecker;     // Clone of the caller's checker.
+    const SkeletonIndexHeader  *fHeader;
+    const int32_t              *fBuckets;
+    const uint32_t             *fHashes;
+    const int32_t              *fValues;
+};
+
+SkeletonIndex::SkeletonIndex(const USpoofChecker *sc, const void *data, int32_t length,
+                             UErrorCode &status) :
+        fChecker(NULL), fHeader(NULL), fBuckets(NULL), fHashes(NULL), fValues(NULL) {
+    const SpoofImpl *impl = SpoofImpl::validateThis(sc, status);
+    if (impl == NULL) {
+        return;
+    }
+    if (data == NULL || length < 0 || ((size_t)data & 3) != 0) {
+        status = U_ILLEGAL_ARGUMENT_ERROR;
+        return;
+    }
+    const SkeletonIndexHeader *header = static_cast<const SkeletonIndexHeader *>(data);
+    if (length < (int32_t)sizeof(SkeletonIndexHeader) ||
+            header->fMagic != SKELETON_INDEX_MAGIC ||
+            header->fFormatVersion[0] != 1 ||
+            (header->fType & ~SKELETON_TYPE_MASK) != 0 ||
+            header->fNumEntries < 0 ||
+            header->fBucketBits < 0 || header->fBucketBits > MAX_BUCKET_BITS) {
+        status = U_INVALID_FORMAT_ERROR;
+        return;
+    }
+    int64_t bucketsLimit = (int64_t)header->fBuckets + 4 * (((int64_t)1 << header->fBucketBits) + 1);
+    int64_t hashesLimit = (int64_t)header->fHashes + 8 * (int64_t)header->fNumEntries;
+    int64_t valuesLimit = (int64_t)header->fValues + 4 * (int64_t)header->fNumEntries;
+    if (header->fLength > length ||
+            header->fBuckets != (int32_t)sizeof(SkeletonIndexHeader) ||
+            header->fHashes != bucketsLimit ||
+            header->fValues != hashesLimit ||
+            header->fLength != valuesLimit) {
+        status = U_INVALID_FORMAT_ERROR;
+        return;
+    }
+    if (header->fDataChecksum != getDataChecksum(impl)) {
+        status = U_INVALID_STATE_ERROR;
+        return;
+    }
+    const char *base = static_cast<const char *>(data);
+    fHeader = header;
+    fBuckets = reinterpret_cast<const int32_t *>(base + header->fBuckets);
+    fHashes = reinterpret_cast<const uint32_t *>(base + header->fHashes);
+    fValues = reinterpret_cast<const int32_t *>(base + header->fValues);
+    fChecker = uspoof_clone(sc, &status);
+}
+
+SkeletonIndex::~SkeletonIndex() {
+    uspoof_close(fChecker);
+}
+
+int32_t SkeletonIndex::find(uint64_t hash, int32_t *dest, int32_t capacity,
+                            UErrorCode &status) const {
+    if (U_FAILURE(status)) {
+        return 0;
+    }
+    uint32_t hashHigh = (uint32_t)(hash >> 32);
+    uint32_t hashLow = (uint32_t)hash;
+    int32_t bucketBits = fHeader->fBucketBits;
+    int32_t bucket = bucketBits == 0 ? 0 : (int32_t)(hashHigh >> (32 - bucketBits));
+    int32_t start = fBuckets[bucket];
+    int32_t limit = fBuckets[bucket + 1];
+    if (start < 0 || limit < start || fHeader->fNumEntries < limit) {
+        status = U_INVALID_FORMAT_ERROR;
+        return 0;
+    }
+
+    // Binary search for the first entry with the hash.
+    while (start < limit) {
+        int32_t i = (start + limit) / 2;
+        uint32_t high = fHashes[2 * i];
+        if (high < hashHigh || (high == hashHigh && fHashes[2 * i + 1] < hashLow)) {
+            start = i + 1;
+        } else {
+            limit = i;
+        }
+    }
+    int32_t count = 0;
+    for (int32_t i = start;
+            i < fHeader->fNumEntries && fHashes[2 * i] == hashHigh && fHashes[2 * i + 1] == hashLow;
+            ++i) {
+        if (count < capacity) {
+            dest[count] = fValues[i];
+        }
+        ++count;
+    }
+    if (count > capacity) {
+        status = U_BUFFER_OVERFLOW_ERROR;
+    }
+    return count;
+}
+
+U_NAMESPACE_END
+
+
+//----------------------------------------------------------------------------
+//
+//  C API
+//
+//----------------------------------------------------------------------------
+
+U_CAPI USpoofSkeletonIndexBuilder * U_EXPORT2
+uspoof_openSkeletonIndexBuilder(const USpoofChecker *sc, uint32_t type, UErrorCode *status) {
+    if (U_FAILURE(*status)) {
+        return NULL;
+    }
+    if ((type & ~SKELETON_TYPE_MASK) != 0) {
+        *status = U_ILLEGAL_ARGUMENT_ERROR;
+        return NULL;
+    }
+    SkeletonIndexBuilder *builder = new SkeletonIndexBuilder(sc, type, *status);
+    if (builder == NULL) {
+        *status = U_MEMORY_ALLOCATION_ERROR;
+        return NULL;
+    }
+    if (U_FAILURE(*status)) {
+        delete builder;
+        return NULL;
+    }
+    return reinterpret_cast<USpoofSkeletonIndexBuilder *>(builder);
+}
+
+U_CAPI void U_EXPORT2
+uspoof_closeSkeletonIndexBuilder(USpoofSkeletonIndexBuilder *builder) {
+    delete reinterpret_cast<SkeletonIndexBuilder *>(builder);
+}
+
+U_CAPI void U_EXPORT2
+uspoof_addToSkeletonIndex(USpoofSkeletonIndexBuilder *builder,
+                          const UChar *id, int32_t length,
+                          int32_t value,
+                          UErrorCode *status) {
+    if (U_FAILURE(*status)) {
+        return;
+    }
+    if (builder == NULL) {
+        *status = U_ILLEGAL_ARGUMENT_ERROR;
+        return;
+    }
+    SkeletonIndexBuilder *This = reinterpret_cast<SkeletonIndexBuilder *>(builder);
+    uint64_t hash = getSkeletonHash(This->fChecker, This->fType, id, length, *status);
+    This->add(hash, value, *status);
+}
+
+U_CAPI void U_EXPORT2
+uspoof_addToSkeletonIndexUTF8(USpoofSkeletonIndexBuilder *builder,
+                              const char *id, int32_t length,
+                              int32_t value,
+                              UErrorCode *status) {
+    if (U_FAILURE(*status)) {
+        return;
+    }
+    if (builder == NULL) {
+        *status = U_ILLEGAL_ARGUMENT_ERROR;
+        return;
+    }
+    SkeletonIndexBuilder *This = reinterpret_cast<SkeletonIndexBuilder *>(builder);
+    uint64_t hash = getSkeletonHashUTF8(This->fChecker, This->fType, id, length, *status);
+    This->add(hash, value, *status);
+}
+
+U_CAPI int32_t U_EXPORT2
+uspoof_serializeSkeletonIndex(USpoofSkeletonIndexBuilder *builder,
+                              void *data, int32_t capacity,
+                              UErrorCode *status) {
+    if (U_FAILURE(*status)) {
+        return 0;
+    }
+    if (builder == NULL) {
+        *status = U_ILLEGAL_ARGUMENT_ERROR;
+        return 0;
+    }
+    return reinterpret_cast<SkeletonIndexBuilder *>(builder)->serialize(data, capacity, *status);
+}
+
+U_CAPI USpoofSkeletonIndex * U_EXPORT2
+uspoof_openSkeletonIndex(const USpoofChecker *sc,
+                         const void *data, int32_t length,
+                         UErrorCode *status) {
+    if (U_FAILURE(*status)) {
+        return NULL;
+    }
+    SkeletonIndex *index = new SkeletonIndex(sc, data, length, *status);
+    if (index == NULL) {
+        *status = U_MEMORY_ALLOCATION_ERROR;
+        return NULL;
+    }
+    if (U_FAILURE(*status)) {
+        delete index;
+        return NULL;
+    }
+    return reinterpret_cast<USpoofSkeletonIndex *>(index);
+}
+
+U_CAPI void U_EXPORT2
+uspoof_closeSkeletonIndex(USpoofSkeletonIndex *index) {
+    delete reinterpret_cast<SkeletonIndex *>(index);
+}
+
+U_CAPI int32_t U_EXPORT2
+uspoof_getSkeletonIndexSize(const USpoofSkeletonIndex *index) {
+    if (index == NULL) {
+        return 0;
+    }
+    return reinterpret_cast<const SkeletonIndex *>(index)->fHeader->fNumEntries;
+}
+
+U_CAPI int32_t U_EXPORT2
+uspoof_findConfusables(const USpoofSkeletonIndex *index,
+                       const UChar *id, int32_t length,
+                       int32_t *values, int32_t capacity,
+                       UErrorCode *status) {
+    if (U_FAILURE(*status)) {
+        return 0;
+    }
+    if (index == NULL || capacity < 0 || (values == NULL && capacity > 0)) {
+        *status = U_ILLEGAL_ARGUMENT_ERROR;
+        return 0;
+    }
+    const SkeletonIndex *This = reinterpret_cast<const SkeletonIndex *>(index);
+    uint64_t hash = getSkeletonHash(This->fChecker, This->fHeader->fType, id, length, *status);
+    return This->find(hash, values, capacity, *status);
+}
+
+U_CAPI int32_t U_EXPORT2
+uspoof_findConfusablesUTF8(const USpoofSkeletonIndex *index,
+                           const char *id, int32_t length,
+                           int32_t *values, int32_t capacity,
+                           UErrorCode *status) {
+    if (U_FAILURE(*status)) {
+        return 0;
+    }
+    if (index == NULL || capacity < 0 || (values == NULL && capacity > 0)) {
+        *status = U_ILLEGAL_ARGUMENT_ERROR;
+        return 0;
+    }
+    const SkeletonIndex *This = reinterpret_cast<const SkeletonIndex *>(index);
+    uint64_t hash = getSkeletonHashUTF8(This->fChecker, This->fHeader->fType, id, length, *status);
+    return This->find(hash, values, capacity, *status);
+}
+
+#endif  // !UCONFIG_NO_NORMALIZATION
@@ -1,6 +1,6 @@
 /*
 **********************************************************************
-*   Copyright (C) 2001-2015 IBM and others. All rights reserved.
+*   Copyright (C) 2001-2016 IBM and others. All rights reserved.
 **********************************************************************
 *   Date        Name        Description
 *  08/13/2001   synwee      Creation.
@@ -163,6 +163,12 @@ struct UPattern {
           int16_t             backShift[MAX_TABLE_SIZE_];
 };
 
+/**
+ * Per-pattern table of text character classes that lets usearch_search()
+ * pass over text which cannot contain a match. Defined in usearch.cpp.
+ */
+struct USearchSkipTable;
+
 struct UStringSearch {
     struct USearch            *search;
     struct UPattern            pattern;
@@ -182,6 +188,8 @@ struct UStringSearch {
            UBool               toShift;
            UChar               canonicalPrefixAccents[INITIAL_ARRAY_SIZE_];
            UChar               canonicalSuffixAccents[INITIAL_ARRAY_SIZE_];
+    // built on the first usearch_search() call, reset with the pattern
+    struct USearchSkipTable   *skipTable;
 };
 
 /**
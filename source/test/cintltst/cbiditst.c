@@ -1,6 +1,6 @@
 /********************************************************************
  * COPYRIGHT:
- * Copyright (c) 1997-2014, International Business Machines Corporation and
+ * Copyright (c) 1997-2016, International Business Machines Corporation and
  * others. All Rights Reserved.
  ********************************************************************/
 /*   file name:  cbiditst.c
@@ -89,6 +89,10 @@ static void doTailTest(void);
 
 static void testBracketOverflow(void);
 
+static void testSplitParagraphs(void);
+
+static void testReserve(void);
+
 /* new BIDI API */
 static void testReorderingMode(void);
 static void testReorderRunsOnly(void);
@@ -136,6 +140,8 @@ addComplexTest(TestNode** root) {
     addTest(root, testGetBaseDirection, "complex/bidi/testGetBaseDirection");
     addTest(root, testContext, "complex/bidi/testContext");
     addTest(root, testBracketOverflow, "complex/bidi/TestBracketOverflow");
+    addTest(root, testSplitParagraphs, "complex/bidi/TestSplitParagraphs");
+    addTest(root, testReserve, "complex/bidi/TestReserve");
 
     addTest(root, doArabicShapingTest, "complex/arabic-shaping/ArabicShapingTest");
     addTest(root, doLamAlefSpecialVLTRArabicShapingTest, "complex/arabic-shaping/lamalef");
@@ -4920,3 +4926,148 @@ testBracketOverflow(void) {
     ubidi_close(bidi);
 }
 
+static void
+testSplitParagraphs(void) {
+    static const char* const paras[] = {
+        "abc \\u05d0\\u05d1 (1-2) def\\u2029",
+        "\\u05d2 [xy] 12\\u000d\\u000a",
+        "\\u2067\\u05d3 a\\u2069 b\\u001c",
+        "  \\u000a",
+        "\\u0627\\u0644 3.4 \\u202bz\\u202c\\u000d",
+        "\\u000d",
+        "q \\u2068\\u05d4\\u2069 (\\u05d5]"
+    };
+    static const UBiDiLevel splitParaLevels[] = {UBIDI_LTR, UBIDI_RTL, UBIDI_DEFAULT_LTR, UBIDI_DEFAULT_RTL};
+    UChar src[MAXLEN];
+    UBiDiLevel levels[MAXLEN];
+    int32_t limits[40];
+    UErrorCode errorCode=U_ZERO_ERROR;
+    UBiDi *pBiDi, *pPart;
+    int32_t length, count, maxParts, start, limit, i, j, k;
+
+    log_verbose("\nEntering TestSplitParagraphs\n\n");
+    length=0;
+    for(i=0; i<3; ++i) {
+        for(j=0; j<UPRV_LENGTHOF(paras); ++j) {
+            length+=u_unescape(paras[j], src+length, MAXLEN-length);
+        }
+    }
+
+    pBiDi=ubidi_open();
+    pPart=ubidi_open();
+    for(i=0; i<UPRV_LENGTHOF(splitParaLevels); ++i) {
+        errorCode=U_ZERO_ERROR;
+        ubidi_setPara(pBiDi, src, length, splitParaLevels[i], NULL, &errorCode);
+        ubidi_getLevels(pBiDi, &errorCode);  /* make sure that the levels are stored */
+        if(U_FAILURE(errorCode)) {
+            log_err("ubidi_setPara(paraLevel=%d) failed - %s\n", splitParaLevels[i], u_errorName(errorCode));
+            break;
+        }
+        uprv_memcpy(levels, ubidi_getLevels(pBiDi, &errorCode), length);
+        for(maxParts=1; maxParts<=UPRV_LENGTHOF(limits); ++maxParts) {
+            count=ubidi_splitParagraphs(src, length, limits, maxParts, &errorCode);
+            if(U_FAILURE(errorCode) || count<1 || count>maxParts || limits[count-1]!=length) {
+                log_err("ubidi_splitParagraphs(maxParts=%d) returned %d parts - %s\n",
+                        maxParts, count, u_errorName(errorCode));
+                errorCode=U_ZERO_ERROR;
+                continue;
+            }
+            for(j=0, start=0; j<count; start=limit, ++j) {
+                limit=limits[j];
+                /* each part ends at a paragraph limit */
+                if(limit<=start ||
+                        (ubidi_getParagraph(pBiDi, limit-1, NULL, &k, NULL, &errorCode), k!=limit)) {
+                    log_err("ubidi_splitParagraphs(maxParts=%d) part %d ends at %d, "
+                            "not at a paragraph limit\n", maxParts, j, limit);
+                    break;
+                }
+                /* with the same levels as in the whole text */
+                ubidi_setPara(pPart, src+start, limit-start, splitParaLevels[i], NULL, &errorCode);
+                if(U_FAILURE(errorCode) ||
+                        uprv_memcmp(ubidi_getLevels(pPart, &errorCode), levels+start, limit-start)!=0) {
+                    log_err("ubidi_setPara(part %d of %d, %d..%d, paraLevel=%d) levels differ "
+                            "from the whole text's - %s\n",
+                            j, count, start, limit, splitParaLevels[i], u_errorName(errorCode));
+                    errorCode=U_ZERO_ERROR;
+                    break;
+                }
+            }
+        }
+    }
+    /* a text without paragraph separators is one part */
+    count=ubidi_splitParagraphs(src, 5, limits, 4, &errorCode);
+    if(U_FAILURE(errorCode) || count!=1 || limits[0]!=5) {
+        log_err("ubidi_splitParagraphs(one paragraph) returned %d parts - %s\n",
+                count, u_errorName(errorCode));
+    }
+    errorCode=U_ZERO_ERROR;
+    count=ubidi_splitParagraphs(src, 0, limits, 4, &errorCode);
+    if(U_FAILURE(errorCode) || count!=0) {
+        log_err("ubidi_splitParagraphs(empty text) returned %d parts - %s\n",
+                count, u_errorName(errorCode));
+    }
+    errorCode=U_ZERO_ERROR;
+    ubidi_splitParagraphs(src, length, limits, 0, &errorCode);
+    if(errorCode!=U_ILLEGAL_ARGUMENT_ERROR) {
+        log_err("ubidi_splitParagraphs(maxParts=0) did not fail as expected - %s\n",
+                u_errorName(errorCode));
+    }
+    ubidi_close(pPart);
+    ubidi_close(pBiDi);
+
+    log_verbose("\nExiting TestSplitParagraphs\n\n");
+}
+
+static void
+testReserve(void) {
+    static const char* const text = "abc \\u05d0\\u05d1 (1-2) def\\u2029\\u05d2 [xy] 12 \\u05d3\\u05d4 ghi jkl";
+    UChar src[MAXLEN];
+    UErrorCode errorCode=U_ZERO_ERROR;
+    UBiDi *pBiDi;
+    int32_t length;
+
+    log_verbose("\nEntering TestReserve\n\n");
+    length=u_unescape(text, src, MAXLEN);
+
+    /* an object from ubidi_open() can still grow */
+    pBiDi=ubidi_open();
+    ubidi_reserve(pBiDi, 20, 4, &errorCode);
+    ubidi_setPara(pBiDi, src, 20, UBIDI_DEFAULT_LTR, NULL, &errorCode);
+    ubidi_countRuns(pBiDi, &errorCode);
+    ubidi_setPara(pBiDi, src, length, UBIDI_DEFAULT_LTR, NULL, &errorCode);
+    ubidi_countRuns(pBiDi, &errorCode);
+    if(U_FAILURE(errorCode)) {
+        log_err("ubidi_reserve() then ubidi_setPara() failed - %s\n", u_errorName(errorCode));
+    }
+    /* the text is discarded */
+    ubidi_reserve(pBiDi, length*2, 0, &errorCode);
+    ubidi_getLevels(pBiDi, &errorCode);
+    if(errorCode!=U_INVALID_STATE_ERROR) {
+        log_err("ubidi_reserve() did not discard the text - %s\n", u_errorName(errorCode));
+    }
+    ubidi_close(pBiDi);
+
+    /* an object from ubidi_openSized() can grow with ubidi_reserve() but not by itself */
+    errorCode=U_ZERO_ERROR;
+    pBiDi=ubidi_openSized(10, 0, &errorCode);
+    ubidi_reserve(pBiDi, 20, 0, &errorCode);
+    ubidi_setPara(pBiDi, src, 20, UBIDI_DEFAULT_LTR, NULL, &errorCode);
+    if(U_FAILURE(errorCode)) {
+        log_err("ubidi_openSized(10), ubidi_reserve(20) then ubidi_setPara(20) failed - %s\n",
+                u_errorName(errorCode));
+    }
+    errorCode=U_ZERO_ERROR;
+    ubidi_setPara(pBiDi, src, 21, UBIDI_DEFAULT_LTR, NULL, &errorCode);
+    if(errorCode!=U_MEMORY_ALLOCATION_ERROR) {
+        log_err("ubidi_openSized(10), ubidi_reserve(20) then ubidi_setPara(21) "
+                "did not fail as expected - %s\n", u_errorName(errorCode));
+    }
+    errorCode=U_ZERO_ERROR;
+    ubidi_reserve(pBiDi, -1, 0, &errorCode);
+    if(errorCode!=U_ILLEGAL_ARGUMENT_ERROR) {
+        log_err("ubidi_reserve(maxLength=-1) did not fail as expected - %s\n", u_errorName(errorCode));
+    }
+    ubidi_close(pBiDi);
+
+    log_verbose("\nExiting TestReserve\n\n");
+}
@@ -1,7 +1,7 @@
 /*
 *******************************************************************************
 *
-*   Copyright (C) 2002-2015, International Business Machines
+*   Copyright (C) 2002-2016, International Business Machines
 *   Corporation and others.  All Rights Reserved.
 *
 *******************************************************************************
@@ -1033,6 +1033,144 @@ TestUCaseInsensitivePrefixMatch(void) {
     }
 }
 
+/* Latin-1 fast path tables vs. the full ucase functions */
+static void
+TestLatin1CaseMappingTables(void) {
+    const UCaseProps *csp=ucase_getSingleton();
+    const UChar *s;
+    UChar32 c;
+    int32_t i, locCache, result, expected;
+
+    for(c=0; c<=0xff; ++c) {
+        for(i=0; i<3; ++i) {
+            locCache=UCASE_LOC_ROOT;
+            if(i==0) {
+                result=ucase_toFullLower(csp, c, NULL, NULL, &s, "", &locCache);
+            } else if(i==1) {
+                result=ucase_toFullUpper(csp, c, NULL, NULL, &s, "", &locCache);
+            } else {
+                result=ucase_toFullFolding(csp, c, &s, U_FOLD_CASE_DEFAULT);
+            }
+            if(result<0) {
+                expected=~result;
+            } else if(result<=UCASE_MAX_STRING_LENGTH || result>0xffff) {
+                expected=USTRCASE_LATIN1_SPECIAL;
+            } else {
+                expected=result;
+            }
+            result= i==0 ? ustrcase_latin1ToLower[c] :
+                    i==1 ? ustrcase_latin1ToUpper[c] : ustrcase_latin1Fold[c];
+            if(result!=expected) {
+                log_err("Latin-1 case mapping table %d[U+%04lx]=U+%04lx but ucase has U+%04lx\n",
+                        (int)i, (long)c, (long)result, (long)expected);
+            }
+        }
+    }
+}
+
+/*
+ * Runs of Latin-1 characters which take the fast path,
+ * interrupted by characters which need the full case mapping functions.
+ */
+static void
+TestLatin1FastPath(void) {
+    static const char *const src=
+        "Ab\\u00c0\\u00e9\\u00df\\u00b5\\u00ff\\u00d7 \\u0130\\u03a3x\\U00010400Z The QUICK br\\u00d6wn fox";
+    static const char *const expected[3]={
+        "ab\\u00e0\\u00e9\\u00df\\u00b5\\u00ff\\u00d7 i\\u0307\\u03c3x\\U00010428z the quick br\\u00f6wn fox",
+        "AB\\u00c0\\u00c9SS\\u039c\\u0178\\u00d7 \\u0130\\u03a3X\\U00010400Z THE QUICK BR\\u00d6WN FOX",
+        "ab\\u00e0\\u00e9ss\\u03bc\\u00ff\\u00d7 i\\u0307\\u03c3x\\U00010428z the quick br\\u00f6wn fox"
+    };
+    static const char *const names[3]={ "lower", "upper", "fold" };
+    UChar src16[80], exp16[80], dest16[80];
+    char src8[160], exp8[160], dest8[160];
+    int32_t srcLength16, expLength16, srcLength8, expLength8;
+    int32_t i, capacity, length;
+    UCaseMap *csm;
+    UErrorCode errorCode=U_ZERO_ERROR;
+
+    csm=ucasemap_open("", 0, &errorCode);
+    if(U_FAILURE(errorCode)) {
+        log_err("ucasemap_open(root) failed - %s\n", u_errorName(errorCode));
+        return;
+    }
+    srcLength16=u_unescape(src, src16, UPRV_LENGTHOF(src16));
+    u_strToUTF8(src8, (int32_t)sizeof(src8), &srcLength8, src16, srcLength16, &errorCode);
+    for(i=0; i<3; ++i) {
+        expLength16=u_unescape(expected[i], exp16, UPRV_LENGTHOF(exp16));
+        u_strToUTF8(exp8, (int32_t)sizeof(exp8), &expLength8, exp16, expLength16, &errorCode);
+
+        /* all capacities, to cover preflighting in the middle of a fast path run */
+        for(capacity=0; capacity<=expLength16+1; ++capacity) {
+            errorCode=U_ZERO_ERROR;
+            u_memset(dest16, 0xffff, UPRV_LENGTHOF(dest16));
+            if(i==0) {
+                length=u_strToLower(dest16, capacity, src16, srcLength16, "", &errorCode);
+            } else if(i==1) {
+                length=u_strToUpper(dest16, capacity, src16, srcLength16, "", &errorCode);
+            } else {
+                length=u_strFoldCase(dest16, capacity, src16, srcLength16, U_FOLD_CASE_DEFAULT, &errorCode);
+            }
+            if( length!=expLength16 ||
+                (capacity<expLength16 ? errorCode!=U_BUFFER_OVERFLOW_ERROR : U_FAILURE(errorCode)) ||
+                (capacity>=expLength16 && 0!=u_memcmp(dest16, exp16, expLength16)) ||
+                dest16[capacity]!=0xffff
+            ) {
+                log_err("UTF-16 %s with capacity %ld: wrong result, length %ld, or %s\n",
+                        names[i], (long)capacity, (long)length, u_errorName(errorCode));
+            }
+        }
+        for(capacity=0; capacity<=expLength8+1; ++capacity) {
+            errorCode=U_ZERO_ERROR;
+            memset(dest8, 0x55, sizeof(dest8));
+            if(i==0) {
+                length=ucasemap_utf8ToLower(csm, dest8, capacity, src8, srcLength8, &errorCode);
+            } else if(i==1) {
+                length=ucasemap_utf8ToUpper(csm, dest8, capacity, src8, srcLength8, &errorCode);
+            } else {
+                length=ucasemap_utf8FoldCase(csm, dest8, capacity, src8, srcLength8, &errorCode);
+            }
+            if( length!=expLength8 ||
+                (capacity<expLength8 ? errorCode!=U_BUFFER_OVERFLOW_ERROR : U_FAILURE(errorCode)) ||
+                (capacity>=expLength8 && 0!=memcmp(dest8, exp8, expLength8)) ||
+                dest8[capacity]!=0x55
+            ) {
+                log_err("UTF-8 %s with capacity %ld: wrong result, length %ld, or %s\n",
+                        names[i], (long)capacity, (long)length, u_errorName(errorCode));
+            }
+        }
+    }
+
+    /* Turkic and Lithuanian mappings of Latin-1 letters must bypass the fast path */
+    errorCode=U_ZERO_ERROR;
+    src16[0]=0x49;
+    src16[1]=0xcc;
+    length=u_strToLower(dest16, UPRV_LENGTHOF(dest16), src16, 1, "tr", &errorCode);
+    if(U_FAILURE(errorCode) || length!=1 || dest16[0]!=0x131) {
+        log_err("u_strToLower(I, tr) did not yield dotless i\n");
+    }
+    src16[0]=0x69;
+    length=u_strToUpper(dest16, UPRV_LENGTHOF(dest16), src16, 1, "az", &errorCode);
+    if(U_FAILURE(errorCode) || length!=1 || dest16[0]!=0x130) {
+        log_err("u_strToUpper(i, az) did not yield dotted capital I\n");
+    }
+    src16[0]=0x49;
+    length=u_strFoldCase(dest16, UPRV_LENGTHOF(dest16), src16, 1, U_FOLD_CASE_EXCLUDE_SPECIAL_I, &errorCode);
+    if(U_FAILURE(errorCode) || length!=1 || dest16[0]!=0x131) {
+        log_err("u_strFoldCase(I, EXCLUDE_SPECIAL_I) did not yield dotless i\n");
+    }
+    length=u_strToLower(dest16, UPRV_LENGTHOF(dest16), src16+1, 1, "lt", &errorCode);
+    if(U_FAILURE(errorCode) || length!=3 || dest16[0]!=0x69 || dest16[1]!=0x307 || dest16[2]!=0x300) {
+        log_err("u_strToLower(U+00CC, lt) did not yield i+dot above+grave\n");
+    }
+    ucasemap_setLocale(csm, "tr", &errorCode);
+    length=ucasemap_utf8ToLower(csm, dest8, (int32_t)sizeof(dest8), "I", 1, &errorCode);
+    if(U_FAILURE(errorCode) || length!=2 || 0!=memcmp(dest8, "\xc4\xb1", 2)) {
+        log_err("ucasemap_utf8ToLower(I, tr) did not yield dotless i\n");
+    }
+    ucasemap_close(csm);
+}
+
 void addCaseTest(TestNode** root);
 
 void addCaseTest(TestNode** root) {
@@ -1050,4 +1188,6 @@ void addCaseTest(TestNode** root) {
     addTest(root, &TestUCaseMapToTitle, "tsutil/cstrcase/TestUCaseMapToTitle");
 #endif
     addTest(root, &TestUCaseInsensitivePrefixMatch, "tsutil/cstrcase/TestUCaseInsensitivePrefixMatch");
+    addTest(root, &TestLatin1CaseMappingTables, "tsutil/cstrcase/TestLatin1CaseMappingTables");
+    addTest(root, &TestLatin1FastPath, "tsutil/cstrcase/TestLatin1FastPath");
 }
@@ -1,6 +1,6 @@
 /********************************************************************
  * COPYRIGHT:
- * Copyright (c) 1997-2015, International Business Machines Corporation and
+ * Copyright (c) 1997-2016, International Business Machines Corporation and
  * others. All Rights Reserved.
  ********************************************************************/
 /*******************************************************************************
@@ -60,6 +60,7 @@ static void TestConsistency(void);
 static void TestUCase(void);
 static void TestUBiDiProps(void);
 static void TestCaseFolding(void);
+static void TestBulkProperties(void);
 
 /* internal methods used */
 static int32_t MakeProp(char* str);
@@ -197,6 +198,7 @@ void addUnicodeTest(TestNode** root)
     addTest(root, &TestUCase, "tsutil/cucdtst/TestUCase");
     addTest(root, &TestUBiDiProps, "tsutil/cucdtst/TestUBiDiProps");
     addTest(root, &TestCaseFolding, "tsutil/cucdtst/TestCaseFolding");
+    addTest(root, &TestBulkProperties, "tsutil/cucdtst/TestBulkProperties");
 }
 
 /*==================================================== */
@@ -1600,6 +1602,9 @@ static const struct {
     {0x3401, "CJK UNIFIED IDEOGRAPH-3401", "", "CJK UNIFIED IDEOGRAPH-3401" },
     {0x7fed, "CJK UNIFIED IDEOGRAPH-7FED", "", "CJK UNIFIED IDEOGRAPH-7FED" },
     {0xac00, "HANGUL SYLLABLE GA", "", "HANGUL SYLLABLE GA" },
+    {0xac02, "HANGUL SYLLABLE GAGG", "", "HANGUL SYLLABLE GAGG" },
+    {0xae4c, "HANGUL SYLLABLE GGA", "", "HANGUL SYLLABLE GGA" },
+    {0xc544, "HANGUL SYLLABLE A", "", "HANGUL SYLLABLE A" },
     {0xd7a3, "HANGUL SYLLABLE HIH", "", "HANGUL SYLLABLE HIH" },
     {0xd800, "", "", "<lead surrogate-D800>" },
     {0xdc00, "", "", "<trail surrogate-DC00>" },
@@ -3550,3 +3555,179 @@ TestCaseFolding() {
 
     uset_close(data.notSeen);
 }
+
+/* bulk property lookups over strings --------------------------------------- */
+
+static const UChar bulkText16[]={
+    0x61, 0x31, 0x20, 0x915, 0x93f, 0xd83d, 0xde00, 0xdc00, 0x78, 0x5d0, 0xa0, 0xd800, 0
+};
+
+/* includes a truncated sequence, a stray trail byte, non-shortest forms and a surrogate */
+static const char bulkText8[]=
+    "a1 \xe0\xa4\x95\xe0\xa4\xbf\xf0\x9f\x98\x80\xe0\xa4x\x80\xd7\x90\xc0\x80\xc2\xa0\xe0\x80\x80\xed\xa0\x80\xed\x9f\xbf\xef\xbf\xbd";
+
+static const UProperty bulkProps[]={
+    UCHAR_GENERAL_CATEGORY, UCHAR_GENERAL_CATEGORY_MASK, UCHAR_SCRIPT,
+    UCHAR_BIDI_CLASS, UCHAR_WHITE_SPACE, UCHAR_ALPHABETIC, UCHAR_LINE_BREAK,
+    UCHAR_INVALID_CODE
+};
+
+/* collects the code points of the test strings the way the bulk functions see them */
+static int32_t
+getBulkCodePoints16(const UChar *s, int32_t length, UChar32 *cps) {
+    int32_t i=0, count=0;
+    UChar32 c;
+    while(i<length) {
+        U16_NEXT(s, i, length, c);
+        cps[count++]=c;
+    }
+    return count;
+}
+
+static int32_t
+getBulkCodePoints8(const char *s, int32_t length, UChar32 *cps, int32_t *limits) {
+    const uint8_t *s8=(const uint8_t *)s;
+    int32_t i=0, count=0;
+    UChar32 c;
+    while(i<length) {
+        U8_NEXT(s8, i, length, c);
+        cps[count]=c<0 ? 0xfffd : c;
+        limits[count++]=i;
+    }
+    return count;
+}
+
+static void
+TestBulkProperties() {
+    UChar32 cps[64];
+    int32_t limits[64];
+    int8_t types[64];
+    int32_t values[64];
+    UErrorCode errorCode;
+    int32_t length16=u_strlen(bulkText16);
+    int32_t length8=(int32_t)strlen(bulkText8);
+    int32_t count16=getBulkCodePoints16(bulkText16, length16, cps);
+    int32_t count8, count, i, p, expected;
+
+    /* u_strCharTypes() */
+    errorCode=U_ZERO_ERROR;
+    count=u_strCharTypes(bulkText16, -1, types, UPRV_LENGTHOF(types), &errorCode);
+    if(U_FAILURE(errorCode) || count!=count16) {
+        log_err("u_strCharTypes() returned %ld %s, expected %ld\n",
+                (long)count, u_errorName(errorCode), (long)count16);
+        return;
+    }
+    for(i=0; i<count; ++i) {
+        if(types[i]!=u_charType(cps[i])) {
+            log_err("u_strCharTypes()[%ld] for U+%04lx = %d != u_charType() = %d\n",
+                    (long)i, (long)cps[i], types[i], u_charType(cps[i]));
+        }
+    }
+
+    /* preflighting */
+    errorCode=U_ZERO_ERROR;
+    count=u_strCharTypes(bulkText16, length16, NULL, 0, &errorCode);
+    if(errorCode!=U_BUFFER_OVERFLOW_ERROR || count!=count16) {
+        log_err("u_strCharTypes(preflighting) returned %ld %s, expected %ld U_BUFFER_OVERFLOW_ERROR\n",
+                (long)count, u_errorName(errorCode), (long)count16);
+    }
+    errorCode=U_ZERO_ERROR;
+    types[2]=-1;
+    count=u_strCharTypes(bulkText16, length16, types, 2, &errorCode);
+    if(errorCode!=U_BUFFER_OVERFLOW_ERROR || count!=count16 || types[2]!=-1) {
+        log_err("u_strCharTypes(capacity 2) returned %ld %s or wrote past the capacity\n",
+                (long)count, u_errorName(errorCode));
+    }
+    errorCode=U_ZERO_ERROR;
+    u_strCharTypes(NULL, 1, types, UPRV_LENGTHOF(types), &errorCode);
+    if(errorCode!=U_ILLEGAL_ARGUMENT_ERROR) {
+        log_err("u_strCharTypes(NULL, 1) did not set U_ILLEGAL_ARGUMENT_ERROR but %s\n",
+                u_errorName(errorCode));
+    }
+
+    /* u_strCharTypesUTF8() */
+    count8=getBulkCodePoints8(bulkText8, length8, cps, limits);
+    errorCode=U_ZERO_ERROR;
+    count=u_strCharTypesUTF8(bulkText8, -1, types, UPRV_LENGTHOF(types), &errorCode);
+    if(U_FAILURE(errorCode) || count!=count8) {
+        log_err("u_strCharTypesUTF8() returned %ld %s, expected %ld\n",
+                (long)count, u_errorName(errorCode), (long)count8);
+        return;
+    }
+    for(i=0; i<count; ++i) {
+        if(types[i]!=u_charType(cps[i])) {
+            log_err("u_strCharTypesUTF8()[%ld] for U+%04lx = %d != u_charType() = %d\n",
+                    (long)i, (long)cps[i], types[i], u_charType(cps[i]));
+        }
+    }
+
+    /* u_strGetIntPropertyValues() and u_strGetIntPropertyValuesUTF8() */
+    for(p=0; p<UPRV_LENGTHOF(bulkProps); ++p) {
+        UProperty which=bulkProps[p];
+
+        count16=getBulkCodePoints16(bulkText16, length16, cps);
+        errorCode=U_ZERO_ERROR;
+        count=u_strGetIntPropertyValues(bulkText16, length16, which,
+                                        values, UPRV_LENGTHOF(values), &errorCode);
+        if(U_FAILURE(errorCode) || count!=count16) {
+            log_err("u_strGetIntPropertyValues(%d) returned %ld %s, expected %ld\n",
+                    which, (long)count, u_errorName(errorCode), (long)count16);
+            continue;
+        }
+        for(i=0; i<count; ++i) {
+            expected=u_getIntPropertyValue(cps[i], which);
+            if(values[i]!=expected) {
+                log_err("u_strGetIntPropertyValues(%d)[%ld] for U+%04lx = %ld != %ld\n",
+                        which, (long)i, (long)cps[i], (long)values[i], (long)expected);
+            }
+        }
+
+        count8=getBulkCodePoints8(bulkText8, length8, cps, limits);
+        errorCode=U_ZERO_ERROR;
+        count=u_strGetIntPropertyValuesUTF8(bulkText8, length8, which,
+                                            values, UPRV_LENGTHOF(values), &errorCode);
+        if(U_FAILURE(errorCode) || count!=count8) {
+            log_err("u_strGetIntPropertyValuesUTF8(%d) returned %ld %s, expected %ld\n",
+                    which, (long)count, u_errorName(errorCode), (long)count8);
+            continue;
+        }
+        for(i=0; i<count; ++i) {
+            expected=u_getIntPropertyValue(cps[i], which);
+            if(values[i]!=expected) {
+                log_err("u_strGetIntPropertyValuesUTF8(%d)[%ld] for U+%04lx = %ld != %ld\n",
+                        which, (long)i, (long)cps[i], (long)values[i], (long)expected);
+            }
+        }
+    }
+    errorCode=U_ZERO_ERROR;
+    count=u_strGetIntPropertyValuesUTF8(bulkText8, length8, UCHAR_SCRIPT, values, 1, &errorCode);
+    if(errorCode!=U_BUFFER_OVERFLOW_ERROR || count!=count8) {
+        log_err("u_strGetIntPropertyValuesUTF8(capacity 1) returned %ld %s, expected %ld U_BUFFER_OVERFLOW_ERROR\n",
+                (long)count, u_errorName(errorCode), (long)count8);
+    }
+
+    /* spans: "a1 " are L&, Nd, Zs; then Devanagari */
+    if( (i=u_strSpanIntPropertyValue(bulkText16, -1, UCHAR_GENERAL_CATEGORY_MASK, U_GC_L_MASK|U_GC_N_MASK))!=2 ||
+        (i=u_strSpanIntPropertyValue(bulkText16, -1, UCHAR_GENERAL_CATEGORY, U_LOWERCASE_LETTER))!=1 ||
+        (i=u_strSpanIntPropertyValue(bulkText16, -1, UCHAR_GENERAL_CATEGORY, 99))!=0 ||
+        (i=u_strSpanIntPropertyValue(bulkText16, -1, UCHAR_WHITE_SPACE, 0))!=2 ||
+        (i=u_strSpanIntPropertyValue(bulkText16+3, 2, UCHAR_SCRIPT, USCRIPT_DEVANAGARI))!=2 ||
+        (i=u_strSpanIntPropertyValue(bulkText16+5, -1, UCHAR_GENERAL_CATEGORY, U_OTHER_SYMBOL))!=2 ||
+        (i=u_strSpanIntPropertyValue(bulkText16+7, -1, UCHAR_GENERAL_CATEGORY, U_SURROGATE))!=1 ||
+        (i=u_strSpanIntPropertyValue(bulkText16+11, 1, UCHAR_GENERAL_CATEGORY, U_SURROGATE))!=1 ||
+        (i=u_strSpanIntPropertyValue(bulkText16, 0, UCHAR_WHITE_SPACE, 0))!=0 ||
+        (i=u_strSpanIntPropertyValue(NULL, 5, UCHAR_WHITE_SPACE, 0))!=0
+    ) {
+        log_err("u_strSpanIntPropertyValue() returned unexpected %ld\n", (long)i);
+    }
+    if( (i=u_strSpanIntPropertyValueUTF8(bulkText8, -1, UCHAR_GENERAL_CATEGORY_MASK, U_GC_L_MASK|U_GC_N_MASK))!=2 ||
+        (i=u_strSpanIntPropertyValueUTF8(bulkText8, -1, UCHAR_WHITE_SPACE, 0))!=2 ||
+        (i=u_strSpanIntPropertyValueUTF8(bulkText8+3, -1, UCHAR_SCRIPT, USCRIPT_DEVANAGARI))!=6 ||
+        (i=u_strSpanIntPropertyValueUTF8(bulkText8+3, -1, UCHAR_GENERAL_CATEGORY_MASK, U_GC_M_MASK|U_GC_L_MASK))!=6 ||
+        (i=u_strSpanIntPropertyValueUTF8(bulkText8+9, 4, UCHAR_GENERAL_CATEGORY, U_OTHER_SYMBOL))!=4 ||
+        (i=u_strSpanIntPropertyValueUTF8(bulkText8+13, -1, UCHAR_GENERAL_CATEGORY, U_OTHER_SYMBOL))!=2 ||
+        (i=u_strSpanIntPropertyValueUTF8(bulkText8, 0, UCHAR_WHITE_SPACE, 0))!=0
+    ) {
+        log_err("u_strSpanIntPropertyValueUTF8() returned unexpected %ld\n", (long)i);
+    }
+}
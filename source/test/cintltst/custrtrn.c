@@ -1,6 +1,6 @@
 /********************************************************************
  * COPYRIGHT:
- * Copyright (c) 2001-2014, International Business Machines Corporation and
+ * Copyright (c) 2001-2016, International Business Machines Corporation and
  * others. All Rights Reserved.
  ********************************************************************/
 /********************************************************************************
@@ -42,6 +42,8 @@ static void Test_WCHART_LongString(void);
 static void Test_strToJavaModifiedUTF8(void);
 static void Test_strFromJavaModifiedUTF8(void);
 static void TestNullEmptySource(void);
+static void TestValidateUTF(void);
+static void TestFromUTF8ASCIIRuns(void);
 
 void 
 addUCharTransformTest(TestNode** root)
@@ -61,6 +63,8 @@ addUCharTransformTest(TestNode** root)
    addTest(root, &Test_strToJavaModifiedUTF8,  "custrtrn/Test_strToJavaModifiedUTF8");
    addTest(root, &Test_strFromJavaModifiedUTF8,  "custrtrn/Test_strFromJavaModifiedUTF8");
    addTest(root, &TestNullEmptySource,  "custrtrn/TestNullEmptySource");
+   addTest(root, &TestValidateUTF,  "custrtrn/TestValidateUTF");
+   addTest(root, &TestFromUTF8ASCIIRuns,  "custrtrn/TestFromUTF8ASCIIRuns");
 }
 
 static const UChar32 src32[]={
@@ -2119,3 +2123,159 @@ static void TestNullEmptySource() {
 
 #endif
 }
+
+static void TestValidateUTF() {
+    static const struct {
+        const char *s;
+        int32_t errorOffset;
+    } cases8[]={
+        { "", -1 },
+        { "abc", -1 },
+        { "a\xc2\x80\xdf\xbf", -1 },
+        { "\xe0\xa0\x80\xed\x9f\xbf\xee\x80\x80\xef\xbf\xbf", -1 },  /* includes noncharacter U+FFFF */
+        { "\xf0\x90\x80\x80\xf4\x8f\xbf\xbf", -1 },
+        { "ab\x80", 2 },            /* stray trail byte */
+        { "\xc0\x80", 0 },          /* non-shortest NUL */
+        { "a\xc1\xbf", 1 },
+        { "ab\xe0\x9f\xbf", 2 },    /* non-shortest 3-byte form */
+        { "\xed\xa0\x80", 0 },      /* lead surrogate */
+        { "\xc3\xa4\xed\xbf\xbf", 2 },  /* trail surrogate */
+        { "\xf0\x8f\xbf\xbf", 0 },  /* non-shortest 4-byte form */
+        { "\xf4\x90\x80\x80", 0 },  /* U+110000 */
+        { "\xf5\x80\x80\x80", 0 },
+        { "abc\xe4\xb8", 3 },       /* truncated */
+        { "\xe4\xb8\xad\xf0\x9f\x98", 3 },
+        { "\xc3z", 0 },
+        { "\xfe", 0 },
+        { "abcdefghijklmnop\xff", 16 }
+    };
+    char buffer[100];
+    UChar buffer16[100];
+    UErrorCode errorCode;
+    int32_t i, prefix, length, expected, result;
+
+    for(i=0; i<UPRV_LENGTHOF(cases8); ++i) {
+        /* prefix with various amounts of ASCII to exercise the word-at-a-time loop */
+        for(prefix=0; prefix<=19; ++prefix) {
+            length=(int32_t)strlen(cases8[i].s);
+            memset(buffer, 'x', prefix);
+            memcpy(buffer+prefix, cases8[i].s, length+1);
+            length+=prefix;
+            expected=cases8[i].errorOffset<0 ? -1 : prefix+cases8[i].errorOffset;
+
+            errorCode=U_ZERO_ERROR;
+            result=u_validateUTF8(buffer, length, &errorCode);
+            if(U_FAILURE(errorCode) || result!=expected) {
+                log_err("u_validateUTF8(case %ld, prefix %ld)=%ld %s, expected %ld\n",
+                        (long)i, (long)prefix, (long)result, u_errorName(errorCode), (long)expected);
+            }
+            errorCode=U_ZERO_ERROR;
+            result=u_validateUTF8(buffer, -1, &errorCode);
+            if(U_FAILURE(errorCode) || result!=expected) {
+                log_err("u_validateUTF8(case %ld, prefix %ld, NUL-terminated)=%ld %s, expected %ld\n",
+                        (long)i, (long)prefix, (long)result, u_errorName(errorCode), (long)expected);
+            }
+
+            /* consistent with the strict conversion function */
+            errorCode=U_ZERO_ERROR;
+            u_strFromUTF8WithSub(buffer16, UPRV_LENGTHOF(buffer16), NULL,
+                                 buffer, length, U_SENTINEL, NULL, &errorCode);
+            if((errorCode==U_INVALID_CHAR_FOUND)!=(expected>=0)) {
+                log_err("u_validateUTF8(case %ld, prefix %ld) inconsistent with u_strFromUTF8WithSub() - %s\n",
+                        (long)i, (long)prefix, u_errorName(errorCode));
+            }
+        }
+    }
+
+    /* UTF-16: put an unpaired surrogate at every position of a longer string */
+    for(i=0; i<40; ++i) {
+        for(length=0; length<40; ++length) {
+            buffer16[length]=(UChar)(0x61+length);
+        }
+        buffer16[40]=0xd83d;
+        buffer16[41]=0xde00;
+        buffer16[42]=0;
+        length=42;
+        errorCode=U_ZERO_ERROR;
+        result=u_validateUTF16(buffer16, -1, &errorCode);
+        if(U_FAILURE(errorCode) || result!=-1) {
+            log_err("u_validateUTF16(well-formed)=%ld %s\n", (long)result, u_errorName(errorCode));
+        }
+        buffer16[i]=(i&1) ? 0xdc00 : 0xd800;
+        errorCode=U_ZERO_ERROR;
+        result=u_validateUTF16(buffer16, length, &errorCode);
+        if(U_FAILURE(errorCode) || result!=i) {
+            log_err("u_validateUTF16(unpaired U+%04x at %ld)=%ld %s\n",
+                    buffer16[i], (long)i, (long)result, u_errorName(errorCode));
+        }
+        /* a lead surrogate at the end, and a well-formed pair right before i */
+        if(i>0) {
+            buffer16[i-1]=0xd800;
+            buffer16[i]=0xdc00;
+            errorCode=U_ZERO_ERROR;
+            result=u_validateUTF16(buffer16, 41, &errorCode);
+            if(U_FAILURE(errorCode) || result!=40) {
+                log_err("u_validateUTF16(pair at %ld, lead at end)=%ld %s, expected 40\n",
+                        (long)(i-1), (long)result, u_errorName(errorCode));
+            }
+        }
+    }
+
+    errorCode=U_ZERO_ERROR;
+    if(u_validateUTF8(NULL, 0, &errorCode)!=-1 || U_FAILURE(errorCode)) {
+        log_err("u_validateUTF8(NULL, 0) failed - %s\n", u_errorName(errorCode));
+    }
+    u_validateUTF16(NULL, 3, &errorCode);
+    if(errorCode!=U_ILLEGAL_ARGUMENT_ERROR) {
+        log_err("u_validateUTF16(NULL, 3) did not set U_ILLEGAL_ARGUMENT_ERROR - %s\n",
+                u_errorName(errorCode));
+    }
+}
+
+/* ASCII runs of various lengths between non-ASCII characters */
+static void TestFromUTF8ASCIIRuns() {
+    char src[2000];
+    UChar expected[1000], dest[1000];
+    int32_t srcLength=0, expectedLength=0, destLength, run, i;
+    UErrorCode errorCode=U_ZERO_ERROR;
+
+    for(run=0; run<=33; ++run) {
+        for(i=0; i<run; ++i) {
+            src[srcLength++]=(char)(0x20+(run+i)%0x5f);
+            expected[expectedLength++]=(UChar)(0x20+(run+i)%0x5f);
+        }
+        if(run&1) {
+            memcpy(src+srcLength, "\xc3\xa4", 2);
+            srcLength+=2;
+            expected[expectedLength++]=0xe4;
+        } else {
+            memcpy(src+srcLength, "\xe4\xb8\xad", 3);
+            srcLength+=3;
+            expected[expectedLength++]=0x4e2d;
+        }
+    }
+    for(i=0; i<40; ++i) {
+        src[srcLength++]='z';
+        expected[expectedLength++]=0x7a;
+    }
+
+    u_strFromUTF8WithSub(dest, UPRV_LENGTHOF(dest), &destLength,
+                         src, srcLength, U_SENTINEL, NULL, &errorCode);
+    if(U_FAILURE(errorCode) || destLength!=expectedLength ||
+            0!=memcmp(dest, expected, expectedLength*U_SIZEOF_UCHAR)) {
+        log_err("u_strFromUTF8WithSub(ASCII runs) failed - %s\n", u_errorName(errorCode));
+    }
+
+    /* same with various destination capacities */
+    for(i=1; i<expectedLength; i+=7) {
+        errorCode=U_ZERO_ERROR;
+        u_memset(dest, 0xffff, UPRV_LENGTHOF(dest));
+        u_strFromUTF8WithSub(dest, i, &destLength,
+                             src, srcLength, U_SENTINEL, NULL, &errorCode);
+        if(errorCode!=U_BUFFER_OVERFLOW_ERROR || destLength!=expectedLength ||
+                0!=memcmp(dest, expected, i*U_SIZEOF_UCHAR) || dest[i]!=0xffff) {
+            log_err("u_strFromUTF8WithSub(ASCII runs, capacity %ld) failed - %s\n",
+                    (long)i, u_errorName(errorCode));
+        }
+    }
+}
@@ -1,6 +1,6 @@
 /********************************************************************
  * COPYRIGHT: 
- * Copyright (c) 2009-2015, International Business Machines Corporation and
+ * Copyright (c) 2009-2016, International Business Machines Corporation and
  * others. All Rights Reserved.
  ********************************************************************/
 /********************************************************************************
@@ -26,6 +26,7 @@
 #include "unicode/uspoof.h"
 #include "unicode/ustring.h"
 #include "unicode/uset.h"
+#include "cmemory.h"
 #include "cintltst.h"
 
 #define TEST_ASSERT_SUCCESS(status) {if (U_FAILURE(status)) { \
@@ -64,6 +65,7 @@ log_err("Test Failure at file %s, line %d: \"%s\" is false.\n", __FILE__, __LINE
 
 static void TestOpenFromSource(void);
 static void TestUSpoofCAPI(void);
+static void TestSkeletonIndex(void);
 
 void addUSpoofTest(TestNode** root);
 
@@ -73,6 +75,7 @@ void addUSpoofTest(TestNode** root)
     addTest(root, &TestOpenFromSource, "uspoof/TestOpenFromSource");
 #endif
     addTest(root, &TestUSpoofCAPI, "uspoof/TestUSpoofCAPI");
+    addTest(root, &TestSkeletonIndex, "uspoof/TestSkeletonIndex");
 }
 
 /*
@@ -154,6 +157,35 @@ static void TestOpenFromSource() {
     TEST_ASSERT_SUCCESS(status);
     TEST_ASSERT_EQ(0, checkResults);
 
+    // The built data includes the confusables trie.
+    // Check skeletons with it, also after a serialization round trip.
+    {
+        UChar skel[20];
+        int32_t skelLength;
+        int32_t dataSize;
+        void *data;
+        USpoofChecker *ssc;
+
+        skelLength = uspoof_getSkeleton(rsc, USPOOF_ANY_CASE, lll_Cyrl, -1, skel, UPRV_LENGTHOF(skel), &status);
+        TEST_ASSERT_SUCCESS(status);
+        TEST_ASSERT_EQ(3, skelLength);
+        TEST_ASSERT(u_strcmp(lll_Skel, skel) == 0);
+
+        dataSize = uspoof_serialize(rsc, NULL, 0, &status);
+        TEST_ASSERT_EQ(U_BUFFER_OVERFLOW_ERROR, status);
+        status = U_ZERO_ERROR;
+        data = malloc(dataSize);
+        uspoof_serialize(rsc, data, dataSize, &status);
+        ssc = uspoof_openFromSerialized(data, dataSize, NULL, &status);
+        TEST_ASSERT_SUCCESS(status);
+        skelLength = uspoof_getSkeleton(ssc, USPOOF_ANY_CASE, lll_Latin_b, -1, skel, UPRV_LENGTHOF(skel), &status);
+        TEST_ASSERT_SUCCESS(status);
+        TEST_ASSERT_EQ(3, skelLength);
+        TEST_ASSERT(u_strcmp(lll_Skel, skel) == 0);
+        uspoof_close(ssc);
+        free(data);
+    }
+
     free(confusablesWholeScript);
     free(confusables);
     free(fileName);
@@ -556,4 +588,115 @@ static void TestUSpoofCAPI(void) {
 
 }
 
+/*
+ *  Skeleton index: build, serialize, reopen and look up.
+ */
+static void TestSkeletonIndex(void) {
+    TEST_SETUP
+        USpoofSkeletonIndexBuilder *builder;
+        USpoofSkeletonIndex *index = NULL;
+        uint32_t *data = NULL;
+        int32_t length, dataLength;
+        int32_t values[4];
+        int32_t count;
+        char lll_Latin_bUTF8[20];
+
+        u_strToUTF8(lll_Latin_bUTF8, sizeof(lll_Latin_bUTF8), NULL, lll_Latin_b, -1, &status);
+        builder = uspoof_openSkeletonIndexBuilder(sc, USPOOF_ANY_CASE, &status);
+        uspoof_addToSkeletonIndex(builder, lll_Latin_a, -1, 1, &status);
+        uspoof_addToSkeletonIndex(builder, goodLatin, -1, 2, &status);
+        uspoof_addToSkeletonIndex(builder, lll_Cyrl, -1, 3, &status);
+        uspoof_addToSkeletonIndex(builder, scLatin, -1, 4, &status);
+        uspoof_addToSkeletonIndexUTF8(builder, lll_Latin_bUTF8, -1, 5, &status);
+        uspoof_addToSkeletonIndex(builder, goodCyrl, 1, 6, &status);
+        TEST_ASSERT_SUCCESS(status);
+
+        length = uspoof_serializeSkeletonIndex(builder, NULL, 0, &status);
+        TEST_ASSERT_EQ(U_BUFFER_OVERFLOW_ERROR, status);
+        status = U_ZERO_ERROR;
+        data = (uint32_t *)malloc(length);
+        dataLength = uspoof_serializeSkeletonIndex(builder, data, length, &status);
+        TEST_ASSERT_SUCCESS(status);
+        TEST_ASSERT_EQ(length, dataLength);
+        uspoof_closeSkeletonIndexBuilder(builder);
+
+        index = uspoof_openSkeletonIndex(sc, data, length, &status);
+        TEST_ASSERT_SUCCESS(status);
+        if (U_SUCCESS(status)) {
+            TEST_ASSERT_EQ(6, uspoof_getSkeletonIndexSize(index));
+
+            /* All of the lll lookalikes, in order of their values. */
+            count = uspoof_findConfusables(index, lll_Latin_b, -1, values, UPRV_LENGTHOF(values), &status);
+            TEST_ASSERT_SUCCESS(status);
+            TEST_ASSERT_EQ(3, count);
+            TEST_ASSERT(values[0] == 1 && values[1] == 3 && values[2] == 5);
+
+            count = uspoof_findConfusablesUTF8(index, lll_Latin_bUTF8, -1, values, UPRV_LENGTHOF(values), &status);
+            TEST_ASSERT_SUCCESS(status);
+            TEST_ASSERT_EQ(3, count);
+
+            count = uspoof_findConfusables(index, scMixed, -1, values, UPRV_LENGTHOF(values), &status);
+            TEST_ASSERT_SUCCESS(status);
+            TEST_ASSERT_EQ(1, count);
+            TEST_ASSERT_EQ(4, values[0]);
+
+            count = uspoof_findConfusables(index, goodCyrl, 1, values, UPRV_LENGTHOF(values), &status);
+            TEST_ASSERT_SUCCESS(status);
+            TEST_ASSERT_EQ(1, count);
+            TEST_ASSERT_EQ(6, values[0]);
+
+            count = uspoof_findConfusables(index, goodGreek, -1, values, UPRV_LENGTHOF(values), &status);
+            TEST_ASSERT_SUCCESS(status);
+            TEST_ASSERT_EQ(0, count);
+
+            /* Preflighting and overflow. */
+            count = uspoof_findConfusables(index, lll_Cyrl, -1, NULL, 0, &status);
+            TEST_ASSERT_EQ(U_BUFFER_OVERFLOW_ERROR, status);
+            TEST_ASSERT_EQ(3, count);
+            status = U_ZERO_ERROR;
+            values[1] = -1;
+            count = uspoof_findConfusables(index, lll_Cyrl, -1, values, 1, &status);
+            TEST_ASSERT_EQ(U_BUFFER_OVERFLOW_ERROR, status);
+            TEST_ASSERT_EQ(3, count);
+            TEST_ASSERT_EQ(1, values[0]);
+            TEST_ASSERT_EQ(-1, values[1]);
+            status = U_ZERO_ERROR;
+        }
+        uspoof_closeSkeletonIndex(index);
+
+        /* Truncated or damaged data is rejected. */
+        index = uspoof_openSkeletonIndex(sc, data, length - 4, &status);
+        TEST_ASSERT_EQ(U_INVALID_FORMAT_ERROR, status);
+        TEST_ASSERT(index == NULL);
+        status = U_ZERO_ERROR;
+        data[0] ^= 1;
+        index = uspoof_openSkeletonIndex(sc, data, length, &status);
+        TEST_ASSERT_EQ(U_INVALID_FORMAT_ERROR, status);
+        TEST_ASSERT(index == NULL);
+        status = U_ZERO_ERROR;
+        free(data);
+
+        /* An empty index. */
+        builder = uspoof_openSkeletonIndexBuilder(sc, USPOOF_SINGLE_SCRIPT_CONFUSABLE, &status);
+        length = uspoof_serializeSkeletonIndex(builder, NULL, 0, &status);
+        status = U_ZERO_ERROR;
+        data = (uint32_t *)malloc(length);
+        uspoof_serializeSkeletonIndex(builder, data, length, &status);
+        uspoof_closeSkeletonIndexBuilder(builder);
+        index = uspoof_openSkeletonIndex(sc, data, length, &status);
+        TEST_ASSERT_SUCCESS(status);
+        count = uspoof_findConfusables(index, lll_Latin_a, -1, values, UPRV_LENGTHOF(values), &status);
+        TEST_ASSERT_SUCCESS(status);
+        TEST_ASSERT_EQ(0, count);
+        uspoof_closeSkeletonIndex(index);
+        free(data);
+
+        /* Only the skeleton type flags are allowed. */
+        builder = uspoof_openSkeletonIndexBuilder(sc, USPOOF_WHOLE_SCRIPT_CONFUSABLE, &status);
+        TEST_ASSERT_EQ(U_ILLEGAL_ARGUMENT_ERROR, status);
+        TEST_ASSERT(builder == NULL);
+        status = U_ZERO_ERROR;
+    TEST_TEARDOWN;
+}
+
 #endif  /* UCONFIG_NO_REGULAR_EXPRESSIONS */
@@ -0,0 +1,812 @@
+/*
+******************************************************************************
+*
+*   Copyright (C) 2016, International Business Machines
+*   Corporation and others.  All Rights Reserved.
+*
+******************************************************************************
+*   file name:  ucptrietest.c
+*   encoding:   US-ASCII
+*   tab size:   8 (not used)
+*   indentation:4
+*
+*   created on: 2016jan12 (starting from a copy of trie2test.c)
+*/
+
+#include <stdio.h>
+#include "unicode/utypes.h"
+#include "unicode/utf16.h"
+#include "ucptrie.h"
+#include "utrie2.h"
+#include "cstring.h"
+#include "cmemory.h"
+#include "cintltst.h"
+
+void addUCPTrieTest(TestNode** root);
+
+/* Values for setting possibly overlapping, out-of-order ranges of values */
+typedef struct SetRange {
+    UChar32 start, limit;
+    uint32_t value;
+} SetRange;
+
+/*
+ * Values for testing:
+ * value is set from the previous boundary's limit to before
+ * this boundary's limit
+ *
+ * There must be an entry with limit 0 and the intialValue.
+ * It may be preceded by an entry with negative limit and the errorValue.
+ */
+typedef struct CheckRange {
+    UChar32 limit;
+    uint32_t value;
+} CheckRange;
+
+static const char *const typeNames[UCPTRIE_TYPE_COUNT]={ "fast", "small" };
+static const char *const widthNames[UCPTRIE_VALUE_BITS_COUNT]={ "16", "32", "8" };
+
+static int32_t
+getSpecialValues(const CheckRange checkRanges[], int32_t countCheckRanges,
+                 uint32_t *pInitialValue, uint32_t *pErrorValue) {
+    int32_t i=0;
+    if(i<countCheckRanges && checkRanges[i].limit<0) {
+        *pErrorValue=checkRanges[i++].value;
+    } else {
+        *pErrorValue=0xbad;
+    }
+    if(i<countCheckRanges && checkRanges[i].limit==0) {
+        *pInitialValue=checkRanges[i++].value;
+    } else {
+        *pInitialValue=0;
+    }
+    return i;
+}
+
+static uint32_t
+getValueMask(UCPTrieValueWidth valueWidth) {
+    switch(valueWidth) {
+    case UCPTRIE_VALUE_BITS_16:
+        return 0xffff;
+    case UCPTRIE_VALUE_BITS_32:
+        return 0xffffffff;
+    default:
+        return 0xff;
+    }
+}
+
+/* ucptrie_enum() verification state */
+typedef struct EnumContext {
+    const char *testName;
+    const CheckRange *checkRanges;
+    int32_t countCheckRanges;
+    uint32_t mask;
+    int32_t i;          /* current checkRanges index */
+    UChar32 next;       /* expected start of the next range */
+    uint32_t prevValue;
+    int32_t errors;
+} EnumContext;
+
+/* ucptrie_enum() callback, modifies a value */
+static uint32_t U_CALLCONV
+testEnumValue(const void *context, uint32_t value) {
+    return value^0x5555;
+}
+
+/*
+ * ucptrie_enum() callback, verifies a range.
+ * With fewer than 32 value bits, adjacent expected ranges may enumerate as one.
+ */
+static UBool U_CALLCONV
+testEnumRange(const void *context, UChar32 start, UChar32 end, uint32_t value) {
+    EnumContext *ec=(EnumContext *)context;
+    const CheckRange *checkRanges=ec->checkRanges;
+    UChar32 c;
+
+    value^=0x5555;
+    if(ec->errors>0) {
+        return FALSE;
+    }
+    if(start!=ec->next || end<start || (start>0 && value==ec->prevValue)) {
+        log_err("error: ucptrie_enum(%s) delivers unexpected range [U+%04lx..U+%04lx].0x%lx\n",
+                ec->testName, (long)start, (long)end, (long)value);
+        ++ec->errors;
+        return FALSE;
+    }
+    for(c=start; c<=end; ++c) {
+        while(c>=checkRanges[ec->i].limit) {
+            ++ec->i;
+        }
+        if(value!=(checkRanges[ec->i].value&ec->mask)) {
+            log_err("error: ucptrie_enum(%s) delivers [U+%04lx..U+%04lx].0x%lx but U+%04lx should be 0x%lx\n",
+                    ec->testName, (long)start, (long)end, (long)value,
+                    (long)c, (long)(checkRanges[ec->i].value&ec->mask));
+            ++ec->errors;
+            return FALSE;
+        }
+    }
+    ec->next=end+1;
+    ec->prevValue=value;
+    return TRUE;
+}
+
+static void
+testTrieEnum(const char *testName,
+             const UCPTrie *trie, UCPTrieValueWidth valueWidth,
+             const CheckRange checkRanges[], int32_t countCheckRanges) {
+    EnumContext ec;
+    uint32_t initialValue, errorValue;
+    int32_t i=getSpecialValues(checkRanges, countCheckRanges, &initialValue, &errorValue);
+    ec.testName=testName;
+    ec.checkRanges=checkRanges+i;
+    ec.countCheckRanges=countCheckRanges-i;
+    ec.mask=getValueMask(valueWidth);
+    ec.i=0;
+    ec.next=0;
+    ec.prevValue=0;
+    ec.errors=0;
+    ucptrie_enum(trie, testEnumValue, testEnumRange, &ec);
+    if(ec.errors==0 && ec.next!=0x110000) {
+        log_err("error: ucptrie_enum(%s) stopped before U+10ffff, at U+%04lx\n",
+                testName, (long)ec.next);
+    }
+}
+
+/* verify all expected values via the UCPTRIE_..._GET() macros and ucptrie_get() */
+static void
+testTrieGetters(const char *testName,
+                const UCPTrie *trie, UCPTrieType type, UCPTrieValueWidth valueWidth,
+                const CheckRange checkRanges[], int32_t countCheckRanges) {
+    uint32_t initialValue, errorValue;
+    uint32_t value, value2, mask;
+    UChar32 start, limit;
+    int32_t i, countSpecials;
+    int32_t countErrors=0;
+
+    countSpecials=getSpecialValues(checkRanges, countCheckRanges, &initialValue, &errorValue);
+    mask=getValueMask(valueWidth);
+
+    start=0;
+    for(i=countSpecials; i<countCheckRanges; ++i) {
+        limit=checkRanges[i].limit;
+        value=checkRanges[i].value&mask;
+
+        while(start<limit) {
+            if(type==UCPTRIE_TYPE_FAST) {
+                if(valueWidth==UCPTRIE_VALUE_BITS_16) {
+                    value2=UCPTRIE_FAST_GET(trie, UCPTRIE_16, start);
+                } else if(valueWidth==UCPTRIE_VALUE_BITS_32) {
+                    value2=UCPTRIE_FAST_GET(trie, UCPTRIE_32, start);
+                } else {
+                    value2=UCPTRIE_FAST_GET(trie, UCPTRIE_8, start);
+                }
+            } else {
+                if(valueWidth==UCPTRIE_VALUE_BITS_16) {
+                    value2=UCPTRIE_SMALL_GET(trie, UCPTRIE_16, start);
+                } else if(valueWidth==UCPTRIE_VALUE_BITS_32) {
+                    value2=UCPTRIE_SMALL_GET(trie, UCPTRIE_32, start);
+                } else {
+                    value2=UCPTRIE_SMALL_GET(trie, UCPTRIE_8, start);
+                }
+            }
+            if(value!=value2) {
+                log_err("error: %s trie(%s).get(U+%04lx)==0x%lx instead of 0x%lx\n",
+                        typeNames[type], testName, (long)start, (long)value2, (long)value);
+                ++countErrors;
+            }
+            if(type==UCPTRIE_TYPE_FAST && valueWidth==UCPTRIE_VALUE_BITS_16) {
+                if(start<=0xffff) {
+                    value2=UCPTRIE_FAST_BMP_GET(trie, UCPTRIE_16, start);
+                } else {
+                    value2=UCPTRIE_FAST_SUPP_GET(trie, UCPTRIE_16, start);
+                }
+                if(value!=value2) {
+                    log_err("error: fast trie(%s).bmp/supp.get(U+%04lx)==0x%lx instead of 0x%lx\n",
+                            testName, (long)start, (long)value2, (long)value);
+                    ++countErrors;
+                }
+            }
+            value2=ucptrie_get(trie, start);
+            if(value!=value2) {
+                log_err("error: ucptrie_get(%s, %s, U+%04lx)==0x%lx instead of 0x%lx\n",
+                        typeNames[type], testName, (long)start, (long)value2, (long)value);
+                ++countErrors;
+            }
+            ++start;
+            if(countErrors>10) {
+                return;
+            }
+        }
+    }
+
+    /* test errorValue */
+    errorValue&=mask;
+    value=ucptrie_get(trie, -1);
+    value2=ucptrie_get(trie, 0x110000);
+    if(value!=errorValue || value2!=errorValue) {
+        log_err("error: ucptrie_get(%s, %s).get(out of range) != errorValue\n",
+                typeNames[type], testName);
+    }
+    if(type==UCPTRIE_TYPE_FAST && valueWidth==UCPTRIE_VALUE_BITS_16) {
+        value=UCPTRIE_FAST_GET(trie, UCPTRIE_16, -1);
+        value2=UCPTRIE_FAST_GET(trie, UCPTRIE_16, 0x110000);
+        if(value!=errorValue || value2!=errorValue) {
+            log_err("error: fast trie(%s).get(out of range) != errorValue\n", testName);
+        }
+    }
+}
+
+static void
+testTrieUTF16(const char *testName,
+              const UCPTrie *trie, UCPTrieValueWidth valueWidth,
+              const CheckRange checkRanges[], int32_t countCheckRanges) {
+    UChar s[200];
+    uint32_t values[100];
+
+    const UChar *p, *limit;
+
+    uint32_t value, mask;
+    UChar32 prevCP, c, c2;
+    int32_t i, length, sIndex, countValues;
+
+    /* write a string */
+    mask=getValueMask(valueWidth);
+    prevCP=0;
+    length=countValues=0;
+    for(i=getSpecialValues(checkRanges, countCheckRanges, &value, &value); i<countCheckRanges; ++i) {
+        value=checkRanges[i].value&mask;
+        /* write three code points */
+        U16_APPEND_UNSAFE(s, length, prevCP);   /* start of the range */
+        values[countValues++]=value;
+        c=checkRanges[i].limit;
+        prevCP=(prevCP+c)/2;                    /* middle of the range */
+        U16_APPEND_UNSAFE(s, length, prevCP);
+        values[countValues++]=value;
+        prevCP=c;
+        --c;                                    /* end of the range */
+        U16_APPEND_UNSAFE(s, length, c);
+        values[countValues++]=value;
+    }
+    /* an unpaired trail and lead surrogate get their code point values */
+    s[length++]=0xdc01;
+    values[countValues++]=ucptrie_get(trie, 0xdc01);
+    s[length++]=0xd800;
+    values[countValues++]=ucptrie_get(trie, 0xd800);
+    limit=s+length;
+
+    /* try forward */
+    p=s;
+    i=0;
+    while(p<limit) {
+        sIndex=(int32_t)(p-s);
+        if(valueWidth==UCPTRIE_VALUE_BITS_16) {
+            UCPTRIE_FAST_U16_NEXT(trie, UCPTRIE_16, p, limit, c, value);
+        } else if(valueWidth==UCPTRIE_VALUE_BITS_32) {
+            UCPTRIE_FAST_U16_NEXT(trie, UCPTRIE_32, p, limit, c, value);
+        } else {
+            UCPTRIE_FAST_U16_NEXT(trie, UCPTRIE_8, p, limit, c, value);
+        }
+        U16_NEXT(s, sIndex, length, c2);
+        if(c!=c2) {
+            log_err("error: wrong code point from UCPTRIE_FAST_U16_NEXT(%s): U+%04lx != U+%04lx\n",
+                    testName, (long)c, (long)c2);
+            continue;
+        }
+        if(value!=values[i]) {
+            log_err("error: wrong value from UCPTRIE_FAST_U16_NEXT(%s)(U+%04lx): 0x%lx instead of 0x%lx\n",
+                    testName, (long)c, (long)value, (long)values[i]);
+        }
+        ++i;
+    }
+}
+
+static void
+testTrieSwap(const char *testName, const void *data, int32_t length) {
+    static uint32_t swapped[10000], swappedBack[10000];
+    UDataSwapper *ds;
+    int32_t length2;
+    UErrorCode errorCode=U_ZERO_ERROR;
+
+    /* swap to the opposite platform endianness, then back again */
+    ds=udata_openSwapper(U_IS_BIG_ENDIAN, U_CHARSET_FAMILY, !U_IS_BIG_ENDIAN, U_CHARSET_FAMILY, &errorCode);
+    length2=ucptrie_swap(ds, data, -1, NULL, &errorCode);
+    if(U_FAILURE(errorCode) || length2!=length) {
+        log_err("error: ucptrie_swap(%s) preflighting returned %ld instead of %ld: %s\n",
+                testName, (long)length2, (long)length, u_errorName(errorCode));
+        udata_closeSwapper(ds);
+        return;
+    }
+    ucptrie_swap(ds, data, length, swapped, &errorCode);
+    udata_closeSwapper(ds);
+    ds=udata_openSwapper(!U_IS_BIG_ENDIAN, U_CHARSET_FAMILY, U_IS_BIG_ENDIAN, U_CHARSET_FAMILY, &errorCode);
+    ucptrie_swap(ds, swapped, length, swappedBack, &errorCode);
+    udata_closeSwapper(ds);
+    if(U_FAILURE(errorCode)) {
+        log_err("error: ucptrie_swap(%s) failed: %s\n", testName, u_errorName(errorCode));
+    } else if(0!=uprv_memcmp(data, swappedBack, length)) {
+        log_err("error: ucptrie_swap(%s) there and back does not round-trip\n", testName);
+    }
+}
+
+static void
+testTrieSerialize(const char *testName, const UCPTrie *trie,
+                  UCPTrieType type, UCPTrieValueWidth valueWidth,
+                  const CheckRange checkRanges[], int32_t countCheckRanges) {
+    uint32_t storage[10000];
+    int32_t length1, length2, length3;
+    UCPTrieType otherType;
+    UErrorCode errorCode;
+    UCPTrie *trie2;
+
+    /* clone the trie so that the caller can modify or discard the original */
+    errorCode=U_ZERO_ERROR;
+    length1=ucptrie_toBinary(trie, NULL, 0, &errorCode);
+    if(errorCode!=U_BUFFER_OVERFLOW_ERROR) {
+        log_err("error: ucptrie_toBinary(%s) preflighting set %s != U_BUFFER_OVERFLOW_ERROR\n",
+                testName, u_errorName(errorCode));
+        return;
+    }
+    errorCode=U_ZERO_ERROR;
+    length2=ucptrie_toBinary(trie, storage, sizeof(storage), &errorCode);
+    if(length1!=length2) {
+        log_err("error: trie serialization (%s) lengths different: "
+                "preflight vs. serialize\n", testName);
+    }
+    if(U_FAILURE(errorCode)) {
+        log_err("error: ucptrie_toBinary(%s) failed: %s\n", testName, u_errorName(errorCode));
+        return;
+    }
+    if((length2&3)!=0) {
+        log_err("error: trie serialization (%s) length %ld is not a multiple of 4\n",
+                testName, (long)length2);
+    }
+
+    otherType= type==UCPTRIE_TYPE_FAST ? UCPTRIE_TYPE_SMALL : UCPTRIE_TYPE_FAST;
+    errorCode=U_ZERO_ERROR;
+    trie2=ucptrie_openFromBinary(otherType, valueWidth, storage, length2, NULL, &errorCode);
+    if(errorCode!=U_INVALID_FORMAT_ERROR) {
+        log_err("error: ucptrie_openFromBinary(%s) with the wrong type is not an error: %s\n",
+                testName, u_errorName(errorCode));
+    }
+    ucptrie_close(trie2);
+
+    errorCode=U_ZERO_ERROR;
+    trie2=ucptrie_openFromBinary(type, valueWidth, storage, length2-4, NULL, &errorCode);
+    if(errorCode!=U_INVALID_FORMAT_ERROR) {
+        log_err("error: ucptrie_openFromBinary(%s) with too few bytes is not an error: %s\n",
+                testName, u_errorName(errorCode));
+    }
+    ucptrie_close(trie2);
+
+    errorCode=U_ZERO_ERROR;
+    trie2=ucptrie_openFromBinary(type, valueWidth, storage, length2, &length3, &errorCode);
+    if(U_FAILURE(errorCode)) {
+        log_err("error: ucptrie_openFromBinary(%s) failed, %s\n", testName, u_errorName(errorCode));
+        return;
+    }
+    if(length2!=length3) {
+        log_err("error: trie serialization (%s) lengths different: "
+                "serialize vs. unserialize\n", testName);
+    }
+    testTrieGetters(testName, trie2, type, valueWidth, checkRanges, countCheckRanges);
+    testTrieEnum(testName, trie2, valueWidth, checkRanges, countCheckRanges);
+    ucptrie_close(trie2);
+
+    testTrieSwap(testName, storage, length2);
+}
+
+static void
+testBuilder(const char *testName, const UMutableCPTrie *mutableTrie,
+            const CheckRange checkRanges[], int32_t countCheckRanges) {
+    char name[80];
+    int32_t type, valueWidth;
+
+    for(type=UCPTRIE_TYPE_FAST; type<UCPTRIE_TYPE_COUNT; ++type) {
+        for(valueWidth=UCPTRIE_VALUE_BITS_16; valueWidth<UCPTRIE_VALUE_BITS_COUNT; ++valueWidth) {
+            UErrorCode errorCode=U_ZERO_ERROR;
+            UCPTrie *trie=umutablecptrie_buildImmutable(mutableTrie,
+                                                        (UCPTrieType)type,
+                                                        (UCPTrieValueWidth)valueWidth,
+                                                        &errorCode);
+            if(U_FAILURE(errorCode)) {
+                log_err("error: umutablecptrie_buildImmutable(%s, %s, %s) failed: %s\n",
+                        testName, typeNames[type], widthNames[valueWidth], u_errorName(errorCode));
+                continue;
+            }
+            sprintf(name, "%s.%s.%s", testName, typeNames[type], widthNames[valueWidth]);
+            testTrieGetters(name, trie, (UCPTrieType)type, (UCPTrieValueWidth)valueWidth,
+                            checkRanges, countCheckRanges);
+            testTrieEnum(name, trie, (UCPTrieValueWidth)valueWidth, checkRanges, countCheckRanges);
+            if(type==UCPTRIE_TYPE_FAST) {
+                testTrieUTF16(name, trie, (UCPTrieValueWidth)valueWidth, checkRanges, countCheckRanges);
+            }
+            testTrieSerialize(name, trie, (UCPTrieType)type, (UCPTrieValueWidth)valueWidth,
+                              checkRanges, countCheckRanges);
+            ucptrie_close(trie);
+        }
+    }
+}
+
+static void
+testMutableGetters(const char *testName, const UMutableCPTrie *mutableTrie,
+                   const CheckRange checkRanges[], int32_t countCheckRanges) {
+    uint32_t initialValue, errorValue, value;
+    UChar32 start, limit;
+    int32_t i, countErrors=0;
+
+    i=getSpecialValues(checkRanges, countCheckRanges, &initialValue, &errorValue);
+    start=0;
+    for(; i<countCheckRanges; ++i) {
+        limit=checkRanges[i].limit;
+        for(; start<limit; ++start) {
+            value=umutablecptrie_get(mutableTrie, start);
+            if(value!=checkRanges[i].value) {
+                log_err("error: umutablecptrie_get(%s, U+%04lx)==0x%lx instead of 0x%lx\n",
+                        testName, (long)start, (long)value, (long)checkRanges[i].value);
+                if(++countErrors>10) {
+                    return;
+                }
+            }
+        }
+    }
+    if(umutablecptrie_get(mutableTrie, -1)!=errorValue ||
+            umutablecptrie_get(mutableTrie, 0x110000)!=errorValue) {
+        log_err("error: umutablecptrie_get(%s, out of range) != errorValue\n", testName);
+    }
+}
+
+static UMutableCPTrie *
+makeTrieWithRanges(const char *testName,
+                   const SetRange setRanges[], int32_t countSetRanges,
+                   const CheckRange checkRanges[], int32_t countCheckRanges) {
+    UMutableCPTrie *trie;
+    uint32_t initialValue, errorValue;
+    UErrorCode errorCode;
+    int32_t i;
+
+    getSpecialValues(checkRanges, countCheckRanges, &initialValue, &errorValue);
+    errorCode=U_ZERO_ERROR;
+    trie=umutablecptrie_open(initialValue, errorValue, &errorCode);
+    if(U_FAILURE(errorCode)) {
+        log_err("error: umutablecptrie_open(%s) failed: %s\n", testName, u_errorName(errorCode));
+        return NULL;
+    }
+
+    /* set values from setRanges[] */
+    for(i=0; i<countSetRanges; ++i) {
+        UChar32 start=setRanges[i].start;
+        UChar32 limit=setRanges[i].limit;
+        uint32_t value=setRanges[i].value;
+        if((limit-start)==1) {
+            umutablecptrie_set(trie, start, value, &errorCode);
+        } else {
+            umutablecptrie_setRange(trie, start, limit-1, value, &errorCode);
+        }
+    }
+    if(U_FAILURE(errorCode)) {
+        log_err("error: setting values into a mutable trie (%s) failed - %s\n",
+                testName, u_errorName(errorCode));
+        umutablecptrie_close(trie);
+        return NULL;
+    }
+    return trie;
+}
+
+static void
+testTrieRanges(const char *testName,
+               const SetRange setRanges[], int32_t countSetRanges,
+               const CheckRange checkRanges[], int32_t countCheckRanges) {
+    UMutableCPTrie *trie=makeTrieWithRanges(testName,
+                                            setRanges, countSetRanges,
+                                            checkRanges, countCheckRanges);
+    if(trie!=NULL) {
+        testMutableGetters(testName, trie, checkRanges, countCheckRanges);
+        testBuilder(testName, trie, checkRanges, countCheckRanges);
+        umutablecptrie_close(trie);
+    }
+}
+
+/* test data ----------------------------------------------------------------*/
+
+/* set consecutive ranges, even with value 0 */
+static const SetRange
+setRanges1[]={
+    { 0,        0x40,     0      },
+    { 0x40,     0xe7,     0x34   },
+    { 0xe7,     0x3400,   0      },
+    { 0x3400,   0x9fa6,   0x61   },
+    { 0x9fa6,   0xda9e,   0x31   },
+    { 0xdada,   0xeeee,   0xff   },
+    { 0xeeee,   0x11111,  1      },
+    { 0x11111,  0x44444,  0x61   },
+    { 0x44444,  0x60003,  0      },
+    { 0xf0003,  0xf0004,  0xf    },
+    { 0xf0004,  0xf0006,  0x10   },
+    { 0xf0006,  0xf0007,  0x11   },
+    { 0xf0007,  0xf0040,  0x12   },
+    { 0xf0040,  0x110000, 0      }
+};
+
+static const CheckRange
+checkRanges1[]={
+    { 0,        0 },
+    { 0x40,     0 },
+    { 0xe7,     0x34 },
+    { 0x3400,   0 },
+    { 0x9fa6,   0x61 },
+    { 0xda9e,   0x31 },
+    { 0xdada,   0 },
+    { 0xeeee,   0xff },
+    { 0x11111,  1 },
+    { 0x44444,  0x61 },
+    { 0xf0003,  0 },
+    { 0xf0004,  0xf },
+    { 0xf0006,  0x10 },
+    { 0xf0007,  0x11 },
+    { 0xf0040,  0x12 },
+    { 0x110000, 0 }
+};
+
+/* set some interesting overlapping ranges, with values wider than 8 bits */
+static const SetRange
+setRanges2[]={
+    { 0x21,     0x7f,     0x5555 },
+    { 0x2f800,  0x2fedc,  0x7a   },
+    { 0x72,     0xdd,     3      },
+    { 0xdd,     0xde,     4      },
+    { 0x201,    0x240,    6      },  /* 3 consecutive blocks with the same pattern but */
+    { 0x241,    0x280,    6      },  /* discontiguous value ranges, testing ucptrie_enum() */
+    { 0x281,    0x2c0,    6      },
+    { 0x2f987,  0x2fa98,  5      },
+    { 0x2f777,  0x2f883,  0      },
+    { 0x2fedc,  0x2ffaa,  1      },
+    { 0x2ffaa,  0x2ffab,  2      },
+    { 0x2ffbb,  0x2ffc0,  7      }
+};
+
+static const CheckRange
+checkRanges2[]={
+    { 0,        0 },
+    { 0x21,     0 },
+    { 0x72,     0x5555 },
+    { 0xdd,     3 },
+    { 0xde,     4 },
+    { 0x201,    0 },
+    { 0x240,    6 },
+    { 0x241,    0 },
+    { 0x280,    6 },
+    { 0x281,    0 },
+    { 0x2c0,    6 },
+    { 0x2f883,  0 },
+    { 0x2f987,  0x7a },
+    { 0x2fa98,  5 },
+    { 0x2fedc,  0x7a },
+    { 0x2ffaa,  1 },
+    { 0x2ffab,  2 },
+    { 0x2ffbb,  0 },
+    { 0x2ffc0,  7 },
+    { 0x110000, 0 }
+};
+
+/* use a non-zero initial value and 32-bit values */
+static const SetRange
+setRanges3[]={
+    { 0x31,     0xa4,     1 },
+    { 0x3400,   0x6789,   2 },
+    { 0x8000,   0x89ab,   9 },
+    { 0x9000,   0xa000,   0x12345678 },
+    { 0xabcd,   0xbcde,   3 },
+    { 0x55555,  0x110000, 6 },  /* highStart<U+ffff with non-initialValue */
+    { 0xcccc,   0x55555,  6 }
+};
+
+static const CheckRange
+checkRanges3[]={
+    { -1,       0xdeadbeef },  /* errorValue */
+    { 0,        9 },  /* non-zero initialValue */
+    { 0x31,     9 },
+    { 0xa4,     1 },
+    { 0x3400,   9 },
+    { 0x6789,   2 },
+    { 0x9000,   9 },
+    { 0xa000,   0x12345678 },
+    { 0xabcd,   9 },
+    { 0xbcde,   3 },
+    { 0xcccc,   9 },
+    { 0x110000, 6 }
+};
+
+/* empty or single-value tries */
+static const SetRange
+setRangesEmpty[]={
+    { 0,        0,        0 },  /* need some values for it to compile */
+};
+
+static const CheckRange
+checkRangesEmpty[]={
+    { 0,        3 },
+    { 0x110000, 3 }
+};
+
+static const SetRange
+setRangesSingleValue[]={
+    { 0,        0x110000, 5 },
+};
+
+static const CheckRange
+checkRangesSingleValue[]={
+    { 0,        3 },
+    { 0x110000, 5 }
+};
+
+static void
+TrieTest(void) {
+    testTrieRanges("set1",
+        setRanges1, UPRV_LENGTHOF(setRanges1),
+        checkRanges1, UPRV_LENGTHOF(checkRanges1));
+    testTrieRanges("set2-overlap",
+        setRanges2, UPRV_LENGTHOF(setRanges2),
+        checkRanges2, UPRV_LENGTHOF(checkRanges2));
+    testTrieRanges("set3-initial-9",
+        setRanges3, UPRV_LENGTHOF(setRanges3),
+        checkRanges3, UPRV_LENGTHOF(checkRanges3));
+    testTrieRanges("set-empty",
+        setRangesEmpty, 0,
+        checkRangesEmpty, UPRV_LENGTHOF(checkRangesEmpty));
+    testTrieRanges("set-single-value",
+        setRangesSingleValue, UPRV_LENGTHOF(setRangesSingleValue),
+        checkRangesSingleValue, UPRV_LENGTHOF(checkRangesSingleValue));
+}
+
+/* the same ranges as in TrieTest() set via a UTrie2 */
+static void
+FromUTrie2Test(void) {
+    static const struct {
+        const char *name;
+        const SetRange *setRanges;
+        int32_t countSetRanges;
+        const CheckRange *checkRanges;
+        int32_t countCheckRanges;
+    } tests[]={
+        { "set1-from-utrie2", setRanges1, UPRV_LENGTHOF(setRanges1),
+          checkRanges1, UPRV_LENGTHOF(checkRanges1) },
+        { "set3-from-utrie2", setRanges3, UPRV_LENGTHOF(setRanges3),
+          checkRanges3, UPRV_LENGTHOF(checkRanges3) }
+    };
+    int32_t t, i;
+
+    for(t=0; t<UPRV_LENGTHOF(tests); ++t) {
+        UErrorCode errorCode=U_ZERO_ERROR;
+        uint32_t initialValue, errorValue;
+        UTrie2 *trie2;
+        UMutableCPTrie *trie;
+
+        getSpecialValues(tests[t].checkRanges, tests[t].countCheckRanges,
+                         &initialValue, &errorValue);
+        trie2=utrie2_open(initialValue, errorValue, &errorCode);
+        for(i=0; i<tests[t].countSetRanges; ++i) {
+            utrie2_setRange32(trie2, tests[t].setRanges[i].start, tests[t].setRanges[i].limit-1,
+                              tests[t].setRanges[i].value, TRUE, &errorCode);
+        }
+        /* lead surrogate code unit values must not be copied */
+        utrie2_set32ForLeadSurrogateCodeUnit(trie2, 0xd801, 0x777, &errorCode);
+        utrie2_freeze(trie2, UTRIE2_32_VALUE_BITS, &errorCode);
+        trie=umutablecptrie_fromUTrie2(trie2, &errorCode);
+        if(U_FAILURE(errorCode)) {
+            log_err("error: umutablecptrie_fromUTrie2(%s) failed: %s\n",
+                    tests[t].name, u_errorName(errorCode));
+        } else {
+            testMutableGetters(tests[t].name, trie,
+                               tests[t].checkRanges, tests[t].countCheckRanges);
+            testBuilder(tests[t].name, trie, tests[t].checkRanges, tests[t].countCheckRanges);
+        }
+        umutablecptrie_close(trie);
+        utrie2_close(trie2);
+    }
+}
+
+/* a trie with many distinct values must not overflow its 16-bit index */
+static void
+ManyValuesTest(void) {
+    UErrorCode errorCode=U_ZERO_ERROR;
+    UMutableCPTrie *mutableTrie=umutablecptrie_open(0, 0xbad, &errorCode);
+    UCPTrie *trie;
+    UChar32 c;
+    int32_t countErrors=0;
+
+    /* every other BMP code point gets its own value */
+    for(c=0; c<=0xffff; c+=2) {
+        umutablecptrie_set(mutableTrie, c, (uint32_t)c+1, &errorCode);
+    }
+    trie=umutablecptrie_buildImmutable(mutableTrie, UCPTRIE_TYPE_FAST, UCPTRIE_VALUE_BITS_32,
+                                       &errorCode);
+    if(U_FAILURE(errorCode)) {
+        log_err("error: umutablecptrie_buildImmutable(many values) failed: %s\n",
+                u_errorName(errorCode));
+    } else {
+        for(c=0; c<=0x10ffff && countErrors<10; ++c) {
+            uint32_t expected= c<=0xffff && (c&1)==0 ? (uint32_t)c+1 : 0;
+            if(UCPTRIE_FAST_GET(trie, UCPTRIE_32, c)!=expected) {
+                log_err("error: many values trie.get(U+%04lx) wrong\n", (long)c);
+                ++countErrors;
+            }
+        }
+    }
+    ucptrie_close(trie);
+
+    /* distinct values everywhere up to U+2FFFF cannot be indexed with 16 bits */
+    for(c=0x10000; c<=0x2ffff; ++c) {
+        umutablecptrie_set(mutableTrie, c, (uint32_t)c, &errorCode);
+    }
+    trie=umutablecptrie_buildImmutable(mutableTrie, UCPTRIE_TYPE_SMALL, UCPTRIE_VALUE_BITS_32,
+                                       &errorCode);
+    if(errorCode!=U_INDEX_OUTOFBOUNDS_ERROR) {
+        log_err("error: umutablecptrie_buildImmutable(too many values) did not fail: %s\n",
+                u_errorName(errorCode));
+    }
+    ucptrie_close(trie);
+    umutablecptrie_close(mutableTrie);
+}
+
+static void
+ErrorTest(void) {
+    UErrorCode errorCode=U_ZERO_ERROR;
+    UMutableCPTrie *mutableTrie=umutablecptrie_open(0, 0xbad, &errorCode);
+    uint32_t storage[8];
+
+    umutablecptrie_set(mutableTrie, 0x110000, 1, &errorCode);
+    if(errorCode!=U_ILLEGAL_ARGUMENT_ERROR) {
+        log_err("error: umutablecptrie_set(U+110000) did not fail: %s\n", u_errorName(errorCode));
+    }
+    errorCode=U_ZERO_ERROR;
+    umutablecptrie_setRange(mutableTrie, 0x200, 0x100, 1, &errorCode);
+    if(errorCode!=U_ILLEGAL_ARGUMENT_ERROR) {
+        log_err("error: umutablecptrie_setRange(start>end) did not fail: %s\n",
+                u_errorName(errorCode));
+    }
+    errorCode=U_ZERO_ERROR;
+    umutablecptrie_setRange(mutableTrie, -1, 0x100, 1, &errorCode);
+    if(errorCode!=U_ILLEGAL_ARGUMENT_ERROR) {
+        log_err("error: umutablecptrie_setRange(start<0) did not fail: %s\n",
+                u_errorName(errorCode));
+    }
+
+    /* garbage is not a trie */
+    uprv_memset(storage, 0x5a, sizeof(storage));
+    errorCode=U_ZERO_ERROR;
+    ucptrie_close(ucptrie_openFromBinary(UCPTRIE_TYPE_FAST, UCPTRIE_VALUE_BITS_16,
+                                         storage, sizeof(storage), NULL, &errorCode));
+    if(errorCode!=U_INVALID_FORMAT_ERROR) {
+        log_err("error: ucptrie_openFromBinary(garbage) did not fail: %s\n",
+                u_errorName(errorCode));
+    }
+    errorCode=U_ZERO_ERROR;
+    ucptrie_close(ucptrie_openFromBinary(UCPTRIE_TYPE_COUNT, UCPTRIE_VALUE_BITS_16,
+                                         storage, sizeof(storage), NULL, &errorCode));
+    if(errorCode!=U_ILLEGAL_ARGUMENT_ERROR) {
+        log_err("error: ucptrie_openFromBinary(bad type) did not fail: %s\n",
+                u_errorName(errorCode));
+    }
+
+    /* serializing into a buffer that is too small */
+    errorCode=U_ZERO_ERROR;
+    {
+        UCPTrie *trie=umutablecptrie_buildImmutable(mutableTrie, UCPTRIE_TYPE_SMALL,
+                                                    UCPTRIE_VALUE_BITS_8, &errorCode);
+        int32_t length=ucptrie_toBinary(trie, storage, sizeof(storage), &errorCode);
+        if(errorCode!=U_BUFFER_OVERFLOW_ERROR || length<=(int32_t)sizeof(storage)) {
+            log_err("error: ucptrie_toBinary(too small) did not fail: %s\n",
+                    u_errorName(errorCode));
+        }
+        ucptrie_close(trie);
+    }
+    umutablecptrie_close(mutableTrie);
+}
+
+void
+addUCPTrieTest(TestNode** root) {
+    addTest(root, &TrieTest, "tsutil/ucptrietest/TrieTest");
+    addTest(root, &FromUTrie2Test, "tsutil/ucptrietest/FromUTrie2Test");
+    addTest(root, &ManyValuesTest, "tsutil/ucptrietest/ManyValuesTest");
+    addTest(root, &ErrorTest, "tsutil/ucptrietest/ErrorTest");
+}
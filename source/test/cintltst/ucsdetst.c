@@ -1,6 +1,6 @@
 /*
  ****************************************************************************
- * Copyright (c) 2005-2009, International Business Machines Corporation and *
+ * Copyright (c) 2005-2016, International Business Machines Corporation and *
  * others. All Rights Reserved.                                             *
  ****************************************************************************
  */
@@ -30,6 +30,8 @@ static void TestChaining(void);
 static void TestBufferOverflow(void);
 static void TestIBM424(void);
 static void TestIBM420(void);
+static void TestAppendText(void);
+static void TestStopConfidence(void);
 
 void addUCsdetTest(TestNode** root);
 
@@ -42,6 +44,8 @@ void addUCsdetTest(TestNode** root)
     addTest(root, &TestInputFilter, "ucsdetst/TestInputFilter");
     addTest(root, &TestChaining, "ucsdetst/TestErrorChaining");
     addTest(root, &TestBufferOverflow, "ucsdetst/TestBufferOverflow");
+    addTest(root, &TestAppendText, "ucsdetst/TestAppendText");
+    addTest(root, &TestStopConfidence, "ucsdetst/TestStopConfidence");
 #if !UCONFIG_NO_LEGACY_CONVERSION
     addTest(root, &TestIBM424, "ucsdetst/TestIBM424");
     addTest(root, &TestIBM420, "ucsdetst/TestIBM420");
@@ -351,6 +355,9 @@ static void TestChaining(void) {
 
     ucsdet_open(&status);
     ucsdet_setText(NULL, NULL, 0, &status);
+    ucsdet_appendText(NULL, NULL, 0, &status);
+    ucsdet_setStopConfidence(NULL, 100, &status);
+    ucsdet_getStopConfidence(NULL, &status);
     ucsdet_getName(NULL, &status);
     ucsdet_getConfidence(NULL, &status);
     ucsdet_getLanguage(NULL, &status);
@@ -588,3 +595,180 @@ bail:
     freeBytes(bytes_r);
     ucsdet_close(csd);
 }
+
+/*
+ * Check that two detectors report the same matches, in the same order.
+ */
+static void checkSameMatches(UCharsetDetector *csd1, UCharsetDetector *csd2, const char *message)
+{
+    UErrorCode status = U_ZERO_ERROR;
+    int32_t count1 = 0, count2 = 0, i;
+    const UCharsetMatch **matches1 = ucsdet_detectAll(csd1, &count1, &status);
+    const UCharsetMatch **matches2 = ucsdet_detectAll(csd2, &count2, &status);
+
+    if (U_FAILURE(status)) {
+        log_err("%s: ucsdet_detectAll() failed - %s\n", message, u_errorName(status));
+        return;
+    }
+    if (count1 != count2) {
+        log_err("%s: got %d matches instead of %d\n", message, count2, count1);
+        return;
+    }
+    for (i = 0; i < count1; i += 1) {
+        if (strcmp(ucsdet_getName(matches1[i], &status), ucsdet_getName(matches2[i], &status)) != 0 ||
+            ucsdet_getConfidence(matches1[i], &status) != ucsdet_getConfidence(matches2[i], &status)) {
+            log_err("%s: match %d is %s/%d instead of %s/%d\n", message, i,
+                ucsdet_getName(matches2[i], &status), ucsdet_getConfidence(matches2[i], &status),
+                ucsdet_getName(matches1[i], &status), ucsdet_getConfidence(matches1[i], &status));
+            return;
+        }
+    }
+}
+
+static void TestAppendText(void)
+{
+    UErrorCode status = U_ZERO_ERROR;
+    static const char ss[] = "Na\u00EFve caf\u00E9 pi\u00F1ata, gar\u00E7on, d\u00E9j\u00E0 vu, "
+               "Stra\u00DFe, \u00FCber, \u0391\u0392\u0393\u0394 and other bits of UTF-8.";
+    UChar s[sizeof(ss)];
+    int32_t sLength, byteLength = 0, i, chunk;
+    char *bytes = NULL;
+    char *longBytes = NULL;
+    UCharsetDetector *whole = ucsdet_open(&status);
+    UCharsetDetector *pieces = ucsdet_open(&status);
+    const UCharsetMatch *match;
+
+    if (U_FAILURE(status)) {
+        log_err("Couldn't open detectors. %s\n", u_errorName(status));
+        goto bail;
+    }
+
+    sLength = u_unescape(ss, s, sizeof(ss));
+    bytes = extractBytes(s, sLength, "UTF-8", &byteLength);
+    ucsdet_setText(whole, bytes, byteLength, &status);
+
+    /* Append the text in small pieces, detecting along the way. */
+    for (i = 0; i < byteLength; i += chunk) {
+        chunk = byteLength - i < 7 ? byteLength - i : 7;
+        ucsdet_appendText(pieces, bytes + i, chunk, &status);
+        ucsdet_detect(pieces, &status);
+    }
+    if (U_FAILURE(status)) {
+        log_err("ucsdet_appendText() failed - %s\n", u_errorName(status));
+        goto bail;
+    }
+    checkSameMatches(whole, pieces, "appended pieces");
+
+    /* Text set with ucsdet_setText() is continued by ucsdet_appendText(). */
+    ucsdet_setText(pieces, bytes, 20, &status);
+    ucsdet_appendText(pieces, bytes + 20, byteLength - 20, &status);
+    checkSameMatches(whole, pieces, "setText + appendText");
+
+    /* ucsdet_setText() starts over. */
+    ucsdet_setText(pieces, bytes, byteLength, &status);
+    checkSameMatches(whole, pieces, "setText after appendText");
+
+    /* Only the first 64k bytes are retained. */
+    longBytes = NEW_ARRAY(char, 0x10000 + byteLength);
+    memset(longBytes, 'a', 0x10000);
+    memcpy(longBytes + 0x10000, bytes, byteLength);
+    ucsdet_setText(whole, longBytes, 0x10000, &status);
+    ucsdet_setText(pieces, NULL, 0, &status);
+    ucsdet_appendText(pieces, longBytes, 0x8000, &status);
+    ucsdet_appendText(pieces, longBytes + 0x8000, 0x8000 + byteLength, &status);
+    ucsdet_appendText(pieces, bytes, byteLength, &status);
+    checkSameMatches(whole, pieces, "appendText beyond 64k");
+
+    ucsdet_appendText(pieces, NULL, 1, &status);
+    if (status != U_ILLEGAL_ARGUMENT_ERROR) {
+        log_err("ucsdet_appendText(NULL, 1) did not fail - %s\n", u_errorName(status));
+    }
+    status = U_ZERO_ERROR;
+
+    /* Empty appended text still counts as text. */
+    ucsdet_close(pieces);
+    pieces = ucsdet_open(&status);
+    ucsdet_appendText(pieces, "", 0, &status);
+    match = ucsdet_detect(pieces, &status);
+    if (U_FAILURE(status)) {
+        log_err("ucsdet_detect() after appending empty text failed - %s\n", u_errorName(status));
+    }
+    (void)match;
+
+bail:
+    freeBytes(bytes);
+    freeBytes(longBytes);
+    ucsdet_close(whole);
+    ucsdet_close(pieces);
+}
+
+static void TestStopConfidence(void)
+{
+    UErrorCode status = U_ZERO_ERROR;
+    static const char ss[] = "This is a string with some non-ascii characters that will "
+               "be converted to UTF-8, then shoved through the detection process.  "
+               "\u0391\u0392\u0393\u0394\u0395";
+    UChar s[sizeof(ss)];
+    int32_t sLength, byteLength = 0, count = 0;
+    char *bytes = NULL;
+    UCharsetDetector *full = ucsdet_open(&status);
+    UCharsetDetector *csd = ucsdet_open(&status);
+    const UCharsetMatch *match;
+    const UCharsetMatch **matches;
+
+    if (U_FAILURE(status)) {
+        log_err("Couldn't open detectors. %s\n", u_errorName(status));
+        goto bail;
+    }
+    if (ucsdet_getStopConfidence(csd, &status) != 0) {
+        log_err("The default stop confidence is not 0\n");
+    }
+
+    sLength = u_unescape(ss, s, sizeof(ss));
+    bytes = extractBytes(s, sLength, "UTF-8", &byteLength);
+    ucsdet_setText(full, bytes, byteLength, &status);
+    ucsdet_setText(csd, bytes, byteLength, &status);
+
+    /* ucsdet_detect() may stop early, but ucsdet_detectAll() then still finds all matches. */
+    match = ucsdet_detect(csd, &status);
+    if (match == NULL || strcmp(ucsdet_getName(match, &status), "UTF-8") != 0 ||
+            ucsdet_getConfidence(match, &status) != 100) {
+        log_err("ucsdet_detect() did not find UTF-8 with confidence 100\n");
+    }
+    checkSameMatches(full, csd, "detectAll after detect");
+
+    ucsdet_setStopConfidence(csd, 100, &status);
+    if (U_FAILURE(status) || ucsdet_getStopConfidence(csd, &status) != 100) {
+        log_err("ucsdet_setStopConfidence(100) failed - %s\n", u_errorName(status));
+        goto bail;
+    }
+    matches = ucsdet_detectAll(csd, &count, &status);
+    if (U_FAILURE(status) || count != 1 ||
+            strcmp(ucsdet_getName(matches[0], &status), "UTF-8") != 0) {
+        log_err("ucsdet_detectAll() with stop confidence 100 returned %d matches - %s\n",
+            count, u_errorName(status));
+    }
+    ucsdet_detectAll(full, &count, &status);
+    if (count <= 1) {
+        log_err("ucsdet_detectAll() without stop confidence returned only %d matches\n", count);
+    }
+
+    /* Back to all matches. */
+    ucsdet_setStopConfidence(csd, 0, &status);
+    checkSameMatches(full, csd, "stop confidence 0");
+
+    ucsdet_setStopConfidence(csd, 101, &status);
+    if (status != U_ILLEGAL_ARGUMENT_ERROR) {
+        log_err("ucsdet_setStopConfidence(101) did not fail - %s\n", u_errorName(status));
+    }
+    status = U_ZERO_ERROR;
+    ucsdet_setStopConfidence(csd, -1, &status);
+    if (status != U_ILLEGAL_ARGUMENT_ERROR) {
+        log_err("ucsdet_setStopConfidence(-1) did not fail - %s\n", u_errorName(status));
+    }
+
+bail:
+    freeBytes(bytes);
+    ucsdet_close(full);
+    ucsdet_close(csd);
+}
@@ -1,6 +1,6 @@
 /*
 **********************************************************************
-* Copyright (c) 2002-2014, International Business Machines
+* Copyright (c) 2002-2016, International Business Machines
 * Corporation and others.  All Rights Reserved.
 **********************************************************************
 */
@@ -20,6 +20,7 @@ static void TestNonInvariantPattern(void);
 static void TestBadPattern(void);
 static void TestFreezable(void);
 static void TestSpan(void);
+static void TestBinary(void);
 
 void addUSetTest(TestNode** root);
 
@@ -43,6 +44,7 @@ addUSetTest(TestNode** root) {
     TEST(TestBadPattern);
     TEST(TestFreezable);
     TEST(TestSpan);
+    TEST(TestBinary);
 }
 
 /*------------------------------------------------------------------
@@ -650,4 +652,61 @@ static void TestSpan() {
     uset_close(idSet);
 }
 
+static void TestBinary() {
+    uint32_t image[300];
+    USet *set, *loaded;
+    UErrorCode errorCode;
+    int32_t length, actualLength;
+    static const UChar s16[]={ 0x61, 0x62, 0x63, 0x61, 0x62, 0x78 };  /* "abcabx" */
+
+    errorCode=U_ZERO_ERROR;
+    set=uset_openPattern(PAT, PAT_LEN, &errorCode);
+    if(U_FAILURE(errorCode)) {
+        log_err("uset_openPattern([a-c{ab}]) failed - %s\n", u_errorName(errorCode));
+        return;
+    }
+
+    length=uset_toBinary(set, NULL, 0, &errorCode);
+    if(errorCode!=U_BUFFER_OVERFLOW_ERROR || length<=0 || length>(int32_t)sizeof(image)) {
+        log_err("uset_toBinary([a-c{ab}], preflighting) returned %ld - %s\n",
+                (long)length, u_errorName(errorCode));
+        uset_close(set);
+        return;
+    }
+    errorCode=U_ZERO_ERROR;
+    length=uset_toBinary(set, image, (int32_t)sizeof(image), &errorCode);
+    if(U_FAILURE(errorCode)) {
+        log_err("uset_toBinary([a-c{ab}]) failed - %s\n", u_errorName(errorCode));
+        uset_close(set);
+        return;
+    }
+
+    actualLength=0;
+    loaded=uset_openFromBinary(image, (int32_t)sizeof(image), &actualLength, &errorCode);
+    if(U_FAILURE(errorCode)) {
+        log_err("uset_openFromBinary([a-c{ab}]) failed - %s\n", u_errorName(errorCode));
+        uset_close(set);
+        return;
+    }
+    if(actualLength!=length || !uset_isFrozen(loaded) || !uset_equals(loaded, set) ||
+        !uset_contains(loaded, 0x62) || uset_contains(loaded, 0x64) ||
+        !uset_containsString(loaded, STR_ab, STR_ab_LEN) ||
+        5!=uset_span(loaded, s16, 6, USET_SPAN_CONTAINED) ||
+        5!=uset_span(loaded, s16, 6, USET_SPAN_SIMPLE)
+    ) {
+        log_err("uset_openFromBinary(uset_toBinary([a-c{ab}])) does not work\n");
+    }
+    uset_close(loaded);
+
+    /* Corrupt the signature. */
+    image[0]^=1;
+    loaded=uset_openFromBinary(image, length, NULL, &errorCode);
+    if(errorCode!=U_INVALID_FORMAT_ERROR || loaded!=NULL) {
+        log_err("uset_openFromBinary(bad signature) did not fail as expected - %s\n",
+                u_errorName(errorCode));
+    }
+    uset_close(loaded);
+    uset_close(set);
+}
+
 /*eof*/
@@ -1,6 +1,6 @@
 /*
  **********************************************************************
- *   Copyright (C) 2005-2015, International Business Machines
+ *   Copyright (C) 2005-2016, International Business Machines
  *   Corporation and others.  All Rights Reserved.
  **********************************************************************
  */
@@ -104,6 +104,10 @@ void CharsetDetectionTest::runIndexedTest( int32_t index, UBool exec, const char
             if (exec) Ticket6954Test();
             break;
 
+       case 10: name = "NGramReuseTest";
+            if (exec) NGramReuseTest();
+            break;
+
         default: name = "";
             break; //needed to end loop
     }
@@ -859,3 +863,58 @@ void CharsetDetectionTest::Ticket6954Test() {
     freeBytes(bWindows);
 #endif
 }
+
+// The single byte charset n-gram scores are computed once per input and kept with
+//  the input text. Check that a detector that is reused for text in another
+//  language does not report the scores of the previous text.
+void CharsetDetectionTest::NGramReuseTest() {
+#if !UCONFIG_NO_CONVERSION
+    const char *const texts[] = {
+        "Le renard brun rapide saute par-dessus le chien paresseux. Les enfants de la ville "
+        "sont partis pour la campagne, et ils ne reviendront pas avant la fin du mois de juillet.",
+        "Der schnelle braune Fuchs springt \u00FCber den faulen Hund. Die Kinder aus der Stadt "
+        "sind auf das Land gefahren, und sie werden erst am Ende des Monats wieder zur\u00FCck sein.",
+        "Le renard brun rapide saute par-dessus le chien paresseux. Les enfants de la ville "
+        "sont partis pour la campagne, et ils ne reviendront pas avant la fin du mois de juillet."
+    };
+    const char *const languages[] = { "fr", "de", "fr" };
+    char bytes[3][400];
+    int32_t lengths[3];
+    int32_t i;
+
+    for (i = 0; i < UPRV_LENGTHOF(texts); i += 1) {
+        UnicodeString text = UnicodeString(texts[i], -1, US_INV).unescape();
+        lengths[i] = text.extract(0, text.length(), bytes[i], sizeof(bytes[i]), "ISO-8859-1");
+    }
+
+    UErrorCode status = U_ZERO_ERROR;
+    LocalUCharsetDetectorPointer csd(ucsdet_open(&status));
+
+    for (i = 0; i < UPRV_LENGTHOF(texts); i += 1) {
+        ucsdet_setText(csd.getAlias(), bytes[i], lengths[i], &status);
+        const UCharsetMatch *match = ucsdet_detect(csd.getAlias(), &status);
+        TEST_ASSERT_SUCCESS(status);
+        if (U_FAILURE(status)) {
+            return;
+        }
+        const char *name = ucsdet_getName(match, &status);
+        const char *language = ucsdet_getLanguage(match, &status);
+        int32_t confidence = ucsdet_getConfidence(match, &status);
+        TEST_ASSERT_SUCCESS(status);
+        if (strcmp(name, "ISO-8859-1") != 0 || strcmp(language, languages[i]) != 0) {
+            errln("Text %d detected as %s (%s) instead of ISO-8859-1 (%s)",
+                  (int)i, name, language, languages[i]);
+        }
+
+        // A new detector must find the same confidence.
+        LocalUCharsetDetectorPointer fresh(ucsdet_open(&status));
+        ucsdet_setText(fresh.getAlias(), bytes[i], lengths[i], &status);
+        const UCharsetMatch *freshMatch = ucsdet_detect(fresh.getAlias(), &status);
+        TEST_ASSERT_SUCCESS(status);
+        if (U_SUCCESS(status) && ucsdet_getConfidence(freshMatch, &status) != confidence) {
+            errln("Text %d: reused detector confidence %d, new detector confidence %d",
+                  (int)i, (int)confidence, (int)ucsdet_getConfidence(freshMatch, &status));
+        }
+    }
+#endif
+}
@@ -112,6 +112,8 @@ void DateFormatTest::runIndexedTest( int32_t index, UBool exec, const char* &nam
     TESTCASE_AUTO(TestDFSCreateForLocaleNonGregorianLocale);
     TESTCASE_AUTO(TestDFSCreateForLocaleWithCalendarInLocale);
     TESTCASE_AUTO(TestChangeCalendar);
+    TESTCASE_AUTO(TestNumericParse);
+    TESTCASE_AUTO(TestNumericParseAttributes);
 
     TESTCASE_AUTO_END;
 }
@@ -4835,6 +4837,123 @@ void DateFormatTest::TestChangeCalendar() {
     assertEquals("format yMMMd", "Iyar 29, 5758", result);
 }
 
+void DateFormatTest::TestNumericParse() {
+    // All-numeric patterns are parsed by a fast path which must give the
+    // same results as the general parser, and must defer to it for input
+    // it does not handle (two-digit years, extra whitespace, ...).
+    static const struct {
+        const char *pattern;
+        const char *text;
+        UBool lenient;
+        int32_t index;  // expected parse position, or -1 for an error
+        int32_t fields[7];  // y, M (1-based), d, H, m, s, S
+    } cases[] = {
+        { "yyyy-MM-dd HH:mm:ss.SSS", "2015-03-07 08:09:10.5", TRUE, 21, { 2015, 3, 7, 8, 9, 10, 500 } },
+        { "yyyy-MM-dd HH:mm:ss.SSS", "2015-3-7 8:9:10.123456", TRUE, 22, { 2015, 3, 7, 8, 9, 10, 123 } },
+        { "yyyy-MM-dd HH:mm:ss.SSS", "2015-03-07 08:09:10.5xyz", TRUE, 21, { 2015, 3, 7, 8, 9, 10, 500 } },
+        { "yyyy-MM-dd HH:mm:ss.SSS", "2015-03-07 24:00:00.000", TRUE, 23, { 2015, 3, 8, 0, 0, 0, 0 } },
+        { "yyyy-MM-dd", "2015-03-07 ", TRUE, 10, { 2015, 3, 7, 0, 0, 0, 0 } },
+        { "yyyy-MM-dd", "2015-03- 7", TRUE, 10, { 2015, 3, 7, 0, 0, 0, 0 } },
+        { "yyyy-MM-dd", "2015/03/07", FALSE, -1, { 0 } },
+        { "yyyy-MM-dd", "2015-13-07", TRUE, 10, { 2016, 1, 7, 0, 0, 0, 0 } },
+        { "yyyy-MM-dd", "2015-13-07", FALSE, -1, { 0 } },
+        { "dd.MM.yyyy", "07.03.2015", TRUE, 10, { 2015, 3, 7, 0, 0, 0, 0 } },
+        { "yyyy''MM''dd", "2015'03'07", TRUE, 10, { 2015, 3, 7, 0, 0, 0, 0 } },
+        { "yyyyMMdd", "20150307", TRUE, 8, { 2015, 3, 7, 0, 0, 0, 0 } },
+        { "yy-MM-dd", "15-03-07", TRUE, 8, { 2015, 3, 7, 0, 0, 0, 0 } },
+    };
+    static const UCalendarDateFields calFields[] = {
+        UCAL_YEAR, UCAL_MONTH, UCAL_DATE, UCAL_HOUR_OF_DAY, UCAL_MINUTE, UCAL_SECOND, UCAL_MILLISECOND
+    };
+
+    UErrorCode status = U_ZERO_ERROR;
+    LocalPointer<Calendar> cal(Calendar::createInstance(TimeZone::getGMT()->clone(), Locale::getUS(), status));
+    if (U_FAILURE(status)) {
+        dataerrln("Calendar::createInstance failed: %s", u_errorName(status));
+        return;
+    }
+    for (int32_t i = 0; i < UPRV_LENGTHOF(cases); ++i) {
+        status = U_ZERO_ERROR;
+        SimpleDateFormat fmt(UnicodeString(cases[i].pattern, -1, US_INV), Locale::getUS(), status);
+        if (U_FAILURE(status)) {
+            dataerrln("SimpleDateFormat(%s) failed: %s", cases[i].pattern, u_errorName(status));
+            return;
+        }
+        fmt.setLenient(cases[i].lenient);
+        cal->clear();
+        cal->setLenient(cases[i].lenient);
+        UnicodeString text(cases[i].text, -1, US_INV);
+        ParsePosition pos(0);
+        fmt.parse(text, *cal, pos);
+        if (cases[i].index < 0) {
+            cal->getTime(status);
+            if (pos.getErrorIndex() < 0 && U_SUCCESS(status)) {
+                errln("FAIL: pattern %s, text %s: expected a parse error", cases[i].pattern, cases[i].text);
+            }
+            continue;
+        }
+        if (pos.getIndex() != cases[i].index) {
+            errln("FAIL: pattern %s, text %s: parse position %d, expected %d",
+                  cases[i].pattern, cases[i].text, pos.getIndex(), cases[i].index);
+            continue;
+        }
+        for (int32_t j = 0; j < UPRV_LENGTHOF(calFields); ++j) {
+            int32_t value = cal->get(calFields[j], status);
+            if (calFields[j] == UCAL_MONTH) {
+                ++value;
+            }
+            if (U_FAILURE(status) || value != cases[i].fields[j]) {
+                errln("FAIL: pattern %s, text %s: field %d is %d, expected %d (%s)",
+                      cases[i].pattern, cases[i].text, (int)j, value, cases[i].fields[j], u_errorName(status));
+            }
+        }
+    }
+}
+
+void DateFormatTest::TestNumericParseAttributes() {
+    // The fast path checks the range of each field under the same attribute
+    // as subParse(): M unless whitespace is allowed, d, m and s unless
+    // numeric parsing is allowed.
+    static const struct {
+        const char *text;
+        UBool checkedUnlessWhitespace;  // else checked unless numeric
+    } cases[] = {
+        { "2015-13-07 08:09:10", TRUE },
+        { "2015-01-40 08:09:10", FALSE },
+        { "2015-01-07 08:61:10", FALSE },
+        { "2015-01-07 08:09:61", FALSE }
+    };
+
+    UErrorCode status = U_ZERO_ERROR;
+    SimpleDateFormat fmt(UnicodeString("yyyy-MM-dd HH:mm:ss", -1, US_INV), Locale::getUS(), status);
+    LocalPointer<Calendar> cal(Calendar::createInstance(TimeZone::getGMT()->clone(), Locale::getUS(), status));
+    if (U_FAILURE(status)) {
+        dataerrln("SimpleDateFormat or Calendar::createInstance failed: %s", u_errorName(status));
+        return;
+    }
+    for (int32_t attributes = 0; attributes < 4; ++attributes) {
+        UBool allowWhitespace = (attributes & 1) != 0;
+        UBool allowNumeric = (attributes & 2) != 0;
+        fmt.setBooleanAttribute(UDAT_PARSE_ALLOW_WHITESPACE, allowWhitespace, status);
+        fmt.setBooleanAttribute(UDAT_PARSE_ALLOW_NUMERIC, allowNumeric, status);
+        if (!assertSuccess("setBooleanAttribute", status)) {
+            return;
+        }
+        for (int32_t i = 0; i < UPRV_LENGTHOF(cases); ++i) {
+            UBool expectError = cases[i].checkedUnlessWhitespace ? !allowWhitespace : !allowNumeric;
+            cal->clear();
+            UnicodeString text(cases[i].text, -1, US_INV);
+            ParsePosition pos(0);
+            fmt.parse(text, *cal, pos);
+            UBool failed = pos.getErrorIndex() >= 0 || pos.getIndex() == 0;
+            if (failed != expectError) {
+                errln("FAIL: whitespace %d, numeric %d, text %s: parse %s, expected %s",
+                      allowWhitespace, allowNumeric, cases[i].text,
+                      failed ? "failed" : "succeeded", expectError ? "an error" : "success");
+            }
+        }
+    }
+}
 
 #endif /* #if !UCONFIG_NO_FORMATTING */
 
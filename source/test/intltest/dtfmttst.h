@@ -249,6 +249,8 @@ public:
     void TestDFSCreateForLocaleNonGregorianLocale();
     void TestDFSCreateForLocaleWithCalendarInLocale();
     void TestChangeCalendar();
+    void TestNumericParse();
+    void TestNumericParseAttributes();
 
 private:
     UBool showParse(DateFormat &format, const UnicodeString &formattedString);
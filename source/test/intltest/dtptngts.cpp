@@ -30,6 +30,7 @@ void IntlTestDateTimePatternGeneratorAPI::runIndexedTest( int32_t index, UBool e
         TESTCASE(0, testAPI);
         TESTCASE(1, testOptions);
         TESTCASE(2, testAllFieldPatterns);
+        TESTCASE(3, testSharedInstances);
         default: name = ""; break;
     }
 }
@@ -1057,4 +1058,59 @@ void IntlTestDateTimePatternGeneratorAPI::testAllFieldPatterns(/*char *par*/)
         }
     }
 }
+// Clones, including the generators returned by createInstance(), share
+// memoized getBestPattern() results; modifying one must not affect the others.
+void IntlTestDateTimePatternGeneratorAPI::testSharedInstances(/*char *par*/)
+{
+    UErrorCode status = U_ZERO_ERROR;
+    UnicodeString conflictingPattern;
+    const UnicodeString skeleton("yMMMd");
+    const UnicodeString first("d MMM y");
+    const UnicodeString second("d.MMM.y");
+
+    LocalPointer<DateTimePatternGenerator> gen1(DateTimePatternGenerator::createEmptyInstance(status));
+    if (U_FAILURE(status)) {
+        errln("ERROR: createEmptyInstance() failed - %s", u_errorName(status));
+        return;
+    }
+    gen1->addPattern(first, FALSE, conflictingPattern, status);
+    UnicodeString pattern = gen1->getBestPattern(skeleton, status);
+    LocalPointer<DateTimePatternGenerator> gen2(gen1->clone());
+    if (U_FAILURE(status) || pattern != first || gen2.isNull() ||
+            gen2->getBestPattern(skeleton, status) != first) {
+        errln(UnicodeString("ERROR: getBestPattern(yMMMd) - got ") + pattern + " expected " + first);
+        return;
+    }
+    gen2->addPattern(second, TRUE, conflictingPattern, status);
+    pattern = gen2->getBestPattern(skeleton, status);
+    if (U_FAILURE(status) || pattern != second) {
+        errln(UnicodeString("ERROR: getBestPattern(yMMMd) after addPattern() - got ") + pattern +
+              " expected " + second + " - " + u_errorName(status));
+    }
+    pattern = gen1->getBestPattern(skeleton, status);
+    if (pattern != first) {
+        errln(UnicodeString("ERROR: addPattern() on a clone changed the original - got ") + pattern +
+              " expected " + first);
+    }
+
+    gen1.adoptInstead(DateTimePatternGenerator::createInstance(Locale::getEnglish(), status));
+    gen2.adoptInstead(DateTimePatternGenerator::createInstance(Locale::getEnglish(), status));
+    if (U_FAILURE(status)) {
+        dataerrln("ERROR: Could not create DateTimePatternGenerator - %s", u_errorName(status));
+        return;
+    }
+    UnicodeString expected = gen1->getBestPattern(skeleton, status);
+    gen2->addPattern(second, TRUE, conflictingPattern, status);
+    pattern = gen2->getBestPattern(skeleton, status);
+    if (U_FAILURE(status) || pattern != second) {
+        errln(UnicodeString("ERROR: getBestPattern(yMMMd) after addPattern() - got ") + pattern +
+              " expected " + second + " - " + u_errorName(status));
+    }
+    LocalPointer<DateTimePatternGenerator> gen3(DateTimePatternGenerator::createInstance(Locale::getEnglish(), status));
+    if (U_FAILURE(status) || gen1->getBestPattern(skeleton, status) != expected ||
+            gen3->getBestPattern(skeleton, status) != expected) {
+        errln("ERROR: addPattern() on one generator changed another one");
+    }
+}
+
 #endif /* #if !UCONFIG_NO_FORMATTING */
@@ -26,6 +26,7 @@ private:
     void testAPI(/* char* par */);
     void testOptions(/* char* par */);
     void testAllFieldPatterns(/* char* par */);
+    void testSharedInstances(/* char* par */);
 };
 
 #endif /* #if !UCONFIG_NO_FORMATTING */
@@ -1,6 +1,6 @@
 /*
 **********************************************************************
-* Copyright (C) 2011-2015, International Business Machines Corporation 
+* Copyright (C) 2011-2016, International Business Machines Corporation 
 * and others.  All Rights Reserved.
 **********************************************************************
 */
@@ -14,11 +14,13 @@
 
 #include "itspoof.h"
 
+#include "unicode/normalizer2.h"
 #include "unicode/normlzr.h"
 #include "unicode/regex.h"
 #include "unicode/unistr.h"
 #include "unicode/uscript.h"
 #include "unicode/uspoof.h"
+#include "unicode/ustring.h"
 
 #include "cstring.h"
 #include "identifier_info.h"
@@ -131,6 +133,12 @@ void IntlTestSpoof::runIndexedTest( int32_t index, UBool exec, const char* &name
                 testMixedNumbers();
             }
             break;
+        case 10:
+            name = "testSkeletonForms";
+            if (exec) {
+                testSkeletonForms();
+            }
+            break;
 
 
         default: name=""; break;
@@ -768,4 +776,114 @@ void IntlTestSpoof::testMixedNumbers() {
     }
 }
 
+//
+//  testSkeletonForms - Check that the UTF-16 and UTF-8 skeleton functions agree with
+//                      each other and with skeletons assembled one code point at a time,
+//                      for text that mixes ASCII with characters that need normalization.
+//
+void IntlTestSpoof::testSkeletonForms() {
+    static const char *tests[] = {
+        "",
+        "paypal",
+        "paypa1.com",
+        "m0zilla%20",
+        "\\u0440\\u0430\\u0443\\u0440\\u0430l",      // Cyrillic
+        "caf\\u00e9-cafe\\u0301",                    // precomposed and decomposed
+        "a\\u0301\\u0323b\\u0323\\u0301c",           // marks to be reordered
+        "\\u059c\\u0301x\\u0315\\u0316",
+        "x\\u2A74y\\u247Ez\\uFDFB",
+        "\\u13CFob\\u017F\\u0391\\u0C83",
+        "\\U0001D5BA\\U0001D5C9x\\U0001F100",
+        "\\u0022\\u0060|I1\\u0022",
+        "\\ud800-\\udc00x"                           // unpaired surrogates
+    };
+    static const uint32_t types[] = {
+        0,
+        USPOOF_SINGLE_SCRIPT_CONFUSABLE,
+        USPOOF_ANY_CASE,
+        USPOOF_SINGLE_SCRIPT_CONFUSABLE | USPOOF_ANY_CASE
+    };
+
+    TEST_SETUP
+        const Normalizer2 *nfd = Normalizer2::getNFDInstance(status);
+        TEST_ASSERT_SUCCESS(status);
+        for (int32_t testNum = 0; testNum < UPRV_LENGTHOF(tests); testNum++) {
+            UnicodeString input = UnicodeString(tests[testNum], -1, US_INV).unescape();
+            for (int32_t typeNum = 0; typeNum < UPRV_LENGTHOF(types); typeNum++) {
+                uint32_t type = types[typeNum];
+                char msgBuf[100];
+                sprintf(msgBuf, "test %d type %d", (int)testNum, (int)type);
+
+                // Expected: the skeletons of the single code points of the NFD input,
+                //           concatenated and normalized.
+                UnicodeString nfdInput = nfd->normalize(input, status);
+                UnicodeString pieces, piece;
+                for (int32_t i = 0; i < nfdInput.length(); i = nfdInput.moveIndex32(i, 1)) {
+                    pieces.append(uspoof_getSkeletonUnicodeString(
+                        sc, type, UnicodeString(nfdInput.char32At(i)), piece, &status));
+                }
+                UnicodeString expected = nfd->normalize(pieces, status);
+                TEST_ASSERT_SUCCESS(status);
+
+                UnicodeString actual;
+                uspoof_getSkeletonUnicodeString(sc, type, input, actual, &status);
+                TEST_ASSERT_SUCCESS(status);
+                TEST_ASSERT_MSG(actual == expected, msgBuf);
+
+                // Same source and destination object.
+                UnicodeString inPlace(input);
+                uspoof_getSkeletonUnicodeString(sc, type, inPlace, inPlace, &status);
+                TEST_ASSERT_MSG(inPlace == expected, msgBuf);
+
+                // C API: preflighting, then into an exactly sized buffer.
+                UChar buffer[200];
+                int32_t length = uspoof_getSkeleton(sc, type, input.getBuffer(), input.length(),
+                                                    NULL, 0, &status);
+                TEST_ASSERT_MSG(status == U_BUFFER_OVERFLOW_ERROR || expected.isEmpty(), msgBuf);
+                TEST_ASSERT_EQ(expected.length(), length);
+                status = U_ZERO_ERROR;
+                length = uspoof_getSkeleton(sc, type, input.getBuffer(), input.length(),
+                                            buffer, expected.length() + 1, &status);
+                TEST_ASSERT_SUCCESS(status);
+                TEST_ASSERT_MSG(expected == UnicodeString(buffer, length), msgBuf);
+                TEST_ASSERT_EQ(0, buffer[length]);
+
+                // C API with the output overwriting the input.
+                input.extract(buffer, UPRV_LENGTHOF(buffer), status);
+                length = uspoof_getSkeleton(sc, type, buffer, -1, buffer, UPRV_LENGTHOF(buffer), &status);
+                TEST_ASSERT_SUCCESS(status);
+                TEST_ASSERT_MSG(expected == UnicodeString(buffer, length), msgBuf);
+
+                // UTF-8, compared with the UTF-8 form of the UTF-16 skeleton.
+                if (input.indexOf((UChar)0xd800) >= 0) {
+                    continue;  // Unpaired surrogates do not round-trip through UTF-8.
+                }
+                char input8[400], expected8[400], buffer8[400];
+                int32_t input8Length, expected8Length;
+                u_strToUTF8(input8, UPRV_LENGTHOF(input8), &input8Length,
+                            input.getBuffer(), input.length(), &status);
+                u_strToUTF8(expected8, UPRV_LENGTHOF(expected8), &expected8Length,
+                            expected.getBuffer(), expected.length(), &status);
+                TEST_ASSERT_SUCCESS(status);
+                length = uspoof_getSkeletonUTF8(sc, type, input8, -1, NULL, 0, &status);
+                TEST_ASSERT_MSG(status == U_BUFFER_OVERFLOW_ERROR || expected.isEmpty(), msgBuf);
+                TEST_ASSERT_EQ(expected8Length, length);
+                status = U_ZERO_ERROR;
+                length = uspoof_getSkeletonUTF8(sc, type, input8, input8Length,
+                                                buffer8, UPRV_LENGTHOF(buffer8), &status);
+                TEST_ASSERT_SUCCESS(status);
+                TEST_ASSERT_MSG(length == expected8Length &&
+                                uprv_strcmp(expected8, buffer8) == 0, msgBuf);
+                if (length > 0) {
+                    status = U_ZERO_ERROR;
+                    uspoof_getSkeletonUTF8(sc, type, input8, input8Length,
+                                           buffer8, length - 1, &status);
+                    TEST_ASSERT_EQ(U_BUFFER_OVERFLOW_ERROR, status);
+                    status = U_ZERO_ERROR;
+                }
+            }
+        }
+    TEST_TEARDOWN;
+}
+
 #endif /* !UCONFIG_NO_REGULAR_EXPRESSIONS && !UCONFIG_NO_NORMALIZATION && !UCONFIG_NO_FILE_IO */
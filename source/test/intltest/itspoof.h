@@ -44,6 +44,8 @@ public:
 
     void testMixedNumbers();
 
+    void testSkeletonForms();
+
     // Internal function to run a single skeleton test case.
     void  checkSkeleton(const USpoofChecker *sc, uint32_t flags, 
                         const char *input, const char *expected, int32_t lineNum);
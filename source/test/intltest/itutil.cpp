@@ -1,6 +1,6 @@
 /********************************************************************
  * COPYRIGHT: 
- * Copyright (c) 1997-2015, International Business Machines Corporation and
+ * Copyright (c) 1997-2016, International Business Machines Corporation and
  * others. All Rights Reserved.
  ********************************************************************/
 
@@ -38,6 +38,7 @@ extern IntlTest *createSimplePatternFormatterTest();
 extern IntlTest *createUnifiedCacheTest();
 extern IntlTest *createQuantityFormatterTest();
 extern IntlTest *createPluralMapTest(); 
+extern IntlTest *createLocaleMatcherTest();
 
 
 #define CASE(id, test) case id:                               \
@@ -132,6 +133,14 @@ void IntlTestUtilities::runIndexedTest( int32_t index, UBool exec, const char* &
                 callTest(*test, par); 
             } 
             break;
+        case 24:
+            name = "LocaleMatcherTest";
+            if (exec) {
+                logln("TestSuite LocaleMatcherTest---"); logln();
+                LocalPointer<IntlTest> test(createLocaleMatcherTest());
+                callTest(*test, par);
+            }
+            break;
         default: name = ""; break; //needed to end loop
     }
 }
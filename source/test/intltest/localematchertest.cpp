@@ -0,0 +1,267 @@
+/*
+*******************************************************************************
+* Copyright (C) 2016, International Business Machines Corporation and         *
+* others. All Rights Reserved.                                                *
+*******************************************************************************
+*
+* File LOCALEMATCHERTEST.CPP
+*
+********************************************************************************
+*/
+#include "unicode/utypes.h"
+#include "unicode/localematcher.h"
+#include "unicode/uloc.h"
+
+#include "cstring.h"
+#include "intltest.h"
+
+class LocaleMatcherTest : public IntlTest {
+public:
+    LocaleMatcherTest() {
+    }
+    void TestExactMatch();
+    void TestLikelySubtags();
+    void TestRegions();
+    void TestDemotion();
+    void TestNoMatch();
+    void TestHTTP();
+    void TestDistance();
+    void TestBadArguments();
+    void runIndexedTest(int32_t index, UBool exec, const char *&name, char *par=0);
+private:
+    UBool haveLikelySubtags();
+    void checkBestMatch(const LocaleMatcher &matcher, const char *desired, const char *expected);
+    void checkBestMatchForHTTP(const LocaleMatcher &matcher, const char *header, const char *expected);
+};
+
+void LocaleMatcherTest::runIndexedTest(int32_t index, UBool exec, const char* &name, char* /*par*/) {
+    TESTCASE_AUTO_BEGIN;
+    TESTCASE_AUTO(TestExactMatch);
+    TESTCASE_AUTO(TestLikelySubtags);
+    TESTCASE_AUTO(TestRegions);
+    TESTCASE_AUTO(TestDemotion);
+    TESTCASE_AUTO(TestNoMatch);
+    TESTCASE_AUTO(TestHTTP);
+    TESTCASE_AUTO(TestDistance);
+    TESTCASE_AUTO(TestBadArguments);
+    TESTCASE_AUTO_END;
+}
+
+UBool LocaleMatcherTest::haveLikelySubtags() {
+    char maximized[ULOC_FULLNAME_CAPACITY];
+    UErrorCode errorCode = U_ZERO_ERROR;
+    uloc_addLikelySubtags("en", maximized, ULOC_FULLNAME_CAPACITY, &errorCode);
+    if (U_FAILURE(errorCode) || uprv_strcmp(maximized, "en_Latn_US") != 0) {
+        dataerrln("likely subtags data not available - %s", u_errorName(errorCode));
+        return FALSE;
+    }
+    return TRUE;
+}
+
+void LocaleMatcherTest::checkBestMatch(
+        const LocaleMatcher &matcher, const char *desired, const char *expected) {
+    UErrorCode errorCode = U_ZERO_ERROR;
+    const Locale *best = matcher.getBestMatch(Locale(desired), errorCode);
+    if (U_FAILURE(errorCode) || best == NULL) {
+        errln("getBestMatch(%s) failed - %s", desired, u_errorName(errorCode));
+        return;
+    }
+    if (uprv_strcmp(best->getName(), expected) != 0) {
+        errln("getBestMatch(%s) = %s, expected %s", desired, best->getName(), expected);
+    }
+}
+
+void LocaleMatcherTest::checkBestMatchForHTTP(
+        const LocaleMatcher &matcher, const char *header, const char *expected) {
+    UErrorCode errorCode = U_ZERO_ERROR;
+    const Locale *best = matcher.getBestMatchForHTTP(header, errorCode);
+    if (U_FAILURE(errorCode) || best == NULL) {
+        errln("getBestMatchForHTTP(\"%s\") failed - %s", header, u_errorName(errorCode));
+        return;
+    }
+    if (uprv_strcmp(best->getName(), expected) != 0) {
+        errln("getBestMatchForHTTP(\"%s\") = %s, expected %s", header, best->getName(), expected);
+    }
+}
+
+void LocaleMatcherTest::TestExactMatch() {
+    // Exact matches do not need any data.
+    Locale supported[] = { Locale("de"), Locale("fr", "CA"), Locale("ja", "JP") };
+    IcuTestErrorCode errorCode(*this, "TestExactMatch");
+    LocaleMatcher matcher(supported, 3, errorCode);
+    if (errorCode.logIfFailureAndReset("LocaleMatcher()")) {
+        return;
+    }
+    assertEquals("supported locales count", 3, matcher.getSupportedLocalesCount());
+    assertEquals("supported locale 1", "fr_CA", matcher.getSupportedLocale(1).getName());
+    checkBestMatch(matcher, "fr_CA", "fr_CA");
+    checkBestMatch(matcher, "ja_JP", "ja_JP");
+    checkBestMatch(matcher, "de", "de");
+}
+
+void LocaleMatcherTest::TestLikelySubtags() {
+    if (!haveLikelySubtags()) {
+        return;
+    }
+    Locale supported[] = {
+        Locale("en", "GB"), Locale("en", "US"), Locale("zh_Hans"), Locale("zh_Hant"),
+        Locale("sr"), Locale("sr_Latn")
+    };
+    IcuTestErrorCode errorCode(*this, "TestLikelySubtags");
+    LocaleMatcher matcher(supported, 6, errorCode);
+    if (errorCode.logIfFailureAndReset("LocaleMatcher()")) {
+        return;
+    }
+    checkBestMatch(matcher, "en", "en_US");
+    checkBestMatch(matcher, "zh_TW", "zh_Hant");
+    checkBestMatch(matcher, "zh_HK", "zh_Hant");
+    checkBestMatch(matcher, "zh_CN", "zh_Hans");
+    checkBestMatch(matcher, "zh", "zh_Hans");
+    // Serbian in Montenegro is written in Latin script.
+    checkBestMatch(matcher, "sr_ME", "sr_Latn");
+    checkBestMatch(matcher, "sr_BA", "sr");
+}
+
+void LocaleMatcherTest::TestRegions() {
+    if (!haveLikelySubtags()) {
+        return;
+    }
+    Locale supported[] = {
+        Locale("en", "US"), Locale("en", "GB"), Locale("es", "ES"), Locale("es", "419"),
+        Locale("pt", "PT"), Locale("pt", "BR")
+    };
+    IcuTestErrorCode errorCode(*this, "TestRegions");
+    LocaleMatcher matcher(supported, 6, errorCode);
+    if (errorCode.logIfFailureAndReset("LocaleMatcher()")) {
+        return;
+    }
+    // Mexico and Argentina are in Latin America, Spain is not.
+    checkBestMatch(matcher, "es_MX", "es_419");
+    checkBestMatch(matcher, "es_AR", "es_419");
+    checkBestMatch(matcher, "es", "es_ES");
+    // Ireland and the UK are both in Northern Europe.
+    checkBestMatch(matcher, "en_IE", "en_GB");
+    // Same language, unrelated regions: the first such supported locale wins.
+    checkBestMatch(matcher, "en_AU", "en_US");
+    checkBestMatch(matcher, "pt_AO", "pt_PT");
+}
+
+void LocaleMatcherTest::TestDemotion() {
+    if (!haveLikelySubtags()) {
+        return;
+    }
+    Locale supported[] = { Locale("en", "US"), Locale("de", "DE"), Locale("fr", "FR") };
+    IcuTestErrorCode errorCode(*this, "TestDemotion");
+    LocaleMatcher matcher(supported, 3, errorCode);
+    if (errorCode.logIfFailureAndReset("LocaleMatcher()")) {
+        return;
+    }
+    // A region mismatch for the first desired locale beats
+    // an exact match for the second one.
+    Locale desired[] = { Locale("de", "AT"), Locale("fr", "FR") };
+    const Locale *best = matcher.getBestMatch(desired, 2, errorCode);
+    if (!errorCode.logIfFailureAndReset("getBestMatch(de_AT, fr_FR)")) {
+        assertEquals("getBestMatch(de_AT, fr_FR)", "de_DE", best->getName());
+    }
+    // An unsupported first desired locale does not get in the way.
+    Locale desired2[] = { Locale("ja"), Locale("fr", "CH") };
+    best = matcher.getBestMatch(desired2, 2, errorCode);
+    if (!errorCode.logIfFailureAndReset("getBestMatch(ja, fr_CH)")) {
+        assertEquals("getBestMatch(ja, fr_CH)", "fr_FR", best->getName());
+    }
+}
+
+void LocaleMatcherTest::TestNoMatch() {
+    Locale supported[] = { Locale("en", "US"), Locale("de") };
+    IcuTestErrorCode errorCode(*this, "TestNoMatch");
+    LocaleMatcher matcher(supported, 2, errorCode);
+    if (errorCode.logIfFailureAndReset("LocaleMatcher()")) {
+        return;
+    }
+    // The default locale is the first supported one.
+    checkBestMatch(matcher, "ja_JP", "en_US");
+    checkBestMatch(matcher, "", "en_US");
+    const Locale *best = matcher.getBestMatch(NULL, 0, errorCode);
+    if (!errorCode.logIfFailureAndReset("getBestMatch(no desired locales)")) {
+        assertEquals("getBestMatch(no desired locales)", "en_US", best->getName());
+    }
+    checkBestMatchForHTTP(matcher, "", "en_US");
+    checkBestMatchForHTTP(matcher, "ko, *", "en_US");
+}
+
+void LocaleMatcherTest::TestHTTP() {
+    if (!haveLikelySubtags()) {
+        return;
+    }
+    Locale supported[] = {
+        Locale("en", "US"), Locale("en", "GB"), Locale("es", "419"), Locale("fr"), Locale("de")
+    };
+    IcuTestErrorCode errorCode(*this, "TestHTTP");
+    LocaleMatcher matcher(supported, 5, errorCode);
+    if (errorCode.logIfFailureAndReset("LocaleMatcher()")) {
+        return;
+    }
+    checkBestMatchForHTTP(matcher, "es-MX, fr;q=0.8, en;q=0.5", "es_419");
+    // The ranges are ordered by their quality values, not by their position.
+    checkBestMatchForHTTP(matcher, "fr;q=0.5, de;q=0.9, ja", "de");
+    checkBestMatchForHTTP(matcher, "ja;q=1.0,fr;q=0.001", "fr");
+    // q=0 means "not acceptable".
+    checkBestMatchForHTTP(matcher, "fr;q=0, de;q=0.1", "de");
+    checkBestMatchForHTTP(matcher, "*, fr;q=0.1", "fr");
+    checkBestMatchForHTTP(matcher, " en-GB-oed ; q = 0.7 , i-klingon", "en_GB");
+}
+
+void LocaleMatcherTest::TestDistance() {
+    IcuTestErrorCode errorCode(*this, "TestDistance");
+    assertEquals("same locale", (int32_t)LocaleMatcher::DISTANCE_EXACT,
+                 LocaleMatcher::getDistance(Locale("fr_CA"), Locale("fr_CA"), errorCode));
+    assertEquals("different languages", (int32_t)LocaleMatcher::DISTANCE_LANGUAGE,
+                 LocaleMatcher::getDistance(Locale("fr"), Locale("de"), errorCode));
+    if (!haveLikelySubtags()) {
+        return;
+    }
+    assertEquals("en vs. en_US", (int32_t)LocaleMatcher::DISTANCE_EXACT,
+                 LocaleMatcher::getDistance(Locale("en"), Locale("en_US"), errorCode));
+    assertEquals("es_MX vs. es_013", (int32_t)LocaleMatcher::DISTANCE_CONTAINING_REGION,
+                 LocaleMatcher::getDistance(Locale("es_MX"), Locale("es_013"), errorCode));
+    assertEquals("en_IE vs. en_GB", (int32_t)LocaleMatcher::DISTANCE_NEARBY_REGION,
+                 LocaleMatcher::getDistance(Locale("en_IE"), Locale("en_GB"), errorCode));
+    assertEquals("pt_PT vs. pt_BR", (int32_t)LocaleMatcher::DISTANCE_REGION,
+                 LocaleMatcher::getDistance(Locale("pt_PT"), Locale("pt_BR"), errorCode));
+    assertEquals("zh_TW vs. zh_Hans", (int32_t)LocaleMatcher::DISTANCE_SCRIPT + LocaleMatcher::DISTANCE_NEARBY_REGION,
+                 LocaleMatcher::getDistance(Locale("zh_TW"), Locale("zh_Hans"), errorCode));
+    errorCode.logIfFailureAndReset("getDistance()");
+}
+
+void LocaleMatcherTest::TestBadArguments() {
+    Locale supported[] = { Locale("en") };
+    UErrorCode errorCode = U_ZERO_ERROR;
+    LocaleMatcher empty(supported, 0, errorCode);
+    if (errorCode != U_ILLEGAL_ARGUMENT_ERROR) {
+        errln("LocaleMatcher(no supported locales) did not fail - %s", u_errorName(errorCode));
+    }
+    errorCode = U_ZERO_ERROR;
+    LocaleMatcher matcher(supported, 1, errorCode);
+    if (U_FAILURE(errorCode)) {
+        errln("LocaleMatcher() failed - %s", u_errorName(errorCode));
+        return;
+    }
+    const Locale *best = matcher.getBestMatchForHTTP(NULL, errorCode);
+    if (errorCode != U_ILLEGAL_ARGUMENT_ERROR || best != NULL) {
+        errln("getBestMatchForHTTP(NULL) did not fail - %s", u_errorName(errorCode));
+    }
+    errorCode = U_ZERO_ERROR;
+    best = matcher.getBestMatch(NULL, 1, errorCode);
+    if (errorCode != U_ILLEGAL_ARGUMENT_ERROR || best != NULL) {
+        errln("getBestMatch(NULL, 1) did not fail - %s", u_errorName(errorCode));
+    }
+    errorCode = U_MEMORY_ALLOCATION_ERROR;
+    best = matcher.getBestMatch(Locale("en"), errorCode);
+    if (errorCode != U_MEMORY_ALLOCATION_ERROR || best != NULL) {
+        errln("getBestMatch() did not return NULL for an incoming failure code");
+    }
+}
+
+extern IntlTest *createLocaleMatcherTest() {
+    return new LocaleMatcherTest();
+}
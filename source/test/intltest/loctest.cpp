@@ -1,6 +1,6 @@
 /********************************************************************
  * COPYRIGHT:
- * Copyright (c) 1997-2015, International Business Machines Corporation and
+ * Copyright (c) 1997-2016, International Business Machines Corporation and
  * others. All Rights Reserved.
  ********************************************************************/
 
@@ -225,6 +225,7 @@ void LocaleTest::runIndexedTest( int32_t index, UBool exec, const char* &name, c
     TESTCASE_AUTO(TestCurrencyByDate);
     TESTCASE_AUTO(TestGetVariantWithKeywords);
     TESTCASE_AUTO(TestIsRightToLeft);
+    TESTCASE_AUTO(TestRepeatedLocaleIDs);
     TESTCASE_AUTO_END;
 }
 
@@ -2695,3 +2696,52 @@ void LocaleTest::TestBug11421() {
         }
     }
 }
+
+void LocaleTest::TestRepeatedLocaleIDs() {
+    // Locale IDs are parsed once and then reused;
+    // later Locale objects for the same ID must be indistinguishable.
+    static const char *const ids[] = {
+        "en_US", "en-US", "zh_Hant_TW", "de__POSIX", "sr_Latn_RS_REVISED", "x-piglatin_ML", "und", ""
+    };
+    for (int32_t i = 0; i < UPRV_LENGTHOF(ids); ++i) {
+        Locale first(ids[i]);
+        for (int32_t j = 0; j < 2; ++j) {
+            Locale again(ids[i]);
+            if (uprv_strcmp(first.getName(), again.getName()) != 0 ||
+                    uprv_strcmp(first.getBaseName(), again.getBaseName()) != 0 ||
+                    uprv_strcmp(first.getLanguage(), again.getLanguage()) != 0 ||
+                    uprv_strcmp(first.getScript(), again.getScript()) != 0 ||
+                    uprv_strcmp(first.getCountry(), again.getCountry()) != 0 ||
+                    uprv_strcmp(first.getVariant(), again.getVariant()) != 0) {
+                errln("Locale(\"%s\") differs from an earlier one: \"%s\" vs. \"%s\"",
+                      ids[i], again.getName(), first.getName());
+            }
+            if (first != again || first.hashCode() != again.hashCode()) {
+                errln("Locale(\"%s\") != or different hashCode() from an earlier one", ids[i]);
+            }
+        }
+    }
+
+    // The hash code follows keyword changes.
+    UErrorCode status = U_ZERO_ERROR;
+    Locale plain("de_DE");
+    Locale withKeyword(plain);
+    withKeyword.setKeywordValue("collation", "phonebook", status);
+    if (U_FAILURE(status)) {
+        errln("setKeywordValue() failed: %s", u_errorName(status));
+        return;
+    }
+    Locale parsed("de_DE@collation=phonebook");
+    assertTrue("keyword added", withKeyword != plain);
+    assertTrue("keyword added == parsed", withKeyword == parsed);
+    assertEquals("keyword added hashCode", parsed.hashCode(), withKeyword.hashCode());
+    withKeyword.setKeywordValue("collation", NULL, status);
+    assertTrue("keyword removed", withKeyword == plain);
+    assertEquals("keyword removed hashCode", plain.hashCode(), withKeyword.hashCode());
+
+    // A bogus Locale hashes like an empty one and does not equal a real one.
+    Locale bogus(plain);
+    bogus.setToBogus();
+    assertTrue("bogus != de_DE", bogus != plain);
+    assertEquals("bogus hashCode", Locale("").hashCode(), bogus.hashCode());
+}
@@ -1,6 +1,6 @@
 /********************************************************************
  * COPYRIGHT: 
- * Copyright (c) 1997-2015, International Business Machines Corporation and
+ * Copyright (c) 1997-2016, International Business Machines Corporation and
  * others. All Rights Reserved.
  ********************************************************************/
 
@@ -103,6 +103,7 @@ public:
     void TestGetVariantWithKeywords(void);
     void TestIsRightToLeft();
     void TestBug11421();
+    void TestRepeatedLocaleIDs();
 
 private:
     void _checklocs(const char* label,
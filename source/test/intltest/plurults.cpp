@@ -1,6 +1,6 @@
 /*
 *******************************************************************************
-* Copyright (C) 2007-2014, International Business Machines Corporation and
+* Copyright (C) 2007-2016, International Business Machines Corporation and
 * others. All Rights Reserved.
 ********************************************************************************
 
@@ -49,6 +49,7 @@ void PluralRulesTest::runIndexedTest( int32_t index, UBool exec, const char* &na
     TESTCASE_AUTO(testAvailbleLocales);
     TESTCASE_AUTO(testParseErrors);
     TESTCASE_AUTO(testFixedDecimal);
+    TESTCASE_AUTO(testSelectIntegers);
     TESTCASE_AUTO_END;
 }
 
@@ -999,6 +1000,44 @@ void PluralRulesTest::testFixedDecimal() {
     }
 }
 
-
+void PluralRulesTest::testSelectIntegers() {
+    // The cached rules for a locale select the keywords of small integers from a table.
+    // Rules created from the same description evaluate the rules instead.
+    static const struct {
+        const char *locale;
+        const char *rules;
+    } cases[] = {
+        { "ar", "zero: n = 0; one: n = 1; two: n = 2; few: n % 100 = 3..10; many: n % 100 = 11..99" },
+        { "ru", "one: v = 0 and i % 10 = 1 and i % 100 != 11; "
+                "few: v = 0 and i % 10 = 2..4 and i % 100 != 12..14; "
+                "many: v = 0 and i % 10 = 0 or v = 0 and i % 10 = 5..9 or v = 0 and i % 100 = 11..14" },
+        { "lv", "zero: n % 10 = 0 or n % 100 = 11..19 or v = 2 and f % 100 = 11..19; "
+                "one: n % 10 = 1 and n % 100 != 11 or v = 2 and f % 10 = 1 and f % 100 != 11 "
+                "or v != 2 and f % 10 = 1" }
+    };
+    IcuTestErrorCode status(*this, "testSelectIntegers");
+    for (int32_t i = 0; i < UPRV_LENGTHOF(cases); ++i) {
+        const char *locale = cases[i].locale;
+        LocalPointer<PluralRules> cached(PluralRules::forLocale(locale, status));
+        if (status.logDataIfFailureAndReset("PluralRules::forLocale(%s)", locale)) {
+            continue;
+        }
+        LocalPointer<PluralRules> evaluated(
+            PluralRules::createRules(UnicodeString(cases[i].rules, -1, US_INV), status));
+        if (status.logIfFailureAndReset("PluralRules::createRules(%s)", locale)) {
+            continue;
+        }
+        LocalPointer<PluralRules> copy(cached->clone());
+        for (int32_t n = -1100; n <= 1100; ++n) {
+            UnicodeString expected = evaluated->select(n);
+            if (expected != cached->select(n) || expected != copy->select((double)n) ||
+                    expected != cached->select(FixedDecimal(n, 0, 0)) ||
+                    evaluated->select(n + 0.5) != cached->select(n + 0.5)) {
+                errln("PluralRules::select(%d) differs from the %s rules", (int)n, locale);
+                break;
+            }
+        }
+    }
+}
 
 #endif /* #if !UCONFIG_NO_FORMATTING */
@@ -1,6 +1,6 @@
 /*
  **********************************************************************
- *   Copyright (C) 2005-2014, International Business Machines
+ *   Copyright (C) 2005-2016, International Business Machines
  *   Corporation and others.  All Rights Reserved.
  **********************************************************************
  */
@@ -12,6 +12,7 @@
 #include "cmemory.h"
 #include "cstring.h"
 #include "usrchimp.h"
+#include "uvectr32.h"
 
 #include "unicode/coll.h"
 #include "unicode/tblcoll.h"
@@ -85,6 +86,14 @@ void SSearchTest::runIndexedTest( int32_t index, UBool exec, const char* &name,
         case 5: name = "searchTime";
             if (exec) searchTime();
             break;
+
+        case 6: name = "skipTest";
+            if (exec) skipTest();
+            break;
+
+        case 7: name = "multiSearchTest";
+            if (exec) multiSearchTest();
+            break;
 #endif
         default: name = "";
             break; //needed to end loop
@@ -806,6 +815,270 @@ void SSearchTest::goodSuffixTest()
     ucol_close(coll);
 }
 
+//
+//  skipTest()    usearch_search() skips over runs of text that cannot contain
+//                a match. Check matches next to and across the characters that
+//                end those runs: expansions, contractions, combining marks,
+//                shifted variables and supplementary characters.
+//                The test texts are surrounded by filler because short texts
+//                are searched without skipping.
+//
+void SSearchTest::skipTest()
+{
+    static const struct {
+        const char          *pattern;
+        const char          *text;
+        UColAttributeValue  strength;
+        UColAttributeValue  alternate;
+        int32_t             matches[9];     // start, limit pairs, -1 terminated
+    } testCases[] = {
+        {"abc", "xxabcxx abc", UCOL_PRIMARY, UCOL_NON_IGNORABLE, {2, 5, 8, 11, -1}},
+        {"resume", "Le R\\u00C9SUM\\u00C9 et le re\\u0301sume\\u0301, resumed.",
+            UCOL_PRIMARY, UCOL_NON_IGNORABLE, {3, 9, 16, 24, 26, 32, -1}},
+        {"resume", "Le R\\u00C9SUM\\u00C9 et le re\\u0301sume\\u0301, resumed.",
+            UCOL_SECONDARY, UCOL_NON_IGNORABLE, {26, 32, -1}},
+        // U+249C PARENTHESIZED LATIN SMALL LETTER A expands to "(a)".
+        {"a", "x\\u249Cy a(a)", UCOL_PRIMARY, UCOL_NON_IGNORABLE, {4, 5, 6, 7, -1}},
+        {"a)", "x\\u249Cy a(a)", UCOL_PRIMARY, UCOL_NON_IGNORABLE, {6, 8, -1}},
+        {"(a", "x\\u249Cy (a)", UCOL_PRIMARY, UCOL_SHIFTED, {5, 6, -1}},
+        // "l\\u00B7" is a contraction.
+        {"l", "al\\u00B7b l L\\u0387 l", UCOL_PRIMARY, UCOL_NON_IGNORABLE, {1, 2, 5, 6, 7, 8, 10, 11, -1}},
+        {"e\\u0301", "ze\\u0301 e\\u0301\\u0323 \\u00E9x e\\u0323\\u0301",
+            UCOL_SECONDARY, UCOL_NON_IGNORABLE, {1, 3, 8, 9, -1}},
+        {"a b", "a-b, a b, ab", UCOL_TERTIARY, UCOL_SHIFTED, {0, 3, 5, 8, 10, 12, -1}},
+        {"\\U0001D400", "x\\U0001D400A\\U0001D400", UCOL_PRIMARY, UCOL_NON_IGNORABLE, {1, 3, 3, 4, 4, 6, -1}},
+        {"\\u0E40\\u0E01", "\\u0E01\\u0E40\\u0E01 \\u0E40\\u0E02\\u0E40\\u0E01",
+            UCOL_PRIMARY, UCOL_NON_IGNORABLE, {1, 3, 6, 8, -1}},
+        {"\\uAC00", "\\u1100\\u1161 \\uAC00\\uAC01", UCOL_PRIMARY, UCOL_NON_IGNORABLE, {0, 2, 3, 4, -1}},
+        {"ss", "Stra\\u00DFe strasse", UCOL_PRIMARY, UCOL_NON_IGNORABLE, {4, 5, 11, 13, -1}},
+        {"\\u0438", "\\u0439 \\u0438\\u0306 \\u0438", UCOL_PRIMARY, UCOL_NON_IGNORABLE, {5, 6, -1}},
+        // Contractions starting with a character that is not in the pattern.
+        {"\\u0439", "\\u0418\\u0306 \\u0419 \\u0418", UCOL_PRIMARY, UCOL_NON_IGNORABLE, {0, 2, 3, 4, -1}},
+        {"\\u00B7", "l\\u00B7 \\u00B7 L\\u00B7", UCOL_PRIMARY, UCOL_NON_IGNORABLE, {3, 4, -1}},
+    };
+
+    const int32_t fillerLength = 520;
+    for (int32_t i = 0; i < UPRV_LENGTHOF(testCases); ++i) {
+        UErrorCode status = U_ZERO_ERROR;
+        UnicodeString pattern = UnicodeString(testCases[i].pattern, -1, US_INV).unescape();
+        UnicodeString filler((UChar32)0x7a, fillerLength, fillerLength);
+        UnicodeString text(filler);
+        text.append(UnicodeString(testCases[i].text, -1, US_INV).unescape()).append(filler);
+        LocalUCollatorPointer coll(ucol_open("", &status));
+        if (U_FAILURE(status)) {
+            dataerrln("ucol_open() failed - %s", u_errorName(status));
+            return;
+        }
+        ucol_setStrength(coll.getAlias(), testCases[i].strength);
+        ucol_setAttribute(coll.getAlias(), UCOL_ALTERNATE_HANDLING, testCases[i].alternate, &status);
+        LocalUStringSearchPointer ss(usearch_openFromCollator(pattern.getBuffer(), pattern.length(),
+                                                              text.getBuffer(), text.length(),
+                                                              coll.getAlias(), NULL, &status));
+        if (U_FAILURE(status)) {
+            dataerrln("usearch_openFromCollator() failed - %s", u_errorName(status));
+            return;
+        }
+
+        const int32_t *expected = testCases[i].matches;
+        int32_t start = -1, limit = -1;
+        for (int32_t index = 0; usearch_search(ss.getAlias(), index, &start, &limit, &status);
+                index = limit, expected += 2) {
+            if (expected[0] < 0) {
+                errln("test case %d: usearch_search(%d) found [%d, %d], expected no match",
+                      (int)i, (int)index, (int)start, (int)limit);
+                break;
+            }
+            if (fillerLength + expected[0] != start || fillerLength + expected[1] != limit) {
+                errln("test case %d: usearch_search(%d) found [%d, %d], expected [%d, %d]",
+                      (int)i, (int)index, (int)start, (int)limit,
+                      (int)(fillerLength + expected[0]), (int)(fillerLength + expected[1]));
+                break;
+            }
+        }
+        TEST_ASSERT_SUCCESS(status);
+        if (U_SUCCESS(status) && expected[0] >= 0 && start < 0) {
+            errln("test case %d: usearch_search() did not find [%d, %d]",
+                  (int)i, (int)(fillerLength + expected[0]), (int)(fillerLength + expected[1]));
+        }
+    }
+
+    // A match at the end of a long text that has the pattern's characters
+    // only in runs that are too short to hold it.
+    UErrorCode status = U_ZERO_ERROR;
+    UnicodeString pattern("needle", -1, US_INV);
+    UnicodeString text;
+    for (int32_t i = 0; i < 1000; ++i) {
+        text.append(UNICODE_STRING_SIMPLE("need\\u00E9 l\\u00E9e, \\u249C\\u0301; ").unescape());
+    }
+    int32_t expectedStart = text.length();
+    text.append(UNICODE_STRING_SIMPLE("N\\u00C9EDLE").unescape());
+    LocalUCollatorPointer coll(ucol_open("", &status));
+    if (U_FAILURE(status)) {
+        dataerrln("ucol_open() failed - %s", u_errorName(status));
+        return;
+    }
+    ucol_setStrength(coll.getAlias(), UCOL_PRIMARY);
+    LocalUStringSearchPointer ss(usearch_openFromCollator(pattern.getBuffer(), pattern.length(),
+                                                          text.getBuffer(), text.length(),
+                                                          coll.getAlias(), NULL, &status));
+    int32_t start = -1, limit = -1;
+    UBool found = usearch_search(ss.getAlias(), 0, &start, &limit, &status);
+    if (U_FAILURE(status)) {
+        dataerrln("usearch_search() failed - %s", u_errorName(status));
+    } else if (!found || start != expectedStart || limit != text.length()) {
+        errln("usearch_search() in a long text found %d [%d, %d], expected [%d, %d]",
+              found, (int)start, (int)limit, (int)expectedStart, (int)text.length());
+    }
+}
+
+void SSearchTest::multiSearchTest()
+{
+    UErrorCode status = U_ZERO_ERROR;
+    LocalUCollatorPointer coll(ucol_open("", &status));
+    if (U_FAILURE(status)) {
+        dataerrln("ucol_open() failed - %s", u_errorName(status));
+        return;
+    }
+    ucol_setStrength(coll.getAlias(), UCOL_PRIMARY);
+
+    // Patterns that are prefixes and suffixes of each other,
+    // reported in the order in which their ends are found.
+    {
+        static const UChar he[] = { 0x68, 0x65 }, she[] = { 0x53, 0x48, 0x45 };
+        static const UChar his[] = { 0x68, 0x69, 0x73 }, hers[] = { 0x68, 0x65, 0x72, 0x73 };
+        static const UChar *const patterns[] = { he, she, his, hers };
+        static const int32_t patternLengths[] = { 2, 3, 3, 4 };
+        static const int32_t expected[][3] = { { 1, 1, 4 }, { 0, 2, 4 }, { 3, 2, 6 } };
+        UnicodeString text = UNICODE_STRING_SIMPLE("ush\\u00C8rs").unescape();
+        LocalUMultiStringSearchPointer ms(usearch_openMulti(patterns, patternLengths, 4,
+                                                            text.getBuffer(), text.length(),
+                                                            coll.getAlias(), &status));
+        int32_t p, start, limit;
+        int32_t count = 0;
+        while (usearch_nextMulti(ms.getAlias(), &p, &start, &limit, &status)) {
+            if (count < UPRV_LENGTHOF(expected) &&
+                    (p != expected[count][0] || start != expected[count][1] || limit != expected[count][2])) {
+                errln("usearch_nextMulti() match %d is pattern %d [%d, %d], expected pattern %d [%d, %d]",
+                      (int)count, (int)p, (int)start, (int)limit,
+                      (int)expected[count][0], (int)expected[count][1], (int)expected[count][2]);
+            }
+            ++count;
+        }
+        TEST_ASSERT_SUCCESS(status);
+        if (count != UPRV_LENGTHOF(expected) || p != -1 || start != -1 || limit != -1) {
+            errln("usearch_nextMulti() found %d matches, expected %d",
+                  (int)count, (int)UPRV_LENGTHOF(expected));
+        }
+    }
+
+    // A pattern without a primary weight cannot be searched for.
+    {
+        static const UChar a[] = { 0x61 }, acute[] = { 0x301 };
+        static const UChar *const patterns[] = { a, acute };
+        static const int32_t patternLengths[] = { 1, 1 };
+        status = U_ZERO_ERROR;
+        LocalUMultiStringSearchPointer ms(usearch_openMulti(patterns, patternLengths, 2,
+                                                            a, 1, coll.getAlias(), &status));
+        if (status != U_ILLEGAL_ARGUMENT_ERROR || ms.isValid()) {
+            errln("usearch_openMulti() with a primary ignorable pattern returned %s, "
+                  "expected U_ILLEGAL_ARGUMENT_ERROR", u_errorName(status));
+        }
+    }
+
+    // Each pattern's matches must be those of usearch_next().
+    static const char *const patternStrings[] = {
+        "resume", "sum", "me", "resume", "xx", "\\u00E9", "e\\u0301", "l", "a)", "(a", "ss",
+        "a b", "\\u0E40\\u0E01", "\\uAC00", "\\u0438", "\\U0001D400"
+    };
+    UnicodeString texts[2];
+    texts[0] = UNICODE_STRING_SIMPLE(
+        "Le R\\u00C9SUM\\u00C9 et le re\\u0301sume\\u0301, resumed. x\\u249Cy a(a) "
+        "al\\u00B7b l L\\u0387 l ze\\u0301 e\\u0301\\u0323 \\u00E9x e\\u0323\\u0301 a-b, a b, ab "
+        "x\\U0001D400A\\U0001D400 \\u0E01\\u0E40\\u0E01 \\u0E40\\u0E02\\u0E40\\u0E01 "
+        "\\u1100\\u1161 \\uAC00\\uAC01 Stra\\u00DFe strasse \\u0439 \\u0438\\u0306 \\u0438 xXx").unescape();
+    for (int32_t i = 0; i < 40; ++i) {
+        texts[1].append(texts[0]);
+    }
+    static const UColAttributeValue strengths[] = { UCOL_PRIMARY, UCOL_SECONDARY, UCOL_TERTIARY };
+    UnicodeString patterns[UPRV_LENGTHOF(patternStrings)];
+    const UChar *patternBuffers[UPRV_LENGTHOF(patternStrings)];
+    int32_t patternLengths[UPRV_LENGTHOF(patternStrings)];
+    for (int32_t i = 0; i < UPRV_LENGTHOF(patternStrings); ++i) {
+        patterns[i] = UnicodeString(patternStrings[i], -1, US_INV).unescape();
+        patternBuffers[i] = patterns[i].getBuffer();
+        patternLengths[i] = patterns[i].length();
+    }
+    for (int32_t si = 0; si < UPRV_LENGTHOF(strengths); ++si) {
+        for (int32_t shifted = 0; shifted < 2; ++shifted) {
+            status = U_ZERO_ERROR;
+            ucol_setStrength(coll.getAlias(), strengths[si]);
+            ucol_setAttribute(coll.getAlias(), UCOL_ALTERNATE_HANDLING,
+                              shifted ? UCOL_SHIFTED : UCOL_NON_IGNORABLE, &status);
+            int32_t patternCount = UPRV_LENGTHOF(patterns);
+            LocalUMultiStringSearchPointer ms(usearch_openMulti(patternBuffers, patternLengths,
+                                                                patternCount,
+                                                                texts[0].getBuffer(), texts[0].length(),
+                                                                coll.getAlias(), &status));
+            if (U_FAILURE(status)) {
+                errln("usearch_openMulti(strength %d) failed - %s", (int)si, u_errorName(status));
+                continue;
+            }
+            for (int32_t ti = 0; ti < UPRV_LENGTHOF(texts); ++ti) {
+                const UnicodeString &text = texts[ti];
+                usearch_setMultiText(ms.getAlias(), text.getBuffer(), text.length(), &status);
+                // Matches of one pattern are found in order.
+                UVector32 found(status);
+                int32_t p, start, limit;
+                while (usearch_nextMulti(ms.getAlias(), &p, &start, &limit, &status)) {
+                    found.addElement(p, status);
+                    found.addElement(start, status);
+                    found.addElement(limit, status);
+                }
+                TEST_ASSERT_SUCCESS(status);
+                for (p = 0; p < patternCount; ++p) {
+                    LocalUStringSearchPointer ss(usearch_openFromCollator(
+                            patternBuffers[p], patternLengths[p], text.getBuffer(), text.length(),
+                            coll.getAlias(), NULL, &status));
+                    int32_t f = 0;
+                    for (start = usearch_first(ss.getAlias(), &status);
+                            start != USEARCH_DONE && U_SUCCESS(status);
+                            start = usearch_next(ss.getAlias(), &status)) {
+                        limit = start + usearch_getMatchedLength(ss.getAlias());
+                        while (f < found.size() && found.elementAti(f) != p) {
+                            f += 3;
+                        }
+                        if (f == found.size()) {
+                            errln("strength %d shifted %d text %d: usearch_nextMulti() did not find "
+                                  "pattern %d at [%d, %d]", (int)si, (int)shifted, (int)ti,
+                                  (int)p, (int)start, (int)limit);
+                            break;
+                        }
+                        if (found.elementAti(f + 1) != start || found.elementAti(f + 2) != limit) {
+                            errln("strength %d shifted %d text %d: usearch_nextMulti() found "
+                                  "pattern %d at [%d, %d], expected [%d, %d]",
+                                  (int)si, (int)shifted, (int)ti, (int)p,
+                                  (int)found.elementAti(f + 1), (int)found.elementAti(f + 2),
+                                  (int)start, (int)limit);
+                            break;
+                        }
+                        f += 3;
+                    }
+                    TEST_ASSERT_SUCCESS(status);
+                    while (f < found.size() && found.elementAti(f) != p) {
+                        f += 3;
+                    }
+                    if (f < found.size()) {
+                        errln("strength %d shifted %d text %d: usearch_nextMulti() found "
+                              "pattern %d at [%d, %d], expected no further match",
+                              (int)si, (int)shifted, (int)ti, (int)p,
+                              (int)found.elementAti(f + 1), (int)found.elementAti(f + 2));
+                    }
+                }
+            }
+        }
+    }
+}
+
 //
 //  searchTime()    A quick and dirty performance test for string search.
 //                  Probably  doesn't really belong as part of intltest, but it
@@ -1,6 +1,6 @@
 /*
  **********************************************************************
- *   Copyright (C) 2005-2012, International Business Machines
+ *   Copyright (C) 2005-2016, International Business Machines
  *   Corporation and others.  All Rights Reserved.
  **********************************************************************
  */
@@ -35,6 +35,8 @@ public:
     virtual void monkeyTest(char *params);
     virtual void sharpSTest();
     virtual void goodSuffixTest();
+    virtual void skipTest();
+    virtual void multiSearchTest();
     virtual void searchTime();
 
 private:
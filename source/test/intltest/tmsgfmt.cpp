@@ -1,6 +1,6 @@
 /********************************************************************
  * COPYRIGHT: 
- * Copyright (c) 1997-2015, International Business Machines Corporation and
+ * Copyright (c) 1997-2016, International Business Machines Corporation and
  * others. All Rights Reserved.
  ********************************************************************
  * File TMSGFMT.CPP
@@ -30,6 +30,7 @@
 #include "unicode/messagepattern.h"
 #include "unicode/selfmt.h"
 #include "unicode/gregocal.h"
+#include "unicode/appendable.h"
 #include <stdio.h>
 
 void
@@ -67,6 +68,8 @@ TestMessageFormat::runIndexedTest(int32_t index, UBool exec,
     TESTCASE_AUTO(TestTrimArgumentName);
     TESTCASE_AUTO(TestSelectOrdinal);
     TESTCASE_AUTO(TestDecimals);
+    TESTCASE_AUTO(TestAppendableFormat);
+    TESTCASE_AUTO(TestNamedArgumentInArray);
     TESTCASE_AUTO_END;
 }
 
@@ -1961,4 +1964,78 @@ void TestMessageFormat::TestDecimals() {
     errorCode.reset();
 }
 
+void TestMessageFormat::TestAppendableFormat() {
+    // The Appendable variant of format() must yield the same text as the
+    // UnicodeString variants, also after the formats or the pattern change.
+    IcuTestErrorCode errorCode(*this, "TestAppendableFormat");
+    MessageFormat m(
+        "'{'It''s'}' {who} {count,plural,one{has # file}other{has # files}} "
+        "{who,select,Alice{(her)}other{(their)}} at {when}.",
+        Locale::getEnglish(), errorCode);
+    if (errorCode.logDataIfFailureAndReset("Unable to instantiate MessageFormat")) {
+        return;
+    }
+    UnicodeString names[] = { "when", "count", "who" };
+    Formattable args[] = { "noon", (int32_t)3, "Alice" };
+    UnicodeString expected;
+    m.format(names, args, 3, expected, errorCode);
+    if (errorCode.logDataIfFailureAndReset("Unable to format a plural argument")) {
+        return;
+    }
+    assertEquals("UnicodeString format()",
+                 "{It's} Alice has 3 files (her) at noon.", expected);
+    UnicodeString result("prefix: ");
+    UnicodeStringAppendable app(result);
+    assertTrue("format() returns the Appendable", &m.format(names, args, 3, app, errorCode) == &app);
+    assertEquals("Appendable format()", UnicodeString("prefix: ").append(expected), result);
+
+    // Missing argument.
+    result.remove();
+    m.format(names, args, 2, app, errorCode);
+    assertEquals("Appendable format() with a missing argument",
+                 "{It's} {who} has 3 files {who} at noon.", result);
+
+    // A custom format for one argument.
+    SelectFormat when("noon{at 12:00}other{sometime}", errorCode);
+    m.setFormat("when", when, errorCode);
+    result.remove();
+    m.format(names, args, 3, app, errorCode);
+    expected.remove();
+    m.format(names, args, 3, expected, errorCode);
+    assertEquals("UnicodeString format() after setFormat()",
+                 "{It's} Alice has 3 files (her) at at 12:00.", expected);
+    assertEquals("Appendable format() after setFormat()", expected, result);
+
+    // Copies and a new pattern with numbered arguments.
+    MessageFormat copy(m);
+    result.remove();
+    copy.format(names, args, 3, app, errorCode);
+    assertEquals("Appendable format() of a copy", expected, result);
+    m.applyPattern("{1}-{0}-{2}-{1}", errorCode);
+    result.remove();
+    m.format(NULL, args, 2, app, errorCode);
+    assertEquals("Appendable format() with numbered arguments", "3-noon-{2}-3", result);
+    assertEquals("copy unaffected by applyPattern()", expected,
+                 copy.format(names, args, 3, result.remove(), errorCode));
+}
+
+void TestMessageFormat::TestNamedArgumentInArray() {
+    // Formatting an array without argument names resolves a named argument
+    // the same way at the top level and in a sub-message.
+    IcuTestErrorCode errorCode(*this, "TestNamedArgumentInArray");
+    MessageFormat m("{0, select, other{[{name}]}} top={name}", Locale::getEnglish(), errorCode);
+    if (errorCode.logDataIfFailureAndReset("Unable to instantiate MessageFormat")) {
+        return;
+    }
+    Formattable args[] = { "Bob", (int32_t)3 };
+    UnicodeString result;
+    FieldPosition ignore(FieldPosition::DONT_CARE);
+    assertEquals("format(array) with a named argument", "[Bob] top=Bob",
+                 m.format(args, 2, result, ignore, errorCode));
+    result.remove();
+    UnicodeStringAppendable app(result);
+    m.format(NULL, args, 2, app, errorCode);
+    assertEquals("Appendable format() with a named argument", "[Bob] top=Bob", result);
+}
+
 #endif /* #if !UCONFIG_NO_FORMATTING */
@@ -118,6 +118,8 @@ public:
     void TestTrimArgumentName();
     void TestSelectOrdinal();
     void TestDecimals();
+    void TestAppendableFormat();
+    void TestNamedArgumentInArray();
 
 private:
     UnicodeString GetPatternAndSkipSyntax(const MessagePattern& pattern);
@@ -1,6 +1,6 @@
 /*
 *******************************************************************************
-* Copyright (C) 2007-2015, International Business Machines Corporation and    *
+* Copyright (C) 2007-2016, International Business Machines Corporation and    *
 * others. All Rights Reserved.                                                *
 *******************************************************************************
 */
@@ -20,6 +20,7 @@
 #include "unicode/basictz.h"
 #include "unicode/tzfmt.h"
 #include "unicode/localpointer.h"
+#include "cmemory.h"
 #include "cstring.h"
 #include "zonemeta.h"
 
@@ -77,6 +78,7 @@ TimeZoneFormatTest::runIndexedTest( int32_t index, UBool exec, const char* &name
         TESTCASE(3, TestISOFormat);
         TESTCASE(4, TestFormat);
         TESTCASE(5, TestFormatTZDBNames);
+        TESTCASE(6, TestParseSharedNames);
         default: name = ""; break;
     }
 }
@@ -850,6 +852,79 @@ TimeZoneFormatTest::TestParse(void) {
     }
 }
 
+void
+TimeZoneFormatTest::TestParseSharedNames(void) {
+    // Names of zones other than the default zone are not loaded into a
+    // TimeZoneNames instance up front, so parsing them reaches the names trie
+    // which all instances for the same locale share.
+    // Mixed case text checks that the shared trie matches case-insensitively.
+    const ParseTestData DATA[] = {
+        //   text               inPos   locale      style
+        //      parseOptions                        expected            outPos  timeType
+            {"central european STANDARD time",  0,  "en_US",    UTZFMT_STYLE_SPECIFIC_LONG,
+                UTZFMT_PARSE_OPTION_NONE,           "Europe/Paris",     30,     UTZFMT_TIME_TYPE_STANDARD},
+
+            {"Australian Eastern Daylight Time",    0,  "en_US",    UTZFMT_STYLE_SPECIFIC_LONG,
+                UTZFMT_PARSE_OPTION_NONE,           "Australia/Sydney", 32,     UTZFMT_TIME_TYPE_DAYLIGHT},
+
+            {"--INDIA standard Time--", 2,  "en_US",    UTZFMT_STYLE_SPECIFIC_LONG,
+                UTZFMT_PARSE_OPTION_NONE,           "Asia/Calcutta",    21,     UTZFMT_TIME_TYPE_STANDARD},
+
+            {"japan time",      0,      "en_US",    UTZFMT_STYLE_GENERIC_LONG,
+                UTZFMT_PARSE_OPTION_NONE,           "Asia/Tokyo",       10,     UTZFMT_TIME_TYPE_UNKNOWN},
+
+            {"Central European Time xyz",   0,  "en_US",    UTZFMT_STYLE_GENERIC_LONG,
+                UTZFMT_PARSE_OPTION_NONE,           "Europe/Paris",     21,     UTZFMT_TIME_TYPE_UNKNOWN},
+
+            {NULL,              0,      NULL,       UTZFMT_STYLE_GENERIC_LOCATION,
+                UTZFMT_PARSE_OPTION_NONE,           NULL,               0,      UTZFMT_TIME_TYPE_UNKNOWN}
+    };
+
+    // Make sure that none of the zones above is the default zone.
+    LocalPointer<TimeZone> defaultZone(TimeZone::createDefault());
+    TimeZone::adoptDefault(TimeZone::createTimeZone("America/Los_Angeles"));
+
+    UErrorCode status = U_ZERO_ERROR;
+    LocalPointer<TimeZoneFormat> tzfmt1(TimeZoneFormat::createInstance(Locale("en_US"), status));
+    LocalPointer<TimeZoneFormat> tzfmt2(TimeZoneFormat::createInstance(Locale("en_US"), status));
+    if (U_FAILURE(status)) {
+        dataerrln("Fail TimeZoneFormat::createInstance: %s", u_errorName(status));
+        TimeZone::adoptDefault(defaultZone.orphan());
+        return;
+    }
+    // Parse each text with the first instance, then with the second one,
+    // and then once more with the first one.
+    TimeZoneFormat *formats[] = { tzfmt1.getAlias(), tzfmt2.getAlias(), tzfmt1.getAlias() };
+    for (int32_t f = 0; f < UPRV_LENGTHOF(formats); f++) {
+        for (int32_t i = 0; DATA[i].text; i++) {
+            UTimeZoneFormatTimeType ttype = UTZFMT_TIME_TYPE_UNKNOWN;
+            ParsePosition pos(DATA[i].inPos);
+            LocalPointer<TimeZone> tz(
+                formats[f]->parse(DATA[i].style, DATA[i].text, pos, DATA[i].parseOptions, &ttype));
+
+            UnicodeString errMsg;
+            if (tz.isValid()) {
+                UnicodeString outID;
+                tz->getID(outID);
+                if (outID != UnicodeString(DATA[i].expected)) {
+                    errMsg = (UnicodeString)"Time zone ID: " + outID + " - expected: " + DATA[i].expected;
+                } else if (pos.getIndex() != DATA[i].outPos) {
+                    errMsg = (UnicodeString)"Parsed pos: " + pos.getIndex() + " - expected: " + DATA[i].outPos;
+                } else if (ttype != DATA[i].timeType) {
+                    errMsg = (UnicodeString)"Time type: " + ttype + " - expected: " + DATA[i].timeType;
+                }
+            } else {
+                errMsg = (UnicodeString)"Parse failure - expected: " + DATA[i].expected;
+            }
+            if (errMsg.length() > 0) {
+                errln((UnicodeString)"Fail: " + errMsg + " [text=" + DATA[i].text + ", pos=" + DATA[i].inPos
+                    + ", style=" + DATA[i].style + ", instance=" + f + "]");
+            }
+        }
+    }
+    TimeZone::adoptDefault(defaultZone.orphan());
+}
+
 void
 TimeZoneFormatTest::TestISOFormat(void) {
     const int32_t OFFSET[] = {
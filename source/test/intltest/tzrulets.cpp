@@ -604,6 +604,8 @@ TimeZoneRuleTest::TestOlsonTransition(void) {
         {1895, 1905}, // including int32 minimum second
         {1965, 1975}, // including the epoch
         {1995, 2015}, // practical year range
+        {2035, 2045}, // switching to the final rule
+        {2095, 2105}, // end of the precomputed final rule transitions
         {0,0}
     };
 
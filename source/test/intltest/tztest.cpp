@@ -1,6 +1,6 @@
 /***********************************************************************
  * COPYRIGHT: 
- * Copyright (c) 1997-2015, International Business Machines Corporation
+ * Copyright (c) 1997-2016, International Business Machines Corporation
  * and others. All Rights Reserved.
  ***********************************************************************/
 
@@ -19,6 +19,7 @@
 #include "cmemory.h"
 #include "putilimp.h"
 #include "cstring.h"
+#include "gregoimp.h"
 #include "olsontz.h"
 
 #define CASE(id,test) case id:                               \
@@ -72,6 +73,8 @@ void TimeZoneTest::runIndexedTest( int32_t index, UBool exec, const char* &name,
     TESTCASE_AUTO(TestGetUnknown);
     TESTCASE_AUTO(TestGetWindowsID);
     TESTCASE_AUTO(TestGetIDForWindowsID);
+    TESTCASE_AUTO(TestSharedZoneData);
+    TESTCASE_AUTO(TestFinalRuleOffsets);
     TESTCASE_AUTO_END;
 }
 
@@ -2450,4 +2453,80 @@ void TimeZoneTest::TestGetIDForWindowsID(void) {
     }
 }
 
+/*
+ * Zones created for a link and its target, and clones of them, share
+ * the zone data but keep their own IDs.
+ */
+void TimeZoneTest::TestSharedZoneData(void) {
+    LocalPointer<TimeZone> target(TimeZone::createTimeZone("America/Los_Angeles"));
+    LocalPointer<TimeZone> link(TimeZone::createTimeZone("US/Pacific"));
+    UnicodeString id;
+    assertEquals("link ID", "US/Pacific", link->getID(id));
+    assertTrue("link has same rules as target", link->hasSameRules(*target));
+    assertTrue("link != target", *link != *target);
+
+    // A clone must remain usable after the original is gone.
+    LocalPointer<TimeZone> clone(link->clone());
+    link.adoptInstead(NULL);
+    assertTrue("clone has same rules as target", clone->hasSameRules(*target));
+    assertEquals("clone ID", "US/Pacific", clone->getID(id));
+
+    UErrorCode status = U_ZERO_ERROR;
+    int32_t rawOffset, dstOffset, expRawOffset, expDstOffset;
+    for (int32_t year = 1900; year <= 2100; year += 7) {
+        UDate date = (year - 1970) * 365.2425 * U_MILLIS_PER_DAY;
+        clone->getOffset(date, FALSE, rawOffset, dstOffset, status);
+        target->getOffset(date, FALSE, expRawOffset, expDstOffset, status);
+        if (U_FAILURE(status)) {
+            errln("getOffset failed: %s", u_errorName(status));
+            return;
+        }
+        if (rawOffset != expRawOffset || dstOffset != expDstOffset) {
+            errln(UnicodeString("Offsets of clone differ from target in year ") + year);
+        }
+    }
+}
+
+void TimeZoneTest::TestFinalRuleOffsets(void) {
+    // Create all zones, so that the zone data of many of them is loaded,
+    // and look up UTC offsets in the final rule range, which uses the
+    // table of final rule transitions built on first use for each zone data.
+    // Local time lookups use the final rule directly, so a round trip
+    // through local time must yield the same offsets.
+    UErrorCode status = U_ZERO_ERROR;
+    LocalPointer<StringEnumeration> ids(TimeZone::createEnumeration());
+    if (ids.isNull()) {
+        dataerrln("Unable to create TimeZone enumeration");
+        return;
+    }
+    const UnicodeString *id;
+    int32_t zoneCount = 0;
+    while ((id = ids->snext(status)) != NULL && U_SUCCESS(status)) {
+        LocalPointer<TimeZone> tz(TimeZone::createTimeZone(*id));
+        ++zoneCount;
+        for (int32_t year = 2040; year < 2100; year += 3) {
+            for (int32_t month = 0; month < 12; ++month) {
+                // The 10th of the month at 12:00 UTC is far from any transition.
+                UDate date = Grego::fieldsToDay(year, month, 10) * U_MILLIS_PER_DAY + 12 * U_MILLIS_PER_HOUR;
+                int32_t rawOffset, dstOffset, localRawOffset, localDstOffset;
+                tz->getOffset(date, FALSE, rawOffset, dstOffset, status);
+                tz->getOffset(date + rawOffset + dstOffset, TRUE, localRawOffset, localDstOffset, status);
+                if (U_FAILURE(status)) {
+                    errln(UnicodeString("getOffset failed for ") + *id + ": " + u_errorName(status));
+                    return;
+                }
+                if (rawOffset != localRawOffset || dstOffset != localDstOffset) {
+                    errln(UnicodeString("Offsets of ") + *id + " in " + year + "-" + (month + 1) +
+                          "-10: UTC " + rawOffset + "/" + dstOffset +
+                          " != local " + localRawOffset + "/" + localDstOffset);
+                }
+            }
+        }
+    }
+    if (U_FAILURE(status)) {
+        errln("TimeZone enumeration failed: %s", u_errorName(status));
+    }
+    logln(UnicodeString("Tested ") + zoneCount + " zones");
+}
+
 #endif /* #if !UCONFIG_NO_FORMATTING */
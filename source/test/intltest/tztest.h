@@ -1,6 +1,6 @@
 
 /********************************************************************
- * Copyright (c) 1997-2014, International Business Machines
+ * Copyright (c) 1997-2016, International Business Machines
  * Corporation and others. All Rights Reserved.
  ********************************************************************/
  
@@ -101,6 +101,9 @@ public:
     void TestGetWindowsID(void);
     void TestGetIDForWindowsID(void);
 
+    void TestSharedZoneData(void);
+    void TestFinalRuleOffsets(void);
+
     static const UDate INTERVAL;
 
 private:
@@ -1,6 +1,6 @@
 /*
 ********************************************************************************
-*   Copyright (C) 1999-2015 International Business Machines Corporation and
+*   Copyright (C) 1999-2016 International Business Machines Corporation and
 *   others. All Rights Reserved.
 ********************************************************************************
 *   Date        Name        Description
@@ -91,6 +91,7 @@ UnicodeSetTest::runIndexedTest(int32_t index, UBool exec,
         CASE(22,TestSpan);
         CASE(23,TestStringSpan);
         CASE(24,TestUCAUnsafeBackwards);
+        CASE(25,TestBinary);
         default: name = ""; break;
     }
 }
@@ -3544,6 +3545,20 @@ void UnicodeSetTest::TestSpan() {
         "*",
         "[\\u007F\\u07FF\\uFFFF\\U0010FFFF]",
         "*",
+
+        // Frozen sets with few ASCII ranges span long ASCII runs in UTF-8 a word at a time.
+        "[\\u0009-\\u000D\\u0020\\u0085\\u00A0\\u3000]",
+        "*",
+        "The quick brown fox\\u3000jumps over\\u00A0the lazy dog.  \\u0009\\u000A\\u000B\\u000C\\u000D"
+        "       \\u4E00\\u4E8Cabcdefghijklmnopqrstuvwxyz0123456789                         x",
+        "[A-Za-z\\u4E00-\\u9FFF]",
+        "*",
+        "Tokenizers_span-ASCII letters, digits 0123456789 and\\u4E00\\u4E8C\\u4E09\\u56DB\\u4E94"
+        "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz\\u00E4\\u00F6\\u00FC\\U00020000xyz",
+        "[0!-/:-@\\\\[-`\\\\{-~\\u3001\\u3002]",
+        "*",
+        "More than four ASCII ranges: !\"#$%&'()*+,-./:;<=>?@[\\\\]^_`{|}~\\u3001\\u3002"
+        "!!!!!!!!!!!!!!!!~~~~~~~~~~~~~~~~ and text",
         "[[[:ID_Continue:]-[\\u30ab\\u30ad]]{\\u3000\\u30ab}{\\u3000\\u30ab\\u30ad}]",
         "-c",
         "*",
@@ -3922,3 +3937,159 @@ void UnicodeSetTest::TestUCAUnsafeBackwards() {
     }
 #endif
 }
+
+// Compares spans and contains() of a set created from a binary image
+// with those of the original, frozen set.
+static UBool sameSpans(const UnicodeSet &a, const UnicodeSet &b) {
+    static const UChar s16[]={
+        0x61, 0x62, 0x63, 0x68, 0x20, 0x41, 0xad, 0x300, 0x4e00, 0x9fa5, 0xd83d, 0xde00, 0x78,
+        0x20, 0x200b, 0xfeff, 0x61, 0x62, 0x62, 0x63, 0x63, 0x68, 0xd800, 0x31, 0x32, 0x33, 0x34,
+        0x35, 0x36, 0x37, 0x38, 0x39, 0x30, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69,
+        0x6a, 0x6b, 0x6c, 0x6d, 0x6e, 0x6f, 0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78
+    };
+    int32_t length16=UPRV_LENGTHOF(s16);
+    char s8[200];
+    int32_t length8;
+    UErrorCode errorCode=U_ZERO_ERROR;
+    u_strToUTF8WithSub(s8, UPRV_LENGTHOF(s8), &length8, s16, length16, 0xfffd, NULL, &errorCode);
+    if(U_FAILURE(errorCode)) {
+        return FALSE;
+    }
+    for(int32_t start=0; start<length16; ++start) {
+        for(int32_t cond=USET_SPAN_NOT_CONTAINED; cond<=USET_SPAN_SIMPLE; ++cond) {
+            USetSpanCondition spanCondition=(USetSpanCondition)cond;
+            if( a.span(s16+start, length16-start, spanCondition)!=
+                    b.span(s16+start, length16-start, spanCondition) ||
+                a.spanBack(s16, length16-start, spanCondition)!=
+                    b.spanBack(s16, length16-start, spanCondition)
+            ) {
+                return FALSE;
+            }
+        }
+    }
+    for(int32_t start=0; start<length8; ++start) {
+        for(int32_t cond=USET_SPAN_NOT_CONTAINED; cond<=USET_SPAN_SIMPLE; ++cond) {
+            USetSpanCondition spanCondition=(USetSpanCondition)cond;
+            if( a.spanUTF8(s8+start, length8-start, spanCondition)!=
+                    b.spanUTF8(s8+start, length8-start, spanCondition) ||
+                a.spanBackUTF8(s8, length8-start, spanCondition)!=
+                    b.spanBackUTF8(s8, length8-start, spanCondition)
+            ) {
+                return FALSE;
+            }
+        }
+    }
+    for(UChar32 c=0; c<=0x10ffff; c+=(c<0x3000 ? 1 : 0x3f)) {
+        if(a.contains(c)!=b.contains(c)) {
+            return FALSE;
+        }
+    }
+    return TRUE;
+}
+
+void UnicodeSetTest::TestBinary() {
+    static const char *const patterns[]={
+        "[]",
+        "[a-z]",
+        "[:Cf:]",
+        "[[:L:][:M:]-[:Han:]]",
+        "[\\u0000-\\U0010FFFF]",
+        "[a-c{ab}]",  // The string is irrelevant for spans.
+        "[a-c{ch}{bb}{\\U0001F600x}]"
+    };
+    IcuTestErrorCode errorCode(*this, "TestBinary");
+    for(int32_t i=0; i<UPRV_LENGTHOF(patterns); ++i) {
+        UnicodeString pattern=UnicodeString(patterns[i], -1, US_INV).unescape();
+        UnicodeSet set(pattern, errorCode);
+        if(errorCode.logDataIfFailureAndReset("UnicodeSet(%s)", patterns[i])) {
+            continue;
+        }
+        for(int32_t frozen=0; frozen<=1; ++frozen) {
+            if(frozen) {
+                set.freeze();
+            }
+            // Preflight, then write the image.
+            int32_t length=set.toBinary(NULL, 0, errorCode);
+            if(errorCode.get()!=U_BUFFER_OVERFLOW_ERROR || length<=0 || (length&3)!=0) {
+                errln("FAIL: %s.toBinary(preflighting) returned %ld - %s",
+                      patterns[i], (long)length, errorCode.errorName());
+                errorCode.reset();
+                continue;
+            }
+            errorCode.reset();
+            LocalArray<uint32_t> image(new uint32_t[length/4+1]);
+            int32_t length2=set.toBinary(image.getAlias(), length, errorCode);
+            if(errorCode.logIfFailureAndReset("%s.toBinary()", patterns[i]) || length2!=length) {
+                continue;
+            }
+
+            int32_t actualLength=0;
+            LocalPointer<UnicodeSet> loaded(
+                UnicodeSet::createFromBinary(image.getAlias(), length+4, &actualLength, errorCode));
+            if(errorCode.logIfFailureAndReset("UnicodeSet::createFromBinary(%s)", patterns[i])) {
+                continue;
+            }
+            if(actualLength!=length) {
+                errln("FAIL: UnicodeSet::createFromBinary(%s) actual length %ld!=%ld",
+                      patterns[i], (long)actualLength, (long)length);
+            }
+            UnicodeSet frozenSet(set);
+            frozenSet.freeze();
+            if(!loaded->isFrozen() || *loaded!=set || loaded->hashCode()!=set.hashCode()) {
+                errln("FAIL: UnicodeSet::createFromBinary(%s) differs from the original", patterns[i]);
+            } else if(!sameSpans(*loaded, frozenSet)) {
+                errln("FAIL: UnicodeSet::createFromBinary(%s) spans differ from the original's",
+                      patterns[i]);
+            }
+
+            // Clones do not depend on the image.
+            LocalPointer<UnicodeSet> cloned((UnicodeSet *)loaded->clone());
+            LocalPointer<UnicodeSet> thawed((UnicodeSet *)loaded->cloneAsThawed());
+            loaded.adoptInstead(NULL);
+            uprv_memset(image.getAlias(), 0, length);
+            if(*cloned!=set || !cloned->isFrozen() || !sameSpans(*cloned, frozenSet) ||
+                    *thawed!=set || thawed->isFrozen()) {
+                errln("FAIL: a clone of UnicodeSet::createFromBinary(%s) differs from the original",
+                      patterns[i]);
+            }
+        }
+    }
+
+    // Invalid images.
+    UnicodeSet set(UNICODE_STRING_SIMPLE("[a-z\\u4e00-\\u9fff]"), errorCode);
+    uint32_t image[400];
+    int32_t length=set.toBinary(image, (int32_t)sizeof(image), errorCode);
+    if(errorCode.logIfFailureAndReset("[a-z\\u4e00-\\u9fff].toBinary()")) {
+        return;
+    }
+    LocalPointer<UnicodeSet> loaded(
+        UnicodeSet::createFromBinary((const char *)image+2, length, NULL, errorCode));
+    if(errorCode.reset()!=U_ILLEGAL_ARGUMENT_ERROR || loaded.isValid()) {
+        errln("FAIL: UnicodeSet::createFromBinary(unaligned) did not fail as expected");
+    }
+    loaded.adoptInstead(UnicodeSet::createFromBinary(image, length-4, NULL, errorCode));
+    if(errorCode.reset()!=U_INVALID_FORMAT_ERROR || loaded.isValid()) {
+        errln("FAIL: UnicodeSet::createFromBinary(truncated) did not fail as expected");
+    }
+    // Swap two list values, after the signature and seven header fields.
+    uint32_t temp=image[8];
+    image[8]=image[9];
+    image[9]=temp;
+    loaded.adoptInstead(UnicodeSet::createFromBinary(image, length, NULL, errorCode));
+    if(errorCode.reset()!=U_INVALID_FORMAT_ERROR || loaded.isValid()) {
+        errln("FAIL: UnicodeSet::createFromBinary(unordered list) did not fail as expected");
+    }
+    image[9]=image[8];
+    image[8]=temp;
+    // Lookup tables that do not fit the list are recomputed:
+    // Overwrite all of the tables (after the 5 list values) with large numbers.
+    uprv_memset(image+8+5, 0x7f, length-(8+5)*4);
+    loaded.adoptInstead(UnicodeSet::createFromBinary(image, length, NULL, errorCode));
+    if(errorCode.logIfFailureAndReset("UnicodeSet::createFromBinary(bad tables)")) {
+        return;
+    }
+    set.freeze();
+    if(*loaded!=set || !sameSpans(*loaded, set)) {
+        errln("FAIL: UnicodeSet::createFromBinary(bad tables) differs from the original");
+    }
+}
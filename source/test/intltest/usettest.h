@@ -1,7 +1,7 @@
 
 /********************************************************************
  * COPYRIGHT: 
- * Copyright (c) 1997-2015, International Business Machines Corporation and
+ * Copyright (c) 1997-2016, International Business Machines Corporation and
  * others. All Rights Reserved.
  ********************************************************************
 **********************************************************************
@@ -90,6 +90,8 @@ private:
 
     void TestUCAUnsafeBackwards();
 
+    void TestBinary();
+
 private:
 
     UBool toPatternAux(UChar32 start, UChar32 end);
@@ -1,6 +1,6 @@
 /*
 *******************************************************************************
-*   Copyright (C) 2010-2014, International Business Machines
+*   Copyright (C) 2010-2016, International Business Machines
 *   Corporation and others.  All Rights Reserved.
 *******************************************************************************
 *   file name:  uts46test.cpp
@@ -490,6 +490,9 @@ static const TestCase testCases[]={
     { "\\u00E4.b-.c", "B", "\\u00E4.b-.c", UIDNA_ERROR_TRAILING_HYPHEN },
     { "\\u00E4.-.c", "B", "\\u00E4.-.c", UIDNA_ERROR_LEADING_HYPHEN|UIDNA_ERROR_TRAILING_HYPHEN },
     { "\\u00E4.bc--de.f", "B", "\\u00E4.bc--de.f", UIDNA_ERROR_HYPHEN_3_4 },
+    { "a.\\u00AD", "B", "a.", 0 },  // empty root label after a removed character
+    { "B\\u00FCcher.DE.eXample.cOm", "B",  // ASCII labels after a non-ASCII label
+      "b\\u00FCcher.de.example.com", 0 },
     { "a.b.\\u0308c.d", "B", "a.b.\\uFFFDc.d", UIDNA_ERROR_LEADING_COMBINING_MARK },
     { "a.b.xn--c-bcb.d", "B",
       "a.b.xn--c-bcb\\uFFFD.d", UIDNA_ERROR_LEADING_COMBINING_MARK|UIDNA_ERROR_INVALID_ACE_LABEL },
@@ -504,6 +507,10 @@ static const TestCase testCases[]={
       "b-.\\u05D0", UIDNA_ERROR_TRAILING_HYPHEN|UIDNA_ERROR_BIDI },
     { "d.xn----dha.xn--4db", "B",  // 2nd label does not end with L/EN
       "d.\\u00FC-.\\u05D0", UIDNA_ERROR_TRAILING_HYPHEN|UIDNA_ERROR_BIDI },
+    { "\\u05D0.0A", "B",  // ASCII label after an RTL label does not start with L
+      "\\u05D0.0a", UIDNA_ERROR_BIDI },
+    { "\\u05D0.B-", "B",  // last ASCII label does not end with L/EN
+      "\\u05D0.b-", UIDNA_ERROR_TRAILING_HYPHEN|UIDNA_ERROR_BIDI },
     { "a\\u05D0", "B", "a\\u05D0", UIDNA_ERROR_BIDI },  // first dir != last dir
     { "\\u05D0\\u05C7", "B", "\\u05D0\\u05C7", 0 },
     { "\\u05D09\\u05C7", "B", "\\u05D09\\u05C7", 0 },
@@ -56,6 +56,10 @@ UPerfFunction* DateFormatPerfTest::runIndexedTest(int32_t index, UBool exec,cons
         TESTCASE(22,DateFmtCopy10000);
         TESTCASE(23,DateFmtCreate250);
         TESTCASE(24,DateFmtCreate10000);
+        TESTCASE(25,DateFmtParse250);
+        TESTCASE(26,DateFmtParse10000);
+        TESTCASE(27,MsgFmt250);
+        TESTCASE(28,MsgFmt10000);
 
 
         default: 
@@ -172,6 +176,22 @@ UPerfFunction* DateFormatPerfTest::DateFmtCopy10000(){
     return new DateFmtCopyFunction(10000, locale);
 }
 
+UPerfFunction* DateFormatPerfTest::DateFmtParse250(){
+    return new DateFmtParseFunction(1, locale);
+}
+
+UPerfFunction* DateFormatPerfTest::DateFmtParse10000(){
+    return new DateFmtParseFunction(40, locale);
+}
+
+UPerfFunction* DateFormatPerfTest::MsgFmt250(){
+    return new MsgFmtFunction(1, locale);
+}
+
+UPerfFunction* DateFormatPerfTest::MsgFmt10000(){
+    return new MsgFmtFunction(40, locale);
+}
+
 UPerfFunction* DateFormatPerfTest::DateFmtCreate250(){
     return new DateFmtCreateFunction(250, locale);
 }
@@ -17,11 +17,13 @@
 #include "unicode/dtitvfmt.h"
 #include "unicode/utypes.h"
 #include "unicode/datefmt.h"
+#include "unicode/smpdtfmt.h"
 #include "unicode/calendar.h"
 #include "unicode/uclean.h"
 #include "unicode/brkiter.h"
 #include "unicode/numfmt.h"
 #include "unicode/coll.h"
+#include "unicode/msgfmt.h"
 #include "util.h"
 
 #include "datedata.h"
@@ -313,6 +315,136 @@ public:
 
 };
 
+class DateFmtParseFunction : public UPerfFunction
+{
+
+private:
+        int num;
+        char locale[25];
+        DateFormat *fmt;
+        Calendar *cal;
+        UnicodeString strings[250];
+
+public:
+
+        // Parses numeric timestamps like "2004-07-21 13:45:09.123".
+        DateFmtParseFunction(int a, const char* loc)
+        {
+                num = a;
+                strcpy(locale, loc);
+                UErrorCode status2 = U_ZERO_ERROR;
+                Locale locl(locale);
+                fmt = new SimpleDateFormat(UnicodeString("yyyy-MM-dd HH:mm:ss.SSS"), locl, status2);
+                check(status2, "SimpleDateFormat::SimpleDateFormat");
+                cal = Calendar::createInstance(TimeZone::createTimeZone("GMT"), locl, status2);
+                check(status2, "Calendar::createInstance");
+                fmt->setCalendar(*cal);
+                for(int i = 0; i < NUM_DATES; i++) {
+                    cal->clear();
+                    cal->set(years[i], months[i], days[i], i % 24, i % 60, (i * 7) % 60);
+                    cal->set(UCAL_MILLISECOND, (i * 37) % 1000);
+                    UDate date = cal->getTime(status2);
+                    check(status2, "Calendar::getTime");
+                    fmt->format(date, strings[i]);
+                }
+        }
+
+        virtual ~DateFmtParseFunction()
+        {
+                delete fmt;
+                delete cal;
+        }
+
+        virtual void call(UErrorCode* /* status */)
+        {
+                for(int j = 0; j < num; j++) {
+                    for(int i = 0; i < NUM_DATES; i++) {
+                        ParsePosition pos(0);
+                        cal->clear();
+                        fmt->parse(strings[i], *cal, pos);
+                        if (pos.getIndex() == 0) {
+                            printf("ERROR: parse failed\n");
+                            exit(1);
+                        }
+                    }
+                }
+        }
+
+        virtual long getOperationsPerIteration()
+        {
+                return NUM_DATES * num;
+        }
+
+        // Verify that a UErrorCode is successful; exit(1) if not
+        void check(UErrorCode& status, const char* msg) {
+                if (U_FAILURE(status)) {
+                        printf("ERROR: %s (%s)\n", u_errorName(status), msg);
+                        exit(1);
+                }
+        }
+
+};
+
+class MsgFmtFunction : public UPerfFunction
+{
+
+private:
+        int num;
+        char locale[25];
+        MessageFormat *fmt;
+        UnicodeString names[3];
+        Formattable args[3];
+
+public:
+
+        // Formats a message with named string and plural arguments.
+        MsgFmtFunction(int a, const char* loc)
+        {
+                num = a;
+                strcpy(locale, loc);
+                UErrorCode status2 = U_ZERO_ERROR;
+                fmt = new MessageFormat(
+                        UnicodeString("{who} copied {count,plural,one{# file}other{# files}} to {where}."),
+                        Locale(locale), status2);
+                check(status2, "MessageFormat::MessageFormat");
+                names[0] = UnicodeString("who");
+                names[1] = UnicodeString("count");
+                names[2] = UnicodeString("where");
+                args[0].setString(UnicodeString("Alice"));
+                args[2].setString(UnicodeString("the backup drive"));
+        }
+
+        virtual ~MsgFmtFunction()
+        {
+                delete fmt;
+        }
+
+        virtual void call(UErrorCode* status)
+        {
+                UnicodeString result;
+                for(int j = 0; j < num; j++) {
+                    for(int i = 0; i < NUM_DATES; i++) {
+                        args[1].setLong(i);
+                        fmt->format(names, args, 3, result.remove(), *status);
+                    }
+                }
+        }
+
+        virtual long getOperationsPerIteration()
+        {
+                return NUM_DATES * num;
+        }
+
+        // Verify that a UErrorCode is successful; exit(1) if not
+        void check(UErrorCode& status, const char* msg) {
+                if (U_FAILURE(status)) {
+                        printf("ERROR: %s (%s)\n", u_errorName(status), msg);
+                        exit(1);
+                }
+        }
+
+};
+
 class DIFCreateFunction : public UPerfFunction
 {
 
@@ -822,6 +954,10 @@ public:
 	UPerfFunction* DateFmtCreate10000();
 	UPerfFunction* DateFmtCopy250();
 	UPerfFunction* DateFmtCopy10000();
+	UPerfFunction* DateFmtParse250();
+	UPerfFunction* DateFmtParse10000();
+	UPerfFunction* MsgFmt250();
+	UPerfFunction* MsgFmt10000();
 	UPerfFunction* BreakItWord250();
 	UPerfFunction* BreakItWord10000();
 	UPerfFunction* BreakItChar250();
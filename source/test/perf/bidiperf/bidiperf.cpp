@@ -0,0 +1,307 @@
+/*
+ **********************************************************************
+ *   Copyright (C) 2016, International Business Machines
+ *   Corporation and others.  All Rights Reserved.
+ **********************************************************************
+ *  file name:  bidiperf.cpp
+ *  encoding:   US-ASCII
+ *  tab size:   8 (not used)
+ *  indentation:4
+ *
+ *  Performance test program for resolving the Bidi levels of
+ *  documents with many paragraphs.
+ *
+ *  Reads a document from a file, or generates one with paragraphs of
+ *  mixed English, Hebrew and Arabic text if no file is specified,
+ *  and measures ubidi_setPara() over the whole document at once,
+ *  one paragraph at a time with and without ubidi_reserve(),
+ *  and in parts from ubidi_splitParagraphs() on several threads.
+ *  One operation is one code unit of the document and
+ *  one event is one paragraph.
+ *
+ *  Example:
+ *      bidiperf SetPara SetParaEach SetParaEachReserved SetParaParallel -T 4 -v -p 10 -i 100
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <thread>
+#include "unicode/uperf.h"
+#include "unicode/ubidi.h"
+#include "unicode/unistr.h"
+#include "cmemory.h"
+#include "uoptions.h"
+
+U_NAMESPACE_USE
+
+static const char *const sampleSentences[] = {
+    "The quick brown fox (version 2.1) jumps over the lazy dog, 42 times.",
+    "\\u05d6\\u05d4\\u05d5 \\u05de\\u05e9\\u05e4\\u05d8 \\u05d1\\u05e2\\u05d1\\u05e8\\u05d9\\u05ea"
+        " \\u05e2\\u05dd ICU 57 \\u05d5-[\\u05e1\\u05d5\\u05d2\\u05e8\\u05d9\\u05d9\\u05dd].",
+    "\\u0647\\u0630\\u0647 \\u062c\\u0645\\u0644\\u0629 \\u0639\\u0631\\u0628\\u064a\\u0629"
+        " \\u0641\\u064a\\u0647\\u0627 \\u0623\\u0631\\u0642\\u0627\\u0645 \\u0661\\u0662\\u0663 \\u0648 3.14.",
+    "Call \\u05d3\\u05e0\\u05d9 at +1-555-0100 or email \\u2067\\u05d3\\u05e0\\u05d9@example.com\\u2069.",
+    "    ",
+};
+
+static UOption bidiOptions[] = {
+    UOPTION_DEF("threads", 'T', UOPT_REQUIRES_ARG),
+    UOPTION_DEF("paragraphs", 'P', UOPT_REQUIRES_ARG)
+};
+
+static const char *const bidiUsage =
+    "\t-T or --threads       Number of threads for SetParaParallel, default 4\n"
+    "\t-P or --paragraphs    Number of paragraphs of the generated document, default 2000\n";
+
+// Test object.
+class BiDiPerfTest : public UPerfTest {
+public:
+    BiDiPerfTest(int32_t argc, const char *argv[], UErrorCode &status);
+    ~BiDiPerfTest();
+
+    virtual UPerfFunction* runIndexedTest(int32_t index, UBool exec, const char* &name, char* par = NULL);
+
+    const UChar *getText() const { return text.getBuffer(); }
+    int32_t getLength() const { return text.length(); }
+    int32_t getParaCount() const { return paraCount; }
+    const int32_t *getParaLimits() const { return paraLimits; }
+    int32_t getMaxParaLength() const { return maxParaLength; }
+    int32_t getThreadCount() const { return threadCount; }
+
+private:
+    UnicodeString text;
+    int32_t *paraLimits;
+    int32_t paraCount;
+    int32_t maxParaLength;
+    int32_t threadCount;
+};
+
+BiDiPerfTest::BiDiPerfTest(int32_t argc, const char *argv[], UErrorCode &status)
+        : UPerfTest(argc, argv, bidiOptions, UPRV_LENGTHOF(bidiOptions), bidiUsage, status),
+          paraLimits(NULL), paraCount(0), maxParaLength(0), threadCount(4) {
+    if (U_FAILURE(status)) {
+        return;
+    }
+    if (bidiOptions[0].doesOccur) {
+        threadCount = atoi(bidiOptions[0].value);
+        if (threadCount <= 0) {
+            status = U_ILLEGAL_ARGUMENT_ERROR;
+            return;
+        }
+    }
+    if (fileName == NULL) {
+        int32_t generatedCount = 2000;
+        if (bidiOptions[1].doesOccur) {
+            generatedCount = atoi(bidiOptions[1].value);
+        }
+        UnicodeString sentences[UPRV_LENGTHOF(sampleSentences)];
+        for (int32_t i = 0; i < UPRV_LENGTHOF(sampleSentences); ++i) {
+            sentences[i] = UnicodeString(sampleSentences[i], -1, US_INV).unescape();
+        }
+        // Paragraphs of 1 to 12 sentences, starting with different scripts.
+        for (int32_t p = 0, s = 0; p < generatedCount; ++p) {
+            int32_t sentenceCount = 1 + (p * 7) % 12;
+            while (sentenceCount-- > 0) {
+                text.append(sentences[s++ % UPRV_LENGTHOF(sampleSentences)]).append((UChar)0x20);
+            }
+            text.append((UChar)(p % 3 == 0 ? 0xd : 0x2029));
+            if (p % 3 == 0) {
+                text.append((UChar)0xa);
+            }
+        }
+    } else {
+        int32_t textLength = 0;
+        const UChar *buffer = getBuffer(textLength, status);
+        if (U_FAILURE(status)) {
+            return;
+        }
+        text.setTo(buffer, textLength);
+    }
+    if (text.isEmpty()) {
+        fprintf(stderr, "error: empty document\n");
+        status = U_ILLEGAL_ARGUMENT_ERROR;
+        return;
+    }
+
+    // Find the paragraphs the way ubidi_setPara() does.
+    UBiDi *pBiDi = ubidi_open();
+    ubidi_setPara(pBiDi, text.getBuffer(), text.length(), UBIDI_DEFAULT_LTR, NULL, &status);
+    paraCount = ubidi_countParagraphs(pBiDi);
+    paraLimits = new int32_t[paraCount];
+    for (int32_t i = 0, start = 0; U_SUCCESS(status) && i < paraCount; ++i) {
+        ubidi_getParagraphByIndex(pBiDi, i, NULL, &paraLimits[i], NULL, &status);
+        if (maxParaLength < paraLimits[i] - start) {
+            maxParaLength = paraLimits[i] - start;
+        }
+        start = paraLimits[i];
+    }
+    ubidi_close(pBiDi);
+    if (verbose) {
+        printf("%ld code units in %ld paragraphs of up to %ld code units\n",
+               (long)text.length(), (long)paraCount, (long)maxParaLength);
+    }
+}
+
+BiDiPerfTest::~BiDiPerfTest() {
+    delete[] paraLimits;
+}
+
+// Performance test function object.
+class Command : public UPerfFunction {
+protected:
+    Command(const BiDiPerfTest &testcase) : test(testcase), sum(0) {}
+
+public:
+    virtual ~Command() {}
+    virtual long getOperationsPerIteration() {
+        // Number of code units.
+        return test.getLength();
+    }
+    virtual long getEventsPerIteration() {
+        return test.getParaCount();
+    }
+
+protected:
+    const BiDiPerfTest &test;
+    int32_t sum;
+};
+
+// The whole document at once, with a UBiDi object that is reused across iterations.
+class SetPara : public Command {
+public:
+    static UPerfFunction* get(const BiDiPerfTest &testcase) {
+        return new SetPara(testcase);
+    }
+    virtual ~SetPara() {
+        ubidi_close(pBiDi);
+    }
+    virtual void call(UErrorCode* pErrorCode) {
+        ubidi_setPara(pBiDi, test.getText(), test.getLength(), UBIDI_DEFAULT_LTR, NULL, pErrorCode);
+        sum += ubidi_getLevels(pBiDi, pErrorCode)[test.getLength() - 1];
+    }
+
+private:
+    SetPara(const BiDiPerfTest &testcase) : Command(testcase), pBiDi(ubidi_open()) {}
+
+    UBiDi *pBiDi;
+};
+
+// One paragraph at a time, with a new UBiDi object for each iteration,
+// which grows whenever a paragraph is longer than all previous ones,
+// unless it is reserved for the longest paragraph first.
+class SetParaEach : public Command {
+public:
+    static UPerfFunction* get(const BiDiPerfTest &testcase, UBool reserve) {
+        return new SetParaEach(testcase, reserve);
+    }
+    virtual void call(UErrorCode* pErrorCode) {
+        UBiDi *pBiDi = ubidi_open();
+        if (doReserve) {
+            ubidi_reserve(pBiDi, test.getMaxParaLength(), 0, pErrorCode);
+        }
+        const UChar *text = test.getText();
+        const int32_t *limits = test.getParaLimits();
+        for (int32_t i = 0, start = 0; i < test.getParaCount(); start = limits[i++]) {
+            ubidi_setPara(pBiDi, text + start, limits[i] - start, UBIDI_DEFAULT_LTR, NULL, pErrorCode);
+            sum += ubidi_getLevels(pBiDi, pErrorCode)[0];
+        }
+        ubidi_close(pBiDi);
+    }
+
+private:
+    SetParaEach(const BiDiPerfTest &testcase, UBool reserve) : Command(testcase), doReserve(reserve) {}
+
+    UBool doReserve;
+};
+
+// Parts of whole paragraphs from ubidi_splitParagraphs(),
+// each on its own thread with its own UBiDi object.
+class SetParaParallel : public Command {
+public:
+    static UPerfFunction* get(const BiDiPerfTest &testcase) {
+        return new SetParaParallel(testcase);
+    }
+    virtual ~SetParaParallel() {
+        for (int32_t i = 0; i < test.getThreadCount(); ++i) {
+            ubidi_close(parts[i].pBiDi);
+        }
+        delete[] parts;
+        delete[] limits;
+        delete[] threads;
+    }
+    virtual void call(UErrorCode* pErrorCode) {
+        int32_t count = ubidi_splitParagraphs(test.getText(), test.getLength(),
+                                              limits, test.getThreadCount(), pErrorCode);
+        for (int32_t i = 0, start = 0; i < count; start = limits[i++]) {
+            parts[i].text = test.getText() + start;
+            parts[i].length = limits[i] - start;
+            parts[i].errorCode = *pErrorCode;
+            threads[i] = std::thread(&Part::run, &parts[i]);
+        }
+        for (int32_t i = 0; i < count; ++i) {
+            threads[i].join();
+            if (U_SUCCESS(*pErrorCode)) {
+                *pErrorCode = parts[i].errorCode;
+            }
+            sum += parts[i].sum;
+        }
+    }
+
+private:
+    struct Part {
+        void run() {
+            ubidi_setPara(pBiDi, text, length, UBIDI_DEFAULT_LTR, NULL, &errorCode);
+            sum = ubidi_getLevels(pBiDi, &errorCode)[length - 1];
+        }
+
+        UBiDi *pBiDi;
+        const UChar *text;
+        int32_t length;
+        int32_t sum;
+        UErrorCode errorCode;
+    };
+
+    SetParaParallel(const BiDiPerfTest &testcase) : Command(testcase) {
+        int32_t threadCount = testcase.getThreadCount();
+        parts = new Part[threadCount];
+        limits = new int32_t[threadCount];
+        threads = new std::thread[threadCount];
+        for (int32_t i = 0; i < threadCount; ++i) {
+            parts[i].pBiDi = ubidi_open();
+        }
+    }
+
+    Part *parts;
+    int32_t *limits;
+    std::thread *threads;
+};
+
+UPerfFunction* BiDiPerfTest::runIndexedTest(int32_t index, UBool exec, const char* &name, char* /*par*/) {
+    switch (index) {
+        case 0: name = "SetPara";               if (exec) return SetPara::get(*this); break;
+        case 1: name = "SetParaEach";           if (exec) return SetParaEach::get(*this, FALSE); break;
+        case 2: name = "SetParaEachReserved";   if (exec) return SetParaEach::get(*this, TRUE); break;
+        case 3: name = "SetParaParallel";       if (exec) return SetParaParallel::get(*this); break;
+        default: name = ""; break;
+    }
+    return NULL;
+}
+
+int main(int argc, const char *argv[]) {
+    UErrorCode status = U_ZERO_ERROR;
+    BiDiPerfTest test(argc, argv, status);
+
+    if (U_FAILURE(status)){
+        printf("The error is %s\n", u_errorName(status));
+        test.usage();
+        return status;
+    }
+
+    if (test.run() == FALSE){
+        fprintf(stderr, "FAILED: Tests could not be run please check the "
+                        "arguments.\n");
+        return -1;
+    }
+
+    return 0;
+}
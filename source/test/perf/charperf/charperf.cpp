@@ -116,6 +116,7 @@ UPerfFunction* CharPerformanceTest::runIndexedTest(int32_t index, UBool exec,
         TESTCASE(19, TestStdLibToLower);
         TESTCASE(20, TestStdLibToUpper);
         TESTCASE(21, TestStdLibIsWhiteSpace);
+        TESTCASE(22, TestCharFromName);
         default: 
             name = ""; 
             return NULL;
@@ -253,3 +254,8 @@ UPerfFunction* CharPerformanceTest::TestStdLibIsWhiteSpace()
     return new StdLibCharPerfFunction(StdLibIsWhiteSpace, (wchar_t)MIN_, 
         (wchar_t)MAX_);
 }
+
+UPerfFunction* CharPerformanceTest::TestCharFromName()
+{
+    return new CharFromNamePerfFunction(MIN_, MAX_);
+}
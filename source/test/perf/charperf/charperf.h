@@ -80,6 +80,52 @@ private:
     wchar_t MAX_;
 };
 
+/**
+ * Looks up code points by their names with u_charFromName().
+ * The names are those of up to kMaxNames code points
+ * picked evenly from the named code points in [min, max).
+ */
+class CharFromNamePerfFunction : public UPerfFunction
+{
+public:
+    virtual void call(UErrorCode* status)
+    {
+        for (int32_t i = 0; i < count_; i ++) {
+            u_charFromName(U_UNICODE_CHAR_NAME, names_[i], status);
+        }
+    }
+
+    virtual long getOperationsPerIteration()
+    {
+        return count_;
+    }
+
+    CharFromNamePerfFunction(UChar32 min, UChar32 max)
+    {
+        // collect the named code points, then pick evenly from them
+        UChar32 *named = new UChar32[max - min];
+        int32_t namedCount = 0;
+        for (UChar32 c = min; c < max; c ++) {
+            UErrorCode status = U_ZERO_ERROR;
+            if (u_charName(c, U_UNICODE_CHAR_NAME, NULL, 0, &status) > 0) {
+                named[namedCount ++] = c;
+            }
+        }
+        count_ = namedCount < kMaxNames ? namedCount : kMaxNames;
+        for (int32_t i = 0; i < count_; i ++) {
+            UErrorCode status = U_ZERO_ERROR;
+            u_charName(named[(int64_t)i * namedCount / count_], U_UNICODE_CHAR_NAME,
+                       names_[i], sizeof(names_[0]), &status);
+        }
+        delete[] named;
+    }
+
+private:
+    enum { kMaxNames = 1000 };
+    char names_[kMaxNames][100];
+    int32_t count_;
+};
+
 class CharPerformanceTest : public UPerfTest
 {
 public:
@@ -110,6 +156,7 @@ public:
     UPerfFunction* TestStdLibToLower();
     UPerfFunction* TestStdLibToUpper();
     UPerfFunction* TestStdLibIsWhiteSpace();
+    UPerfFunction* TestCharFromName();
 
 private:
     UChar32 MIN_;
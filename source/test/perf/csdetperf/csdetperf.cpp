@@ -0,0 +1,206 @@
+/*
+ **********************************************************************
+ *   Copyright (C) 2016, International Business Machines
+ *   Corporation and others.  All Rights Reserved.
+ **********************************************************************
+ *  file name:  csdetperf.cpp
+ *  encoding:   US-ASCII
+ *  tab size:   8 (not used)
+ *  indentation:4
+ *
+ *  Performance test program for charset detection.
+ *
+ *  Reads a text file, cuts it into documents of up to 4000 code units
+ *  (at line boundaries where possible), converts them to one charset per
+ *  test, and measures the throughput of ucsdet_detect() and
+ *  ucsdet_detectAll() over them.
+ *  One operation is one input byte, so the throughput in MB/s is
+ *  1000 divided by the ns per operation reported with -v;
+ *  one event is one document.
+ *
+ *  Example:
+ *      csdetperf DetectUTF8 DetectLatin1 -f fr.txt -e UTF-8 -v -p 10 -i 100
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "unicode/uperf.h"
+#include "unicode/ucnv.h"
+#include "unicode/ucsdet.h"
+#include "cmemory.h"
+#include "uoptions.h"
+
+U_NAMESPACE_USE
+
+#define DOCUMENT_LENGTH 4000
+
+// Test object.
+class CSDetPerfTest : public UPerfTest {
+public:
+    CSDetPerfTest(int32_t argc, const char *argv[], UErrorCode &status);
+    ~CSDetPerfTest();
+
+    virtual UPerfFunction* runIndexedTest(int32_t index, UBool exec, const char* &name, char* par = NULL);
+
+    const UChar *getText() const { return text; }
+    int32_t getTextLength() const { return textLength; }
+
+private:
+    const UChar *text;
+    int32_t textLength;
+};
+
+CSDetPerfTest::CSDetPerfTest(int32_t argc, const char *argv[], UErrorCode &status)
+        : UPerfTest(argc, argv, NULL, 0, "", status), text(NULL), textLength(0) {
+    if (U_FAILURE(status)) {
+        return;
+    }
+    if (fileName == NULL) {
+        fprintf(stderr, "error: no text file specified (-f)\n");
+        status = U_ILLEGAL_ARGUMENT_ERROR;
+        return;
+    }
+    text = getBuffer(textLength, status);
+}
+
+CSDetPerfTest::~CSDetPerfTest() {}
+
+// Performance test function object.
+// Converts the text to the test's charset, one document at a time.
+class Command : public UPerfFunction {
+protected:
+    Command(const CSDetPerfTest &testcase, const char *charset, UBool all)
+            : test(testcase), detector(NULL), bytes(NULL), starts(NULL),
+              count(0), length(0), detectAll(all), sum(0) {
+        UErrorCode errorCode = U_ZERO_ERROR;
+        const UChar *text = test.getText();
+        int32_t textLength = test.getTextLength();
+        int32_t capacity = 0;
+        starts = new int32_t[textLength / (DOCUMENT_LENGTH / 2) + 2];
+        LocalUConverterPointer cnv(ucnv_open(charset, &errorCode));
+        detector = ucsdet_open(&errorCode);
+        for (int32_t start = 0; start < textLength && U_SUCCESS(errorCode);) {
+            int32_t limit = start + DOCUMENT_LENGTH;
+            if (limit >= textLength) {
+                limit = textLength;
+            } else {
+                // End the document after a line break in its second half,
+                // and never between the halves of a surrogate pair.
+                int32_t i = limit;
+                while (i > start + DOCUMENT_LENGTH / 2 && text[i - 1] != 0xa) {
+                    --i;
+                }
+                limit = text[i - 1] == 0xa ? i : (U16_IS_LEAD(text[limit - 1]) ? limit - 1 : limit);
+            }
+            int32_t needed = 4 * (limit - start) + 4;
+            if (length + needed > capacity) {
+                capacity = 2 * capacity + needed;
+                char *newBytes = (char *)uprv_malloc(capacity);
+                if (newBytes == NULL) {
+                    errorCode = U_MEMORY_ALLOCATION_ERROR;
+                    break;
+                }
+                if (length > 0) {
+                    uprv_memcpy(newBytes, bytes, length);
+                }
+                uprv_free(bytes);
+                bytes = newBytes;
+            }
+            starts[count++] = length;
+            length += ucnv_fromUChars(cnv.getAlias(), bytes + length, capacity - length,
+                                      text + start, limit - start, &errorCode);
+            start = limit;
+        }
+        starts[count] = length;
+        if (U_FAILURE(errorCode)) {
+            fprintf(stderr, "error converting the text to %s: %s\n", charset, u_errorName(errorCode));
+            count = length = 0;
+        }
+    }
+
+public:
+    virtual ~Command() {
+        ucsdet_close(detector);
+        uprv_free(bytes);
+        delete[] starts;
+    }
+    virtual void call(UErrorCode* pErrorCode) {
+        sum = 0;
+        for (int32_t i = 0; i < count; ++i) {
+            ucsdet_setText(detector, bytes + starts[i], starts[i + 1] - starts[i], pErrorCode);
+            if (detectAll) {
+                int32_t matchCount = 0;
+                ucsdet_detectAll(detector, &matchCount, pErrorCode);
+                sum += matchCount;
+            } else {
+                sum += ucsdet_getConfidence(ucsdet_detect(detector, pErrorCode), pErrorCode);
+            }
+        }
+    }
+    virtual long getOperationsPerIteration() {
+        // Number of bytes examined.
+        return length > 0 ? length : 1;
+    }
+    virtual long getEventsPerIteration() {
+        // Number of documents.
+        return count;
+    }
+
+protected:
+    const CSDetPerfTest &test;
+    UCharsetDetector *detector;
+    char *bytes;
+    int32_t *starts;
+    int32_t count;
+    int32_t length;
+    UBool detectAll;
+    int32_t sum;
+};
+
+class Detect : public Command {
+public:
+    static UPerfFunction* get(const CSDetPerfTest &testcase, const char *charset) {
+        return new Detect(testcase, charset, FALSE);
+    }
+    static UPerfFunction* getAll(const CSDetPerfTest &testcase, const char *charset) {
+        return new Detect(testcase, charset, TRUE);
+    }
+
+private:
+    Detect(const CSDetPerfTest &testcase, const char *charset, UBool all)
+            : Command(testcase, charset, all) {}
+};
+
+UPerfFunction* CSDetPerfTest::runIndexedTest(int32_t index, UBool exec, const char* &name, char* /*par*/) {
+    switch (index) {
+        case 0: name = "DetectUTF8";        if (exec) return Detect::get(*this, "UTF-8"); break;
+        case 1: name = "DetectUTF16LE";     if (exec) return Detect::get(*this, "UTF-16LE"); break;
+        case 2: name = "DetectLatin1";      if (exec) return Detect::get(*this, "ISO-8859-1"); break;
+        case 3: name = "DetectLatin2";      if (exec) return Detect::get(*this, "ISO-8859-2"); break;
+        case 4: name = "DetectCyrillic";    if (exec) return Detect::get(*this, "windows-1251"); break;
+        case 5: name = "DetectShiftJIS";    if (exec) return Detect::get(*this, "Shift_JIS"); break;
+        case 6: name = "DetectAllUTF8";     if (exec) return Detect::getAll(*this, "UTF-8"); break;
+        case 7: name = "DetectAllLatin1";   if (exec) return Detect::getAll(*this, "ISO-8859-1"); break;
+        default: name = ""; break;
+    }
+    return NULL;
+}
+
+int main(int argc, const char *argv[]) {
+    UErrorCode status = U_ZERO_ERROR;
+    CSDetPerfTest test(argc, argv, status);
+
+    if (U_FAILURE(status)){
+        printf("The error is %s\n", u_errorName(status));
+        test.usage();
+        return status;
+    }
+
+    if (test.run() == FALSE){
+        fprintf(stderr, "FAILED: Tests could not be run please check the "
+                        "arguments.\n");
+        return -1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,228 @@
+/*
+ **********************************************************************
+ *   Copyright (C) 2016, International Business Machines
+ *   Corporation and others.  All Rights Reserved.
+ **********************************************************************
+ *  file name:  idnaperf.cpp
+ *  encoding:   US-ASCII
+ *  tab size:   8 (not used)
+ *  indentation:4
+ *
+ *  Performance test program for UTS #46 IDNA processing.
+ *
+ *  Reads a file with one host name per line, or uses a built-in list of
+ *  mostly-ASCII host names if no file is specified, and measures the
+ *  throughput of the IDNA name processing functions over them.
+ *  One operation and one event are one host name, so the number of
+ *  host names per second is 10^9 divided by the ns per operation
+ *  reported with -v.
+ *
+ *  Example:
+ *      idnaperf NameToASCII_UTF8 NameToASCII -f hosts.txt -e UTF-8 -v -p 10 -i 1000
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "unicode/uperf.h"
+#include "unicode/bytestream.h"
+#include "unicode/idna.h"
+#include "unicode/unistr.h"
+#include "cmemory.h"
+#include "uoptions.h"
+
+U_NAMESPACE_USE
+
+static const char *const defaultHostNames[] = {
+    "www.example.com",
+    "mail.google.com",
+    "WWW.ICU-PROJECT.ORG",
+    "cdn-3.static.images.example.net",
+    "a.b.c.d.e.f.example.co.uk",
+    "localhost",
+    "api.v2.service.internal",
+    "ssl.gstatic.com",
+    "xn--bcher-kva.de",
+    "b\xC3\xBC" "cher.de",
+    "www.M\xC3\xBC" "nchen.de",
+    "\xE6\x97\xA5\xE6\x9C\xAC\xE8\xAA\x9E\xE3\x80\x82\xEF\xBC\xAA\xEF\xBC\xB0",
+};
+
+// Test object.
+class IDNAPerfTest : public UPerfTest {
+public:
+    IDNAPerfTest(int32_t argc, const char *argv[], UErrorCode &status);
+    ~IDNAPerfTest();
+
+    virtual UPerfFunction* runIndexedTest(int32_t index, UBool exec, const char* &name, char* par = NULL);
+
+    const IDNA *getIDNA() const { return idna; }
+    int32_t getNameCount() const { return nameCount; }
+    const UnicodeString &getName(int32_t i) const { return names[i]; }
+    const std::string &getName8(int32_t i) const { return names8[i]; }
+
+private:
+    IDNA *idna;
+    UnicodeString *names;
+    std::string *names8;
+    int32_t nameCount;
+};
+
+IDNAPerfTest::IDNAPerfTest(int32_t argc, const char *argv[], UErrorCode &status)
+        : UPerfTest(argc, argv, NULL, 0, "", status),
+          idna(NULL), names(NULL), names8(NULL), nameCount(0) {
+    if (U_FAILURE(status)) {
+        return;
+    }
+    idna = IDNA::createUTS46Instance(UIDNA_NONTRANSITIONAL_TO_ASCII | UIDNA_NONTRANSITIONAL_TO_UNICODE,
+                                     status);
+    if (U_FAILURE(status)) {
+        return;
+    }
+    if (fileName == NULL) {
+        nameCount = UPRV_LENGTHOF(defaultHostNames);
+        names = new UnicodeString[nameCount];
+        for (int32_t i = 0; i < nameCount; ++i) {
+            names[i] = UnicodeString::fromUTF8(defaultHostNames[i]);
+        }
+    } else {
+        int32_t textLength = 0;
+        const UChar *text = getBuffer(textLength, status);
+        if (U_FAILURE(status)) {
+            return;
+        }
+        int32_t lineCount = 0;
+        for (int32_t i = 0; i < textLength; ++i) {
+            if (text[i] == 0xa) {
+                ++lineCount;
+            }
+        }
+        names = new UnicodeString[lineCount + 1];
+        for (int32_t start = 0; start < textLength;) {
+            int32_t limit = start;
+            while (limit < textLength && text[limit] != 0xa && text[limit] != 0xd) {
+                ++limit;
+            }
+            if (limit > start) {
+                names[nameCount++].setTo(text + start, limit - start);
+            }
+            start = limit + 1;
+        }
+        if (nameCount == 0) {
+            fprintf(stderr, "error: no host names in %s\n", fileName);
+            status = U_ILLEGAL_ARGUMENT_ERROR;
+            return;
+        }
+    }
+    names8 = new std::string[nameCount];
+    for (int32_t i = 0; i < nameCount; ++i) {
+        names[i].toUTF8String(names8[i]);
+    }
+}
+
+IDNAPerfTest::~IDNAPerfTest() {
+    delete idna;
+    delete[] names;
+    delete[] names8;
+}
+
+// Performance test function object.
+class Command : public UPerfFunction {
+protected:
+    Command(const IDNAPerfTest &testcase, UBool utf8, UBool ascii)
+            : test(testcase), isUTF8(utf8), toASCII(ascii), sum(0) {}
+
+public:
+    virtual ~Command() {}
+    virtual void call(UErrorCode* pErrorCode) {
+        const IDNA *idna = test.getIDNA();
+        int32_t count = test.getNameCount();
+        IDNAInfo info;
+        sum = 0;
+        if (isUTF8) {
+            char buffer[1024];
+            for (int32_t i = 0; i < count; ++i) {
+                CheckedArrayByteSink sink(buffer, UPRV_LENGTHOF(buffer));
+                if (toASCII) {
+                    idna->nameToASCII_UTF8(test.getName8(i), sink, info, *pErrorCode);
+                } else {
+                    idna->nameToUnicodeUTF8(test.getName8(i), sink, info, *pErrorCode);
+                }
+                sum += sink.NumberOfBytesAppended() + info.getErrors();
+            }
+        } else {
+            UnicodeString result;
+            for (int32_t i = 0; i < count; ++i) {
+                if (toASCII) {
+                    idna->nameToASCII(test.getName(i), result, info, *pErrorCode);
+                } else {
+                    idna->nameToUnicode(test.getName(i), result, info, *pErrorCode);
+                }
+                sum += result.length() + info.getErrors();
+            }
+        }
+    }
+    virtual long getOperationsPerIteration() {
+        // Number of host names.
+        return test.getNameCount();
+    }
+    virtual long getEventsPerIteration() {
+        return test.getNameCount();
+    }
+
+protected:
+    const IDNAPerfTest &test;
+    UBool isUTF8;
+    UBool toASCII;
+    int32_t sum;
+};
+
+class NameToASCII : public Command {
+public:
+    static UPerfFunction* get(const IDNAPerfTest &testcase, UBool utf8) {
+        return new NameToASCII(testcase, utf8);
+    }
+
+private:
+    NameToASCII(const IDNAPerfTest &testcase, UBool utf8) : Command(testcase, utf8, TRUE) {}
+};
+
+class NameToUnicode : public Command {
+public:
+    static UPerfFunction* get(const IDNAPerfTest &testcase, UBool utf8) {
+        return new NameToUnicode(testcase, utf8);
+    }
+
+private:
+    NameToUnicode(const IDNAPerfTest &testcase, UBool utf8) : Command(testcase, utf8, FALSE) {}
+};
+
+UPerfFunction* IDNAPerfTest::runIndexedTest(int32_t index, UBool exec, const char* &name, char* /*par*/) {
+    switch (index) {
+        case 0: name = "NameToASCII_UTF8";      if (exec) return NameToASCII::get(*this, TRUE); break;
+        case 1: name = "NameToASCII";           if (exec) return NameToASCII::get(*this, FALSE); break;
+        case 2: name = "NameToUnicode_UTF8";    if (exec) return NameToUnicode::get(*this, TRUE); break;
+        case 3: name = "NameToUnicode";         if (exec) return NameToUnicode::get(*this, FALSE); break;
+        default: name = ""; break;
+    }
+    return NULL;
+}
+
+int main(int argc, const char *argv[]) {
+    UErrorCode status = U_ZERO_ERROR;
+    IDNAPerfTest test(argc, argv, status);
+
+    if (U_FAILURE(status)){
+        printf("The error is %s\n", u_errorName(status));
+        test.usage();
+        return status;
+    }
+
+    if (test.run() == FALSE){
+        fprintf(stderr, "FAILED: Tests could not be run please check the "
+                        "arguments.\n");
+        return -1;
+    }
+
+    return 0;
+}
+
@@ -0,0 +1,371 @@
+/*
+ **********************************************************************
+ *   Copyright (C) 2016, International Business Machines
+ *   Corporation and others.  All Rights Reserved.
+ **********************************************************************
+ *  file name:  localeperf.cpp
+ *  encoding:   US-ASCII
+ *  tab size:   8 (not used)
+ *  indentation:4
+ *
+ *  Performance test program for Locale objects.
+ *
+ *  Measures the throughput (operations per second) of creating Locale
+ *  objects from locale ID strings, copying them, comparing them with
+ *  operator==, and computing their hash codes, over a list of common
+ *  locale IDs.
+ *  CreateLocaleThreaded creates the same Locale objects on several threads
+ *  at once (-T option, default 4), as concurrent service lookups do.
+ *  Also measures the throughput (tags/IDs per second) of
+ *  uloc_forLanguageTag() for a list of BCP 47 language tags,
+ *  and of uloc_addLikelySubtags() and uloc_minimizeSubtags()
+ *  for the locale IDs.
+ *  Also compares the throughput (headers per second) of negotiating
+ *  HTTP Accept-Language headers against all of the available locales
+ *  with a LocaleMatcher and with uloc_acceptLanguageFromHTTP().
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <thread>
+#include "unicode/localematcher.h"
+#include "unicode/locid.h"
+#include "unicode/uloc.h"
+#include "unicode/uenum.h"
+#include "unicode/uperf.h"
+#include "cmemory.h"
+#include "uoptions.h"
+
+U_NAMESPACE_USE
+
+static const char *const kLocaleIDs[] = {
+    "en", "en_US", "en_GB", "fr_FR", "de_DE", "de_CH", "it_IT", "es_ES",
+    "es_419", "pt_BR", "ru_RU", "ja_JP", "ko_KR", "zh_Hans_CN", "zh_Hant_TW", "ar_EG",
+    "he_IL", "hi_IN", "th_TH", "tr_TR", "pl_PL", "nl_NL", "sv_SE", "sr_Latn_RS"
+};
+static const int32_t kLocaleIDCount = (int32_t)(sizeof(kLocaleIDs) / sizeof(kLocaleIDs[0]));
+
+// Language tags as found in HTTP Accept-Language headers,
+// including a few grandfathered and deprecated ones.
+static const char *const kLanguageTags[] = {
+    "en-US", "en", "de-DE", "de-CH", "fr", "fr-CA", "es-419", "pt-BR",
+    "zh-Hant-TW", "zh-CN", "ja", "ko-KR", "sr-Latn-RS", "iw-IL", "i-klingon", "art-lojban",
+    "en-GB-oed", "zh-min-nan", "de-DE-u-co-phonebk", "ar-EG-u-nu-latn", "th-TH-u-ca-buddhist", "x-private"
+};
+static const int32_t kLanguageTagCount = (int32_t)(sizeof(kLanguageTags) / sizeof(kLanguageTags[0]));
+
+// Typical HTTP Accept-Language header values.
+static const char *const kAcceptLanguages[] = {
+    "en-US,en;q=0.8", "de-DE,de;q=0.8,en-US;q=0.6,en;q=0.4", "es-MX,es;q=0.8,en;q=0.5",
+    "fr-CH, fr;q=0.9, en;q=0.8, de;q=0.7, *;q=0.5", "zh-TW,zh;q=0.8,en-US;q=0.6",
+    "pt-BR,pt;q=0.8", "ja,en-US;q=0.7,en;q=0.3", "ko-KR", "en-GB,en;q=0.9", "ru;q=0.9, sv"
+};
+static const int32_t kAcceptLanguageCount = (int32_t)(sizeof(kAcceptLanguages) / sizeof(kAcceptLanguages[0]));
+
+static UOption localeOptions[] = {
+    UOPTION_DEF("threads", 'T', UOPT_REQUIRES_ARG)
+};
+
+static const char *const localeUsage =
+    "\t-T or --threads       Number of threads for CreateLocaleThreaded, default 4\n";
+
+// Test object.
+class LocalePerfTest : public UPerfTest {
+public:
+    LocalePerfTest(int32_t argc, const char *argv[], UErrorCode &status)
+            : UPerfTest(argc, argv, localeOptions, UPRV_LENGTHOF(localeOptions), localeUsage, status),
+              threadCount(4) {
+        if (U_SUCCESS(status) && localeOptions[0].doesOccur) {
+            threadCount = atoi(localeOptions[0].value);
+            if (threadCount <= 0) {
+                status = U_ILLEGAL_ARGUMENT_ERROR;
+            }
+        }
+    }
+
+    virtual UPerfFunction* runIndexedTest(int32_t index, UBool exec, const char* &name, char* par = NULL);
+
+private:
+    int32_t threadCount;
+};
+
+// Performance test function object.
+// Holds one Locale for each of the kLocaleIDs.
+class Command : public UPerfFunction {
+protected:
+    Command() {
+        for (int32_t i = 0; i < kLocaleIDCount; ++i) {
+            locales[i] = Locale(kLocaleIDs[i]);
+        }
+    }
+
+public:
+    virtual long getOperationsPerIteration() {
+        // Number of Locale objects processed.
+        return kLocaleIDCount;
+    }
+
+protected:
+    Locale locales[kLocaleIDCount];
+    int32_t sum;
+};
+
+class CreateLocale : public Command {
+public:
+    static UPerfFunction* get() {
+        return new CreateLocale();
+    }
+    virtual void call(UErrorCode* /*pErrorCode*/) {
+        sum = 0;
+        for (int32_t i = 0; i < kLocaleIDCount; ++i) {
+            Locale locale(kLocaleIDs[i]);
+            sum += (int32_t)locale.getCountry()[0];
+        }
+    }
+};
+
+// Each thread creates Locale objects for all of the kLocaleIDs kRounds times.
+class CreateLocaleThreaded : public UPerfFunction {
+public:
+    static UPerfFunction* get(int32_t threadCount) {
+        return new CreateLocaleThreaded(threadCount);
+    }
+    virtual ~CreateLocaleThreaded() {
+        delete[] threads;
+        delete[] sums;
+    }
+    virtual long getOperationsPerIteration() {
+        return threadCount * kRounds * kLocaleIDCount;
+    }
+    virtual void call(UErrorCode* /*pErrorCode*/) {
+        for (int32_t i = 0; i < threadCount; ++i) {
+            threads[i] = std::thread(&CreateLocaleThreaded::run, &sums[i]);
+        }
+        for (int32_t i = 0; i < threadCount; ++i) {
+            threads[i].join();
+        }
+    }
+
+private:
+    static const int32_t kRounds = 100;
+
+    CreateLocaleThreaded(int32_t count) : threadCount(count) {
+        threads = new std::thread[count];
+        sums = new int32_t[count];
+    }
+
+    static void run(int32_t *sum) {
+        *sum = 0;
+        for (int32_t round = 0; round < kRounds; ++round) {
+            for (int32_t i = 0; i < kLocaleIDCount; ++i) {
+                Locale locale(kLocaleIDs[i]);
+                *sum += (int32_t)locale.getCountry()[0];
+            }
+        }
+    }
+
+    int32_t threadCount;
+    std::thread *threads;
+    int32_t *sums;
+};
+
+class CopyLocale : public Command {
+public:
+    static UPerfFunction* get() {
+        return new CopyLocale();
+    }
+    virtual void call(UErrorCode* /*pErrorCode*/) {
+        sum = 0;
+        for (int32_t i = 0; i < kLocaleIDCount; ++i) {
+            Locale copy(locales[i]);
+            sum += (int32_t)copy.getCountry()[0];
+        }
+    }
+};
+
+// Compares each Locale with each other one,
+// as for example a linear search through a list of Locales does.
+class EqualsLocale : public Command {
+public:
+    static UPerfFunction* get() {
+        return new EqualsLocale();
+    }
+    virtual long getOperationsPerIteration() {
+        return kLocaleIDCount * kLocaleIDCount;
+    }
+    virtual void call(UErrorCode* /*pErrorCode*/) {
+        sum = 0;
+        for (int32_t i = 0; i < kLocaleIDCount; ++i) {
+            for (int32_t j = 0; j < kLocaleIDCount; ++j) {
+                if (locales[i] == locales[j]) {
+                    ++sum;
+                }
+            }
+        }
+    }
+};
+
+class HashLocale : public Command {
+public:
+    static UPerfFunction* get() {
+        return new HashLocale();
+    }
+    virtual void call(UErrorCode* /*pErrorCode*/) {
+        sum = 0;
+        for (int32_t i = 0; i < kLocaleIDCount; ++i) {
+            sum += locales[i].hashCode();
+        }
+    }
+};
+
+class ForLanguageTag : public UPerfFunction {
+public:
+    static UPerfFunction* get() {
+        return new ForLanguageTag();
+    }
+    virtual long getOperationsPerIteration() {
+        return kLanguageTagCount;
+    }
+    virtual void call(UErrorCode* pErrorCode) {
+        char localeID[ULOC_FULLNAME_CAPACITY];
+        for (int32_t i = 0; i < kLanguageTagCount; ++i) {
+            uloc_forLanguageTag(kLanguageTags[i], localeID, ULOC_FULLNAME_CAPACITY, NULL, pErrorCode);
+        }
+        if (U_FAILURE(*pErrorCode)) {
+            fprintf(stderr, "error: uloc_forLanguageTag() failed: %s\n",
+                    u_errorName(*pErrorCode));
+        }
+    }
+};
+
+// Maximizes or minimizes each of the kLocaleIDs.
+class LikelySubtags : public UPerfFunction {
+protected:
+    LikelySubtags(UBool maximize) : maximize(maximize) {}
+public:
+    static UPerfFunction* get(UBool maximize) {
+        return new LikelySubtags(maximize);
+    }
+    virtual long getOperationsPerIteration() {
+        return kLocaleIDCount;
+    }
+    virtual void call(UErrorCode* pErrorCode) {
+        char localeID[ULOC_FULLNAME_CAPACITY];
+        for (int32_t i = 0; i < kLocaleIDCount; ++i) {
+            if (maximize) {
+                uloc_addLikelySubtags(kLocaleIDs[i], localeID, ULOC_FULLNAME_CAPACITY, pErrorCode);
+            } else {
+                uloc_minimizeSubtags(kLocaleIDs[i], localeID, ULOC_FULLNAME_CAPACITY, pErrorCode);
+            }
+        }
+        if (U_FAILURE(*pErrorCode)) {
+            fprintf(stderr, "error: %s() failed: %s\n",
+                    maximize ? "uloc_addLikelySubtags" : "uloc_minimizeSubtags",
+                    u_errorName(*pErrorCode));
+        }
+    }
+private:
+    UBool maximize;
+};
+
+// Picks the best of the available locales for each of the kAcceptLanguages.
+class AcceptLanguage : public UPerfFunction {
+protected:
+    AcceptLanguage(UBool useMatcher, UErrorCode &errorCode)
+            : useMatcher(useMatcher), matcher(NULL), availableIDs(NULL) {
+        availableCount = uloc_countAvailable();
+        if (availableCount == 0) {
+            errorCode = U_MISSING_RESOURCE_ERROR;
+            return;
+        }
+        availableIDs = new const char *[availableCount];
+        Locale *available = new Locale[availableCount];
+        for (int32_t i = 0; i < availableCount; ++i) {
+            availableIDs[i] = uloc_getAvailable(i);
+            available[i] = Locale(availableIDs[i]);
+        }
+        if (useMatcher) {
+            matcher = new LocaleMatcher(available, availableCount, errorCode);
+        }
+        delete[] available;
+    }
+public:
+    static UPerfFunction* get(UBool useMatcher, UErrorCode &errorCode) {
+        AcceptLanguage *f = new AcceptLanguage(useMatcher, errorCode);
+        if (U_FAILURE(errorCode)) {
+            delete f;
+            return NULL;
+        }
+        return f;
+    }
+    virtual ~AcceptLanguage() {
+        delete matcher;
+        delete[] availableIDs;
+    }
+    virtual long getOperationsPerIteration() {
+        return kAcceptLanguageCount;
+    }
+    virtual void call(UErrorCode* pErrorCode) {
+        char localeID[ULOC_FULLNAME_CAPACITY];
+        UAcceptResult outResult;
+        for (int32_t i = 0; i < kAcceptLanguageCount; ++i) {
+            if (useMatcher) {
+                matcher->getBestMatchForHTTP(kAcceptLanguages[i], *pErrorCode);
+            } else {
+                // uloc_acceptLanguageFromHTTP() consumes the enumeration.
+                UEnumeration *available = uenum_openCharStringsEnumeration(
+                    availableIDs, availableCount, pErrorCode);
+                uloc_acceptLanguageFromHTTP(localeID, ULOC_FULLNAME_CAPACITY, &outResult,
+                                            kAcceptLanguages[i], available, pErrorCode);
+                uenum_close(available);
+            }
+        }
+        if (U_FAILURE(*pErrorCode)) {
+            fprintf(stderr, "error: %s failed: %s\n",
+                    useMatcher ? "LocaleMatcher::getBestMatchForHTTP()" : "uloc_acceptLanguageFromHTTP()",
+                    u_errorName(*pErrorCode));
+        }
+    }
+private:
+    UBool useMatcher;
+    LocaleMatcher *matcher;
+    const char **availableIDs;
+    int32_t availableCount;
+};
+
+UPerfFunction* LocalePerfTest::runIndexedTest(int32_t index, UBool exec, const char* &name, char* /*par*/) {
+    UErrorCode status = U_ZERO_ERROR;
+    switch (index) {
+        case 0: name = "CreateLocale";  if (exec) return CreateLocale::get(); break;
+        case 1: name = "CopyLocale";    if (exec) return CopyLocale::get(); break;
+        case 2: name = "EqualsLocale";  if (exec) return EqualsLocale::get(); break;
+        case 3: name = "HashLocale";    if (exec) return HashLocale::get(); break;
+        case 4: name = "ForLanguageTag";    if (exec) return ForLanguageTag::get(); break;
+        case 5: name = "AddLikelySubtags";  if (exec) return LikelySubtags::get(TRUE); break;
+        case 6: name = "MinimizeSubtags";   if (exec) return LikelySubtags::get(FALSE); break;
+        case 7: name = "AcceptLanguageFromHTTP";    if (exec) return AcceptLanguage::get(FALSE, status); break;
+        case 8: name = "LocaleMatcherForHTTP";      if (exec) return AcceptLanguage::get(TRUE, status); break;
+        case 9: name = "CreateLocaleThreaded";  if (exec) return CreateLocaleThreaded::get(threadCount); break;
+        default: name = ""; break;
+    }
+    return NULL;
+}
+
+int main(int argc, const char *argv[]) {
+    UErrorCode status = U_ZERO_ERROR;
+    LocalePerfTest test(argc, argv, status);
+
+    if (U_FAILURE(status)){
+        printf("The error is %s\n", u_errorName(status));
+        test.usage();
+        return status;
+    }
+
+    if (test.run() == FALSE){
+        fprintf(stderr, "FAILED: Tests could not be run please check the "
+                        "arguments.\n");
+        return -1;
+    }
+
+    return 0;
+}
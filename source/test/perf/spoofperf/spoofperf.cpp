@@ -0,0 +1,310 @@
+/*
+ **********************************************************************
+ *   Copyright (C) 2016, International Business Machines
+ *   Corporation and others.  All Rights Reserved.
+ **********************************************************************
+ *  file name:  spoofperf.cpp
+ *  encoding:   US-ASCII
+ *  tab size:   8 (not used)
+ *  indentation:4
+ *
+ *  Performance test program for spoof detection.
+ *
+ *  Reads identifiers (user names, host names, ...), one per line,
+ *  and measures the throughput (identifiers per second) of computing
+ *  their confusable skeletons from UTF-16 and from UTF-8,
+ *  of comparing adjacent identifiers with uspoof_areConfusable(),
+ *  of checking them with uspoof_check(),
+ *  and of building and querying a skeleton index of all of them.
+ *
+ *  Example:
+ *      spoofperf GetSkeleton GetSkeletonUTF8 -f names.txt -e UTF-8 -l -p 10 -i 100
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "unicode/uperf.h"
+#include "unicode/uspoof.h"
+#include "unicode/ustring.h"
+#include "cmemory.h"
+#include "uoptions.h"
+
+U_NAMESPACE_USE
+
+#define SKELETON_CAPACITY 1000
+
+// Test object.
+class SpoofPerfTest : public UPerfTest {
+public:
+    SpoofPerfTest(int32_t argc, const char *argv[], UErrorCode &status);
+    ~SpoofPerfTest();
+
+    virtual UPerfFunction* runIndexedTest(int32_t index, UBool exec, const char* &name, char* par = NULL);
+
+    const USpoofChecker *getChecker() const { return checker; }
+    const ULine *getIdentifiers() const { return identifiers; }
+    const char *const *getUTF8Identifiers() const { return utf8Identifiers; }
+    const int32_t *getUTF8Lengths() const { return utf8Lengths; }
+    int32_t getCount() const { return count; }
+
+private:
+    USpoofChecker *checker;
+    const ULine *identifiers;
+    char **utf8Identifiers;
+    int32_t *utf8Lengths;
+    int32_t count;
+};
+
+SpoofPerfTest::SpoofPerfTest(int32_t argc, const char *argv[], UErrorCode &status)
+        : UPerfTest(argc, argv, NULL, 0, "", status),
+          checker(NULL), identifiers(NULL), utf8Identifiers(NULL), utf8Lengths(NULL), count(0) {
+    if (U_FAILURE(status)) {
+        return;
+    }
+    if (fileName == NULL) {
+        fprintf(stderr, "error: no identifiers file specified (-f)\n");
+        status = U_ILLEGAL_ARGUMENT_ERROR;
+        return;
+    }
+    identifiers = getLines(status);
+    count = numLines;
+    checker = uspoof_open(&status);
+    if (U_FAILURE(status)) {
+        return;
+    }
+    utf8Identifiers = new char *[count];
+    utf8Lengths = new int32_t[count];
+    for (int32_t i = 0; i < count; ++i) {
+        int32_t length = 0;
+        UErrorCode preflightStatus = U_ZERO_ERROR;
+        u_strToUTF8(NULL, 0, &length, identifiers[i].name, identifiers[i].len, &preflightStatus);
+        utf8Identifiers[i] = new char[length + 1];
+        u_strToUTF8(utf8Identifiers[i], length + 1, &utf8Lengths[i],
+                    identifiers[i].name, identifiers[i].len, &status);
+    }
+}
+
+SpoofPerfTest::~SpoofPerfTest() {
+    if (utf8Identifiers != NULL) {
+        for (int32_t i = 0; i < count; ++i) {
+            delete[] utf8Identifiers[i];
+        }
+    }
+    delete[] utf8Identifiers;
+    delete[] utf8Lengths;
+    uspoof_close(checker);
+}
+
+// Performance test function object.
+class Command : public UPerfFunction {
+protected:
+    Command(const SpoofPerfTest &testcase) : test(testcase), sum(0) {}
+
+public:
+    virtual long getOperationsPerIteration() {
+        // Number of identifiers processed.
+        return test.getCount();
+    }
+
+protected:
+    const SpoofPerfTest &test;
+    int32_t sum;
+};
+
+class GetSkeleton : public Command {
+public:
+    static UPerfFunction* get(const SpoofPerfTest &testcase) {
+        return new GetSkeleton(testcase);
+    }
+    virtual void call(UErrorCode* pErrorCode) {
+        const ULine *identifiers = test.getIdentifiers();
+        sum = 0;
+        for (int32_t i = 0; i < test.getCount(); ++i) {
+            sum += uspoof_getSkeleton(test.getChecker(), USPOOF_ANY_CASE,
+                                      identifiers[i].name, identifiers[i].len,
+                                      skeleton, SKELETON_CAPACITY, pErrorCode);
+        }
+    }
+
+private:
+    GetSkeleton(const SpoofPerfTest &testcase) : Command(testcase) {}
+
+    UChar skeleton[SKELETON_CAPACITY];
+};
+
+class GetSkeletonUTF8 : public Command {
+public:
+    static UPerfFunction* get(const SpoofPerfTest &testcase) {
+        return new GetSkeletonUTF8(testcase);
+    }
+    virtual void call(UErrorCode* pErrorCode) {
+        const char *const *identifiers = test.getUTF8Identifiers();
+        const int32_t *lengths = test.getUTF8Lengths();
+        sum = 0;
+        for (int32_t i = 0; i < test.getCount(); ++i) {
+            sum += uspoof_getSkeletonUTF8(test.getChecker(), USPOOF_ANY_CASE,
+                                          identifiers[i], lengths[i],
+                                          skeleton, SKELETON_CAPACITY, pErrorCode);
+        }
+    }
+
+private:
+    GetSkeletonUTF8(const SpoofPerfTest &testcase) : Command(testcase) {}
+
+    char skeleton[SKELETON_CAPACITY];
+};
+
+// Compares each identifier with the next one.
+class AreConfusable : public Command {
+public:
+    static UPerfFunction* get(const SpoofPerfTest &testcase) {
+        return new AreConfusable(testcase);
+    }
+    virtual void call(UErrorCode* pErrorCode) {
+        const ULine *identifiers = test.getIdentifiers();
+        sum = 0;
+        for (int32_t i = 1; i < test.getCount(); ++i) {
+            sum += uspoof_areConfusable(test.getChecker(),
+                                        identifiers[i - 1].name, identifiers[i - 1].len,
+                                        identifiers[i].name, identifiers[i].len, pErrorCode);
+        }
+    }
+
+private:
+    AreConfusable(const SpoofPerfTest &testcase) : Command(testcase) {}
+};
+
+class CheckIdentifier : public Command {
+public:
+    static UPerfFunction* get(const SpoofPerfTest &testcase) {
+        return new CheckIdentifier(testcase);
+    }
+    virtual void call(UErrorCode* pErrorCode) {
+        const ULine *identifiers = test.getIdentifiers();
+        sum = 0;
+        for (int32_t i = 0; i < test.getCount(); ++i) {
+            sum += uspoof_check(test.getChecker(), identifiers[i].name, identifiers[i].len,
+                                NULL, pErrorCode);
+        }
+    }
+
+private:
+    CheckIdentifier(const SpoofPerfTest &testcase) : Command(testcase) {}
+};
+
+// Builds and serializes a skeleton index of all identifiers.
+class BuildSkeletonIndex : public Command {
+public:
+    static UPerfFunction* get(const SpoofPerfTest &testcase) {
+        return new BuildSkeletonIndex(testcase);
+    }
+    virtual ~BuildSkeletonIndex() {
+        uprv_free(data);
+    }
+    virtual void call(UErrorCode* pErrorCode) {
+        const ULine *identifiers = test.getIdentifiers();
+        LocalUSpoofSkeletonIndexBuilderPointer builder(
+            uspoof_openSkeletonIndexBuilder(test.getChecker(), USPOOF_ANY_CASE, pErrorCode));
+        for (int32_t i = 0; i < test.getCount(); ++i) {
+            uspoof_addToSkeletonIndex(builder.getAlias(), identifiers[i].name, identifiers[i].len,
+                                      i, pErrorCode);
+        }
+        int32_t length = uspoof_serializeSkeletonIndex(builder.getAlias(), data, capacity, pErrorCode);
+        if (*pErrorCode == U_BUFFER_OVERFLOW_ERROR) {
+            *pErrorCode = U_ZERO_ERROR;
+            uprv_free(data);
+            data = uprv_malloc(length);
+            capacity = length;
+            uspoof_serializeSkeletonIndex(builder.getAlias(), data, capacity, pErrorCode);
+        }
+    }
+
+private:
+    BuildSkeletonIndex(const SpoofPerfTest &testcase)
+            : Command(testcase), data(NULL), capacity(0) {}
+
+    void *data;
+    int32_t capacity;
+};
+
+// Looks up each identifier in a skeleton index of all identifiers.
+class FindConfusables : public Command {
+public:
+    static UPerfFunction* get(const SpoofPerfTest &testcase) {
+        return new FindConfusables(testcase);
+    }
+    virtual ~FindConfusables() {
+        uspoof_closeSkeletonIndex(index);
+        uprv_free(data);
+    }
+    virtual void call(UErrorCode* pErrorCode) {
+        const ULine *identifiers = test.getIdentifiers();
+        sum = 0;
+        for (int32_t i = 0; i < test.getCount(); ++i) {
+            sum += uspoof_findConfusables(index, identifiers[i].name, identifiers[i].len,
+                                          values, UPRV_LENGTHOF(values), pErrorCode);
+            if (*pErrorCode == U_BUFFER_OVERFLOW_ERROR) {
+                *pErrorCode = U_ZERO_ERROR;
+            }
+        }
+    }
+
+private:
+    FindConfusables(const SpoofPerfTest &testcase)
+            : Command(testcase), data(NULL), index(NULL) {
+        UErrorCode errorCode = U_ZERO_ERROR;
+        const ULine *identifiers = test.getIdentifiers();
+        LocalUSpoofSkeletonIndexBuilderPointer builder(
+            uspoof_openSkeletonIndexBuilder(test.getChecker(), USPOOF_ANY_CASE, &errorCode));
+        for (int32_t i = 0; i < test.getCount(); ++i) {
+            uspoof_addToSkeletonIndex(builder.getAlias(), identifiers[i].name, identifiers[i].len,
+                                      i, &errorCode);
+        }
+        int32_t length = uspoof_serializeSkeletonIndex(builder.getAlias(), NULL, 0, &errorCode);
+        if (errorCode == U_BUFFER_OVERFLOW_ERROR) {
+            errorCode = U_ZERO_ERROR;
+            data = uprv_malloc(length);
+            uspoof_serializeSkeletonIndex(builder.getAlias(), data, length, &errorCode);
+            index = uspoof_openSkeletonIndex(test.getChecker(), data, length, &errorCode);
+        }
+        if (U_FAILURE(errorCode)) {
+            fprintf(stderr, "error building the skeleton index: %s\n", u_errorName(errorCode));
+        }
+    }
+
+    void *data;
+    USpoofSkeletonIndex *index;
+    int32_t values[16];
+};
+
+UPerfFunction* SpoofPerfTest::runIndexedTest(int32_t index, UBool exec, const char* &name, char* /*par*/) {
+    switch (index) {
+        case 0: name = "GetSkeleton";       if (exec) return GetSkeleton::get(*this); break;
+        case 1: name = "GetSkeletonUTF8";   if (exec) return GetSkeletonUTF8::get(*this); break;
+        case 2: name = "AreConfusable";     if (exec) return AreConfusable::get(*this); break;
+        case 3: name = "CheckIdentifier";   if (exec) return CheckIdentifier::get(*this); break;
+        case 4: name = "BuildSkeletonIndex"; if (exec) return BuildSkeletonIndex::get(*this); break;
+        case 5: name = "FindConfusables";   if (exec) return FindConfusables::get(*this); break;
+        default: name = ""; break;
+    }
+    return NULL;
+}
+
+int main(int argc, const char *argv[]) {
+    UErrorCode status = U_ZERO_ERROR;
+    SpoofPerfTest test(argc, argv, status);
+
+    if (U_FAILURE(status)){
+        printf("The error is %s\n", u_errorName(status));
+        test.usage();
+        return status;
+    }
+
+    if (test.run() == FALSE){
+        fprintf(stderr, "FAILED: Tests could not be run please check the "
+                        "arguments.\n");
+        return -1;
+    }
+
+    return 0;
+}
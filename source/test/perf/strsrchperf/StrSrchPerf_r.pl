@@ -1,7 +1,7 @@
 #!/usr/bin/perl
 #  ********************************************************************
 #  * COPYRIGHT:
-#  * Copyright (c) 2008-2013, International Business Machines
+#  * Copyright (c) 2008-2016, International Business Machines
 #  * Corporation and others. All Rights Reserved.
 #  ********************************************************************
 
@@ -55,6 +55,10 @@ my $dataFiles = {
 my $tests = {
     "ICU Forward Search", [ "$p1 Test_ICU_Forward_Search", "$p2 Test_ICU_Forward_Search" ],
     "ICU Backward Search",[ "$p1 Test_ICU_Backward_Search", "$p2 Test_ICU_Backward_Search" ],
+    "ICU Forward Search, primary strength", [ "$p1 Test_ICU_Forward_Search_Primary", "$p2 Test_ICU_Forward_Search_Primary" ],
+    "ICU Forward Search, secondary strength", [ "$p1 Test_ICU_Forward_Search_Secondary", "$p2 Test_ICU_Forward_Search_Secondary" ],
+    "ICU Backward Search, primary strength", [ "$p1 Test_ICU_Backward_Search_Primary", "$p2 Test_ICU_Backward_Search_Primary" ],
+    "ICU Search for many words, one search each, primary strength", [ "$p1 Test_ICU_Forward_Search_Each_Primary", "$p2 Test_ICU_Forward_Search_Each_Primary" ],
 };
 
 runTests( $options, $tests, $dataFiles );
@@ -1,12 +1,16 @@
 /********************************************************************
  * COPYRIGHT:
- * Copyright (C) 2008-2012 IBM, Inc.   All Rights Reserved.
+ * Copyright (C) 2008-2016 IBM, Inc.   All Rights Reserved.
  *
  ********************************************************************/
 /** 
  * This program tests string search performance.
  * APIs tested: 
  * ICU4C 
+ * The _Primary and _Secondary tests search with a collator of that strength,
+ * that is, case-insensitively, and also accent-insensitively at primary strength.
+ * The _Multi and _Each tests search for words of the text, as many as
+ * MULTI_PATTERN_COUNT, with one UMultiStringSearch or with one UStringSearch each.
  */
 
 #include "strsrchperf.h"
@@ -15,7 +19,12 @@ StringSearchPerformanceTest::StringSearchPerformanceTest(int32_t argc, const cha
 :UPerfTest(argc,argv,status){
     int32_t start, end;
     srch = NULL;
+    srchPrimary = NULL;
+    srchSecondary = NULL;
     pttrn = NULL;
+    wordCount = 0;
+    collPrimary = NULL;
+    multiSrch = NULL;
     if(status== U_ILLEGAL_ARGUMENT_ERROR || line_mode){
        fprintf(stderr,gUsageString, "strsrchperf");
        return;
@@ -61,6 +70,9 @@ StringSearchPerformanceTest::StringSearchPerformanceTest(int32_t argc, const cha
     
     /* Create the StringSearch object to be use in performance test. */
     srch = usearch_open(pttrn, pttrnLen, src, srcLen, locale, NULL, &status);
+    srchPrimary = openSearch(UCOL_PRIMARY, status);
+    srchSecondary = openSearch(UCOL_SECONDARY, status);
+    openMultiSearches(status);
 
     if(U_FAILURE(status)){
         fprintf(stderr, "FAILED to create UPerfTest object. Error: %s\n", u_errorName(status));
@@ -69,6 +81,59 @@ StringSearchPerformanceTest::StringSearchPerformanceTest(int32_t argc, const cha
     
 }
 
+UStringSearch* StringSearchPerformanceTest::openSearch(UCollationStrength strength, UErrorCode &status) {
+    UStringSearch* search = usearch_open(pttrn, pttrnLen, src, srcLen, locale, NULL, &status);
+    if (U_SUCCESS(status)) {
+        ucol_setStrength(usearch_getCollator(search), strength);
+        usearch_reset(search);
+    }
+    return search;
+}
+
+void StringSearchPerformanceTest::openMultiSearches(UErrorCode &status) {
+    /* Collect distinct words of 4 to 20 letters. */
+    int32_t i = 0;
+    while (i < srcLen && wordCount < MULTI_PATTERN_COUNT) {
+        int32_t start = i;
+        while (i < srcLen && u_isalpha(src[i])) {
+            i++;
+        }
+        int32_t len = i - start;
+        if (len >= 4 && len <= 20) {
+            int32_t j;
+            for (j = 0; j < wordCount; j++) {
+                if (wordLens[j] == len && u_strncmp(words[j], src + start, len) == 0) {
+                    break;
+                }
+            }
+            if (j == wordCount) {
+                words[wordCount] = src + start;
+                wordLens[wordCount] = len;
+                wordCount++;
+            }
+        }
+        if (i == start) {
+            i++;
+        }
+    }
+    for (i = 0; i < wordCount; i++) {
+        wordSrchs[i] = NULL;
+    }
+    if (U_FAILURE(status) || wordCount == 0) {
+        return;
+    }
+
+    collPrimary = ucol_open(locale, &status);
+    if (U_FAILURE(status)) {
+        return;
+    }
+    ucol_setStrength(collPrimary, UCOL_PRIMARY);
+    multiSrch = usearch_openMulti(words, wordLens, wordCount, src, srcLen, collPrimary, &status);
+    for (i = 0; i < wordCount; i++) {
+        wordSrchs[i] = usearch_openFromCollator(words[i], wordLens[i], src, srcLen, collPrimary, NULL, &status);
+    }
+}
+
 StringSearchPerformanceTest::~StringSearchPerformanceTest() {
     if (pttrn != NULL) {
         free(pttrn);
@@ -76,12 +141,30 @@ StringSearchPerformanceTest::~StringSearchPerformanceTest() {
     if (srch != NULL) {
         usearch_close(srch);
     }
+    if (srchPrimary != NULL) {
+        usearch_close(srchPrimary);
+    }
+    if (srchSecondary != NULL) {
+        usearch_close(srchSecondary);
+    }
+    usearch_closeMulti(multiSrch);
+    for (int32_t i = 0; i < wordCount; i++) {
+        usearch_close(wordSrchs[i]);
+    }
+    if (collPrimary != NULL) {
+        ucol_close(collPrimary);
+    }
 }
 
 UPerfFunction* StringSearchPerformanceTest::runIndexedTest(int32_t index, UBool exec, const char *&name, char *par) {
     switch (index) {
         TESTCASE(0,Test_ICU_Forward_Search);
         TESTCASE(1,Test_ICU_Backward_Search);
+        TESTCASE(2,Test_ICU_Forward_Search_Primary);
+        TESTCASE(3,Test_ICU_Forward_Search_Secondary);
+        TESTCASE(4,Test_ICU_Backward_Search_Primary);
+        TESTCASE(5,Test_ICU_Multi_Search_Primary);
+        TESTCASE(6,Test_ICU_Forward_Search_Each_Primary);
 
         default: 
             name = ""; 
@@ -100,6 +183,31 @@ UPerfFunction* StringSearchPerformanceTest::Test_ICU_Backward_Search(){
     return func;
 }
 
+UPerfFunction* StringSearchPerformanceTest::Test_ICU_Forward_Search_Primary(){
+    StringSearchPerfFunction* func = new StringSearchPerfFunction(ICUForwardSearch, srchPrimary, src, srcLen, pttrn, pttrnLen);
+    return func;
+}
+
+UPerfFunction* StringSearchPerformanceTest::Test_ICU_Forward_Search_Secondary(){
+    StringSearchPerfFunction* func = new StringSearchPerfFunction(ICUForwardSearch, srchSecondary, src, srcLen, pttrn, pttrnLen);
+    return func;
+}
+
+UPerfFunction* StringSearchPerformanceTest::Test_ICU_Backward_Search_Primary(){
+    StringSearchPerfFunction* func = new StringSearchPerfFunction(ICUBackwardSearch, srchPrimary, src, srcLen, pttrn, pttrnLen);
+    return func;
+}
+
+UPerfFunction* StringSearchPerformanceTest::Test_ICU_Multi_Search_Primary(){
+    MultiStringSearchPerfFunction* func = new MultiStringSearchPerfFunction(multiSrch, NULL, 0, src, srcLen);
+    return func;
+}
+
+UPerfFunction* StringSearchPerformanceTest::Test_ICU_Forward_Search_Each_Primary(){
+    MultiStringSearchPerfFunction* func = new MultiStringSearchPerfFunction(NULL, wordSrchs, wordCount, src, srcLen);
+    return func;
+}
+
 int main (int argc, const char* argv[]) {
     UErrorCode status = U_ZERO_ERROR;
     StringSearchPerformanceTest test(argc, argv, status);
@@ -1,6 +1,6 @@
 /********************************************************************
  * COPYRIGHT:
- * Copyright (C) 2008-2012 IBM, Inc.   All Rights Reserved.
+ * Copyright (C) 2008-2016 IBM, Inc.   All Rights Reserved.
  *
  ********************************************************************/
 #ifndef _STRSRCHPERF_H
@@ -11,6 +11,9 @@
 #include <stdlib.h>
 #include <stdio.h>
 
+/* number of patterns for the multiple pattern tests */
+#define MULTI_PATTERN_COUNT 200
+
 typedef void (*StrSrchFn)(UStringSearch* srch, const UChar* src,int32_t srcLen, const UChar* pttrn, int32_t pttrnLen, UErrorCode* status);
 
 class StringSearchPerfFunction : public UPerfFunction {
@@ -41,6 +44,43 @@ public:
     }
 };
 
+/* Searches for many patterns, either with one UMultiStringSearch or with one UStringSearch each. */
+class MultiStringSearchPerfFunction : public UPerfFunction {
+private:
+    UMultiStringSearch* msrch;
+    UStringSearch** srchs;
+    int32_t srchCount;
+    const UChar* src;
+    int32_t srcLen;
+
+public:
+    virtual void call(UErrorCode* status) {
+        if (msrch != NULL) {
+            usearch_setMultiText(msrch, src, srcLen, status);
+            while (usearch_nextMulti(msrch, NULL, NULL, NULL, status)) {}
+        } else {
+            for (int32_t i = 0; i < srchCount; i++) {
+                int32_t match = usearch_first(srchs[i], status);
+                while (match != USEARCH_DONE) {
+                    match = usearch_next(srchs[i], status);
+                }
+            }
+        }
+    }
+
+    virtual long getOperationsPerIteration() {
+        return (long) srcLen;
+    }
+
+    MultiStringSearchPerfFunction(UMultiStringSearch* msearch, UStringSearch** searches, int32_t searchCount, const UChar* source, int32_t sourceLen) {
+        msrch = msearch;
+        srchs = searches;
+        srchCount = searchCount;
+        src = source;
+        srcLen = sourceLen;
+    }
+};
+
 class StringSearchPerformanceTest : public UPerfTest {
 private:
     const UChar* src;
@@ -48,6 +88,18 @@ private:
     UChar* pttrn;
     int32_t pttrnLen;
     UStringSearch* srch;
+    UStringSearch* srchPrimary;
+    UStringSearch* srchSecondary;
+    /* words of the text, for the multiple pattern tests */
+    const UChar* words[MULTI_PATTERN_COUNT];
+    int32_t wordLens[MULTI_PATTERN_COUNT];
+    int32_t wordCount;
+    UCollator* collPrimary;
+    UMultiStringSearch* multiSrch;
+    UStringSearch* wordSrchs[MULTI_PATTERN_COUNT];
+
+    UStringSearch* openSearch(UCollationStrength strength, UErrorCode &status);
+    void openMultiSearches(UErrorCode &status);
     
 public:
     StringSearchPerformanceTest(int32_t argc, const char *argv[], UErrorCode &status);
@@ -55,6 +107,11 @@ public:
     virtual UPerfFunction* runIndexedTest(int32_t index, UBool exec, const char *&name, char *par = NULL);
     UPerfFunction* Test_ICU_Forward_Search();
     UPerfFunction* Test_ICU_Backward_Search();
+    UPerfFunction* Test_ICU_Forward_Search_Primary();
+    UPerfFunction* Test_ICU_Forward_Search_Secondary();
+    UPerfFunction* Test_ICU_Backward_Search_Primary();
+    UPerfFunction* Test_ICU_Multi_Search_Primary();
+    UPerfFunction* Test_ICU_Forward_Search_Each_Primary();
 };
 
 
@@ -0,0 +1,264 @@
+/*
+ **********************************************************************
+ *   Copyright (C) 2016, International Business Machines
+ *   Corporation and others.  All Rights Reserved.
+ **********************************************************************
+ *  file name:  tzperf.cpp
+ *  encoding:   US-ASCII
+ *  tab size:   8 (not used)
+ *  indentation:4
+ *
+ *  Performance test program for time zone offset lookups.
+ *
+ *  Measures TimeZone::getOffset() and BasicTimeZone::getOffsetFromLocal()
+ *  throughput (offsets per second) for a zone with many historic
+ *  transitions, a zone with very few transitions, and for dates which
+ *  are covered by the final (recurrent) rule of a zone.
+ *  Also measures TimeZone::createTimeZone() and TimeZone::clone()
+ *  throughput (zones per second), and TimeZoneNames::find() throughput
+ *  (names per second) for fresh TimeZoneNames instances.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "unicode/basictz.h"
+#include "unicode/locid.h"
+#include "unicode/timezone.h"
+#include "unicode/tznames.h"
+#include "unicode/uperf.h"
+#include "uoptions.h"
+
+#if !UCONFIG_NO_FORMATTING
+
+U_NAMESPACE_USE
+
+// Number of offset lookups per iteration.
+static const int32_t kDateCount = 4096;
+
+static const UDate kMillisPerYear = 365.2425 * 24.0 * 60.0 * 60.0 * 1000.0;
+
+// Test object.
+class TimeZonePerfTest : public UPerfTest {
+public:
+    TimeZonePerfTest(int32_t argc, const char *argv[], UErrorCode &status)
+            : UPerfTest(argc, argv, NULL, 0, "", status) {}
+
+    virtual UPerfFunction* runIndexedTest(int32_t index, UBool exec, const char* &name, char* par = NULL);
+};
+
+// Performance test function object.
+// Looks up the offsets of kDateCount dates spread evenly over
+// [startYear, limitYear) in the given zone.
+class Command : public UPerfFunction {
+protected:
+    Command(const char *tzid, int32_t startYear, int32_t limitYear) {
+        zone = (BasicTimeZone *)TimeZone::createTimeZone(UnicodeString(tzid, -1, US_INV));
+        UDate start = (startYear - 1970) * kMillisPerYear;
+        UDate step = (limitYear - startYear) * kMillisPerYear / kDateCount;
+        for (int32_t i = 0; i < kDateCount; ++i) {
+            dates[i] = start + i * step;
+        }
+    }
+
+public:
+    virtual ~Command() {
+        delete zone;
+    }
+
+    virtual long getOperationsPerIteration() {
+        // Number of offsets looked up.
+        return kDateCount;
+    }
+
+protected:
+    BasicTimeZone *zone;
+    UDate dates[kDateCount];
+    int32_t sum;
+};
+
+class GetOffset : public Command {
+protected:
+    GetOffset(const char *tzid, int32_t startYear, int32_t limitYear)
+            : Command(tzid, startYear, limitYear) {}
+public:
+    static UPerfFunction* get(const char *tzid, int32_t startYear, int32_t limitYear) {
+        return new GetOffset(tzid, startYear, limitYear);
+    }
+    virtual void call(UErrorCode* pErrorCode) {
+        int32_t raw, dst;
+        sum = 0;
+        for (int32_t i = 0; i < kDateCount; ++i) {
+            zone->getOffset(dates[i], FALSE, raw, dst, *pErrorCode);
+            sum += raw + dst;
+        }
+        if (U_FAILURE(*pErrorCode)) {
+            fprintf(stderr, "error: TimeZone::getOffset() failed: %s\n",
+                    u_errorName(*pErrorCode));
+        }
+    }
+};
+
+class GetOffsetFromLocal : public Command {
+protected:
+    GetOffsetFromLocal(const char *tzid, int32_t startYear, int32_t limitYear)
+            : Command(tzid, startYear, limitYear) {}
+public:
+    static UPerfFunction* get(const char *tzid, int32_t startYear, int32_t limitYear) {
+        return new GetOffsetFromLocal(tzid, startYear, limitYear);
+    }
+    virtual void call(UErrorCode* pErrorCode) {
+        int32_t raw, dst;
+        sum = 0;
+        for (int32_t i = 0; i < kDateCount; ++i) {
+            zone->getOffsetFromLocal(dates[i], BasicTimeZone::kFormer, BasicTimeZone::kLatter,
+                                     raw, dst, *pErrorCode);
+            sum += raw + dst;
+        }
+        if (U_FAILURE(*pErrorCode)) {
+            fprintf(stderr, "error: BasicTimeZone::getOffsetFromLocal() failed: %s\n",
+                    u_errorName(*pErrorCode));
+        }
+    }
+};
+
+// Creates and deletes zones for a list of IDs.
+static const char *const kZoneIDs[] = {
+    "America/New_York", "Europe/Berlin", "Asia/Tokyo", "Australia/Sydney",
+    "America/Los_Angeles", "Europe/London", "Asia/Kolkata", "US/Pacific"
+};
+static const int32_t kZoneIDCount = (int32_t)(sizeof(kZoneIDs) / sizeof(kZoneIDs[0]));
+
+class CreateTimeZone : public UPerfFunction {
+public:
+    static UPerfFunction* get() {
+        return new CreateTimeZone();
+    }
+    CreateTimeZone() {
+        for (int32_t i = 0; i < kZoneIDCount; ++i) {
+            ids[i] = UnicodeString(kZoneIDs[i], -1, US_INV);
+        }
+    }
+    virtual long getOperationsPerIteration() {
+        return kZoneIDCount;
+    }
+    virtual void call(UErrorCode* pErrorCode) {
+        for (int32_t i = 0; i < kZoneIDCount; ++i) {
+            TimeZone *zone = TimeZone::createTimeZone(ids[i]);
+            if (zone == NULL) {
+                *pErrorCode = U_MEMORY_ALLOCATION_ERROR;
+                return;
+            }
+            delete zone;
+        }
+    }
+private:
+    UnicodeString ids[kZoneIDCount];
+};
+
+class CloneTimeZone : public UPerfFunction {
+public:
+    static UPerfFunction* get() {
+        return new CloneTimeZone();
+    }
+    CloneTimeZone() {
+        zone = TimeZone::createTimeZone(UnicodeString("America/New_York", -1, US_INV));
+    }
+    virtual ~CloneTimeZone() {
+        delete zone;
+    }
+    virtual long getOperationsPerIteration() {
+        return 1;
+    }
+    virtual void call(UErrorCode* pErrorCode) {
+        TimeZone *clone = zone->clone();
+        if (clone == NULL) {
+            *pErrorCode = U_MEMORY_ALLOCATION_ERROR;
+            return;
+        }
+        delete clone;
+    }
+private:
+    TimeZone *zone;
+};
+
+// Creates a TimeZoneNames instance and looks up names which are not
+// names of the default zone, so that they are not preloaded.
+static const char *const kZoneNames[] = {
+    "Central European Summer Time", "Japan Standard Time",
+    "Australian Eastern Standard Time", "India Standard Time"
+};
+static const int32_t kZoneNameCount = (int32_t)(sizeof(kZoneNames) / sizeof(kZoneNames[0]));
+
+class FindTimeZoneNames : public UPerfFunction {
+public:
+    static UPerfFunction* get() {
+        return new FindTimeZoneNames();
+    }
+    FindTimeZoneNames() {
+        for (int32_t i = 0; i < kZoneNameCount; ++i) {
+            names[i] = UnicodeString(kZoneNames[i], -1, US_INV);
+        }
+    }
+    virtual long getOperationsPerIteration() {
+        return kZoneNameCount;
+    }
+    virtual void call(UErrorCode* pErrorCode) {
+        TimeZoneNames *tznames = TimeZoneNames::createInstance(Locale::getEnglish(), *pErrorCode);
+        if (U_FAILURE(*pErrorCode)) {
+            fprintf(stderr, "error: TimeZoneNames::createInstance() failed: %s\n",
+                    u_errorName(*pErrorCode));
+            return;
+        }
+        for (int32_t i = 0; i < kZoneNameCount; ++i) {
+            delete tznames->find(names[i], 0, UTZNM_LONG_STANDARD | UTZNM_LONG_DAYLIGHT, *pErrorCode);
+        }
+        delete tznames;
+    }
+private:
+    UnicodeString names[kZoneNameCount];
+};
+
+// America/New_York has a long history of DST transitions (dense),
+// Asia/Tokyo has only a handful (sparse).
+// Years from 2038 on are governed by the final rule of a zone.
+UPerfFunction* TimeZonePerfTest::runIndexedTest(int32_t index, UBool exec, const char* &name, char* par) {
+    switch (index) {
+        case 0: name = "GetOffsetDense";        if (exec) return GetOffset::get("America/New_York", 1900, 2038); break;
+        case 1: name = "GetOffsetSparse";       if (exec) return GetOffset::get("Asia/Tokyo", 1900, 2038); break;
+        case 2: name = "GetOffsetFinalRule";    if (exec) return GetOffset::get("America/New_York", 2038, 2100); break;
+        case 3: name = "GetOffsetFromLocalDense";   if (exec) return GetOffsetFromLocal::get("America/New_York", 1900, 2038); break;
+        case 4: name = "GetOffsetFromLocalSparse";  if (exec) return GetOffsetFromLocal::get("Asia/Tokyo", 1900, 2038); break;
+        case 5: name = "CreateTimeZone";        if (exec) return CreateTimeZone::get(); break;
+        case 6: name = "CloneTimeZone";         if (exec) return CloneTimeZone::get(); break;
+        case 7: name = "FindTimeZoneNames";     if (exec) return FindTimeZoneNames::get(); break;
+        default: name = ""; break;
+    }
+    return NULL;
+}
+
+int main(int argc, const char *argv[]) {
+    UErrorCode status = U_ZERO_ERROR;
+    TimeZonePerfTest test(argc, argv, status);
+
+    if (U_FAILURE(status)){
+        printf("The error is %s\n", u_errorName(status));
+        test.usage();
+        return status;
+    }
+
+    if (test.run() == FALSE){
+        fprintf(stderr, "FAILED: Tests could not be run please check the "
+                        "arguments.\n");
+        return -1;
+    }
+
+    return 0;
+}
+
+#else
+
+int main(int argc, const char *argv[]) {
+    return 0;
+}
+
+#endif
@@ -1,6 +1,6 @@
 /*  
 **********************************************************************
-*   Copyright (C) 2014, International Business Machines
+*   Copyright (C) 2014-2016, International Business Machines
 *   Corporation and others.  All Rights Reserved.
 **********************************************************************
 *   file name:  unisetperf.cpp
@@ -46,7 +46,8 @@ class UnicodeSetPerformanceTest : public UPerfTest {
 public:
     UnicodeSetPerformanceTest(int32_t argc, const char *argv[], UErrorCode &status)
             : UPerfTest(argc, argv, options, UPRV_LENGTHOF(options), unisetperf_usage, status),
-              utf8(NULL), utf8Length(0), countInputCodePoints(0), spanCount(0) {
+              utf8(NULL), utf8Length(0), countInputCodePoints(0), spanCount(0),
+              spanLimits(NULL), spanLimitsUTF8(NULL) {
         if (U_SUCCESS(status)) {
             UnicodeString pattern=UnicodeString(options[SET_PATTERN].value, -1, US_INV).unescape();
             set.applyPattern(pattern, status);
@@ -73,6 +74,9 @@ public:
                         status=U_MEMORY_ALLOCATION_ERROR;
                     }
                 }
+                if(U_SUCCESS(status)) {
+                    getSpanLimitsUTF8();
+                }
 
                 if(verbose) {
                     printf("code points:%ld  len16:%ld  len8:%ld  spans:%ld  "
@@ -85,12 +89,20 @@ public:
         }
     }
 
+    virtual ~UnicodeSetPerformanceTest() {
+        free(utf8);
+        free(spanLimits);
+        free(spanLimitsUTF8);
+    }
+
     virtual UPerfFunction* runIndexedTest(int32_t index, UBool exec, const char* &name, char* par = NULL);
 
     // Count spans of characters that are in the set,
     // and spans of characters that are not in the set.
     // If the very first character is in the set, then one additional
     // not-span is counted.
+    // Also remember the span limits, for verifying the results
+    // of the set's span functions against those of contains().
     void countSpans() {
         const UChar *s=getBuffer();
         int32_t length=getBufferLen();
@@ -101,6 +113,28 @@ public:
             tf=(UBool)(!tf);
             ++spanCount;
         }
+        spanLimits=(int32_t *)malloc(spanCount*4);
+        if(spanLimits!=NULL) {
+            int32_t count=0;
+            i=0;
+            tf=FALSE;
+            while(i<length) {
+                spanLimits[count++]=i=span(s, length, i, tf);
+                tf=(UBool)(!tf);
+            }
+        }
+    }
+    void getSpanLimitsUTF8() {
+        spanLimitsUTF8=(int32_t *)malloc(spanCount*4);
+        if(spanLimitsUTF8!=NULL) {
+            int32_t count=0;
+            int32_t i=0;
+            UBool tf=FALSE;
+            while(i<utf8Length && count<spanCount) {
+                spanLimitsUTF8[count++]=i=spanUTF8(utf8, utf8Length, i, tf);
+                tf=(UBool)(!tf);
+            }
+        }
     }
     int32_t span(const UChar *s, int32_t length, int32_t start, UBool tf) const {
         UChar32 c;
@@ -113,6 +147,17 @@ public:
         }
         return prev;
     }
+    int32_t spanUTF8(const char *s, int32_t length, int32_t start, UBool tf) const {
+        UChar32 c;
+        int32_t prev;
+        while((prev=start)<length) {
+            U8_NEXT(s, start, length, c);
+            if(tf!=set.contains(c)) {
+                break;
+            }
+        }
+        return prev;
+    }
 
     const UChar *getBuffer() const { return buffer; }
     int32_t getBufferLen() const { return bufferLen; }
@@ -124,6 +169,10 @@ public:
     int32_t countInputCodePoints;
     int32_t spanCount;
 
+    // Limits of the UTF-16 and UTF-8 spans, from contains() one code point at a time.
+    int32_t *spanLimits;
+    int32_t *spanLimitsUTF8;
+
     UnicodeSet set;
     UnicodeSet prefrozen;
 };
@@ -148,6 +197,17 @@ public:
         return testcase.spanCount;
     }
 
+    // Compare a span limit from one of the frozen set's span functions
+    // with the one found by calling contains() for one code point at a time.
+    static UBool checkLimit(const char *name, int32_t index, int32_t limit, int32_t expected) {
+        if(limit!=expected) {
+            fprintf(stderr, "error: %s() span %ld limit=%ld != %ld from contains()\n",
+                    name, (long)index, (long)limit, (long)expected);
+            return FALSE;
+        }
+        return TRUE;
+    }
+
     const UnicodeSetPerformanceTest &testcase;
 };
 
@@ -201,6 +261,32 @@ public:
     }
 };
 
+// Scalar reference for SpanUTF8: contains() for one code point at a time.
+class ContainsUTF8 : public Command {
+protected:
+    ContainsUTF8(const UnicodeSetPerformanceTest &testcase) : Command(testcase) {}
+public:
+    static UPerfFunction* get(const UnicodeSetPerformanceTest &testcase) {
+        return new ContainsUTF8(testcase);
+    }
+    virtual void call(UErrorCode* pErrorCode) {
+        const char *s=testcase.utf8;
+        int32_t length=testcase.utf8Length;
+        int32_t count=0;
+        int32_t i=0;
+        UBool tf=FALSE;
+        while(i<length) {
+            i=testcase.spanUTF8(s, length, i, tf);
+            tf=(UBool)(!tf);
+            ++count;
+        }
+        if(count!=testcase.spanCount) {
+            fprintf(stderr, "error: ContainsUTF8() count=%ld != %ld=UnicodeSetPerformanceTest.spanCount\n",
+                    (long)count, (long)testcase.spanCount);
+        }
+    }
+};
+
 class SpanUTF16 : public Command {
 protected:
     SpanUTF16(const UnicodeSetPerformanceTest &testcase) : Command(testcase) {
@@ -228,6 +314,23 @@ protected:
         if(set!=testcase.set) {
             fprintf(stderr, "error: frozen set != original!\n");
         }
+
+        // Verify that span() finds the same limits as contains().
+        if(testcase.spanLimits!=NULL) {
+            const UChar *s=testcase.getBuffer();
+            int32_t length=testcase.getBufferLen();
+            int32_t count=0;
+            int32_t i=0;
+            UBool tf=FALSE;
+            while(i<length && count<testcase.spanCount) {
+                i+=testcase.set.span(s+i, length-i, (USetSpanCondition)tf);
+                if(!checkLimit("SpanUTF16", count, i, testcase.spanLimits[count])) {
+                    break;
+                }
+                tf=(UBool)(!tf);
+                ++count;
+            }
+        }
     }
 public:
     static UPerfFunction* get(const UnicodeSetPerformanceTest &testcase) {
@@ -279,6 +382,24 @@ protected:
         if(set!=testcase.set) {
             fprintf(stderr, "error: frozen set != original!\n");
         }
+
+        // Verify that spanBack() finds the same span starts as contains(),
+        // which are the limits of the preceding spans.
+        if(testcase.spanLimits!=NULL) {
+            const UChar *s=testcase.getBuffer();
+            int32_t length=testcase.getBufferLen();
+            int32_t count=testcase.spanCount;
+            UBool tf=(UBool)((testcase.spanCount&1)==0);
+            while((length>0 || !tf) && count>0) {
+                length=testcase.set.spanBack(s, length, (USetSpanCondition)tf);
+                --count;
+                if(!checkLimit("SpanBackUTF16", count, length,
+                               count>0 ? testcase.spanLimits[count-1] : 0)) {
+                    break;
+                }
+                tf=(UBool)(!tf);
+            }
+        }
     }
 public:
     static UPerfFunction* get(const UnicodeSetPerformanceTest &testcase) {
@@ -329,6 +450,22 @@ protected:
         if(set!=testcase.set) {
             fprintf(stderr, "error: frozen set != original!\n");
         }
+
+        // Verify that spanUTF8() finds the same limits as contains().
+        if(testcase.spanLimitsUTF8!=NULL) {
+            const char *s=testcase.utf8;
+            int32_t count=0;
+            int32_t i=0;
+            UBool tf=FALSE;
+            while(i<testcase.utf8Length && count<testcase.spanCount) {
+                i+=testcase.set.spanUTF8(s+i, testcase.utf8Length-i, (USetSpanCondition)tf);
+                if(!checkLimit("SpanUTF8", count, i, testcase.spanLimitsUTF8[count])) {
+                    break;
+                }
+                tf=(UBool)(!tf);
+                ++count;
+            }
+        }
     }
 public:
     static UPerfFunction* get(const UnicodeSetPerformanceTest &testcase) {
@@ -375,6 +512,23 @@ protected:
         if(set!=testcase.set) {
             fprintf(stderr, "error: frozen set != original!\n");
         }
+
+        // Verify that spanBackUTF8() finds the same span starts as contains().
+        if(testcase.spanLimitsUTF8!=NULL) {
+            const char *s=testcase.utf8;
+            int32_t count=testcase.spanCount;
+            UBool tf=(UBool)((testcase.spanCount&1)==0);
+            length=testcase.utf8Length;
+            while((length>0 || !tf) && count>0) {
+                length=testcase.set.spanBackUTF8(s, length, (USetSpanCondition)tf);
+                --count;
+                if(!checkLimit("SpanBackUTF8", count, length,
+                               count>0 ? testcase.spanLimitsUTF8[count-1] : 0)) {
+                    break;
+                }
+                tf=(UBool)(!tf);
+            }
+        }
     }
 public:
     static UPerfFunction* get(const UnicodeSetPerformanceTest &testcase) {
@@ -410,6 +564,7 @@ UPerfFunction* UnicodeSetPerformanceTest::runIndexedTest(int32_t index, UBool ex
         case 2: name = "SpanBackUTF16";if (exec) return SpanBackUTF16::get(*this); break;
         case 3: name = "SpanUTF8";     if (exec) return SpanUTF8::get(*this); break;
         case 4: name = "SpanBackUTF8"; if (exec) return SpanBackUTF8::get(*this); break;
+        case 5: name = "ContainsUTF8"; if (exec) return ContainsUTF8::get(*this); break;
         default: name = ""; break;
     }
     return NULL;
@@ -1,7 +1,7 @@
 #!/usr/bin/perl
 #  ********************************************************************
 #  * COPYRIGHT:
-#  * Copyright (c) 2005-2013, International Business Machines Corporation and
+#  * Copyright (c) 2005-2016, International Business Machines Corporation and
 #  * others. All Rights Reserved.
 #  ********************************************************************
 
@@ -87,3 +87,39 @@ $tests = {
 };
 
 runTests($options, $tests, $dataFiles);
+
+# Frozen sets with few ASCII ranges span long ASCII runs in UTF-8 a word at a time;
+# compare with contains() one code point at a time.
+$options = {
+    "title"=>"UnicodeSet spanUTF8() vs. contains() performance",
+    "headers"=>"White_Space A-Za-z Han",
+    "operationIs"=>"tested Unicode code point",
+    "passes"=>"3",
+    "time"=>"2",
+    #"outputType"=>"HTML",
+    "dataDir"=>$UDHRDataPath,
+    "outputDir"=>"../results"
+};
+
+$tests = {
+    "ContainsUTF8",
+    [
+        "$p,ContainsUTF8 --type fast --pattern \"[:White_Space:]\"",
+        "$p,ContainsUTF8 --type fast --pattern \"[A-Za-z]\"",
+        "$p,ContainsUTF8 --type fast --pattern \"[:Han:]\""
+    ],
+    "SpanUTF8",
+    [
+        "$p,SpanUTF8 --type fast --pattern \"[:White_Space:]\"",
+        "$p,SpanUTF8 --type fast --pattern \"[A-Za-z]\"",
+        "$p,SpanUTF8 --type fast --pattern \"[:Han:]\""
+    ],
+    "SpanBackUTF8",
+    [
+        "$p,SpanBackUTF8 --type fast --pattern \"[:White_Space:]\"",
+        "$p,SpanBackUTF8 --type fast --pattern \"[A-Za-z]\"",
+        "$p,SpanBackUTF8 --type fast --pattern \"[:Han:]\""
+    ]
+};
+
+runTests($options, $tests, $dataFiles);
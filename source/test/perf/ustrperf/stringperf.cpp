@@ -1,6 +1,6 @@
 /********************************************************************
  * COPYRIGHT:
- * Copyright (C) 2002-2006 International Business Machines Corporation
+ * Copyright (C) 2002-2016 International Business Machines Corporation
  * and others. All Rights Reserved.
  *
  ********************************************************************/
@@ -16,7 +16,7 @@
 
 /** 
  * This program tests UnicodeString performance.
- * APIs tested: UnicodeString
+ * APIs tested: UnicodeString, string case mapping
  * ICU4C  
  * Windows 2000/XP, Linux
  */
@@ -148,6 +148,13 @@ UPerfFunction* StringPerformanceTest::runIndexedTest(int32_t index, UBool exec,
         TESTCASE(22, TestStdLibScan1);
         TESTCASE(23, TestStdLibScan2);
 
+        TESTCASE(24, TestToLower);
+        TESTCASE(25, TestToUpper);
+        TESTCASE(26, TestFoldCase);
+        TESTCASE(27, TestUTF8ToLower);
+        TESTCASE(28, TestUTF8ToUpper);
+        TESTCASE(29, TestUTF8FoldCase);
+
         default: 
             name = ""; 
             return NULL;
@@ -374,4 +381,56 @@ UPerfFunction* StringPerformanceTest::TestStdLibScan2()
     }
 }
 
+UPerfFunction* StringPerformanceTest::TestToLower()
+{
+    if (line_mode) {
+        return new StringPerfFunction(toLower, filelines_, numLines, uselen);
+    } else {
+        return new StringPerfFunction(toLower, StrBuffer, StrBufferLen, uselen);
+    }
+}
+
+UPerfFunction* StringPerformanceTest::TestToUpper()
+{
+    if (line_mode) {
+        return new StringPerfFunction(toUpper, filelines_, numLines, uselen);
+    } else {
+        return new StringPerfFunction(toUpper, StrBuffer, StrBufferLen, uselen);
+    }
+}
+
+UPerfFunction* StringPerformanceTest::TestFoldCase()
+{
+    if (line_mode) {
+        return new StringPerfFunction(foldCase, filelines_, numLines, uselen);
+    } else {
+        return new StringPerfFunction(foldCase, StrBuffer, StrBufferLen, uselen);
+    }
+}
 
+UPerfFunction* StringPerformanceTest::TestUTF8ToLower()
+{
+    if (line_mode) {
+        return new CaseMapUTF8PerfFunction(CaseMap_Lower, filelines_, numLines);
+    } else {
+        return new CaseMapUTF8PerfFunction(CaseMap_Lower, StrBuffer, StrBufferLen);
+    }
+}
+
+UPerfFunction* StringPerformanceTest::TestUTF8ToUpper()
+{
+    if (line_mode) {
+        return new CaseMapUTF8PerfFunction(CaseMap_Upper, filelines_, numLines);
+    } else {
+        return new CaseMapUTF8PerfFunction(CaseMap_Upper, StrBuffer, StrBufferLen);
+    }
+}
+
+UPerfFunction* StringPerformanceTest::TestUTF8FoldCase()
+{
+    if (line_mode) {
+        return new CaseMapUTF8PerfFunction(CaseMap_Fold, filelines_, numLines);
+    } else {
+        return new CaseMapUTF8PerfFunction(CaseMap_Fold, StrBuffer, StrBufferLen);
+    }
+}
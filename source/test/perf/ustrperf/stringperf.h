@@ -1,6 +1,6 @@
 /*
 **********************************************************************
-* Copyright (c) 2002-2011, International Business Machines
+* Copyright (c) 2002-2016, International Business Machines
 * Corporation and others.  All Rights Reserved.
 **********************************************************************
 */
@@ -9,6 +9,9 @@
 
 #include "unicode/utypes.h"
 #include "unicode/unistr.h"
+#include "unicode/ustring.h"
+#include "unicode/ucasemap.h"
+#include "unicode/uchar.h"
 
 #include "unicode/uperf.h"
 
@@ -24,6 +27,7 @@ typedef std::wstring stlstring;
 #define LOOPS 100			//Iterations
 //#define LOOPS 10
 #define catenate_STRLEN 2
+#define CASEMAP_CAPACITY (4*1024*1024)	//Capacity of the case mapping destination buffers
 
 const UChar uTESTCHAR1 =  'a';
 const wchar_t wTESTCHAR1 = 'a';
@@ -340,6 +344,90 @@ private:
 };
 
 
+/* Case mapping of UTF-8 text: converts the UTF-16 input once, then maps it in call(). */
+enum CaseMapType { CaseMap_Lower, CaseMap_Upper, CaseMap_Fold };
+
+class CaseMapUTF8PerfFunction : public UPerfFunction
+{
+public:
+    CaseMapUTF8PerfFunction(CaseMapType type, ULine* srcLines, int32_t srcNumLines)
+            : type_(type), numLines_(srcNumLines), csm_(NULL) {
+        lines8_=new char *[numLines_];
+        lengths8_=new int32_t[numLines_];
+        for(int32_t i=0; i<numLines_; i++) {
+            toUTF8(srcLines[i].name, srcLines[i].len, i);
+        }
+        open();
+    }
+
+    CaseMapUTF8PerfFunction(CaseMapType type, UChar* source, int32_t sourceLen)
+            : type_(type), numLines_(1), csm_(NULL) {
+        lines8_=new char *[1];
+        lengths8_=new int32_t[1];
+        toUTF8(source, sourceLen, 0);
+        open();
+    }
+
+    ~CaseMapUTF8PerfFunction() {
+        for(int32_t i=0; i<numLines_; i++) {
+            delete[] lines8_[i];
+        }
+        delete[] lines8_;
+        delete[] lengths8_;
+        ucasemap_close(csm_);
+    }
+
+    virtual void call(UErrorCode* status) {
+        for(int32_t i=0; i<numLines_; i++) {
+            UErrorCode errorCode=U_ZERO_ERROR;
+            switch(type_) {
+            case CaseMap_Lower:
+                ucasemap_utf8ToLower(csm_, dest8_, CASEMAP_CAPACITY, lines8_[i], lengths8_[i], &errorCode);
+                break;
+            case CaseMap_Upper:
+                ucasemap_utf8ToUpper(csm_, dest8_, CASEMAP_CAPACITY, lines8_[i], lengths8_[i], &errorCode);
+                break;
+            default:
+                ucasemap_utf8FoldCase(csm_, dest8_, CASEMAP_CAPACITY, lines8_[i], lengths8_[i], &errorCode);
+                break;
+            }
+            if(U_FAILURE(errorCode)) {
+                *status=errorCode;
+            }
+        }
+    }
+
+    virtual long getOperationsPerIteration() {
+        return numLines_;
+    }
+
+private:
+    void toUTF8(const UChar *s, int32_t length, int32_t i) {
+        UErrorCode errorCode=U_ZERO_ERROR;
+        int32_t length8=0;
+        u_strToUTF8(NULL, 0, &length8, s, length, &errorCode);
+        lines8_[i]=new char[length8+1];
+        errorCode=U_ZERO_ERROR;
+        u_strToUTF8(lines8_[i], length8+1, &lengths8_[i], s, length, &errorCode);
+    }
+
+    void open() {
+        UErrorCode errorCode=U_ZERO_ERROR;
+        csm_=ucasemap_open("", 0, &errorCode);
+    }
+
+    static char dest8_[CASEMAP_CAPACITY];
+
+    CaseMapType type_;
+    int32_t numLines_;
+    char **lines8_;
+    int32_t *lengths8_;
+    UCaseMap *csm_;
+};
+
+char CaseMapUTF8PerfFunction::dest8_[CASEMAP_CAPACITY];
+
+
 class StringPerformanceTest : public UPerfTest
 {
 public:
@@ -374,6 +462,13 @@ public:
     UPerfFunction* TestStdLibScan1();
     UPerfFunction* TestStdLibScan2();
 
+    UPerfFunction* TestToLower();
+    UPerfFunction* TestToUpper();
+    UPerfFunction* TestFoldCase();
+    UPerfFunction* TestUTF8ToLower();
+    UPerfFunction* TestUTF8ToUpper();
+    UPerfFunction* TestUTF8FoldCase();
+
 private:
     long COUNT_;
     ULine* filelines_;
@@ -466,6 +561,27 @@ inline void scan2(const UChar* src,int32_t srcLen, UnicodeString s0)
     scan_idx = uScan_STRING.indexOf(c2);
 }
 
+/* Case mapping with the root locale; results go into a global buffer. */
+UChar caseMapDest[CASEMAP_CAPACITY];
+
+inline void toLower(const UChar* src,int32_t srcLen, UnicodeString s0)
+{
+    UErrorCode errorCode=U_ZERO_ERROR;
+    u_strToLower(caseMapDest, CASEMAP_CAPACITY, src, srcLen, "", &errorCode);
+}
+
+inline void toUpper(const UChar* src,int32_t srcLen, UnicodeString s0)
+{
+    UErrorCode errorCode=U_ZERO_ERROR;
+    u_strToUpper(caseMapDest, CASEMAP_CAPACITY, src, srcLen, "", &errorCode);
+}
+
+inline void foldCase(const UChar* src,int32_t srcLen, UnicodeString s0)
+{
+    UErrorCode errorCode=U_ZERO_ERROR;
+    u_strFoldCase(caseMapDest, CASEMAP_CAPACITY, src, srcLen, U_FOLD_CASE_DEFAULT, &errorCode);
+}
+
 
 inline void StdLibCtor(const wchar_t* src,int32_t srcLen, stlstring s0)
 {
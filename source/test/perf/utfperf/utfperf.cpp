@@ -1,6 +1,6 @@
 /*  
  **********************************************************************
- *   Copyright (C) 2002-2014, International Business Machines
+ *   Copyright (C) 2002-2016, International Business Machines
  *   Corporation and others.  All Rights Reserved.
  **********************************************************************
  *   file name:  utfperf.cpp
@@ -18,6 +18,7 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include "unicode/uperf.h"
+#include "unicode/ustring.h"
 #include "cmemory.h" // for UPRV_LENGTHOF
 #include "uoptions.h"
 
@@ -324,11 +325,74 @@ protected:
     int32_t input8Length;
 };
 
+// Test UTF-8 validation of the whole input text.
+class ValidateUTF8 : public UPerfFunction {
+protected:
+    ValidateUTF8() : errorOffset(0) {}
+public:
+    static UPerfFunction* get(const UtfPerformanceTest &) {
+        return new ValidateUTF8();
+    }
+    virtual void call(UErrorCode* pErrorCode) {
+        errorOffset=u_validateUTF8(utf8, utf8Length, pErrorCode);
+        if(errorOffset>=0) {
+            fprintf(stderr, "error: u_validateUTF8() found an error at %ld\n", (long)errorOffset);
+        }
+    }
+    virtual long getOperationsPerIteration() {
+        return countInputCodePoints;
+    }
+protected:
+    int32_t errorOffset;
+};
+
+// Test UTF-16 validation of the whole input text.
+class ValidateUTF16 : public UPerfFunction {
+protected:
+    ValidateUTF16(const UtfPerformanceTest &testcase) : testcase(testcase), errorOffset(0) {}
+public:
+    static UPerfFunction* get(const UtfPerformanceTest &testcase) {
+        return new ValidateUTF16(testcase);
+    }
+    virtual void call(UErrorCode* pErrorCode) {
+        errorOffset=u_validateUTF16(testcase.getBuffer(), testcase.getBufferLen(), pErrorCode);
+        if(errorOffset>=0) {
+            fprintf(stderr, "error: u_validateUTF16() found an error at %ld\n", (long)errorOffset);
+        }
+    }
+    virtual long getOperationsPerIteration() {
+        return countInputCodePoints;
+    }
+protected:
+    const UtfPerformanceTest &testcase;
+    int32_t errorOffset;
+};
+
+// Test u_strFromUTF8WithSub() of the whole input text into the output buffer.
+class StrFromUTF8 : public UPerfFunction {
+protected:
+    StrFromUTF8() {}
+public:
+    static UPerfFunction* get(const UtfPerformanceTest &) {
+        return new StrFromUTF8();
+    }
+    virtual void call(UErrorCode* pErrorCode) {
+        u_strFromUTF8WithSub(output, OUTPUT_CAPACITY, &outputLength,
+                             utf8, utf8Length, 0xfffd, NULL, pErrorCode);
+    }
+    virtual long getOperationsPerIteration() {
+        return countInputCodePoints;
+    }
+};
+
 UPerfFunction* UtfPerformanceTest::runIndexedTest(int32_t index, UBool exec, const char* &name, char* par) {
     switch (index) {
         case 0: name = "Roundtrip";     if (exec) return Roundtrip::get(*this); break;
         case 1: name = "FromUnicode";   if (exec) return FromUnicode::get(*this); break;
         case 2: name = "FromUTF8";      if (exec) return FromUTF8::get(*this); break;
+        case 3: name = "ValidateUTF8";  if (exec) return ValidateUTF8::get(*this); break;
+        case 4: name = "ValidateUTF16"; if (exec) return ValidateUTF16::get(*this); break;
+        case 5: name = "StrFromUTF8";   if (exec) return StrFromUTF8::get(*this); break;
         default: name = ""; break;
     }
     return NULL;
@@ -1,6 +1,6 @@
 /*  
  **********************************************************************
- *   Copyright (C) 2002-2014, International Business Machines
+ *   Copyright (C) 2002-2016, International Business Machines
  *   Corporation and others.  All Rights Reserved.
  **********************************************************************
  *  file name:  utrie2perf.cpp
@@ -11,7 +11,7 @@
  *  created on: 2008sep07
  *  created by: Markus W. Scherer
  *
- *  Performance test program for UTrie2.
+ *  Performance test program for UTrie2 and UCPTrie.
  */
 
 #include <stdio.h>
@@ -19,7 +19,9 @@
 #include "unicode/uchar.h"
 #include "unicode/unorm.h"
 #include "unicode/uperf.h"
+#include "ucptrie.h"
 #include "uoptions.h"
+#include "utrie2.h"
 
 #if 0
 // Left over from when icu/branches/markus/utf8 could use both old UTrie
@@ -225,14 +227,248 @@ public:
     }
 };
 
+class GetGeneralCategory : public Command {
+protected:
+    GetGeneralCategory(const UTrie2PerfTest &testcase) : Command(testcase) {}
+public:
+    static UPerfFunction* get(const UTrie2PerfTest &testcase) {
+        return new GetGeneralCategory(testcase);
+    }
+    virtual void call(UErrorCode* pErrorCode) {
+        const UChar *buffer=testcase.getBuffer();
+        int32_t length=testcase.getBufferLen();
+        UChar32 c;
+        int32_t i;
+        uint32_t bitSet=0;
+        for(i=0; i<length;) {
+            U16_NEXT(buffer, i, length, c);
+            bitSet|=U_MASK(u_charType(c));
+        }
+        if(length>0 && bitSet==0) {
+            fprintf(stderr, "error: GetGeneralCategory() did not collect bits\n");
+        }
+    }
+};
+
+// Same as GetGeneralCategory but with one u_strCharTypes() call for the whole text.
+class GetGeneralCategoryBulk : public Command {
+protected:
+    GetGeneralCategoryBulk(const UTrie2PerfTest &testcase) : Command(testcase),
+            types((int8_t *)malloc(testcase.countInputCodePoints+1)), bits(0) {}
+public:
+    static UPerfFunction* get(const UTrie2PerfTest &testcase) {
+        return new GetGeneralCategoryBulk(testcase);
+    }
+    virtual ~GetGeneralCategoryBulk() { free(types); }
+    virtual void call(UErrorCode* pErrorCode) {
+        int32_t count=callBulk(pErrorCode);
+        uint32_t bitSet=0;
+        for(int32_t i=0; i<count; ++i) {
+            bitSet|=U_MASK(types[i]);
+        }
+        if(count>0 && bitSet==0) {
+            fprintf(stderr, "error: GetGeneralCategoryBulk() did not collect bits\n");
+        }
+        bits|=bitSet;
+    }
+protected:
+    virtual int32_t callBulk(UErrorCode* pErrorCode) {
+        return u_strCharTypes(testcase.getBuffer(), testcase.getBufferLen(),
+                              types, testcase.countInputCodePoints+1, pErrorCode);
+    }
+
+    int8_t *types;
+    uint32_t bits;
+};
+
+class GetGeneralCategoryBulkUTF8 : public GetGeneralCategoryBulk {
+protected:
+    GetGeneralCategoryBulkUTF8(const UTrie2PerfTest &testcase) : GetGeneralCategoryBulk(testcase) {}
+public:
+    static UPerfFunction* get(const UTrie2PerfTest &testcase) {
+        return new GetGeneralCategoryBulkUTF8(testcase);
+    }
+protected:
+    virtual int32_t callBulk(UErrorCode* pErrorCode) {
+        return u_strCharTypesUTF8(testcase.utf8, testcase.utf8Length,
+                                  types, testcase.countInputCodePoints+1, pErrorCode);
+    }
+};
+
+class ToLower : public Command {
+protected:
+    ToLower(const UTrie2PerfTest &testcase) : Command(testcase) {}
+public:
+    static UPerfFunction* get(const UTrie2PerfTest &testcase) {
+        return new ToLower(testcase);
+    }
+    virtual void call(UErrorCode* pErrorCode) {
+        const UChar *buffer=testcase.getBuffer();
+        int32_t length=testcase.getBufferLen();
+        UChar32 c;
+        int32_t i;
+        UChar32 sum=0;
+        for(i=0; i<length;) {
+            U16_NEXT(buffer, i, length, c);
+            sum+=u_tolower(c);
+        }
+        if(length>0 && sum==0) {
+            fprintf(stderr, "error: ToLower() did not sum up anything\n");
+        }
+    }
+};
+
+// Looks up the general category in equivalent UTrie2 and UCPTrie objects,
+// comparing the raw trie access without the property API around it.
+class TrieGetGC : public Command {
+protected:
+    TrieGetGC(const UTrie2PerfTest &testcase) : Command(testcase),
+            trie2(NULL), fastTrie(NULL), smallTrie(NULL), fastTrie8(NULL), result(0) {
+        UErrorCode errorCode=U_ZERO_ERROR;
+        trie2=utrie2_open(0, 0, &errorCode);
+        u_enumCharTypes(setGCRange, this);
+        utrie2_freeze(trie2, UTRIE2_16_VALUE_BITS, &errorCode);
+        UMutableCPTrie *mutableTrie=umutablecptrie_fromUTrie2(trie2, &errorCode);
+        fastTrie=umutablecptrie_buildImmutable(mutableTrie, UCPTRIE_TYPE_FAST,
+                                               UCPTRIE_VALUE_BITS_16, &errorCode);
+        smallTrie=umutablecptrie_buildImmutable(mutableTrie, UCPTRIE_TYPE_SMALL,
+                                                UCPTRIE_VALUE_BITS_16, &errorCode);
+        fastTrie8=umutablecptrie_buildImmutable(mutableTrie, UCPTRIE_TYPE_FAST,
+                                                UCPTRIE_VALUE_BITS_8, &errorCode);
+        umutablecptrie_close(mutableTrie);
+        if(U_FAILURE(errorCode)) {
+            fprintf(stderr, "error: building the general category tries failed: %s\n",
+                    u_errorName(errorCode));
+        }
+    }
+    ~TrieGetGC() {
+        utrie2_close(trie2);
+        ucptrie_close(fastTrie);
+        ucptrie_close(smallTrie);
+        ucptrie_close(fastTrie8);
+    }
+
+    static UBool U_CALLCONV
+    setGCRange(const void *context, UChar32 start, UChar32 limit, UCharCategory type) {
+        UErrorCode errorCode=U_ZERO_ERROR;
+        utrie2_setRange32(((const TrieGetGC *)context)->trie2, start, limit-1, type,
+                          TRUE, &errorCode);
+        return U_SUCCESS(errorCode);
+    }
+
+    // Stores the collected bits so that the lookups are not optimized away.
+    void checkBits(uint32_t bitSet) {
+        result=bitSet;
+        if(testcase.getBufferLen()>0 && result==0) {
+            fprintf(stderr, "error: TrieGetGC did not collect bits\n");
+        }
+    }
+
+    UTrie2 *trie2;
+    UCPTrie *fastTrie, *smallTrie, *fastTrie8;
+    uint32_t result;
+};
+
+class UTrie2GetGC : public TrieGetGC {
+protected:
+    UTrie2GetGC(const UTrie2PerfTest &testcase) : TrieGetGC(testcase) {}
+public:
+    static UPerfFunction* get(const UTrie2PerfTest &testcase) {
+        return new UTrie2GetGC(testcase);
+    }
+    virtual void call(UErrorCode* pErrorCode) {
+        const UChar *p=testcase.getBuffer();
+        const UChar *limit=p+testcase.getBufferLen();
+        UChar32 c;
+        uint16_t value;
+        uint32_t bitSet=0;
+        while(p<limit) {
+            UTRIE2_U16_NEXT16(trie2, p, limit, c, value);
+            bitSet|=(uint32_t)1<<value;
+        }
+        checkBits(bitSet);
+    }
+};
+
+class UCPTrieFastGetGC : public TrieGetGC {
+protected:
+    UCPTrieFastGetGC(const UTrie2PerfTest &testcase) : TrieGetGC(testcase) {}
+public:
+    static UPerfFunction* get(const UTrie2PerfTest &testcase) {
+        return new UCPTrieFastGetGC(testcase);
+    }
+    virtual void call(UErrorCode* pErrorCode) {
+        const UChar *p=testcase.getBuffer();
+        const UChar *limit=p+testcase.getBufferLen();
+        UChar32 c;
+        uint16_t value;
+        uint32_t bitSet=0;
+        while(p<limit) {
+            UCPTRIE_FAST_U16_NEXT(fastTrie, UCPTRIE_16, p, limit, c, value);
+            bitSet|=(uint32_t)1<<value;
+        }
+        checkBits(bitSet);
+    }
+};
+
+class UCPTrieFast8GetGC : public TrieGetGC {
+protected:
+    UCPTrieFast8GetGC(const UTrie2PerfTest &testcase) : TrieGetGC(testcase) {}
+public:
+    static UPerfFunction* get(const UTrie2PerfTest &testcase) {
+        return new UCPTrieFast8GetGC(testcase);
+    }
+    virtual void call(UErrorCode* pErrorCode) {
+        const UChar *p=testcase.getBuffer();
+        const UChar *limit=p+testcase.getBufferLen();
+        UChar32 c;
+        uint8_t value;
+        uint32_t bitSet=0;
+        while(p<limit) {
+            UCPTRIE_FAST_U16_NEXT(fastTrie8, UCPTRIE_8, p, limit, c, value);
+            bitSet|=(uint32_t)1<<value;
+        }
+        checkBits(bitSet);
+    }
+};
+
+class UCPTrieSmallGetGC : public TrieGetGC {
+protected:
+    UCPTrieSmallGetGC(const UTrie2PerfTest &testcase) : TrieGetGC(testcase) {}
+public:
+    static UPerfFunction* get(const UTrie2PerfTest &testcase) {
+        return new UCPTrieSmallGetGC(testcase);
+    }
+    virtual void call(UErrorCode* pErrorCode) {
+        const UChar *buffer=testcase.getBuffer();
+        int32_t length=testcase.getBufferLen();
+        UChar32 c;
+        int32_t i;
+        uint32_t bitSet=0;
+        for(i=0; i<length;) {
+            U16_NEXT(buffer, i, length, c);
+            bitSet|=(uint32_t)1<<UCPTRIE_SMALL_GET(smallTrie, UCPTRIE_16, c);
+        }
+        checkBits(bitSet);
+    }
+};
+
 UPerfFunction* UTrie2PerfTest::runIndexedTest(int32_t index, UBool exec, const char* &name, char* par) {
     switch (index) {
         case 0: name = "CheckFCD";              if (exec) return CheckFCD::get(*this); break;
         case 1: name = "ToNFC";                 if (exec) return ToNFC::get(*this); break;
         case 2: name = "GetBiDiClass";          if (exec) return GetBiDiClass::get(*this); break;
+        case 3: name = "GetGeneralCategory";    if (exec) return GetGeneralCategory::get(*this); break;
+        case 4: name = "ToLower";               if (exec) return ToLower::get(*this); break;
+        case 5: name = "UTrie2GetGC";           if (exec) return UTrie2GetGC::get(*this); break;
+        case 6: name = "UCPTrieFastGetGC";      if (exec) return UCPTrieFastGetGC::get(*this); break;
+        case 7: name = "UCPTrieFast8GetGC";     if (exec) return UCPTrieFast8GetGC::get(*this); break;
+        case 8: name = "UCPTrieSmallGetGC";     if (exec) return UCPTrieSmallGetGC::get(*this); break;
+        case 9: name = "GetGeneralCategoryBulk"; if (exec) return GetGeneralCategoryBulk::get(*this); break;
+        case 10: name = "GetGeneralCategoryBulkUTF8"; if (exec) return GetGeneralCategoryBulkUTF8::get(*this); break;
 #if 0  // See comment at unorm_initUTrie2() forward declaration.
-        case 3: name = "CheckFCDAlwaysGet";     if (exec) return CheckFCDAlwaysGet::get(*this); break;
-        case 4: name = "CheckFCDUTF8";          if (exec) return CheckFCDUTF8::get(*this); break;
+        case 11: name = "CheckFCDAlwaysGet";    if (exec) return CheckFCDAlwaysGet::get(*this); break;
+        case 12: name = "CheckFCDUTF8";         if (exec) return CheckFCDUTF8::get(*this); break;
 #endif
         default: name = ""; break;
     }
@@ -22,4 +22,12 @@ for file in udhr_eng.txt \
 # $PERF CheckFCDUTF8        -f ~/udhr/$file -v -e UTF-8 --passes 3 --iterations 30000
   $PERF ToNFC               -f ~/udhr/$file -v -e UTF-8 --passes 3 --iterations 30000
   $PERF GetBiDiClass        -f ~/udhr/$file -v -e UTF-8 --passes 3 --iterations 30000
+  $PERF GetGeneralCategory  -f ~/udhr/$file -v -e UTF-8 --passes 3 --iterations 30000
+  $PERF GetGeneralCategoryBulk     -f ~/udhr/$file -v -e UTF-8 --passes 3 --iterations 30000
+  $PERF GetGeneralCategoryBulkUTF8 -f ~/udhr/$file -v -e UTF-8 --passes 3 --iterations 30000
+  $PERF ToLower             -f ~/udhr/$file -v -e UTF-8 --passes 3 --iterations 30000
+  $PERF UTrie2GetGC         -f ~/udhr/$file -v -e UTF-8 --passes 3 --iterations 30000
+  $PERF UCPTrieFastGetGC    -f ~/udhr/$file -v -e UTF-8 --passes 3 --iterations 30000
+  $PERF UCPTrieFast8GetGC   -f ~/udhr/$file -v -e UTF-8 --passes 3 --iterations 30000
+  $PERF UCPTrieSmallGetGC   -f ~/udhr/$file -v -e UTF-8 --passes 3 --iterations 30000
 done
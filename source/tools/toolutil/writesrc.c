@@ -1,7 +1,7 @@
 /*
 *******************************************************************************
 *
-*   Copyright (C) 2005-2012, International Business Machines
+*   Copyright (C) 2005-2016, International Business Machines
 *   Corporation and others.  All Rights Reserved.
 *
 *******************************************************************************
@@ -222,6 +222,46 @@ usrc_writeUTrie2Struct(FILE *f,
     }
 }
 
+U_CAPI void U_EXPORT2
+usrc_writeUCPTrieArrays(FILE *f,
+                        const char *indexPrefix, const char *dataPrefix,
+                        const UCPTrie *pTrie,
+                        const char *postfix) {
+    int32_t width=
+        pTrie->valueWidth==UCPTRIE_VALUE_BITS_16 ? 16 :
+        pTrie->valueWidth==UCPTRIE_VALUE_BITS_32 ? 32 : 8;
+    usrc_writeArray(f, indexPrefix, pTrie->index, 16, pTrie->indexLength, postfix);
+    usrc_writeArray(f, dataPrefix, pTrie->data.ptr0, width, pTrie->dataLength, postfix);
+}
+
+U_CAPI void U_EXPORT2
+usrc_writeUCPTrieStruct(FILE *f,
+                        const char *prefix,
+                        const UCPTrie *pTrie,
+                        const char *indexName, const char *dataName,
+                        const char *postfix) {
+    if(prefix!=NULL) {
+        fputs(prefix, f);
+    }
+    fprintf(
+        f,
+        "    %s,\n"         /* index */
+        "    { %s },\n"     /* data (const void *) */
+        "    %ld,\n"        /* indexLength */
+        "    %ld,\n"        /* dataLength */
+        "    0x%lx,\n"      /* highStart */
+        "    %d,\n"         /* type */
+        "    %d,\n"         /* valueWidth */
+        "    0, NULL\n",    /* padding, memory */
+        indexName, dataName,
+        (long)pTrie->indexLength, (long)pTrie->dataLength,
+        (long)pTrie->highStart,
+        (int)pTrie->type, (int)pTrie->valueWidth);
+    if(postfix!=NULL) {
+        fputs(postfix, f);
+    }
+}
+
 U_CAPI void U_EXPORT2
 usrc_writeArrayOfMostlyInvChars(FILE *f,
                                 const char *prefix,
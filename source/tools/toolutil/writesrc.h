@@ -1,7 +1,7 @@
 /*
 *******************************************************************************
 *
-*   Copyright (C) 2005-2012, International Business Machines
+*   Copyright (C) 2005-2016, International Business Machines
 *   Corporation and others.  All Rights Reserved.
 *
 *******************************************************************************
@@ -21,6 +21,7 @@
 
 #include <stdio.h>
 #include "unicode/utypes.h"
+#include "ucptrie.h"
 #include "utrie2.h"
 
 /**
@@ -73,6 +74,28 @@ usrc_writeUTrie2Struct(FILE *f,
                        const char *indexName, const char *dataName,
                        const char *postfix);
 
+/**
+ * Calls usrc_writeArray() for the index and data arrays of an immutable UCPTrie.
+ * The data array is written with the trie's value width.
+ */
+U_CAPI void U_EXPORT2
+usrc_writeUCPTrieArrays(FILE *f,
+                        const char *indexPrefix, const char *dataPrefix,
+                        const UCPTrie *pTrie,
+                        const char *postfix);
+
+/**
+ * Writes the UCPTrie struct values.
+ * The {} and declaration etc. need to be included in prefix/postfix or
+ * printed before and after the array contents.
+ */
+U_CAPI void U_EXPORT2
+usrc_writeUCPTrieStruct(FILE *f,
+                        const char *prefix,
+                        const UCPTrie *pTrie,
+                        const char *indexName, const char *dataName,
+                        const char *postfix);
+
 /**
  * Writes the contents of an array of mostly invariant characters.
  * Characters 0..0x1f are printed as numbers,